@@ -0,0 +1,102 @@
+/**
+ * @file benchmarks/capstone2llvmir/translation_benchmarks.cpp
+ * @brief Microbenchmarks for the Capstone to LLVM IR translation loops.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include "benchmark.h"
+#include "retdec/capstone2llvmir/capstone2llvmir.h"
+
+using namespace retdec::benchmark;
+using namespace retdec::capstone2llvmir;
+
+namespace {
+
+// A representative x86-32 basic block: prologue, loop with memory accesses
+// and arithmetic, epilogue. Pre-assembled so the benchmark does not depend
+// on keystone.
+const std::vector<std::uint8_t>& x86CodeBlock()
+{
+	static const std::vector<std::uint8_t> code = {
+		0x55,                               // push ebp
+		0x89, 0xe5,                         // mov ebp, esp
+		0x83, 0xec, 0x10,                   // sub esp, 0x10
+		0x31, 0xc0,                         // xor eax, eax
+		0x8b, 0x4d, 0x08,                   // mov ecx, [ebp+0x8]
+		0x8b, 0x55, 0x0c,                   // mov edx, [ebp+0xc]
+		0x01, 0xd0,                         // add eax, edx
+		0x0f, 0xaf, 0xc1,                   // imul eax, ecx
+		0x89, 0x45, 0xfc,                   // mov [ebp-0x4], eax
+		0x83, 0xc1, 0x01,                   // add ecx, 1
+		0x39, 0xd1,                         // cmp ecx, edx
+		0xc1, 0xe8, 0x02,                   // shr eax, 2
+		0x29, 0xc8,                         // sub eax, ecx
+		0x8d, 0x44, 0x11, 0x05,             // lea eax, [ecx+edx+0x5]
+		0x89, 0xec,                         // mov esp, ebp
+		0x5d,                               // pop ebp
+		0xc3,                               // ret
+	};
+	return code;
+}
+
+/**
+ * Translates the given code block in a loop; the translated IR is thrown
+ * away with the function after every iteration so the module does not grow.
+ */
+void translateInLoop(State& state, const std::vector<std::uint8_t>& code)
+{
+	llvm::LLVMContext context;
+	llvm::Module module("benchmark", context);
+	auto translator = Capstone2LlvmIrTranslator::createX86_32(&module);
+
+	while (state.keepRunning())
+	{
+		auto* function = llvm::Function::Create(
+				llvm::FunctionType::get(
+						llvm::Type::getVoidTy(context), false),
+				llvm::GlobalValue::ExternalLinkage,
+				"benchmark_function",
+				&module);
+		auto* block = llvm::BasicBlock::Create(context, "entry", function);
+		llvm::IRBuilder<> irb(block);
+		irb.CreateRetVoid();
+		irb.SetInsertPoint(block->getTerminator());
+
+		auto result = translator->translate(code, 0x1000, irb);
+		doNotOptimize(result.size);
+
+		function->eraseFromParent();
+	}
+	state.setBytesProcessed(code.size());
+}
+
+} // anonymous namespace
+
+BENCHMARK(capstone2llvmir_x86_translateBlock)
+{
+	translateInLoop(state, x86CodeBlock());
+}
+
+BENCHMARK(capstone2llvmir_x86_translateLarge)
+{
+	// The same block repeated -- approximates a long straight-line function
+	// and amortizes the per-call setup.
+	std::vector<std::uint8_t> code;
+	for (int i = 0; i < 64; ++i)
+	{
+		// Without the final ret so the block keeps going.
+		code.insert(code.end(), x86CodeBlock().begin(),
+				x86CodeBlock().end() - 1);
+	}
+	code.push_back(0xc3); // ret
+	translateInLoop(state, code);
+}
@@ -0,0 +1,36 @@
+/* Recursion, loops and integer arithmetic -- exercises control-flow
+ * reconstruction and the backend loop optimizations. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned long long fib_rec(unsigned n)
+{
+	return n < 2 ? n : fib_rec(n - 1) + fib_rec(n - 2);
+}
+
+static unsigned long long fib_iter(unsigned n)
+{
+	unsigned long long a = 0, b = 1;
+	while (n--) {
+		unsigned long long t = a + b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned n = argc > 1 ? (unsigned)atoi(argv[1]) : 30;
+	unsigned i;
+
+	for (i = 0; i <= n; ++i) {
+		if (fib_rec(i % 20) != fib_iter(i % 20)) {
+			fprintf(stderr, "mismatch at %u\n", i);
+			return 1;
+		}
+	}
+	printf("fib(%u) = %llu\n", n, fib_iter(n));
+	return 0;
+}
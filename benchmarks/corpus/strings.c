@@ -0,0 +1,34 @@
+/* String handling and a table of literals -- exercises data-section
+ * analysis, string detection and library function recognition. */
+
+#include <stdio.h>
+#include <string.h>
+
+static const char *words[] = {
+	"alpha", "bravo", "charlie", "delta", "echo", "foxtrot",
+	"golf", "hotel", "india", "juliett", "kilo", "lima",
+};
+
+static unsigned hash(const char *s)
+{
+	unsigned h = 5381;
+	while (*s)
+		h = h * 33 + (unsigned char)*s++;
+	return h;
+}
+
+int main(void)
+{
+	char buffer[256] = "";
+	unsigned i, total = 0;
+
+	for (i = 0; i < sizeof(words) / sizeof(words[0]); ++i) {
+		total += hash(words[i]);
+		if (strlen(buffer) + strlen(words[i]) + 2 < sizeof(buffer)) {
+			strcat(buffer, words[i]);
+			strcat(buffer, " ");
+		}
+	}
+	printf("%s-> %u\n", buffer, total);
+	return 0;
+}
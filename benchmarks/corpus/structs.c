@@ -0,0 +1,56 @@
+/* Structures, arrays of structures and pointer walks -- exercises type
+ * reconstruction and stack/data-flow analyses. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+struct point {
+	double x, y;
+};
+
+struct shape {
+	struct point center;
+	struct point vertices[8];
+	unsigned count;
+	struct shape *next;
+};
+
+static double area(const struct shape *s)
+{
+	double sum = 0;
+	unsigned i;
+	for (i = 0; i < s->count; ++i) {
+		const struct point *a = &s->vertices[i];
+		const struct point *b = &s->vertices[(i + 1) % s->count];
+		sum += a->x * b->y - b->x * a->y;
+	}
+	return sum < 0 ? -sum / 2 : sum / 2;
+}
+
+int main(void)
+{
+	struct shape *head = NULL;
+	double total = 0;
+	unsigned i, j;
+
+	for (i = 0; i < 64; ++i) {
+		struct shape *s = calloc(1, sizeof(*s));
+		if (!s)
+			return 1;
+		s->count = 3 + i % 6;
+		for (j = 0; j < s->count; ++j) {
+			s->vertices[j].x = (double)((i + j * 7) % 13);
+			s->vertices[j].y = (double)((i * 3 + j) % 11);
+		}
+		s->next = head;
+		head = s;
+	}
+	while (head) {
+		struct shape *next = head->next;
+		total += area(head);
+		free(head);
+		head = next;
+	}
+	printf("total area: %f\n", total);
+	return 0;
+}
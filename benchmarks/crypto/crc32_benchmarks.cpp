@@ -0,0 +1,58 @@
+/**
+ * @file benchmarks/crypto/crc32_benchmarks.cpp
+ * @brief Microbenchmarks for the CRC32 implementation.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark.h"
+#include "retdec/crypto/crc32.h"
+
+using namespace retdec::benchmark;
+
+namespace {
+
+std::vector<std::uint8_t> makeBytes(std::size_t size)
+{
+	std::mt19937 generator(42);
+	std::vector<std::uint8_t> bytes(size);
+	for (auto& byte : bytes)
+	{
+		byte = generator() & 0xFF;
+	}
+	return bytes;
+}
+
+void crc32OfSize(State& state, std::size_t size)
+{
+	const auto bytes = makeBytes(size);
+	while (state.keepRunning())
+	{
+		CRC32 crc;
+		crc.add(bytes.data(), bytes.size());
+		doNotOptimize(crc.getHash());
+	}
+	state.setBytesProcessed(bytes.size());
+}
+
+} // anonymous namespace
+
+// Small inputs stay on the slice-by-8 path.
+BENCHMARK(crc32_32B)
+{
+	crc32OfSize(state, 32);
+}
+
+// Large inputs take the hardware (carry-less multiplication) path.
+BENCHMARK(crc32_4K)
+{
+	crc32OfSize(state, 0x1000);
+}
+
+BENCHMARK(crc32_1M)
+{
+	crc32OfSize(state, 0x100000);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file benchmarks/demangler/demangler_benchmarks.cpp
+ * @brief Microbenchmarks for the demangler parsers.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "retdec/demangler/demangler.h"
+
+using namespace retdec::benchmark;
+using namespace retdec::demangler;
+
+namespace {
+
+// Names taken from the demangler unit tests -- a mix of short, template-heavy
+// and operator names, as found in real symbol tables.
+const std::vector<std::string>& gccNames()
+{
+	static const std::vector<std::string> names = {
+		"__ZN1A1B6myFuncEii",
+		"_ZN5cGram9printableEN5cName5ntypeE",
+		"_ZNSt6vectorIPN5cGram7gelem_tESaIS2_EE13_M_insert_auxEN9"
+			"__gnu_cxx17__normal_iteratorIPS2_S4_EERKS2_",
+		"_ZN9__gnu_cxx17__normal_iteratorIPSsSt6vectorISsSaISsEEEC1ERKS1_",
+		"_ZStplIcSt11char_traitsIcESaIcEESbIT_T0_T1_ERKS6_S8_",
+		"_Znwj",
+		"_ZdlPv",
+		"_ZNSs4_Rep10_M_disposeERKSaIcE",
+	};
+	return names;
+}
+
+const std::vector<std::string>& msvcNames()
+{
+	static const std::vector<std::string> names = {
+		"?myFunc@B@A@@QAEXHH@Z",
+		"??0exception@std@@QAE@ABQBD@Z",
+		"??$?6U?$char_traits@D@std@@@std@@YAAAV?$basic_ostream@DU?$"
+			"char_traits@D@std@@@0@AAV10@PBD@Z",
+		"??2@YAPAXI@Z",
+		"?insert@?$vector@HV?$allocator@H@std@@@std@@QAEXV?$"
+			"_Vector_iterator@HV?$allocator@H@std@@@2@II@Z",
+	};
+	return names;
+}
+
+} // anonymous namespace
+
+BENCHMARK(demangler_gcc_mixedNames)
+{
+	CDemangler gcc("gcc");
+	const auto& names = gccNames();
+	std::size_t i = 0;
+	while (state.keepRunning())
+	{
+		doNotOptimize(gcc.demangleToString(names[i++ % names.size()]));
+	}
+}
+
+BENCHMARK(demangler_msvc_mixedNames)
+{
+	CDemangler msvc("ms");
+	const auto& names = msvcNames();
+	std::size_t i = 0;
+	while (state.keepRunning())
+	{
+		doNotOptimize(msvc.demangleToString(names[i++ % names.size()]));
+	}
+}
+
+// Symbol tables are dominated by names that are not mangled at all -- the
+// early rejection path matters as much as the successful parse.
+BENCHMARK(demangler_gcc_unmangledName)
+{
+	CDemangler gcc("gcc");
+	const std::string name = "main";
+	while (state.keepRunning())
+	{
+		doNotOptimize(gcc.demangleToString(name));
+	}
+}
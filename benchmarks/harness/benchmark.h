@@ -0,0 +1,196 @@
+/**
+ * @file benchmarks/harness/benchmark.h
+ * @brief Minimal header-only microbenchmark harness.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef BENCHMARKS_HARNESS_BENCHMARK_H
+#define BENCHMARKS_HARNESS_BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace retdec {
+namespace benchmark {
+
+/**
+ * Prevents the compiler from optimizing away a computed value.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile char sink;
+	sink = *reinterpret_cast<const volatile char*>(&value);
+#endif
+}
+
+/**
+ * State of one benchmark run, handed to the benchmark function.
+ *
+ * The benchmark body loops <tt>while (state.keepRunning())</tt>; the harness
+ * re-runs it with a growing iteration count until the run takes long enough
+ * to measure reliably. setBytesProcessed() makes the harness print a
+ * throughput column.
+ */
+class State
+{
+	public:
+		State(std::uint64_t iterationCount) :
+				remaining(iterationCount), iterationCount(iterationCount)
+		{
+		}
+
+		bool keepRunning()
+		{
+			return remaining-- > 0;
+		}
+
+		std::uint64_t iterations() const
+		{
+			return iterationCount;
+		}
+
+		/// Sets the number of bytes processed by one iteration.
+		void setBytesProcessed(std::uint64_t bytes)
+		{
+			bytesPerIteration = bytes;
+		}
+
+		std::uint64_t getBytesProcessed() const
+		{
+			return bytesPerIteration;
+		}
+
+	private:
+		std::uint64_t remaining;         ///< iterations left in this run
+		std::uint64_t iterationCount;    ///< total iterations of this run
+		std::uint64_t bytesPerIteration = 0; ///< bytes one iteration processes
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+/**
+ * One registered benchmark.
+ */
+struct Benchmark
+{
+	const char* name;            ///< name printed in the report
+	BenchmarkFunction function;  ///< the measured function
+};
+
+inline std::vector<Benchmark>& getRegistry()
+{
+	static std::vector<Benchmark> registry;
+	return registry;
+}
+
+/**
+ * Registers a benchmark on construction -- used by the BENCHMARK() macro.
+ */
+struct Registrar
+{
+	Registrar(const char* name, BenchmarkFunction function)
+	{
+		getRegistry().push_back({name, function});
+	}
+};
+
+/**
+ * Runs all registered benchmarks and prints a report to standard output
+ * @param argc Argument count from main()
+ * @param argv Argument vector from main(); an argument selects benchmarks
+ *             whose name contains it as a substring
+ * @return Exit code for main()
+ */
+inline int runAllBenchmarks(int argc, char** argv)
+{
+	using Clock = std::chrono::steady_clock;
+
+	// Run each benchmark for at least this long to get a stable number.
+	const double minSeconds = 0.25;
+
+	std::printf("%-45s %15s %12s %12s\n",
+			"benchmark", "iterations", "ns/iter", "MB/s");
+
+	for (const auto& benchmark : getRegistry())
+	{
+		bool selected = argc < 2;
+		for (int i = 1; i < argc; ++i)
+		{
+			selected = selected
+					|| std::strstr(benchmark.name, argv[i]) != nullptr;
+		}
+		if (!selected)
+		{
+			continue;
+		}
+
+		std::uint64_t iterations = 1;
+		double seconds = 0;
+		std::uint64_t bytesPerIteration = 0;
+		for (;;)
+		{
+			State state(iterations);
+			const auto start = Clock::now();
+			benchmark.function(state);
+			seconds = std::chrono::duration<double>(
+					Clock::now() - start).count();
+			bytesPerIteration = state.getBytesProcessed();
+			if (seconds >= minSeconds)
+			{
+				break;
+			}
+			// Aim past the minimum time, at least doubling.
+			const auto factor = seconds > 0
+					? 2 * minSeconds / seconds : 100.0;
+			iterations = factor > 2
+					? static_cast<std::uint64_t>(iterations * factor)
+					: 2 * iterations;
+		}
+
+		const double nsPerIteration = seconds * 1e9 / iterations;
+		if (bytesPerIteration)
+		{
+			const double mbPerSecond
+					= bytesPerIteration * iterations / seconds / 1e6;
+			std::printf("%-45s %15llu %12.1f %12.1f\n", benchmark.name,
+					static_cast<unsigned long long>(iterations),
+					nsPerIteration, mbPerSecond);
+		}
+		else
+		{
+			std::printf("%-45s %15llu %12.1f %12s\n", benchmark.name,
+					static_cast<unsigned long long>(iterations),
+					nsPerIteration, "-");
+		}
+		std::fflush(stdout);
+	}
+
+	return 0;
+}
+
+} // namespace benchmark
+} // namespace retdec
+
+/// Defines and registers a benchmark function.
+#define BENCHMARK(function) \
+	static void function(::retdec::benchmark::State&); \
+	static ::retdec::benchmark::Registrar \
+			registrarFor_##function(#function, &function); \
+	static void function(::retdec::benchmark::State& state)
+
+/// Defines the main() function running all registered benchmarks.
+#define BENCHMARK_MAIN() \
+	int main(int argc, char** argv) \
+	{ \
+		return ::retdec::benchmark::runAllBenchmarks(argc, argv); \
+	}
+
+#endif
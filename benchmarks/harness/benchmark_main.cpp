@@ -0,0 +1,9 @@
+/**
+ * @file benchmarks/harness/benchmark_main.cpp
+ * @brief main() for the microbenchmark executables (like gmock_main).
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "benchmark.h"
+
+BENCHMARK_MAIN()
@@ -0,0 +1,293 @@
+#!/usr/bin/env python3
+"""End-to-end performance benchmark suite for RetDec.
+
+Runs the installed tools over the corpus described by corpus/corpus.json and
+measures, per input and per stage:
+
+  - wall time (minimum over --runs repetitions),
+  - peak RSS of the whole process,
+  - retired instruction count (via perf, when available),
+  - per-phase times reported by the tools themselves (RETDEC_PROFILE).
+
+The stages are:
+
+  fileinfo    retdec-fileinfo --verbose --json  (fileformat parse + cpdetect)
+  decompile   retdec-decompiler.sh              (decode, bin2llvmir, llvmir2hll)
+
+The corpus binaries are compiled on the fly from the checked-in C sources, so
+no binary blobs live in the repository; entries may instead name a prebuilt
+binary to benchmark externally produced inputs.
+
+With --baseline, every wall-time and peak-RSS value is compared against the
+baseline file and the script exits with a non-zero status when a metric
+regresses by more than the threshold (per-metric thresholds can be stored in
+the baseline itself). --update-baseline (re)creates the baseline from the
+measured results.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+DEFAULT_RUNS = 3
+DEFAULT_THRESHOLD_PERCENT = 15.0
+
+
+def eprint(*args):
+    print(*args, file=sys.stderr)
+
+
+def find_tool(install_dir, name):
+    path = os.path.join(install_dir, 'bin', name)
+    if not os.path.isfile(path):
+        sys.exit('error: {} not found -- is {} a RetDec installation?'.format(
+            path, install_dir))
+    return path
+
+
+def build_corpus(corpus_file, cc, work_dir):
+    """Returns a list of (name, path-to-binary) to benchmark."""
+    corpus_dir = os.path.dirname(os.path.abspath(corpus_file))
+    with open(corpus_file) as f:
+        entries = json.load(f)
+
+    binaries = []
+    for entry in entries:
+        name = entry['name']
+        if 'binary' in entry:
+            binaries.append((name, os.path.join(corpus_dir, entry['binary'])))
+            continue
+
+        if not cc:
+            eprint('skipping {}: no C compiler available'.format(name))
+            continue
+        source = os.path.join(corpus_dir, entry['source'])
+        output = os.path.join(work_dir, name)
+        cmd = [cc] + entry.get('cc_flags', []) + ['-o', output, source]
+        try:
+            subprocess.check_call(cmd)
+        except (OSError, subprocess.CalledProcessError) as e:
+            eprint('skipping {}: compilation failed ({})'.format(name, e))
+            continue
+        binaries.append((name, output))
+
+    if not binaries:
+        sys.exit('error: the corpus is empty')
+    return binaries
+
+
+def measure_command(cmd, env, perf):
+    """Runs cmd once; returns (wall_s, max_rss_kb, instructions or None)."""
+    instructions = None
+    perf_output = None
+    if perf:
+        perf_output = tempfile.NamedTemporaryFile(
+            mode='r', suffix='.perf', delete=False)
+        cmd = [perf, 'stat', '-x', ',', '-e', 'instructions',
+               '-o', perf_output.name] + cmd
+
+    start = time.perf_counter()
+    with open(os.devnull, 'wb') as devnull:
+        process = subprocess.Popen(cmd, env=env, stdout=devnull,
+                                   stderr=devnull)
+        if hasattr(os, 'wait4'):
+            _, status, rusage = os.wait4(process.pid, 0)
+            process.returncode = status  # keep Popen bookkeeping consistent
+            max_rss_kb = rusage.ru_maxrss
+            returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else 1
+        else:
+            returncode = process.wait()
+            max_rss_kb = None
+    wall = time.perf_counter() - start
+
+    if perf_output:
+        for line in perf_output.read().splitlines():
+            fields = line.split(',')
+            if len(fields) > 2 and fields[2] == 'instructions':
+                try:
+                    instructions = int(fields[0])
+                except ValueError:
+                    pass
+        perf_output.close()
+        os.unlink(perf_output.name)
+
+    if returncode != 0:
+        eprint('warning: command failed ({}): {}'.format(
+            returncode, ' '.join(cmd)))
+    return wall, max_rss_kb, instructions
+
+
+def collect_phase_reports(profile_dir):
+    """Merges the RETDEC_PROFILE reports written into profile_dir."""
+    phases = {}
+    for report in sorted(os.listdir(profile_dir)):
+        path = os.path.join(profile_dir, report)
+        try:
+            with open(path) as f:
+                data = json.load(f)
+        except ValueError:
+            continue
+        for phase in data.get('phases', []):
+            merged = phases.setdefault(
+                phase['name'], {'calls': 0, 'nanoseconds': 0})
+            merged['calls'] += phase['calls']
+            merged['nanoseconds'] += phase['nanoseconds']
+        os.unlink(path)
+    return phases
+
+
+def run_stage(cmd, runs, perf, profile_dir):
+    """Runs one benchmark stage; returns its result dictionary."""
+    env = dict(os.environ)
+    env['RETDEC_PROFILE'] = os.path.join(profile_dir, 'profile-%p.json')
+
+    best_wall = None
+    max_rss = None
+    instructions = None
+    phases = {}
+    for _ in range(runs):
+        for leftover in os.listdir(profile_dir):
+            os.unlink(os.path.join(profile_dir, leftover))
+        wall, rss, insns = measure_command(cmd, env, perf)
+        if best_wall is None or wall < best_wall:
+            best_wall = wall
+            phases = collect_phase_reports(profile_dir)
+        else:
+            collect_phase_reports(profile_dir)
+        if rss is not None:
+            max_rss = rss if max_rss is None else max(max_rss, rss)
+        if insns is not None:
+            instructions = insns if instructions is None \
+                else min(instructions, insns)
+
+    return {
+        'wall_s': round(best_wall, 6),
+        'max_rss_kb': max_rss,
+        'instructions': instructions,
+        'phases': phases,
+    }
+
+
+def compare_with_baseline(results, baseline, default_threshold):
+    """Returns a list of human-readable regression descriptions."""
+    threshold = baseline.get('thresholds', {})
+    time_limit = threshold.get('wall_percent', default_threshold)
+    rss_limit = threshold.get('rss_percent', default_threshold)
+
+    regressions = []
+    for name, stages in baseline.get('results', {}).items():
+        for stage, old in stages.items():
+            new = results.get(name, {}).get(stage)
+            if new is None:
+                regressions.append('{}/{}: missing from results'.format(
+                    name, stage))
+                continue
+            for metric, limit in (('wall_s', time_limit),
+                                  ('max_rss_kb', rss_limit)):
+                if not old.get(metric) or not new.get(metric):
+                    continue
+                change = 100.0 * (new[metric] - old[metric]) / old[metric]
+                if change > limit:
+                    regressions.append(
+                        '{}/{}: {} regressed by {:.1f}% '
+                        '({} -> {}, limit {:.1f}%)'.format(
+                            name, stage, metric, change,
+                            old[metric], new[metric], limit))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--install-dir', required=True,
+                        help='RetDec installation to benchmark')
+    parser.add_argument('--corpus',
+                        default=os.path.join(os.path.dirname(__file__),
+                                             'corpus', 'corpus.json'),
+                        help='corpus description file')
+    parser.add_argument('--output', default='benchmark-results.json',
+                        help='where to write the results')
+    parser.add_argument('--work-dir', default=None,
+                        help='directory for compiled corpus and outputs')
+    parser.add_argument('--baseline', default=None,
+                        help='baseline file to compare against')
+    parser.add_argument('--update-baseline', action='store_true',
+                        help='write the measured results to --baseline')
+    parser.add_argument('--threshold', type=float,
+                        default=DEFAULT_THRESHOLD_PERCENT,
+                        help='default regression threshold in percent')
+    parser.add_argument('--runs', type=int, default=DEFAULT_RUNS,
+                        help='repetitions per stage (minimum wall time wins)')
+    parser.add_argument('--cc', default=os.environ.get('CC') or
+                        shutil.which('cc') or shutil.which('gcc'),
+                        help='C compiler for building the corpus')
+    args = parser.parse_args()
+
+    fileinfo = find_tool(args.install_dir, 'retdec-fileinfo')
+    decompiler = find_tool(args.install_dir, 'retdec-decompiler.sh')
+    perf = shutil.which('perf')
+    if not perf:
+        eprint('note: perf not found, instruction counts will be null')
+
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix='retdec-bench-')
+    os.makedirs(work_dir, exist_ok=True)
+    profile_dir = os.path.join(work_dir, 'profiles')
+    os.makedirs(profile_dir, exist_ok=True)
+
+    binaries = build_corpus(args.corpus, args.cc, work_dir)
+
+    results = {}
+    for name, binary in binaries:
+        print('benchmarking {} ...'.format(name))
+        stages = {}
+        stages['fileinfo'] = run_stage(
+            [fileinfo, binary, '--verbose', '--json'],
+            args.runs, perf, profile_dir)
+        stages['decompile'] = run_stage(
+            [decompiler, binary,
+             '-o', os.path.join(work_dir, name + '.c')],
+            args.runs, perf, profile_dir)
+        results[name] = stages
+        for stage, result in sorted(stages.items()):
+            print('  {:10} {:8.3f}s  rss {} kB'.format(
+                stage, result['wall_s'], result['max_rss_kb']))
+
+    report = {
+        'runs': args.runs,
+        'install_dir': os.path.abspath(args.install_dir),
+        'results': results,
+    }
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+    print('results written to {}'.format(args.output))
+
+    if args.baseline and args.update_baseline:
+        baseline = {
+            'thresholds': {
+                'wall_percent': args.threshold,
+                'rss_percent': args.threshold,
+            },
+            'results': results,
+        }
+        with open(args.baseline, 'w') as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+        print('baseline written to {}'.format(args.baseline))
+    elif args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare_with_baseline(
+            results, baseline, args.threshold)
+        if regressions:
+            eprint('PERFORMANCE REGRESSIONS:')
+            for regression in regressions:
+                eprint('  ' + regression)
+            sys.exit(1)
+        print('no regressions against {}'.format(args.baseline))
+
+
+if __name__ == '__main__':
+    main()
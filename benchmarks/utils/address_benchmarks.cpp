@@ -0,0 +1,83 @@
+/**
+ * @file benchmarks/utils/address_benchmarks.cpp
+ * @brief Microbenchmarks for AddressRangeContainer operations.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <random>
+#include <vector>
+
+#include "benchmark.h"
+#include "retdec/utils/address.h"
+
+using namespace retdec::benchmark;
+using namespace retdec::utils;
+
+namespace {
+
+/// Container with @a count non-adjacent ranges of 0x100 bytes each.
+AddressRangeContainer makeContainer(std::size_t count)
+{
+	std::vector<AddressRange> ranges;
+	ranges.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		ranges.push_back(AddressRange(i * 0x200, i * 0x200 + 0x100));
+	}
+	return AddressRangeContainer(std::move(ranges));
+}
+
+} // anonymous namespace
+
+// The decode hot path: stab queries for candidate jump targets.
+BENCHMARK(addressRangeContainer_stab_1k)
+{
+	const auto container = makeContainer(1000);
+	std::mt19937 generator(42);
+	while (state.keepRunning())
+	{
+		doNotOptimize(container.getRange(generator() % (1000 * 0x200)));
+	}
+}
+
+BENCHMARK(addressRangeContainer_stab_100k)
+{
+	const auto container = makeContainer(100000);
+	std::mt19937 generator(42);
+	while (state.keepRunning())
+	{
+		doNotOptimize(container.getRange(
+				static_cast<std::uint64_t>(generator()) % (100000 * 0x200)));
+	}
+}
+
+// Decoded ranges are removed from the allowed ranges one by one.
+BENCHMARK(addressRangeContainer_insertRemove_1k)
+{
+	while (state.keepRunning())
+	{
+		auto container = makeContainer(1000);
+		std::mt19937 generator(42);
+		for (int i = 0; i < 100; ++i)
+		{
+			const auto start = generator() % (1000 * 0x200);
+			container.remove(start, start + 0x80);
+			container.insert(start + 0x20, start + 0x40);
+		}
+		doNotOptimize(container.size());
+	}
+}
+
+BENCHMARK(addressRangeContainer_bulkConstruction_100k)
+{
+	std::vector<AddressRange> ranges;
+	for (std::size_t i = 0; i < 100000; ++i)
+	{
+		ranges.push_back(AddressRange(i * 0x200, i * 0x200 + 0x100));
+	}
+	while (state.keepRunning())
+	{
+		AddressRangeContainer container(ranges);
+		doNotOptimize(container.size());
+	}
+}
@@ -0,0 +1,80 @@
+/**
+ * @file benchmarks/utils/allocator_benchmarks.cpp
+ * @brief Microbenchmarks for the bump arena and object pool.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <memory>
+
+#include "benchmark.h"
+#include "retdec/utils/allocator.h"
+
+using namespace retdec::benchmark;
+using namespace retdec::utils;
+
+namespace {
+
+/// Roughly symbol-sized payload.
+struct Payload
+{
+	char data[96];
+};
+
+} // anonymous namespace
+
+BENCHMARK(heap_newDelete_96B)
+{
+	while (state.keepRunning())
+	{
+		auto* payload = new Payload();
+		doNotOptimize(payload);
+		delete payload;
+	}
+}
+
+BENCHMARK(bumpArena_allocate_96B)
+{
+	BumpArena arena;
+	while (state.keepRunning())
+	{
+		BumpArena::Scope scope(arena);
+		doNotOptimize(arena.allocate(sizeof(Payload)));
+	}
+}
+
+BENCHMARK(objectPool_createDestroy_96B)
+{
+	ObjectPool<Payload> pool;
+	while (state.keepRunning())
+	{
+		auto* payload = pool.create();
+		doNotOptimize(payload);
+		pool.destroy(payload);
+	}
+}
+
+BENCHMARK(heap_makeShared_96B)
+{
+	while (state.keepRunning())
+	{
+		auto payload = std::make_shared<Payload>();
+		doNotOptimize(payload.get());
+	}
+}
+
+// The pattern used by PE/COFF symbol loading: shared objects and their
+// control blocks carved out of one arena.
+BENCHMARK(arenaAllocator_allocateShared_96B)
+{
+	auto arena = std::make_shared<BumpArena>();
+	ArenaAllocator<Payload> allocator(arena);
+	while (state.keepRunning())
+	{
+		const auto scopeState = arena->getState();
+		{
+			auto payload = std::allocate_shared<Payload>(allocator);
+			doNotOptimize(payload.get());
+		}
+		arena->rewind(scopeState);
+	}
+}
@@ -0,0 +1,82 @@
+/**
+ * @file benchmarks/utils/conversion_benchmarks.cpp
+ * @brief Microbenchmarks for the hex/byte conversion kernels.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "retdec/utils/conversion.h"
+
+using namespace retdec::benchmark;
+using namespace retdec::utils;
+
+namespace {
+
+std::vector<std::uint8_t> makeBytes(std::size_t size)
+{
+	std::mt19937 generator(42);
+	std::vector<std::uint8_t> bytes(size);
+	for (auto& byte : bytes)
+	{
+		byte = generator() & 0xFF;
+	}
+	return bytes;
+}
+
+} // anonymous namespace
+
+BENCHMARK(bytesToHexString_64B)
+{
+	const auto bytes = makeBytes(64);
+	std::string result;
+	while (state.keepRunning())
+	{
+		bytesToHexString(bytes.data(), bytes.size(), result);
+		doNotOptimize(result);
+	}
+	state.setBytesProcessed(bytes.size());
+}
+
+BENCHMARK(bytesToHexString_64K)
+{
+	const auto bytes = makeBytes(0x10000);
+	std::string result;
+	while (state.keepRunning())
+	{
+		bytesToHexString(bytes.data(), bytes.size(), result);
+		doNotOptimize(result);
+	}
+	state.setBytesProcessed(bytes.size());
+}
+
+// The generic template used for non-byte elements -- scalar lookup table.
+BENCHMARK(bytesToHexString_64K_wideElements)
+{
+	const auto bytes = makeBytes(0x10000);
+	const std::vector<std::uint64_t> wide(bytes.begin(), bytes.end());
+	std::string result;
+	while (state.keepRunning())
+	{
+		bytesToHexString(wide.data(), wide.size(), result);
+		doNotOptimize(result);
+	}
+	state.setBytesProcessed(bytes.size());
+}
+
+BENCHMARK(hexStringToBytes_64K)
+{
+	const auto bytes = makeBytes(0x10000);
+	std::string hex;
+	bytesToHexString(bytes.data(), bytes.size(), hex);
+	while (state.keepRunning())
+	{
+		auto result = hexStringToBytes(hex);
+		doNotOptimize(result);
+	}
+	state.setBytesProcessed(bytes.size());
+}
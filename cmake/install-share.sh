@@ -115,5 +115,21 @@ fi
 # Remove archive.
 rm -f "$SUPPORT_DIR/$ARCH_NAME"
 
+# Generate a manifest of YARA rule files in every directory that contains
+# some, so the tools can load the file list instead of enumerating the
+# directory on every run. Each line holds the size, the SHA-256 hash and the
+# name of one rule file.
+echo "Generating YARA rule manifests ..."
+find "$SUPPORT_DIR" -type d | while read -r RULE_DIR; do
+	MANIFEST="$RULE_DIR/yara-rules.manifest"
+	rm -f "$MANIFEST"
+	for RULE_FILE in "$RULE_DIR"/*.yar "$RULE_DIR"/*.yara; do
+		[ -f "$RULE_FILE" ] || continue
+		RULE_SIZE=$(wc -c < "$RULE_FILE" | tr -d ' ')
+		RULE_HASH=$(sha256hash "$RULE_FILE" | cut -d' ' -f1)
+		printf '%s\t%s\t%s\n' "$RULE_SIZE" "$RULE_HASH" "$(basename "$RULE_FILE")" >> "$MANIFEST"
+	done
+done
+
 echo "RetDec support directory downloaded OK"
 exit
@@ -67,10 +67,15 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 		/// @{
 		bool getNames(std::vector<std::string> &result,
 			std::string &errorMessage) const;
-		bool getCount(std::size_t &count, std::string &errorMessage) const;
+		bool buildNameIndex(std::string &errorMessage);
 		/// @}
 
 		std::size_t objectCount = 0; ///< Number of object files in archive.
+
+		/// Names of all object files, in archive order. Built once at
+		/// construction from member headers and the string table only, so
+		/// listing operations never touch member bodies.
+		std::vector<std::string> objectNames;
 };
 
 } // namespace ar_extractor
@@ -0,0 +1,96 @@
+/**
+* @file include/retdec/bin2llvmir/analyses/analysis_manager.h
+* @brief Per-function validity tracking for bin2llvmir analyses.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_ANALYSES_ANALYSIS_MANAGER_H
+#define RETDEC_BIN2LLVMIR_ANALYSES_ANALYSIS_MANAGER_H
+
+#include <cstdint>
+#include <map>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Module.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Tracks which functions were modified since an analysis result was computed.
+ *
+ * Passes report what they modified (the common mutation paths in
+ * @c IrModifier do this automatically), which bumps a per-function version
+ * counter. Analyses stamp their cached per-function results with the version
+ * at computation time and recompute only when the versions differ -- i.e.
+ * only for dirty functions, instead of from scratch for the whole module.
+ */
+class AnalysisManager
+{
+	public:
+		/// @name Modification reporting -- called by passes.
+		/// @{
+		static void reportModified(const llvm::Function* f);
+		static void reportModified(const llvm::Module* m);
+		/// @}
+
+		/// @name Validity queries -- called by analyses.
+		/// @{
+		static std::uint64_t getVersion(const llvm::Function* f);
+		/// @}
+
+		static void erase(const llvm::Module* m);
+		static void clear();
+
+	private:
+		/// Per-function modification counters.
+		static std::map<const llvm::Function*, std::uint64_t> _fncVersions;
+		/// Bumped instead of all per-function counters on module-wide
+		/// modifications (e.g. new functions, split functions).
+		static std::map<const llvm::Module*, std::uint64_t> _modVersions;
+};
+
+/**
+ * Per-function analysis result cache stamped with @c AnalysisManager
+ * versions.
+ *
+ * An analysis holds an instance of this class and asks it for per-function
+ * results -- @c compute is invoked only when there is no result for the
+ * function yet, or when the function was reported modified since the result
+ * was computed.
+ */
+template<typename Result>
+class FunctionAnalysisCache
+{
+	public:
+		template<typename Compute>
+		Result& get(llvm::Function* f, Compute compute)
+		{
+			auto version = AnalysisManager::getVersion(f);
+			auto fIt = _results.find(f);
+			if (fIt == _results.end() || fIt->second.first != version)
+			{
+				_results[f] = std::make_pair(version, compute(f));
+				fIt = _results.find(f);
+			}
+			return fIt->second.second;
+		}
+
+		void invalidate(const llvm::Function* f)
+		{
+			_results.erase(f);
+		}
+
+		void clear()
+		{
+			_results.clear();
+		}
+
+	private:
+		std::map<const llvm::Function*, std::pair<std::uint64_t, Result>> _results;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -83,7 +83,6 @@ class BasicBlockEntry
 				const BasicBlockEntry& bbe);
 
 		void initializeKillDefSets();
-		Changed initDefsOut();
 
 		const DefSet& defsFromUse(const llvm::Instruction* I) const;
 		const UseSet& usesFromDef(const llvm::Instruction* I) const;
@@ -103,8 +102,6 @@ class BasicBlockEntry
 		DefSet genDefs;
 		UnorderedValSet killDefs;
 
-		bool changed = false;
-
 	private:
 		unsigned id;
 	    static int newUID;
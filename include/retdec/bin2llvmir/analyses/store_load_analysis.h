@@ -340,6 +340,7 @@ public:
 	llvm::Instruction *getInstFromExtRUses(llvm::Value &leftOp,
 		llvm::Value &rightOp, llvm::Function &func);
 	InstSet getRUsesForLUse(llvm::Instruction &lUse);
+	bool isFuncOverBudget(llvm::Function &func) const;
 
 	void printFuncInfos();
 	void printFuncInfo(llvm::Function &func);
@@ -496,6 +497,8 @@ private:
 	void processFunc(llvm::Function &func);
 	void goThroughBBsAndAnalyzeThem(llvm::Function &func);
 	void afterAnalysisBBsInFunc();
+	bool isCurrFuncOverBudget() const;
+	void degradeCurrFuncInfo();
 	void visitBBsInSCC();
 	void visitBBNotInSCC();
 	void spreadNotGoThroughInSCC();
@@ -578,6 +581,17 @@ private:
 
 	/// Current basic block info.
 	BBInfo *currBBInfo;
+
+	/// Work budget (in basic block visits) for the currently analyzed
+	/// function.
+	std::size_t currFuncBBVisitBudget;
+
+	/// Basic block visits spent on the currently analyzed function.
+	std::size_t currFuncBBVisits;
+
+	/// Functions whose analysis exceeded its budget and was degraded to a
+	/// conservative approximation.
+	FuncSet funcsOverBudget;
 };
 
 } // namespace bin2llvmir
@@ -7,6 +7,8 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_CFG_FUNCTION_DETECTION_CFG_FUNCTION_DETECTION_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_CFG_FUNCTION_DETECTION_CFG_FUNCTION_DETECTION_H
 
+#include <map>
+
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
@@ -31,11 +33,15 @@ class CfgFunctionDetection : public llvm::ModulePass
 		bool runOne();
 		bool isArmDataInCode(AsmInstruction& ai);
 		llvm::Instruction* isPotentialSplitInstruction(llvm::Instruction* i);
+		bool isExitWrapper(llvm::Function* f);
 
 	private:
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
 		FileImage* _image = nullptr;
+		/// Memoized results of @c isExitWrapper() -- the entry basic block
+		/// of a callee is inspected once, not on every call site.
+		std::map<llvm::Function*, bool> _exitWrappers;
 };
 
 } // namespace bin2llvmir
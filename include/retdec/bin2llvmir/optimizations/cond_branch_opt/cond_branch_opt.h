@@ -7,6 +7,7 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_COND_BRANCH_OPT_COND_BRANCH_OPT_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_COND_BRANCH_OPT_COND_BRANCH_OPT_H
 
+#include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
@@ -26,6 +27,9 @@ class CondBranchOpt : public llvm::ModulePass
 	private:
 		bool run();
 		bool runOnFunction(ReachingDefinitionsAnalysis& RDA, llvm::Function* f);
+		bool transformConditionalBranch(
+				ReachingDefinitionsAnalysis& RDA,
+				llvm::BranchInst* br);
 
 	private:
 		llvm::Module* _module = nullptr;
@@ -8,6 +8,7 @@
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_CONTROL_FLOW_CONTROL_FLOW_H
 
 #include <llvm/IR/Module.h>
+#include <llvm/IR/ValueHandle.h>
 #include <llvm/Pass.h>
 
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
@@ -58,10 +59,20 @@ class ControlFlow : public llvm::ModulePass
 		bool runPowerpcCall(AsmInstruction& ai);
 
 		bool runGeneric();
-		bool runGenericFunction(llvm::Function* f);
+		void collectPseudoCalls();
 		bool runGenericBr(AsmInstruction& ai, llvm::CallInst* call);
 		bool runGenericCondBr(AsmInstruction& ai, llvm::CallInst* call);
 
+		struct JmpTableData
+		{
+				/// Values of the table entries, in order.
+				std::vector<retdec::utils::Address> targets;
+				/// Byte size of one table entry.
+				unsigned entrySize = 0;
+		};
+
+		const JmpTableData& readJmpTable(retdec::utils::Address tableAddr);
+
 		llvm::ReturnInst* transformToReturn(
 				AsmInstruction& ai,
 				llvm::CallInst* call = nullptr);
@@ -104,6 +115,23 @@ class ControlFlow : public llvm::ModulePass
 		std::set<std::pair<llvm::CallInst*, AsmInstruction>> _toBr;
 		std::set<std::pair<llvm::CallInst*, AsmInstruction>> _toCondBr;
 		std::list<SwitchEntry> _toSwitch;
+
+		/// Worklist of pseudo branch calls that are not resolved yet.
+		/// Seeded by one module scan on the first runGeneric() run; later
+		/// runs process only these instead of rescanning the whole module.
+		/// Value handles, because other transformations (e.g. the second
+		/// ARM pass) may erase a pending call -- such entries turn null.
+		std::vector<llvm::WeakVH> _pseudoCallWorklist;
+
+		/// Has the worklist been seeded already?
+		bool _pseudoCallsCollected = false;
+
+		/// Cache of raw jump-table reads from the image, keyed by the table
+		/// address. Image data never changes during the run, so the entries
+		/// stay valid; pseudo branches sharing one table (and repeated runs
+		/// of this pass) re-validate it against the module without reading
+		/// the image entry by entry again.
+		std::map<retdec::utils::Address, JmpTableData> _jmpTableCache;
 };
 
 } // namespace bin2llvmir
@@ -38,6 +38,19 @@ class Decoder : public llvm::ModulePass
 				FileImage* o,
 				DebugFormat* d);
 
+		/// @name Decode-on-demand API.
+		///
+		/// Used together with lazy decoding
+		/// (@c config::Parameters::isLazyDecoding()) -- later analyses may
+		/// ask the decoder to decode an address (e.g. a call target) that
+		/// was not reachable from the seeded entry points. The pass instance
+		/// must be kept alive (@c runOnModuleCustom()) for this to work.
+		/// @{
+		bool decodeOnDemand(
+				retdec::utils::Address a,
+				const std::string& name = "");
+		/// @}
+
 	public:
 		class JumpTarget
 		{
@@ -307,6 +320,7 @@ class Decoder : public llvm::ModulePass
 		void initRangesAndTargets();
 		void initAllowedRangesWithSegments();
 		void initAllowedRangesWithConfig();
+		bool isSelectionAuthoritative() const;
 		void initJumpTargets();
 		void initJumpTargetsWithStaticCode();
 		void removeZeroSequences(retdec::utils::AddressRangeContainer& rs);
@@ -314,6 +328,8 @@ class Decoder : public llvm::ModulePass
 		void doDecoding();
 		bool looksLikeValidJumpTarget(retdec::utils::Address addr);
 
+		void preDecodeJumpTargets();
+
 		void doStaticCodeRecognition();
 
 		retdec::utils::Address getJumpTarget(llvm::Value* val);
@@ -328,9 +344,12 @@ class Decoder : public llvm::ModulePass
 		void removeStaticallyLinkedFunctions();
 		void hackDeleteKnownLinkedFunctions();
 
+		void computeFunctionHashes();
+
 		void fixMipsDelaySlots();
 
 		bool isArmOrThumb() const;
+		bool getCapstoneArchBasicMode(cs_arch& arch, cs_mode& basicMode) const;
 		cs_mode getUnknownMode() const;
 		cs_mode determineMode(AsmInstruction ai, retdec::utils::Address target) const;
 
@@ -357,6 +376,11 @@ class Decoder : public llvm::ModulePass
 
 		std::size_t decodingChunk = 0x50;
 
+		/// Jump targets whose bytes could not be disassembled even once in
+		/// the parallel pre-decode stage. Translation of such targets would
+		/// fail anyway, so the main decoding loop skips them right away.
+		std::set<retdec::utils::Address> _undecodableTargets;
+
 		std::map<llvm::Function*, std::pair<retdec::utils::Address, retdec::utils::Address>> _functions;
 
 		/// <ordinal number, function name>
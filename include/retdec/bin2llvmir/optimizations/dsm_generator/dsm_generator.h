@@ -7,7 +7,9 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DSM_GENERATOR_DSM_GENERATOR_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DSM_GENERATOR_DSM_GENERATOR_H
 
+#include <cstdint>
 #include <ostream>
+#include <string>
 
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
@@ -53,9 +55,10 @@ class DsmGenerator : public llvm::ModulePass
 				std::ostream& ret);
 		void generateAlignedAddress(
 				retdec::utils::Address addr,
-				std::ostream& ret);
+				std::string& ret);
 
-		void getAsmInstructionHex(AsmInstruction& ai, std::ostream& ret);
+		static void appendHexByte(std::string& str, std::uint8_t byte);
+		void getAsmInstructionHex(AsmInstruction& ai, std::string& ret);
 		std::string processInstructionDsm(AsmInstruction& ai);
 		void generateData(
 				std::ostream& ret,
@@ -79,6 +82,9 @@ class DsmGenerator : public llvm::ModulePass
 		FileImage* _objf = nullptr;
 		std::size_t _longestInst = 0;
 		std::size_t _longestAddr = 0;
+		/// Reusable buffer -- lines are assembled here and written to the
+		/// output stream in one piece.
+		std::string _line;
 		std::map<retdec::utils::Address, retdec::config::Function*> _addr2fnc;
 
 		const std::size_t DATA_SEGMENT_LINE    = 16;
@@ -131,6 +131,8 @@ private:
 	void solveLastLUsesForIndirectCalls();
 	void goThroughLastLUsesAndSolveIndirectCalls(llvm::Function &func,
 		const AnalysisInfo::ValInstSetMap &extRUses);
+	void filterUsesInFuncsOverBudget(llvm::Module &module,
+		const GlobVarSet &globs);
 	void filterUsesThatCannotBeOptimized();
 	bool goThroughFuncsInfoFilterAndReturnIfChanged(
 		InstSet &lUsesNotToOptimize,
@@ -8,6 +8,8 @@
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_IDIOMS_IDIOMS_ANALYSIS_H
 
 #include <cstdio>
+#include <unordered_map>
+#include <vector>
 
 #include <llvm/ADT/Statistic.h>
 #include <llvm/IR/BasicBlock.h>
@@ -52,8 +54,19 @@ public:
 	virtual bool doAnalysis(llvm::Function & f, llvm::Pass * p) override;
 
 private:
+	using OpcodeIndex = std::unordered_map<unsigned, std::vector<llvm::Instruction*>>;
+
 	bool analyse(llvm::Function & f, llvm::Pass * p, int (IdiomsAnalysis::*exchanger)(llvm::Function &, llvm::Pass *) const, const char * fname);
 	bool analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname);
+	bool analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname, unsigned rootOpcode);
+
+	OpcodeIndex & getOpcodeIndex(llvm::BasicBlock & bb);
+	void invalidateOpcodeIndex(llvm::BasicBlock & bb);
+
+	/// Instructions of a basic block bucketed by opcode. Exchangers are
+	/// dispatched only on instructions whose opcode matches the root of
+	/// the idiom they recognize, instead of on every instruction.
+	std::unordered_map<const llvm::BasicBlock*, OpcodeIndex> _bbIndex;
 
 	void print_dbg(const char * str, const llvm::Instruction & i) const {
 		DEBUG(llvm::errs() << str << " detected an idiom starting at " << i.getName() << "\n");
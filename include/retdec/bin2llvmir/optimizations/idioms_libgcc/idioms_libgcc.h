@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
@@ -24,7 +25,8 @@ class IdiomsLibgccImpl;
 class IdiomsLibgcc : public llvm::ModulePass
 {
 	public:
-		using Fnc2Action = std::vector<std::pair<std::string, std::function<void(llvm::CallInst*)>>>;
+		using FncAction = std::function<void(llvm::CallInst*)>;
+		using Fnc2Action = std::vector<std::pair<std::string, FncAction>>;
 
 	public:
 		static char ID;
@@ -36,6 +38,7 @@ class IdiomsLibgcc : public llvm::ModulePass
 
 	private:
 		bool testArchAndInitialize();
+		void bucketCalledFunctions();
 		bool handleInstructions();
 		bool handleInstruction(llvm::Instruction* inst);
 		void localize();
@@ -46,6 +49,8 @@ class IdiomsLibgcc : public llvm::ModulePass
 		Config* _config = nullptr;
 
 		Fnc2Action _fnc2action;
+		/// Functions of the current module pre-bucketed to their actions.
+		std::unordered_map<llvm::Function*, const FncAction*> _calledFnc2action;
 };
 
 } // namespace bin2llvmir
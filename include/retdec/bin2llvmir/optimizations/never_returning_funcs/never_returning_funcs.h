@@ -47,6 +47,8 @@ private:
 	void initBeforeRun();
 	void initFuncNeverReturnsMap();
 	void deinitFuncNeverReturnsMap();
+	void buildNeverReturnsSummaries();
+	bool computeNeverReturnsSummary(llvm::Function *func);
 	void addInstsThatWillBeRemoved(llvm::Instruction &inst);
 	void replaceTerminatorInstsWithUnreachableInst(
 			const TerminatorInstSet &toReplace);
@@ -59,6 +61,10 @@ private:
 	/// Mapping of functions that never return.
 	static StringVecFuncMap funcNeverReturnsMap;
 
+	/// Summaries for functions with bodies that were computed to never
+	/// return. Filled bottom-up over callgraph SCCs in doInitialization().
+	static FuncSet funcNeverReturnsSummaries;
+
 	/// Optimized module.
 	llvm::Module *module;
 
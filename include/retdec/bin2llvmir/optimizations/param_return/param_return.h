@@ -30,7 +30,6 @@ class CallEntry
 		CallEntry(llvm::CallInst* c);
 
 	public:
-		void filterRegisters(Config* _config);
 		void filterSort(Config* _config);
 		void filterLeaveOnlyContinuousStackOffsets(Config* _config);
 		void filterLeaveOnlyNeededStackOffsets(Config* _config);
@@ -96,6 +95,8 @@ class DataFlowEntry
 		void setArgumentTypes();
 
 	//
+		bool registerCanBeParameter(llvm::Value* val);
+		void filterRegisters(CallEntry& ce);
 		void filterRegistersArgLoads();
 		void filterSortArgLoads();
 
@@ -129,6 +130,11 @@ class DataFlowEntry
 		bool isVarArg = false;
 		llvm::CallInst* wrappedCall = nullptr;
 		std::vector<std::string> argNames;
+
+	private:
+		/// Cached verdicts whether a value may hold a parameter according
+		/// to the ABI -- shared by all call sites of this callee.
+		std::map<llvm::Value*, bool> _regParamVerdicts;
 };
 
 class ParamReturn : public llvm::ModulePass
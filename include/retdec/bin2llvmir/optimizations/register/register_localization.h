@@ -0,0 +1,56 @@
+/**
+* @file include/retdec/bin2llvmir/optimizations/register/register_localization.h
+* @brief Localize register global variables early with a linear scan.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_REGISTER_REGISTER_LOCALIZATION_H
+#define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_REGISTER_REGISTER_LOCALIZATION_H
+
+#include <set>
+
+#include <llvm/IR/Module.h>
+#include <llvm/Pass.h>
+
+#include "retdec/bin2llvmir/providers/config.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+* Converts accesses to register global variables into accesses to per-function
+* local variables as soon as the register model is no longer needed by the
+* calling-convention analyses. Cross-function register state is preserved by
+* copying the local back to the global before every call and return, and
+* reloading it afterwards -- a single linear scan over each function's
+* instructions is enough, no data-flow analysis is run. Later passes
+* (@c -instcombine, @c -global-to-local, @c -dead-global-assign) then work
+* with compact intra-function def-use chains instead of one module-wide web
+* per register, and clean up the spill/reload copies that turn out to be dead.
+*/
+class RegisterLocalization : public llvm::ModulePass
+{
+	public:
+		static char ID;
+		RegisterLocalization();
+		virtual bool runOnModule(llvm::Module& m) override;
+		bool runOnModuleCustom(
+				llvm::Module& m,
+				Config* c);
+
+	private:
+		bool run();
+		bool canBeLocalized(llvm::GlobalVariable& gv) const;
+		bool localizeInFunction(
+				llvm::Function& f,
+				const std::set<llvm::GlobalVariable*>& regs);
+
+	private:
+		llvm::Module* _module = nullptr;
+		Config* _config = nullptr;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -216,11 +216,22 @@ class SimpleTypesAnalysis : public llvm::ModulePass
 		void eraseObsoleteInstructions();
 		void setGlobalConstants();
 
+		EqSet* findEqSetRepresentative(EqSet* s);
+		void unionEqSets(EqSet* a, EqSet* b);
+		void mergeEqSets();
+
 	private:
 		ValueMap processedObjs;
 		EqSetContainer eqSets;
 		ValuePairList val2PtrVal;
 
+		/// Union-find forest (path compression + union by rank) over the
+		/// equivalence sets. Merges discovered during the traversal are only
+		/// recorded here; the sets themselves are merged in one batch by
+		/// mergeEqSets() before propagation.
+		std::unordered_map<EqSet*, EqSet*> _ufParent;
+		std::unordered_map<EqSet*, unsigned> _ufRank;
+
 		ReachingDefinitionsAnalysis RDA;
 		llvm::Module* module = nullptr;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
@@ -58,6 +58,13 @@ class StackAnalysis : public llvm::ModulePass
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
 		DebugFormat* _dbgf = nullptr;
+
+		/// Per-debug-function index of stack-stored locals by their stack
+		/// offset. Debug info does not change while this pass runs, so each
+		/// function's locals are walked once on the first query and every
+		/// later query is a map lookup instead of a rescan.
+		std::map<retdec::config::Function*, std::map<int, retdec::config::Object*>>
+				_debugStackVariables;
 };
 
 } // namespace bin2llvmir
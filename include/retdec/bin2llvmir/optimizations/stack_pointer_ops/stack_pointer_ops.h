@@ -26,12 +26,20 @@ class StackPointerOpsRemove : public llvm::ModulePass
 
 	private:
 		bool run();
+		void collectRegisters();
 		bool removeStackPointerStores();
 		bool removePreservationStores();
 
 	private:
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
+
+		/// Stack pointer registers of the module, resolved once per run so
+		/// the per-instruction checks are pointer comparisons instead of
+		/// repeated name lookups.
+		std::set<llvm::Value*> _spRegisters;
+		/// Base pointer registers (@c ebp, @c rbp), resolved the same way.
+		std::set<llvm::Value*> _bpRegisters;
 };
 
 } // namespace bin2llvmir
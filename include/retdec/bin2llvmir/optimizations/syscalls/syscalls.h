@@ -7,6 +7,9 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_SYSCALLS_SYSCALLS_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_SYSCALLS_SYSCALLS_H
 
+#include <cstddef>
+#include <cstdint>
+
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
@@ -19,6 +22,36 @@ namespace bin2llvmir {
 
 class AsmInstruction;
 
+/**
+ * One entry of a compile-time syscall table.
+ *
+ * The tables are constexpr arrays sorted by syscall code and live in
+ * read-only data -- they cost nothing to initialize at startup and the
+ * pages are shared between forked jobs in daemon mode.
+ */
+struct SyscallEntry
+{
+	std::uint64_t code;
+	const char* name;
+};
+
+const char* findSyscallName(
+		const SyscallEntry* begin,
+		const SyscallEntry* end,
+		std::uint64_t code);
+
+/**
+ * Finds @a code in the sorted syscall table @a table by binary search.
+ * @return Name of the syscall or @c nullptr if the code is not known.
+ */
+template <std::size_t N>
+const char* findSyscallName(
+		const SyscallEntry (&table)[N],
+		std::uint64_t code)
+{
+	return findSyscallName(table, table + N, code);
+}
+
 class SyscallFixer : public llvm::ModulePass
 {
 	public:
@@ -31,6 +31,11 @@ class Abi
 		static Abi mipsPic32Cdecl(llvm::Module* m, retdec::config::Architecture& a);
 		static Abi mipsPspCdecl(llvm::Module* m, retdec::config::Architecture& a);
 
+		static bool getParameterRegisterNames(
+				const retdec::config::Architecture& a,
+				const char* const*& names,
+				std::size_t& count);
+
 	public:
 		const retdec::config::Architecture& getArchitecture() const;
 		const retdec::config::CallingConvention& getCallingConvention() const;
@@ -128,6 +133,7 @@ class AbiProvider
 				retdec::config::CallingConvention cc,
 				Abi*& abi);
 
+		static void erase(llvm::Module* module);
 		static void clear();
 
 	private:
@@ -7,6 +7,9 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 
+#include <map>
+#include <vector>
+
 #include <capstone/capstone.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
@@ -342,7 +345,9 @@ class AsmInstruction
 		static retdec::utils::Address getInstructionAddress(
 				llvm::Instruction* inst);
 		static bool isLlvmToAsmInstruction(const llvm::Value* inst);
+		static void erase(const llvm::Module* m);
 		static void clear();
+		static void invalidateAddressIndex(const llvm::Module* m);
 
 	private:
 		const llvm::GlobalVariable* getLlvmToAsmGlobalVariablePrivate(
@@ -351,10 +356,20 @@ class AsmInstruction
 
 	private:
 		using ModuleGlobalPair = std::pair<const llvm::Module*, const llvm::GlobalVariable*>;
+		/// Flat address -> special instruction index, sorted by address.
+		using AddressIndex = std::vector<
+				std::pair<std::uint64_t, llvm::StoreInst*>>;
+
+	private:
+		static AddressIndex& getAddressIndex(llvm::Module* m);
+		static llvm::StoreInst* findByAddress(
+				llvm::Module* m,
+				retdec::utils::Address addr);
 
 	private:
 		llvm::StoreInst* _llvmToAsmInstr = nullptr;
 		static std::vector<ModuleGlobalPair> _cache;
+		static std::map<const llvm::Module*, AddressIndex> _addressIndex;
 };
 
 } // namespace bin2llvmir
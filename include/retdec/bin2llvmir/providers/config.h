@@ -11,6 +11,7 @@
 
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
+#include <llvm/IR/ValueHandle.h>
 
 #include "retdec/utils/address.h"
 
@@ -157,9 +158,21 @@ class Config
 		bool isMipsOrPic32() const;
 		llvm::GlobalVariable* getGlobalDummy();
 
+	private:
+		void buildStackVariableIndex(llvm::Function* fnc);
+
 	private:
 		llvm::Module* _module = nullptr;
 		retdec::config::Config _configDB;
+
+		/// Per-function index of stack variables by their stack offset.
+		/// Built lazily by one walk over the function's allocas and kept up
+		/// to date by insertStackVariable(), so getLlvmStackVariable() is a
+		/// logarithmic lookup instead of a rescan of the whole function per
+		/// query. Weak handles -- an erased alloca turns null and the index
+		/// of its function is rebuilt on the next query.
+		std::map<const llvm::Function*, std::map<int, llvm::WeakVH>>
+				_stackVariableIndex;
 		std::string _configPath;
 		llvm::GlobalVariable* _globalDummy = nullptr;
 		llvm::GlobalVariable* _asm2llvmGv = nullptr;
@@ -179,6 +192,7 @@ class ConfigProvider
 		static Config* getConfig(llvm::Module* m);
 		static bool getConfig(llvm::Module* m, Config*& c);
 		static void doFinalization(llvm::Module* m);
+		static void erase(llvm::Module* m);
 		static void clear();
 
 	private:
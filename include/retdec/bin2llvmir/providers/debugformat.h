@@ -48,6 +48,7 @@ class DebugFormatProvider
 		static DebugFormat* getDebugFormat(llvm::Module* m);
 		static bool getDebugFormat(llvm::Module* m, DebugFormat*& df);
 
+		static void erase(llvm::Module* m);
 		static void clear();
 
 	private:
@@ -7,7 +7,11 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_DEMANGLER_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_DEMANGLER_H
 
+#include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 #include <llvm/IR/Module.h>
 
@@ -39,12 +43,33 @@ class DemanglerProvider
 				llvm::Module* m,
 				retdec::demangler::CDemangler*& d);
 
+		static std::string demangleToString(
+				llvm::Module* m,
+				const std::string& mangled);
+
+		static void erase(llvm::Module* m);
 		static void clear();
 
 	private:
 		using Demangler = std::unique_ptr<retdec::demangler::CDemangler>;
 		/// Mapping of modules to demanglers associated with them.
 		static std::map<llvm::Module*, Demangler> _module2demangler;
+
+		/// Cached demangling results of one module in LRU order.
+		struct LruCache
+		{
+			/// Mangled-demangled pairs, most recently used first.
+			std::list<std::pair<std::string, std::string>> entries;
+			/// Mangled name to its entry.
+			std::unordered_map<
+					std::string,
+					std::list<std::pair<std::string, std::string>>::iterator>
+					index;
+		};
+		/// Maximal number of cached results per module.
+		static const std::size_t _cacheCapacity;
+		/// Mapping of modules to their demangling caches.
+		static std::map<llvm::Module*, LruCache> _module2cache;
 };
 
 } // namespace bin2llvmir
@@ -75,12 +75,20 @@ class FileImage
 		const retdec::fileformat::Symbol* getPreferredSymbol(
 				retdec::utils::Address addr);
 
+		bool hasDataOnAddress(retdec::utils::Address addr);
+
 	public:
 		auto& getSegments() const { return _image->getSegments(); }
 
 	private:
 		llvm::Module* _module = nullptr;
 		std::unique_ptr<retdec::loader::Image> _image;
+
+		/// Shared address-candidate index -- analyses that test constant
+		/// operands for being addresses all probe through the provider, so
+		/// every distinct candidate value is validated against the image's
+		/// segment index only once.
+		std::map<retdec::utils::Address, bool> _addressDataCache;
 };
 
 /**
@@ -111,6 +119,7 @@ class FileImageProvider
 				llvm::Module* m,
 				FileImage*& img);
 
+		static void erase(llvm::Module* m);
 		static void clear();
 
 	private:
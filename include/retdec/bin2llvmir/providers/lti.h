@@ -7,6 +7,8 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 
+#include <unordered_map>
+
 #include <llvm/IR/Module.h>
 
 #include "retdec/ctypes/context.h"
@@ -81,6 +83,7 @@ class Lti
 
 	private:
 		void loadLtiFile(const std::string& filePath);
+		void loadUsedFunctions();
 		llvm::Type* getLlvmType(std::shared_ptr<retdec::ctypes::Type> type);
 
 	private:
@@ -89,6 +92,11 @@ class Lti
 		retdec::loader::Image* _image = nullptr;
 		std::unique_ptr<retdec::ctypes::Module> _ltiModule;
 		ctypesparser::JSONCTypesParser _ltiParser;
+		/// Cache of converted LLVM types. Types in the ctypes context are
+		/// canonical (hash-consed by its factories), so pointer identity is
+		/// structural identity and the conversion of each type can be
+		/// computed once.
+		std::unordered_map<const retdec::ctypes::Type*, llvm::Type*> _type2llvm;
 };
 
 class LtiProvider
@@ -100,6 +108,7 @@ class LtiProvider
 				retdec::loader::Image* objf);
 		static Lti* getLti(llvm::Module* m);
 		static bool getLti(llvm::Module* m, Lti*& lti);
+		static void erase(llvm::Module* m);
 		static void clear();
 
 	private:
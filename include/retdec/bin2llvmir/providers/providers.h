@@ -0,0 +1,58 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/providers.h
+ * @brief Lifetime management of per-module provider data.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDERS_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDERS_H
+
+#include <llvm/IR/Module.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Lifetime management of the static per-module maps of all providers.
+ *
+ * Providers keep their data in static maps keyed by @c llvm::Module*. In a
+ * one-shot decompilation this does not matter, but when decompilation runs
+ * as a long-lived service, every job leaks its loaded image, parsed type
+ * database, debug info, etc. This class tears down all data of a single
+ * module. Only module-keyed entries are touched -- provider state that is
+ * shared between modules stays warm across jobs.
+ */
+class Providers
+{
+	public:
+		static void erase(llvm::Module* m);
+		static void clear();
+};
+
+/**
+ * RAII guard that erases all per-module provider data of a module when it
+ * goes out of scope. Intended usage is one scope per decompilation job:
+ * @code{.cpp}
+ * {
+ *     ProviderScope scope(module);
+ *     // ... initialize providers, run passes ...
+ * } // all provider data of module is released here
+ * @endcode
+ */
+class ProviderScope
+{
+	public:
+		ProviderScope(llvm::Module* m);
+		~ProviderScope();
+
+		ProviderScope(const ProviderScope&) = delete;
+		ProviderScope& operator=(const ProviderScope&) = delete;
+
+	private:
+		llvm::Module* _module = nullptr;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -89,6 +89,12 @@ llvm::Function* splitFunctionOn(
 
 void insertAtBegin(llvm::Instruction* li, llvm::BasicBlock* bb);
 
+void eraseInstructions(const std::vector<llvm::Instruction*>& insts);
+
+void moveInstructionsToFront(
+		llvm::BasicBlock* bb,
+		const std::vector<llvm::Instruction*>& insts);
+
 } // namespace bin2llvmir
 } // namespace retdec
 
@@ -0,0 +1,59 @@
+/**
+* @file include/retdec/bin2llvmir/utils/peephole.h
+* @brief Worklist-driven engine for local instruction rewrites.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_UTILS_PEEPHOLE_H
+#define RETDEC_BIN2LLVMIR_UTILS_PEEPHOLE_H
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/ValueHandle.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Worklist-driven engine for local instruction rewrites.
+ *
+ * Rewrite rules register on instruction opcodes and the engine applies
+ * them in a single walk over each function, re-visiting the neighbourhood
+ * of every successful rewrite until a local fixpoint is reached. Passes
+ * doing local pattern rewrites can share one engine instead of each
+ * adding another whole-module walk.
+ *
+ * A rule gets the matched instruction and returns @c true if it changed
+ * the IR. It may create new instructions, replace uses, and erase the
+ * matched instruction or its neighbours. The worklist holds weak value
+ * handles, so instructions erased by one rule are skipped safely later.
+ */
+class PeepholeEngine
+{
+	public:
+		using Rule = std::function<bool(llvm::Instruction*)>;
+
+	public:
+		void addRule(unsigned opcode, Rule rule);
+		bool runOnFunction(llvm::Function& f);
+		bool runOnModule(llvm::Module& m);
+
+	private:
+		bool processInstruction(llvm::Instruction* i);
+
+	private:
+		/// Opcode to rules applied to instructions with that opcode.
+		std::map<unsigned, std::vector<Rule>> _rules;
+		/// Instructions waiting to be (re-)visited.
+		std::vector<llvm::WeakVH> _worklist;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -168,9 +168,20 @@ class Capstone2LlvmIrTranslatorArm : public Capstone2LlvmIrTranslator
 				llvm::Value* n);
 
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorArm::*)(cs_insn* i, cs_arm*, llvm::IRBuilder<>&)> _i2fm;
+		/// Dense table of translation functions indexed directly by the
+		/// Capstone instruction ID. @c nullptr entries are instructions
+		/// without a translation routine.
+		struct DispatchTable
+		{
+			void (Capstone2LlvmIrTranslatorArm::*fns[ARM_INS_ENDING])(
+					cs_insn* i, cs_arm*, llvm::IRBuilder<>&);
+		};
+
+		/// Generates the content of @c _i2fm at compile time.
+		static constexpr DispatchTable makeDispatchTable();
+
+		/// Mapping of Capstone instruction IDs to their translation functions.
+		static const DispatchTable _i2fm;
 
 		// These are used to save lines needed to declare locale operands in
 		// each translation function.
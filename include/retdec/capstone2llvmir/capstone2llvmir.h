@@ -151,15 +151,63 @@ class Capstone2LlvmIrTranslator
 			/// This is any branch type. i.e. call, return, branch, cond branch.
 			llvm::CallInst* branchCall = nullptr;
 			bool inCondition = false;
+			/// Number of delay slot instructions translated after
+			/// @c branchCall as part of this run. If nonzero, the caller
+			/// does not have to decode the slot in a separate step --
+			/// @c size already covers it.
+			std::size_t delaySlots = 0;
 			bool failed() const { return size == 0; }
 		};
 
+		/**
+		 * Result of a block translation. On top of the block summary in
+		 * @c block, it carries one entry per translated instruction, so
+		 * callers can inspect the instructions without walking the
+		 * generated LLVM IR.
+		 */
+		struct BlockTranslationResult
+		{
+			TranslationResult block;
+			/// Per-instruction results in translation order: the special
+			/// asm to LLVM mapping instruction + its Capstone instruction.
+			std::vector<std::pair<llvm::StoreInst*, cs_insn*>> instructions;
+			bool failed() const { return block.failed(); }
+		};
+
 		virtual TranslationResult translate(
 				const std::vector<uint8_t>& bytes,
 				retdec::utils::Address a,
 				llvm::IRBuilder<>& irb,
 				bool stopOnBranch = false);
 
+		virtual BlockTranslationResult translateBlock(
+				const std::vector<uint8_t>& bytes,
+				retdec::utils::Address a,
+				llvm::IRBuilder<>& irb,
+				std::size_t count = 0,
+				bool stopOnBranch = false);
+
+	protected:
+		TranslationResult translateInternal(
+				const std::vector<uint8_t>& bytes,
+				retdec::utils::Address a,
+				llvm::IRBuilder<>& irb,
+				bool stopOnBranch,
+				std::size_t count,
+				std::vector<std::pair<llvm::StoreInst*, cs_insn*>>* insns);
+
+		std::size_t translateDelaySlots(
+				uint32_t branchInsnId,
+				const uint8_t** code,
+				std::size_t* size,
+				uint64_t* address,
+				retdec::utils::Address a,
+				llvm::IRBuilder<>& irb,
+				TranslationResult& res,
+				std::vector<std::pair<llvm::StoreInst*, cs_insn*>>* insns);
+
+	public:
+
 	// Public pure virtual methods that must be implemented in concrete classes.
 	//
 	public:
@@ -351,6 +399,43 @@ class Capstone2LlvmIrTranslator
 				llvm::IRBuilder<>& irb,
 				bool reverse = false);
 
+	// Translation cache.
+	//
+	protected:
+		/**
+		 * Reusable translation of one instruction encoding. Holds unparented
+		 * template instructions that are cloned into the target basic block
+		 * on every cache hit. Owned (and freed) by the translator.
+		 */
+		struct CachedTranslation
+		{
+			std::vector<llvm::Instruction*> insns;
+			/// @c False -> this encoding must always go through the full
+			/// translation routine (address-dependent, branching, or
+			/// multi-block translation).
+			bool cacheable = false;
+			/// @c True once cacheability of this encoding has been decided,
+			/// whatever the outcome. Further occurrences of an uncacheable
+			/// encoding then skip the evaluation probe entirely.
+			bool evaluated = false;
+		};
+
+	protected:
+		bool translateFromCache(cs_insn* i, llvm::IRBuilder<>& irb);
+		void addToTranslationCache(
+				cs_insn* i,
+				llvm::IRBuilder<>& irb,
+				llvm::BasicBlock* bodyBb,
+				llvm::Instruction* lastBefore,
+				llvm::CallInst* branchBefore);
+		void clearTranslationCache();
+
+	private:
+		std::string getTranslationCacheKey(cs_insn* i) const;
+		static bool isSameTranslation(
+				const std::vector<llvm::Instruction*>& a,
+				const std::vector<llvm::Instruction*>& b);
+
 	protected:
 		llvm::Function* getOrCreateAsmFunction(
 				std::size_t insnId,
@@ -406,6 +491,13 @@ class Capstone2LlvmIrTranslator
 		/// Maybe, it would be possible to do this task without this.
 		std::map<llvm::GlobalVariable*, uint32_t> _allLlvmRegs;
 
+		/// Dense register-number-indexed cache of LLVM registers created by
+		/// @c createRegister(). It is pre-sized once in
+		/// @c generateEnvironment(), so @c getRegister() resolves created
+		/// registers with a plain index instead of a name construction and
+		/// a module symbol table lookup.
+		std::vector<llvm::GlobalVariable*> _capstoneReg2llvmGv;
+
 		/// If the last translated instruction generated branch call, it is
 		/// stored to this member.
 		llvm::CallInst* _branchGenerated = nullptr;
@@ -414,6 +506,11 @@ class Capstone2LlvmIrTranslator
 		/// @c True if generated branch is in conditional code, e.g. uncond
 		/// branch in if-then.
 		bool _inCondition = false;
+
+		/// Translations keyed by basic mode + raw instruction bytes. Real
+		/// binaries repeat the same encodings many times -- address
+		/// independent translations are generated once and then only cloned.
+		std::map<std::string, CachedTranslation> _translationCache;
 };
 
 } // namespace capstone2llvmir
@@ -111,9 +111,20 @@ class Capstone2LlvmIrTranslatorMips : public Capstone2LlvmIrTranslator
 		bool isFpInstructionVariant(cs_insn* i);
 
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorMips::*)(cs_insn* i, cs_mips*, llvm::IRBuilder<>&)> _i2fm;
+		/// Dense table of translation functions indexed directly by the
+		/// Capstone instruction ID. @c nullptr entries are instructions
+		/// without a translation routine.
+		struct DispatchTable
+		{
+			void (Capstone2LlvmIrTranslatorMips::*fns[MIPS_INS_ENDING])(
+					cs_insn* i, cs_mips*, llvm::IRBuilder<>&);
+		};
+
+		/// Generates the content of @c _i2fm at compile time.
+		static constexpr DispatchTable makeDispatchTable();
+
+		/// Mapping of Capstone instruction IDs to their translation functions.
+		static const DispatchTable _i2fm;
 
 		// These are used to save lines needed to declare locale operands in
 		// each translation function.
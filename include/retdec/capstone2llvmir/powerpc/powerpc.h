@@ -133,9 +133,20 @@ class Capstone2LlvmIrTranslatorPowerpc : public Capstone2LlvmIrTranslator
 		bool isCrRegister(cs_ppc_op& op);
 
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorPowerpc::*)(cs_insn* i, cs_ppc*, llvm::IRBuilder<>&)> _i2fm;
+		/// Dense table of translation functions indexed directly by the
+		/// Capstone instruction ID. @c nullptr entries are instructions
+		/// without a translation routine.
+		struct DispatchTable
+		{
+			void (Capstone2LlvmIrTranslatorPowerpc::*fns[PPC_INS_ENDING])(
+					cs_insn* i, cs_ppc*, llvm::IRBuilder<>&);
+		};
+
+		/// Generates the content of @c _i2fm at compile time.
+		static constexpr DispatchTable makeDispatchTable();
+
+		/// Mapping of Capstone instruction IDs to their translation functions.
+		static const DispatchTable _i2fm;
 
 		// These are used to save lines needed to declare locale operands in
 		// each translation function.
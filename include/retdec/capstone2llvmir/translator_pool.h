@@ -0,0 +1,95 @@
+/**
+ * @file include/retdec/capstone2llvmir/translator_pool.h
+ * @brief Pool of translators for concurrent decoding.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_CAPSTONE2LLVMIR_TRANSLATOR_POOL_H
+#define RETDEC_CAPSTONE2LLVMIR_TRANSLATOR_POOL_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "retdec/capstone2llvmir/capstone2llvmir.h"
+
+namespace retdec {
+namespace capstone2llvmir {
+
+/**
+ * Pool of translator instances for the same architecture and modes.
+ *
+ * One translator instance is not reentrant -- it holds its own Capstone
+ * handle and a builder state. This pool creates N instances up front, each
+ * bound to its own (typically per-thread, later linked) LLVM module, and
+ * hands them out to concurrent decoders. The heavy semantic tables (dispatch
+ * tables, register maps) are static and therefore shared read-only by all
+ * instances.
+ *
+ * Checked out translators are returned automatically -- @c checkOut()
+ * returns a move-only RAII guard that checks the instance back in on
+ * destruction.
+ */
+class Capstone2LlvmIrTranslatorPool
+{
+	public:
+		/**
+		 * Move-only guard around a checked out translator. Checks the
+		 * translator back into its pool on destruction.
+		 */
+		class CheckedOutTranslator
+		{
+			// Only the pool can create valid guards.
+			friend class Capstone2LlvmIrTranslatorPool;
+
+			public:
+				CheckedOutTranslator(CheckedOutTranslator&& other);
+				CheckedOutTranslator& operator=(CheckedOutTranslator&& other);
+				CheckedOutTranslator(const CheckedOutTranslator&) = delete;
+				CheckedOutTranslator& operator=(
+						const CheckedOutTranslator&) = delete;
+				~CheckedOutTranslator();
+
+				Capstone2LlvmIrTranslator* get() const;
+				Capstone2LlvmIrTranslator* operator->() const;
+				Capstone2LlvmIrTranslator& operator*() const;
+
+			private:
+				CheckedOutTranslator(
+						Capstone2LlvmIrTranslatorPool* pool,
+						Capstone2LlvmIrTranslator* translator);
+
+			private:
+				Capstone2LlvmIrTranslatorPool* _pool = nullptr;
+				Capstone2LlvmIrTranslator* _translator = nullptr;
+		};
+
+	public:
+		Capstone2LlvmIrTranslatorPool(
+				cs_arch a,
+				const std::vector<llvm::Module*>& modules,
+				cs_mode basic = CS_MODE_LITTLE_ENDIAN,
+				cs_mode extra = CS_MODE_LITTLE_ENDIAN);
+
+		/// Blocks until an instance is available.
+		CheckedOutTranslator checkOut();
+
+		std::size_t size() const;
+
+	private:
+		void checkIn(Capstone2LlvmIrTranslator* t);
+
+	private:
+		/// All created instances -- owned by the pool.
+		std::vector<std::unique_ptr<Capstone2LlvmIrTranslator>> _translators;
+		/// Instances currently available for check-out.
+		std::vector<Capstone2LlvmIrTranslator*> _available;
+		mutable std::mutex _mutex;
+		std::condition_variable _cond;
+};
+
+} // namespace capstone2llvmir
+} // namespace retdec
+
+#endif
@@ -99,10 +99,20 @@ class Capstone2LlvmIrTranslatorX86 : public Capstone2LlvmIrTranslator
 		/// map -- it will deal with added enums.
 		std::vector<uint32_t> _reg2parentMap;
 
+		/// Dense table of translation functions indexed directly by the
+		/// Capstone instruction ID. @c nullptr entries are instructions
+		/// without a translation routine.
+		struct DispatchTable
+		{
+			void (Capstone2LlvmIrTranslatorX86::*fns[X86_INS_ENDING])(
+					cs_insn* i, cs_x86*, llvm::IRBuilder<>&);
+		};
+
+		/// Generates the content of @c _i2fm at compile time.
+		static constexpr DispatchTable makeDispatchTable();
+
 		/// Mapping of Capstone instruction IDs to their translation functions.
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorX86::*)(cs_insn* i, cs_x86*, llvm::IRBuilder<>&)> _i2fm;
+		static const DispatchTable _i2fm;
 
 
 	// Translation helper methods.
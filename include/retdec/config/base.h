@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <memory>
+#include <ostream>
 #include <set>
 #include <vector>
 
@@ -64,6 +66,69 @@ bool safeGetBool(
 		const std::string& name = "",
 		bool defaultValue = false);
 
+//
+//=============================================================================
+// ConfigStreamWriter
+//=============================================================================
+//
+
+/**
+ * Interface for streaming emitters of the configuration value tree.
+ *
+ * Writers are fed objects and arrays as the configuration is walked,
+ * so the whole document never has to be materialized as one @c Json::Value
+ * tree. Leaf values (and small fixed-size objects) are still passed in
+ * as @c Json::Value subtrees.
+ */
+class ConfigStreamWriter
+{
+	public:
+		virtual ~ConfigStreamWriter() {}
+
+		virtual void beginObject() = 0;
+		virtual void endObject() = 0;
+		virtual void beginArray() = 0;
+		virtual void endArray() = 0;
+		virtual void key(const std::string& name) = 0;
+		virtual void value(const Json::Value& val) = 0;
+};
+
+/**
+ * Streaming JSON emitter.
+ * Writes compact JSON directly to the output stream as it is fed,
+ * eliminating the intermediate DOM of the whole document.
+ */
+class JsonStreamWriter : public ConfigStreamWriter
+{
+	public:
+		explicit JsonStreamWriter(std::ostream& out);
+
+		virtual void beginObject() override;
+		virtual void endObject() override;
+		virtual void beginArray() override;
+		virtual void endArray() override;
+		virtual void key(const std::string& name) override;
+		virtual void value(const Json::Value& val) override;
+
+	private:
+		void separateInArray();
+
+	private:
+		/// One entry per open object or array.
+		struct Level
+		{
+			bool isObject;
+			bool hasMembers;
+		};
+
+	private:
+		std::ostream& _out;
+		std::vector<Level> _levels;
+		/// Writer used to serialize the (small) @c Json::Value subtrees
+		/// passed to @c value().
+		std::unique_ptr<Json::StreamWriter> _subtreeWriter;
+};
+
 //
 //=============================================================================
 // AddressRangeJson
@@ -239,6 +304,24 @@ class BaseSequentialContainer
 			return array;
 		}
 
+		/**
+		 * Streams elements of this container as a JSON array into a writer.
+		 * Unlike getJsonValue(), only one element's JSON tree exists
+		 * at a time.
+		 * @param w Writer to stream into.
+		 */
+		void writeJsonValue(ConfigStreamWriter& w) const
+		{
+			w.beginArray();
+
+			for (auto& elem : _data)
+			{
+				w.value( elem.getJsonValue() );
+			}
+
+			w.endArray();
+		}
+
 		/**
 		 * Reads array of JSON objects into elements of this container.
 		 * Container is cleared before parsing - it contains only new objects afterwards.
@@ -246,14 +329,35 @@ class BaseSequentialContainer
 		 */
 		void readJsonValue(const Json::Value& val)
 		{
-			clear();
+			beginReadingJson();
 
 			for (auto& elem : val)
 			{
-				if ( ! elem.isNull() )
-				{
-					_data.push_back( Elem::fromJsonValue(elem) );
-				}
+				readJsonElement(elem);
+			}
+		}
+
+		/**
+		 * Prepares this container for element-wise reading - container is
+		 * cleared, same as when readJsonValue() is entered.
+		 */
+		void beginReadingJson()
+		{
+			clear();
+		}
+
+		/**
+		 * Reads one JSON object into an element of this container.
+		 * Together with beginReadingJson(), this lets streaming parsers feed
+		 * elements one by one, so the whole array never has to exist as one
+		 * JSON value tree.
+		 * @param elem JSON object to read.
+		 */
+		void readJsonElement(const Json::Value& elem)
+		{
+			if ( ! elem.isNull() )
+			{
+				_data.push_back( Elem::fromJsonValue(elem) );
 			}
 		}
 
@@ -357,6 +461,24 @@ class BaseAssociativeContainer
 			return array;
 		}
 
+		/**
+		 * Streams elements of this container as a JSON array into a writer.
+		 * Unlike getJsonValue(), only one element's JSON tree exists
+		 * at a time.
+		 * @param w Writer to stream into.
+		 */
+		void writeJsonValue(ConfigStreamWriter& w) const
+		{
+			w.beginArray();
+
+			for (auto& elem : _data)
+			{
+				w.value( elem.second.getJsonValue() );
+			}
+
+			w.endArray();
+		}
+
 		/**
 		 * Reads array of JSON objects into elements of this container.
 		 * Container is cleared before parsing - it contains only new objects afterwards.
@@ -364,14 +486,35 @@ class BaseAssociativeContainer
 		 */
 		void readJsonValue(const Json::Value& val)
 		{
-			clear();
+			beginReadingJson();
 
 			for (auto& elem : val)
 			{
-				if ( ! elem.isNull() )
-				{
-					insert( Elem::fromJsonValue(elem) );
-				}
+				readJsonElement(elem);
+			}
+		}
+
+		/**
+		 * Prepares this container for element-wise reading - container is
+		 * cleared, same as when readJsonValue() is entered.
+		 */
+		void beginReadingJson()
+		{
+			clear();
+		}
+
+		/**
+		 * Reads one JSON object into an element of this container.
+		 * Together with beginReadingJson(), this lets streaming parsers feed
+		 * elements one by one, so the whole array never has to exist as one
+		 * JSON value tree.
+		 * @param elem JSON object to read.
+		 */
+		void readJsonElement(const Json::Value& elem)
+		{
+			if ( ! elem.isNull() )
+			{
+				insert( Elem::fromJsonValue(elem) );
 			}
 		}
 
@@ -476,6 +619,24 @@ class BaseSetContainer
 			return array;
 		}
 
+		/**
+		 * Streams elements of this container as a JSON array into a writer.
+		 * Unlike getJsonValue(), only one element's JSON tree exists
+		 * at a time.
+		 * @param w Writer to stream into.
+		 */
+		void writeJsonValue(ConfigStreamWriter& w) const
+		{
+			w.beginArray();
+
+			for (auto& elem : _data)
+			{
+				w.value( elem.getJsonValue() );
+			}
+
+			w.endArray();
+		}
+
 		/**
 		 * Reads array of JSON objects into elements of this container.
 		 * Container is cleared before parsing - it contains only new objects afterwards.
@@ -485,10 +646,31 @@ class BaseSetContainer
 		{
 			for (auto& elem : val)
 			{
-				if ( ! elem.isNull() )
-				{
-					insert( Elem::fromJsonValue(elem) );
-				}
+				readJsonElement(elem);
+			}
+		}
+
+		/**
+		 * Prepares this container for element-wise reading.
+		 * Nothing to do here - readJsonValue() of this container does not
+		 * clear it either.
+		 */
+		void beginReadingJson()
+		{
+		}
+
+		/**
+		 * Reads one JSON object into an element of this container.
+		 * Together with beginReadingJson(), this lets streaming parsers feed
+		 * elements one by one, so the whole array never has to exist as one
+		 * JSON value tree.
+		 * @param elem JSON object to read.
+		 */
+		void readJsonElement(const Json::Value& elem)
+		{
+			if ( ! elem.isNull() )
+			{
+				insert( Elem::fromJsonValue(elem) );
 			}
 		}
 
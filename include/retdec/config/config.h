@@ -71,9 +71,13 @@ class Config
 		std::string generateJsonString() const;
 		std::string generateJsonFile() const;
 		std::string generateJsonFile(const std::string& outputFilePath) const;
+		std::string generateBinaryFile(const std::string& outputFilePath) const;
 
 		void readJsonString(const std::string& json);
 		void readJsonFile(const std::string& input);
+		void readBinaryString(const std::string& data);
+		void readBinaryFile(const std::string& input);
+		void readFile(const std::string& input);
 
 	public:
 		Parameters parameters;
@@ -91,6 +95,11 @@ class Config
 		ClassContainer classes;
 		PatternContainer patterns;
 
+	private:
+		void writeJsonValue(ConfigStreamWriter& w) const;
+		void readJsonValue(const Json::Value& root);
+		bool readJsonStringStreaming(const std::string& json);
+
 	private:
 		std::string _inputFile;
 		std::string _unpackedInputFile;
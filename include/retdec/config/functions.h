@@ -8,6 +8,7 @@
 #define RETDEC_CONFIG_FUNCTIONS_H
 
 #include <string>
+#include <vector>
 
 #include "retdec/config/base.h"
 #include "retdec/config/calling_convention.h"
@@ -82,6 +83,7 @@ class Function : public retdec::utils::AddressRange
 		void setIsExported(bool f);
 		void setIsVariadic(bool f);
 		void setIsThumb(bool f);
+		void setContentHash(const std::string& h);
 		/// @}
 
 		/// @name Function get methods.
@@ -96,6 +98,7 @@ class Function : public retdec::utils::AddressRange
 		std::string getWrappedFunctionName() const;
 		LineNumber getStartLine() const;
 		LineNumber getEndLine() const;
+		const std::string& getContentHash() const;
 		/// @}
 
 		bool operator<(const Function& o) const;
@@ -122,7 +125,9 @@ class Function : public retdec::utils::AddressRange
 		};
 
 	private:
-		std::string _name; ///< This is objects unique ID.
+		/// This is objects unique ID.
+		/// Names are interned -- this points to the single process-wide copy.
+		const std::string* _name;
 		std::string _realName;
 		std::string _demangledName;
 		std::string _comment;
@@ -140,6 +145,9 @@ class Function : public retdec::utils::AddressRange
 		bool _exported = false;
 		bool _variadic = false;
 		bool _thumb = false;
+		/// Hash of the function's bytes in the input binary. Used to detect
+		/// functions that did not change between two versions of a binary.
+		std::string _contentHash;
 };
 
 /**
@@ -149,11 +157,32 @@ class Function : public retdec::utils::AddressRange
 class FunctionContainer : public BaseAssociativeContainer<std::string, Function>
 {
 	public:
+		FunctionContainer();
+		FunctionContainer(const FunctionContainer& o);
+		FunctionContainer& operator=(const FunctionContainer& o);
+
 		bool hasFunction(const std::string& name);
 		Function* getFunctionByName(const std::string& name);
 		const Function* getFunctionByName(const std::string& name) const;
 		Function* getFunctionByStartAddress(const retdec::utils::Address& addr);
 		Function* getFunctionByRealName(const std::string& name);
+
+		/// @name Reimplemented base container methods.
+		///
+		/// They need to be reimplemented to invalidate @c _addrIndex.
+		/// @{
+		virtual std::pair<iterator,bool> insert(const Function& e) override;
+		void clear();
+		size_t erase(const std::string& name);
+		/// @}
+
+	private:
+		/// Flat index of functions sorted by their start addresses.
+		/// It allows fast binary search in getFunctionByStartAddress().
+		/// The pipeline's access pattern is build-then-query, so the index
+		/// is rebuilt lazily on the first query after a modification.
+		std::vector<Function*> _addrIndex;
+		bool _addrIndexValid = false;
 };
 
 } // namespace config
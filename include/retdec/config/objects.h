@@ -8,6 +8,8 @@
 #define RETDEC_CONFIG_OBJECTS_H
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "retdec/config/base.h"
 #include "retdec/config/storage.h"
@@ -74,7 +76,8 @@ class Object
 
 	protected:
 		/// Unique ID -- name used in LLVM IR.
-		std::string _name;
+		/// Names are interned -- this points to the single process-wide copy.
+		const std::string* _name;
 		Storage _storage;
 		/// Real name of this object to appear in output C.
 		/// This may or may not differ from @c name.
@@ -145,8 +148,14 @@ class GlobalVarContainer : public ObjectSetContainer
 		/// @}
 
 	private:
-		/// Map allows fast global variables search by address.
-		std::map<retdec::utils::Address, const Object*> _addr2global;
+		std::vector<std::pair<retdec::utils::Address, const Object*>>::iterator
+				addrFind(const retdec::utils::Address& address);
+
+	private:
+		/// Flat vector sorted by address allows fast (binary search) global
+		/// variables search by address with contiguous storage.
+		std::vector<std::pair<retdec::utils::Address, const Object*>>
+				_addr2global;
 
 		GTEST_FRIEND_TEST(
 				GlobalVarContainerTests,
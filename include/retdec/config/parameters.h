@@ -27,6 +27,9 @@ class Parameters
 		bool isVerboseOutput() const;
 		bool isKeepAllFunctions() const;
 		bool isSelectedDecodeOnly() const;
+		bool isLazyDecoding() const;
+		bool isIncremental() const;
+		bool isStaticCodeDecoding() const;
 		bool isFrontendFunction(const std::string& funcName) const;
 		/// @}
 
@@ -35,6 +38,9 @@ class Parameters
 		void setIsVerboseOutput(bool b);
 		void setIsKeepAllFunctions(bool b);
 		void setIsSelectedDecodeOnly(bool b);
+		void setIsLazyDecoding(bool b);
+		void setIsIncremental(bool b);
+		void setIsStaticCodeDecoding(bool b);
 		void setOutputFile(const std::string& n);
 		void setFrontendOutputFile(const std::string& n);
 		void setOrdinalNumbersDirectory(const std::string& n);
@@ -87,6 +93,23 @@ class Parameters
 		/// results.
 		bool _selectedDecodeOnly = false;
 
+		/// Decode only code reachable from entry points, exports, and
+		/// user-selected addresses. Other parts are decoded lazily, only
+		/// when some later analysis asks for them.
+		bool _lazyDecoding = false;
+
+		/// Incremental decompilation of a new version of an already
+		/// decompiled binary: functions whose content hash matches a hash
+		/// recorded in the input config are pruned, so only changed and new
+		/// functions make it into the output.
+		bool _incremental = false;
+
+		/// Decode and translate bodies of detected statically linked
+		/// functions. Off by default -- detected library functions are
+		/// turned into body-less known functions, which keeps their
+		/// instructions out of all later analyses.
+		bool _staticCodeDecoding = false;
+
 		std::string _outputFile;
 		std::string _frontendOutputFile;
 		std::string _ordinalNumbersDirectory;
@@ -74,6 +74,12 @@ class Heuristics
 		 */
 		bool priorityLanguageIsSet = false;
 
+		/**
+		 * If @c true only the most probable tool is needed and remaining
+		 * heuristics are skipped once a strong enough detection exists.
+		 */
+		bool triageMode = false;
+
 
 		/// @name Auxiliary methods
 		/// @{
@@ -81,6 +87,7 @@ class Heuristics
 		const DetectResult* isDetected(
 				const std::string &name,
 				const DetectionStrength minStrength = DetectionStrength::LOW);
+		bool canStopDetection() const;
 		/// @}
 
 		/// @name Virtual methods
@@ -139,7 +146,7 @@ class Heuristics
 
 		/// @name Heuristics methods
 		/// @{
-		void getAllHeuristics();
+		void getAllHeuristics(bool triage = false);
 		/// @}
 };
 
@@ -92,6 +92,9 @@ class Search
 		bool hasStringInSection(const std::string &str, const retdec::fileformat::Section *section) const;
 		bool hasStringInSection(const std::string &str, std::size_t sectionIndex) const;
 		bool hasStringInSection(const std::string &str, const std::string &sectionName) const;
+		std::vector<bool> findStringsInArea(const std::vector<std::string> &strs, std::size_t startOffset, std::size_t stopOffset) const;
+		std::vector<bool> findStringsInSection(const std::vector<std::string> &strs, const retdec::fileformat::Section *section) const;
+		std::vector<bool> findStringsInSection(const std::vector<std::string> &strs, std::size_t sectionIndex) const;
 		/// @}
 
 		/// @name Signature methods
@@ -109,7 +109,16 @@ struct DetectParams
 	bool internal;  ///< use of internal signature database
 	bool external;  ///< use of external signature database
 
-	DetectParams(SearchType searchType_, bool internal_, bool external_);
+	/**
+	 * In triage mode only the most probable tool is needed. Detection may
+	 * stop as soon as one sufficiently strong detection exists instead of
+	 * running all remaining heuristics.
+	 */
+	bool triage;
+
+	DetectParams(
+			SearchType searchType_, bool internal_, bool external_,
+			bool triage_ = false);
 	~DetectParams();
 };
 
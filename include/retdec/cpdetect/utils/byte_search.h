@@ -0,0 +1,59 @@
+/**
+ * @file include/retdec/cpdetec/utils/byte_search.h
+ * @brief Fast substring search over file content.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_CPDETECT_UTILS_BYTE_SEARCH_H
+#define RETDEC_CPDETECT_UTILS_BYTE_SEARCH_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace retdec {
+namespace cpdetect {
+
+std::size_t findSubstringInArea(const std::string &haystack, const std::string &needle,
+	std::size_t startOffset, std::size_t stopOffset);
+
+/**
+ * Search engine for detection of multiple patterns in a single pass
+ *
+ * The engine is built once from a set of patterns (Aho-Corasick automaton)
+ * and then tells which of the patterns occur in a given area of the searched
+ * content. Use it when a heuristic checks several signatures against the same
+ * bytes -- the content is scanned only once no matter how many patterns
+ * there are.
+ */
+class MultiPatternSearch
+{
+	private:
+		/**
+		 * One state of the automaton
+		 */
+		struct State
+		{
+			std::map<unsigned char, std::size_t> next; ///< transitions to other states
+			std::size_t fail = 0;                      ///< failure link
+			std::vector<std::size_t> matches;          ///< indexes of patterns ending in this state
+		};
+
+		std::vector<State> states;       ///< states of the automaton (index 0 is the root)
+		std::size_t numberOfPatterns;    ///< number of patterns the engine was built from
+		std::vector<bool> emptyPatterns; ///< which patterns are empty (they match everywhere)
+	public:
+		MultiPatternSearch(const std::vector<std::string> &patterns);
+		~MultiPatternSearch();
+
+		/// @name Search methods
+		/// @{
+		std::vector<bool> findInArea(const std::string &haystack,
+			std::size_t startOffset, std::size_t stopOffset) const;
+		/// @}
+};
+
+} // namespace cpdetect
+} // namespace retdec
+
+#endif
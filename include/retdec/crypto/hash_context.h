@@ -35,7 +35,7 @@ public:
 	bool init(HashAlgorithm algorithm);
 	bool addData(const std::uint8_t* data, std::size_t size);
 	bool addData(const std::vector<std::uint8_t>& data);
-	std::string getHash();
+	std::string getHash(bool uppercase = true);
 
 private:
 	EVP_MD_CTX* _ctx; ///< OpenSSL envelope message digest context.
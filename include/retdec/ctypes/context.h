@@ -7,11 +7,13 @@
 #ifndef RETDEC_CTYPES_CONTEXT_H
 #define RETDEC_CTYPES_CONTEXT_H
 
-#include <map>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "retdec/ctypes/array_type.h"
 #include "retdec/ctypes/function_type.h"
@@ -77,14 +79,45 @@ class Context
 		void addAnnotation(const std::shared_ptr<Annotation> &annot);
 		/// @}
 
+	private:
+		/**
+		* @brief Structural hash for composite type keys.
+		*
+		* Component types are themselves canonical objects stored in this
+		* context, so hashing (and comparing) them by pointer identity is
+		* equivalent to deep structural hashing, at O(1) per component.
+		*/
+		struct CompositeKeyHash
+		{
+			template <typename Component>
+			static void combine(std::size_t &seed, const Component &c)
+			{
+				std::hash<Component> hasher;
+				seed ^= hasher(c) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			}
+
+			template <typename Item>
+			std::size_t operator()(const std::pair<
+				std::shared_ptr<Type>, std::vector<Item>> &key) const
+			{
+				std::size_t seed = std::hash<std::shared_ptr<Type>>{}(key.first);
+				for (const auto &item : key.second)
+				{
+					combine(seed, item);
+				}
+				return seed;
+			}
+		};
+
 	private:
 		using Functions = std::unordered_map<std::string, std::shared_ptr<Function>>;
 		/// Stored functions.
 		Functions functions;
 
-		using FunctionTypes = std::map<
+		using FunctionTypes = std::unordered_map<
 			std::pair<std::shared_ptr<Type>, FunctionType::Parameters>,
-			std::shared_ptr<FunctionType>
+			std::shared_ptr<FunctionType>,
+			CompositeKeyHash
 		>;
 		/// Stored function types, key is return type and parameters' types.
 		FunctionTypes functionTypes;
@@ -98,9 +131,10 @@ class Context
 		/// Stored pointer types, key is type that they point to.
 		PointerTypes pointerTypes;
 
-		using ArrayTypes = std::map<
+		using ArrayTypes = std::unordered_map<
 			std::pair<std::shared_ptr<Type>, ArrayType::Dimensions>,
-			std::shared_ptr<ArrayType>
+			std::shared_ptr<ArrayType>,
+			CompositeKeyHash
 		>;
 		/// Stored array types, key is element type and dimensions
 		ArrayTypes arrayTypes;
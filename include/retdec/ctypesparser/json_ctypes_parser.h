@@ -8,8 +8,10 @@
 #define RETDEC_CTYPESPARSER_JSON_CTYPES_PARSER_H
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <rapidjson/document.h>
 
@@ -37,6 +39,17 @@ class JSONCTypesParser: public CTypesParser
 			const TypeWidths &typeWidths = {},
 			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention()) override;
 
+		/// @name Lazy parsing methods.
+		/// @{
+		void addLazySource(
+			std::istream &stream,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		std::shared_ptr<retdec::ctypes::Function> materializeFunction(
+			const std::string &name,
+			std::unique_ptr<retdec::ctypes::Module> &module);
+		/// @}
+
 	private:
 		std::string loadJson(std::istream &stream) const;
 		std::unique_ptr<rapidjson::Document> parseJson(char *buffer) const;
@@ -130,12 +143,35 @@ class JSONCTypesParser: public CTypesParser
 		using ParserContext = std::unordered_map<std::string, std::shared_ptr<retdec::ctypes::Type>>;
 		using TypesMap = std::unordered_map<std::string, rapidjson::Value::ConstMemberIterator>;
 
+		/**
+		* @brief One lazily parsed JSON type database.
+		*
+		* Only the JSON DOM and a function-name index are built upfront;
+		* C-types are materialized per function on the first query.
+		*/
+		struct LazySource
+		{
+			/// JSON text the in-situ parsed DOM points into.
+			std::string buffer;
+			std::unique_ptr<rapidjson::Document> doc;
+			/// Index of JSON function representations by function name.
+			std::unordered_map<std::string, const rapidjson::Value*> functions;
+			TypesMap typesMap;
+			ParserContext parserContext;
+			TypeWidths typeWidths;
+			retdec::ctypes::CallConvention callConvention;
+		};
+
 	private:
 		/// Context for the parser (to speedup the parsing).
 		ParserContext parserContext;
 
 		/// Map used to store pointers to JSON types (to speedup the parsing).
 		TypesMap typesMap;
+
+		/// Type databases registered by addLazySource(), searched in order
+		/// by materializeFunction().
+		std::vector<std::unique_ptr<LazySource>> lazySources;
 };
 
 } // namespace ctypesparser
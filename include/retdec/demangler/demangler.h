@@ -7,8 +7,10 @@
 #ifndef RETDEC_DEMANGLER_DEMANGLERL_H
 #define RETDEC_DEMANGLER_DEMANGLERL_H
 
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "retdec/demangler/gparser.h"
 
@@ -38,6 +40,8 @@ public:
 	void createGrammar(std::string inputfilename, std::string outputname);
 	cName *demangleToClass(std::string inputName);
 	std::string demangleToString(std::string inputName);
+	std::map<std::string, std::string> demangleBatchToStrings(
+		std::vector<std::string> inputNames);
 	void setSubAnalyze(bool x);
 };
 
@@ -768,6 +768,46 @@ public:
 	size_t lex_position = 0; //position in the source file
 	std::fstream *source = nullptr; //pointer to the input filestream
 
+	/**
+	 * @brief Reusable working containers of the per-symbol analysis.
+	 * Both analyze() and subanalyze() take their working stacks and vectors
+	 * from here instead of constructing them locally. The containers are
+	 * cleared -- but keep their allocated capacity -- before every symbol,
+	 * so demangling does not allocate them again in the steady state.
+	 */
+	struct workmem_t {
+		//analyze()
+		std::stack<gelem_t> elemstack;
+		std::vector<unsigned int> used_rules;
+		std::vector<cName::type_t> current_param_vector;
+		std::vector<cName::name_t> name_substitution_vector;
+		std::vector<cName::type_t> type_substitution_vector;
+		std::stack<cName::type_t> param_stack;
+		std::stack<std::vector<cName::type_t>> param_vector_stack;
+		std::stack<std::vector<cName::name_t>> name_vector_stack;
+		std::stack<std::vector<cName::name_t>> name_substitution_stack;
+		std::stack<std::vector<cName::type_t>> type_substitution_stack;
+		std::stack<bool> btypesub_stack;
+		std::vector<cName::name_t> current_name;
+		//subanalyze()
+		std::stack<gelem_t> sub_elemstack;
+		std::stack<std::string> name_stack;
+		std::stack<std::string> paramm_stack;
+		std::stack<std::string> params_stack;
+		std::stack<std::vector<std::string>> arrays_stack;
+		std::vector<std::string> template_subs;
+		std::vector<std::string> substitutions;
+		std::vector<std::string> arrays;
+		std::vector<unsigned int> sub_used_rules;
+
+		void reset();
+	};
+
+	/**
+	* @brief Working containers reused by the analysis of every symbol.
+	*/
+	workmem_t workmem;
+
 	/*
 	 * methods
 	 */
@@ -19,7 +19,8 @@ public:
 	static cGram::ruleaddr_t ruleaddrs[534];
 	static cGram::gelem_t ruleelements[796];
 	static cGram::gelem_t root;
-	cGram::igram_t getInternalGrammar();
+	static cGram::llelem_t* llst_rows[249];
+	static cGram::igram_t getInternalGrammar();
 };
 
 } // namespace demangler
@@ -8,7 +8,7 @@
 #define RETDEC_DWARFPARSER_DWARF_CU_H
 
 #include <cstdlib>
-#include <list>
+#include <vector>
 
 #include "retdec/dwarfparser/dwarf_base.h"
 
@@ -34,7 +34,7 @@ class DwarfCU : public DwarfBaseElement
 
 		std::size_t srcFilesCount();
 		void addSrcFile(std::string f);
-		std::string *getSrcFile(unsigned idx);
+		const std::string *getSrcFile(unsigned idx);
 		int findSrcFile(std::string f, const std::string **ret);
 		bool IsLanguageC() const;
 		bool IsLanguageCpp() const;
@@ -47,7 +47,9 @@ class DwarfCU : public DwarfBaseElement
 		Dwarf_Unsigned language;           ///< A code indicating the source language.
 
 	private:
-		std::list<std::string> m_srcFiles; ///< List of source file of this compilation unit.
+		/// Source files of this compilation unit. Names are interned in the
+		/// parent file, so compilation units share them.
+		std::vector<const std::string*> m_srcFiles;
 };
 
 /**
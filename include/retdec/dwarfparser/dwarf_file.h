@@ -27,6 +27,8 @@
 #define RETDEC_DWARFPARSER_DWARF_FILE_H
 
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include <libdwarf/dwarf.h>
 #include <libdwarf/libdwarf.h>
@@ -67,6 +69,8 @@ class DwarfFile
 
 	//
 	// Functions getting particular DWARF records.
+	// Compilation units are parsed lazily -- the first call of any getter
+	// parses all the compilation units that were not parsed yet.
 	//
 	public:
 		DwarfCUContainer *getCUs();
@@ -75,17 +79,36 @@ class DwarfFile
 		DwarfTypeContainer *getTypes();
 		DwarfVarContainer *getGlobalVars();
 		Dwarf_Debug &getDwarfDebug();
+		bool loadCUAtAddress(Dwarf_Unsigned address);
 
 	//
 	// Private methods.
 	//
 	private:
 		bool loadFile(std::string fileName, retdec::fileformat::FileFormat *fileParser);
-		void loadFileCUs();
+		void indexFileCUs();
+		void loadAllCUs();
 		void loadCUtree(Dwarf_Die die, DwarfBaseElement* parent, int lvl);
 		void loadDIE(Dwarf_Die die, DwarfBaseElement* &parent, int lvl);
 		void makeStructTypesUnique();
 
+	//
+	// Cheap index of compilation units used for lazy parsing.
+	//
+	private:
+		/**
+		 * @brief Index record of one compilation unit.
+		 */
+		struct CUIndexEntry
+		{
+			Dwarf_Off dieOffset;     ///< Global offset of the CU DIE.
+			Dwarf_Unsigned lowAddr;  ///< Lowest address covered by the CU.
+			Dwarf_Unsigned highAddr; ///< Highest address covered by the CU.
+			bool loaded;             ///< CU DIE subtree was already parsed.
+		};
+
+		bool loadIndexedCU(CUIndexEntry &entry);
+
 	//
 	// Containers storing high-level representation of DWARF data.
 	//
@@ -112,6 +135,21 @@ class DwarfFile
 	private:
 		DwarfCU *m_activeCU;
 
+	//
+	// Index of compilation units used for lazy parsing.
+	//
+	private:
+		std::vector<CUIndexEntry> m_cuIndex; ///< Index of all CUs in the file.
+		bool m_allCUsLoaded;                 ///< All indexed CUs were parsed.
+
+	//
+	// Strings shared by all compilation units.
+	//
+	public:
+		const std::string *internString(std::string s);
+	private:
+		std::unordered_set<std::string> m_internedStrings; ///< One copy of each distinct string.
+
 	//
 	// Resources.
 	//
@@ -8,7 +8,6 @@
 #define RETDEC_DWARFPARSER_DWARF_LINENUMBERS_H
 
 #include <cstdlib>
-#include <list>
 #include <vector>
 
 #include "retdec/dwarfparser/dwarf_base.h"
@@ -73,13 +72,17 @@ class DwarfLineContainer : public DwarfBaseContainer<DwarfLine>
 
 		std::vector<Dwarf_Addr> getAddrByLine(std::string file, Dwarf_Unsigned line);
 		DwarfLine *getLineByAddr(Dwarf_Addr addr);
+		std::vector<DwarfLine*> getLinesInRange(Dwarf_Addr lowAddr, Dwarf_Addr highAddr);
 
 	private:
 		void loadLine(Dwarf_Line line);
-		std::string *findSrcFile(std::string f);
+		const std::string *findSrcFile(std::string f);
+		void buildAddrTable();
 
 	private:
-		std::list<std::string> m_srcFiles; ///< List of all source file names used in lines.
+		const std::string *m_lastSrcFile; ///< Source file of the lastly loaded line.
+		std::vector<DwarfLine*> m_addrTable; ///< Flat table of lines sorted by address.
+		bool m_addrTableValid; ///< Address table is up to date with container contents.
 };
 
 } // namespace dwarfparser
@@ -100,6 +100,8 @@ class DwarfLocationDesc
 		void dump();
 
 	private:
+		cLocType computeLocationImpl(std::string *n, Dwarf_Addr *a, Dwarf_Addr pc,
+			Dwarf_Addr base, bool hasBase);
 		cLocType evaluateExpression(Expression &expr, std::string *retN, Dwarf_Addr *retA,
 			Dwarf_Addr pc = 0, Dwarf_Addr base = 0, bool hasBase = false);
 
@@ -107,6 +109,12 @@ class DwarfLocationDesc
 		std::vector<Expression> m_exprs; ///< Vector of expressions of this location.
 		DwarfFunction *m_baseFunc;       ///< Pointer to base function containing frame base location.
 		DwarfBaseElement *m_parent;      ///< Pointer to object which owns this location.
+
+		bool m_cacheValid;               ///< @c true if the cached result below is usable.
+		Dwarf_Addr m_cachePc;            ///< Program counter the cached result was computed for.
+		eLocType m_cacheType;            ///< Cached location type.
+		std::string m_cacheName;         ///< Cached address space or register array name.
+		Dwarf_Addr m_cacheAddr;          ///< Cached address or register number.
 };
 
 } // namespace dwarfparser
@@ -64,7 +64,9 @@ enum LoadFlags
 	NONE              = 0,
 	NO_FILE_HASHES    = 1,
 	NO_VERBOSE_HASHES = 2,
-	DETECT_STRINGS    = 4
+	DETECT_STRINGS    = 4,
+	MAP_INPUT_FILE    = 8,
+	ASYNC_CERTIFICATES = 16
 };
 
 } // namespace fileformat
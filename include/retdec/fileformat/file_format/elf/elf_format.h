@@ -65,6 +65,8 @@ class ElfFormat : public FileFormat
 		void loadSegments();
 		void loadInfoFromDynamicTables(std::size_t noOfTables);
 		void loadInfoFromDynamicSegment();
+		bool lookupSymbolInGnuHashTable(const ELFIO::section *hashSec, const SymbolTable &symTab, const std::string &name, std::size_t &symbolIndex) const;
+		bool lookupSymbolInHashTable(const ELFIO::section *hashSec, const SymbolTable &symTab, const std::string &name, std::size_t &symbolIndex) const;
 		/// @}
 	protected:
 		int elfClass;        ///< class of input ELF file
@@ -120,7 +122,10 @@ class ElfFormat : public FileFormat
 
 		/// @name Other methods
 		/// @{
+		using FileFormat::getSymbol;
+		virtual const Symbol* getSymbol(const std::string &name) const override;
 		unsigned long long getBaseOffset() const;
+		const Symbol* getDynamicSymbol(const std::string &name) const;
 		/// @}
 };
 
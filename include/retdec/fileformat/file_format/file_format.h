@@ -13,8 +13,11 @@
 #include <set>
 #include <vector>
 
+#include <llvm/ADT/StringRef.h>
+
 #include "retdec/config/config.h"
 #include "retdec/utils/byte_value_storage.h"
+#include "retdec/utils/memory_mapped_file.h"
 #include "retdec/utils/non_copyable.h"
 #include "retdec/fileformat/fftypes.h"
 
@@ -30,11 +33,13 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::ifstream auxStream;                 ///< auxiliary member for opening of input file
 		std::vector<unsigned char> *loadedBytes; ///< reference to serialized content of input file
 		LoadFlags loadFlags;                     ///< load flags for configurable file loading
+		retdec::utils::MemoryMappedFile mappedFile; ///< memory mapping of input file (used with @c LoadFlags::MAP_INPUT_FILE)
 
 		/// @name Initialization methods
 		/// @{
 		void init();
 		void initStream();
+		void materializeBytes() const;
 		template<typename T> void initFormatArch(T derivedPtr, const retdec::config::Architecture &arch);
 		/// @}
 
@@ -56,7 +61,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::vector<SymbolTable*> symbolTables;                           ///< symbol tables
 		std::vector<RelocationTable*> relocationTables;                   ///< relocation tables
 		std::vector<DynamicTable*> dynamicTables;                         ///< tables with dynamic records
-		std::vector<unsigned char> bytes;                                 ///< content of file as bytes
+		mutable std::vector<unsigned char> bytes;                         ///< content of file as bytes (filled lazily by materializeBytes() when the file is memory-mapped)
 		std::vector<String> strings;                                      ///< detected strings
 		std::set<std::uint64_t> unknownRelocs;                            ///< unknown relocations
 		ImportTable *importTable;                                         ///< table of imports
@@ -82,6 +87,18 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		void computeSectionTableHashes();
 		/// @}
 
+		/// @name Lazy loading methods
+		///
+		/// The getters of the corresponding structures call these methods
+		/// before handing out the result. A format which parses some of its
+		/// structures lazily overrides them; by default, they do nothing.
+		/// @{
+		virtual void loadRichHeaderOnDemand() const;
+		virtual void loadPdbInfoOnDemand() const;
+		virtual void loadResourcesOnDemand() const;
+		virtual void loadCertificatesOnDemand() const;
+		/// @}
+
 		/// @name Setters
 		/// @{
 		void setLoadedBytes(std::vector<unsigned char> *lBytes);
@@ -182,6 +199,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		bool getHexBytesFromEnd(std::string &result, unsigned long long numberOfBytes) const;
 		bool getString(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const;
 		bool getStringFromEnd(std::string &result, unsigned long long numberOfBytes) const;
+		const llvm::StringRef getLoadedBytes(unsigned long long offset, unsigned long long numberOfBytes) const;
 		const Section* getEpSection();
 		const Section* getSection(const std::string &secName) const;
 		const Section* getSection(unsigned long long secIndex) const;
@@ -202,7 +220,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		const RichHeader* getRichHeader() const;
 		const PdbInfo* getPdbInfo() const;
 		const CertificateTable* getCertificateTable() const;
-		const Symbol* getSymbol(const std::string &name) const;
+		virtual const Symbol* getSymbol(const std::string &name) const;
 		const Symbol* getSymbol(unsigned long long address) const;
 		const Relocation* getRelocation(const std::string &name) const;
 		const Relocation* getRelocation(unsigned long long address) const;
@@ -86,6 +86,7 @@ class IntelHexParser
 		/// @name Hexadecimal conversions
 		/// @{
 		static unsigned long long strToInt(const std::string &str);
+		static int hexDigit(char c);
 		static bool isHexadec(char c);
 		static bool isHexadec(const std::string &vec);
 		/// @}
@@ -60,11 +60,17 @@ class IntelHexTokenizer
 {
 	private:
 		std::ifstream fstr;
-		std::istream *source = nullptr;
+		/// Whole input in one contiguous buffer.
+		std::string content;
+		/// Position of the next unread character in @c content.
+		std::string::size_type pos = 0;
+		/// Total number of data bytes found by the structural scan.
+		std::size_t dataBytes = 0;
 
 		/// @name Helper methods
 		/// @{
-		std::string readN(unsigned n);
+		int readByte();
+		void scanContent();
 		IntelHexToken makeErrorToken(const std::string &errorMessage);
 		/// @}
 	public:
@@ -74,6 +80,7 @@ class IntelHexTokenizer
 		/// @name Getters
 		/// @{
 		IntelHexToken getToken();
+		std::size_t getDataByteCount() const;
 		/// @}
 
 		/// @name Initialization functions
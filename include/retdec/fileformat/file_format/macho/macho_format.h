@@ -80,6 +80,7 @@ class MachOFormat : public FileFormat
 		/// @name Symbols & Imports & Exports commands methods
 		/// @{
 		void loadDylibCommand(const llvm::object::MachOObjectFile::LoadCommandInfo &commandInfo);
+		void parseSymbolEntries();
 		void symtabCommand();
 		MachOSection* getLazySymbolsSection() const;
 		MachOSection* getNonLazySymbolsSection() const;
@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_FILE_FORMAT_PE_PE_FORMAT_H
 #define RETDEC_FILEFORMAT_FILE_FORMAT_PE_PE_FORMAT_H
 
+#include <future>
+
 #include <pelib/PeLib.h>
 
 #include "retdec/crypto/hash_context.h"
@@ -28,6 +30,16 @@ namespace fileformat {
 class PeFormat : public FileFormat
 {
 	private:
+		/**
+		 * Header of one .NET metadata stream whose content is parsed lazily
+		 */
+		struct DotnetStreamHeader
+		{
+			std::string name;     ///< name of stream
+			std::uint64_t offset; ///< offset of stream relative to metadata header
+			std::uint64_t size;   ///< size of stream
+		};
+
 		PeFormatParser *formatParser;                              ///< parser of PE file
 		PeLib::MzHeader mzHeader;                                  ///< MZ header
 		std::unique_ptr<CLRHeader> clrHeader;                      ///< .NET CLR header
@@ -41,6 +53,15 @@ class PeFormat : public FileFormat
 		std::string typeLibId;                                     ///< .NET type lib ID
 		std::vector<std::shared_ptr<DotnetClass>> definedClasses;  ///< .NET defined class list
 		std::vector<std::shared_ptr<DotnetClass>> importedClasses; ///< .NET imported class list
+		std::uint64_t metadataHeaderAddress;                       ///< address of .NET metadata header
+		std::vector<DotnetStreamHeader> dotnetStreamHeaders;       ///< .NET stream headers waiting for lazy parsing
+		bool richHeaderLoaded;                                     ///< was the rich header already parsed?
+		bool pdbInfoLoaded;                                        ///< was the PDB debug information already parsed?
+		bool resourcesLoaded;                                      ///< were the resources already parsed?
+		bool certificatesLoaded;                                   ///< were the certificates already parsed?
+		bool dotnetHeadersLoaded;                                  ///< were the .NET headers already parsed?
+		bool dotnetStreamsLoaded;                                  ///< were the .NET stream contents already parsed?
+		std::future<void> certificatesFuture;                      ///< asynchronously started certificate processing (used with @c LoadFlags::ASYNC_CERTIFICATES)
 
 		/// @name Initialization methods
 		/// @{
@@ -67,6 +88,16 @@ class PeFormat : public FileFormat
 		void loadCertificates();
 		/// @}
 
+		/// @name Lazy loading methods
+		/// @{
+		virtual void loadRichHeaderOnDemand() const override;
+		virtual void loadPdbInfoOnDemand() const override;
+		virtual void loadResourcesOnDemand() const override;
+		virtual void loadCertificatesOnDemand() const override;
+		void loadDotnetHeadersOnDemand() const;
+		void loadDotnetStreamsOnDemand() const;
+		/// @}
+
 		/// @name Signature verification methods
 		/// @{
 		bool verifySignature(PKCS7 *p7);
@@ -77,6 +108,7 @@ class PeFormat : public FileFormat
 		/// @name .NET methods
 		/// @{
 		void loadDotnetHeaders();
+		void loadDotnetStreams();
 		void parseMetadataStream(std::uint64_t baseAddress, std::uint64_t offset, std::uint64_t size);
 		void parseBlobStream(std::uint64_t baseAddress, std::uint64_t offset, std::uint64_t size);
 		void parseGuidStream(std::uint64_t baseAddress, std::uint64_t offset, std::uint64_t size);
@@ -7,6 +7,7 @@
 #ifndef RETDEC_FILEFORMAT_FORMAT_FACTORY_H
 #define RETDEC_FILEFORMAT_FORMAT_FACTORY_H
 
+#include <istream>
 #include <memory>
 
 #include "retdec/fileformat/file_format/file_format.h"
@@ -14,7 +15,18 @@
 namespace retdec {
 namespace fileformat {
 
+/**
+ * Parsing an input file is expensive, so create one @c FileFormat per input
+ * and hand it to everything that needs the parsed file. All the in-process
+ * consumers can work over a caller-owned instance instead of parsing their
+ * own: @c retdec::loader::createImage() accepts a shared instance,
+ * @c retdec::cpdetect::createCompilerDetector() takes a reference, and
+ * @c retdec::dwarfparser::DwarfFile takes an optional parser pointer. Pass
+ * @c LoadFlags::MAP_INPUT_FILE to back the instance by a memory mapping of
+ * the input instead of reading the whole file upfront.
+ */
 std::unique_ptr<FileFormat> createFileFormat(const std::string &filePath, retdec::config::Config *config = nullptr, LoadFlags loadFlags = LoadFlags::NONE);
+std::unique_ptr<FileFormat> createFileFormat(std::istream &inputStream, retdec::config::Config *config = nullptr, LoadFlags loadFlags = LoadFlags::NONE);
 
 } // namespace fileformat
 } // namespace retdec
@@ -18,7 +18,9 @@ namespace fileformat {
 class Export
 {
 	private:
-		std::string name;                 ///< export name
+		/// Export name. Names repeat heavily across input files, so they
+		/// are interned -- this points to the single process-wide copy.
+		const std::string* name;
 		unsigned long long address;       ///< address of export
 		unsigned long long ordinalNumber; ///< ordinal number
 		bool ordinalNumberIsValid;        ///< @c true if ordinal number is valid
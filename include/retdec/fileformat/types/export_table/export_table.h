@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_TYPES_EXPORT_TABLE_EXPORT_TABLE_H
 #define RETDEC_FILEFORMAT_TYPES_EXPORT_TABLE_EXPORT_TABLE_H
 
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "retdec/fileformat/types/export_table/export.h"
@@ -22,6 +24,16 @@ class ExportTable
 	private:
 		using exportsIterator = std::vector<Export>::const_iterator;
 		std::vector<Export> exports; ///< stored exports
+		/// name of export -> index of its first occurrence (built lazily)
+		mutable std::unordered_map<std::string, std::size_t> nameIndex;
+		/// sorted (address, index) pairs for binary search (built lazily)
+		mutable std::vector<std::pair<unsigned long long, std::size_t>> addressIndex;
+		mutable bool indexesAreValid;  ///< @c true if lookup indexes are up to date
+
+		/// @name Auxiliary methods
+		/// @{
+		void buildIndexes() const;
+		/// @}
 	public:
 		ExportTable();
 		~ExportTable();
@@ -32,6 +44,8 @@ class ExportTable
 		const Export* getExport(std::size_t exportIndex) const;
 		const Export* getExport(const std::string &name) const;
 		const Export* getExportOnAddress(unsigned long long address) const;
+		const Export* findByName(const std::string &name) const;
+		const Export* findByAddress(unsigned long long address) const;
 		/// @}
 
 		/// @name Iterators
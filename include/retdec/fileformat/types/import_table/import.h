@@ -18,7 +18,9 @@ namespace fileformat {
 class Import
 {
 	private:
-		std::string name;                 ///< import name
+		/// Import name. Names repeat heavily across input files, so they
+		/// are interned -- this points to the single process-wide copy.
+		const std::string* name;
 		unsigned long long libraryIndex;  ///< index of library from which is import imported
 		unsigned long long address;       ///< address of import
 		unsigned long long ordinalNumber; ///< ordinal number
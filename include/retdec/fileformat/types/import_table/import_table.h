@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_TYPES_IMPORT_TABLE_IMPORT_TABLE_H
 #define RETDEC_FILEFORMAT_TYPES_IMPORT_TABLE_IMPORT_TABLE_H
 
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "retdec/fileformat/types/import_table/import.h"
@@ -27,6 +29,16 @@ class ImportTable
 		std::string impHashCrc32;                ///< imphash CRC32
 		std::string impHashMd5;                  ///< imphash MD5
 		std::string impHashSha256;               ///< imphash SHA256
+		/// name of import -> index of its first occurrence (built lazily)
+		mutable std::unordered_map<std::string, std::size_t> nameIndex;
+		/// sorted (address, index) pairs for binary search (built lazily)
+		mutable std::vector<std::pair<unsigned long long, std::size_t>> addressIndex;
+		mutable bool indexesAreValid;            ///< @c true if lookup indexes are up to date
+
+		/// @name Auxiliary methods
+		/// @{
+		void buildIndexes() const;
+		/// @}
 	public:
 		ImportTable();
 		~ImportTable();
@@ -45,6 +57,8 @@ class ImportTable
 		const Import* getImport(std::size_t importIndex) const;
 		const Import* getImport(const std::string &name) const;
 		const Import* getImportOnAddress(unsigned long long address) const;
+		const Import* findByName(const std::string &name) const;
+		const Import* findByAddress(unsigned long long address) const;
 		/// @}
 
 		/// @name Iterators
@@ -91,6 +91,7 @@ class Resource
 		void invalidateLanguageId();
 		void invalidateSublanguageId();
 		void load(const FileFormat *rOwner);
+		void computeHashes();
 		bool hasCrc32() const;
 		bool hasMd5() const;
 		bool hasSha256() const;
@@ -50,6 +50,7 @@ class ResourceTable
 		/// @{
 		void clear();
 		void addResource(Resource &newResource);
+		void computeResourceHashes();
 		bool hasResources() const;
 		bool hasResourceWithName(const std::string &rName) const;
 		bool hasResourceWithName(std::size_t rId) const;
@@ -51,6 +51,8 @@ class SecSeg
 		bool entrySizeIsValid;            ///< size of one entry in section or segment
 		bool isInMemory;                  ///< @c true if the section or segment will appear in the memory image of a process
 		bool loaded;                      ///< @c true if content of section or segment was successfully loaded from input file
+		mutable double entropy;           ///< entropy of section or segment data, computed lazily by getEntropy()
+		mutable bool entropyIsValid;      ///< @c true if @c entropy was already computed
 
 		void computeHashes();
 	public:
@@ -83,6 +85,7 @@ class SecSeg
 		std::string getCrc32() const;
 		std::string getMd5() const;
 		std::string getSha256() const;
+		double getEntropy() const;
 		std::string getName() const;
 		const char* getNameAsCStr() const;
 		const llvm::StringRef getBytes(unsigned long long sOffset = 0, unsigned long long sSize = 0) const;
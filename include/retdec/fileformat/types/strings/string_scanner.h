@@ -0,0 +1,35 @@
+/**
+ * @file include/retdec/fileformat/types/strings/string_scanner.h
+ * @brief Vectorized scanner of printable-character runs.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_SCANNER_H
+#define RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_SCANNER_H
+
+#include <cstddef>
+
+#include "retdec/fileformat/types/strings/character_iterator.h"
+
+namespace retdec {
+namespace fileformat {
+
+/// @name String scanning
+///
+/// Scanning of raw data for runs of valid string characters. A character of
+/// @a charSize bytes starting at some offset is valid if its character byte
+/// is printable ASCII and all its padding bytes are zero; for little endian
+/// the character byte comes first, for big endian last. The scanners classify
+/// 16 bytes at a time using SSE2 or NEON where available and fall back to a
+/// scalar implementation elsewhere.
+/// @{
+std::size_t findNextCharacterStart(const unsigned char* data, std::size_t size,
+	std::size_t pos, std::size_t charSize, CharacterEndianness endian);
+std::size_t findCharacterRunEnd(const unsigned char* data, std::size_t size,
+	std::size_t pos, std::size_t charSize, CharacterEndianness endian);
+/// @}
+
+} // namespace fileformat
+} // namespace retdec
+
+#endif
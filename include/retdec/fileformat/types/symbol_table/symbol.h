@@ -37,8 +37,12 @@ class Symbol
 			FILE
 		};
 	private:
-		std::string name;                 ///< symbol name (normalized name)
-		std::string originalName;         ///< original name of symbol
+		/// Symbol name (normalized name). Names repeat heavily across
+		/// symbols, so they are interned -- this points to the single
+		/// process-wide copy of the name.
+		const std::string* name;
+		/// Original name of symbol (interned, see @c name).
+		const std::string* originalName;
 		Type type;                        ///< symbol type
 		UsageType usageType;              ///< usage of symbol
 		unsigned long long index;         ///< symbol index
@@ -8,6 +8,8 @@
 #define RETDEC_FILEFORMAT_TYPES_SYMBOL_TABLE_SYMBOL_TABLE_H
 
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "retdec/fileformat/types/symbol_table/symbol.h"
@@ -25,6 +27,20 @@ class SymbolTable
 		using symbolsIterator = std::vector<std::shared_ptr<Symbol>>::iterator;
 		std::vector<std::shared_ptr<Symbol>> table; ///< stored symbols
 		std::string name;                           ///< name of symbol table
+		/// name of symbol -> index of its first occurrence (built lazily)
+		mutable std::unordered_map<std::string, std::size_t> nameIndex;
+		/// sorted (address, index) pairs for binary search (built lazily)
+		mutable std::vector<std::pair<unsigned long long, std::size_t>> addressIndex;
+		/// stored symbol index -> table position of its first occurrence
+		/// (built lazily)
+		mutable std::unordered_map<std::size_t, std::size_t> storedIndexMap;
+		mutable bool indexesAreValid;               ///< @c true if lookup indexes are up to date
+
+		/// @name Auxiliary methods
+		/// @{
+		void buildIndexes() const;
+		void invalidateIndexes();
+		/// @}
 	public:
 		SymbolTable();
 		~SymbolTable();
@@ -36,6 +52,8 @@ class SymbolTable
 		const Symbol* getSymbol(const std::string &name) const;
 		const Symbol* getSymbolOnAddress(unsigned long long addr) const;
 		const Symbol* getSymbolWithIndex(std::size_t symbolIndex) const;
+		const Symbol* findByName(const std::string &name) const;
+		const Symbol* findByAddress(unsigned long long addr) const;
 		const std::string& getName() const;
 		/// @}
 
@@ -58,6 +76,7 @@ class SymbolTable
 		/// @name Other methods
 		/// @{
 		void clear();
+		void reserve(std::size_t capacity);
 		void addSymbol(const std::shared_ptr<Symbol> &symbol);
 		void addSymbol(std::shared_ptr<Symbol> &&symbol);
 		bool hasSymbols() const;
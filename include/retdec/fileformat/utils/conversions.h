@@ -11,6 +11,8 @@
 #include <sstream>
 #include <vector>
 
+#include <llvm/ADT/StringRef.h>
+
 #include "retdec/fileformat/utils/other.h"
 
 namespace retdec {
@@ -43,6 +45,7 @@ template<typename N> bool addUniqueValue(std::vector<N> &currentValues, N newVal
 
 std::ios_base& hexWithPrefix(std::ios_base &str);
 void separateStrings(std::string &str, std::vector<std::string> &words);
+void separateStrings(llvm::StringRef str, std::vector<std::string> &words);
 
 } // namespace fileformat
 } // namespace retdec
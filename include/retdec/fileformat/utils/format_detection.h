@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_UTILS_FORMAT_DETECTION_H
 #define RETDEC_FILEFORMAT_UTILS_FORMAT_DETECTION_H
 
+#include <istream>
+
 #include "retdec/config/config.h"
 #include "retdec/fileformat/fftypes.h"
 
@@ -14,6 +16,7 @@ namespace retdec {
 namespace fileformat {
 
 Format detectFileFormat(const std::string &filePath, retdec::config::Config *config = nullptr);
+Format detectFileFormat(std::istream &inputStream, retdec::config::Config *config = nullptr);
 
 } // namespace fileformat
 } // namespace retdec
@@ -59,6 +59,18 @@ void printSubSubPhase(const std::string &phaseName,
 void printSubSubSubPhase(const std::string &phaseName,
 	llvm::raw_ostream &stream = llvm::outs());
 
+// The report*Phase() variants record the phase into the binary event log
+// (see retdec/utils/event_log.h) even when @a print is false, so production
+// runs keep their phase traces without paying for the stream formatting.
+void reportPhase(bool print, const std::string &phaseName,
+	llvm::raw_ostream &stream = llvm::outs());
+void reportSubPhase(bool print, const std::string &phaseName,
+	llvm::raw_ostream &stream = llvm::outs());
+void reportSubSubPhase(bool print, const std::string &phaseName,
+	llvm::raw_ostream &stream = llvm::outs());
+void reportSubSubSubPhase(bool print, const std::string &phaseName,
+	llvm::raw_ostream &stream = llvm::outs());
+
 /// @}
 
 /// @name Messages
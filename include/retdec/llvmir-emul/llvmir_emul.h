@@ -7,9 +7,13 @@
 #ifndef RETDEC_LLVMIR_EMUL_LLVMIR_EMUL_H
 #define RETDEC_LLVMIR_EMUL_LLVMIR_EMUL_H
 
+#include <array>
 #include <list>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <llvm/CodeGen/IntrinsicLowering.h>
 #include <llvm/ExecutionEngine/GenericValue.h>
@@ -66,6 +70,83 @@ class AllocaHolder
 
 class LocalExecutionContext;
 
+/**
+ * Emulated memory modeled as a page table over 4 KB pages (4096 addresses,
+ * one @c llvm::GenericValue slot per address) allocated on first store.
+ * A load or store does one page lookup instead of one map lookup per address,
+ * and the last accessed page is cached, so the sequential accesses typical
+ * for unpacking loops do not pay even for the page lookup.
+ */
+class MemoryPageTable
+{
+	public:
+		static const uint64_t PageSize = 0x1000;
+
+		struct Page
+		{
+			std::array<llvm::GenericValue, PageSize> slots;
+		};
+
+	public:
+		MemoryPageTable() = default;
+		MemoryPageTable(const MemoryPageTable& o) :
+				_pages(o._pages)
+		{
+
+		}
+		MemoryPageTable& operator=(const MemoryPageTable& o)
+		{
+			// The cache points into this object's pages -- it must not be
+			// copied, and it is invalidated by the copy.
+			_pages = o._pages;
+			_lastPage = nullptr;
+			return *this;
+		}
+
+		llvm::GenericValue get(uint64_t addr)
+		{
+			Page* p = findPage(addr & ~(PageSize - 1));
+			return p ? p->slots[addr & (PageSize - 1)] : llvm::GenericValue();
+		}
+
+		void set(uint64_t addr, const llvm::GenericValue& val)
+		{
+			uint64_t pageAddr = addr & ~(PageSize - 1);
+			Page* p = findPage(pageAddr);
+			if (p == nullptr)
+			{
+				_lastPage = &_pages[pageAddr];
+				_lastPageAddr = pageAddr;
+				p = _lastPage;
+			}
+			p->slots[addr & (PageSize - 1)] = val;
+		}
+
+	private:
+		Page* findPage(uint64_t pageAddr)
+		{
+			if (_lastPage && _lastPageAddr == pageAddr)
+			{
+				return _lastPage;
+			}
+			auto fIt = _pages.find(pageAddr);
+			if (fIt == _pages.end())
+			{
+				return nullptr;
+			}
+			// Element addresses in std::unordered_map are stable, so the
+			// cached pointer stays valid when other pages are added.
+			_lastPage = &fIt->second;
+			_lastPageAddr = pageAddr;
+			return _lastPage;
+		}
+
+	private:
+		std::unordered_map<uint64_t, Page> _pages;
+		Page* _lastPage = nullptr;
+		uint64_t _lastPageAddr = 0;
+};
+
 /**
  * This is not ideal.
  * 1) Memory accesses are separated into global variable accesses and memory
@@ -99,13 +180,13 @@ class GlobalExecutionContext
 	public:
 		llvm::Module* _module = nullptr;
 
-		std::map<uint64_t, llvm::GenericValue> memory;
-		std::list<uint64_t> memoryLoads;
-		std::list<uint64_t> memoryStores;
+		MemoryPageTable memory;
+		std::vector<uint64_t> memoryLoads;
+		std::vector<uint64_t> memoryStores;
 
-		std::map<llvm::GlobalVariable*, llvm::GenericValue> globals;
-		std::list<llvm::GlobalVariable*> globalsLoads;
-		std::list<llvm::GlobalVariable*> globalsStores;
+		std::unordered_map<llvm::GlobalVariable*, llvm::GenericValue> globals;
+		std::vector<llvm::GlobalVariable*> globalsLoads;
+		std::vector<llvm::GlobalVariable*> globalsStores;
 
 		/// LLVM values of all emulated objects.
 		/// In the original LLVM's interpret implementation, this was in local
@@ -113,7 +194,13 @@ class GlobalExecutionContext
 		/// However, we want to provide this information to the user of this
 		/// library after emulation is done, so we need to preserve it for all
 		/// emulated objects and not to thorw it away after local frame is left.
-		std::map<llvm::Value*, llvm::GenericValue> values;
+		std::unordered_map<llvm::Value*, llvm::GenericValue> values;
+
+		/// Cache of evaluated plain constant operands. LLVM constants are
+		/// uniqued per context, so one evaluation per constant is enough --
+		/// without this, every occurrence of a constant operand re-runs the
+		/// whole getConstantValue() computation.
+		std::unordered_map<llvm::Constant*, llvm::GenericValue> constants;
 };
 
 class LocalExecutionContext
@@ -161,8 +248,8 @@ class LlvmIrEmulator : public llvm::InstVisitor<LlvmIrEmulator>
 	// Emulation query methods.
 	//
 	public:
-		const std::list<llvm::Instruction*>& getVisitedInstructions() const;
-		const std::list<llvm::BasicBlock*>& getVisitedBasicBlocks() const;
+		const std::vector<llvm::Instruction*>& getVisitedInstructions() const;
+		const std::vector<llvm::BasicBlock*>& getVisitedBasicBlocks() const;
 		bool wasInstructionVisited(llvm::Instruction* i) const;
 		bool wasBasicBlockVisited(llvm::BasicBlock* bb) const;
 
@@ -196,6 +283,41 @@ class LlvmIrEmulator : public llvm::InstVisitor<LlvmIrEmulator>
 
 		llvm::GenericValue getValueValue(llvm::Value* val);
 
+	// Known runtime routine fast paths.
+	//
+	public:
+		/**
+		 * Is function @a f recognized as a known runtime routine
+		 * (memcpy/memset/strlen-like) that gets a native fast-path
+		 * emulation instead of an instruction-by-instruction one?
+		 * Recognition is done by function name, so it covers both
+		 * dynamically linked declarations and statically linked code
+		 * named by signature detection.
+		 */
+		bool isKnownRoutine(llvm::Function* f) const;
+
+	// State snapshot & restore.
+	//
+	public:
+		/**
+		 * Snapshot of the emulator's persistent state -- global memory,
+		 * global variables, value bindings and the emulation logs.
+		 * See takeSnapshot() and restoreSnapshot().
+		 */
+		struct Snapshot
+		{
+			GlobalExecutionContext globalEc;
+			std::vector<llvm::Instruction*> visitedInsns;
+			std::unordered_set<llvm::Instruction*> visitedInsnsSet;
+			std::vector<llvm::BasicBlock*> visitedBbs;
+			std::unordered_set<llvm::BasicBlock*> visitedBbsSet;
+			std::list<CallEntry> calls;
+			llvm::GenericValue exitValue;
+		};
+
+		Snapshot takeSnapshot() const;
+		void restoreSnapshot(const Snapshot& s);
+
 	// This needs to be public for LLVM instruction visitor.
 	// However, users of this class SHOULD NOT call any of these.
 	//
@@ -247,6 +369,12 @@ class LlvmIrEmulator : public llvm::InstVisitor<LlvmIrEmulator>
 
 		void logInstruction(llvm::Instruction* i);
 
+		bool emulateKnownRoutine(
+				llvm::CallInst& I,
+				llvm::Function* cf,
+				const std::vector<llvm::GenericValue>& args);
+		void setKnownRoutineReturnValue(llvm::CallInst& I, uint64_t val);
+
 		void popStackAndReturnValueToCaller(
 				llvm::Type* retT,
 				llvm::GenericValue res);
@@ -264,11 +392,15 @@ class LlvmIrEmulator : public llvm::InstVisitor<LlvmIrEmulator>
 		/// All visited instruction in order of their visitation.
 		/// No cycling checks are performed at the moment -- one instruction
 		/// might be visited multiple times.
-		std::list<llvm::Instruction*> _visitedInsns;
+		std::vector<llvm::Instruction*> _visitedInsns;
+		/// Set of visited instructions for O(1) wasInstructionVisited().
+		std::unordered_set<llvm::Instruction*> _visitedInsnsSet;
 		/// All visited basic blocks in order of their visitation.
 		/// No cycling checks are performed at the moment -- one basic block
 		/// might be visited multiple times.
-		std::list<llvm::BasicBlock*> _visitedBbs;
+		std::vector<llvm::BasicBlock*> _visitedBbs;
+		/// Set of visited basic blocks for O(1) wasBasicBlockVisited().
+		std::unordered_set<llvm::BasicBlock*> _visitedBbsSet;
 
 		/// Intrinsic calls are lowered and not logged here.
 		std::list<CallEntry> _calls;
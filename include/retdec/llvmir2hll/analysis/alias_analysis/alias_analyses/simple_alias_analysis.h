@@ -39,6 +39,8 @@ public:
 	static ShPtr<AliasAnalysis> create();
 
 	virtual void init(ShPtr<Module> module) override;
+	virtual void refreshFuncs(ShPtr<Module> module,
+		const FuncVector &funcs) override;
 	virtual std::string getId() const override;
 	virtual const VarSet &mayPointTo(ShPtr<Variable> var) const override;
 	virtual ShPtr<Variable> pointsTo(ShPtr<Variable> var) const override;
@@ -54,6 +56,9 @@ private:
 private:
 	SimpleAliasAnalysis();
 
+	void computeFuncSummary(ShPtr<Function> func);
+	void composeAllAddressedVars();
+
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
@@ -61,9 +66,15 @@ private:
 	/// @}
 
 private:
-	/// All variables in the module whose address is taken.
+	/// All variables in the module whose address is taken. It is composed
+	/// from @c globalInitAddressedVars and @c funcAddressedVarsMap by
+	/// composeAllAddressedVars().
 	VarSet allAddressedVars;
 
+	/// Variables whose address is taken in the initializers of global
+	/// variables.
+	VarSet globalInitAddressedVars;
+
 	/// Mapping of a function into the set of variables whose address
 	/// is taken in there. Function arguments are included.
 	FuncVarSetMap funcAddressedVarsMap;
@@ -34,6 +34,7 @@ public:
 	virtual ~AliasAnalysis() = 0;
 
 	virtual void init(ShPtr<Module> module);
+	virtual void refreshFuncs(ShPtr<Module> module, const FuncVector &funcs);
 	virtual bool isInitialized() const;
 
 	/**
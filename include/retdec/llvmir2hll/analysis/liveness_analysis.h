@@ -0,0 +1,51 @@
+/**
+* @file include/retdec/llvmir2hll/analysis/liveness_analysis.h
+* @brief An analysis providing shared liveness summaries of functions.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_ANALYSIS_LIVENESS_ANALYSIS_H
+#define RETDEC_LLVMIR2HLL_ANALYSIS_LIVENESS_ANALYSIS_H
+
+#include "retdec/llvmir2hll/support/caching.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Function;
+class UsedVars;
+
+/**
+* @brief An analysis providing shared liveness summaries of functions.
+*
+* For every function, this analysis provides a summary of which variables may
+* be read in it ("gen") and which variables are written into in it ("kill"),
+* together with write counts and the presence of function calls. The summaries
+* are computed on demand, cached, and shared, so several optimizations working
+* with the same facts (like the optimizers eliminating dead assignments) do
+* not have to derive them over and over again.
+*
+* Whenever the body of a function is changed, funcHasBeenChanged() has to be
+* called; the summary of the function is then re-computed upon the next
+* request. To drop all the cached summaries at once, call clearCache().
+*
+* Instances of this class have reference object semantics.
+*/
+class LivenessAnalysis: private retdec::utils::NonCopyable,
+		public Caching<ShPtr<Function>, ShPtr<UsedVars>> {
+public:
+	ShPtr<UsedVars> getLivenessInfo(ShPtr<Function> func);
+	void funcHasBeenChanged(ShPtr<Function> func);
+
+	static ShPtr<LivenessAnalysis> create();
+
+private:
+	LivenessAnalysis();
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
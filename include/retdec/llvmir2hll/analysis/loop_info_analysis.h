@@ -0,0 +1,74 @@
+/**
+* @file include/retdec/llvmir2hll/analysis/loop_info_analysis.h
+* @brief An analysis providing shared information about "while true" loops.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_ANALYSIS_LOOP_INFO_ANALYSIS_H
+#define RETDEC_LLVMIR2HLL_ANALYSIS_LOOP_INFO_ANALYSIS_H
+
+#include <unordered_map>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class WhileLoopStmt;
+struct IndVarInfo;
+struct SplittedWhileTrueLoop;
+
+/**
+* @brief An analysis providing shared information about "while true" loops.
+*
+* For every "while true" loop, this analysis provides the loop splitted by its
+* exit condition (see splitWhileTrueLoop()) and information about its
+* induction variable (see getIndVarInfo()). The results are computed on
+* demand, cached (including the negative answers for loops that cannot be
+* splitted), and shared, so the optimizers converting "while true" loops into
+* other kinds of loops do not have to derive them over and over again.
+*
+* Whenever the statements of a loop are changed, loopHasBeenChanged() has to
+* be called; the information about the loop is then re-computed upon the next
+* request. To drop all the cached information at once, call clearCache().
+*
+* Instances of this class have reference object semantics.
+*/
+class LoopInfoAnalysis: private retdec::utils::NonCopyable {
+public:
+	ShPtr<SplittedWhileTrueLoop> getSplittedLoop(ShPtr<WhileLoopStmt> stmt);
+	ShPtr<IndVarInfo> getIndVarInfo(ShPtr<WhileLoopStmt> stmt);
+	void loopHasBeenChanged(ShPtr<WhileLoopStmt> stmt);
+	void clearCache();
+
+	static ShPtr<LoopInfoAnalysis> create();
+
+private:
+	/// Mapping of a loop into its splitted form.
+	using LoopSplitMap = std::unordered_map<ShPtr<WhileLoopStmt>,
+		ShPtr<SplittedWhileTrueLoop>>;
+
+	/// Mapping of a loop into the information about its induction variable.
+	using LoopIndVarMap = std::unordered_map<ShPtr<WhileLoopStmt>,
+		ShPtr<IndVarInfo>>;
+
+private:
+	LoopInfoAnalysis();
+
+private:
+	/// Cache of the already splitted loops. The presence of a key means that
+	/// the loop has already been splitted (possibly unsuccessfully, in which
+	/// case the mapped value is the null pointer).
+	LoopSplitMap splittedLoopCache;
+
+	/// Cache of the already obtained information about induction variables.
+	/// The presence of a key is to be interpreted in the same way as in @c
+	/// splittedLoopCache.
+	LoopIndVarMap indVarInfoCache;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -48,8 +48,10 @@ public:
 	VarSet getAllVars() const;
 	std::size_t getCount(bool read = true, bool written = true) const;
 	std::size_t getNumOfUses(ShPtr<Variable> var) const;
+	std::size_t getNumOfWrites(ShPtr<Variable> var) const;
 	bool isUsed(ShPtr<Variable> var, bool read = true,
 		bool written = true) const;
+	bool hasCalls() const;
 
 	/// @name Used Variables Accessors
 	/// @{
@@ -84,6 +86,12 @@ private:
 
 	/// Number of uses of a variable.
 	VarCountMap numOfVarUses;
+
+	/// Number of (direct) writes into a variable.
+	VarCountMap numOfVarWrites;
+
+	/// Does the value contain function calls?
+	bool containsCalls;
 };
 
 /**
@@ -123,6 +131,7 @@ private:
 	virtual void visit(ShPtr<ArrayIndexOpExpr> expr) override;
 	virtual void visit(ShPtr<StructIndexOpExpr> expr) override;
 	virtual void visit(ShPtr<DerefOpExpr> expr) override;
+	virtual void visit(ShPtr<CallExpr> expr) override;
 	virtual void visit(ShPtr<AssignStmt> stmt) override;
 	virtual void visit(ShPtr<VarDefStmt> stmt) override;
 	virtual void visit(ShPtr<ForLoopStmt> stmt) override;
@@ -9,6 +9,8 @@
 
 #include <cstddef>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "retdec/llvmir2hll/support/caching.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -207,7 +209,10 @@ private:
 * analysis will know that they have to validate the analysis before using it.
 * Upon calling clearCache(), the analysis gets validated automatically. If you
 * modify or remove a statement and call removeFromCache(), then you do not have
-* to call invalidate().
+* to call invalidate(). Likewise, if all your modifications concern a single
+* variable, you may call removeDependentFromCache() with that variable instead
+* of invalidating the whole analysis -- only the cached results that were
+* computed from the variable are dropped.
 */
 class ValueAnalysis: private OrderedAllVisitor,
 	private retdec::utils::NonCopyable, public ValidState,
@@ -223,11 +228,13 @@ public:
 	/// @{
 	void clearCache();
 	void removeFromCache(ShPtr<Value> value, bool recursive = true);
+	void removeDependentFromCache(ShPtr<Variable> var);
 	/// @}
 
 	/// @name Access To Alias Analysis
 	/// @{
 	void initAliasAnalysis(ShPtr<Module> module);
+	void refreshAliasAnalysis(ShPtr<Module> module, const FuncVector &funcs);
 	const VarSet &mayPointTo(ShPtr<Variable> var) const;
 	ShPtr<Variable> pointsTo(ShPtr<Variable> var) const;
 	bool mayBePointed(ShPtr<Variable> var) const;
@@ -242,6 +249,8 @@ private:
 
 	void computeAndStoreIndirectlyUsedVars(ShPtr<DerefOpExpr> expr);
 
+	void recordCacheDependencies(ShPtr<Value> value, ShPtr<ValueData> data);
+
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
@@ -316,6 +325,11 @@ private:
 	/// Information about the currently computed value.
 	ShPtr<ValueData> valueData;
 
+	/// Mapping of a variable into the cached values whose results were
+	/// computed from it.
+	std::unordered_map<ShPtr<Variable>,
+		std::unordered_set<ShPtr<Value>>> cachedValuesForVar;
+
 	/// Are we writing into a variable?
 	bool writing;
 
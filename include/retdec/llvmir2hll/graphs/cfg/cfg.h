@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -237,6 +238,10 @@ private:
 	/// Vector of nodes.
 	NodeVector nodes;
 
+	/// Set of all nodes in @c nodes for fast membership checks. It has to be
+	/// kept in sync with @c nodes.
+	std::unordered_set<ShPtr<Node>> nodeSet;
+
 	/// Vector of edges.
 	EdgeVector edges;
 
@@ -29,6 +29,7 @@ public:
 	virtual ~CGBuilder() override;
 
 	static ShPtr<CG> getCG(ShPtr<Module> module);
+	static void updateFuncsInCG(ShPtr<CG> cg, const FuncSet &funcs);
 
 private:
 	explicit CGBuilder(ShPtr<Module> module);
@@ -7,8 +7,8 @@
 #ifndef RETDEC_LLVMIR2HLL_HLL_BRACKET_MANAGER_H
 #define RETDEC_LLVMIR2HLL_HLL_BRACKET_MANAGER_H
 
-#include <map>
 #include <stack>
+#include <unordered_map>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
@@ -115,7 +115,9 @@ private:
 	std::stack<PrevOperators> prevOperatorsStack;
 	/// This map contains Expression adresses and status to write, or doesn't write
 	/// brackets.
-	std::map<ShPtr<Expression>, bool> bracketsAreNeededMap;
+	// It is an unordered map because areBracketsNeeded() is called for every
+	// emitted expression, so the lookups have to be fast.
+	std::unordered_map<ShPtr<Expression>, bool> bracketsAreNeededMap;
 	/// The module to be analyzed.
 	ShPtr<Module> module;
 
@@ -193,11 +195,11 @@ protected:
 
 private:
 	void addOperatorOnStackIfSupported(Operators currentOperator,
-		Direction direction);
+		Direction direction, bool operatorSupported);
 	void areBracketsNeededForExpr(ShPtr<Expression> expr,
 		Operators currentOperator);
 	bool areBracketsNeededPrecTable(Operators currentOperator);
-	void removeOperatorFromStackIfSupported(Operators currentOperator);
+	void removeOperatorFromStackIfSupported(bool operatorSupported);
 
 	void treeTraversalForBinaryOpWithStackOperations(
 		ShPtr<BinaryOpExpr> expr, Operators currentOperator);
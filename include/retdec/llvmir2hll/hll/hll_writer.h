@@ -52,6 +52,8 @@ public:
 	void setOptionKeepAllBrackets(bool keep = true);
 	void setOptionEmitTimeVaryingInfo(bool emit = true);
 	void setOptionUseCompoundOperators(bool use = true);
+	void setOptionEmitFunctionsInChunks(bool emit = true);
+	void setOptionEmitFunctionsInParallel(bool emit = true);
 	/// @}
 
 protected:
@@ -141,6 +143,11 @@ protected:
 
 	void emitSectionHeader(const std::string &sectionName);
 
+	void flushOutBuffer();
+	std::string takeEmittedCode();
+
+	virtual void prepareHelperWriter(ShPtr<HLLWriter> helper);
+
 	/**
 	* @brief Emits the given sequence @a seq by calling @c accept on every value.
 	*
@@ -181,7 +188,23 @@ protected:
 	/// The module to be written.
 	ShPtr<Module> module;
 
-	/// Stream, where the resulting code will be generated.
+private:
+	/// Buffer into which the code is emitted before it is written to the
+	/// output. It only grows during the emission; it is emptied in bulk by
+	/// flushOutBuffer().
+	std::string outBuffer;
+
+	/// A stream that appends to @c outBuffer.
+	llvm::raw_string_ostream outBufferStream;
+
+	/// The output itself, into which flushOutBuffer() writes the buffered
+	/// code.
+	llvm::raw_ostream &finalOut;
+
+protected:
+	/// Stream, where the resulting code will be generated. It is backed by
+	/// @c outBuffer, so the code reaches the output only upon
+	/// flushOutBuffer().
 	llvm::raw_ostream &out;
 
 	/// Recognizes which brackets around expressions are needed.
@@ -204,6 +227,12 @@ protected:
 	/// Use compound operators (like @c +=) instead of assignments?
 	bool optionUseCompoundOperators;
 
+	/// Write every emitted function to the output as soon as it is finished?
+	bool optionEmitFunctionsInChunks;
+
+	/// Emit function bodies in parallel?
+	bool optionEmitFunctionsInParallel;
+
 	/// Names of functions that were fixed by the LLVM IR fixing script.
 	StringSet namesOfFuncsWithFixedIR;
 
@@ -225,6 +254,8 @@ private:
 	bool emitMetaInfoNumberOfDecompilationErrors();
 	/// @}
 
+	bool emitFunctionsInParallel(const FuncVector &funcs);
+
 	std::string getRawGotoLabel(ShPtr<Statement> stmt);
 	std::string getReadableClassName(const std::string &cl) const;
 	StringVector getReadableClassNames(const StringVector &classes) const;
@@ -53,6 +53,7 @@ private:
 	virtual bool emitFunctionPrototypes() override;
 	virtual bool emitExternalFunction(ShPtr<Function> func) override;
 	virtual bool emitTargetCode(ShPtr<Module> module) override;
+	virtual void prepareHelperWriter(ShPtr<HLLWriter> helper) override;
 
 	/// @name Visitor Interface
 	/// @{
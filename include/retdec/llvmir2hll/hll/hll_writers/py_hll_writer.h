@@ -50,6 +50,7 @@ private:
 	virtual bool emitExternalFunction(ShPtr<Function> func) override;
 	virtual bool emitFileFooter() override;
 	virtual bool emitTargetCode(ShPtr<Module> module) override;
+	virtual void prepareHelperWriter(ShPtr<HLLWriter> helper) override;
 
 	/// @name Visitor Interface
 	/// @{
@@ -64,6 +64,7 @@ public:
 	/// @{
 	void addGlobalVar(ShPtr<Variable> var, ShPtr<Expression> init = nullptr);
 	void removeGlobalVar(ShPtr<Variable> var);
+	void removeGlobalVars(const VarSet &vars);
 	bool isGlobalVar(ShPtr<Variable> var) const;
 	bool isGlobalVarStoringStringLiteral(const std::string &varName) const;
 	ShPtr<Expression> getInitForGlobalVar(ShPtr<Variable> var) const;
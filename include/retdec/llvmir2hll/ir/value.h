@@ -55,6 +55,17 @@ public:
 	*/
 	virtual ShPtr<Value> clone() = 0;
 
+	/// @name Arena Allocation
+	/// @{
+
+	// All values (i.e. instances of subclasses of this class) are allocated
+	// from a common arena (see ValueArena), which makes their creation a
+	// pointer bump and their destruction a free-list push.
+	static void *operator new(std::size_t size);
+	static void operator delete(void *ptr, std::size_t size) noexcept;
+
+	/// @}
+
 	/**
 	* @brief Returns @c true if this value is equal to @a otherValue, @c false
 	*        otherwise.
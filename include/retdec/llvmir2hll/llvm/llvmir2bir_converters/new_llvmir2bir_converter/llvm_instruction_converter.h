@@ -48,6 +48,7 @@ class ZExtInst;
 namespace retdec {
 namespace llvmir2hll {
 
+class ArithmExprEvaluator;
 class CallExpr;
 class Expression;
 class LLVMFCmpConverter;
@@ -130,6 +131,7 @@ private:
 	ShPtr<Expression> convertGetElementPtrToExpression(llvm::User &inst);
 	ShPtr<Expression> convertGEPIndices(ShPtr<Expression> base,
 		llvm::gep_type_iterator start, llvm::gep_type_iterator end);
+	ShPtr<Expression> foldToConstantIfPossible(ShPtr<Expression> expr);
 
 	ShPtr<LLVMValueConverter> getConverter();
 
@@ -138,6 +140,9 @@ private:
 
 	/// A converter from LLVM fcmp instruction to expression in BIR.
 	UPtr<LLVMFCmpConverter> fcmpConverter;
+
+	/// An evaluator used to fold constant subtrees during conversion.
+	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
 };
 
 } // namespace llvmir2hll
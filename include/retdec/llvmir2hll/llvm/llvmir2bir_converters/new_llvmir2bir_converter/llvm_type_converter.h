@@ -34,6 +34,10 @@ class Type;
 
 /**
 * @brief A converter from LLVM type to type in BIR.
+*
+* All conversion methods are memoized: each distinct LLVM type is converted
+* into a single, shared BIR type no matter how many times and through which
+* overload it is converted.
 */
 class LLVMTypeConverter final: private retdec::utils::NonCopyable {
 public:
@@ -67,6 +67,8 @@ private:
 
 	using MapBBToBBSet = std::unordered_map<llvm::BasicBlock *, BBSet>;
 	using MapBBToCFGNode = std::unordered_map<llvm::BasicBlock *, ShPtr<CFGNode>>;
+	using MapCFGNodeToCFGNode = std::unordered_map<ShPtr<CFGNode>, ShPtr<CFGNode>>;
+	using MapCFGNodeToCFGNodeSet = std::unordered_map<ShPtr<CFGNode>, CFGNode::CFGNodeSet>;
 	using MapCFGNodeToSwitchClause = std::unordered_map<ShPtr<CFGNode>, ShPtr<SwitchClause>>;
 	using MapCFGNodeToDFSNodeState = std::unordered_map<ShPtr<CFGNode>, DFSNodeState>;
 	using MapLoopToCFGNode = std::unordered_map<llvm::Loop *, ShPtr<CFGNode>>;
@@ -101,6 +103,9 @@ private:
 		std::function<bool (ShPtr<CFGNode>)> pred) const;
 	bool existsPathWithoutLoopsBetween(const ShPtr<CFGNode> &node1,
 		const ShPtr<CFGNode> &node2) const;
+	const CFGNode::CFGNodeSet &getReachableNodesFrom(
+		const ShPtr<CFGNode> &node) const;
+	void invalidateQueryResultsFor(const ShPtr<CFGNode> &node) const;
 	/// @}
 
 	/// @name Detection of constructions
@@ -308,6 +313,12 @@ private:
 
 	// A set of nodes, which are already generated to the resulting code.
 	CFGNode::CFGNodeSet generatedNodes;
+
+	// Memoized results of getReachableNodesFrom(), keyed by the starting node.
+	mutable MapCFGNodeToCFGNodeSet reachableNodes;
+
+	// Memoized results of getSwitchSuccessor(), keyed by the switch node.
+	mutable MapCFGNodeToCFGNode switchSuccessors;
 };
 
 } // namespace llvmir2hll
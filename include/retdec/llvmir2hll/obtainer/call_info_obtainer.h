@@ -225,6 +225,9 @@ public:
 	virtual void init(ShPtr<CG> cg, ShPtr<ValueAnalysis> va);
 	virtual bool isInitialized() const;
 
+	void update(ShPtr<Module> module, ShPtr<ValueAnalysis> va);
+	void markFuncCallsAsChanged(ShPtr<Function> func);
+
 	/**
 	* @brief Returns the ID of the obtainer.
 	*/
@@ -308,6 +311,8 @@ protected:
 
 	ShPtr<FuncInfoCompOrder> getFuncInfoCompOrder(ShPtr<CG> cg);
 
+	bool cgMatchesFuncsInModule(ShPtr<Module> module) const;
+
 protected:
 	/// The current module.
 	ShPtr<Module> module;
@@ -324,6 +329,10 @@ protected:
 	/// The used builder of CFGs.
 	ShPtr<CFGBuilder> cfgBuilder;
 
+	/// Functions whose set of function calls has been changed since the last
+	/// call to update() (see markFuncCallsAsChanged()).
+	FuncSet funcsWithChangedCalls;
+
 private:
 	/**
 	* @brief A computation of strongly connected components (SCCs) from a call
@@ -19,6 +19,8 @@ namespace llvmir2hll {
 class ArithmExprEvaluator;
 class CallInfoObtainer;
 class HLLWriter;
+class LivenessAnalysis;
+class LoopInfoAnalysis;
 class Module;
 class ValueAnalysis;
 
@@ -69,6 +71,13 @@ private:
 	/// Used call info obtainer.
 	ShPtr<CallInfoObtainer> cio;
 
+	/// Liveness analysis shared by the dead-assign optimizers.
+	ShPtr<LivenessAnalysis> la;
+
+	/// Loop-info analysis shared by the "while true" loop-conversion
+	/// optimizers.
+	ShPtr<LoopInfoAnalysis> loopInfo;
+
 	/// Used evaluator of arithmetical expressions.
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
 
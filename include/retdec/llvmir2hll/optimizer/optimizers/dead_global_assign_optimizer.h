@@ -17,6 +17,7 @@ namespace llvmir2hll {
 class CFG;
 class CFGBuilder;
 class CallInfoObtainer;
+class LivenessAnalysis;
 class Module;
 class ValueAnalysis;
 
@@ -41,7 +42,7 @@ class ValueAnalysis;
 class DeadGlobalAssignOptimizer final: public FuncOptimizer {
 public:
 	DeadGlobalAssignOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va,
-		ShPtr<CallInfoObtainer> cio);
+		ShPtr<CallInfoObtainer> cio, ShPtr<LivenessAnalysis> la = nullptr);
 	virtual ~DeadGlobalAssignOptimizer() override;
 
 	virtual std::string getId() const override { return "DeadGlobalAssign"; }
@@ -65,6 +66,10 @@ private:
 	/// Obtainer of information about function calls.
 	ShPtr<CallInfoObtainer> cio;
 
+	/// Analysis providing liveness summaries of functions. It may be shared
+	/// with other optimizers.
+	ShPtr<LivenessAnalysis> la;
+
 	/// CFG of the current function.
 	ShPtr<CFG> currCFG;
 
@@ -13,6 +13,7 @@
 namespace retdec {
 namespace llvmir2hll {
 
+class LivenessAnalysis;
 class Module;
 class ValueAnalysis;
 class VarUses;
@@ -41,7 +42,8 @@ class VarUsesVisitor;
 */
 class DeadLocalAssignOptimizer final: public FuncOptimizer {
 public:
-	DeadLocalAssignOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va);
+	DeadLocalAssignOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va,
+		ShPtr<LivenessAnalysis> la = nullptr);
 	virtual ~DeadLocalAssignOptimizer() override;
 
 	virtual std::string getId() const override { return "DeadLocalAssign"; }
@@ -62,6 +64,10 @@ private:
 	/// Analysis of used values.
 	ShPtr<ValueAnalysis> va;
 
+	/// Analysis providing liveness summaries of functions. It may be shared
+	/// with other optimizers.
+	ShPtr<LivenessAnalysis> la;
+
 	/// Visitor for obtaining uses of variables.
 	ShPtr<VarUsesVisitor> vuv;
 };
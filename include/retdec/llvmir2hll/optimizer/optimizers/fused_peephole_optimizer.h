@@ -0,0 +1,82 @@
+/**
+* @file include/retdec/llvmir2hll/optimizer/optimizers/fused_peephole_optimizer.h
+* @brief Runs several local rewrite rules in a single traversal.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_FUSED_PEEPHOLE_OPTIMIZER_H
+#define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_FUSED_PEEPHOLE_OPTIMIZER_H
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "retdec/llvmir2hll/optimizer/func_optimizer.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Module;
+
+/**
+* @brief Runs several local rewrite rules in a single traversal.
+*
+* Peephole-style optimizers only look at one statement (and possibly its
+* direct neighborhood) at a time, yet each of them traverses the whole module
+* on its own. This optimizer fuses them: every statement of a function is
+* collected in one traversal and fed to all registered rules, and whenever a
+* rule changes something, only the neighborhood of the change is reexamined
+* (a change-driven worklist), not the whole module.
+*
+* Rules have to be local: a rule gets one statement, may rewrite or remove
+* it, and returns whether it has changed anything. A rule must not modify
+* statements other than the given one and its direct predecessors/successor,
+* and it has to behave as a no-op on statements it does not match.
+*
+* Rules for existing optimizers are provided as static member functions (see
+* createSelfAssignRule() and createEmptyStmtRule()).
+*
+* Instances of this class have reference object semantics.
+*/
+class FusedPeepholeOptimizer final: public FuncOptimizer {
+public:
+	/// A local rewrite rule. It gets a statement and returns @c true if it
+	/// has modified the IR around it, @c false otherwise.
+	using RewriteRule = std::function<bool (ShPtr<Statement>)>;
+
+	FusedPeepholeOptimizer(ShPtr<Module> module,
+		const std::vector<RewriteRule> &rules);
+
+	virtual ~FusedPeepholeOptimizer() override;
+
+	virtual std::string getId() const override { return "FusedPeephole"; }
+
+	static RewriteRule createSelfAssignRule();
+	static RewriteRule createEmptyStmtRule();
+
+private:
+	virtual void runOnFunction(ShPtr<Function> func) override;
+	virtual void visitStmt(ShPtr<Statement> stmt, bool visitSuccessors = true,
+		bool visitNestedStmts = true) override;
+
+	void enqueue(ShPtr<Statement> stmt);
+	bool applyRules(ShPtr<Statement> stmt);
+
+private:
+	/// The registered rewrite rules.
+	std::vector<RewriteRule> rules;
+
+	/// Statements waiting to be (re)examined.
+	std::deque<ShPtr<Statement>> workList;
+
+	/// Statements currently present in @c workList.
+	StmtUSet inWorkList;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -45,6 +45,9 @@ private:
 	/// Mapping of a function into a set of variables.
 	using FuncVarsMap = std::map<ShPtr<Function>, VarSet>;
 
+	/// Mapping of a variable into a set of functions.
+	using VarFuncsMap = std::map<ShPtr<Variable>, FuncSet>;
+
 private:
 	virtual void doOptimization() override;
 
@@ -62,7 +65,6 @@ private:
 	void computeGlobalVarsUsedInGlobalVarDef();
 	void computeUsedGlobalVars();
 	VarSet computeUsedGlobalVarsForFunc(ShPtr<Function> func) const;
-	bool isUsedInFunc(ShPtr<Variable> var, ShPtr<Function> func);
 	void computeUsefulAndUselessGlobalVars();
 	bool isUsefulInFunc(ShPtr<Variable> var, ShPtr<Function> func) const;
 	bool globalVarMayBeRemovedAsUnused(ShPtr<Variable> var);
@@ -104,6 +106,12 @@ private:
 	/// Mapping of a function into the set of global variables used in the
 	/// function.
 	FuncVarsMap funcUsedGlobalVarsMap;
+
+	/// Mapping of a global variable into the set of function definitions that
+	/// use it (the inverse of @c funcUsedGlobalVarsMap). By using this map,
+	/// "which functions use this global variable?" queries are single lookups
+	/// instead of loops over all the functions in the module.
+	VarFuncsMap globalVarUsersMap;
 };
 
 } // namespace llvmir2hll
@@ -47,6 +47,7 @@ public:
 	static ShPtr<SubOptimizer> create(
 		ShPtr<ArithmExprEvaluator> arithmExprEvaluator);
 	virtual std::string getId() const override;
+	virtual ExprTypeVector getHandledExprTypes() const override;
 
 private:
 	/// @name Visitor Interface
@@ -56,9 +57,6 @@ private:
 	virtual void visit(ShPtr<NeqOpExpr> expr) override;
 	/// @}
 
-	template<typename ExprType>
-	void optimizeNestedComparisons(ExprType expr);
-
 	void replaceWithFirstOperand(ShPtr<BinaryOpExpr> expr);
 	void replaceWithNegationOfFirstOperand(ShPtr<BinaryOpExpr> expr);
 };
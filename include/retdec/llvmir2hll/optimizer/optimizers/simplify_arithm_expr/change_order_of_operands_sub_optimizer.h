@@ -45,6 +45,7 @@ public:
 	static ShPtr<SubOptimizer> create(ShPtr<ArithmExprEvaluator>
 		arithmExprEvaluator);
 	virtual std::string getId() const override;
+	virtual ExprTypeVector getHandledExprTypes() const override;
 
 private:
 	/// @name Visitor Interface
@@ -8,6 +8,8 @@
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_SIMPLIFY_ARITHM_EXPR_SUB_OPTIMIZER_H
 
 #include <string>
+#include <typeindex>
+#include <vector>
 
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr/sub_optimizer_factory.h"
@@ -20,8 +22,17 @@ namespace llvmir2hll {
 
 /**
 * @brief A base class for all simplify arithmetical expression optimizations.
+*
+* A sub-optimizer applies its rules only to the root node of the given
+* expression. The traversal of expressions is driven by
+* SimplifyArithmExprOptimizer, which dispatches every expression to the
+* sub-optimizers that can simplify its root node (see getHandledExprTypes()).
 */
 class SubOptimizer: public OrderedAllVisitor, private retdec::utils::NonCopyable {
+public:
+	/// A vector of types of expressions.
+	using ExprTypeVector = std::vector<std::type_index>;
+
 public:
 	virtual ~SubOptimizer() override;
 
@@ -29,6 +40,13 @@ public:
 	* @brief Returns the ID of the optimizer.
 	*/
 	virtual std::string getId() const = 0;
+
+	/**
+	* @brief Returns the types of expressions whose root node the sub-optimizer
+	*        is able to simplify.
+	*/
+	virtual ExprTypeVector getHandledExprTypes() const = 0;
+
 	virtual bool tryOptimize(ShPtr<Expression> expr);
 
 protected:
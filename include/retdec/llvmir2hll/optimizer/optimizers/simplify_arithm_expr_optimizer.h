@@ -7,6 +7,10 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_SIMPLIFY_ARITHM_EXPR_OPTIMIZER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_SIMPLIFY_ARITHM_EXPR_OPTIMIZER_H
 
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
 #include "retdec/llvmir2hll/optimizer/func_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr/sub_optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -20,7 +24,10 @@ class ArithmExprEvaluator;
 * @brief Optimizer that optimizes expressions to a simpler form.
 *
 * The optimizer utilizes many sub-optimizers. They are in the @c
-* simplify_arithm_expr sub-directory.
+* simplify_arithm_expr sub-directory. The optimizer traverses every expression
+* bottom-up and applies to each visited expression only the sub-optimizers
+* that can simplify its root node (the dispatch goes through a table indexed
+* by the type of the expression).
 *
 * Instances of this class have reference object semantics.
 *
@@ -56,6 +63,7 @@ private:
 		virtual void visit(ShPtr<EqOpExpr> expr) override;
 		virtual void visit(ShPtr<NeqOpExpr> expr) override;
 		virtual void visit(ShPtr<NotOpExpr> expr) override;
+		virtual void visit(ShPtr<AndOpExpr> expr) override;
 		virtual void visit(ShPtr<OrOpExpr> expr) override;
 		virtual void visit(ShPtr<TernaryOpExpr> expr) override;
 		/// @}
@@ -67,10 +75,17 @@ private:
 	/// Vector of sub-optimizations.
 	using SubOptimVec = std::vector<ShPtr<SubOptimizer>>;
 
+	/// Mapping of a type of an expression into the sub-optimizations that can
+	/// simplify its root node.
+	using SubOptimTable = std::unordered_map<std::type_index, SubOptimVec>;
+
 private:
 	/// Vector of sub-optimizations.
 	SubOptimVec subOptims;
 
+	/// Sub-optimizations indexed by the type of the expression they handle.
+	SubOptimTable subOptimsTable;
+
 	/// @c true if the module was optimized in a sub/optimization, @c false
 	/// otherwise.
 	bool codeChanged;
@@ -8,6 +8,7 @@
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_UNUSED_GLOBAL_VAR_OPTIMIZER_H
 
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
+#include "retdec/llvmir2hll/support/global_vars_usage.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 
@@ -30,15 +31,7 @@ public:
 private:
 	virtual void doOptimization() override;
 
-	/// @name Visitor Interface
-	/// @{
-	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<Variable> var) override;
-	/// @}
-
-	void computeUsedGlobalVars();
 	void removeUnusedGlobalVars();
-	bool isGlobal(ShPtr<Variable> var) const;
 	bool isUsed(ShPtr<Variable> var) const;
 
 private:
@@ -47,8 +40,8 @@ private:
 	/// such information.
 	VarSet globalVars;
 
-	/// Global variables that are used.
-	VarSet usedGlobalVars;
+	/// Usage of global variables in @c module.
+	ShPtr<GlobalVarsUsage> globalVarsUsage;
 };
 
 } // namespace llvmir2hll
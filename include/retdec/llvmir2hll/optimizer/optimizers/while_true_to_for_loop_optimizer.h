@@ -16,6 +16,7 @@ namespace llvmir2hll {
 
 class ArithmExprEvaluator;
 class BinaryOpExpr;
+class LoopInfoAnalysis;
 class ValueAnalysis;
 
 /**
@@ -46,7 +47,8 @@ class ValueAnalysis;
 class WhileTrueToForLoopOptimizer final: public FuncOptimizer {
 public:
 	WhileTrueToForLoopOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va,
-		ShPtr<ArithmExprEvaluator> arithmExprEvaluator);
+		ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
+		ShPtr<LoopInfoAnalysis> loopInfo = nullptr);
 
 	virtual ~WhileTrueToForLoopOptimizer() override;
 
@@ -81,6 +83,10 @@ private:
 
 	/// Evaluator of expressions.
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
+
+	/// Analysis providing information about "while true" loops. It may be
+	/// shared with other optimizers.
+	ShPtr<LoopInfoAnalysis> loopInfo;
 };
 
 } // namespace llvmir2hll
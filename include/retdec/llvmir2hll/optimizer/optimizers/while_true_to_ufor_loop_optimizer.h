@@ -14,6 +14,7 @@
 namespace retdec {
 namespace llvmir2hll {
 
+class LoopInfoAnalysis;
 class ValueAnalysis;
 
 /**
@@ -25,7 +26,8 @@ class ValueAnalysis;
 */
 class WhileTrueToUForLoopOptimizer final: public FuncOptimizer {
 public:
-	WhileTrueToUForLoopOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va);
+	WhileTrueToUForLoopOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va,
+		ShPtr<LoopInfoAnalysis> loopInfo = nullptr);
 
 	virtual ~WhileTrueToUForLoopOptimizer() override;
 
@@ -53,6 +55,10 @@ private:
 	/// Analysis of values.
 	ShPtr<ValueAnalysis> va;
 
+	/// Analysis providing information about "while true" loops. It may be
+	/// shared with other optimizers.
+	ShPtr<LoopInfoAnalysis> loopInfo;
+
 	/// While loop that is being optimized.
 	ShPtr<WhileLoopStmt> whileLoop;
 
@@ -13,6 +13,8 @@
 namespace retdec {
 namespace llvmir2hll {
 
+class LoopInfoAnalysis;
+
 /**
 * @brief Optimizes "while true" loops into "while cond" loops.
 *
@@ -64,7 +66,8 @@ namespace llvmir2hll {
 */
 class WhileTrueToWhileCondOptimizer final: public FuncOptimizer {
 public:
-	WhileTrueToWhileCondOptimizer(ShPtr<Module> module);
+	WhileTrueToWhileCondOptimizer(ShPtr<Module> module,
+		ShPtr<LoopInfoAnalysis> loopInfo = nullptr);
 
 	virtual ~WhileTrueToWhileCondOptimizer() override;
 
@@ -76,6 +79,11 @@ private:
 	using OrderedAllVisitor::visit;
 	virtual void visit(ShPtr<WhileLoopStmt> stmt) override;
 	/// @}
+
+private:
+	/// Analysis providing information about "while true" loops. It may be
+	/// shared with other optimizers.
+	ShPtr<LoopInfoAnalysis> loopInfo;
 };
 
 } // namespace llvmir2hll
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "retdec/llvmir2hll/obtainer/calls_in_module_obtainer.h"
 #include "retdec/llvmir2hll/pattern/pattern.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/utils/non_copyable.h"
@@ -33,6 +34,11 @@ class CallInfoObtainer;
 * Note: Do NOT set the ID of your concrete finder to "all" as this ID is
 *       reserved.
 *
+* If the finder looks for patterns rooted at function calls, it should also
+* override the two-parameter variant of findPatterns(), which is given a
+* pre-computed list of all the calls in the module. In this way, a single walk
+* over the module may serve all such finders (see PatternFinderRunner).
+*
 * Instances of this class have reference object semantics.
 */
 class PatternFinder: private retdec::utils::NonCopyable {
@@ -53,6 +59,9 @@ public:
 	*/
 	virtual Patterns findPatterns(ShPtr<Module> module) = 0;
 
+	virtual Patterns findPatterns(ShPtr<Module> module,
+		const CallsInModuleObtainer::Calls &callsInModule);
+
 protected:
 	PatternFinder(ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio);
 
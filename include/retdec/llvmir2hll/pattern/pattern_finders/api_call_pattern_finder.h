@@ -37,6 +37,8 @@ public:
 
 	virtual const std::string getId() const override;
 	virtual Patterns findPatterns(ShPtr<Module> module) override;
+	virtual Patterns findPatterns(ShPtr<Module> module,
+		const CallsInModuleObtainer::Calls &callsInModule) override;
 
 	static ShPtr<PatternFinder> create(ShPtr<ValueAnalysis> va,
 		ShPtr<CallInfoObtainer> cio);
@@ -28,6 +28,13 @@ namespace llvmir2hll {
 *  - create a static create() function and register the semantics at
 *    SemanticsFactory (see the implementation of existing subclasses)
 *
+* Implementations have to be usable from several threads at once because a
+* single semantics may be queried concurrently, e.g. when functions are
+* emitted in parallel. The bundled semantics satisfy this requirement
+* automatically: they are stateless and only query maps that are lazily
+* initialized inside function-local static variables, whose initialization is
+* thread-safe in C++11.
+*
 * Instances of this class have reference object semantics.
 */
 class Semantics: private retdec::utils::NonCopyable {
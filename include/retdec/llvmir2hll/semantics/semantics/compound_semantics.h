@@ -10,6 +10,7 @@
 
 #include <deque>
 #include <string>
+#include <unordered_map>
 
 #include "retdec/llvmir2hll/semantics/semantics.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -76,6 +77,16 @@ protected:
 protected:
 	/// A list of provided semantics.
 	SemanticsList providedSemantics;
+
+	/// Cache of the already obtained answers to getCHeaderFileForFunc().
+	///
+	/// This query is issued for every declared function in a module, both when
+	/// collecting header files to be emitted and when emitting prototypes, so
+	/// without the cache, the underlying semantics maps would be probed over
+	/// and over again for the same function names. The cache is cleared
+	/// whenever the list of provided semantics changes.
+	mutable std::unordered_map<std::string, Maybe<std::string>>
+		cHeaderFileForFuncCache;
 };
 
 } // namespace llvmir2hll
@@ -34,6 +34,32 @@ namespace semantics {
 Maybe<std::string> getCHeaderFileForFuncFromMap(const std::string &funcName,
 		const StringStringUMap &map);
 
+/**
+* @brief One entry of a statically allocated function name to header file
+*        table.
+*
+* Such tables consist of string literals only, so they are initialized at
+* compile time and live in read-only data -- contrary to the maps filled by
+* ADD_FUNCS_TO_C_HEADER_MAP, they cost nothing at process startup.
+*/
+struct FuncCHeaderTableEntry {
+	const char *funcName;
+	const char *header;
+};
+
+Maybe<std::string> getCHeaderFileForFuncFromTable(const std::string &funcName,
+		const FuncCHeaderTableEntry *begin, const FuncCHeaderTableEntry *end);
+
+/**
+* @brief Returns the header name for the given function from the given table,
+*        which has to be sorted by function name.
+*/
+template <std::size_t N>
+Maybe<std::string> getCHeaderFileForFuncFromTable(const std::string &funcName,
+		const FuncCHeaderTableEntry (&table)[N]) {
+	return getCHeaderFileForFuncFromTable(funcName, table, table + N);
+}
+
 } // namespace semantics
 } // namespace llvmir2hll
 } // namespace retdec
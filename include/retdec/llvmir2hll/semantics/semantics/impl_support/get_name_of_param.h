@@ -43,6 +43,33 @@ using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
 Maybe<std::string> getNameOfParamFromMap(const std::string &funcName,
 	unsigned paramPos, const FuncParamNamesMap &map);
 
+/**
+* @brief One entry of a statically allocated function parameter name table.
+*
+* Such tables consist of string literals only, so they are initialized at
+* compile time and live in read-only data -- contrary to the maps filled by
+* ADD_PARAM_NAME, they cost nothing at process startup.
+*/
+struct FuncParamNameTableEntry {
+	const char *funcName;
+	unsigned paramPos;
+	const char *paramName;
+};
+
+Maybe<std::string> getNameOfParamFromTable(const std::string &funcName,
+	unsigned paramPos, const FuncParamNameTableEntry *begin,
+	const FuncParamNameTableEntry *end);
+
+/**
+* @brief Returns the name of the given parameter from the given table, which
+*        has to be sorted by function name and parameter position.
+*/
+template <std::size_t N>
+Maybe<std::string> getNameOfParamFromTable(const std::string &funcName,
+		unsigned paramPos, const FuncParamNameTableEntry (&table)[N]) {
+	return getNameOfParamFromTable(funcName, paramPos, table, table + N);
+}
+
 } // namespace semantics
 } // namespace llvmir2hll
 } // namespace retdec
@@ -7,11 +7,14 @@
 #ifndef RETDEC_LLVMIR2HLL_SUPPORT_GLOBAL_VARS_SORTER_H
 #define RETDEC_LLVMIR2HLL_SUPPORT_GLOBAL_VARS_SORTER_H
 
+#include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 
 namespace retdec {
 namespace llvmir2hll {
 
+class GlobalVarsUsage;
+
 /**
 * @brief Sorts global variables according to the given conditions.
 *
@@ -22,6 +25,9 @@ class GlobalVarsSorter {
 public:
 	static GlobalVarDefVector sortByInterdependencies(
 		const GlobalVarDefVector &globalVars);
+	static GlobalVarDefVector sortByInterdependencies(
+		const GlobalVarDefVector &globalVars,
+		ShPtr<GlobalVarsUsage> usage);
 };
 
 } // namespace llvmir2hll
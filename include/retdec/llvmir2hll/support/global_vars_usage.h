@@ -0,0 +1,81 @@
+/**
+* @file include/retdec/llvmir2hll/support/global_vars_usage.h
+* @brief Usage of global variables computed in one walk over a module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SUPPORT_GLOBAL_VARS_USAGE_H
+#define RETDEC_LLVMIR2HLL_SUPPORT_GLOBAL_VARS_USAGE_H
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Function;
+class Module;
+
+/**
+* @brief Usage of global variables computed in one walk over a module.
+*
+* Every global variable gets an index, and the usage is stored as bitmaps
+* over these indices: one bitmap per function and one per global-variable
+* initializer. All queries are then answered from the bitmaps without any
+* further traversals, so the usage can be computed once and shared by several
+* consumers (e.g. UnusedGlobalVarOptimizer and GlobalVarsSorter). This
+* matters for raw-binary modules, which may contain thousands of
+* register-derived global variables.
+*/
+class GlobalVarsUsage {
+public:
+	static ShPtr<GlobalVarsUsage> compute(ShPtr<Module> module);
+	static ShPtr<GlobalVarsUsage> computeFromInitializers(
+		const GlobalVarDefVector &globalVars);
+
+	/// @name Queries
+	/// @{
+	bool isGlobal(ShPtr<Variable> var) const;
+	bool isUsed(ShPtr<Variable> var) const;
+	bool isUsedInFunc(ShPtr<Variable> var, ShPtr<Function> func) const;
+	bool initializerOfUses(ShPtr<Variable> var, ShPtr<Variable> usedVar) const;
+	bool initializerOfUsesAnyGlobal(ShPtr<Variable> var) const;
+	/// @}
+
+private:
+	/// Bitmap over indices of global variables.
+	using UsageBitmap = std::vector<bool>;
+
+	/// Mapping of a variable into its index.
+	using VarIndexMap = std::map<ShPtr<Variable>, std::size_t>;
+
+private:
+	GlobalVarsUsage();
+
+	void assignIndexes(const GlobalVarDefVector &globalVars);
+	UsageBitmap bitmapFromVars(const VarSet &vars) const;
+	void mergeIntoUsedAnywhere(const UsageBitmap &bitmap);
+
+private:
+	/// Mapping of a global variable into its index.
+	VarIndexMap varIndexMap;
+
+	/// For every global variable (by its index), the bitmap of global
+	/// variables used in its initializer.
+	std::vector<UsageBitmap> initUses;
+
+	/// For every function, the bitmap of global variables used in it.
+	std::map<ShPtr<Function>, UsageBitmap> funcUses;
+
+	/// Bitmap of global variables that are used anywhere in the module.
+	UsageBitmap usedAnywhere;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -74,12 +74,18 @@ using CallSet = std::set<ShPtr<CallExpr>>;
 using FuncSet = std::set<ShPtr<Function>>;
 
 
+/// Unordered set of strings.
+using StringUSet = std::unordered_set<std::string>;
+
 /// Unordered set of statements.
 using StmtUSet = std::unordered_set<ShPtr<Statement>>;
 
 /// Unordered set of types.
 using TypeUSet = std::unordered_set<ShPtr<Type>>;
 
+/// Unordered set of variables.
+using VarUSet = std::unordered_set<ShPtr<Variable>>;
+
 
 /// Vector of strings.
 using StringVector = std::vector<std::string>;
@@ -0,0 +1,96 @@
+/**
+* @file include/retdec/llvmir2hll/support/value_arena.h
+* @brief An arena allocator for BIR values.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SUPPORT_VALUE_ARENA_H
+#define RETDEC_LLVMIR2HLL_SUPPORT_VALUE_ARENA_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "retdec/llvmir2hll/support/singleton.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief An arena allocator for BIR values.
+*
+* Converting a module creates and destroys millions of small, similarly sized
+* Value objects. This arena serves them from large chunks: a fresh allocation
+* is a pointer bump, a deallocation is a push onto a size-bucketed free list,
+* and a subsequent allocation of the same size pops it again. The chunks
+* themselves are released only when the arena is destroyed.
+*
+* Requests larger than @c MAX_BLOCK_SIZE are forwarded to the global
+* <tt>operator new</tt>/<tt>operator delete</tt>.
+*
+* The arena is thread-safe: all its operations are guarded by a mutex, so
+* values may be created and destroyed from several threads at once (which
+* happens, for example, when functions are emitted in parallel, see
+* HLLWriter::setOptionEmitFunctionsInParallel()).
+*
+* Use it through @c GlobalValueArena, i.e. by calling @c
+* GlobalValueArena::getInstance().
+*/
+class ValueArena: private retdec::utils::NonCopyable {
+public:
+	ValueArena();
+	~ValueArena();
+
+	void *allocate(std::size_t size);
+	void deallocate(void *ptr, std::size_t size) noexcept;
+
+	std::size_t getNumOfAllocatedChunks() const;
+
+private:
+	/// A deallocated block, linked into the free list of its size bucket.
+	struct FreeBlock {
+		FreeBlock *next;
+	};
+
+private:
+	std::size_t getBucketIndex(std::size_t size) const noexcept;
+	void allocateNewChunk();
+
+private:
+	/// Alignment of all served blocks. Block sizes are rounded up to a
+	/// multiple of it, which also makes it the free-list bucket granularity.
+	static const std::size_t GRANULE = alignof(std::max_align_t);
+
+	/// The largest block size (after rounding) served from the arena.
+	static const std::size_t MAX_BLOCK_SIZE = 256;
+
+	/// Size of one chunk (a multiple of @c GRANULE).
+	static const std::size_t CHUNK_SIZE = 256 * 1024;
+
+private:
+	/// All allocated chunks -- owned by the arena.
+	std::vector<std::unique_ptr<unsigned char[]>> chunks;
+
+	/// First unused byte in the last chunk.
+	unsigned char *nextFree = nullptr;
+
+	/// Number of unused bytes in the last chunk.
+	std::size_t remainingInChunk = 0;
+
+	/// Free lists of deallocated blocks, one per size bucket.
+	std::array<FreeBlock *, MAX_BLOCK_SIZE / GRANULE> freeLists;
+
+	/// Mutex making the arena usable from several threads at once.
+	mutable std::mutex mutex;
+};
+
+/// The arena all BIR values are allocated from.
+using GlobalValueArena = Singleton<ValueArena>;
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
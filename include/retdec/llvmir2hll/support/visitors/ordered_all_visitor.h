@@ -129,6 +129,7 @@ protected:
 	virtual void visitStmt(ShPtr<Statement> stmt, bool visitSuccessors = true,
 		bool visitNestedStmts = true);
 
+	void visitSuccessorOfStmt(ShPtr<Statement> stmt);
 	void restart(bool visitSuccessors = true, bool visitNestedStmts = true);
 	bool makeAccessedAndCheckIfAccessed(ShPtr<Type> type);
 
@@ -147,6 +148,25 @@ protected:
 
 	/// Should nested statements be accessed?
 	bool visitNestedStmts;
+
+	/// Should chains of successive statements be traversed iteratively
+	/// instead of recursively? Subclasses that override visitStmt() and
+	/// perform work after the successors of the given statement have been
+	/// visited have to set this to @c false; otherwise, their work would run
+	/// before the successors are visited.
+	bool flattenStmtChains;
+
+	/// Are we inside a traversal driven by visitStmt()?
+	bool traversingStmts;
+
+	/// Statement whose visit has been postponed until the currently visited
+	/// statement is left (used by visitStmt() to traverse chains of successive
+	/// statements iteratively instead of recursively).
+	ShPtr<Statement> stmtToVisitNext;
+
+	/// Statement that visitStmt() should visit without traversing its
+	/// successors (they are traversed by the loop that set this attribute).
+	ShPtr<Statement> stmtToSingleStep;
 };
 
 } // namespace llvmir2hll
@@ -37,6 +37,8 @@ public:
 	virtual std::string getId() const = 0;
 
 	bool validate(ShPtr<Module> module, bool printMessageOnError = false);
+	bool validateFuncs(ShPtr<Module> module, const FuncVector &funcs,
+		bool printMessageOnError = false);
 
 protected:
 	Validator();
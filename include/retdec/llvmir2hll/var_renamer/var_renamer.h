@@ -7,8 +7,8 @@
 #ifndef RETDEC_LLVMIR2HLL_VAR_RENAMER_VAR_RENAMER_H
 #define RETDEC_LLVMIR2HLL_VAR_RENAMER_VAR_RENAMER_H
 
-#include <map>
 #include <string>
+#include <unordered_map>
 
 #include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
 #include "retdec/llvmir2hll/var_name_gen/var_name_gen.h"
@@ -94,6 +94,8 @@ protected:
 		ShPtr<Function> func);
 	/// @}
 
+	void unassignLocalVarName(ShPtr<Function> func, const std::string &name);
+
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
@@ -102,10 +104,17 @@ protected:
 
 protected:
 	/// Mapping of a function into a set of strings.
-	using FuncStringSetMap = std::map<ShPtr<Function>, StringSet>;
+	using FuncStringSetMap = std::unordered_map<ShPtr<Function>, StringUSet>;
 
 	/// Mapping of a function's name into the function.
-	using FuncByNameMap = std::map<std::string, ShPtr<Function>>;
+	using FuncByNameMap = std::unordered_map<std::string, ShPtr<Function>>;
+
+	/// Mapping of a name into the next numeric suffix to be tried when the
+	/// name clashes (see generateUniqueName()). There is one index for every
+	/// function; the index for the global scope is stored under the null
+	/// pointer.
+	using NameClashIndexMap = std::unordered_map<ShPtr<Function>,
+		std::unordered_map<std::string, unsigned>>;
 
 protected:
 	/// Used generator of variable names.
@@ -120,7 +129,7 @@ protected:
 	/// Global variables in @c module. This is here to speedup the renaming. By
 	/// using this set, we do not have to ask @c module every time we need such
 	/// information.
-	VarSet globalVars;
+	VarUSet globalVars;
 
 	/// Mapping of function names into functions.
 	/// This is here to speedup the renaming (@c module->getFuncByName() is too
@@ -128,10 +137,10 @@ protected:
 	FuncByNameMap funcsByName;
 
 	/// Variables which have already been renamed.
-	VarSet renamedVars;
+	VarUSet renamedVars;
 
 	/// Assigned names of global variables.
-	StringSet globalVarsNames;
+	StringUSet globalVarsNames;
 
 	/// Assigned names to local variables of all functions in the module,
 	/// including function parameters.
@@ -143,6 +152,11 @@ protected:
 	/// The currently visited function.
 	ShPtr<Function> currFunc;
 
+	/// For every scope, the next numeric suffix to be tried for every name
+	/// that has already clashed. It has to be kept in sync with the assigned
+	/// names (see unassignLocalVarName()).
+	NameClashIndexMap nameClashIndex;
+
 private:
 	void storeFuncsByName();
 	std::string ensureNameUniqueness(ShPtr<Variable> var,
@@ -15,7 +15,8 @@
 namespace retdec {
 namespace loader {
 
-std::unique_ptr<Image> createImage(const std::string& filePath, retdec::config::Config *config = nullptr);
+std::unique_ptr<Image> createImage(const std::string& filePath, retdec::config::Config *config = nullptr,
+	retdec::fileformat::LoadFlags loadFlags = retdec::fileformat::LoadFlags::NONE);
 std::unique_ptr<Image> createImage(const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat);
 
 } // namespace loader
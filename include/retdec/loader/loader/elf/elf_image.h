@@ -53,6 +53,7 @@ protected:
 	bool canLoadSections(const std::vector<retdec::fileformat::Section*>& sections) const;
 	void fixBssSegments();
 	void applyRelocations();
+	bool canApplyRelocation(const retdec::fileformat::Relocation& rel) const;
 	void resolveRelocation(const retdec::fileformat::Relocation& rel, const retdec::fileformat::Symbol& sym);
 
 	SegmentToSectionsTable createSegmentToSectionsTable();
@@ -42,6 +42,8 @@ public:
 	virtual bool getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t& res, retdec::utils::Endianness e = retdec::utils::Endianness::UNKNOWN) const override;
 	virtual bool getXBytes(std::uint64_t address, std::uint64_t x, std::vector<std::uint8_t>& res) const override;
 
+	bool getWords(std::uint64_t address, std::uint64_t count, std::vector<std::uint64_t>& res, retdec::utils::Endianness e = retdec::utils::Endianness::UNKNOWN) const;
+
 	virtual bool setXByte(std::uint64_t address, std::uint64_t x, std::uint64_t val, retdec::utils::Endianness e = retdec::utils::Endianness::UNKNOWN) override;
 	virtual bool setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& res) override;
 
@@ -73,6 +75,8 @@ public:
 
 	std::pair<const std::uint8_t*, std::uint64_t> getRawSegmentData(std::uint64_t address) const;
 
+	void prefetchDataOnAddress(std::uint64_t address, std::uint64_t size) const;
+
 	const std::string& getStatusMessage() const;
 
 protected:
@@ -82,18 +86,35 @@ protected:
 	void sortSegments();
 
 	void setStatusMessage(const std::string& message);
+	void invalidateAddressIndex();
 
 private:
+	/**
+	 * One entry of the address index over the segments. Entries are sorted
+	 * by the start address of their segment.
+	 */
+	struct SegmentIndexEntry
+	{
+		std::uint64_t address; ///< Start address of the segment.
+		std::uint64_t maxEndAddress; ///< Maximum end address over this and all preceding entries.
+		std::size_t order; ///< Position of the segment in the segment list.
+		const Segment* segment;
+	};
+
 	const Segment* _getSegment(std::size_t index) const;
 	const Segment* _getSegment(const std::string& name) const;
 	const Segment* _getSegmentWithIndex(std::size_t index) const;
 	const Segment* _getSegmentFromAddress(std::uint64_t address) const;
 
+	void buildAddressIndex() const;
+
 	std::shared_ptr<retdec::fileformat::FileFormat> _fileFormat;
 	std::vector<std::unique_ptr<Segment>> _segments;
 	std::uint64_t _baseAddress;
 	NameGenerator _namelessSegNameGen;
 	std::string _statusMessage;
+	mutable std::vector<SegmentIndexEntry> _addressIndex; ///< Lazily built index for address to segment resolution.
+	mutable bool _addressIndexIsValid; ///< @c true if the address index reflects the current segments.
 };
 
 } // namespace loader
@@ -36,7 +36,10 @@ public:
 	bool saveData(std::uint64_t saveOffset, std::uint64_t saveSize, const std::vector<std::uint8_t>& data);
 
 private:
+	void copyDataOnWrite();
+
 	llvm::StringRef _data;
+	std::vector<std::uint8_t> _copiedData; ///< Private copy of the viewed data, materialized on the first write.
 };
 
 } // namespace loader
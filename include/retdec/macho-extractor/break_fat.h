@@ -18,6 +18,18 @@ namespace macho_extractor {
 class BreakMachOUniversal
 {
 	private:
+		/// One slice of the universal binary. The slice table is parsed
+		/// once at construction; extraction then only writes the described
+		/// range of the file mapping, without touching the fat header
+		/// structures again.
+		struct Slice
+		{
+				std::uint32_t cpuType = 0;
+				std::uint64_t offset = 0;
+				std::uint64_t size = 0;
+				std::string archName;
+		};
+
 		bool valid = false;
 		bool isStatic = false;
 
@@ -25,15 +37,17 @@ class BreakMachOUniversal
 		std::unique_ptr<llvm::object::MachOUniversalBinary> file;
 		llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer;
 
+		/// Slice table, in file order.
+		std::vector<Slice> slices;
+
 		/// @brief Auxiliary methods
 		/// @{
 		bool isArchive();
 		const char* getFileBufferStart();
-		bool getByArchFamily(
-				std::uint32_t cpuType,
-				llvm::object::MachOUniversalBinary::object_iterator &res);
-		bool extract(
-				llvm::object::MachOUniversalBinary::object_iterator &object,
+		void buildSliceIndex();
+		const Slice* getSliceByCpuType(std::uint32_t cpuType) const;
+		bool extractSlice(
+				const Slice &slice,
 				const std::string &outPath);
 		bool getObjectNamesForArchive(
 				std::uintptr_t archOffset ,
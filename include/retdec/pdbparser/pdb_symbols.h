@@ -97,6 +97,9 @@ class PDBFunction
 // PDB function map (key is address)
 typedef std::map<int, PDBFunction *> PDBFunctionAddressMap;
 
+// PDB function map (key is name, overloaded names keep the last function)
+typedef std::unordered_map<std::string, PDBFunction *> PDBFunctionNameMap;
+
 // =================================================================
 // GLOBAL VARIABLE STRUCTURES
 // =================================================================
@@ -130,7 +133,7 @@ class PDBSymbols
 //		pdb_gsi_data(gsi->data),
 //		pdb_psi_size(psi->size),
 //		pdb_psi_data(psi->data),
-				pdb_sym_size(sym->size), pdb_sym_data(sym->data), modules(m), sections(s), types(tps), parsed(false)
+				pdb_sym_size(sym->size), pdb_sym(sym), pdb_sym_data(nullptr), modules(m), sections(s), types(tps), parsed(false)
 		{
 		}
 		;
@@ -140,16 +143,29 @@ class PDBSymbols
 		void parse_symbols(void);
 
 		// Getting methods
+		// Symbols are parsed lazily on the first query.
 		PDBFunctionAddressMap & get_functions(void)
 		{
+			if (!parsed)
+				parse_symbols();
 			return functions;
 		}
 		;
 		PDBGlobalVarAddressMap & get_global_variables(void)
 		{
+			if (!parsed)
+				parse_symbols();
 			return global_variables;
 		}
 		;
+		PDBFunction * get_function_by_name(const std::string & name)
+		{
+			if (!parsed)
+				parse_symbols();
+			PDBFunctionNameMap::iterator fIt = functions_byname.find(name);
+			return (fIt != functions_byname.end()) ? fIt->second : nullptr;
+		}
+		;
 
 		/**
 		 * Get virtual address from section index and offset of symbol
@@ -192,7 +208,8 @@ class PDBSymbols
 //	unsigned int		pdb_psi_size;	// size of PSI stream
 //	char *				pdb_psi_data;	// data from PSI stream
 		unsigned int pdb_sym_size;  // size of SYM stream
-		char * pdb_sym_data;  // data from SYM stream
+		PDBStream * pdb_sym;  // SYM stream
+		char * pdb_sym_data;  // data from SYM stream (loaded on first use)
 		PDBModulesVec & modules;  // modules
 		PDBSectionsVec & sections;  // sections
 		PDBTypes * types;  // types
@@ -200,6 +217,7 @@ class PDBSymbols
 
 		// Data containers
 		PDBFunctionAddressMap functions;  // Map of functions (key is address)
+		PDBFunctionNameMap functions_byname;  // Map of functions (key is name)
 		PDBGlobalVarAddressMap global_variables;  // Map of global variables (key is address)
 };
 
@@ -8,6 +8,7 @@
 #define RETDEC_PDBPARSER_PDB_TYPES_H
 
 #include <cstdio>
+#include <unordered_map>
 
 #include "retdec/pdbparser/pdb_info.h"
 #include "retdec/pdbparser/pdb_utils.h"
@@ -18,7 +19,10 @@ namespace pdbparser {
 // PDB type definition
 class PDBTypeDef;
 // PDB type definition map (key is type index)
-typedef std::map<int, PDBTypeDef *> PDBTypeDefIndexMap;
+// Hash table - type index is resolved for every symbol during parsing.
+typedef std::unordered_map<int, PDBTypeDef *> PDBTypeDefIndexMap;
+// PDB type definition map with deterministic iteration order (key is type index)
+typedef std::map<int, PDBTypeDef *> PDBTypeDefIndexOrderedMap;
 // PDB type definition map - for fully defined types (key is type name)
 typedef std::map<std::string, PDBTypeDef *> PDBTypeDefNameMap;
 
@@ -585,8 +589,8 @@ class PDBTypes
 	public:
 		// Constructor and destructor
 		PDBTypes(PDBStream *s) :
-				pdb_tpi_size(s->size), pdb_tpi_data(s->data), parsed(false), tpi_header(
-				        reinterpret_cast<HDR *>(s->data))
+				pdb_tpi_stream(s), pdb_tpi_size(s->size), pdb_tpi_data(nullptr), parsed(false), tpi_header(
+				        nullptr)
 		{
 		}
 		;
@@ -596,20 +600,33 @@ class PDBTypes
 		void parse_types(void);
 
 		// Getting methods
+		// Types are parsed lazily on the first query.
 		PDBTypeDef * get_type_by_index(int index)
 		{
 			if (!parsed)
-				return nullptr;
-			else
-				return types[index];
+				parse_types();
+			return types[index];
 		}
 		;
 		PDBTypeDef * get_type_by_name(char *name)
 		{
 			if (!parsed)
-				return nullptr;
-			else
-				return types_byname[name];
+				parse_types();
+			return types_byname[name];
+		}
+		;
+		PDBTypeDefIndexMap & get_types(void)
+		{
+			if (!parsed)
+				parse_types();
+			return types;
+		}
+		;
+		PDBTypeDefIndexOrderedMap & get_types_fully_defined(void)
+		{
+			if (!parsed)
+				parse_types();
+			return types_fully_defined;
 		}
 		;
 
@@ -622,8 +639,9 @@ class PDBTypes
 		PHDR TPILoadTypeInfo(void);
 
 		// Variables
+		PDBStream * pdb_tpi_stream;  // TPI stream
 		unsigned int pdb_tpi_size;  // size of TPI stream
-		char * pdb_tpi_data;  // data from TPI stream
+		char * pdb_tpi_data;  // data from TPI stream (loaded on first use)
 		bool parsed;  // types are parsed
 
 		// Data structure pointers
@@ -631,7 +649,7 @@ class PDBTypes
 
 		// Data containers
 		PDBTypeDefIndexMap types;  // Map of type definitions (key is type index)
-		PDBTypeDefIndexMap types_fully_defined;  // Map of fully defined types (key is type index)
+		PDBTypeDefIndexOrderedMap types_fully_defined;  // Map of fully defined types (key is type index)
 		PDBTypeDefNameMap types_byname;  // Map of fully defined types (key is type name)
 };
 
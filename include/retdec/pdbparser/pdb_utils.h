@@ -93,10 +93,15 @@ typedef struct PDB__IMAGE_SECTION_HEADER
 // PDB Stream
 typedef struct _PDBStream
 {
-		char * data;  // stream data pointer
+		char * data;  // stream data pointer. For fragmented streams it is nullptr until load() reassembles them.
 		int size;  // stream size in bytes
 		bool unused;  // indicates unused stream
-		bool linear;  // stream is linear in PDB file
+		bool linear;  // stream is linear in PDB file (data points directly into the file)
+		const char * file_data;  // PDB file data used for on-demand reassembly of fragmented streams
+		PDB_DWORD * pages;  // page table of fragmented stream
+		int num_pages;  // number of pages used by fragmented stream
+		unsigned int page_size;  // size of one page in bytes
+		char * load(void);  // reassembles fragmented stream into linear memory on first use
 } PDBStream;
 
 // PDB Modules vector
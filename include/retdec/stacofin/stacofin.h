@@ -7,6 +7,7 @@
 #ifndef RETDEC_STACOFIN_STACOFIN_H
 #define RETDEC_STACOFIN_STACOFIN_H
 
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
@@ -21,9 +22,21 @@ namespace loader {
 namespace stacofin {
 
 /**
- * Data-type for offset-name relocation pairs.
+ * Structure representing one reference of a detected function.
  */
-using References = std::vector<std::pair<std::size_t, std::string>>;
+struct Reference
+{
+	std::size_t offset = 0;   ///< Offset of reference in the function body.
+	std::string name;         ///< Name of the referenced object.
+
+	std::uint64_t target = 0; ///< Referenced virtual address.
+	bool ok = false;          ///< @c true if reference was resolved.
+};
+
+/**
+ * Data-type for references of one detected function.
+ */
+using References = std::vector<Reference>;
 using CoveredCode = retdec::utils::AddressRangeContainer;
 
 
@@ -64,6 +77,11 @@ class Finder
 		void search(
 			const retdec::loader::Image &image,
 			const std::string &yaraFile);
+		void search(
+			const retdec::loader::Image &image,
+			const std::vector<std::string> &yaraFiles,
+			double coverageTarget = 1.0);
+		void resolveReferences(const retdec::loader::Image &image);
 		/// @}
 
 		/// @name Getters.
@@ -77,6 +95,12 @@ class Finder
 		CoveredCode coveredCode;                         ///< Code coverage.
 		std::vector<DetectedFunction> detectedFunctions; ///< Functions.
 
+		bool loadCachedDetections(
+			const std::string &cachePath,
+			const std::string &yaraFile);
+		void saveCachedDetections(
+			const std::string &cachePath,
+			std::size_t firstIndex) const;
 		void sort();
 		bool isSorted = true; ///< @c true if detected functions are sorted.
 };
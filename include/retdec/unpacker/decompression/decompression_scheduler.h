@@ -0,0 +1,50 @@
+/**
+ * @file include/retdec/unpacker/decompression/decompression_scheduler.h
+ * @brief Declaration of scheduler running independent decompression jobs in parallel.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UNPACKER_DECOMPRESSION_DECOMPRESSION_SCHEDULER_H
+#define RETDEC_UNPACKER_DECOMPRESSION_DECOMPRESSION_SCHEDULER_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace retdec {
+namespace unpacker {
+
+/**
+ * @brief Scheduler running independent decompression jobs on a thread pool.
+ *
+ * Packed files often contain several compressed blocks that don't depend on each other,
+ * such as one packed block per LOAD segment in UPX'd ELF files. The scheduler collects
+ * jobs decompressing such blocks into their own preallocated destination buffers and runs
+ * them on worker threads. The jobs must not touch any shared mutable state - every job
+ * should work only with its own packed block, its own destination buffer and its own
+ * decompressor instance.
+ *
+ * Exceptions thrown by the jobs are propagated to the caller of @ref run. If more jobs
+ * throw, the exception of the job that was scheduled first is rethrown.
+ */
+class DecompressionScheduler
+{
+public:
+	/// One unit of work, decompressing a single independent block.
+	using Job = std::function<void()>;
+
+	void addJob(Job job);
+	std::size_t getJobCount() const;
+
+	void run(std::size_t workerCount = 0);
+
+	static std::size_t hardwareWorkerCount();
+
+private:
+	std::vector<Job> _jobs; ///< Jobs to run, in the order of scheduling.
+};
+
+} // namespace unpacker
+} // namespace retdec
+
+#endif
@@ -7,6 +7,7 @@
 #ifndef RETDEC_UNPACKER_DYNAMIC_BUFFER_H
 #define RETDEC_UNPACKER_DYNAMIC_BUFFER_H
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -33,7 +34,9 @@ public:
 	DynamicBuffer(retdec::utils::Endianness endianness = retdec::utils::Endianness::LITTLE);
 	DynamicBuffer(uint32_t capacity, retdec::utils::Endianness endianness = retdec::utils::Endianness::LITTLE);
 	DynamicBuffer(const std::vector<uint8_t>& data, retdec::utils::Endianness endianness = retdec::utils::Endianness::LITTLE);
+	DynamicBuffer(std::vector<uint8_t>&& data, retdec::utils::Endianness endianness = retdec::utils::Endianness::LITTLE);
 	DynamicBuffer(const DynamicBuffer& dynamicBuffer);
+	DynamicBuffer(DynamicBuffer&& dynamicBuffer) noexcept;
 	DynamicBuffer(const DynamicBuffer& dynamicBuffer, uint32_t startPos, uint32_t amount);
 
 	~DynamicBuffer();
@@ -182,6 +185,31 @@ private:
 	uint32_t _capacity;
 };
 
+/**
+ * @brief The non-owning read-only view of a sequence of bytes.
+ *
+ * The view can be created over the DynamicBuffer or the plain vector of bytes and lets read-only
+ * paths, such as signature matching, work on top of the original data without copying them.
+ * The viewed data must outlive the view.
+ */
+class BufferView
+{
+public:
+	BufferView(const DynamicBuffer& buffer);
+	BufferView(const std::vector<uint8_t>& data);
+	BufferView(const uint8_t* data, std::size_t size);
+
+	const uint8_t* data() const;
+	std::size_t size() const;
+	bool empty() const;
+
+	uint8_t operator [](std::size_t pos) const;
+
+private:
+	const uint8_t* _data; ///< Pointer to the viewed bytes.
+	std::size_t _size; ///< Number of the viewed bytes.
+};
+
 } // namespace unpacker
 } // namespace retdec
 
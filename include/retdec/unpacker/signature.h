@@ -151,6 +151,7 @@ public:
 
 	uint64_t getSize() const;
 	uint64_t getCaptureSize() const;
+	const Signature::Byte& getByte(uint64_t index) const;
 
 	bool match(const MatchSettings& settings, retdec::loader::Image* file) const;
 	bool match(const MatchSettings& settings, const DynamicBuffer& data) const;
@@ -162,8 +163,8 @@ public:
 private:
 	Signature& operator =(const Signature&);
 
-	bool searchMatchImpl(const std::vector<uint8_t>& bytesToMatch, uint64_t offset, uint64_t maxSearchDist, DynamicBuffer* captureBuffer) const;
-	int64_t matchImpl(const std::vector<uint8_t>& bytesToMatch, uint64_t offset, DynamicBuffer* captureBuffer) const;
+	bool searchMatchImpl(const BufferView& bytesToMatch, uint64_t offset, uint64_t maxSearchDist, DynamicBuffer* captureBuffer) const;
+	int64_t matchImpl(const BufferView& bytesToMatch, uint64_t offset, DynamicBuffer* captureBuffer) const;
 
 	std::vector<Signature::Byte> _buffer; ///< Signature bytes buffer.
 };
@@ -11,6 +11,7 @@
 #include <ostream>
 #include <set>
 #include <sstream>
+#include <vector>
 
 #include "retdec/utils/range.h"
 
@@ -69,17 +70,29 @@ class AddressRange : public Range<Address>
 };
 
 /**
- * TODO: Merge with Marek's RangeContainer, use RangeContainer because it can
- * be used with any data type, not only Address.
- * Make sure the result merges 0x0-0x5 and 0x6-0x10 into 0x0-0x10.
+ * Set of address ranges kept as a flat sorted vector.
+ *
+ * Stored ranges never overlap and are never adjacent: inserting merges with
+ * existing neighbors (e.g. inserting 0x6-0x10 into {0x0-0x5} gives
+ * {0x0-0x10}), removing splits them. Both starts and ends are therefore
+ * strictly increasing, which makes stab queries (contains(), getRange()) a
+ * single binary search and iteration a linear walk over contiguous memory.
+ * Insertion and removal are linear in the worst case, but usually touch only
+ * the neighborhood of the modified range.
+ *
+ * Pointers and iterators into the container are invalidated by any
+ * modification.
  */
 class AddressRangeContainer
 {
 	public:
-		using iterator       = typename std::set<AddressRange>::iterator;
-		using const_iterator = typename std::set<AddressRange>::const_iterator;
+		using iterator       = typename std::vector<AddressRange>::const_iterator;
+		using const_iterator = typename std::vector<AddressRange>::const_iterator;
 
 	public:
+		AddressRangeContainer();
+		AddressRangeContainer(std::vector<AddressRange> rs);
+
 		iterator begin();
 		const_iterator begin() const;
 		iterator end();
@@ -97,16 +110,17 @@ class AddressRangeContainer
 		void remove(const AddressRange &r);
 		void remove(const Address& s, const Address& e);
 
-		bool contains(Address addr);
-		const AddressRange* getRange(Address addr);
-		bool containsExact(AddressRange r);
+		bool contains(Address addr) const;
+		const AddressRange* getRange(Address addr) const;
+		bool containsExact(AddressRange r) const;
 
 		friend std::ostream& operator<<(
 				std::ostream &out,
 				const AddressRangeContainer &r);
 
 	private:
-		std::set<AddressRange> ranges;
+		/// Non-overlapping, non-adjacent ranges sorted by start address.
+		std::vector<AddressRange> ranges;
 };
 
 } // namespace utils
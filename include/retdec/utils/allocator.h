@@ -0,0 +1,257 @@
+/**
+* @file include/retdec/utils/allocator.h
+* @brief Bump arena and object pool allocation utilities.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_ALLOCATOR_H
+#define RETDEC_UTILS_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Bump (arena) allocator
+ *
+ * Memory is carved out of larger chunks by advancing an offset, so an
+ * allocation costs a pointer bump and individual deallocation does not exist.
+ * All memory is released at once when the arena is destroyed, reset, or
+ * rewound to a previously captured state. Intended for batches of small,
+ * equally long-lived objects (symbol tables, parse trees, IR nodes) where
+ * per-object @c new/@c delete dominates the loading time.
+ *
+ * The arena is not thread-safe, one instance must not be used from multiple
+ * threads at once.
+ */
+class BumpArena : private NonCopyable
+{
+	public:
+		/// Default size of one chunk in bytes.
+		static const std::size_t DEFAULT_CHUNK_SIZE = 0x10000;
+
+		/**
+		 * State of the arena which can be rewound to via rewind()
+		 */
+		struct State
+		{
+			std::size_t numberOfChunks; ///< number of chunks at capture time
+			std::size_t usedInLastChunk; ///< used bytes in the last chunk
+		};
+
+		/**
+		 * RAII helper which captures the arena state on construction and
+		 * rewinds the arena back to it on destruction
+		 *
+		 * Everything allocated inside the scope must be dead (trivially
+		 * destructible or destroyed) before the scope ends.
+		 */
+		class Scope : private NonCopyable
+		{
+			public:
+				Scope(BumpArena &bumpArena) : arena(bumpArena), state(bumpArena.getState())
+				{
+
+				}
+				~Scope()
+				{
+					arena.rewind(state);
+				}
+			private:
+				BumpArena &arena; ///< arena to rewind
+				State state;      ///< captured state
+		};
+
+		BumpArena(std::size_t sizeOfChunk = DEFAULT_CHUNK_SIZE);
+		~BumpArena();
+
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+		State getState() const;
+		void rewind(const State &state);
+		void reset();
+		std::size_t getAllocatedBytes() const;
+	private:
+		/**
+		 * One chunk of backing memory
+		 */
+		struct Chunk
+		{
+			std::unique_ptr<std::uint8_t[]> data; ///< backing memory
+			std::size_t size;                     ///< size of backing memory
+			std::size_t used;                     ///< number of used bytes
+		};
+
+		std::vector<Chunk> chunks; ///< chunks in order of creation
+		std::size_t chunkSize;     ///< size of newly created chunks
+};
+
+/**
+ * Fixed-size object pool
+ *
+ * Objects are constructed in slots of larger blocks and destroyed slots are
+ * recycled through a free list, so creation and destruction of many objects
+ * of one type avoids the general-purpose heap. Destroying the pool releases
+ * the blocks without running destructors, so every object created by the
+ * pool must be returned via destroy() before the pool dies unless its
+ * destructor is trivial.
+ *
+ * The pool is not thread-safe.
+ */
+template <typename T, std::size_t BlockCapacity = 256>
+class ObjectPool : private NonCopyable
+{
+	public:
+		ObjectPool() : nextSlotInBlock(BlockCapacity)
+		{
+
+		}
+
+		/**
+		 * Construct new object in the pool
+		 * @param args Arguments forwarded to the constructor of @c T
+		 * @return Pointer to the constructed object
+		 */
+		template <typename... Args>
+		T* create(Args&&... args)
+		{
+			void *slot = allocateSlot();
+			try
+			{
+				return new (slot) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				freeSlots.push_back(slot);
+				throw;
+			}
+		}
+
+		/**
+		 * Destroy object created by create() and recycle its slot
+		 * @param object Object to destroy
+		 */
+		void destroy(T *object)
+		{
+			object->~T();
+			freeSlots.push_back(object);
+		}
+	private:
+		using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+		void* allocateSlot()
+		{
+			if(!freeSlots.empty())
+			{
+				void *slot = freeSlots.back();
+				freeSlots.pop_back();
+				return slot;
+			}
+			if(nextSlotInBlock == BlockCapacity)
+			{
+				blocks.emplace_back(new Slot[BlockCapacity]);
+				nextSlotInBlock = 0;
+			}
+			return &blocks.back()[nextSlotInBlock++];
+		}
+
+		std::vector<std::unique_ptr<Slot[]>> blocks; ///< blocks of slots
+		std::size_t nextSlotInBlock;                 ///< first never used slot in the last block
+		std::vector<void*> freeSlots;                ///< recycled slots
+};
+
+/**
+ * Standard-compatible allocator carving memory out of a shared BumpArena
+ *
+ * The allocator holds shared ownership of the arena, so memory obtained
+ * through it (including control blocks of @c std::allocate_shared) stays
+ * valid as long as any allocator copy or allocated object exists.
+ * deallocate() is a no-op - everything is released with the arena.
+ */
+template <typename T>
+class ArenaAllocator
+{
+	public:
+		using value_type = T;
+
+		ArenaAllocator(std::shared_ptr<BumpArena> arenaPtr) : arena(std::move(arenaPtr))
+		{
+
+		}
+
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.getArena())
+		{
+
+		}
+
+		T* allocate(std::size_t n)
+		{
+			return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T*, std::size_t)
+		{
+
+		}
+
+		const std::shared_ptr<BumpArena>& getArena() const
+		{
+			return arena;
+		}
+	private:
+		std::shared_ptr<BumpArena> arena; ///< shared backing arena
+};
+
+template <typename T, typename U>
+bool operator ==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b)
+{
+	return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+bool operator !=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b)
+{
+	return !(a == b);
+}
+
+/**
+ * Deleter for objects placement-constructed in a shared BumpArena
+ *
+ * Runs the destructor and keeps the arena alive while any object allocated
+ * in it is still owned; the memory itself is released with the arena. Useful
+ * together with @c std::shared_ptr for classes whose constructors are private
+ * and therefore cannot go through @c std::allocate_shared:
+ * @code
+ * void *mem = arena->allocate(sizeof(T), alignof(T));
+ * std::shared_ptr<T>(new (mem) T(args), ArenaDeleter<T>(arena), ArenaAllocator<T>(arena));
+ * @endcode
+ */
+template <typename T>
+class ArenaDeleter
+{
+	public:
+		ArenaDeleter(std::shared_ptr<BumpArena> arenaPtr) : arena(std::move(arenaPtr))
+		{
+
+		}
+
+		void operator ()(T *object) const
+		{
+			object->~T();
+		}
+	private:
+		std::shared_ptr<BumpArena> arena; ///< shared backing arena
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -90,6 +90,7 @@ public:
 
 protected:
 	bool createValueFromBytes(const std::vector<std::uint8_t>& data, std::uint64_t& value, Endianness endian, std::uint64_t offset = 0, std::uint64_t size = 0) const;
+	bool createValueFromBytes(const std::uint8_t* data, std::size_t dataSize, std::uint64_t& value, Endianness endian, std::uint64_t offset = 0, std::uint64_t size = 0) const;
 	bool createBytesFromValue(std::uint64_t data, std::uint64_t x, std::vector<std::uint8_t>& value, Endianness endian) const;
 
 	bool get10ByteImpl(const std::vector<std::uint8_t>& data, long double& res) const;
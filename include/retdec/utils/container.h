@@ -239,6 +239,14 @@ void addToSet(const std::set<T> &from, std::set<T> &to) {
 	to.insert(from.begin(), from.end());
 }
 
+/**
+* @brief Adds all the items from @a from to the unordered set @a to.
+*/
+template<typename T>
+void addToSet(const std::set<T> &from, std::unordered_set<T> &to) {
+	to.insert(from.begin(), from.end());
+}
+
 /**
 * @brief Returns the set union <tt>s1 \\cup s2</tt>.
 *
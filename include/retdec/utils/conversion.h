@@ -7,6 +7,7 @@
 #ifndef RETDEC_UTILS_CONVERSION_H
 #define RETDEC_UTILS_CONVERSION_H
 
+#include <cstdint>
 #include <iomanip>
 #include <ios>
 #include <limits>
@@ -179,6 +180,9 @@ template<typename N> void byteToHexString(std::ostream& oStr, N byte, bool upper
 	oStr << std::hex << std::setfill('0') << std::setw(2) << (uppercase ? std::uppercase : std::nouppercase) << (byte & 0xFF);
 }
 
+void bytesToHex(const std::uint8_t *data, std::size_t numBytes, char *result, bool uppercase = true);
+void bytesToHexString(const std::uint8_t *data, std::size_t dataSize, std::string &result, std::size_t offset = 0, std::size_t size = 0, bool uppercase = true);
+
 /**
  * Converts the given array of numbers into a hexadecimal string representation
  * @param data Array to be converted into a hexadecimal string
@@ -188,6 +192,10 @@ template<typename N> void byteToHexString(std::ostream& oStr, N byte, bool upper
  * @param size Number of bytes from @a data for conversion
  *    (0 means all bytes from @a offset)
  * @param uppercase @c true if hex letters (A-F) should be uppercase
+ *
+ * For plain byte arrays the non-template overload taking
+ * <tt>const std::uint8_t*</tt> is picked instead, which uses a vectorized
+ * conversion kernel.
  */
 template<typename N> void bytesToHexString(const N *data, std::size_t dataSize, std::string &result, std::size_t offset = 0, std::size_t size = 0, bool uppercase = true)
 {
@@ -205,16 +213,15 @@ template<typename N> void bytesToHexString(const N *data, std::size_t dataSize,
 		size = (size == 0 || offset + size > dataSize) ? dataSize - offset : size;
 	}
 
-	result.clear();
-	result.reserve(size * 2);
-	std::ostringstream oStr;
+	result.resize(size * 2);
+	const char *digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
 
 	for(std::size_t i = 0; i < size; ++i)
 	{
-		byteToHexString(oStr, data[offset + i], uppercase);
+		const auto byte = static_cast<unsigned char>(data[offset + i] & 0xFF);
+		result[2 * i] = digits[byte >> 4];
+		result[2 * i + 1] = digits[byte & 0x0F];
 	}
-
-	result = oStr.str();
 }
 
 /**
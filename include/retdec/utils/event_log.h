@@ -0,0 +1,97 @@
+/**
+* @file include/retdec/utils/event_log.h
+* @brief Low-overhead event logging into per-thread binary ring buffers.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_EVENT_LOG_H
+#define RETDEC_UTILS_EVENT_LOG_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Low-overhead event logging into per-thread binary ring buffers.
+ *
+ * Formatting diagnostics through streams is too slow to leave enabled in
+ * production, so verbose runs and production runs behave differently and slow
+ * production jobs cannot be correlated with what the pipeline was doing. The
+ * event log splits the cost: a call site registers itself once as a Site,
+ * record() appends a small binary record (site id, timestamp, two integer
+ * arguments) to a ring buffer of the calling thread without taking any lock,
+ * and all the formatting happens offline, when the trace is exported.
+ *
+ * The log is controlled by the @c RETDEC_TRACE environment variable the same
+ * way the instrumentation is controlled by @c RETDEC_PROFILE. When it is
+ * unset, record() is a no-op costing one branch on a cached flag, so call
+ * sites can stay in release builds. When it is set, the collected trace is
+ * formatted when the process exits:
+ *  - <tt>RETDEC_TRACE=trace.log</tt> (any value with a dot) writes the trace
+ *    to the file,
+ *  - any other value (e.g. @c 1) writes the trace to standard error.
+ * A @c %p in the path expands to the PID of the exporting process.
+ *
+ * Every thread writes only to its own buffer, so recording never blocks.
+ * When a thread records more events than its buffer holds, the oldest ones
+ * are overwritten -- the trace keeps the most recent events of every thread.
+ *
+ * String arguments have to be interned with internText() first; the returned
+ * id is stable for the lifetime of the process and is resolved back to the
+ * text during formatting. Interning takes a lock, so it is meant for values
+ * drawn from a small set (phase names, pass names), not for unbounded data.
+ */
+namespace event_log {
+
+/// Is the event log collecting records (i.e. is @c RETDEC_TRACE set)?
+bool isEnabled();
+
+/// Enables the event log programmatically, even when @c RETDEC_TRACE is
+/// unset. The caller is then expected to export the trace itself via
+/// formatTrace().
+void enable();
+
+/**
+ * One registered logging call site.
+ *
+ * Construct it as a function-local static, so the registration runs once:
+ * @code
+ * static event_log::Site site("decoder/jump-target");
+ * event_log::record(site, address);
+ * @endcode
+ */
+class Site: private NonCopyable
+{
+public:
+	Site(const char *name, bool arg0IsText = false);
+
+	std::uint32_t getId() const { return id; }
+
+private:
+	/// Identifier of the site within the process.
+	std::uint32_t id;
+};
+
+/// Interns the given text and returns its id, usable as a record argument of
+/// a site constructed with @c arg0IsText.
+std::uint64_t internText(const std::string &text);
+
+/// Appends one record of the given site to the ring buffer of the calling
+/// thread. A no-op unless the event log is enabled.
+void record(const Site &site, std::uint64_t arg0 = 0, std::uint64_t arg1 = 0);
+
+/// Formats all the collected records, merged over the threads and ordered by
+/// time, into the given stream.
+void formatTrace(std::ostream &out);
+
+} // namespace event_log
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -0,0 +1,96 @@
+/**
+* @file include/retdec/utils/instrumentation.h
+* @brief Phase timing and counter instrumentation.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_INSTRUMENTATION_H
+#define RETDEC_UTILS_INSTRUMENTATION_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Lightweight, machine-readable performance instrumentation.
+ *
+ * The instrumentation is controlled by the @c RETDEC_PROFILE environment
+ * variable. When it is unset, every function here is a no-op costing one
+ * branch on a cached flag, so call sites can stay in release builds. When it
+ * is set, phase times and counters are aggregated in memory and exported when
+ * the process exits:
+ *  - <tt>RETDEC_PROFILE=report.json</tt> writes a JSON report to the file,
+ *  - <tt>RETDEC_PROFILE=report.csv</tt> writes a CSV report to the file,
+ *  - any other value (e.g. @c 1) writes the JSON report to standard error.
+ *
+ * A @c %p in the path expands to the PID of the exporting process, so every
+ * tool of a multi-process pipeline can write its own report.
+ *
+ * Phases can be recorded in two ways. ScopedPhase measures a code block with
+ * RAII and supports nesting -- the reported name of an inner phase is
+ * prefixed with the names of the enclosing ones (<tt>outer/inner</tt>).
+ * recordPhaseTransition() serves the older sequential style used by the
+ * phase printing in llvm-support diagnostics, where a phase ends when the
+ * next one of the same or shallower depth starts.
+ *
+ * Besides time, every phase boundary samples the resident-set size of the
+ * process, so the report also shows how much memory each phase gained or
+ * released and the highest RSS observed while it ran -- together with the
+ * process-wide peak, this tells where a memory-capped run went over budget.
+ * A tool can also request just the memory side of the report on its own
+ * (see enable() and printMemoryReport()) without @c RETDEC_PROFILE.
+ *
+ * All functions are thread-safe; nesting of scoped phases is tracked per
+ * thread.
+ */
+namespace instrumentation {
+
+/// Is the instrumentation enabled (i.e. is @c RETDEC_PROFILE set)?
+bool isEnabled();
+
+/// Enables the instrumentation programmatically, even when @c RETDEC_PROFILE
+/// is unset (used by the <tt>--memory-report</tt> options of the tools).
+void enable();
+
+/// Adds @a delta to the counter with the given name.
+void incrementCounter(const std::string &name, std::uint64_t delta = 1);
+
+/// Starts a new sequential phase at the given nesting depth, ending all
+/// phases at the same or greater depth.
+void recordPhaseTransition(const std::string &name, unsigned depth);
+
+/// Writes a human-readable summary of the collected memory measurements
+/// (process peak RSS, per-phase RSS deltas and watermarks, memory counters).
+void printMemoryReport(std::ostream &out);
+
+/**
+ * RAII timer measuring one (possibly nested) phase.
+ */
+class ScopedPhase: private NonCopyable
+{
+public:
+	ScopedPhase(const std::string &name);
+	~ScopedPhase();
+
+private:
+	/// Is the instrumentation enabled for this phase?
+	bool active;
+
+	/// Start of the phase in nanoseconds.
+	std::uint64_t start;
+
+	/// Resident-set size of the process when the phase started.
+	std::size_t startRss;
+};
+
+} // namespace instrumentation
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -0,0 +1,74 @@
+/**
+* @file include/retdec/utils/job_server.h
+* @brief Unix-socket job server for the daemon modes of the tools.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_JOB_SERVER_H
+#define RETDEC_UTILS_JOB_SERVER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Unix-socket job server for the daemon modes of the tools.
+*
+* A tool paying a large fixed startup cost (LLVM initialization, loading of
+* linked libraries, static data) can run as a daemon: it performs the
+* startup once, then listens on a local socket and forks one short-lived
+* worker per job. The worker inherits all the warm state of the daemon via
+* copy-on-write, so a job only pays for the decompilation itself. Forking
+* also isolates the jobs from each other -- no per-job state (providers,
+* LLVM options, globals) can leak between jobs.
+*
+* Protocol (line-based, one job per connection):
+*  - the client connects to the unix socket and sends a single line with
+*    the command-line arguments of the job separated by tabs,
+*  - the server sends back everything the job writes to its standard and
+*    error outputs, followed by a line <tt>\@retdec-exit STATUS</tt>, and
+*    closes the connection,
+*  - a job line consisting of the single word <tt>\@shutdown</tt> stops
+*    the server.
+*
+* For example, with a running <tt>bin2llvmir -daemon /tmp/b2l.sock</tt>:
+* @code
+* printf 'input.bc\t-o\toutput.bc\t-provider-init\n' \
+*     | socat - UNIX:/tmp/b2l.sock
+* @endcode
+*
+* Only available on POSIX systems; on Windows, listenOn() always fails.
+*/
+class JobServer: private NonCopyable
+{
+public:
+	/// Handler running one job, getting its command-line arguments and
+	/// returning its exit status. It runs in a forked worker whose standard
+	/// and error outputs are connected to the client.
+	using JobHandler = std::function<int (const std::vector<std::string>&)>;
+
+	JobServer(const std::string &socketPath);
+	~JobServer();
+
+	bool listenOn();
+	int run(const JobHandler &handler);
+
+	static std::string extractDaemonOption(int &argc, char **argv);
+
+private:
+	/// Path of the unix socket the server listens on.
+	std::string socketPath;
+
+	/// File descriptor of the listening socket (-1 when not listening).
+	int serverFd = -1;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -7,6 +7,9 @@
 #ifndef RETDEC_UTILS_MATH_H
 #define RETDEC_UTILS_MATH_H
 
+#include <cstdint>
+#include <cstddef>
+
 namespace retdec {
 namespace utils {
 
@@ -37,6 +40,12 @@ bool isPowerOfTwoOrZero(N number) {
 unsigned countBits(unsigned long long n);
 unsigned bitSizeOfNumber(unsigned long long v);
 
+void byteHistogram(
+		const unsigned char* data,
+		std::size_t size,
+		std::uint64_t (&counts)[256]);
+double byteEntropy(const unsigned char* data, std::size_t size);
+
 } // namespace utils
 } // namespace retdec
 
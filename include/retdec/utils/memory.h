@@ -13,6 +13,8 @@ namespace retdec {
 namespace utils {
 
 std::size_t getTotalSystemMemory();
+std::size_t getCurrentMemoryUsage();
+std::size_t getPeakMemoryUsage();
 bool limitSystemMemory(std::size_t limit);
 bool limitSystemMemoryToHalfOfTotalSystemMemory();
 
@@ -0,0 +1,76 @@
+/**
+ * @file include/retdec/utils/memory_mapped_file.h
+ * @brief Read-only memory mapping of a file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UTILS_MEMORY_MAPPED_FILE_H
+#define RETDEC_UTILS_MEMORY_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+#include "retdec/utils/non_copyable.h"
+#include "retdec/utils/os.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * @brief Read-only memory mapping of a file.
+ *
+ * The content of a mapped file is accessible as one contiguous range of
+ * bytes, backed directly by the page cache, so mapping a file is cheap no
+ * matter how large the file is -- pages are read from the disk lazily on
+ * first access and may be evicted when memory runs low.
+ *
+ * The mapping is released in the destructor (RAII).
+ */
+class MemoryMappedFile: private NonCopyable
+{
+public:
+	/// Expected access pattern for advise().
+	enum class AccessPattern
+	{
+		Normal,     ///< no particular pattern
+		Sequential, ///< content is read once, front to back
+		Random      ///< accesses jump around, read-ahead would be wasted
+	};
+
+	MemoryMappedFile();
+	~MemoryMappedFile();
+
+	bool map(const std::string& filePath);
+	void unmap();
+	bool advise(AccessPattern pattern) const;
+
+	bool isMapped() const;
+	const unsigned char* getData() const;
+	std::size_t getSize() const;
+
+	static bool prefetch(const void* data, std::size_t size);
+
+private:
+	/// Start of the mapped content (@c nullptr if nothing is mapped).
+	const unsigned char* data;
+
+	/// Size of the mapped content in bytes.
+	std::size_t size;
+
+	/// Is a file currently mapped?
+	/// Separate from @c data because an empty file maps to no content.
+	bool mapped;
+
+#ifdef OS_WINDOWS
+	/// Handle of the mapped file.
+	void* fileHandle;
+
+	/// Handle of the file-mapping object.
+	void* mappingHandle;
+#endif
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * @file include/retdec/utils/string_pool.h
+ * @brief Interning pool for immutable strings.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UTILS_STRING_POOL_H
+#define RETDEC_UTILS_STRING_POOL_H
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace retdec {
+namespace utils {
+
+/**
+ * @brief Hash-consing pool of immutable strings.
+ *
+ * intern() stores each distinct string exactly once and always hands out
+ * a reference to that single copy, so heavily repeated strings (symbol
+ * names, import names, function names, ...) are kept in memory once no
+ * matter how many objects refer to them. As a bonus, two interned strings
+ * from the same pool are equal exactly when their addresses are equal.
+ *
+ * Strings are never removed, so returned references stay valid for the
+ * whole lifetime of the pool. The pool may be shared between threads.
+ */
+class StringPool
+{
+	public:
+		const std::string& intern(const std::string& s);
+		const std::string& intern(std::string&& s);
+
+		std::size_t size() const;
+
+	private:
+		/// Interned strings. @c std::unordered_set never moves its elements,
+		/// so references into it stay valid across insertions.
+		std::unordered_set<std::string> _strings;
+
+		/// Protects @c _strings.
+		mutable std::mutex _mutex;
+};
+
+/// @name Process-wide interning pool
+///
+/// One pool shared by the whole process. It is intentionally never
+/// destroyed, so interned names may be used even during static destruction.
+/// @{
+const std::string& internString(const std::string& s);
+const std::string& internString(std::string&& s);
+/// @}
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -0,0 +1,40 @@
+/**
+* @file include/retdec/utils/thread_pool.h
+* @brief Worker threads with a process-wide concurrency budget.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_THREAD_POOL_H
+#define RETDEC_UTILS_THREAD_POOL_H
+
+#include <cstdlib>
+#include <functional>
+
+namespace retdec {
+namespace utils {
+
+/// @name Concurrency budget
+///
+/// Several subsystems (decoding, signature scanning, resource hashing, HLL
+/// emission, ...) parallelize their hot loops. If each of them sized its
+/// threads by std::thread::hardware_concurrency() alone, regions running
+/// inside other regions would oversubscribe the machine. The functions below
+/// share one process-wide budget: a region only spawns extra workers for the
+/// part of the budget that is currently free, and a region nested inside
+/// saturated regions simply runs on its calling thread.
+/// @{
+std::size_t maxParallelism();
+void setMaxParallelism(std::size_t threads);
+/// @}
+
+/// @name Parallel execution
+/// @{
+void runWorkers(std::size_t maxWorkers, const std::function<void()> &worker);
+void parallelFor(std::size_t count,
+		const std::function<void(std::size_t)> &action);
+/// @}
+
+} // namespace utils
+} // namespace retdec
+
+#endif
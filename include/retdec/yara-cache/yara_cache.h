@@ -0,0 +1,20 @@
+/**
+ * @file include/retdec/yara-cache/yara_cache.h
+ * @brief Persistent cache of compiled YARA rule files.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_YARA_CACHE_YARA_CACHE_H
+#define RETDEC_YARA_CACHE_YARA_CACHE_H
+
+#include <string>
+
+namespace retdec {
+namespace yara_cache {
+
+std::string getCompiledRuleFile(const std::string &ruleFile);
+
+} // namespace yara_cache
+} // namespace retdec
+
+#endif
@@ -0,0 +1,245 @@
+#!/usr/bin/env bash
+#
+# Runs the decompilation script over the given binary with the work sharded
+# across several worker processes. The front end is run once to detect the
+# functions, the function set is then partitioned into shards, and each shard
+# is decompiled by its own decompilation-script process restricted (via
+# --select-functions-file) to its functions only. The per-shard outputs are
+# concatenated in shard order, so the result is deterministic for a given
+# input and shard count.
+#
+
+# On macOS, we want the GNU version of 'readlink', which is available under
+# 'greadlink':
+gnureadlink()
+{
+	if hash greadlink 2> /dev/null; then
+		greadlink "$@"
+	else
+		readlink "$@"
+	fi
+}
+
+SCRIPT_DIR="$(dirname "$(gnureadlink -e "$0")")"
+
+if [ -z "$DECOMPILER_UTILS" ]; then
+	DECOMPILER_UTILS="$SCRIPT_DIR/retdec-utils.sh"
+fi
+
+. "$DECOMPILER_UTILS"
+
+##
+## Prints help to stream $1.
+##
+print_help() {
+	echo "Runs the decompilation script over the given binary with the work" > "$1"
+	echo "sharded across several worker processes. You can pass additional" > "$1"
+	echo "arguments for the decompilations after double-dash '--' argument." > "$1"
+	echo "" > "$1"
+	echo "Usage:" > "$1"
+	echo "    $0 FILE [-j N] [-o FILE] [--budget N] [-- ARGS]" > "$1"
+	echo "" > "$1"
+	echo "Options:" > "$1"
+	echo "    -j|--jobs N       Number of shards/worker processes (default: number of CPUs)." > "$1"
+	echo "    -o|--output FILE  Output file (default: FILE.c)." > "$1"
+	echo "    --budget N        Time budget in seconds. Functions are decompiled in priority" > "$1"
+	echo "                      order (entry point and main, then exports, then the rest) and" > "$1"
+	echo "                      the output contains whatever finished within the budget." > "$1"
+	echo "" > "$1"
+}
+
+##
+## Cleans up all temporary files.
+## No arguments accepted.
+##
+cleanup() {
+	for ((INDEX=0; INDEX<JOBS; INDEX++)); do
+		rm -f "$OUT.shard$INDEX.list"
+		rm -f "$OUT.shard$INDEX.$HLL_SUFFIX"
+		rm -f "$OUT.shard$INDEX.$HLL_SUFFIX.log.verbose"
+	done
+}
+
+##
+## Parse script arguments.
+##
+while [[ $# -gt 0 ]]
+do
+	case $1 in
+		-h|--help)
+			print_help /dev/stdout
+			exit 0;;
+		-j|--jobs)
+			[ "$JOBS" ] && print_error_and_die "Duplicate option: -j|--jobs"
+			JOBS="$2"
+			if ! [[ "$JOBS" =~ ^[0-9]+$ ]] || [ "$JOBS" -lt 1 ]; then
+				print_error_and_die "Value in option -j|--jobs must be a positive number."
+			fi
+			shift 2;;
+		-o|--output)
+			[ "$OUT" ] && print_error_and_die "Duplicate option: -o|--output"
+			OUT="$2"
+			shift 2;;
+		--budget)
+			[ "$BUDGET" ] && print_error_and_die "Duplicate option: --budget"
+			BUDGET="$2"
+			if ! [[ "$BUDGET" =~ ^[0-9]+$ ]] || [ "$BUDGET" -lt 1 ]; then
+				print_error_and_die "Value in option --budget must be a positive number of seconds."
+			fi
+			shift 2;;
+		--)
+			# Skip -- and store arguments for decompilations.
+			shift
+			DECOMPILER_SH_ARGS=$*
+			break;;
+		*)
+			! [ -f "$1" ] && print_error_and_die "Input '$1' is not a valid file."
+			IN="$1"
+			shift;;
+	esac
+done
+
+# Check arguments.
+[ ! "$IN" ] && print_error_and_die "No input file."
+if [ -z "$JOBS" ]; then
+	if hash nproc 2> /dev/null; then
+		JOBS=$(nproc)
+	else
+		JOBS=$(sysctl -n hw.ncpu 2> /dev/null || echo 1)
+	fi
+fi
+OUT=${OUT:="$IN.c"}
+HLL_SUFFIX="${OUT##*.}"
+
+##
+## Run the front end once to detect the functions. The produced config file
+## is then shared by all the shards -- they get the function boundaries from
+## it, so they can decode just their own functions.
+##
+echo "##### Running the front end to detect functions in $IN..."
+SECONDS=0
+if [ "$BUDGET" ]; then
+	gnutimeout "$BUDGET" "$DECOMPILER_SH" -o "$OUT" --stop-after bin2llvmir "$IN" $DECOMPILER_SH_ARGS
+	RC=$?
+	[ "$RC" -eq 124 ] && print_error_and_die "The whole budget of ${BUDGET}s was spent in the front end -- no function was decompiled."
+	[ "$RC" -ne 0 ] && print_error_and_die "Front-end decompilation of '$IN' failed."
+else
+	"$DECOMPILER_SH" -o "$OUT" --stop-after bin2llvmir "$IN" $DECOMPILER_SH_ARGS \
+		|| print_error_and_die "Front-end decompilation of '$IN' failed."
+fi
+CONFIG="$OUT.json"
+[ -f "$CONFIG" ] || print_error_and_die "Front end did not produce the config file '$CONFIG'."
+
+##
+## Partition the detected functions into shards. Round-robin over the sorted
+## function list keeps the partitioning deterministic and the shard sizes
+## balanced.
+##
+# In the budget mode, the function list is ordered by priority, so that the
+# most interesting functions are decompiled before the budget runs out.
+LIST_FUNCS_OPT="--list-funcs"
+[ "$BUDGET" ] && LIST_FUNCS_OPT="--list-funcs-prioritized"
+
+FUNCS=()
+while IFS= read -r F; do
+	[ "$F" ] && FUNCS+=("$F")
+done < <("$CONFIGTOOL" "$CONFIG" --read "$LIST_FUNCS_OPT")
+
+if [ "${#FUNCS[@]}" -eq 0 ]; then
+	# Nothing to shard over (e.g. a stripped binary where no functions were
+	# named) -- fall back to a single ordinary decompilation.
+	print_warning "No functions detected, falling back to a single decompilation process."
+	"$DECOMPILER_SH" -o "$OUT" "$IN" $DECOMPILER_SH_ARGS
+	exit $?
+fi
+
+if [ "$JOBS" -gt "${#FUNCS[@]}" ]; then
+	JOBS="${#FUNCS[@]}"
+fi
+
+for ((INDEX=0; INDEX<JOBS; INDEX++)); do
+	> "$OUT.shard$INDEX.list"
+done
+if [ "$BUDGET" ]; then
+	# Contiguous split: shard 0 gets the highest-priority functions, so when
+	# the budget runs out, the lowest-priority shards are the ones missing.
+	PER_SHARD=$(( (${#FUNCS[@]} + JOBS - 1) / JOBS ))
+	for ((INDEX=0; INDEX<${#FUNCS[@]}; INDEX++)); do
+		echo "${FUNCS[$INDEX]}" >> "$OUT.shard$((INDEX / PER_SHARD)).list"
+	done
+else
+	for ((INDEX=0; INDEX<${#FUNCS[@]}; INDEX++)); do
+		echo "${FUNCS[$INDEX]}" >> "$OUT.shard$((INDEX % JOBS)).list"
+	done
+fi
+
+##
+## Decompile the shards in parallel. Each worker is an ordinary decompilation
+## restricted to its functions -- to distribute the work across machines, run
+## the same commands on the nodes instead of backgrounding them here.
+##
+if [ "$BUDGET" ]; then
+	REMAINING=$((BUDGET - SECONDS))
+	[ "$REMAINING" -lt 1 ] && REMAINING=1
+	TIMEOUT_CMD=(gnutimeout "$REMAINING")
+else
+	TIMEOUT_CMD=()
+fi
+
+echo ""
+echo "##### Decompiling ${#FUNCS[@]} functions in $JOBS shards..."
+SHARD_PIDS=()
+for ((INDEX=0; INDEX<JOBS; INDEX++)); do
+	LOG_FILE="$OUT.shard$INDEX.$HLL_SUFFIX.log.verbose"
+	"${TIMEOUT_CMD[@]}" "$DECOMPILER_SH" -o "$OUT.shard$INDEX.$HLL_SUFFIX" \
+		--config "$CONFIG" \
+		--select-functions-file "$OUT.shard$INDEX.list" \
+		"$IN" $DECOMPILER_SH_ARGS > "$LOG_FILE" 2>&1 &
+	SHARD_PIDS+=($!)
+done
+
+FAILED=
+SHARD_DONE=()
+for ((INDEX=0; INDEX<JOBS; INDEX++)); do
+	echo -ne "shard $((INDEX + 1))/$JOBS\t\t"
+	wait "${SHARD_PIDS[$INDEX]}"
+	RC=$?
+	case $RC in
+		0)
+			echo "[OK]"
+			SHARD_DONE[$INDEX]=1;;
+		124)
+			echo "[TIMEOUT]";;
+		*)
+			echo "[FAIL] (see $OUT.shard$INDEX.$HLL_SUFFIX.log.verbose)"
+			FAILED=1;;
+	esac
+done
+# In the budget mode, timed-out shards are expected -- the output contains
+# whatever finished. Real failures are fatal either way.
+[ "$FAILED" ] && print_error_and_die "Decompilation of some shards failed."
+
+##
+## Concatenate the finished per-shard outputs in shard order. Functions whose
+## shards did not finish within the budget are listed in a comment.
+##
+COMMENT="//"
+[ "$HLL_SUFFIX" = "py" ] && COMMENT="#"
+
+> "$OUT"
+for ((INDEX=0; INDEX<JOBS; INDEX++)); do
+	if [ "${SHARD_DONE[$INDEX]}" ]; then
+		cat "$OUT.shard$INDEX.$HLL_SUFFIX" >> "$OUT"
+	else
+		echo "$COMMENT Budget of ${BUDGET}s exceeded -- the following functions were not decompiled:" >> "$OUT"
+		while IFS= read -r F; do
+			echo "$COMMENT     $F" >> "$OUT"
+		done < "$OUT.shard$INDEX.list"
+	fi
+done
+
+cleanup
+
+echo ""
+echo "##### Done, output saved to $OUT."
+exit 0
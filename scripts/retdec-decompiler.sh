@@ -70,6 +70,7 @@ print_help()
 	echo "               --backend-semantics                    A comma-separated list of the used semantics."
 	echo "               --backend-strict-fpu-semantics         Forces strict FPU semantics to be used."
 	echo "               --backend-var-renamer string           Used renamer of variables [address|hungarian|readable|simple|unified] (default: readable)."
+	echo "               --cache-dir dir                        Cache front-end results in the given directory and reuse them when the same input is decompiled again (e.g. with different back-end options)."
 	echo "               --cleanup                              Removes temporary files created during the decompilation."
 	echo "               --color-for-ida                        Put IDA Pro color tags to output C file."
 	echo "               --config name                          Specify JSON decompilation configuration file."
@@ -77,10 +78,12 @@ print_help()
 	echo "               --fileinfo-verbose                     Print all detected information about input file."
 	echo "               --fileinfo-use-all-external-patterns   Use all detection rules from external YARA databases."
 	echo "               --graph-format name                    Specify format of a all generated graphs (e.g. CG, CFG) [pdf|png|svg] (default: png)."
+	echo "               --incremental                          Decompile only functions that changed since the run that produced the config given via --config; unchanged ones keep their recorded content hashes and are pruned."
 	echo "               --raw-entry-point addr                 Entry point address used for raw binary (default: architecture dependent)."
 	echo "               --raw-section-vma addr                 Virtual address where section created from the raw binary will be placed (default: architecture dependent)."
 	echo "               --select-decode-only                   Decode only selected parts (functions/ranges). Faster decompilation, but worse results."
 	echo "               --select-functions list                Specify a comma separated list of functions to decompile (example: fnc1,fnc2,fnc3)."
+	echo "               --select-functions-file file           Like --select-functions, but the function names are read from the given file (one name per line)."
 	echo "               --select-ranges list                   Specify a comma separated list of ranges to decompile (example: 0x100-0x200,0x300-0x400,0x500-0x600)."
 	echo "               --stop-after tool                      Stop the decompilation after the given tool (supported tools: fileinfo, unpacker, bin2llvmir, llvmir2hll)."
 	echo "               --static-code-sigfile path             Adds additional signature file for static code detection."
@@ -91,7 +94,7 @@ print_help()
 }
 SCRIPT_NAME=$0
 GETOPT_SHORTOPT="a:e:hkl:m:o:p:"
-GETOPT_LONGOPT="arch:,help,keep-unreachable-funcs,target-language:,mode:,output:,pdb:,backend-aggressive-opts,backend-arithm-expr-evaluator:,backend-call-info-obtainer:,backend-cfg-test,backend-disabled-opts:,backend-emit-cfg,backend-emit-cg,backend-cg-conversion:,backend-cfg-conversion:,backend-enabled-opts:,backend-find-patterns:,backend-force-module-name:,backend-keep-all-brackets,backend-keep-library-funcs,backend-llvmir2bir-converter:,backend-no-compound-operators,backend-no-debug,backend-no-debug-comments,backend-no-opts,backend-no-symbolic-names,backend-no-time-varying-info,backend-no-var-renaming,backend-semantics,backend-strict-fpu-semantics,backend-var-renamer:,cleanup,graph-format:,raw-entry-point:,raw-section-vma:,endian:,select-decode-only,select-functions:,select-ranges:,fileinfo-verbose,fileinfo-use-all-external-patterns,config:,color-for-ida,no-config,stop-after:,static-code-sigfile:,static-code-archive:,no-default-static-signatures,ar-name:,ar-index:,max-memory:,no-memory-limit"
+GETOPT_LONGOPT="arch:,help,keep-unreachable-funcs,target-language:,mode:,output:,pdb:,backend-aggressive-opts,backend-arithm-expr-evaluator:,backend-call-info-obtainer:,backend-cfg-test,backend-disabled-opts:,backend-emit-cfg,backend-emit-cg,backend-cg-conversion:,backend-cfg-conversion:,backend-enabled-opts:,backend-find-patterns:,backend-force-module-name:,backend-keep-all-brackets,backend-keep-library-funcs,backend-llvmir2bir-converter:,backend-no-compound-operators,backend-no-debug,backend-no-debug-comments,backend-no-opts,backend-no-symbolic-names,backend-no-time-varying-info,backend-no-var-renaming,backend-semantics,backend-strict-fpu-semantics,backend-var-renamer:,cache-dir:,cleanup,graph-format:,raw-entry-point:,raw-section-vma:,endian:,select-decode-only,select-functions:,select-functions-file:,select-ranges:,fileinfo-verbose,fileinfo-use-all-external-patterns,config:,color-for-ida,no-config,incremental,stop-after:,static-code-sigfile:,static-code-archive:,no-default-static-signatures,ar-name:,ar-index:,max-memory:,no-memory-limit"
 
 #
 # Check proper combination of input arguments.
@@ -132,6 +135,12 @@ check_arguments()
 		fi
 	fi
 
+	# Incremental decompilation needs the config from the previous run -- it
+	# carries the content hashes the new functions are compared against.
+	if [ "$INCREMENTAL" ] && [ ! "$CONFIG_DB" ]; then
+		print_error_and_die "Option --incremental must be used with option --config"
+	fi
+
 	# Archive decompilation errors.
 	[ "$AR_NAME" ] && [ "$AR_INDEX" ] && print_error_and_die "Options --ar-name and --ar-index are mutually exclusive. Pick one."
 	if [ "$MODE" != "bin" ]; then
@@ -171,6 +180,9 @@ check_arguments()
 	if [ -e "$PDB_FILE" ]; then
 		PDB_FILE="$(get_realpath "$PDB_FILE")"
 	fi
+	if [ -e "$SELECTED_FUNCTIONS_FILE" ]; then
+		SELECTED_FUNCTIONS_FILE="$(get_realpath "$SELECTED_FUNCTIONS_FILE")"
+	fi
 
 	# Check that selected ranges are valid.
 	if [ "$SELECTED_RANGES" ]; then
@@ -403,6 +415,10 @@ while true; do
 		RAW_SECTION_VMA="$2"
 		#RAW_SECTION_VMA="$(($2))"  # evaluate hex address - probably not needed
 		shift 2;;
+	--cache-dir)					# Directory for cached front-end results.
+		[ "$CACHE_DIR" ] && print_error_and_die "Duplicate option: --cache-dir"
+		CACHE_DIR="$2"
+		shift 2;;
 	--cleanup) 						# Cleanup.
 		[ "$CLEANUP" ] && print_error_and_die "Duplicate option: --cleanup"
 		CLEANUP=1
@@ -438,12 +454,25 @@ while true; do
 		IFS=',' read -a SELECTED_FUNCTIONS <<< "$2"  # parser line into array
 		KEEP_UNREACHABLE_FUNCS=1
 		shift 2;;
+	--select-functions-file)		# File with selected functions.
+		[ "$SELECTED_FUNCTIONS_FILE" ] && print_error_and_die "Duplicate option: --select-functions-file"
+		SELECTED_FUNCTIONS_FILE="$2"
+		if [ ! -r "$SELECTED_FUNCTIONS_FILE" ]; then
+			print_error_and_die "The file '$SELECTED_FUNCTIONS_FILE' given to --select-functions-file does not exist or is not readable"
+		fi
+		KEEP_UNREACHABLE_FUNCS=1
+		shift 2;;
 	--select-ranges)				# List of selected ranges.
 		[ "$SELECTED_RANGES" ] && print_error_and_die "Duplicate option: --select-ranges"
 		SELECTED_RANGES="$2"
 		IFS=',' read -a SELECTED_RANGES <<< "$2"  # parser line into array
 		KEEP_UNREACHABLE_FUNCS=1
 		shift 2;;
+	--incremental)					# Decompile only changed functions.
+		[ "$INCREMENTAL" ] && print_error_and_die "Duplicate option: --incremental"
+		INCREMENTAL=1
+		KEEP_UNREACHABLE_FUNCS=1
+		shift;;
 	--stop-after) 				# Stop decompilation after the given tool.
 		[ "$STOP_AFTER" ] && print_error_and_die "Duplicate option: --stop-after"
 		STOP_AFTER="$2"
@@ -633,6 +662,51 @@ if [ "$MODE" = "bin" ] || [ "$MODE" = "raw" ]; then
 		echo "{}" > "$CONFIG"
 	fi
 
+	# Front-end cache: the config and the bin2llvmir output module are keyed
+	# by the content of all input files and by the options that influence the
+	# front-end. On a hit the whole front-end (fileinfo, unpacker, bin2llvmir,
+	# including static code detection) is skipped and only the back-end runs.
+	if [ "$CACHE_DIR" ]; then
+		mkdir -p "$CACHE_DIR" || print_error_and_die "Unable to create cache directory '$CACHE_DIR'"
+		CACHE_KEY="$MODE|$ARCH|$ENDIAN|$RAW_ENTRY_POINT|$RAW_SECTION_VMA"
+		CACHE_KEY+="|$KEEP_UNREACHABLE_FUNCS|$SELECTED_DECODE_ONLY"
+		CACHE_KEY+="|${SELECTED_FUNCTIONS[*]}|${SELECTED_RANGES[*]}"
+		CACHE_KEY+="|$DO_NOT_LOAD_STATIC_SIGNATURES"
+		CACHE_KEY+="|$FILEINFO_VERBOSE|$FILEINFO_USE_ALL_EXTERNAL_PATTERNS"
+		for f in "$IN" "$PDB_FILE" "$CONFIG_DB" "$SELECTED_FUNCTIONS_FILE" "${TEMPORARY_SIGNATURES[@]}" "${SIGNATURE_ARCHIVE_PATHS[@]}"; do
+			[ -f "$f" ] && CACHE_KEY+="|$(sha256sum "$f" | cut -d' ' -f1)"
+		done
+		CACHE_ENTRY="$CACHE_DIR/$(sha256sum <<< "$CACHE_KEY" | cut -d' ' -f1)"
+
+		if [ -f "$CACHE_ENTRY.config.json" ] && [ -f "$CACHE_ENTRY.backend.bc" ]; then
+			FRONTEND_FROM_CACHE=1
+		fi
+	fi
+
+	if [ "$FRONTEND_FROM_CACHE" ]; then
+		echo ""
+		echo "##### Restoring cached front-end results for $IN..."
+		cp "$CACHE_ENTRY.config.json" "$CONFIG"
+
+		OUT_BACKEND="$OUT.backend"
+		[ "$OUT_FRONTEND_LL" = "$OUT_BACKEND.ll" ] && OUT_BACKEND="$OUT.backend.backend"
+		OUT_BACKEND_BC="$OUT_BACKEND.bc"
+		OUT_BACKEND_LL="$OUT_BACKEND.ll"
+		cp "$CACHE_ENTRY.backend.bc" "$OUT_BACKEND_BC"
+
+		# The cached config may come from a run with different output paths.
+		"$CONFIGTOOL" "$CONFIG" --write --input-file "$IN"
+		"$CONFIGTOOL" "$CONFIG" --write --frontend-output-file "$OUT_FRONTEND_LL"
+		"$CONFIGTOOL" "$CONFIG" --write --output-file "$OUT"
+
+		# The cached artifacts cover these phases.
+		check_whether_decompilation_should_be_forcefully_stopped "fileinfo"
+		check_whether_decompilation_should_be_forcefully_stopped "unpacker"
+		check_whether_decompilation_should_be_forcefully_stopped "bin2llvmir"
+	fi
+fi # modes "bin" || "raw"
+
+if { [ "$MODE" = "bin" ] || [ "$MODE" = "raw" ]; } && [ ! "$FRONTEND_FROM_CACHE" ]; then
 	# Raw data needs architecture, endianess and optionaly sections's vma and entry point to be specified.
 	if [ "$MODE" = "raw" ]; then
 		[ ! "$ARCH" -o "$ARCH" = "unknown" -o "$ARCH" = "" ] && print_error_and_die "Option -a|--arch must be used with mode $MODE"
@@ -862,12 +936,20 @@ if [ "$MODE" = "bin" ] || [ "$MODE" = "raw" ]; then
 		"$CONFIGTOOL" "$CONFIG" --write --decode-only-selected "false"
 	fi
 
+	# Store incremental decompilation flag.
+	if [ "$INCREMENTAL" ]; then
+		"$CONFIGTOOL" "$CONFIG" --write --incremental "true"
+	fi
+
 	# Store selected functions or selected ranges into config for frontend.
 	if [ "$SELECTED_FUNCTIONS" ]; then
 		for f in "${SELECTED_FUNCTIONS[@]}"; do
 			"$CONFIGTOOL" "$CONFIG" --write --selected-func "$f"
 		done
 	fi
+	if [ "$SELECTED_FUNCTIONS_FILE" ]; then
+		"$CONFIGTOOL" "$CONFIG" --write --selected-funcs-file "$SELECTED_FUNCTIONS_FILE"
+	fi
 	if [ "$SELECTED_RANGES" ]; then
 		for r in "${SELECTED_RANGES[@]}"; do
 			"$CONFIGTOOL" "$CONFIG" --write --selected-range "$r"
@@ -890,6 +972,15 @@ if [ "$MODE" = "bin" ] || [ "$MODE" = "raw" ]; then
 	##
 	## Decompile the binary into LLVM IR.
 	##
+	if [ "$SELECTED_FUNCTIONS" ] || [ "$SELECTED_FUNCTIONS_FILE" ] || [ "$SELECTED_RANGES" ] || [ "$INCREMENTAL" ]; then
+		# Selection (user-given, or computed from the content hashes in the
+		# incremental mode) is authoritative: prune unselected and
+		# unreachable functions right after function detection, before the
+		# expensive analyses run, instead of after them.
+		BIN2LLVMIR_PARAMS="$(sed 's/-select-fncs *//g;s/-unreachable-funcs *//g' <<< "$BIN2LLVMIR_PARAMS")"
+		BIN2LLVMIR_PARAMS="$(sed 's/-main-detection/-main-detection -select-fncs -unreachable-funcs/' <<< "$BIN2LLVMIR_PARAMS")"
+	fi
+
 	if [ "$KEEP_UNREACHABLE_FUNCS" ]; then
 		# Prevent bin2llvmir from removing unreachable functions.
 		BIN2LLVMIR_PARAMS="$(sed 's/-unreachable-funcs *//g' <<< "$BIN2LLVMIR_PARAMS")"
@@ -920,6 +1011,13 @@ if [ "$MODE" = "bin" ] || [ "$MODE" = "raw" ]; then
 		cleanup
 		print_error_and_die "Decompilation to LLVM IR failed"
 	fi
+
+	if [ "$CACHE_ENTRY" ]; then
+		# Store the front-end results for future runs on the same input.
+		cp "$CONFIG" "$CACHE_ENTRY.config.json"
+		cp "$OUT_BACKEND_BC" "$CACHE_ENTRY.backend.bc"
+	fi
+
 	check_whether_decompilation_should_be_forcefully_stopped "bin2llvmir"
 
 fi # modes "bin" || "raw"
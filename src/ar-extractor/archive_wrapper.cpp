@@ -15,6 +15,7 @@
 
 #include "retdec/utils/filesystem_path.h"
 #include "retdec/utils/string.h"
+#include "retdec/utils/thread_pool.h"
 #include "retdec/ar-extractor/archive_wrapper.h"
 
 using namespace retdec::utils;
@@ -111,8 +112,13 @@ ArchiveWrapper::ArchiveWrapper(
 	const std::string &archivePath,
 	bool &succes,
 	std::string &errorMessage)
-	: buffer(MemoryBuffer::getFile(llvm::Twine(archivePath)))
+	: buffer(MemoryBuffer::getFile(llvm::Twine(archivePath), -1,
+		/*RequiresNullTerminator=*/false))
 {
+	// Without the null terminator requirement, large archives are mapped
+	// into memory instead of being read into a heap buffer. Member buffers
+	// are just references into this shared read-only mapping, so they can
+	// be used from multiple threads.
 	succes = false;
 	if (!buffer) {
 		errorMessage = "Could not create file buffer";
@@ -126,8 +132,8 @@ ArchiveWrapper::ArchiveWrapper(
 		return;
 	}
 
-	// Get object count - this iterates over all objects.
-	succes = getCount(objectCount, errorMessage);
+	// Get object count and names - this iterates over all objects.
+	succes = buildNameIndex(errorMessage);
 }
 
 
@@ -274,6 +280,11 @@ bool ArchiveWrapper::extract(
 	// Map for non-unique names - counts number of name occurrences.
 	std::map<std::string, std::size_t> nameMap;
 
+	// First pass: collect output paths and member buffers. The buffers are
+	// only references into the shared archive mapping, so nothing is copied
+	// here.
+	std::vector<std::pair<std::string, llvm::StringRef>> tasks;
+
 	Error error;
 	for (const auto &child : archive->children(error)) {
 		if (checkError(error, errorMessage)) {
@@ -296,13 +307,31 @@ bool ArchiveWrapper::extract(
 		}
 		else {
 			auto dir = directory.empty() ? directory : directory + '/';
-			if (!writeFile(dir + name, *bufferOrErr, errorMessage)) {
-				return false;
-			}
+			tasks.emplace_back(dir + name, *bufferOrErr);
 		}
 	}
+	if (checkError(error, errorMessage)) {
+		return false;
+	}
 
-	return !checkError(error, errorMessage);
+	// Second pass: write the output files, in parallel when there is more
+	// than one. Every worker only reads the shared mapping and writes its
+	// own output file, so no synchronization beyond the task counter is
+	// needed. The first error (in archive order) is reported.
+	std::vector<std::string> taskErrors(tasks.size());
+
+	parallelFor(tasks.size(), [&](std::size_t i) {
+		writeFile(tasks[i].first, tasks[i].second, taskErrors[i]);
+	});
+
+	for (const auto &taskError : taskErrors) {
+		if (!taskError.empty()) {
+			errorMessage = taskError;
+			return false;
+		}
+	}
+
+	return true;
 }
 
 
@@ -425,6 +454,9 @@ bool ArchiveWrapper::extractByIndex(
  * If name of object could not be read from input archive, name 'invalid_name'
  * is used.
  *
+ * Names are served from the index built at construction, so this does not
+ * iterate over the archive again.
+ *
  * @param result container where names will be added
  * @param errorMessage possible error message if @c false is returned
  *
@@ -434,45 +466,39 @@ bool ArchiveWrapper::getNames(
 	std::vector<std::string> &result,
 	std::string &errorMessage) const
 {
-	Error error;
-	for (const auto &child : archive->children(error)) {
-		if (checkError(error, errorMessage)) {
-			return false;
-		}
-
-		auto nameOrErr = child.getName();
-		if (!nameOrErr) {
-			result.emplace_back("invalid_name");
-		}
-		else {
-			result.push_back(*nameOrErr);
-		}
-	}
-
-	return !checkError(error, errorMessage);
+	result = objectNames;
+	return true;
 }
 
 
 /**
- * Get object count.
+ * Get object count and names of all object files in one walk.
+ *
+ * Only member headers and the string table are read - member bodies are not
+ * touched. If name of object could not be read, name 'invalid_name' is used.
  *
- * @param count result
  * @param errorMessage possible error message if @c false is returned
  *
  * @return @c true if no errors occurred, @c false otherwise
  */
-bool ArchiveWrapper::getCount(
-	std::size_t &count,
-	std::string &errorMessage) const
+bool ArchiveWrapper::buildNameIndex(std::string &errorMessage)
 {
 	Error error;
-	count = 0; // Reset counter.
-	const auto &ar = archive;
-	for (auto i = ar->child_begin(error), e = ar->child_end(); i != e; ++i) {
+	objectCount = 0; // Reset counter.
+	objectNames.clear();
+	for (const auto &child : archive->children(error)) {
 		if (checkError(error, errorMessage)) {
 			return false;
 		}
-		count++;
+
+		auto nameOrErr = child.getName();
+		if (!nameOrErr) {
+			objectNames.emplace_back("invalid_name");
+		}
+		else {
+			objectNames.push_back(*nameOrErr);
+		}
+		objectCount++;
 	}
 
 	return !checkError(error, errorMessage);
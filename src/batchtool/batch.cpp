@@ -0,0 +1,479 @@
+/**
+ * @file src/batchtool/batch.cpp
+ * @brief Core-aware batch decompilation scheduler.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "retdec/fileformat/utils/format_detection.h"
+#include "retdec/utils/memory.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_POSIX
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
+using retdec::fileformat::Format;
+
+namespace {
+
+/**
+ * One binary to decompile, with its predicted cost.
+ */
+struct Job
+{
+	std::string input;            ///< path of the input binary
+	std::uint64_t fileSize = 0;   ///< size of the input binary in bytes
+	Format format = Format::UNKNOWN; ///< detected file format
+	std::size_t predictedMemory = 0; ///< predicted peak memory in bytes
+	bool done = false;            ///< has the job been taken by a worker?
+};
+
+/**
+ * Command-line options of the tool.
+ */
+struct Options
+{
+	/// Number of concurrent jobs.
+	unsigned jobs = std::thread::hardware_concurrency();
+
+	/// Total memory budget shared by the running jobs (0 = system RAM).
+	std::size_t totalMemory = 0;
+
+	/// Hard per-job memory cap (0 = derived from the prediction).
+	std::size_t jobMemory = 0;
+
+	/// Command template run for every job; {} expands to the input path.
+	std::string command = "retdec-decompiler.sh {}";
+
+	/// Input binaries.
+	std::vector<std::string> inputs;
+};
+
+/**
+ * Print usage.
+ */
+void printUsage()
+{
+	std::cout << "\nCore-aware batch decompilation scheduler.\n"
+		"Usage: retdec-batch [OPTIONS] BINARY_FILE [BINARY_FILE ...]\n\n"
+		"Options:\n"
+		"  -j N           Run up to N jobs concurrently (default: all cores).\n"
+		"  -m BYTES       Total memory budget shared by the running jobs\n"
+		"                 (default: total system RAM).\n"
+		"  --job-memory BYTES\n"
+		"                 Hard per-job memory cap (default: 1.5x of the\n"
+		"                 predicted memory of the job).\n"
+		"  -c COMMAND     Command template to run for every job; {} expands\n"
+		"                 to the input path (default: retdec-decompiler.sh {}).\n"
+		"  -l FILE        Read additional input paths from FILE, one per line.\n"
+		"  -h, --help     Print this message.\n\n"
+		"Jobs are ordered by predicted cost (file size, format) and started\n"
+		"largest-first, so one huge binary does not serialize the tail of the\n"
+		"batch, and a job is only started when its predicted memory fits into\n"
+		"the remaining budget. The output of every job goes to INPUT.log; one\n"
+		"status line per finished job goes to standard output.\n\n";
+}
+
+/**
+ * Print error message and return non-zero value.
+ *
+ * @param errorMessage message to print
+ * @return non-zero value
+ */
+int printError(const std::string &errorMessage)
+{
+	std::cerr << "Error: " << errorMessage << "\n";
+	return 1;
+}
+
+/**
+ * Predict the peak memory of decompiling the given binary.
+ *
+ * @param format detected file format of the binary
+ * @param fileSize size of the binary in bytes
+ * @return predicted peak memory in bytes
+ *
+ * The multipliers are rough upper estimates of how the pipeline expands its
+ * input (LLVM IR, provider data, back-end structures). They only need to
+ * order and pack the jobs sensibly -- the real cap applied to a job leaves
+ * headroom above this prediction.
+ */
+std::size_t predictMemoryUsage(Format format, std::uint64_t fileSize)
+{
+	std::size_t multiplier = 0;
+	switch (format) {
+		case Format::PE:
+		case Format::ELF:
+		case Format::COFF:
+		case Format::MACHO:
+			multiplier = 12;
+			break;
+		case Format::INTEL_HEX:
+		case Format::RAW_DATA:
+			// Everything in these is code to decode and translate.
+			multiplier = 24;
+			break;
+		default:
+			multiplier = 8;
+			break;
+	}
+
+	// Fixed pipeline cost dominates small inputs.
+	const std::size_t base = 256 * 1024 * 1024;
+	return base + fileSize * multiplier;
+}
+
+/**
+ * Probe the given binary and create its job.
+ *
+ * @param input path of the binary
+ * @param job created job
+ * @return @c true when the binary exists and is readable
+ *
+ * Only the size and the format magic are read -- the probe must stay cheap
+ * enough to run on thousands of inputs before any decompilation starts.
+ */
+bool probeInput(const std::string &input, Job &job)
+{
+	std::ifstream file(input, std::ios::binary | std::ios::ate);
+	if (!file) {
+		return false;
+	}
+
+	job.input = input;
+	job.fileSize = file.tellg();
+	file.seekg(0);
+	job.format = retdec::fileformat::detectFileFormat(file);
+	job.predictedMemory = predictMemoryUsage(job.format, job.fileSize);
+	return true;
+}
+
+/**
+ * Build the command of a job from the command template.
+ *
+ * @param commandTemplate template with {} as the input placeholder
+ * @param input path of the input binary
+ * @return command to run via the shell
+ */
+std::string buildJobCommand(
+	const std::string &commandTemplate,
+	const std::string &input)
+{
+	// Single-quote the path for the shell; embedded single quotes become
+	// the usual '\'' dance.
+	std::string quoted = "'";
+	for (const auto c : input) {
+		quoted += c == '\'' ? "'\\''" : std::string(1, c);
+	}
+	quoted += "'";
+
+	auto command = commandTemplate;
+	const auto placeholder = command.find("{}");
+	if (placeholder != std::string::npos) {
+		command.replace(placeholder, 2, quoted);
+	} else {
+		command += " " + quoted;
+	}
+	return command;
+}
+
+#ifdef OS_POSIX
+
+/**
+ * Run one job and wait for it to finish.
+ *
+ * @param job job to run
+ * @param command command of the job
+ * @param memoryCap hard memory cap applied to the job process
+ * @return exit status of the job (non-zero also on signals)
+ *
+ * The job runs in its own process with its output redirected to INPUT.log;
+ * the memory cap is applied between fork and exec, so the whole job process
+ * tree shares one budget and an over-predicted job dies alone instead of
+ * taking the machine down.
+ */
+int runJob(const Job &job, const std::string &command, std::size_t memoryCap)
+{
+	const auto pid = fork();
+	if (pid == -1) {
+		return 1;
+	}
+
+	if (pid == 0) {
+		if (!freopen((job.input + ".log").c_str(), "w", stdout)
+				|| dup2(STDOUT_FILENO, STDERR_FILENO) == -1) {
+			_exit(1);
+		}
+		retdec::utils::limitSystemMemory(memoryCap);
+		execl("/bin/sh", "sh", "-c", command.c_str(),
+			static_cast<char*>(nullptr));
+		_exit(127);
+	}
+
+	int status = 0;
+	if (waitpid(pid, &status, 0) == -1) {
+		return 1;
+	}
+	if (WIFEXITED(status)) {
+		return WEXITSTATUS(status);
+	}
+	return WIFSIGNALED(status) ? 128 + WTERMSIG(status) : 1;
+}
+
+/**
+ * Scheduler packing the jobs onto the cores within the memory budget.
+ */
+class Scheduler
+{
+	public:
+		Scheduler(std::vector<Job> &jobs, const Options &options) :
+			jobs(jobs), options(options),
+			availableMemory(options.totalMemory)
+		{
+		}
+
+		/**
+		 * Run all jobs on the configured number of worker threads.
+		 *
+		 * @return number of failed jobs
+		 */
+		unsigned run()
+		{
+			// Largest-first ordering -- the classic longest-processing-time
+			// heuristic keeps one huge binary from serializing the tail of
+			// the batch.
+			std::sort(jobs.begin(), jobs.end(),
+				[](const Job &a, const Job &b) {
+					return a.predictedMemory > b.predictedMemory;
+				});
+
+			std::vector<std::thread> workers;
+			const auto count = std::max(1u,
+				std::min<unsigned>(options.jobs, jobs.size()));
+			for (unsigned i = 0; i < count; ++i) {
+				workers.emplace_back(&Scheduler::workerLoop, this);
+			}
+			for (auto &worker : workers) {
+				worker.join();
+			}
+			return failed;
+		}
+
+	private:
+		/**
+		 * Take the largest not-yet-taken job fitting into the remaining
+		 * memory budget and reserve its memory.
+		 *
+		 * @param taken the taken job
+		 * @return @c false when no jobs are left
+		 */
+		bool takeJob(Job *&taken)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			while (true) {
+				bool anyLeft = false;
+				for (auto &job : jobs) {
+					if (job.done) {
+						continue;
+					}
+					anyLeft = true;
+					// A job larger than the whole budget would never start;
+					// run it alone instead (running == 0).
+					if (job.predictedMemory <= availableMemory
+							|| running == 0) {
+						job.done = true;
+						++running;
+						availableMemory -= std::min(
+							job.predictedMemory, availableMemory);
+						taken = &job;
+						return true;
+					}
+				}
+				if (!anyLeft) {
+					return false;
+				}
+				// Everything left is too big right now -- wait for a
+				// running job to release its memory.
+				memoryReleased.wait(lock);
+			}
+		}
+
+		/**
+		 * Return the memory reserved for a finished job to the budget.
+		 */
+		void releaseJob(const Job &job)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				--running;
+				availableMemory += std::min(job.predictedMemory,
+					options.totalMemory - availableMemory);
+			}
+			memoryReleased.notify_all();
+		}
+
+		/**
+		 * Main loop of one worker thread.
+		 */
+		void workerLoop()
+		{
+			Job *job = nullptr;
+			while (takeJob(job)) {
+				const auto cap = options.jobMemory
+					? options.jobMemory
+					: job->predictedMemory + job->predictedMemory / 2;
+				const auto command = buildJobCommand(
+					options.command, job->input);
+
+				const auto start = std::chrono::steady_clock::now();
+				const auto status = runJob(*job, command, cap);
+				const std::chrono::duration<double> elapsed =
+					std::chrono::steady_clock::now() - start;
+
+				if (status != 0) {
+					++failed;
+				}
+				releaseJob(*job);
+
+				std::lock_guard<std::mutex> lock(outputMutex);
+				std::cout << "[" << ++finished << "/" << jobs.size() << "] "
+					<< (status == 0 ? "ok      " : "FAILED  ")
+					<< job->input
+					<< " status=" << status
+					<< " time=" << std::fixed << std::setprecision(1)
+					<< elapsed.count() << "s"
+					<< " predicted=" << (job->predictedMemory >> 20) << "MiB"
+					<< std::endl;
+			}
+		}
+
+		std::vector<Job> &jobs;      ///< all jobs, sorted largest-first
+		const Options &options;      ///< command-line options
+		std::mutex mutex;            ///< guards the jobs and the budget
+		std::mutex outputMutex;      ///< guards the status output
+		std::condition_variable memoryReleased; ///< signaled on job end
+		std::size_t availableMemory; ///< unreserved part of the budget
+		unsigned running = 0;        ///< number of currently running jobs
+		std::atomic<unsigned> finished{0}; ///< number of finished jobs
+		std::atomic<unsigned> failed{0};   ///< number of failed jobs
+};
+
+#endif
+
+/**
+ * Parse the command line into the options.
+ *
+ * @param argc argument count
+ * @param argv argument values
+ * @param options parsed options
+ * @return @c true on success
+ */
+bool parseArguments(int argc, char **argv, Options &options)
+{
+	const auto nextValue = [&](int &i) -> const char* {
+		return i + 1 < argc ? argv[++i] : nullptr;
+	};
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		if (arg == "-h" || arg == "--help") {
+			printUsage();
+			return false;
+		} else if (arg == "-j") {
+			const auto value = nextValue(i);
+			if (!value || std::atoi(value) <= 0) {
+				return false;
+			}
+			options.jobs = std::atoi(value);
+		} else if (arg == "-m") {
+			const auto value = nextValue(i);
+			if (!value) {
+				return false;
+			}
+			options.totalMemory = std::strtoull(value, nullptr, 10);
+		} else if (arg == "--job-memory") {
+			const auto value = nextValue(i);
+			if (!value) {
+				return false;
+			}
+			options.jobMemory = std::strtoull(value, nullptr, 10);
+		} else if (arg == "-c") {
+			const auto value = nextValue(i);
+			if (!value) {
+				return false;
+			}
+			options.command = value;
+		} else if (arg == "-l") {
+			const auto value = nextValue(i);
+			if (!value) {
+				return false;
+			}
+			std::ifstream list(value);
+			std::string line;
+			while (std::getline(list, line)) {
+				if (!line.empty()) {
+					options.inputs.push_back(line);
+				}
+			}
+		} else {
+			options.inputs.push_back(arg);
+		}
+	}
+
+	return !options.inputs.empty();
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+#ifdef OS_POSIX
+	Options options;
+	if (!parseArguments(argc, argv, options)) {
+		printUsage();
+		return 1;
+	}
+
+	if (options.totalMemory == 0) {
+		options.totalMemory = retdec::utils::getTotalSystemMemory();
+	}
+	if (options.totalMemory == 0) {
+		return printError("cannot determine the total system memory; "
+			"give the budget via -m");
+	}
+
+	std::vector<Job> jobs;
+	for (const auto &input : options.inputs) {
+		Job job;
+		if (!probeInput(input, job)) {
+			return printError("cannot read input file: " + input);
+		}
+		jobs.push_back(job);
+	}
+
+	Scheduler scheduler(jobs, options);
+	const auto failed = scheduler.run();
+	if (failed) {
+		std::cerr << failed << " of " << jobs.size() << " jobs failed\n";
+		return 1;
+	}
+	return 0;
+#else
+	return printError("retdec-batch is only available on POSIX systems");
+#endif
+}
@@ -0,0 +1,84 @@
+/**
+* @file src/bin2llvmir/analyses/analysis_manager.cpp
+* @brief Per-function validity tracking for bin2llvmir analyses.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/analyses/analysis_manager.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+std::map<const llvm::Function*, std::uint64_t> AnalysisManager::_fncVersions;
+std::map<const llvm::Module*, std::uint64_t> AnalysisManager::_modVersions;
+
+/**
+ * Report that the body of function @a f was modified.
+ */
+void AnalysisManager::reportModified(const llvm::Function* f)
+{
+	if (f)
+	{
+		++_fncVersions[f];
+	}
+}
+
+/**
+ * Report a module-wide modification of @a m -- functions added, removed,
+ * split, etc. All per-function results computed for @a m become stale.
+ */
+void AnalysisManager::reportModified(const llvm::Module* m)
+{
+	if (m)
+	{
+		++_modVersions[m];
+	}
+}
+
+/**
+ * @return Version stamp of function @a f. The stamp changes whenever @a f,
+ *         or the module that owns it, is reported modified.
+ */
+std::uint64_t AnalysisManager::getVersion(const llvm::Function* f)
+{
+	if (f == nullptr)
+	{
+		return 0;
+	}
+
+	std::uint64_t v = 0;
+	auto fIt = _fncVersions.find(f);
+	if (fIt != _fncVersions.end())
+	{
+		v = fIt->second;
+	}
+	auto mIt = _modVersions.find(f->getParent());
+	if (mIt != _modVersions.end())
+	{
+		// Function versions never get anywhere near 2^32, so combining the
+		// two counters this way cannot collide in practice.
+		v += (mIt->second << 32);
+	}
+	return v;
+}
+
+/**
+ * Erase all version counters associated with module @a m.
+ */
+void AnalysisManager::erase(const llvm::Module* m)
+{
+	for (auto it = _fncVersions.begin(); it != _fncVersions.end();)
+	{
+		it = it->first->getParent() == m ? _fncVersions.erase(it) : std::next(it);
+	}
+	_modVersions.erase(m);
+}
+
+void AnalysisManager::clear()
+{
+	_fncVersions.clear();
+	_modVersions.clear();
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
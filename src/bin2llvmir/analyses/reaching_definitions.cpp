@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include <llvm/ADT/BitVector.h>
 #include <llvm/ADT/PostOrderIterator.h>
 #include <llvm/Analysis/OrderedBasicBlock.h>
 #include <llvm/IR/CFG.h>
@@ -229,6 +230,15 @@ void ReachingDefinitionsAnalysis::initializeKillGenSets()
 	}
 }
 
+/**
+ * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
+ * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
+ *
+ * The fixpoint is computed on bit vectors over a per-function numbering of
+ * definitions -- one iteration step is a handful of word-parallel operations
+ * instead of hash-set insertions. The resulting @c defsOut sets are
+ * materialized from the bit vectors only once, after the fixpoint is reached.
+ */
 void ReachingDefinitionsAnalysis::propagate()
 {
 	for (auto &pair1 : bbMap)
@@ -244,18 +254,94 @@ void ReachingDefinitionsAnalysis::propagate()
 			auto fIt = pair1.second.find(bb);
 			assert(fIt != pair1.second.end());
 			workList.push_back(&(fIt->second));
+		}
+
+		// Number all definitions in the function and precompute the set of
+		// definitions for every defined source.
+		//
+		std::vector<Definition*> defPool;
+		std::unordered_map<Definition*, unsigned> defIds;
+		for (auto* bbe : workList)
+		{
+			for (Definition& d : bbe->defs)
+			{
+				defIds[&d] = defPool.size();
+				defPool.push_back(&d);
+			}
+		}
+		unsigned dn = defPool.size();
+
+		std::unordered_map<llvm::Value*, llvm::BitVector> srcDefs;
+		for (unsigned i = 0; i < dn; ++i)
+		{
+			auto& bv = srcDefs[defPool[i]->getSource()];
+			if (bv.size() != dn)
+			{
+				bv.resize(dn);
+			}
+			bv.set(i);
+		}
+
+		std::unordered_map<BasicBlockEntry*, unsigned> bbIds;
+		std::vector<llvm::BitVector> gen(workList.size());
+		std::vector<llvm::BitVector> kill(workList.size());
+		std::vector<llvm::BitVector> out(workList.size());
+		for (unsigned j = 0; j < workList.size(); ++j)
+		{
+			BasicBlockEntry* bbe = workList[j];
+			bbIds[bbe] = j;
+
+			gen[j].resize(dn);
+			for (Definition* d : bbe->genDefs)
+			{
+				gen[j].set(defIds[d]);
+			}
+
+			kill[j].resize(dn);
+			for (llvm::Value* src : bbe->killDefs)
+			{
+				auto sIt = srcDefs.find(src);
+				if (sIt != srcDefs.end())
+				{
+					kill[j] |= sIt->second;
+				}
+			}
 
-			fIt->second.changed = true;
+			out[j] = gen[j];
 		}
 
 		bool changed = true;
+		llvm::BitVector in(dn);
 		while (changed)
 		{
 			changed = false;
 
-			for (auto* bbe : workList)
+			for (unsigned j = 0; j < workList.size(); ++j)
+			{
+				BasicBlockEntry* bbe = workList[j];
+
+				in.reset();
+				for (auto* p : bbe->prevBBs)
+				{
+					in |= out[bbIds[p]];
+				}
+
+				in.reset(kill[j]);
+				in |= gen[j];
+				if (in != out[j])
+				{
+					out[j] = in;
+					changed = true;
+				}
+			}
+		}
+
+		for (unsigned j = 0; j < workList.size(); ++j)
+		{
+			BasicBlockEntry* bbe = workList[j];
+			for (int i = out[j].find_first(); i >= 0; i = out[j].find_next(i))
 			{
-				changed |= bbe->initDefsOut();
+				bbe->defsOut.insert(defPool[i]);
 			}
 		}
 	}
@@ -381,37 +467,6 @@ void BasicBlockEntry::initializeKillDefSets()
 	}
 }
 
-/**
- * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
- * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
- */
-Changed BasicBlockEntry::initDefsOut()
-{
-	auto oldSz = defsOut.size();
-
-	if (defsOut.empty() && !genDefs.empty())
-	{
-		defsOut = std::move(genDefs);
-	}
-
-	for (auto* p : prevBBs)
-	{
-		if (p->changed)
-		{
-			for (auto* d : p->defsOut)
-			{
-				if (killDefs.find(d->getSource()) == killDefs.end())
-				{
-					defsOut.insert(d);
-				}
-			}
-		}
-	}
-
-	changed = oldSz != defsOut.size();
-	return changed;
-}
-
 std::string BasicBlockEntry::getName() const
 {
 	std::stringstream out;
@@ -4,10 +4,13 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include <llvm/IR/CFG.h>
 #include <llvm/Support/raw_ostream.h>
 
 #include "retdec/utils/container.h"
+#include "retdec/utils/instrumentation.h"
 #include "retdec/bin2llvmir/analyses/indirectly_called_funcs_analysis.h"
 #include "retdec/bin2llvmir/analyses/store_load_analysis.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
@@ -18,6 +21,19 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+namespace {
+
+/// Number of basic block visits per one basic block of a function that the
+/// analysis of this function may spend. On adversarial control flow, the SCC
+/// iteration can need an enormous number of visits to reach a fixed point.
+const std::size_t BB_VISIT_BUDGET_PER_BB = 128;
+
+/// Lower bound of the work budget, so small functions with complicated
+/// control flow are not degraded needlessly.
+const std::size_t BB_VISIT_BUDGET_MIN = 4096;
+
+} // anonymous namespace
+
 /**
 * @brief Emits all functions info to standard error.
 *
@@ -102,7 +118,8 @@ void StoreLoadAnalysis::FuncInfo::printFuncInfo() {
 * @brief Creates a new store load analysis.
 */
 StoreLoadAnalysis::StoreLoadAnalysis(): countWithFuncsOutOfModule(false),
-	currFuncInfo(nullptr), currBBInfo(nullptr) {}
+	currFuncInfo(nullptr), currBBInfo(nullptr), currFuncBBVisitBudget(0),
+	currFuncBBVisits(0) {}
 
 /**
 * @brief Destructs a store load analysis.
@@ -158,6 +175,8 @@ void StoreLoadAnalysis::clear() {
 	for (auto &item : bbInfoMap) {
 		delete item.second;
 	}
+
+	funcsOverBudget.clear();
 }
 
 /**
@@ -341,6 +360,13 @@ void StoreLoadAnalysis::processFunc(Function &func) {
 
 	setCurrFuncInfo(func);
 
+	if (isFuncOverBudget(func)) {
+		// Once degraded, the function stays degraded -- re-analyzing it in
+		// a next SCC iteration would just exceed the budget again.
+		degradeCurrFuncInfo();
+		return;
+	}
+
 	goThroughBBsAndAnalyzeThem(func);
 
 	afterAnalysisBBsInFunc();
@@ -350,8 +376,19 @@ void StoreLoadAnalysis::processFunc(Function &func) {
 * @brief Goes through basic blocks in @a func and analyzes them.
 */
 void StoreLoadAnalysis::goThroughBBsAndAnalyzeThem(Function &func) {
+	// Watchdog against superlinear behavior on adversarial control flow: when
+	// the budget is exceeded, the rest of the analysis of this function is
+	// abandoned and its info is degraded to a conservative approximation in
+	// afterAnalysisBBsInFunc().
+	currFuncBBVisits = 0;
+	currFuncBBVisitBudget = std::max<std::size_t>(BB_VISIT_BUDGET_MIN,
+		BB_VISIT_BUDGET_PER_BB * func.size());
+
 	bbTraversalAnalysis.doBBsAnalysis(func);
 	while (bbTraversalAnalysis.hasSomethingToReturn()) {
+		if (isCurrFuncOverBudget()) {
+			return;
+		}
 		if (bbTraversalAnalysis.isNextInSCC()) {
 			visitBBsInSCC();
 		} else {
@@ -364,6 +401,11 @@ void StoreLoadAnalysis::goThroughBBsAndAnalyzeThem(Function &func) {
 * Makes what is need after analysis basic blocks in function.
 */
 void StoreLoadAnalysis::afterAnalysisBBsInFunc() {
+	if (isCurrFuncOverBudget()) {
+		degradeCurrFuncInfo();
+		return;
+	}
+
 BBInfo *entryBBInfo(getBBInfoFor(currFuncInfo->getFunc().getEntryBlock()));
 	currFuncInfo->setFuncInfo(*entryBBInfo);
 	if (currFuncInfo->funcInfo->emptyLastLUses() &&
@@ -377,12 +419,53 @@ BBInfo *entryBBInfo(getBBInfoFor(currFuncInfo->getFunc().getEntryBlock()));
 	}
 }
 
+/**
+* @brief Returns @c true if the analysis of the current function exceeded its
+*        work budget, otherwise @c false.
+*/
+bool StoreLoadAnalysis::isCurrFuncOverBudget() const {
+	return currFuncBBVisits > currFuncBBVisitBudget;
+}
+
+/**
+* @brief Returns @c true if the analysis of @a func exceeded its work budget
+*        and was degraded to a conservative approximation, otherwise @c false.
+*/
+bool StoreLoadAnalysis::isFuncOverBudget(Function &func) const {
+	return hasItem(funcsOverBudget, &func);
+}
+
+/**
+* @brief Replaces info of the current function with a safe conservative
+*        approximation and marks the function as not analyzed.
+*
+* This is the graceful fallback of the per-function watchdog. The degraded
+* function gets no last left uses and not go through for all analyzed global
+* variables, and stays marked as not analyzed, so callers handle its calls
+* the same conservative way as calls of not yet analyzed functions in
+* recursion (@see processFuncCall()). Nothing in the degraded function is
+* optimized, but the analysis of the rest of the module finishes in bounded
+* time.
+*/
+void StoreLoadAnalysis::degradeCurrFuncInfo() {
+	if (funcsOverBudget.insert(&currFuncInfo->getFunc()).second) {
+		retdec::utils::instrumentation::incrementCounter(
+			"watchdog/store-load-analysis/degraded-funcs");
+	}
+
+	for (GlobalVariable *glob : globsToAnalyze) {
+		currFuncInfo->funcInfo->addNotGoThrough(*glob);
+	}
+
+	currFuncInfo->markAsNotAnalyzed();
+}
+
 /**
 * @brief Analyzes basic blocks that are in SCC.
 */
 void StoreLoadAnalysis::visitBBsInSCC() {
 	spreadNotGoThroughInSCC();
-	while (goThroughBBsSCCAndReturnIfChanged()) {
+	while (!isCurrFuncOverBudget() && goThroughBBsSCCAndReturnIfChanged()) {
 		// Do nothing, just keep iterating.
 	}
 
@@ -449,6 +532,8 @@ bool StoreLoadAnalysis::goThroughBBsSCCAndReturnIfChanged() {
 * @brief Processes one basic block @a bb.
 */
 void StoreLoadAnalysis::processBB(BasicBlock &bb) {
+	++currFuncBBVisits;
+
 	// Init.
 	setCurrBBInfo(bb);
 	bool isBBVisited(currFuncInfo->isBBVisited(bb));
@@ -7,6 +7,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <vector>
 
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
@@ -14,6 +15,7 @@
 #include "retdec/bin2llvmir/optimizations/asm_inst_remover/asm_inst_remover.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/utils/defs.h"
+#include "retdec/bin2llvmir/utils/instruction.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
 
@@ -66,31 +68,33 @@ bool AsmInstructionRemover::run(Module& M)
 
 	changed |= renameTempVariables(M);
 
+	// Collect-then-apply -- gather all marker instructions of a function
+	// first and erase them in one bulk sweep instead of doing per-node IR
+	// surgery while iterating.
+	std::vector<Instruction*> toErase;
 	for (auto& F : M.getFunctionList())
-	for (auto& B : F)
 	{
-		auto it = B.begin();
-		while (it != B.end())
+		toErase.clear();
+		for (auto& B : F)
+		for (auto& I : B)
 		{
-			// We need to move to the next instruction before potentially
-			// removing the current instruction. Otherwise, the iterator
-			// would become invalid.
-			//
-			auto* inst = &(*it);
-			++it;
-
-			if (_config->isLlvmToAsmInstruction(inst))
+			if (_config->isLlvmToAsmInstruction(&I))
 			{
-				AsmInstruction ai(inst);
+				AsmInstruction ai(&I);
 				if (cs_insn* insn = ai.getCapstoneInsn())
 				{
 					cs_free(insn, 1);
 				}
 
-				inst->eraseFromParent();
-				changed = true;
+				toErase.push_back(&I);
 			}
 		}
+
+		if (!toErase.empty())
+		{
+			eraseInstructions(toErase);
+			changed = true;
+		}
 	}
 
 	if (auto* global = _config->getLlvmToAsmGlobalVariable())
@@ -111,6 +115,10 @@ bool AsmInstructionRemover::run(Module& M)
 		nmd->eraseFromParent();
 	}
 
+	// The special instructions are gone -> the address index built over them
+	// must not be used anymore.
+	AsmInstruction::invalidateAddressIndex(&M);
+
 	return changed;
 }
 
@@ -100,17 +100,54 @@ bool CfgFunctionDetection::isArmDataInCode(AsmInstruction& ai)
 	return false;
 }
 
+static retdec::utils::NonIterableSet<std::string> exitFncs =
+{
+	"exit", "_exit", "ExitThread", "abort", "longjmp", "_Exit",
+	"quick_exit", "thrd_exit", "ExitProcess"
+};
+
+/**
+ * @return @c true if the entry basic block of @a f calls one of the known
+ * program-terminating functions. The result is memoized -- the entry block
+ * is inspected once per callee, not on every call site.
+ */
+bool CfgFunctionDetection::isExitWrapper(llvm::Function* f)
+{
+	auto fIt = _exitWrappers.find(f);
+	if (fIt != _exitWrappers.end())
+	{
+		return fIt->second;
+	}
+
+	bool wrapper = false;
+	if (!f->empty())
+	{
+		auto& bb = f->front();
+		for (auto& ii : bb)
+		{
+			auto* cc = dyn_cast<CallInst>(&ii);
+			if (cc && cc->getCalledFunction())
+			{
+				auto* ccf = cc->getCalledFunction();
+				std::string n = ccf->getName();
+				if (exitFncs.has(n))
+				{
+					wrapper = true;
+					break;
+				}
+			}
+		}
+	}
+
+	_exitWrappers[f] = wrapper;
+	return wrapper;
+}
+
 llvm::Instruction* CfgFunctionDetection::isPotentialSplitInstruction(
 		llvm::Instruction* i)
 {
 	Instruction* ret = dyn_cast<TerminatorInst>(i);
 
-	static retdec::utils::NonIterableSet<std::string> exitFncs =
-	{
-		"exit", "_exit", "ExitThread", "abort", "longjmp", "_Exit",
-		"quick_exit", "thrd_exit", "ExitProcess"
-	};
-
 	if (ret == nullptr)
 	{
 		auto* c = dyn_cast<CallInst>(i);
@@ -119,28 +156,10 @@ llvm::Instruction* CfgFunctionDetection::isPotentialSplitInstruction(
 			auto* cf = c->getCalledFunction();
 			std::string n = cf->getName();
 
-			if (exitFncs.has(n))
+			if (exitFncs.has(n) || isExitWrapper(cf))
 			{
 				ret = c;
 			}
-			else if (!cf->empty())
-			{
-				auto& bb = cf->front();
-				for (auto& ii : bb)
-				{
-					auto* cc = dyn_cast<CallInst>(&ii);
-					if (cc && cc->getCalledFunction())
-					{
-						auto* ccf = cc->getCalledFunction();
-						std::string n = ccf->getName();
-						if (exitFncs.has(n))
-						{
-							ret = c;
-							break;
-						}
-					}
-				}
-			}
 		}
 	}
 
@@ -166,9 +185,13 @@ bool CfgFunctionDetection::runOne()
 	std::set<AsmInstruction> newFncs;
 	IrModifier irmodif(_module, _config);
 
+	_exitWrappers.clear();
+
 	for (auto& f : _module->getFunctionList())
 	{
-		if (f.empty())
+		// A function with less than 2 basic blocks can not be split.
+		//
+		if (f.empty() || f.size() < 2)
 		{
 			continue;
 		}
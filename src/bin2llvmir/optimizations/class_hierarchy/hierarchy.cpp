@@ -58,10 +58,10 @@ retdec::config::Class Class::getConfigClass(
 {
 	retdec::config::Class c(name);
 
-	auto* demangler = DemanglerProvider::getDemangler(m);
-	if (demangler)
+	auto demangled = DemanglerProvider::demangleToString(m, name);
+	if (!demangled.empty())
 	{
-		c.setDemangledName(demangler->demangleToString(name));
+		c.setDemangledName(demangled);
 	}
 
 	for (auto* s : superClasses)
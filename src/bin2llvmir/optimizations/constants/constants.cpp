@@ -158,7 +158,7 @@ void ConstantsAnalysis::checkForGlobalInInstruction(
 
 	if (max && maxC)
 	if (userI || max == &root) // TODO: see comment in store
-	if (objf->getImage()->hasDataOnAddress(maxC->getZExtValue()))
+	if (objf->hasDataOnAddress(maxC->getZExtValue()))
 	if (maxC->getZExtValue() != 0)
 	{
 		auto* ngv = getGlobalVariable(
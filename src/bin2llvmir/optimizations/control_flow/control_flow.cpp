@@ -305,6 +305,9 @@ bool ControlFlow::toCondBr()
 
 		if (aiSource.getFunction() != aiTarget.getFunction())
 		{
+			// May become transformable after a later function split --
+			// retry on the next worklist round.
+			_pseudoCallWorklist.push_back(call);
 			continue;
 		}
 
@@ -392,10 +395,12 @@ bool ControlFlow::toSwitch()
 		}
 		if (_config->getLlvmFunction(defaultAi.getAddress()))
 		{
+			_pseudoCallWorklist.push_back(call);
 			continue;
 		}
 		if (aiSource.getFunction() != defaultAi.getFunction())
 		{
+			_pseudoCallWorklist.push_back(call);
 			continue;
 		}
 		bool ok = true;
@@ -415,6 +420,7 @@ bool ControlFlow::toSwitch()
 		}
 		if (!ok)
 		{
+			_pseudoCallWorklist.push_back(call);
 			continue;
 		}
 
@@ -486,30 +492,106 @@ bool ControlFlow::toSwitch()
 
 bool ControlFlow::runGeneric()
 {
+	if (!_pseudoCallsCollected)
+	{
+		collectPseudoCalls();
+		_pseudoCallsCollected = true;
+	}
+
+	// Only the calls that could not be resolved before are reprocessed --
+	// a later run (e.g. after RDA or function splitting) never rescans the
+	// whole module. Calls that stay unresolved, or whose scheduled
+	// transformation had to be skipped, go back on the worklist.
 	bool changed = false;
-	for (auto& f : *_module)
+	std::vector<WeakVH> worklist;
+	worklist.swap(_pseudoCallWorklist);
+	for (auto& vh : worklist)
 	{
-		changed |= runGenericFunction(&f);
+		Value* v = vh;
+		auto* c = dyn_cast_or_null<CallInst>(v);
+		if (c == nullptr)
+		{
+			// Erased by another transformation in the meantime.
+			continue;
+		}
+
+		AsmInstruction ai(c);
+		bool resolved = false;
+		if (_config->isLlvmAnyUncondBranchPseudoFunctionCall(c))
+		{
+			resolved = runGenericBr(ai, c);
+		}
+		else if (_config->isLlvmCondBranchPseudoFunctionCall(c))
+		{
+			resolved = runGenericCondBr(ai, c);
+		}
+		if (!resolved)
+		{
+			_pseudoCallWorklist.push_back(c);
+		}
+		changed |= resolved;
 	}
 	return changed;
 }
 
-bool ControlFlow::runGenericFunction(llvm::Function* f)
+/**
+ * Seed the worklist with all pseudo branch calls -- the one and only full
+ * module scan the generic engine does.
+ */
+void ControlFlow::collectPseudoCalls()
 {
-	bool changed = false;
-	for (auto ai = AsmInstruction(f); ai.isValid(); ai = ai.getNext())
+	for (auto& f : *_module)
+	for (auto ai = AsmInstruction(&f); ai.isValid(); ai = ai.getNext())
 	for (auto& i : ai)
 	{
-		if (auto* c = _config->isLlvmAnyUncondBranchPseudoFunctionCall(&i))
+		if (_config->isLlvmAnyUncondBranchPseudoFunctionCall(&i)
+				|| _config->isLlvmCondBranchPseudoFunctionCall(&i))
+		{
+			_pseudoCallWorklist.push_back(&i);
+		}
+	}
+}
+
+/**
+ * Read the jump table at \p tableAddr from the image, or return its cached
+ * contents if it was read before. The walk is bounded by the segment that
+ * holds the table -- a table never crosses into another segment -- so the
+ * image is not probed entry by entry until a read finally fails.
+ */
+const ControlFlow::JmpTableData& ControlFlow::readJmpTable(
+		retdec::utils::Address tableAddr)
+{
+	auto fIt = _jmpTableCache.find(tableAddr);
+	if (fIt != _jmpTableCache.end())
+	{
+		return fIt->second;
+	}
+
+	JmpTableData& data = _jmpTableCache[tableAddr];
+
+	retdec::utils::Address segEnd;
+	if (auto* seg = _image->getImage()->getSegmentFromAddress(tableAddr))
+	{
+		segEnd = seg->getPhysicalEndAddress();
+	}
+
+	auto a = tableAddr;
+	while (segEnd.isUndefined() || a < segEnd)
+	{
+		auto* ci = _image->getConstantDefault(a);
+		if (ci == nullptr)
 		{
-			changed |= runGenericBr(ai, c);
+			break;
 		}
-		else if (auto* c = _config->isLlvmCondBranchPseudoFunctionCall(&i))
+		if (data.entrySize == 0)
 		{
-			changed |= runGenericCondBr(ai, c);
+			data.entrySize = getTypeByteSizeInBinary(_module, ci->getType());
 		}
+		data.targets.push_back(ci->getZExtValue());
+		a += data.entrySize;
 	}
-	return changed;
+
+	return data;
 }
 
 bool ControlFlow::runGenericBr(AsmInstruction& ai, llvm::CallInst* call)
@@ -857,16 +939,10 @@ bool ControlFlow::runGenericBr(AsmInstruction& ai, llvm::CallInst* call)
 
 			std::vector<AsmInstruction> fullJmpTable;
 			std::vector<std::pair<unsigned, AsmInstruction>> jmpTable;
-			auto tableItemAddr = tableAddr;
 			unsigned cntr = 0;
-			while (true)
+			for (auto target : readJmpTable(tableAddr).targets)
 			{
-				auto* ci = _image->getConstantDefault(tableItemAddr);
-				if (ci == nullptr)
-				{
-					break;
-				}
-				auto targetAi = AsmInstruction(_module, ci->getZExtValue());
+				auto targetAi = AsmInstruction(_module, target);
 				if (targetAi.isInvalid() || targetAi.getFunction() != ai.getFunction())
 				{
 					break;
@@ -888,7 +964,6 @@ bool ControlFlow::runGenericBr(AsmInstruction& ai, llvm::CallInst* call)
 				}
 				LOG << std::endl;
 
-				tableItemAddr += getTypeByteSizeInBinary(_module, ci->getType());
 				++cntr;
 			}
 			if (jmpTable.empty())
@@ -920,7 +995,16 @@ bool ControlFlow::runGenericBr(AsmInstruction& ai, llvm::CallInst* call)
 				// We have to use the original index.
 				idx = cast<Instruction>(idxRoot.ops[0].ops[0].value);
 
-				while (true)
+				// Like in readJmpTable(), bound the walk by the segment
+				// holding the index table.
+				retdec::utils::Address segEnd2;
+				if (auto* seg = _image->getImage()->getSegmentFromAddress(
+						tableAddr2))
+				{
+					segEnd2 = seg->getPhysicalEndAddress();
+				}
+
+				while (segEnd2.isUndefined() || tableAddr2 < segEnd2)
 				{
 					auto* ci = _image->getConstantInt(it, tableAddr2);
 					if (ci == nullptr)
@@ -1129,16 +1213,10 @@ bool ControlFlow::runGenericCondBr(AsmInstruction& ai, llvm::CallInst* call)
 			LOG << "labels:" << std::endl;
 
 			std::vector<std::pair<unsigned, AsmInstruction>> jmpTable;
-			auto tableItemAddr = tableAddr;
 			unsigned cntr = 0;
-			while (true)
+			for (auto target : readJmpTable(tableAddr).targets)
 			{
-				auto* ci = _image->getConstantDefault(tableItemAddr);
-				if (ci == nullptr)
-				{
-					break;
-				}
-				auto targetAi = AsmInstruction(_module, ci->getZExtValue());
+				auto targetAi = AsmInstruction(_module, target);
 				if (targetAi.isInvalid() || targetAi.getFunction() != ai.getFunction())
 				{
 					break;
@@ -1159,7 +1237,6 @@ bool ControlFlow::runGenericCondBr(AsmInstruction& ai, llvm::CallInst* call)
 				}
 				LOG << std::endl;
 
-				tableItemAddr += getTypeByteSizeInBinary(_module, ci->getType());
 				++cntr;
 			}
 			if (jmpTable.empty())
@@ -4,7 +4,11 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
@@ -14,6 +18,7 @@
 #include "retdec/bin2llvmir/optimizations/data_references/data_references.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/utils/defs.h"
+#include "retdec/utils/thread_pool.h"
 
 using namespace retdec::llvm_support;
 using namespace retdec::utils;
@@ -74,32 +79,63 @@ void DataReferences::detectReferencesIntoSegments()
 	LOG << "\n*** detectReferencesIntoSegments():" << std::endl;
 
 	const auto& conf = config->getConfig();
-	for (const auto& seg : objf->getSegments())
+	const auto& segments = objf->getSegments();
+	const auto wordSz = objf->getFileFormat()->getBytesPerWord();
+	const bool armOrThumb = conf.architecture.isArmOrThumb();
+
+	// Build the lazy address -> segment index before the workers start, so
+	// they only ever read it.
+	objf->getImage()->getSegmentFromAddress(0);
+
+	// The scan is data-parallel -- workers pick segments from a shared
+	// counter and collect hits locally; results are merged below in segment
+	// order, so the outcome is the same as a sequential scan.
+	std::vector<std::vector<std::pair<Address, ReferencedObject>>> found(
+			segments.size());
+
+	std::atomic<std::size_t> nextSegment(0);
+	auto worker = [&]()
 	{
-		for (Address a = seg->getAddress();
-				a < seg->getEndAddress();
-				a += objf->getFileFormat()->getBytesPerWord())
+		std::size_t i;
+		while ((i = nextSegment++) < segments.size())
 		{
-			std::uint64_t tmp = 0;
-			if (!objf->getImage()->getWord(a, tmp))
-				continue;
-
-			Address val = tmp;
-			if (conf.architecture.isArmOrThumb() && val % 2)
+			const auto& seg = segments[i];
+			for (Address a = seg->getAddress();
+					a < seg->getEndAddress();
+					a += wordSz)
 			{
-				--val;
+				std::uint64_t tmp = 0;
+				if (!objf->getImage()->getWord(a, tmp))
+					continue;
+
+				Address val = tmp;
+				if (armOrThumb && val % 2)
+				{
+					--val;
+				}
+
+				const Segment* ref =
+						objf->getImage()->getSegmentFromAddress(val);
+				if (ref)
+				{
+					ReferencedObject r(val);
+					r.seg = ref;
+					found[i].emplace_back(a, r);
+				}
 			}
+		}
+	};
 
-			const Segment* ref = objf->getImage()->getSegmentFromAddress(val);
-			if (ref)
-			{
-				ReferencedObject r(val);
-				r.seg = ref;
-				addr2obj.insert( {a, r} );
+	runWorkers(segments.size(), worker);
 
-				LOG << a << " @ " << seg->getName() << " -> "
-				    << val << " @ " << ref->getName() << "\n";
-			}
+	for (std::size_t i = 0; i < segments.size(); ++i)
+	{
+		for (auto& p : found[i])
+		{
+			addr2obj.insert(p);
+
+			LOG << p.first << " @ " << segments[i]->getName() << " -> "
+			    << p.second.addr << " @ " << p.second.seg->getName() << "\n";
 		}
 	}
 }
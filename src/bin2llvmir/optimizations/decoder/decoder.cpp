@@ -9,7 +9,9 @@
 
 #include <llvm/IR/InstIterator.h>
 
+#include "retdec/crypto/crypto.h"
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/instrumentation.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder.h"
 #include "retdec/bin2llvmir/utils/defs.h"
@@ -27,6 +29,23 @@ namespace bin2llvmir {
 
 char Decoder::ID = 0;
 
+/**
+ * Statically linked functions that must keep their decoded bodies -- main
+ * detection inspects them to locate the real main function.
+ */
+static const std::set<std::string>& getProtectedLinkedFunctionNames()
+{
+	static std::set<std::string> protectedLinked = {
+			"__CrtSetReportHookW2",
+			"_CrtSetCheckCount",
+			"InterlockedExchange",
+			"___tmainCRTStartup",
+			"_WinMainCRTStartup",
+			"WinMainCRTStartup",
+	};
+	return protectedLinked;
+}
+
 static RegisterPass<Decoder> X(
 		"decoder",
 		"Input binary to LLVM IR decoding",
@@ -106,6 +125,7 @@ bool Decoder::run()
 	LOG << _jumpTargets << std::endl;
 	LOG << std::endl;
 
+	preDecodeJumpTargets();
 	doDecoding();
 	checkIfSomethingDecoded();
 
@@ -114,6 +134,8 @@ bool Decoder::run()
 	removeStaticallyLinkedFunctions();
 	hackDeleteKnownLinkedFunctions();
 
+	computeFunctionHashes();
+
 //dumpModuleToFile(_module);
 
 	fixMipsDelaySlots();
@@ -150,7 +172,12 @@ void Decoder::initRangesAndTargets()
 		initAllowedRangesWithConfig();
 	}
 
-	if (!_config->getConfig().parameters.isSelectedDecodeOnly())
+	// When the selection is authoritative, only the selected parts (and the
+	// code reachable from them) are decoded -- everything else stays a
+	// declaration and the later passes do not have to process and then throw
+	// away its body.
+	if (!_config->getConfig().parameters.isSelectedDecodeOnly()
+			&& !isSelectionAuthoritative())
 	{
 		initAllowedRangesWithSegments();
 	}
@@ -176,6 +203,18 @@ void Decoder::initRangesAndTargets()
 		}
 	}
 
+	// The selected ranges are about to be walked through -- first by the zero
+	// sequence removal right below and then by the decoding itself -- so let
+	// the OS start reading them into memory already.
+	for (auto& r : _allowedRanges)
+	{
+		_image->getImage()->prefetchDataOnAddress(r.getStart(), r.getSize());
+	}
+	for (auto& r : _alternativeRanges)
+	{
+		_image->getImage()->prefetchDataOnAddress(r.getStart(), r.getSize());
+	}
+
 	removeZeroSequences(_allowedRanges);
 	removeZeroSequences(_alternativeRanges);
 }
@@ -418,12 +457,6 @@ void Decoder::initAllowedRangesWithConfig()
 
 	std::set<std::string> foundFs;
 
-	if (!_config->getConfig().parameters.isSelectedDecodeOnly())
-	{
-		LOG << "\tnot selected decode only -> skipped" << std::endl;
-		return;
-	}
-
 	for (auto &p : _config->getConfig().parameters.selectedRanges)
 	{
 		LOG << "\tadd selected range @ " << p << std::endl;
@@ -579,6 +612,25 @@ void Decoder::initAllowedRangesWithConfig()
 	}
 }
 
+/**
+ * Is the user selection (selected functions/ranges) authoritative for
+ * decoding?
+ *
+ * It is when something is selected and every selected function was resolved
+ * to an address -- then decoding can be restricted to the selection right
+ * away. When a selected name could not be resolved (e.g. a stripped binary
+ * where functions get their names only after function detection), the full
+ * decode is kept as a fallback so the name can still be matched later.
+ *
+ * @return @c True if decoding can be restricted to the selection.
+ */
+bool Decoder::isSelectionAuthoritative() const
+{
+	return _config->getConfig().parameters.isSomethingSelected()
+			&& _config->getConfig().parameters.selectedNotFoundFunctions.empty()
+			&& !_allowedRanges.empty();
+}
+
 void Decoder::initJumpTargets()
 {
 	LOG << "\n initJumpTargets():" << std::endl;
@@ -586,8 +638,22 @@ void Decoder::initJumpTargets()
 	auto m = _currentMode;
 	auto bsz = _config->getConfig().architecture.getByteSize();
 
+	// In lazy-decoding mode, only targets that are certain to be wanted
+	// (config functions, entry point, imports, exports, selected ranges)
+	// are seeded. Speculative targets -- section starts, code pointers
+	// found in data, symbols -- are left out and the code behind them is
+	// decoded on demand via decodeOnDemand().
+	// An authoritative selection implies the same -- speculative targets
+	// would fall outside the selected ranges anyway, so seeding them would
+	// only burn time in the decoding loop.
+	//
+	bool lazy = _config->getConfig().parameters.isLazyDecoding()
+			|| isSelectionAuthoritative();
+
 	// Sections/segments.
 	//
+if (!lazy)
+{
 	LOG << "\tSections:" << std::endl;
 	for (auto& s : _image->getSegments())
 	{
@@ -795,6 +861,7 @@ void Decoder::initJumpTargets()
 			}
 		}
 	}
+} // !lazy
 
 	// Config.
 	// TODO: If object file is decompiled, these functions are probably off.
@@ -853,6 +920,8 @@ void Decoder::initJumpTargets()
 
 	// Symbols.
 	//
+if (!lazy)
+{
 	LOG << "\tSymbols:" << std::endl;
 	for (const auto* t : _image->getFileFormat()->getSymbolTables())
 	for (const auto& s : *t)
@@ -889,6 +958,7 @@ void Decoder::initJumpTargets()
 			_jumpTargets.push(_config, addr, JumpTarget::eType::SYMBOL_FUNCTION, m, name);
 		}
 	}
+} // !lazy
 
 	// Exports.
 	//
@@ -1003,7 +1073,7 @@ void Decoder::initJumpTargets()
 	// Debug.
 	//
 	LOG << "\tDebug:" << std::endl;
-	if (_debug)
+	if (_debug && !lazy)
 	{
 		for (const auto& p : _debug->functions)
 		{
@@ -1035,6 +1105,43 @@ void Decoder::initJumpTargets()
 	//
 }
 
+/**
+ * Decode code at address @a a that was not decoded in the main decoding run.
+ *
+ * The address is pushed into the (already drained) worklist as a selected
+ * target and the decoding loop is run again -- control-flow targets
+ * discovered from @a a are decoded transitively, addresses that were already
+ * processed (or already failed) are skipped by the worklist bookkeeping.
+ *
+ * @param a    Address to decode.
+ * @param name Optional name for the function created at @a a.
+ * @return @c True if the address is decoded (now, or was already before),
+ *         @c false otherwise.
+ */
+bool Decoder::decodeOnDemand(retdec::utils::Address a, const std::string& name)
+{
+	if (_module == nullptr || _c2l == nullptr || a.isUndefined())
+	{
+		return false;
+	}
+	if (_processedRanges.contains(a))
+	{
+		return true;
+	}
+
+	LOG << "\n decodeOnDemand() @ " << a << std::endl;
+
+	_jumpTargets.push(
+			_config,
+			a,
+			JumpTarget::eType::SELECTED_RANGE_START,
+			_currentMode,
+			name);
+	doDecoding();
+
+	return _processedRanges.contains(a);
+}
+
 void Decoder::doDecoding()
 {
 	LOG << "\n doDecoding()" << std::endl;
@@ -1170,6 +1277,13 @@ if (_config->getConfig().architecture.isArmOrThumb())
 			continue;
 		}
 
+		if (_undecodableTargets.count(jt.address))
+		{
+			LOG << "\t\tpre-decode stage found no decodable instruction "
+					"-> skipped" << std::endl;
+			continue;
+		}
+
 		// It is not safe to use these pointers when static code is not decoded.
 		//
 		if (jt.type == JumpTarget::eType::CODE_POINTER_FROM_OTHER)
@@ -1179,6 +1293,31 @@ if (_config->getConfig().architecture.isArmOrThumb())
 			continue;
 		}
 
+		// Detected statically linked functions are presented as known
+		// body-less functions -- decoding and translating their bodies would
+		// only feed instructions into all later analyses for nothing. Their
+		// whole detected range is marked processed, so no other target
+		// decodes into it. The declaration and config flagging happen in the
+		// common function post-processing below.
+		//
+		if (jt.type == JumpTarget::eType::STATICALLY_LINKED_FUNCTION
+				&& !_config->getConfig().parameters.isStaticCodeDecoding()
+				&& getProtectedLinkedFunctionNames().count(jt.getName()) == 0)
+		{
+			auto scIt = _staticCode.find(jt.address);
+			if (scIt != _staticCode.end())
+			{
+				auto& r = scIt->second.second;
+				LOG << "\t\tstatically linked function "
+						<< scIt->second.first
+						<< " -> body not decoded : " << r << std::endl;
+				_processedRanges.insert(r);
+				_allowedRanges.remove(r);
+				_alternativeRanges.remove(r);
+				continue;
+			}
+		}
+
 		Address start = jt.address;
 		bool inAlternativeRanges = false;
 		auto* range = _allowedRanges.getRange(start);
@@ -1321,7 +1460,8 @@ LOG << "===========> SWITCH MODE #2 " << _currentMode << " -> " << jt.mode << st
 	}
 }
 
-		auto tRes = _c2l->translate(code, start, irb, true);
+		auto bRes = _c2l->translateBlock(code, start, irb, 0, true);
+		auto& tRes = bRes.block;
 		if (tRes.failed())
 		{
 			LOG << "\t\ttranslation failed" << std::endl;
@@ -1340,6 +1480,8 @@ LOG << "===========> SWITCH MODE #2 " << _currentMode << " -> " << jt.mode << st
 		LOG << "\t\tbranch call: " << llvmObjToString(termCall) << std::endl;
 
 		_processedRanges.insert(tRange);
+		retdec::utils::instrumentation::incrementCounter(
+				"decoder/translated-bytes", tRes.size);
 		if (inAlternativeRanges)
 		{
 			_alternativeRanges.remove(tRange);
@@ -1360,9 +1502,9 @@ LOG << "===========> SWITCH MODE #2 " << _currentMode << " -> " << jt.mode << st
 		// Right now we analyze only push instruction, but there might be more.
 		//
 		if (_config->getConfig().architecture.isX86())
-		for (auto ai = first; ; ai = ai.getNext())
+		for (auto& iRes : bRes.instructions)
 		{
-			cs_insn* capstoneI = ai.getCapstoneInsn();
+			cs_insn* capstoneI = iRes.second;
 			cs_x86* xi = &capstoneI->detail->x86;
 			Address imm;
 			if (capstoneI->id == X86_INS_PUSH
@@ -1386,15 +1528,11 @@ LOG << "===========> SWITCH MODE #2 " << _currentMode << " -> " << jt.mode << st
 						JumpTarget::eType::CODE_POINTER_FROM_DATA,
 						_currentMode);
 
-				LOG << "\t\tpush code pointer @ " << ai.getAddress()
+				LOG << "\t\tpush code pointer @ "
+						<< Address(capstoneI->address)
 						<< " -> " << std::hex << imm
 						<< std::endl;
 			}
-
-			if (ai == last)
-			{
-				break;
-			}
 		}
 
 		if (_config->isMipsOrPic32())
@@ -1608,6 +1746,12 @@ if (_c2l->hasDelaySlot(lastCs->id))
 {
 	_jumpTargets.push(_config, next, JumpTarget::eType::DELAY_SLOT, _currentMode);
 }
+else if (tRes.delaySlots)
+{
+	// The slot was translated within the run -> continue right after it,
+	// the same way processing of a DELAY_SLOT target would.
+	_jumpTargets.push(_config, next, JumpTarget::eType::CONTROL_FLOW, _currentMode);
+}
 else if (tRes.inCondition)
 {
 	_jumpTargets.push(_config, next, JumpTarget::eType::CONTROL_FLOW, _currentMode);
@@ -1644,6 +1788,12 @@ if (_c2l->hasDelaySlot(lastCs->id))
 {
 	_jumpTargets.push(_config, next, JumpTarget::eType::DELAY_SLOT, _currentMode);
 }
+else if (tRes.delaySlots)
+{
+	// The slot was translated within the run -> continue right after it,
+	// the same way processing of a DELAY_SLOT target would.
+	_jumpTargets.push(_config, next, JumpTarget::eType::CONTROL_FLOW, _currentMode);
+}
 else if (tRes.inCondition)
 {
 	_jumpTargets.push(_config, next, JumpTarget::eType::CONTROL_FLOW, _currentMode);
@@ -1702,12 +1852,27 @@ else if ((_config->getConfig().architecture.isPpc() || isArmOrThumb())
 	LOG << "\nAlternative ranges:" << std::endl;
 	LOG << _alternativeRanges << std::endl;
 
+	// Both this map and the sources of extra function information below are
+	// sorted by address, so instead of probing them for every function, the
+	// sorted sequences are merged in one pass.
+	auto staticIt = _staticCode.begin();
+	auto debugIt = _debug->functions.begin();
+
 	for (auto& p : functions)
 	{
 		Address a = p.first;
 		Function* f = p.second.first;
 		JumpTarget::eType t = p.second.second;
 
+		while (staticIt != _staticCode.end() && staticIt->first < a)
+		{
+			++staticIt;
+		}
+		while (debugIt != _debug->functions.end() && debugIt->first < a)
+		{
+			++debugIt;
+		}
+
 		if (t == JumpTarget::eType::SECTION_START
 				&& f->user_empty()
 				&& &f->front().front() == &f->back().back())
@@ -1776,8 +1941,7 @@ else if ((_config->getConfig().architecture.isPpc() || isArmOrThumb())
 			// remove their bodies.
 			if (!_config->getConfig().parameters.isSomethingSelected())
 			{
-				auto slIt = _staticCode.find(a);
-				if (slIt != _staticCode.end())
+				if (staticIt != _staticCode.end() && staticIt->first == a)
 				{
 					cf->setIsStaticallyLinked();
 				}
@@ -1816,16 +1980,14 @@ else if ((_config->getConfig().architecture.isPpc() || isArmOrThumb())
 			}
 		}
 
-		auto slIt = _staticCode.find(a);
-		if (slIt != _staticCode.end())
+		if (staticIt != _staticCode.end() && staticIt->first == a)
 		{
 			cf->setIsStaticallyLinked();
 		}
 
-		auto dfIt = _debug->functions.find(a);
-		if (dfIt != _debug->functions.end())
+		if (debugIt != _debug->functions.end() && debugIt->first == a)
 		{
-			auto& df = dfIt->second;
+			auto& df = debugIt->second;
 			cf->setIsFromDebug(true);
 			cf->setStartLine(df.getStartLine());
 			cf->setEndLine(df.getEndLine());
@@ -1840,6 +2002,54 @@ else if ((_config->getConfig().architecture.isPpc() || isArmOrThumb())
 	}
 }
 
+/**
+ * Compute content hashes of all decoded functions and store them into their
+ * config entries.
+ *
+ * In the incremental mode (@c config::Parameters::isIncremental()), the new
+ * hashes are also compared with the hashes recorded in the input config:
+ * names of changed and new user-defined functions are put into the selected
+ * functions set, so the existing selection machinery prunes the unchanged
+ * ones before the expensive analyses run and the user can reuse their old
+ * outputs.
+ */
+void Decoder::computeFunctionHashes()
+{
+	bool incremental = _config->getConfig().parameters.isIncremental();
+
+	for (auto& p : _config->getConfig().functions)
+	{
+		retdec::config::Function& cf = p.second;
+		if (cf.getStart().isUndefined()
+				|| cf.getEnd().isUndefined()
+				|| cf.getStart() > cf.getEnd())
+		{
+			continue;
+		}
+
+		auto data = _image->getImage()->getRawSegmentData(cf.getStart());
+		if (data.first == nullptr || data.second == 0)
+		{
+			continue;
+		}
+
+		auto size = std::min<std::uint64_t>(
+				data.second,
+				cf.getEnd() + 1 - cf.getStart());
+
+		std::string oldHash = cf.getContentHash();
+		cf.setContentHash(retdec::crypto::getCrc32(data.first, size));
+
+		if (incremental
+				&& cf.isUserDefined()
+				&& cf.getContentHash() != oldHash)
+		{
+			_config->getConfig().parameters.selectedFunctions.insert(
+					cf.getName());
+		}
+	}
+}
+
 // Operand is pointer to allowed ranges, but it does not have
 // to point to code. Right now, we check that there is
 // "push ebp" at the target location.
@@ -2016,15 +2226,19 @@ bool Decoder::looksLikeValidJumpTarget(retdec::utils::Address addr)
 	return false;
 }
 
-bool Decoder::initTranslator()
+/**
+ * Compute the Capstone architecture and basic mode for the module's
+ * architecture from config.
+ * @return @c true if the architecture is known, @c false otherwise. Output
+ *         parameters are set to defaults (@c CS_ARCH_ALL,
+ *         @c CS_MODE_LITTLE_ENDIAN) when the architecture is unknown.
+ */
+bool Decoder::getCapstoneArchBasicMode(cs_arch& arch, cs_mode& basicMode) const
 {
 	auto& a = _config->getConfig().architecture;
 
-	cs_arch arch = CS_ARCH_ALL;
-	cs_mode basicMode = CS_MODE_LITTLE_ENDIAN;
-	cs_mode extraMode = a.isEndianBig()
-			? CS_MODE_BIG_ENDIAN
-			: CS_MODE_LITTLE_ENDIAN;
+	arch = CS_ARCH_ALL;
+	basicMode = CS_MODE_LITTLE_ENDIAN;
 
 	if (a.isX86())
 	{
@@ -2082,6 +2296,21 @@ bool Decoder::initTranslator()
 		basicMode = CS_MODE_ARM;
 	}
 
+	return arch != CS_ARCH_ALL;
+}
+
+bool Decoder::initTranslator()
+{
+	auto& a = _config->getConfig().architecture;
+
+	cs_arch arch = CS_ARCH_ALL;
+	cs_mode basicMode = CS_MODE_LITTLE_ENDIAN;
+	cs_mode extraMode = a.isEndianBig()
+			? CS_MODE_BIG_ENDIAN
+			: CS_MODE_LITTLE_ENDIAN;
+
+	getCapstoneArchBasicMode(arch, basicMode);
+
 	_c2l = Capstone2LlvmIrTranslator::createArch(
 			arch,
 			_module,
@@ -2285,17 +2514,9 @@ void Decoder::removeStaticallyLinkedFunctions()
 	// Merge control flow pass with decoding and move main detection right after it
 	// so that all statically linked functions may be removed as soon as possible.
 	//
-	std::set<std::string> protectedLinked = {
-			"__CrtSetReportHookW2",
-			"_CrtSetCheckCount",
-			"InterlockedExchange",
-			"___tmainCRTStartup",
-			"_WinMainCRTStartup",
-			"WinMainCRTStartup",
-	};
 	for (Function& f : _module->functions())
 	{
-		if (protectedLinked.count(f.getName()))
+		if (getProtectedLinkedFunctionNames().count(f.getName()))
 		{
 			continue;
 		}
@@ -0,0 +1,174 @@
+/**
+* @file src/bin2llvmir/optimizations/decoder/parallel_pre_decode.cpp
+* @brief Parallel pre-decode (scout) stage run before the main decoding loop.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include "retdec/bin2llvmir/optimizations/decoder/decoder.h"
+#include "retdec/bin2llvmir/utils/defs.h"
+#include "retdec/utils/thread_pool.h"
+#define debug_enabled false
+#include "retdec/llvm-support/utils.h"
+
+using namespace retdec::llvm_support;
+using namespace retdec::utils;
+
+namespace {
+
+/**
+ * One unit of work for a scout thread -- bytes of a single jump target that
+ * should be checked for decodability.
+ */
+struct ScoutJob
+{
+	retdec::utils::Address address;
+	std::vector<std::uint8_t> code;
+	bool undecodable = false;
+};
+
+} // anonymous namespace
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Disassemble function-entry jump targets in parallel before the main
+ * (sequential) decoding loop runs.
+ *
+ * The main loop emits instructions into a single LLVM module, which is not
+ * thread-safe, so the actual translation cannot be distributed. What can be
+ * distributed is the disassembly itself -- every worker thread gets its own
+ * Capstone handle and checks whether the bytes at each jump target decode to
+ * at least one valid instruction. Targets that do not are recorded in
+ * @c _undecodableTargets and skipped by the main loop, which would otherwise
+ * pay for a full (failing) translation attempt on each of them.
+ *
+ * ARM/Thumb binaries are not scouted -- the decoding mode of a target may
+ * depend on the instructions decoded around it, which is only known during
+ * the sequential decoding.
+ */
+void Decoder::preDecodeJumpTargets()
+{
+	if (isArmOrThumb())
+	{
+		return;
+	}
+
+	cs_arch arch;
+	cs_mode basicMode;
+	if (!getCapstoneArchBasicMode(arch, basicMode))
+	{
+		return;
+	}
+	cs_mode mode = basicMode;
+	if (_config->getConfig().architecture.isEndianBig())
+	{
+		mode = static_cast<cs_mode>(mode + CS_MODE_BIG_ENDIAN);
+	}
+
+	// Bytes are read sequentially -- the underlying image is shared and its
+	// accessors are not guaranteed to be thread-safe. Only the disassembly
+	// below runs in parallel.
+	//
+	std::vector<ScoutJob> jobs;
+	for (const JumpTarget& jt : _jumpTargets)
+	{
+		if (jt.type == JumpTarget::eType::CODE_POINTER_FROM_OTHER)
+		{
+			continue;
+		}
+		if (jt.isKnownMode() && jt.mode != basicMode)
+		{
+			continue;
+		}
+
+		Address start = jt.address;
+		auto* range = _allowedRanges.getRange(start);
+		if (range == nullptr)
+		{
+			range = _alternativeRanges.getRange(start);
+		}
+		if (range == nullptr)
+		{
+			continue;
+		}
+
+		std::size_t size = decodingChunk;
+		if (start + size > range->getEnd())
+		{
+			size = range->getEnd() - start + 1;
+		}
+
+		ScoutJob job;
+		job.address = start;
+		std::vector<std::uint64_t> tmp;
+		_image->getImage()->get1ByteArray(start, tmp, size);
+		std::copy(tmp.begin(), tmp.end(), std::back_inserter(job.code));
+		jobs.push_back(std::move(job));
+	}
+
+	if (jobs.empty())
+	{
+		return;
+	}
+
+	std::atomic<std::size_t> next(0);
+
+	auto worker = [&]()
+	{
+		csh handle;
+		if (cs_open(arch, mode, &handle) != CS_ERR_OK)
+		{
+			return;
+		}
+
+		std::size_t i;
+		while ((i = next++) < jobs.size())
+		{
+			ScoutJob& job = jobs[i];
+			if (job.code.empty())
+			{
+				job.undecodable = true;
+				continue;
+			}
+
+			cs_insn* insn = nullptr;
+			std::size_t c = cs_disasm(
+					handle,
+					job.code.data(),
+					job.code.size(),
+					job.address,
+					1,
+					&insn);
+			if (c == 0)
+			{
+				job.undecodable = true;
+			}
+			if (insn)
+			{
+				cs_free(insn, c);
+			}
+		}
+
+		cs_close(&handle);
+	};
+
+	runWorkers(jobs.size(), worker);
+
+	for (const ScoutJob& job : jobs)
+	{
+		if (job.undecodable)
+		{
+			LOG << "\tpre-decode: undecodable target @ " << job.address
+					<< std::endl;
+			_undecodableTargets.insert(job.address);
+		}
+	}
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -348,10 +348,9 @@ void Decoder::doStaticCodeRecognition()
 	}
 
 	Finder codeFinder;
-	for (const auto &path : sigPaths)
-	{
-		codeFinder.search(*_image->getImage(), path);
-	}
+	codeFinder.search(
+			*_image->getImage(),
+			std::vector<std::string>(sigPaths.begin(), sigPaths.end()));
 
 	LOG << "\n" << "Detected functions:" << std::endl;
 
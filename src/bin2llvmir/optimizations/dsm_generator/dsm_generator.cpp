@@ -10,6 +10,7 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
@@ -87,7 +88,12 @@ bool DsmGenerator::runOnModule(Module& m)
 		dsmOut = out.substr(0, out.find_last_of('.')) + ".dsm";
 	}
 
-	std::ofstream outFile(dsmOut, std::ofstream::out);
+	// Use a big stream buffer -- listings can have hundreds of MB and the
+	// default buffer would flush to disk far too often.
+	std::vector<char> outBuf(1 << 16);
+	std::ofstream outFile;
+	outFile.rdbuf()->pubsetbuf(outBuf.data(), outBuf.size());
+	outFile.open(dsmOut, std::ofstream::out);
 	assert(outFile.is_open() && "Error in opening output dsm file");
 	if (!outFile.is_open())
 	{
@@ -280,9 +286,21 @@ void DsmGenerator::generateFunction(
 	}
 }
 
-void DsmGenerator::getAsmInstructionHex(AsmInstruction& ai, std::ostream& ret)
+/**
+ * Append the two hex digits of @a byte to @a str. Table-driven replacement
+ * for the stream manipulator dance -- this runs for every byte of every
+ * instruction and data line.
+ */
+void DsmGenerator::appendHexByte(std::string& str, std::uint8_t byte)
 {
-	static std::size_t longestHexa = _longestInst * 3 - 1;
+	static const char digits[] = "0123456789abcdef";
+	str += digits[byte >> 4];
+	str += digits[byte & 0xf];
+}
+
+void DsmGenerator::getAsmInstructionHex(AsmInstruction& ai, std::string& ret)
+{
+	const std::size_t longestHexa = _longestInst * 3 - 1;
 	const std::size_t aiHexa = ai.getByteSize() * 3 - 1;
 
 	std::vector<std::uint64_t> bytes;
@@ -290,30 +308,34 @@ void DsmGenerator::getAsmInstructionHex(AsmInstruction& ai, std::ostream& ret)
 	{
 		for (size_t i = 0; i < bytes.size(); ++i)
 		{
-			ret << (i == 0 ? "" : " ") << std::setw(2) << std::setfill('0')
-					<< std::hex << bytes[i];
+			if (i != 0)
+			{
+				ret += ' ';
+			}
+			appendHexByte(ret, bytes[i]);
 		}
 	}
 	else
 	{
 		for (size_t i = 0; i < ai.getByteSize(); ++i)
 		{
-			ret << (i == 0 ? "??" : " ??");
+			ret += (i == 0 ? "??" : " ??");
 		}
 	}
 
-	const auto diff = longestHexa - aiHexa;
-	for (size_t i = 0; i < diff; ++i)
-	{
-		ret << ' ';
-	}
+	ret.append(longestHexa - aiHexa, ' ');
 }
 
 void DsmGenerator::generateInstruction(AsmInstruction& ai, std::ostream& ret)
 {
-	generateAlignedAddress(ai.getAddress(), ret);
-	getAsmInstructionHex(ai, ret);
-	ret << ALIGN << INSTR_SEPARATOR << processInstructionDsm(ai) << "\n";
+	_line.clear();
+	generateAlignedAddress(ai.getAddress(), _line);
+	getAsmInstructionHex(ai, _line);
+	_line += ALIGN;
+	_line += INSTR_SEPARATOR;
+	_line += processInstructionDsm(ai);
+	_line += '\n';
+	ret << _line;
 }
 
 std::string DsmGenerator::processInstructionDsm(AsmInstruction& ai)
@@ -504,7 +526,8 @@ void DsmGenerator::generateData(
 	{
 		std::string ascii = "|";
 
-		generateAlignedAddress(Address(start + off), ret);
+		_line.clear();
+		generateAlignedAddress(Address(start + off), _line);
 
 		for (std::size_t off1 = 0; off1 < DATA_SEGMENT_LINE; ++off1)
 		{
@@ -514,42 +537,45 @@ void DsmGenerator::generateData(
 				if (_objf->getImage()->get1Byte(start + off + off1, val))
 				{
 					unsigned char c = val;
-					ret << std::setw(2) << std::setfill('0') << std::hex << val;
+					appendHexByte(_line, c);
 					ascii += std::isprint(c) ? c : '.';
 				}
 				else
 				{
-					ret << "??";
+					_line += "??";
 					ascii += "?";
 				}
 			}
 			else
 			{
-				ret << "  ";
+				_line += "  ";
 				ascii += " ";
 			}
 
 			if (off1 == 7)
 			{
-				ret << " ";
+				_line += ' ';
 			}
 
 			if (off1+1 < DATA_SEGMENT_LINE)
 			{
-				ret << " ";
+				_line += ' ';
 			}
 		}
 
 		ascii += "|";
 
-		ret << ALIGN << ascii;
+		_line += ALIGN;
+		_line += ascii;
 
 		if (off == 0 && !objVal.empty())
 		{
-			ret << ALIGN << objVal;
+			_line += ALIGN;
+			_line += objVal;
 		}
 
-		ret << "\n";
+		_line += '\n';
+		ret << _line;
 
 		off += DATA_SEGMENT_LINE;
 	}
@@ -635,17 +661,16 @@ std::string DsmGenerator::reduceNegativeNumbers(const std::string& str)
 
 void DsmGenerator::generateAlignedAddress(
 		retdec::utils::Address addr,
-		std::ostream& ret)
+		std::string& ret)
 {
 	auto as = addr.toHexPrefixString();
+	ret += as;
+	ret += ':';
 	if (_longestAddr > as.size())
 	{
-		ret << as << ":" << std::string(_longestAddr - as.size(), ' ') << ALIGN;
-	}
-	else
-	{
-		ret << as << ":" << ALIGN;
+		ret.append(_longestAddr - as.size(), ' ');
 	}
+	ret += ALIGN;
 }
 
 void DsmGenerator::findLongestAddress()
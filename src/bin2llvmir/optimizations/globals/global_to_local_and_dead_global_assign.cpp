@@ -299,6 +299,8 @@ bool GlobalToLocalAndDeadGlobalAssign::runOnModule(Module &module) {
 
 	solveIndirectCallsAndNotAggressive();
 
+	filterUsesInFuncsOverBudget(module, globsToOptimize);
+
 	filterUsesThatCannotBeOptimized();
 
 	doOptimization(module, globsToOptimize);
@@ -448,6 +450,43 @@ void GlobalToLocalAndDeadGlobalAssign::goThroughLastLUsesAndSolveIndirectCalls(
 	}
 }
 
+/**
+* @brief Filters all uses of analyzed global variables in functions whose
+*        store load analysis exceeded its work budget.
+*
+* Info for such functions is only a conservative approximation, so nothing
+* in them can be safely optimized.
+*
+* @param[in] module Module with functions to go through.
+* @param[in] globs Global variables that are optimized.
+*/
+void GlobalToLocalAndDeadGlobalAssign::filterUsesInFuncsOverBudget(
+		Module &module, const GlobVarSet &globs) {
+	for (Function &func : module) {
+		if (!storeLoadAnalysis.isFuncOverBudget(func)) {
+			continue;
+		}
+
+		for (BasicBlock &bb : func) {
+			for (Instruction &inst : bb) {
+				if (StoreInst *store = dyn_cast<StoreInst>(&inst)) {
+					auto *glob = dyn_cast<GlobalVariable>(
+						store->getPointerOperand());
+					if (glob && hasItem(globs, glob)) {
+						addFilteredLUse(*store);
+					}
+				} else if (LoadInst *load = dyn_cast<LoadInst>(&inst)) {
+					auto *glob = dyn_cast<GlobalVariable>(
+						load->getPointerOperand());
+					if (glob && hasItem(globs, glob)) {
+						rUsesNotToOptimize.insert(load);
+					}
+				}
+			}
+		}
+	}
+}
+
 /**
 * @brief Filter in contained info instructions that can't be optimized.
 */
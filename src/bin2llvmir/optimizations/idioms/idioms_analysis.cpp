@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/bin2llvmir/optimizations/idioms/idioms_analysis.h"
 
 using namespace llvm;
@@ -62,6 +64,96 @@ bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsA
 	return change_made;
 }
 
+/**
+ * Analyse given BasicBlock and use instruction exchanger to transform
+ * instruction idioms, dispatching only on instructions whose opcode matches
+ * the root of the idiom.
+ *
+ * @param bb BasicBlock to analyse
+ * @param exchanger instruction idiom exchanger
+ * @param fname instruction idiom exchanger name (for debug purpose only)
+ * @param rootOpcode opcode of the root instruction of the idiom
+ */
+bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname, unsigned rootOpcode) {
+	OpcodeIndex & index = getOpcodeIndex(bb);
+	OpcodeIndex::iterator fIt = index.find(rootOpcode);
+	if (fIt == index.end() || fIt->second.empty())
+		return false;
+
+	// Take a snapshot -- exchangers may erase instructions from the basic
+	// block, which would invalidate iteration over the live bucket.
+	std::vector<Instruction*> candidates = fIt->second;
+
+	bool change_made = false;
+
+	for (Instruction * candidate : candidates) {
+		if (change_made) {
+			// An exchange might have erased this candidate -- consult the
+			// rebuilt index and skip candidates which are gone.
+			OpcodeIndex & current = getOpcodeIndex(bb);
+			OpcodeIndex::iterator cIt = current.find(rootOpcode);
+			if (cIt == current.end()
+					|| std::find(cIt->second.begin(), cIt->second.end(),
+							candidate) == cIt->second.end())
+				continue;
+		}
+
+		BasicBlock::iterator insn = candidate->getIterator();
+
+		// call exchanger on candidate instructions only
+		Instruction * res = (this->*exchanger)(insn);
+
+		if (res) {
+			++NumIdioms;
+
+			change_made = true;
+
+			(*insn).replaceAllUsesWith(res);
+			print_dbg(fname, *insn);
+
+			// Move the name to the new instruction first.
+			res->takeName(&*insn);
+
+			// Insert the new instruction into the basic block...
+			BasicBlock * InstParent = (*insn).getParent();
+
+			// If we replace a PHI with something that isn't a PHI,
+			// fix up the insertion point.
+			if (! isa<PHINode>(res) && isa<PHINode>(insn))
+				insn = InstParent->getFirstInsertionPt();
+
+			InstParent->getInstList().insert(insn, res);
+
+			(*insn).eraseFromParent();
+
+			invalidateOpcodeIndex(bb);
+		}
+	}
+
+	return change_made;
+}
+
+/**
+ * Get (build if missing or invalidated) the opcode index of @a bb.
+ */
+IdiomsAnalysis::OpcodeIndex & IdiomsAnalysis::getOpcodeIndex(llvm::BasicBlock & bb) {
+	auto fIt = _bbIndex.find(&bb);
+	if (fIt != _bbIndex.end())
+		return fIt->second;
+
+	OpcodeIndex & index = _bbIndex[&bb];
+	for (Instruction & i : bb)
+		index[i.getOpcode()].push_back(&i);
+	return index;
+}
+
+/**
+ * Throw away the opcode index of @a bb -- called after @a bb was changed.
+ */
+void IdiomsAnalysis::invalidateOpcodeIndex(llvm::BasicBlock & bb) {
+	_bbIndex.erase(&bb);
+}
+
 /**
  * Do instruction idioms analysis pass
  *
@@ -80,6 +172,9 @@ bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
 	 */
 	bool change_made = false; // was there any exchange?
 
+	// Indices of previously analysed functions are of no use any more.
+	_bbIndex.clear();
+
 	CC_compiler cc = getCompiler();
 	CC_arch arch = getArch();
 
@@ -95,182 +190,222 @@ bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
 		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
 				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod1,
-											"IdiomsMagicDivMod::signedMod1");
+									"IdiomsMagicDivMod::signedMod1",
+									Instruction::Add);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod2,
-											"IdiomsMagicDivMod::signedMod2");
+									"IdiomsMagicDivMod::signedMod2",
+									Instruction::Add);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv2,
-											"IdiomsMagicDivMod::magicUnsignedDiv2");
+									"IdiomsMagicDivMod::magicUnsignedDiv2",
+									Instruction::LShr);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv1,
-											"IdiomsMagicDivMod::magicUnsignedDiv1");
+									"IdiomsMagicDivMod::magicUnsignedDiv1",
+									Instruction::Trunc);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv1,
-											"IdiomsMagicDivMod::magicSignedDiv1");
+									"IdiomsMagicDivMod::magicSignedDiv1",
+									Instruction::Sub);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv2,
-											"IdiomsMagicDivMod::magicSignedDiv2");
+									"IdiomsMagicDivMod::magicSignedDiv2",
+									Instruction::Sub);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv3,
-											"IdiomsMagicDivMod::magicSignedDiv3");
+									"IdiomsMagicDivMod::magicSignedDiv3",
+									Instruction::Sub);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv4,
-											"IdiomsMagicDivMod::magicSignedDiv4");
+									"IdiomsMagicDivMod::magicSignedDiv4",
+									Instruction::Sub);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv5,
-											"IdiomsMagicDivMod::magicSignedDiv5");
+									"IdiomsMagicDivMod::magicSignedDiv5",
+									Instruction::Sub);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv6,
-											"IdiomsMagicDivMod::magicSignedDiv6");
+									"IdiomsMagicDivMod::magicSignedDiv6",
+									Instruction::Sub);
 
 				// Found in PowerPC - div 10
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7pos,
-											"IdiomsMagicDivMod::magicSignedDiv7pos");
+									"IdiomsMagicDivMod::magicSignedDiv7pos",
+									Instruction::Sub);
 
 				// Found in PowerPC - the same as previous, but the divisor
 				// is negative, i.e. div -10
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7neg,
-											"IdiomsMagicDivMod::magicSignedDiv7neg");
+									"IdiomsMagicDivMod::magicSignedDiv7neg",
+									Instruction::Sub);
 
 				// Found in PowerPC - div 6
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8pos,
-											"IdiomsMagicDivMod::magicSignedDiv8pos");
+									"IdiomsMagicDivMod::magicSignedDiv8pos",
+									Instruction::Sub);
 
 				// Found in PowerPC - the same as previous, but the divisor
 				// is negative, i.e. div -3
 				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8neg,
-											"IdiomsMagicDivMod::magicSignedDiv8neg");
+									"IdiomsMagicDivMod::magicSignedDiv8neg",
+									Instruction::Sub);
 
 				change_made |= analyse(bb, &IdiomsMagicDivMod::unsignedMod,
-											"IdiomsMagicDivMod::unsignedMod");
+									"IdiomsMagicDivMod::unsignedMod",
+									Instruction::Sub);
 		}
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeSignedModuloByTwo,
-										"IdiomsGCC::exchangeSignedModuloByTwo");
+									"IdiomsGCC::exchangeSignedModuloByTwo",
+									Instruction::Sub);
 
 		// PowerPC model lacks FPU and x86 uses x87.
 		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsGCC::exchangeCopysign,
-											"IdiomsGCC::exchangeCopysign");
+									"IdiomsGCC::exchangeCopysign",
+									Instruction::Or);
 
 		// PowerPC model lacks FPU and x86 uses x87.
 		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatAbs,
-											"IdiomsGCC::exchangeFloatAbs");
+									"IdiomsGCC::exchangeFloatAbs",
+									Instruction::And);
 
 		if (arch == ARCH_x86 || arch == ARCH_ANY)
 			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsVStudio::exchangeOrMinusOneAssign,
-											"IdiomsVStudio::exchangeOrMinusOneAssign");
+									"IdiomsVStudio::exchangeOrMinusOneAssign",
+									Instruction::Or);
 
 		if (arch == ARCH_x86 || arch == ARCH_ANY)
 			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsVStudio::exchangeAndZeroAssign,
-										"IdiomsVStudio::exchangeAndZeroAssign");
+									"IdiomsVStudio::exchangeAndZeroAssign",
+									Instruction::And);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv1,
-										"IdiomsGCC::exchangeCondBitShiftDiv1");
+									"IdiomsGCC::exchangeCondBitShiftDiv1",
+									Instruction::AShr);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv2,
-										"IdiomsGCC::exchangeCondBitShiftDiv2");
+									"IdiomsGCC::exchangeCondBitShiftDiv2",
+									Instruction::Sub);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv3,
-										"IdiomsGCC::exchangeCondBitShiftDiv3");
+									"IdiomsGCC::exchangeCondBitShiftDiv3",
+									Instruction::Sub);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeSignedModulo2n,
-										"IdiomsCommon::exchangeSignedModulo2n");
+									"IdiomsCommon::exchangeSignedModulo2n",
+									Instruction::Sub);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeGreaterEqualZero,
-										"IdiomsCommon::exchangeGreaterEqualZero");
+									"IdiomsCommon::exchangeGreaterEqualZero",
+									Instruction::Xor);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsGCC::exchangeXorMinusOne,
-										"IdiomsGCC::exchangeXorMinusOne");
+									"IdiomsGCC::exchangeXorMinusOne",
+									Instruction::Xor);
 
 		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 			if (cc == CC_GCC || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsCommon::exchangeDivByMinusTwo,
-											"IdiomsCommon::exchangeDivByMinusTwo");
+									"IdiomsCommon::exchangeDivByMinusTwo",
+									Instruction::Sub);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeLessThanZero,
-										"IdiomsCommon::exchangeLessThanZero");
+									"IdiomsCommon::exchangeLessThanZero",
+									Instruction::LShr);
 
 		// PowerPC model lacks FPU and x86 uses x87.
 		if (cc == CC_GCC || cc == CC_ANY)
 			if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
 				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatNeg,
-											"IdiomsGCC::exchangeFloatNeg");
+									"IdiomsGCC::exchangeFloatNeg",
+									Instruction::Xor);
 
 		// all arch
 		if (cc == CC_GCC || cc == CC_ANY)
 			change_made |= analyse(bb, &IdiomsCommon::exchangeUnsignedModulo2n,
-										"IdiomsCommon::exchangeUnsignedModulo2n");
+									"IdiomsCommon::exchangeUnsignedModulo2n",
+									Instruction::And);
 
 		// all arch
 		if (cc == CC_LLVM || cc == CC_ANY)
 				change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-											"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+									"IdiomsLLVM::exchangeIsGreaterThanMinusOne",
+									Instruction::ICmp);
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv1,
-									"IdiomsCommon::exchangeBitShiftSDiv1");
+									"IdiomsCommon::exchangeBitShiftSDiv1",
+									Instruction::Or);
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv2,
-									"IdiomsCommon::exchangeBitShiftSDiv2");
+									"IdiomsCommon::exchangeBitShiftSDiv2",
+									Instruction::AShr);
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftUDiv,
-									"IdiomsCommon::exchangeBitShiftUDiv");
+									"IdiomsCommon::exchangeBitShiftUDiv",
+									Instruction::LShr);
 
 		// all arch
 		// all compilers
 		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftMul,
-									"IdiomsCommon::exchangeBitShiftMul");
+									"IdiomsCommon::exchangeBitShiftMul",
+									Instruction::Shl);
 
 		// all arch
 		if (cc == CC_LLVM || cc == CC_ANY) {
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-										"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
+									"IdiomsLLVM::exchangeIsGreaterThanMinusOne",
+									Instruction::ICmp);
 		}
 
 		// all arch
 		if (cc == CC_LLVM || cc == CC_ANY) {
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareEq,
-										"IdiomsLLVM::exchangeCompareEq");
+									"IdiomsLLVM::exchangeCompareEq",
+									Instruction::Xor);
 
 	#if 0
 			/* We do not recognize this well */
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareNeq,
-										"IdiomsLLVM::exchangeCompareNeq");
+									"IdiomsLLVM::exchangeCompareNeq",
+									Instruction::Xor);
 	#endif
 
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSlt,
-										"IdiomsLLVM::exchangeCompareSlt");
+									"IdiomsLLVM::exchangeCompareSlt",
+									Instruction::And);
 
 			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSle,
-									"IdiomsLLVM::exchangeCompareSle");
+									"IdiomsLLVM::exchangeCompareSle",
+									Instruction::Or);
 		}
 	}
 
@@ -1455,6 +1455,8 @@ bool IdiomsLibgcc::runOnModule(Module& M)
 		return false;
 	}
 
+	bucketCalledFunctions();
+
 	bool changed = handleInstructions();
 
 	if (_impl->isSomethingToLocalize())
@@ -1491,6 +1493,30 @@ bool IdiomsLibgcc::runOnModule(Module& M)
 	return changed;
 }
 
+/**
+ * Match every function of the current module against @c _fnc2action in one
+ * pass and remember the first matching action for it. The hot call-scanning
+ * loop in @c handleInstruction() then does a single pointer-keyed lookup per
+ * call instead of searching the whole table for every call instruction.
+ */
+void IdiomsLibgcc::bucketCalledFunctions()
+{
+	_calledFnc2action.clear();
+
+	for (auto& fnc : _module->getFunctionList())
+	{
+		std::string name = fnc.getName();
+		for (auto& p : _fnc2action)
+		{
+			if (contains(name, p.first))
+			{
+				_calledFnc2action.emplace(&fnc, &p.second);
+				break;
+			}
+		}
+	}
+}
+
 bool IdiomsLibgcc::handleInstructions()
 {
 	bool changed = false;
@@ -1521,18 +1547,14 @@ bool IdiomsLibgcc::handleInstruction(llvm::Instruction* inst)
 		return false;
 	}
 
-	std::string calledFnc = call->getCalledFunction()->getName();
-
-	for (auto& p : _fnc2action)
+	auto fIt = _calledFnc2action.find(call->getCalledFunction());
+	if (fIt == _calledFnc2action.end())
 	{
-		if (contains(calledFnc, p.first))
-		{
-			p.second(call);
-			return true;
-		}
+		return false;
 	}
 
-	return false;
+	(*fIt->second)(call);
+	return true;
 }
 
 } // namespace bin2llvmir
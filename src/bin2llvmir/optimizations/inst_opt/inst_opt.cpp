@@ -22,6 +22,7 @@
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
+#include "retdec/bin2llvmir/utils/peephole.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/utils/type.h"
@@ -96,64 +97,49 @@ void InstOpt::removeInstructionNames()
 	}
 }
 
-bool InstOpt::runGeneralOpts()
+/**
+ * Rewrites a binary operation on two loads of the same register generated
+ * for a single assembly instruction:
+ * <tt>xor x, x -> 0</tt>, <tt>or/and x, x -> x</tt>.
+ */
+static bool optBinOpOnSameRegister(llvm::Instruction* i)
 {
-	bool changed = false;
-
-	for (auto& F : _module->getFunctionList())
+	auto* op0 = dyn_cast<LoadInst>(i->getOperand(0));
+	auto* op1 = dyn_cast<LoadInst>(i->getOperand(1));
+	if (!(op0 && op1 && op0 != op1
+			&& op0->getPointerOperand() == op1->getPointerOperand()))
 	{
-		for (auto ai = AsmInstruction(&F); ai.isValid(); ai = ai.getNext())
-		{
-			std::set<Instruction*> toErase;
-
-			for (auto& i : ai)
-			{
-				if (!isa<BinaryOperator>(i))
-				{
-					continue;
-				}
-
-				auto* op0 = dyn_cast<LoadInst>(i.getOperand(0));
-				auto* op1 = dyn_cast<LoadInst>(i.getOperand(1));
-				if (!(op0 && op1 && op0->getPointerOperand() == op1->getPointerOperand()))
-				{
-					continue;
-				}
-				AsmInstruction op0Asm(op0);
-				AsmInstruction op1Asm(op1);
-				if ((op0Asm != op1Asm) || (op0Asm != ai))
-				{
-					continue;
-				}
-
-				if (i.getOpcode() == Instruction::Xor)
-				{
-					i.replaceAllUsesWith(ConstantInt::get(i.getType(), 0));
-					toErase.insert(&i);
-					op1->replaceAllUsesWith(op0);
-					toErase.insert(op1);
-					changed = true;
-				}
-				else if (i.getOpcode() == Instruction::Or
-						|| i.getOpcode() == Instruction::And)
-				{
-					i.replaceAllUsesWith(op0);
-					toErase.insert(&i);
-					op1->replaceAllUsesWith(op0);
-					toErase.insert(op1);
-					changed = true;
-				}
-			}
+		return false;
+	}
+	AsmInstruction iAsm(i);
+	AsmInstruction op0Asm(op0);
+	AsmInstruction op1Asm(op1);
+	if (iAsm.isValid() == false || (op0Asm != op1Asm) || (op0Asm != iAsm))
+	{
+		return false;
+	}
 
-			for (auto* i : toErase)
-			{
-				i->eraseFromParent();
-				changed = true;
-			}
-		}
+	if (i->getOpcode() == Instruction::Xor)
+	{
+		i->replaceAllUsesWith(ConstantInt::get(i->getType(), 0));
+	}
+	else
+	{
+		i->replaceAllUsesWith(op0);
 	}
+	i->eraseFromParent();
+	op1->replaceAllUsesWith(op0);
+	op1->eraseFromParent();
+	return true;
+}
 
-	return changed;
+bool InstOpt::runGeneralOpts()
+{
+	PeepholeEngine engine;
+	engine.addRule(Instruction::Xor, &optBinOpOnSameRegister);
+	engine.addRule(Instruction::Or, &optBinOpOnSameRegister);
+	engine.addRule(Instruction::And, &optBinOpOnSameRegister);
+	return engine.runOnModule(*_module);
 }
 
 bool InstOpt::fixX86RepAnalysis()
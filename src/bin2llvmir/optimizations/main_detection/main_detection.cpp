@@ -23,6 +23,34 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+namespace {
+
+/**
+ * Known positions of the call to @c main in MSVC entry point stubs.
+ *
+ * Entries are tried in order and the first one whose version matches the
+ * detected tool is used -- an empty version matches any MSVC. Offsets are
+ * relative to the entry point, @c wrapperProbes enables the fallback probes
+ * around @c _CrtSetCheckCount and @c InterlockedExchange.
+ */
+struct MsvcMainStub
+{
+	const char* version;
+	std::vector<int> epOffsets;
+	bool wrapperProbes;
+};
+
+const std::vector<MsvcMainStub> msvcMainStubs =
+{
+	{"8.0", {-0x14e}, true},
+	{"9.0", {}, true},
+	{"10.0", {-0x5b, -0x126}, true},
+	{"11.0", {-0x82, -0xC8}, false},
+	{"", {}, true},
+};
+
+} // anonymous namespace
+
 char MainDetection::ID = 0;
 
 static RegisterPass<MainDetection> X(
@@ -179,6 +207,14 @@ retdec::utils::Address MainDetection::getFromContext()
 
 	for (auto& ci : tools)
 	{
+		// The first tool whose probe succeeds wins -- do not let the probes
+		// of the remaining (less likely) tools run, or even overwrite the
+		// result.
+		if (mainAddr.isDefined())
+		{
+			break;
+		}
+
 		int major = ci.getMajorVersion();
 		int minor = ci.getMinorVersion();
 
@@ -208,71 +244,34 @@ retdec::utils::Address MainDetection::getFromContext()
 					}
 				}
 			}
-			else if (ci.isMsvc("8.0"))
-			{
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromEntryPointOffset(-0x14e);
-				}
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromCrtSetCheckCount();
-				}
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromInterlockedExchange();
-				}
-			}
-			else if (ci.isMsvc("9.0"))
-			{
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromCrtSetCheckCount();
-				}
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromInterlockedExchange();
-				}
-			}
-			else if (ci.isMsvc("10.0"))
-			{
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromEntryPointOffset(-0x5b);
-				}
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromEntryPointOffset(-0x126);
-				}
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromCrtSetCheckCount();
-				}
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromInterlockedExchange();
-				}
-			}
-			else if (ci.isMsvc("11.0"))
-			{
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromEntryPointOffset(-0x82);
-				}
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromEntryPointOffset(-0xC8);
-				}
-			}
 			else if (ci.isMsvc())
 			{
-				if (mainAddr.isUndefined())
-				{
-					mainAddr = getFromCrtSetCheckCount();
-				}
-				if (mainAddr.isUndefined())
+				for (const auto& stub : msvcMainStubs)
 				{
-					mainAddr = getFromInterlockedExchange();
+					if (stub.version[0] && !ci.isMsvc(stub.version))
+					{
+						continue;
+					}
+
+					for (int offset : stub.epOffsets)
+					{
+						if (mainAddr.isUndefined())
+						{
+							mainAddr = getFromEntryPointOffset(offset);
+						}
+					}
+					if (stub.wrapperProbes)
+					{
+						if (mainAddr.isUndefined())
+						{
+							mainAddr = getFromCrtSetCheckCount();
+						}
+						if (mainAddr.isUndefined())
+						{
+							mainAddr = getFromInterlockedExchange();
+						}
+					}
+					break;
 				}
 			}
 		}
@@ -4,7 +4,10 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <llvm/ADT/SCCIterator.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/Analysis/CallGraph.h>
+#include <llvm/IR/CFG.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/Transforms/Utils/BasicBlockUtils.h>
@@ -171,6 +174,7 @@ char NeverReturningFuncs::ID = 0;
 
 const char *NeverReturningFuncs::NAME = OPTIMIZATION_NAME;
 StringVecFuncMap NeverReturningFuncs::funcNeverReturnsMap;
+FuncSet NeverReturningFuncs::funcNeverReturnsSummaries;
 
 RegisterPass<NeverReturningFuncs> NeverReturningFuncsRegistered(
 	NeverReturningFuncs::getName(), "Never-returning-functions optimization",
@@ -313,14 +317,90 @@ void NeverReturningFuncs::deinitFuncNeverReturnsMap() {
 	}
 }
 
+/**
+* @brief Computes, bottom-up over callgraph SCCs, which functions with bodies
+*        can never return.
+*
+* A function never returns when no return instruction is reachable from its
+* entry block -- reachability is cut behind calls to functions already known
+* to never return, either declarations from @c funcNeverReturnsMap or
+* summaries of callees computed earlier. SCCs are visited callees-first and
+* iterated to a fixed point, so one pass over the callgraph is enough.
+*/
+void NeverReturningFuncs::buildNeverReturnsSummaries() {
+	funcNeverReturnsSummaries.clear();
+
+	CallGraph cg(*module);
+	for (auto i = scc_begin(&cg), e = scc_end(&cg); i != e; ++i) {
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			for (CallGraphNode *node : *i) {
+				Function *func = node->getFunction();
+				if (!func || func->isDeclaration() ||
+						funcNeverReturnsSummaries.count(func)) {
+					continue;
+				}
+				if (computeNeverReturnsSummary(func)) {
+					funcNeverReturnsSummaries.insert(func);
+					changed = true;
+				}
+			}
+		}
+	}
+}
+
+/**
+* @brief Returns @c true if no return instruction is reachable from the entry
+*        block of function @a func, otherwise @c false.
+*/
+bool NeverReturningFuncs::computeNeverReturnsSummary(Function *func) {
+	BBSet visited{&func->getEntryBlock()};
+	BBVec worklist{&func->getEntryBlock()};
+
+	while (!worklist.empty()) {
+		BasicBlock *bb = worklist.back();
+		worklist.pop_back();
+
+		// A call to a function that never returns cuts the rest of the block
+		// and its successors off.
+		bool cut = false;
+		for (Instruction &inst : *bb) {
+			if (CallInst *call = dyn_cast<CallInst>(&inst)) {
+				if (neverReturns(call->getCalledFunction())) {
+					cut = true;
+					break;
+				}
+			}
+		}
+		if (cut) {
+			continue;
+		}
+
+		if (isa<ReturnInst>(bb->getTerminator())) {
+			return false;
+		}
+
+		for (auto s = succ_begin(bb), e = succ_end(bb); s != e; ++s) {
+			if (visited.insert(*s).second) {
+				worklist.push_back(*s);
+			}
+		}
+	}
+
+	return true;
+}
+
 bool NeverReturningFuncs::doInitialization(llvm::Module &module) {
 	this->module = &module;
 	initFuncNeverReturnsMap();
+	buildNeverReturnsSummaries();
 	return true;
 }
 
 bool NeverReturningFuncs::doFinalization(llvm::Module &module) {
 	deinitFuncNeverReturnsMap();
+	funcNeverReturnsSummaries.clear();
 	return true;
 }
 
@@ -390,8 +470,9 @@ bool NeverReturningFuncs::neverReturns(const Function *func) {
 	}
 
 	if (!func->isDeclaration()) {
-		// We consider only functions that don't have definitions.
-		return false;
+		// Functions with bodies have bottom-up computed summaries -- this
+		// catches e.g. statically linked exit() implementations.
+		return funcNeverReturnsSummaries.count(func) != 0;
 	}
 
 	auto it(funcNeverReturnsMap.find(func->getName()));
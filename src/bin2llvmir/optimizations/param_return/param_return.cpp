@@ -35,6 +35,7 @@
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/utils/type.h"
+#include "retdec/bin2llvmir/providers/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 
@@ -285,50 +286,57 @@ bool registerCanBeParameterAccordingToAbi(Config* _config, llvm::Value* val)
 		return true;
 	}
 
-	if (_config->getConfig().architecture.isX86())
+	const char* const* names = nullptr;
+	std::size_t count = 0;
+	if (!Abi::getParameterRegisterNames(
+			_config->getConfig().architecture,
+			names,
+			count))
 	{
-		return false;
-	}
-	else if (_config->getConfig().architecture.isPpc())
-	{
-		static std::set<std::string> names = {"r3", "r4", "r5", "r6", "r7", "r8", "r9"};
-		if (names.find(val->getName()) == names.end())
-		{
-			return false;
-		}
+		return true;
 	}
-	else if (_config->getConfig().architecture.isArmOrThumb())
+
+	auto name = val->getName();
+	for (std::size_t i = 0; i < count; ++i)
 	{
-		static std::set<std::string> names = {"r0", "r1", "r2", "r3"};
-		if (names.find(val->getName()) == names.end())
+		if (name == names[i])
 		{
-			return false;
+			return true;
 		}
 	}
-	else if (_config->getConfig().architecture.isMipsOrPic32())
+	return false;
+}
+
+/**
+ * Memoized variant of @c registerCanBeParameterAccordingToAbi() -- the ABI
+ * verdict for a value is computed once per callee and reused across all its
+ * call sites.
+ */
+bool DataFlowEntry::registerCanBeParameter(llvm::Value* val)
+{
+	auto fIt = _regParamVerdicts.find(val);
+	if (fIt != _regParamVerdicts.end())
 	{
-		static std::set<std::string> names = {"a0", "a1", "a2", "a3"};
-		if (names.find(val->getName()) == names.end())
-		{
-			return false;
-		}
+		return fIt->second;
 	}
 
-	return true;
+	bool v = registerCanBeParameterAccordingToAbi(_config, val);
+	_regParamVerdicts.emplace(val, v);
+	return v;
 }
 
 /**
  * Remove all registers that are not used to pass argument according to ABI.
  */
-void CallEntry::filterRegisters(Config* _config)
+void DataFlowEntry::filterRegisters(CallEntry& ce)
 {
-	auto it = possibleArgStores.begin();
-	while (it != possibleArgStores.end())
+	auto it = ce.possibleArgStores.begin();
+	while (it != ce.possibleArgStores.end())
 	{
 		auto* op = (*it)->getPointerOperand();
-		if (!registerCanBeParameterAccordingToAbi(_config, op))
+		if (!registerCanBeParameter(op))
 		{
-			it = possibleArgStores.erase(it);
+			it = ce.possibleArgStores.erase(it);
 		}
 		else
 		{
@@ -343,7 +351,7 @@ void DataFlowEntry::filterRegistersArgLoads()
 	while (it != argLoads.end())
 	{
 		auto* op = (*it)->getPointerOperand();
-		if (!registerCanBeParameterAccordingToAbi(_config, op))
+		if (!registerCanBeParameter(op))
 		{
 			it = argLoads.erase(it);
 		}
@@ -1000,7 +1008,7 @@ void DataFlowEntry::filter()
 
 	for (CallEntry& e : calls)
 	{
-		e.filterRegisters(_config);
+		filterRegisters(e);
 		e.filterSort(_config);
 		e.filterLeaveOnlyContinuousStackOffsets(_config);
 		e.filterLeaveOnlyNeededStackOffsets(_config);
@@ -12,6 +12,7 @@
 
 #include "retdec/bin2llvmir/optimizations/phi2seq/phi2seq.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/utils/instruction.h"
 
 using namespace llvm;
 
@@ -325,14 +326,12 @@ void PHI2Seq::updatePredecessorsInPHINodes(BasicBlock &bb, BasicBlock &oldBB,
 */
 void PHI2Seq::orderDependentPHINodes(BasicBlock &bb, const VarDependAnalysis::
 		PHINodeVec &nonCyclesDependResult) {
-	auto &instrList(bb.getInstList());
-
-	// Ordering PHI nodes. Uses results of analysis.
-	for (auto ri = nonCyclesDependResult.rbegin(),
-			re = nonCyclesDependResult.rend(); ri != re; ++ri) {
-		(*ri)->removeFromParent();
-		instrList.push_front(*ri);
-	}
+	// Ordering PHI nodes. Uses results of analysis. The nodes are spliced to
+	// the front of the block in one batch -- they never leave the block, so
+	// no per-node ownership maintenance takes place.
+	std::vector<Instruction*> ordered(nonCyclesDependResult.begin(),
+		nonCyclesDependResult.end());
+	moveInstructionsToFront(&bb, ordered);
 }
 
 } // namespace bin2llvmir
@@ -0,0 +1,253 @@
+/**
+* @file src/bin2llvmir/optimizations/register/register_localization.cpp
+* @brief Localize register global variables early with a linear scan.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <map>
+#include <vector>
+
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+
+#include "retdec/bin2llvmir/optimizations/register/register_localization.h"
+
+using namespace llvm;
+
+namespace {
+
+const std::string SUFFIX_OF_LOC = ".reg-localized";
+
+/**
+* Records in config that local variable @a localVarName created in @a func
+* holds the register @a globalVarName, so the backend can name it properly.
+*/
+void addMappingOfLocalVarToRegisterInConfig(
+		retdec::bin2llvmir::Config* config,
+		const llvm::Function* func,
+		const std::string& localVarName,
+		const std::string& globalVarName)
+{
+	if (!config)
+	{
+		return;
+	}
+	auto f = config->getConfigFunction(func);
+	if (!f)
+	{
+		return;
+	}
+
+	retdec::config::Object localVar(
+			localVarName,
+			retdec::config::Storage::inRegister(globalVarName));
+	f->locals.insert(localVar);
+}
+
+} // anonymous namespace
+
+namespace retdec {
+namespace bin2llvmir {
+
+char RegisterLocalization::ID = 0;
+
+static RegisterPass<RegisterLocalization> X(
+		"register-localization",
+		"Register localization optimization",
+		false, // Only looks at CFG
+		false // Analysis Pass
+);
+
+RegisterLocalization::RegisterLocalization() :
+		ModulePass(ID)
+{
+
+}
+
+bool RegisterLocalization::runOnModule(llvm::Module& m)
+{
+	_module = &m;
+	_config = ConfigProvider::getConfig(_module);
+	return run();
+}
+
+bool RegisterLocalization::runOnModuleCustom(
+		llvm::Module& m,
+		Config* c)
+{
+	_module = &m;
+	_config = c;
+	return run();
+}
+
+bool RegisterLocalization::run()
+{
+	if (_config == nullptr)
+	{
+		return false;
+	}
+
+	std::set<GlobalVariable*> regs;
+	for (GlobalVariable& gv : _module->globals())
+	{
+		if (canBeLocalized(gv))
+		{
+			regs.insert(&gv);
+		}
+	}
+	if (regs.empty())
+	{
+		return false;
+	}
+
+	bool changed = false;
+	for (Function& f : *_module)
+	{
+		if (f.isDeclaration())
+		{
+			continue;
+		}
+		changed |= localizeInFunction(f, regs);
+	}
+	return changed;
+}
+
+/**
+* @return @c True if @a gv is a register global variable whose every use in
+* the module is an ordinary (non-volatile) direct load or store, @c false
+* otherwise. Only such registers can be localized without changing semantics.
+*/
+bool RegisterLocalization::canBeLocalized(llvm::GlobalVariable& gv) const
+{
+	if (!_config->isRegister(&gv))
+	{
+		return false;
+	}
+	if (!gv.getType()->getPointerElementType()->isSingleValueType())
+	{
+		return false;
+	}
+	for (auto* u : gv.users())
+	{
+		if (auto* l = dyn_cast<LoadInst>(u))
+		{
+			if (l->isVolatile())
+			{
+				return false;
+			}
+		}
+		else if (auto* s = dyn_cast<StoreInst>(u))
+		{
+			if (s->getPointerOperand() != &gv || s->isVolatile())
+			{
+				return false;
+			}
+		}
+		else
+		{
+			// Address taken, constant expression, etc.
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* Localizes every register from @a regs that @a f accesses.
+*
+* One linear scan collects, in instruction order, the register accesses,
+* the calls, and the returns. Each accessed register then gets a local
+* variable that is filled from the global on entry, takes over all interior
+* loads and stores, and is synchronized with the global around every
+* non-intrinsic call and before every return -- so any register state the
+* callers and callees observe stays exactly as it was.
+*
+* @return @c True if @a f was modified, @c false otherwise.
+*/
+bool RegisterLocalization::localizeInFunction(
+		llvm::Function& f,
+		const std::set<llvm::GlobalVariable*>& regs)
+{
+	std::map<GlobalVariable*, std::vector<Instruction*>> accesses;
+	std::vector<CallInst*> calls;
+	std::vector<ReturnInst*> rets;
+
+	for (auto it = inst_begin(&f), eIt = inst_end(&f); it != eIt; ++it)
+	{
+		Instruction& i = *it;
+		if (auto* l = dyn_cast<LoadInst>(&i))
+		{
+			auto* g = dyn_cast<GlobalVariable>(l->getPointerOperand());
+			if (g && regs.count(g))
+			{
+				accesses[g].push_back(l);
+			}
+		}
+		else if (auto* s = dyn_cast<StoreInst>(&i))
+		{
+			auto* g = dyn_cast<GlobalVariable>(s->getPointerOperand());
+			if (g && regs.count(g))
+			{
+				accesses[g].push_back(s);
+			}
+		}
+		else if (auto* c = dyn_cast<CallInst>(&i))
+		{
+			// Intrinsics can not touch registers -- localized registers
+			// never have their address taken (see canBeLocalized()).
+			if (!isa<IntrinsicInst>(c))
+			{
+				calls.push_back(c);
+			}
+		}
+		else if (auto* r = dyn_cast<ReturnInst>(&i))
+		{
+			rets.push_back(r);
+		}
+	}
+	if (accesses.empty())
+	{
+		return false;
+	}
+
+	Instruction* entry = &f.getEntryBlock().front();
+	for (auto& p : accesses)
+	{
+		GlobalVariable* reg = p.first;
+		auto* t = reg->getType()->getPointerElementType();
+		std::string name = reg->getName().str() + SUFFIX_OF_LOC;
+
+		auto* local = new AllocaInst(t, name, entry);
+		auto* fill = new LoadInst(reg, "", entry);
+		new StoreInst(fill, local, entry);
+
+		for (Instruction* a : p.second)
+		{
+			a->replaceUsesOfWith(reg, local);
+		}
+
+		for (CallInst* c : calls)
+		{
+			new StoreInst(new LoadInst(local, "", c), reg, c);
+			// A call never terminates a basic block -- there is always
+			// a next instruction to reload before.
+			auto* next = c->getNextNode();
+			new StoreInst(new LoadInst(reg, "", next), local, next);
+		}
+		for (ReturnInst* r : rets)
+		{
+			new StoreInst(new LoadInst(local, "", r), reg, r);
+		}
+
+		addMappingOfLocalVarToRegisterInConfig(
+				_config,
+				&f,
+				name,
+				reg->getName());
+	}
+	return true;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -91,6 +91,7 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 		RDA.runOnModule(M, config);
 		buildEqSets(M);
 		buildEquations();
+		mergeEqSets();
 		eqSets.propagate(module);
 		eqSets.apply(module, config, objf, instToErase);
 		eraseObsoleteInstructions();
@@ -336,7 +337,9 @@ void SimpleTypesAnalysis::processRoot(Value* root)
 		toProcess.push(root);
 		processValue(toProcess, eqSet);
 
-		if (eqSet.valSet.size() <= 1 && eqSet.typeSet.size() <= 1 && eqSet.equationSet.size() <= 1)
+		if (eqSet.valSet.size() <= 1 && eqSet.typeSet.size() <= 1
+				&& eqSet.equationSet.size() <= 1
+				&& _ufParent.count(&eqSet) == 0)
 		{
 			eqSets.eqSets.pop_back();
 		}
@@ -361,8 +364,16 @@ void SimpleTypesAnalysis::processValue(std::queue<Value*>& toProcess, EqSet& eqS
 		auto current = toProcess.front();
 		toProcess.pop();
 
-		if (processedObjs.find(current) != processedObjs.end())
+		auto pIt = processedObjs.find(current);
+		if (pIt != processedObjs.end())
 		{
+			// The value is connected to this set, but was already placed
+			// into another one -> the two sets have to have the same type.
+			// Record the merge; it is applied in one batch later.
+			if (pIt->second != &eqSet)
+			{
+				unionEqSets(pIt->second, &eqSet);
+			}
 			continue;
 		}
 
@@ -704,6 +715,125 @@ void SimpleTypesAnalysis::buildEquations()
 	}
 }
 
+/**
+ * @return Representative of the union-find class that @a s belongs to.
+ *         Paths to the representative are compressed along the way.
+ */
+EqSet* SimpleTypesAnalysis::findEqSetRepresentative(EqSet* s)
+{
+	auto it = _ufParent.find(s);
+	if (it == _ufParent.end() || it->second == s)
+	{
+		return s;
+	}
+	EqSet* root = findEqSetRepresentative(it->second);
+	it->second = root;
+	return root;
+}
+
+/**
+ * Record that sets @a a and @a b have to be merged (union by rank).
+ */
+void SimpleTypesAnalysis::unionEqSets(EqSet* a, EqSet* b)
+{
+	a = findEqSetRepresentative(a);
+	b = findEqSetRepresentative(b);
+	if (a == b)
+	{
+		return;
+	}
+
+	unsigned ra = _ufRank[a];
+	unsigned rb = _ufRank[b];
+	if (ra < rb)
+	{
+		std::swap(a, b);
+	}
+
+	_ufParent[a] = a;
+	_ufParent[b] = a;
+	if (ra == rb)
+	{
+		_ufRank[a] = ra + 1;
+	}
+}
+
+/**
+ * Apply all the merges recorded by unionEqSets() in one batch: move members
+ * of every non-representative set into its representative, remap equation
+ * targets to representatives, and drop the emptied sets. Doing this once,
+ * after the whole module was traversed, avoids the repeated content moves
+ * that made incremental merging quadratic on large modules.
+ */
+void SimpleTypesAnalysis::mergeEqSets()
+{
+	if (_ufParent.empty())
+	{
+		return;
+	}
+
+	LOG << "\nmergeEqSets():" << std::endl;
+
+	for (auto& eq : eqSets.eqSets)
+	{
+		EqSet* rep = findEqSetRepresentative(&eq);
+		if (rep == &eq)
+		{
+			continue;
+		}
+
+		LOG << "\tmerge #" << eq.id << " -> #" << rep->id << std::endl;
+
+		rep->valSet.insert(eq.valSet.begin(), eq.valSet.end());
+		rep->typeSet.insert(eq.typeSet.begin(), eq.typeSet.end());
+		rep->equationSet.insert(eq.equationSet.begin(), eq.equationSet.end());
+		eq.valSet.clear();
+		eq.typeSet.clear();
+		eq.equationSet.clear();
+	}
+
+	// Equations may point to sets that were merged away -> remap them to
+	// the representatives. Self-referencing equations are dropped.
+	for (auto& eq : eqSets.eqSets)
+	{
+		if (findEqSetRepresentative(&eq) != &eq)
+		{
+			continue;
+		}
+
+		EquationEntrySet remapped;
+		for (auto e : eq.equationSet)
+		{
+			e.other = findEqSetRepresentative(e.other);
+			if (e.other != &eq)
+			{
+				remapped.insert(e);
+			}
+		}
+		eq.equationSet = std::move(remapped);
+	}
+
+	for (auto& p : processedObjs)
+	{
+		p.second = findEqSetRepresentative(p.second);
+	}
+
+	for (auto it = eqSets.eqSets.begin(); it != eqSets.eqSets.end();)
+	{
+		if (findEqSetRepresentative(&(*it)) != &(*it))
+		{
+			it = eqSets.eqSets.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	_ufParent.clear();
+	_ufRank.clear();
+}
+
 void SimpleTypesAnalysis::eraseObsoleteInstructions()
 {
 	for (auto* v : instToErase)
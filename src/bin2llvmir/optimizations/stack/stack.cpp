@@ -438,21 +438,25 @@ retdec::config::Object* StackAnalysis::getDebugStackVariable(
 		return nullptr;
 	}
 
-	for (auto& p : debugFnc->locals)
+	auto fIt = _debugStackVariables.find(debugFnc);
+	if (fIt == _debugStackVariables.end())
 	{
-		auto& var = p.second;
-		if (!var.getStorage().isStack())
+		std::map<int, retdec::config::Object*> offset2var;
+		for (auto& p : debugFnc->locals)
 		{
-			continue;
-		}
-
-		if (var.getStorage().getStackOffset() == baseOffset)
-		{
-			return &var;
+			auto& var = p.second;
+			if (var.getStorage().isStack())
+			{
+				offset2var[var.getStorage().getStackOffset()] = &var;
+			}
 		}
+		fIt = _debugStackVariables.emplace(
+				debugFnc,
+				std::move(offset2var)).first;
 	}
 
-	return nullptr;
+	auto vIt = fIt->second.find(baseOffset);
+	return vIt != fIt->second.end() ? vIt->second : nullptr;
 }
 
 } // namespace bin2llvmir
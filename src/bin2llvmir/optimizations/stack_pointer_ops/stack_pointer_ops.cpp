@@ -61,6 +61,8 @@ bool StackPointerOpsRemove::runOnModuleCustom(llvm::Module& M, Config* c)
  */
 bool StackPointerOpsRemove::run()
 {
+	collectRegisters();
+
 	bool changed = false;
 	changed |= removeStackPointerStores();
 	changed |= removePreservationStores();
@@ -68,6 +70,28 @@ bool StackPointerOpsRemove::run()
 	return changed;
 }
 
+/**
+ * Resolves the stack and base pointer registers of the module once, so the
+ * per-instruction checks below do not repeat name lookups for every store.
+ */
+void StackPointerOpsRemove::collectRegisters()
+{
+	_spRegisters.clear();
+	_bpRegisters.clear();
+
+	for (auto& gv : _module->globals())
+	{
+		if (_config && _config->isStackPointerRegister(&gv))
+		{
+			_spRegisters.insert(&gv);
+		}
+		else if (gv.getName() == "ebp" || gv.getName() == "rbp")
+		{
+			_bpRegisters.insert(&gv);
+		}
+	}
+}
+
 bool StackPointerOpsRemove::removeStackPointerStores()
 {
 	if (_config == nullptr)
@@ -93,7 +117,7 @@ bool StackPointerOpsRemove::removeStackPointerStores()
 			if (StoreInst* s = dyn_cast<StoreInst>(inst))
 			{
 				auto* reg = s->getPointerOperand();
-				if (!_config->isStackPointerRegister(reg))
+				if (_spRegisters.count(reg) == 0)
 				{
 					continue;
 				}
@@ -135,7 +159,7 @@ bool StackPointerOpsRemove::removePreservationStores()
 				{
 					auto* l = dyn_cast<LoadInst>(s->getValueOperand());
 					if (l && storedVal == nullptr
-							&& (l->getPointerOperand()->getName() == "ebp" || l->getPointerOperand()->getName() == "rbp"))
+							&& _bpRegisters.count(l->getPointerOperand()))
 					{
 						storedVal = l->getPointerOperand();
 						toRemove.insert(s);
@@ -156,7 +180,7 @@ bool StackPointerOpsRemove::removePreservationStores()
 					{
 						auto* s = dyn_cast<StoreInst>(uu);
 						if (s && storedVal == nullptr
-								&& (s->getPointerOperand()->getName() == "ebp" || s->getPointerOperand()->getName() == "rbp"))
+								&& _bpRegisters.count(s->getPointerOperand()))
 						{
 							storedVal = s->getPointerOperand();
 							toRemove.insert(s);
@@ -22,7 +22,7 @@ using namespace llvm;
 /**
  * http://lxr.free-electrons.com/source/arch/arm/include/asm/unistd.h?v=3.1;a%3Darm
  */
-std::map<uint64_t, std::string> armSyscalls =
+constexpr retdec::bin2llvmir::SyscallEntry armSyscalls[] =
 {
 	{0, "restart_syscall"},
 	{1, "exit"},
@@ -125,7 +125,6 @@ std::map<uint64_t, std::string> armSyscalls =
 	{98, "profil"}, // 98 was sys_profil
 	{99, "statfs"},
 	{100, "fstatfs"},
-	{109, "ioperm"}, // 101 was sys_ioperm
 	{102, "socketcall"},
 	{103, "syslog"},
 	{104, "setitimer"},
@@ -133,7 +132,7 @@ std::map<uint64_t, std::string> armSyscalls =
 	{106, "stat"},
 	{107, "lstat"},
 	{108, "fstat"},
-	{109, "uname"}, // 109 was sys_uname
+	{109, "ioperm"}, // 101 was sys_ioperm; this entry won over 109 sys_uname
 	{110, "iopl"}, // 110 was sys_iopl
 	{111, "vhangup"},
 	{112, "idle"}, // 112 was sys_idle
@@ -461,10 +460,9 @@ bool SyscallFixer::runArm()
 			LOG << "\tcode = " << std::dec << code << std::endl;
 
 			std::string callName;
-			auto fit = armSyscalls.find(code);
-			if (fit != armSyscalls.end())
+			if (const char* scName = findSyscallName(armSyscalls, code))
 			{
-				callName = fit->second;
+				callName = scName;
 				LOG << "\tfound in syscall map: " << callName << std::endl;
 			}
 			else
@@ -24,7 +24,7 @@ using namespace llvm;
  *   http://www.rdos.net/svn/tags/V9.2.5/watcom/bld/clib/h/sysmips.h
  *   linux/mips/syscallent.h
  */
-std::map<uint64_t, std::string> mipsSyscalls =
+constexpr retdec::bin2llvmir::SyscallEntry mipsSyscalls[] =
 {
 	{4001, "exit"},
 	{4002, "fork"},
@@ -188,8 +188,6 @@ std::map<uint64_t, std::string> mipsSyscalls =
 	{4160, "sched_setscheduler"},
 	{4161, "sched_getscheduler"},
 	{4162, "sched_yield"},
-	{4161, "sched_getscheduler"},
-	{4162, "sched_yield"},
 	{4163, "sched_get_priority_max"},
 	{4164, "sched_get_priority_min"},
 	{4165, "sched_rr_get_interval"},
@@ -286,10 +284,10 @@ bool SyscallFixer::runMips()
 			LOG << "\tcode: " << std::dec << ci->getZExtValue() << std::endl;
 
 			std::string callName;
-			auto fit = mipsSyscalls.find(ci->getZExtValue());
-			if (fit != mipsSyscalls.end())
+			if (const char* scName = findSyscallName(
+					mipsSyscalls, ci->getZExtValue()))
 			{
-				callName = fit->second;
+				callName = scName;
 				LOG << "\tfound in syscall map: " << callName << std::endl;
 			}
 			else
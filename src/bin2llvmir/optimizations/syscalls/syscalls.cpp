@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/optimizations/syscalls/syscalls.h"
 
@@ -13,6 +15,23 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+/**
+ * Finds @a code in the sorted syscall table delimited by @a begin and @a end.
+ * @return Name of the syscall or @c nullptr if the code is not known.
+ */
+const char* findSyscallName(
+		const SyscallEntry* begin,
+		const SyscallEntry* end,
+		std::uint64_t code)
+{
+	auto it = std::lower_bound(
+			begin,
+			end,
+			code,
+			[](const SyscallEntry& e, std::uint64_t c) { return e.code < c; });
+	return it != end && it->code == code ? it->name : nullptr;
+}
+
 char SyscallFixer::ID = 0;
 
 static RegisterPass<SyscallFixer> X(
@@ -24,7 +24,7 @@ using namespace llvm;
  * Note: x86 and x86_64 have different ABIs, therefore different syscall tables.
  * For x86_64 see /usr/include/asm/unistd_64.h.
  */
-std::map<uint64_t, std::string> x86Syscalls =
+constexpr retdec::bin2llvmir::SyscallEntry x86Syscalls[] =
 {
 	{0, "restart_syscall"},
 	{1, "exit"},
@@ -407,7 +407,7 @@ std::map<uint64_t, std::string> x86Syscalls =
 /**
  * From: /usr/include/linux/net.h
  */
-std::map<uint64_t, std::string> x86SocketSyscalls =
+constexpr retdec::bin2llvmir::SyscallEntry x86SocketSyscalls[] =
 {
 	{1, "socket"}, // SYS_SOCKET -- sys_socket(2)
 	{2, "bind"}, // SYS_BIND -- sys_bind(2)
@@ -528,18 +528,15 @@ bool SyscallFixer::runX86()
 			LOG << "\teax store    : " << llvmObjToString(eaxStore) << std::endl;
 			LOG << "\tsyscall code : " << std::dec << ci->getZExtValue() << std::endl;
 
-			std::string callName;
-			auto fit = x86Syscalls.find(ci->getZExtValue());
-			if (fit == x86Syscalls.end())
+			const char* scName = findSyscallName(
+					x86Syscalls, ci->getZExtValue());
+			if (scName == nullptr)
 			{
 				x86TransformToDummySyscall(ai);
 				continue;
 			}
-			else
-			{
-				callName = fit->second;
-				LOG << "\tsyscall name : " << callName << std::endl;
-			}
+			std::string callName = scName;
+			LOG << "\tsyscall name : " << callName << std::endl;
 
 			auto* lf = _module->getFunction(callName);
 			if (lf)
@@ -102,6 +102,7 @@ void VtableAnalysis::detectVtablesInData()
 	LOG << "\n*** detectVtablesInData():" << std::endl;
 
 	auto wordSz = objf->getFileFormat()->getBytesPerWord();
+	const auto& refs = RA->getAddressToObjectMapping();
 
 	for (auto& seg : objf->getSegments())
 	{
@@ -112,28 +113,38 @@ void VtableAnalysis::detectVtablesInData()
 
 		auto addr = seg->getAddress();
 		auto end = seg->getEndAddress();
-		while (addr + wordSz < end)
+
+		// A candidate position must be followed by two referenced words, so
+		// only positions one word before a detected reference can ever
+		// match. Walking the reference index instead of every word of the
+		// segment skips the pointer-free space entirely.
+		for (auto rIt = refs.lower_bound(addr + wordSz);
+				rIt != refs.end() && rIt->first < end;
+				++rIt)
 		{
+			Address pos = rIt->first - wordSz;
+			if (pos < addr || !(pos + wordSz < end))
+			{
+				continue;
+			}
+
 			std::uint64_t val = 0;
-			if (!objf->getImage()->getWord(addr, val))
+			if (!objf->getImage()->getWord(pos, val))
 			{
-				addr += wordSz;
 				continue;
 			}
 
 			if (gcc && val != 0)
 			{
-				addr += wordSz;
 				continue;
 			}
 
-			Address item1 = addr + wordSz;
+			Address item1 = pos + wordSz;
 			Address item2 = item1 + wordSz;
 
 			if (!RA->hasReferenceOnAddress(item1)
 					|| !RA->hasReferenceOnAddress(item2))
 			{
-				addr += wordSz;
 				continue;
 			}
 
@@ -12,12 +12,134 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+namespace {
+
+//
+//=============================================================================
+//  Register tables
+//=============================================================================
+//
+
+// Per-calling-convention orderings of registers used to pass arguments.
+// These tables are the single source of truth -- ABI construction resolves
+// them to module globals, and quick parameter-register queries read them
+// directly without touching the module.
+
+constexpr const char* armParamRegNames[] =
+		{"r0", "r1", "r2", "r3"};
+constexpr const char* armDoubleParamRegNames[][2] =
+		{{"r0", "r1"}, {"r2", "r3"}};
+
+constexpr const char* ppcParamRegNames[] =
+		{"r3", "r4", "r5", "r6", "r7", "r8", "r9"};
+
+constexpr const char* x86FastcallParamRegNames[] =
+		{"ecx", "edx"};
+
+constexpr const char* mipsParamRegNames[] =
+		{"a0", "a1", "a2", "a3"};
+constexpr const char* mipsFloatParamRegNames[][2] =
+		{{"f12", "f13"}, {"f14", "f15"}};
+constexpr const char* mipsDoubleParamRegNames[][2] =
+		{{"fd0", "fd1"}, {"fd3", "fd4"}};
+
+constexpr const char* mipsPspParamRegNames[] =
+		{"a0", "a1", "a2", "a3", "t0", "t1", "t2", "t3"};
+constexpr const char* mipsPspFloatParamRegNames[][2] =
+		{{"f12", "f13"}, {"f14", "f15"}, {"f16", "f17"}, {"f18", "f19"}};
+constexpr const char* mipsPspDoubleParamRegNames[][2] =
+		{{"fd12", "fd13"}, {"fd14", "fd15"}, {"fd16", "fd17"}, {"fd18", "fd19"}};
+
+template <typename T, std::size_t N>
+constexpr std::size_t arraySize(T (&)[N])
+{
+	return N;
+}
+
+/**
+ * Resolve a table of single register names into register couples.
+ */
+std::vector<RegisterCouple> regsFromNames(
+		llvm::Module* m,
+		const char* const* names,
+		std::size_t count)
+{
+	std::vector<RegisterCouple> ret;
+	ret.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		ret.emplace_back(m->getNamedGlobal(names[i]));
+	}
+	return ret;
+}
+
+/**
+ * Resolve a table of register name pairs into register couples.
+ */
+std::vector<RegisterCouple> regCouplesFromNames(
+		llvm::Module* m,
+		const char* const (*names)[2],
+		std::size_t count)
+{
+	std::vector<RegisterCouple> ret;
+	ret.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		ret.emplace_back(
+				m->getNamedGlobal(names[i][0]),
+				m->getNamedGlobal(names[i][1]));
+	}
+	return ret;
+}
+
+} // anonymous namespace
+
 //
 //=============================================================================
 //  Abi
 //=============================================================================
 //
 
+/**
+ * Get the ordered table of integer parameter register @a names (and their
+ * @a count) for the architecture @a a.
+ * @return @c True if the ABI of @a a is known -- @a names and @a count are
+ *         set. @a count may be zero (e.g. x86 cdecl passes all arguments on
+ *         the stack). @c False if the ABI is not known -- outputs are not
+ *         modified.
+ */
+bool Abi::getParameterRegisterNames(
+		const retdec::config::Architecture& a,
+		const char* const*& names,
+		std::size_t& count)
+{
+	if (a.isX86())
+	{
+		names = nullptr;
+		count = 0;
+		return true;
+	}
+	else if (a.isPpc())
+	{
+		names = ppcParamRegNames;
+		count = arraySize(ppcParamRegNames);
+		return true;
+	}
+	else if (a.isArmOrThumb())
+	{
+		names = armParamRegNames;
+		count = arraySize(armParamRegNames);
+		return true;
+	}
+	else if (a.isMipsOrPic32())
+	{
+		names = mipsParamRegNames;
+		count = arraySize(mipsParamRegNames);
+		return true;
+	}
+	return false;
+}
+
 Abi Abi::armCdecl(llvm::Module* m, retdec::config::Architecture& a)
 {
 	auto& ctx = m->getContext();
@@ -43,13 +165,10 @@ Abi Abi::armCdecl(llvm::Module* m, retdec::config::Architecture& a)
 					ret._module->getNamedGlobal("r0"),
 					ret._module->getNamedGlobal("r1")));
 
-	std::vector<RegisterCouple> i32Args =
-	{
-			RegisterCouple(ret._module->getNamedGlobal("r0")),
-			RegisterCouple(ret._module->getNamedGlobal("r1")),
-			RegisterCouple(ret._module->getNamedGlobal("r2")),
-			RegisterCouple(ret._module->getNamedGlobal("r3")),
-	};
+	std::vector<RegisterCouple> i32Args = regsFromNames(
+			ret._module,
+			armParamRegNames,
+			arraySize(armParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getInt32Ty(ctx),
 			i32Args);
@@ -59,15 +178,10 @@ Abi Abi::armCdecl(llvm::Module* m, retdec::config::Architecture& a)
 			Type::getFloatTy(ctx),
 			floatArgs);
 
-	std::vector<RegisterCouple> doubleArgs =
-	{
-			RegisterCouple(
-					ret._module->getNamedGlobal("r0"),
-					ret._module->getNamedGlobal("r1")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("r2"),
-					ret._module->getNamedGlobal("r3"))
-	};
+	std::vector<RegisterCouple> doubleArgs = regCouplesFromNames(
+			ret._module,
+			armDoubleParamRegNames,
+			arraySize(armDoubleParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getDoubleTy(ctx),
 			doubleArgs);
@@ -103,16 +217,10 @@ Abi Abi::ppcCdecl(llvm::Module* m, retdec::config::Architecture& a)
 					ret._module->getNamedGlobal("r3"),
 					ret._module->getNamedGlobal("r4")));
 
-	std::vector<RegisterCouple> i32Args =
-	{
-			RegisterCouple(ret._module->getNamedGlobal("r3")),
-			RegisterCouple(ret._module->getNamedGlobal("r4")),
-			RegisterCouple(ret._module->getNamedGlobal("r5")),
-			RegisterCouple(ret._module->getNamedGlobal("r6")),
-			RegisterCouple(ret._module->getNamedGlobal("r7")),
-			RegisterCouple(ret._module->getNamedGlobal("r8")),
-			RegisterCouple(ret._module->getNamedGlobal("r9")),
-	};
+	std::vector<RegisterCouple> i32Args = regsFromNames(
+			ret._module,
+			ppcParamRegNames,
+			arraySize(ppcParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getInt32Ty(ctx),
 			i32Args);
@@ -173,11 +281,10 @@ Abi Abi::x86Fastcall(llvm::Module* m, retdec::config::Architecture& a)
 
 	ret._cc = retdec::config::CallingConvention::initFastcall();
 
-	std::vector<RegisterCouple> i32Args =
-	{
-			RegisterCouple(ret._module->getNamedGlobal("ecx")),
-			RegisterCouple(ret._module->getNamedGlobal("edx")),
-	};
+	std::vector<RegisterCouple> i32Args = regsFromNames(
+			ret._module,
+			x86FastcallParamRegNames,
+			arraySize(x86FastcallParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getInt32Ty(ctx),
 			i32Args);
@@ -225,39 +332,26 @@ Abi Abi::mipsCdecl(llvm::Module* m, retdec::config::Architecture& a)
 			RegisterCouple(
 					ret._module->getNamedGlobal("fd0")));
 
-	std::vector<RegisterCouple> i32Args =
-	{
-			RegisterCouple(ret._module->getNamedGlobal("a0")),
-			RegisterCouple(ret._module->getNamedGlobal("a1")),
-			RegisterCouple(ret._module->getNamedGlobal("a2")),
-			RegisterCouple(ret._module->getNamedGlobal("a3")),
-	};
+	std::vector<RegisterCouple> i32Args = regsFromNames(
+			ret._module,
+			mipsParamRegNames,
+			arraySize(mipsParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getInt32Ty(ctx),
 			i32Args);
 
-	std::vector<RegisterCouple> floatArgs =
-	{
-			RegisterCouple(
-					ret._module->getNamedGlobal("f12"),
-					ret._module->getNamedGlobal("f13")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("f14"),
-					ret._module->getNamedGlobal("f15"))
-	};
+	std::vector<RegisterCouple> floatArgs = regCouplesFromNames(
+			ret._module,
+			mipsFloatParamRegNames,
+			arraySize(mipsFloatParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getFloatTy(ctx),
 			floatArgs);
 
-	std::vector<RegisterCouple> doubleArgs =
-	{
-			RegisterCouple(
-					ret._module->getNamedGlobal("fd0"),
-					ret._module->getNamedGlobal("fd1")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("fd3"),
-					ret._module->getNamedGlobal("fd4"))
-	};
+	std::vector<RegisterCouple> doubleArgs = regCouplesFromNames(
+			ret._module,
+			mipsDoubleParamRegNames,
+			arraySize(mipsDoubleParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getDoubleTy(ctx),
 			doubleArgs);
@@ -288,55 +382,26 @@ Abi Abi::mipsPspCdecl(llvm::Module* m, retdec::config::Architecture& a)
 	auto& ctx = m->getContext();
 	auto ret = mipsCdecl(m, a);
 
-	std::vector<RegisterCouple> i32Args =
-	{
-			RegisterCouple(ret._module->getNamedGlobal("a0")),
-			RegisterCouple(ret._module->getNamedGlobal("a1")),
-			RegisterCouple(ret._module->getNamedGlobal("a2")),
-			RegisterCouple(ret._module->getNamedGlobal("a3")),
-			RegisterCouple(ret._module->getNamedGlobal("t0")),
-			RegisterCouple(ret._module->getNamedGlobal("t1")),
-			RegisterCouple(ret._module->getNamedGlobal("t2")),
-			RegisterCouple(ret._module->getNamedGlobal("t3")),
-	};
+	std::vector<RegisterCouple> i32Args = regsFromNames(
+			ret._module,
+			mipsPspParamRegNames,
+			arraySize(mipsPspParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getInt32Ty(ctx),
 			i32Args);
 
-	std::vector<RegisterCouple> floatArgs =
-	{
-			RegisterCouple(
-					ret._module->getNamedGlobal("f12"),
-					ret._module->getNamedGlobal("f13")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("f14"),
-					ret._module->getNamedGlobal("f15")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("f16"),
-					ret._module->getNamedGlobal("f17")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("f18"),
-					ret._module->getNamedGlobal("f19")),
-	};
+	std::vector<RegisterCouple> floatArgs = regCouplesFromNames(
+			ret._module,
+			mipsPspFloatParamRegNames,
+			arraySize(mipsPspFloatParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getFloatTy(ctx),
 			floatArgs);
 
-	std::vector<RegisterCouple> doubleArgs =
-	{
-			RegisterCouple(
-					ret._module->getNamedGlobal("fd12"),
-					ret._module->getNamedGlobal("fd13")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("fd14"),
-					ret._module->getNamedGlobal("fd15")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("fd16"),
-					ret._module->getNamedGlobal("fd17")),
-			RegisterCouple(
-					ret._module->getNamedGlobal("fd18"),
-					ret._module->getNamedGlobal("fd19")),
-	};
+	std::vector<RegisterCouple> doubleArgs = regCouplesFromNames(
+			ret._module,
+			mipsPspDoubleParamRegNames,
+			arraySize(mipsPspDoubleParamRegNames));
 	ret._typeToArgumentRegs.emplace(
 			Type::getDoubleTy(ctx),
 			doubleArgs);
@@ -698,6 +763,14 @@ bool AbiProvider::getAbi(
 	return abi != nullptr;
 }
 
+/**
+ * Erase all data stored for module @a module.
+ */
+void AbiProvider::erase(llvm::Module* module)
+{
+	_module2abis.erase(module);
+}
+
 /**
  * Clear all stored data.
  */
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/InstIterator.h>
 
@@ -20,6 +22,7 @@ namespace retdec {
 namespace bin2llvmir {
 
 std::vector<std::pair<const llvm::Module*, const llvm::GlobalVariable*>> AsmInstruction::_cache;
+std::map<const llvm::Module*, AsmInstruction::AddressIndex> AsmInstruction::_addressIndex;
 
 AsmInstruction::AsmInstruction()
 {
@@ -93,23 +96,99 @@ AsmInstruction::AsmInstruction(llvm::Module* m, retdec::utils::Address addr)
 		return;
 	}
 
+	_llvmToAsmInstr = findByAddress(m, addr);
+}
+
+/**
+ * Get (build if it does not exist yet) the flat address-sorted index of the
+ * special instructions in module @a m.
+ *
+ * Address-to-instruction resolution used to be done by inspecting the users
+ * of the address constant, which LLVM implements as a use-list traversal.
+ * Passes like @c Decoder or @c ParamReturn do these lookups millions of
+ * times per binary, so the index is built once by a single module walk and
+ * every subsequent lookup is a binary search.
+ */
+AsmInstruction::AddressIndex& AsmInstruction::getAddressIndex(llvm::Module* m)
+{
+	auto fIt = _addressIndex.find(m);
+	if (fIt != _addressIndex.end())
+	{
+		return fIt->second;
+	}
+
+	AddressIndex& idx = _addressIndex[m];
+	for (auto& f : *m)
+	for (auto& b : f)
+	for (auto& i : b)
+	{
+		if (isLlvmToAsmInstruction(&i))
+		{
+			auto* s = cast<StoreInst>(&i);
+			if (auto* ci = dyn_cast<ConstantInt>(s->getValueOperand()))
+			{
+				idx.emplace_back(ci->getZExtValue(), s);
+			}
+		}
+	}
+	std::sort(idx.begin(), idx.end());
+	return idx;
+}
+
+/**
+ * Find the special instruction with address @a addr in module @a m using the
+ * address index. Instructions created after the index was built (e.g. by
+ * decoding on demand) are found by the original use-list inspection and added
+ * to the index incrementally.
+ */
+llvm::StoreInst* AsmInstruction::findByAddress(
+		llvm::Module* m,
+		retdec::utils::Address addr)
+{
+	AddressIndex& idx = getAddressIndex(m);
+
+	auto it = std::lower_bound(
+			idx.begin(),
+			idx.end(),
+			std::make_pair(std::uint64_t(addr), (StoreInst*)nullptr));
+	if (it != idx.end() && it->first == addr)
+	{
+		return it->second;
+	}
+
 	ConstantInt* ci = ConstantInt::get(
 			Type::getInt64Ty(m->getContext()),
 			addr,
 			false);
 	if (ci == nullptr)
 	{
-		return;
+		return nullptr;
 	}
 
 	for (auto* u : ci->users())
 	{
-		if (isLlvmToAsmInstructionPrivate(u))
+		if (isLlvmToAsmInstruction(u))
 		{
-			_llvmToAsmInstr = dyn_cast_or_null<StoreInst>(u);
-			return;
+			auto* s = dyn_cast_or_null<StoreInst>(u);
+			if (s)
+			{
+				idx.insert(it, std::make_pair(std::uint64_t(addr), s));
+			}
+			return s;
 		}
 	}
+
+	return nullptr;
+}
+
+/**
+ * Throw away the address index built for module @a m. Must be called whenever
+ * the special instructions in @a m are removed (e.g. by @c AsmInstructionRemover)
+ * or replaced wholesale.
+ */
+void AsmInstruction::invalidateAddressIndex(const llvm::Module* m)
+{
+	_addressIndex.erase(m);
 }
 
 bool AsmInstruction::operator<(const AsmInstruction& o) const
@@ -247,9 +326,22 @@ bool AsmInstruction::isLlvmToAsmInstruction(const llvm::Value* inst)
 	return s->getPointerOperand() == getLlvmToAsmGlobalVariable(m);
 }
 
+/**
+ * Erase all data cached for module @a m.
+ */
+void AsmInstruction::erase(const llvm::Module* m)
+{
+	for (auto it = _cache.begin(); it != _cache.end();)
+	{
+		it = it->first == m ? _cache.erase(it) : it + 1;
+	}
+	_addressIndex.erase(m);
+}
+
 void AsmInstruction::clear()
 {
 	_cache.clear();
+	_addressIndex.clear();
 }
 
 bool AsmInstruction::isValid() const
@@ -44,7 +44,7 @@ Config Config::fromFile(llvm::Module* m, const std::string& path)
 	if (!config._configPath.empty())
 	{
 		// Can throw an exception, but it is catched by bin2llvmirl.
-		config._configDB.readJsonFile(config._configPath);
+		config._configDB.readFile(config._configPath);
 	}
 
 	for (auto& s : config.getConfig().structures)
@@ -77,7 +77,7 @@ void Config::doFinalization()
 {
 	if (!_configPath.empty())
 	{
-		_configDB.generateJsonFile(_configPath);
+		_configDB.generateBinaryFile(_configPath);
 	}
 }
 
@@ -209,35 +209,68 @@ llvm::AllocaInst* Config::getLlvmStackVariable(
 		llvm::Function* fnc,
 		int offset)
 {
-	auto* cf = getConfigFunction(fnc);
-	if (cf == nullptr)
+	if (getConfigFunction(fnc) == nullptr)
 	{
 		return nullptr;
 	}
 
-	for (auto& p: cf->locals)
+	// Two attempts -- a stale index (erased or moved alloca) is rebuilt and
+	// queried once more.
+	for (unsigned attempt = 0; attempt < 2; ++attempt)
 	{
-		auto& l = p.second;
-		int off = 0;
-		if (l.getStorage().isStack(off) && off == offset)
+		auto fIt = _stackVariableIndex.find(fnc);
+		if (fIt == _stackVariableIndex.end())
+		{
+			buildStackVariableIndex(fnc);
+			fIt = _stackVariableIndex.find(fnc);
+		}
+
+		auto oIt = fIt->second.find(offset);
+		if (oIt == fIt->second.end())
+		{
+			return nullptr;
+		}
+
+		Value* v = oIt->second;
+		auto* a = dyn_cast_or_null<AllocaInst>(v);
+		if (a && a->getFunction() == fnc)
 		{
-			for (auto& b : *fnc)
-			for (auto& i : b)
-			{
-				if (AllocaInst* a = dyn_cast<AllocaInst>(&i))
-				{
-					if (a->getName() == l.getName())
-					{
-						return a;
-					}
-				}
-			}
+			return a;
 		}
+
+		_stackVariableIndex.erase(fIt);
 	}
 
 	return nullptr;
 }
 
+/**
+ * Build the stack variable index of the given function by one walk over its
+ * allocas. The function must have a config counterpart.
+ */
+void Config::buildStackVariableIndex(llvm::Function* fnc)
+{
+	auto* cf = getConfigFunction(fnc);
+	assert(cf);
+
+	auto& index = _stackVariableIndex[fnc];
+	for (auto& b : *fnc)
+	for (auto& i : b)
+	{
+		auto* a = dyn_cast<AllocaInst>(&i);
+		if (a == nullptr)
+		{
+			continue;
+		}
+		auto* cl = cf->locals.getObjectByName(a->getName());
+		int off = 0;
+		if (cl && cl->getStorage().isStack(off))
+		{
+			index[off] = a;
+		}
+	}
+}
+
 /**
  * @return @c True if the the provided LLVM value @a val is a stack variable.
  *         @c False otherwise.
@@ -306,6 +339,15 @@ retdec::config::Object* Config::insertStackVariable(
 	local.type.setLlvmIr(llvmObjToString(sv->getType()));
 
 	auto p = cf->locals.insert(local);
+
+	// Keep an already built index up to date; a not-yet-built one picks the
+	// variable up when it is built.
+	auto fIt = _stackVariableIndex.find(sv->getFunction());
+	if (fIt != _stackVariableIndex.end())
+	{
+		fIt->second[offset] = const_cast<llvm::AllocaInst*>(sv);
+	}
+
 	return &p.first->second;
 }
 
@@ -329,14 +371,10 @@ retdec::config::Function* Config::insertFunction(
 
 	if (cf.getDemangledName().empty())
 	{
-		retdec::demangler::CDemangler* d = DemanglerProvider::getDemangler(_module);
-		if (d)
+		auto s = DemanglerProvider::demangleToString(_module, fnc->getName());
+		if (!s.empty())
 		{
-			auto s = d->demangleToString(fnc->getName());
-			if (!s.empty())
-			{
-				cf.setDemangledName(s);
-			}
+			cf.setDemangledName(s);
 		}
 	}
 
@@ -353,14 +391,10 @@ retdec::config::Function* Config::renameFunction(
 
 	if (cf.getDemangledName().empty())
 	{
-		retdec::demangler::CDemangler* d = DemanglerProvider::getDemangler(_module);
-		if (d)
+		auto s = DemanglerProvider::demangleToString(_module, fnc->getName());
+		if (!s.empty())
 		{
-			auto s = d->demangleToString(fnc->getName());
-			if (!s.empty())
-			{
-				cf.setDemangledName(s);
-			}
+			cf.setDemangledName(s);
 		}
 	}
 
@@ -707,6 +741,14 @@ void ConfigProvider::doFinalization(llvm::Module* m)
 /**
  * Clear all stored data.
  */
+/**
+ * Erase all data stored for module @a m.
+ */
+void ConfigProvider::erase(llvm::Module* m)
+{
+	_module2config.erase(m);
+}
+
 void ConfigProvider::clear()
 {
 	_module2config.clear();
@@ -83,6 +83,14 @@ bool DebugFormatProvider::getDebugFormat(llvm::Module* m, DebugFormat*& df)
 /**
  * Clear all stored data.
  */
+/**
+ * Erase all data stored for module @a m.
+ */
+void DebugFormatProvider::erase(llvm::Module* m)
+{
+	_module2debug.erase(m);
+}
+
 void DebugFormatProvider::clear()
 {
 	_module2debug.clear();
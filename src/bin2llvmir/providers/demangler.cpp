@@ -12,6 +12,8 @@ namespace retdec {
 namespace bin2llvmir {
 
 std::map<Module*, DemanglerProvider::Demangler> DemanglerProvider::_module2demangler;
+const std::size_t DemanglerProvider::_cacheCapacity = 8192;
+std::map<Module*, DemanglerProvider::LruCache> DemanglerProvider::_module2cache;
 
 /**
  * Create and add to provider a demangler for the given module @a m
@@ -73,12 +75,65 @@ bool DemanglerProvider::getDemangler(
 	return d != nullptr;
 }
 
+/**
+ * Demangle @a mangled name using demangler associated with module @a m.
+ * Results are cached -- mangled names repeat massively in real binaries and
+ * every miss runs the full grammar parse. The cache keeps the most recently
+ * used results per module and is dropped together with the demangler.
+ * @return Demangled name, or an empty string if there is no demangler
+ *         associated with @a m.
+ */
+std::string DemanglerProvider::demangleToString(
+		llvm::Module* m,
+		const std::string& mangled)
+{
+	auto* d = getDemangler(m);
+	if (d == nullptr)
+	{
+		return std::string();
+	}
+
+	auto& cache = _module2cache[m];
+	auto f = cache.index.find(mangled);
+	if (f != cache.index.end())
+	{
+		// Move the hit to the front of the LRU order.
+		cache.entries.splice(
+				cache.entries.begin(),
+				cache.entries,
+				f->second);
+		return f->second->second;
+	}
+
+	auto demangled = d->demangleToString(mangled);
+
+	cache.entries.emplace_front(mangled, demangled);
+	cache.index[mangled] = cache.entries.begin();
+	if (cache.entries.size() > _cacheCapacity)
+	{
+		cache.index.erase(cache.entries.back().first);
+		cache.entries.pop_back();
+	}
+
+	return demangled;
+}
+
 /**
  * Clear all stored data.
  */
+/**
+ * Erase all data stored for module @a m.
+ */
+void DemanglerProvider::erase(llvm::Module* m)
+{
+	_module2demangler.erase(m);
+	_module2cache.erase(m);
+}
+
 void DemanglerProvider::clear()
 {
 	_module2demangler.clear();
+	_module2cache.clear();
 }
 
 } // namespace bin2llvmir
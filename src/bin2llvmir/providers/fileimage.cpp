@@ -595,6 +595,28 @@ const retdec::fileformat::Symbol* FileImage::getPreferredSymbol(
 	return ret;
 }
 
+/**
+ * Memoized variant of @c Image::hasDataOnAddress().
+ *
+ * Analyses probing constant operands for being addresses ask about the same
+ * candidate values over and over -- the answer cannot change during
+ * decompilation, so it is computed once per distinct address and then served
+ * from the shared cache.
+ *
+ * @return @c True if there are data on address @a addr, @c false otherwise.
+ */
+bool FileImage::hasDataOnAddress(retdec::utils::Address addr)
+{
+	auto fIt = _addressDataCache.find(addr);
+	if (fIt == _addressDataCache.end())
+	{
+		fIt = _addressDataCache.emplace(
+				addr,
+				_image->hasDataOnAddress(addr)).first;
+	}
+	return fIt->second;
+}
+
 //
 //=============================================================================
 //  FileImageProvider
@@ -674,6 +696,14 @@ bool FileImageProvider::getFileImage(
 /**
  * Clear all stored data.
  */
+/**
+ * Erase all data stored for module @a m.
+ */
+void FileImageProvider::erase(llvm::Module* m)
+{
+	_module2image.erase(m);
+}
+
 void FileImageProvider::clear()
 {
 	_module2image.clear();
@@ -284,6 +284,8 @@ Lti::Lti(
 			loadLtiFile(l);
 		}
 	}
+
+	loadUsedFunctions();
 }
 
 void Lti::loadLtiFile(const std::string& filePath)
@@ -317,7 +319,35 @@ void Lti::loadLtiFile(const std::string& filePath)
 		{
 			cc = "stdcall";
 		}
-		_ltiParser.parseInto(file, _ltiModule, typeWidths, cc);
+		_ltiParser.addLazySource(file, typeWidths, cc);
+	}
+}
+
+/**
+ * Materialize type information for functions whose names appear in the
+ * binary's imports or symbol tables. A typical binary links only a few
+ * hundred known APIs, so this resolves the relevant part of the databases
+ * in one batch; anything queried later under a different name is still
+ * materialized on demand by getLtiFunction().
+ */
+void Lti::loadUsedFunctions()
+{
+	auto* ff = _image->getFileFormat();
+
+	if (auto* impTbl = ff->getImportTable())
+	{
+		for (const auto& imp : *impTbl)
+		{
+			getLtiFunction(imp.getName());
+		}
+	}
+
+	for (const auto* symTbl : ff->getSymbolTables())
+	{
+		for (const auto& sym : *symTbl)
+		{
+			getLtiFunction(sym->getNormalizedName());
+		}
 	}
 }
 
@@ -329,7 +359,7 @@ bool Lti::hasLtiFunction(const std::string& name)
 std::shared_ptr<retdec::ctypes::Function> Lti::getLtiFunction(
 		const std::string& name)
 {
-	return _ltiModule->getFunctionWithName(name);
+	return _ltiParser.materializeFunction(name, _ltiModule);
 }
 
 /**
@@ -438,9 +468,17 @@ llvm::Function* Lti::getLlvmFunction(const std::string& name)
 
 llvm::Type* Lti::getLlvmType(std::shared_ptr<retdec::ctypes::Type> type)
 {
+	auto fIt = _type2llvm.find(type.get());
+	if (fIt != _type2llvm.end())
+	{
+		return fIt->second;
+	}
+
 	ToLlvmTypeVisitor visitor(_module, _config);
 	type->accept(&visitor);
-	return visitor.getLlvmType();
+	auto* llvmType = visitor.getLlvmType();
+	_type2llvm.emplace(type.get(), llvmType);
+	return llvmType;
 }
 
 //
@@ -477,6 +515,14 @@ bool LtiProvider::getLti(llvm::Module* m, Lti*& lti)
 	return lti != nullptr;
 }
 
+/**
+ * Erase all data stored for module @a m.
+ */
+void LtiProvider::erase(llvm::Module* m)
+{
+	_module2lti.erase(m);
+}
+
 void LtiProvider::clear()
 {
 	_module2lti.clear();
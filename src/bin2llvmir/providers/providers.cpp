@@ -0,0 +1,74 @@
+/**
+ * @file src/bin2llvmir/providers/providers.cpp
+ * @brief Lifetime management of per-module provider data.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/bin2llvmir/analyses/analysis_manager.h"
+#include "retdec/bin2llvmir/providers/abi.h"
+#include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/providers.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+//
+//=============================================================================
+//  Providers
+//=============================================================================
+//
+
+/**
+ * Erase the data all providers store for module @a m.
+ */
+void Providers::erase(llvm::Module* m)
+{
+	AbiProvider::erase(m);
+	AnalysisManager::erase(m);
+	AsmInstruction::erase(m);
+	ConfigProvider::erase(m);
+	DebugFormatProvider::erase(m);
+	DemanglerProvider::erase(m);
+	FileImageProvider::erase(m);
+	LtiProvider::erase(m);
+}
+
+/**
+ * Clear all data of all providers, no matter which module they belong to.
+ */
+void Providers::clear()
+{
+	AbiProvider::clear();
+	AnalysisManager::clear();
+	AsmInstruction::clear();
+	ConfigProvider::clear();
+	DebugFormatProvider::clear();
+	DemanglerProvider::clear();
+	FileImageProvider::clear();
+	LtiProvider::clear();
+}
+
+//
+//=============================================================================
+//  ProviderScope
+//=============================================================================
+//
+
+ProviderScope::ProviderScope(llvm::Module* m) :
+		_module(m)
+{
+
+}
+
+ProviderScope::~ProviderScope()
+{
+	Providers::erase(_module);
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
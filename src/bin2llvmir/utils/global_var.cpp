@@ -72,7 +72,7 @@ bool globalVariableCanBeCreated(
 	{
 		return false;
 	}
-	if (!objf->getImage()->hasDataOnAddress(addr))
+	if (!objf->hasDataOnAddress(addr))
 	{
 		return false;
 	}
@@ -105,21 +105,21 @@ bool globalVariableCanBeCreated(
 			uint64_t val = 0;
 			if (objf->getImage()->getWord(addr, val))
 			{
-				if (objf->getImage()->hasDataOnAddress(val))
+				if (objf->hasDataOnAddress(val))
 				{
 					return true;
 				}
 			}
 			if (objf->getImage()->getWord(addr+getDefaultTypeByteSize(module), val))
 			{
-				if (objf->getImage()->hasDataOnAddress(val))
+				if (objf->hasDataOnAddress(val))
 				{
 					return true;
 				}
 			}
 			if (objf->getImage()->getWord(addr-getDefaultTypeByteSize(module), val))
 			{
-				if (objf->getImage()->hasDataOnAddress(val))
+				if (objf->hasDataOnAddress(val))
 				{
 					return true;
 				}
@@ -784,6 +784,45 @@ void insertAtBegin(llvm::Instruction* i, llvm::BasicBlock* bb)
 	}
 }
 
+/**
+ * Erase all instructions in @a insts from their parent basic blocks.
+ *
+ * References among the erased instructions themselves are dropped in one
+ * fix-up pass first, so they may be passed in any order and may use one
+ * another -- no per-erase use-list repair is needed as it would be with a
+ * plain @c eraseFromParent() loop.
+ */
+void eraseInstructions(const std::vector<llvm::Instruction*>& insts)
+{
+	for (auto* i : insts)
+	{
+		i->dropAllReferences();
+	}
+	for (auto* i : insts)
+	{
+		i->eraseFromParent();
+	}
+}
+
+/**
+ * Move instructions @a insts to the front of basic block @a bb so that they
+ * end up at its beginning in the given order.
+ *
+ * The nodes are relinked by list splicing -- each one changes its place in
+ * the instruction list exactly once and never leaves its parent block, so
+ * there is no per-move ownership or symbol table maintenance.
+ */
+void moveInstructionsToFront(
+		llvm::BasicBlock* bb,
+		const std::vector<llvm::Instruction*>& insts)
+{
+	auto& il = bb->getInstList();
+	for (auto ri = insts.rbegin(), re = insts.rend(); ri != re; ++ri)
+	{
+		il.splice(il.begin(), il, (*ri)->getIterator());
+	}
+}
+
 /**
  * Split the function into two functions at the specified instruction.
  * The original function stays valid -- pointer to it can be used.
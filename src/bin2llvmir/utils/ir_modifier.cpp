@@ -10,6 +10,7 @@
 
 #include "retdec/llvm-support/utils.h"
 #include "retdec/utils/string.h"
+#include "retdec/bin2llvmir/analyses/analysis_manager.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
@@ -609,6 +610,8 @@ IrModifier::FunctionPair IrModifier::splitFunctionOn(
 
 //==============================================================================
 
+	AnalysisManager::reportModified(_module);
+
 	return {fnc, ncf};
 }
 
@@ -634,6 +637,8 @@ IrModifier::FunctionPair IrModifier::addFunction(
 
 	auto* cf = _config->insertFunction(fnc, start, start);
 
+	AnalysisManager::reportModified(_module);
+
 	return {fnc, cf};
 }
 
@@ -687,6 +692,8 @@ IrModifier::StackPair IrModifier::getStackVariable(
 
 	auto* csv = _config->insertStackVariable(ret, offset);
 
+	AnalysisManager::reportModified(fnc);
+
 	return {ret, csv};
 }
 
@@ -0,0 +1,123 @@
+/**
+* @file src/bin2llvmir/utils/peephole.cpp
+* @brief Worklist-driven engine for local instruction rewrites.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <llvm/IR/InstIterator.h>
+
+#include "retdec/bin2llvmir/utils/peephole.h"
+
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Registers @a rule to be applied to instructions with opcode @a opcode.
+ * Rules registered on the same opcode are tried in registration order,
+ * the first one that changes the IR wins the visit.
+ */
+void PeepholeEngine::addRule(unsigned opcode, Rule rule)
+{
+	_rules[opcode].push_back(rule);
+}
+
+/**
+ * Applies the registered rules to all instructions in @a f to fixpoint.
+ * @return @c true if the function was modified.
+ */
+bool PeepholeEngine::runOnFunction(llvm::Function& f)
+{
+	bool changed = false;
+
+	_worklist.clear();
+	for (auto it = inst_begin(f), e = inst_end(f); it != e; ++it)
+	{
+		_worklist.push_back(&*it);
+	}
+
+	while (!_worklist.empty())
+	{
+		Value* v = _worklist.back();
+		_worklist.pop_back();
+
+		// Weak handles to instructions erased by earlier rewrites are null.
+		//
+		auto* i = dyn_cast_or_null<Instruction>(v);
+		if (i == nullptr)
+		{
+			continue;
+		}
+
+		changed |= processInstruction(i);
+	}
+
+	return changed;
+}
+
+/**
+ * Applies the registered rules to all functions in @a m.
+ * @return @c true if the module was modified.
+ */
+bool PeepholeEngine::runOnModule(llvm::Module& m)
+{
+	bool changed = false;
+	for (auto& f : m.getFunctionList())
+	{
+		changed |= runOnFunction(f);
+	}
+	return changed;
+}
+
+/**
+ * Tries the rules registered on the opcode of @a i. After a successful
+ * rewrite, the instruction and its pre-rewrite neighbourhood (defining
+ * instructions of its operands and its users) are queued for another
+ * visit, so rules cascade to a local fixpoint.
+ * @return @c true if some rule changed the IR.
+ */
+bool PeepholeEngine::processInstruction(llvm::Instruction* i)
+{
+	auto rIt = _rules.find(i->getOpcode());
+	if (rIt == _rules.end())
+	{
+		return false;
+	}
+
+	// Collected before the rules run -- a rule may erase @c i.
+	//
+	std::vector<WeakVH> neighbours;
+	neighbours.push_back(i);
+	for (auto& op : i->operands())
+	{
+		if (auto* oi = dyn_cast<Instruction>(op.get()))
+		{
+			neighbours.push_back(oi);
+		}
+	}
+	for (auto* u : i->users())
+	{
+		if (auto* ui = dyn_cast<Instruction>(u))
+		{
+			neighbours.push_back(ui);
+		}
+	}
+
+	for (auto& rule : rIt->second)
+	{
+		if (rule(i))
+		{
+			_worklist.insert(
+					_worklist.end(),
+					neighbours.begin(),
+					neighbours.end());
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -11,9 +11,12 @@
  */
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/CallGraph.h>
@@ -23,6 +26,7 @@
 #include <llvm/Analysis/TargetLibraryInfo.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeWriterPass.h>
+#include <llvm/Bitcode/ReaderWriter.h>
 #include <llvm/CodeGen/CommandFlags.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/DebugInfo.h>
@@ -52,7 +56,11 @@
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #include <llvm/Transforms/Utils/Cloning.h>
 
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/config/config.h"
 #include "retdec/llvm-support/diagnostics.h"
+#include "retdec/utils/instrumentation.h"
+#include "retdec/utils/job_server.h"
 #include "retdec/utils/memory.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
@@ -84,6 +92,60 @@ MaxMemoryLimitHalfRAM("max-memory-half-ram",
 		cl::desc("Limit maximal memory to half of system RAM."),
 		cl::init(false));
 
+static cl::opt<bool>
+MemoryReport("memory-report",
+		cl::desc("Print peak and per-phase memory usage to stderr when the tool finishes."),
+		cl::init(false));
+
+// The bitcode output is the interchange format consumed by llvmir2hlltool;
+// the textual form is only useful for debugging, and writing (and later
+// parsing) it can take minutes for large modules.
+static cl::opt<bool>
+EmitTextIr("emit-text-ir",
+		cl::desc("Also write the module as textual LLVM IR (*.ll) next to the bitcode output."),
+		cl::init(false));
+
+// Checkpoints let a long decompilation that dies mid-run (OOM kill, node
+// preemption) be resumed from the last completed pass instead of starting
+// from zero.
+static cl::opt<std::string>
+CheckpointFile("checkpoint-file",
+		cl::desc("Write pass-boundary checkpoints to the given file and resume from it if it exists."),
+		cl::value_desc("filename"));
+
+static cl::list<std::string>
+CheckpointAfter("checkpoint-after",
+		cl::desc("Checkpoint only after passes with the given argument name (may be used multiple times; default: after every pass)."),
+		cl::value_desc("passname"));
+
+// The pipeline policy replaces hand-patching of the pass list: presets and
+// explicit skips are applied when the pass list is built, and every dropped
+// pass is announced on stderr, so the job log always shows what ran.
+static cl::opt<std::string>
+PipelinePreset("pipeline-preset",
+		cl::desc("Pass pipeline preset: 'full' runs the pass list as given (default), "
+				"'fast' skips the expensive optional analyses, 'adaptive' skips "
+				"passes based on the detections recorded in the config file."),
+		cl::init("full"));
+
+static cl::list<std::string>
+SkipPass("skip-pass",
+		cl::desc("Skip passes with the given argument name (may be used multiple times)."),
+		cl::value_desc("passname"));
+
+static cl::opt<std::string>
+PassStatsFile("pass-stats-file",
+		cl::desc("Append per-pass cost/benefit records (pass, seconds, IR size delta) to the given CSV file."),
+		cl::value_desc("filename"));
+
+// Recognized by a manual pre-scan in _main(), not by the LLVM command-line
+// parser -- in daemon mode, the parser runs in the workers, once per job.
+// Declared here only so it shows up in -help.
+static cl::opt<std::string>
+Daemon("daemon",
+		cl::desc("Run as a daemon accepting jobs on the given unix socket (POSIX only)."),
+		cl::value_desc("socket"));
+
 static cl::opt<bool>
 NoVerify("disable-verify", cl::desc("Do not run the verifier"), cl::Hidden);
 
@@ -112,6 +174,15 @@ static cl::opt<bool>
 DisableSimplifyLibCalls("disable-simplify-libcalls",
 		cl::desc("Disable simplify-libcalls"));
 
+// Defined in bin2llvmir (provider_init.cpp). The pipeline policy reads the
+// config file before the passes run, so it can base its decisions on the
+// front-end detections.
+namespace retdec {
+namespace bin2llvmir {
+extern llvm::cl::opt<std::string> ConfigPath;
+} // namespace bin2llvmir
+} // namespace retdec
+
 /**
  * These passes are considered to be from LLVM, not from RetDec.
  * We do not want to write phase information for each of them.
@@ -247,6 +318,297 @@ char ModulePassPrinter::ID = 0;
 std::string ModulePassPrinter::LastPhase = std::string();
 const std::string ModulePassPrinter::LlvmAggregatePhaseName = "LLVM";
 
+/**
+ * @return Identification of the pass list given on the command line. It is
+ * stored in the checkpoint progress file -- a checkpoint recorded with a
+ * different pass list cannot be resumed, because the recorded pass count
+ * would skip different passes.
+ */
+std::string getPassListId()
+{
+	std::string id;
+	for (unsigned i = 0; i < PassList.size(); ++i)
+	{
+		id += PassList[i]->getPassArgument();
+		id += " ";
+	}
+	return id;
+}
+
+/**
+ * This pass snapshots the decompilation state at a pass boundary: the module
+ * as bitcode, the provider state into the config file (the same way the
+ * normal end of the run does), and a progress record with the number of
+ * completed passes. A later run with the same pass list and -checkpoint-file
+ * resumes from the snapshot instead of starting over.
+ */
+class CheckpointWriter : public ModulePass
+{
+	public:
+		static char ID;
+		unsigned PassesDone;
+
+	public:
+		CheckpointWriter(unsigned passesDone) :
+				ModulePass(ID),
+				PassesDone(passesDone)
+		{
+
+		}
+
+		bool runOnModule(Module &M) override
+		{
+			// Write to temporary files and rename them afterwards, so that a
+			// kill in the middle of a snapshot cannot destroy the last
+			// complete one.
+			std::error_code EC;
+			std::string bcTmp = CheckpointFile + ".bc.tmp";
+			{
+				raw_fd_ostream os(bcTmp, EC, sys::fs::F_None);
+				if (EC)
+				{
+					throw std::runtime_error(
+							"failed to write checkpoint: " + EC.message());
+				}
+				bool PreserveBitcodeUseListOrder = true;
+				WriteBitcodeToFile(&M, os, PreserveBitcodeUseListOrder);
+			}
+			sys::fs::rename(bcTmp, CheckpointFile + ".bc");
+
+			// Everything the completed passes recorded into the config must
+			// survive the restart -- the resumed run re-reads the config in
+			// the provider initialization.
+			retdec::bin2llvmir::ConfigProvider::doFinalization(&M);
+
+			std::string progressTmp = CheckpointFile + ".progress.tmp";
+			{
+				std::ofstream f(progressTmp);
+				f << PassesDone << std::endl;
+				f << getPassListId() << std::endl;
+			}
+			sys::fs::rename(progressTmp, CheckpointFile + ".progress");
+
+			return false;
+		}
+
+		const char *getPassName() const override
+		{
+			return "Checkpoint Writer";
+		}
+
+		void getAnalysisUsage(AnalysisUsage &AU) const override
+		{
+			AU.setPreservesAll();
+		}
+};
+char CheckpointWriter::ID = 0;
+
+/**
+ * @return Rough size of the module's IR -- the benefit side of the per-pass
+ * statistics. Counting is linear in the module, so it runs only when the
+ * statistics were requested.
+ */
+std::uint64_t getModuleIrSize(Module &M)
+{
+	std::uint64_t size = M.size() + M.global_size();
+	for (Function &F : M)
+	{
+		for (BasicBlock &B : F)
+		{
+			size += B.size();
+		}
+	}
+	return size;
+}
+
+/**
+ * When -pass-stats-file is given, this pass pair surrounds every pass from
+ * the pass list. The begin half snapshots time and IR size, the end half
+ * turns the deltas into instrumentation counters and appends one CSV record
+ * (pass, seconds, IR size delta) to the statistics file. The records
+ * accumulate over runs, so the file is the history that decisions about
+ * presets and skips can be based on.
+ */
+class PassStatsBegin : public ModulePass
+{
+	public:
+		static char ID;
+		static std::chrono::steady_clock::time_point Start;
+		static std::uint64_t IrSize;
+
+	public:
+		PassStatsBegin() :
+				ModulePass(ID)
+		{
+
+		}
+
+		bool runOnModule(Module &M) override
+		{
+			IrSize = getModuleIrSize(M);
+			Start = std::chrono::steady_clock::now();
+			return false;
+		}
+
+		const char *getPassName() const override
+		{
+			return "Pass Stats Begin";
+		}
+
+		void getAnalysisUsage(AnalysisUsage &AU) const override
+		{
+			AU.setPreservesAll();
+		}
+};
+char PassStatsBegin::ID = 0;
+std::chrono::steady_clock::time_point PassStatsBegin::Start;
+std::uint64_t PassStatsBegin::IrSize = 0;
+
+class PassStatsEnd : public ModulePass
+{
+	public:
+		static char ID;
+		std::string PassArg;
+
+	public:
+		PassStatsEnd(const std::string &passArg) :
+				ModulePass(ID),
+				PassArg(passArg)
+		{
+
+		}
+
+		bool runOnModule(Module &M) override
+		{
+			const auto seconds = std::chrono::duration<double>(
+					std::chrono::steady_clock::now()
+							- PassStatsBegin::Start).count();
+			const auto irDelta = static_cast<std::int64_t>(getModuleIrSize(M))
+					- static_cast<std::int64_t>(PassStatsBegin::IrSize);
+
+			retdec::utils::instrumentation::incrementCounter(
+					"pass/" + PassArg + "/runs");
+			retdec::utils::instrumentation::incrementCounter(
+					"pass/" + PassArg + "/microseconds",
+					static_cast<std::uint64_t>(seconds * 1e6));
+
+			std::ofstream stats(PassStatsFile, std::ios::app);
+			stats << PassArg << "," << seconds << "," << irDelta << std::endl;
+			return false;
+		}
+
+		const char *getPassName() const override
+		{
+			return "Pass Stats End";
+		}
+
+		void getAnalysisUsage(AnalysisUsage &AU) const override
+		{
+			AU.setPreservesAll();
+		}
+};
+char PassStatsEnd::ID = 0;
+
+/// Input size from which the adaptive preset keeps only the first iteration
+/// of the repeated type propagation.
+const std::streamoff ADAPTIVE_INPUT_SIZE_LIMIT = 16 * 1024 * 1024;
+
+/**
+ * Decide which passes of the pass list the pipeline policy drops.
+ *
+ * The 'fast' preset drops the expensive optional analyses unconditionally.
+ * The 'adaptive' preset decides from the config file: the C++ reconstruction
+ * analyses are dropped when the detected languages do not include C++ (e.g.
+ * C-only Go binaries), the libgcc idiom recognition when the detected tools
+ * are not GCC, and the repeated type propagation iterations on large inputs.
+ * Passes named by -skip-pass are dropped in every preset. The provider
+ * initialization is never dropped -- every other pass depends on it.
+ *
+ * @return Mask with @c true for every pass that is skipped.
+ */
+std::vector<bool> getPassSkipMask()
+{
+	std::vector<bool> skip(PassList.size(), false);
+	std::set<std::string> skipArgs(SkipPass.begin(), SkipPass.end());
+	bool collapseSimpleTypes = false;
+
+	if (PipelinePreset == "fast")
+	{
+		skipArgs.insert("idioms");
+		skipArgs.insert("class-hierarchy");
+		skipArgs.insert("vtable-analysis");
+		skipArgs.insert("ctor-dtor");
+		collapseSimpleTypes = true;
+	}
+	else if (PipelinePreset == "adaptive")
+	{
+		std::string configPath = retdec::bin2llvmir::ConfigPath;
+		if (configPath.empty())
+		{
+			std::cerr << "Warning: -pipeline-preset=adaptive without"
+					" -config-path behaves like the full preset." << std::endl;
+		}
+		else
+		{
+			try
+			{
+				auto config = retdec::config::Config::fromFile(configPath);
+
+				if (!config.languages.empty()
+						&& !config.languages.hasLanguage("C++"))
+				{
+					skipArgs.insert("class-hierarchy");
+					skipArgs.insert("vtable-analysis");
+					skipArgs.insert("ctor-dtor");
+				}
+
+				if (!config.tools.empty() && !config.tools.isGcc())
+				{
+					skipArgs.insert("idioms-libgcc");
+				}
+
+				std::ifstream input(config.getInputFile(),
+						std::ifstream::ate | std::ifstream::binary);
+				if (input.is_open()
+						&& input.tellg() >= ADAPTIVE_INPUT_SIZE_LIMIT)
+				{
+					collapseSimpleTypes = true;
+				}
+			}
+			catch (const std::exception &e)
+			{
+				std::cerr << "Warning: -pipeline-preset=adaptive cannot read"
+						" config '" << configPath << "': " << e.what()
+						<< std::endl;
+			}
+		}
+	}
+	else if (PipelinePreset != "full")
+	{
+		throw std::runtime_error(
+				"unknown pipeline preset: " + PipelinePreset);
+	}
+
+	skipArgs.erase("provider-init");
+
+	bool simpleTypesSeen = false;
+	for (unsigned i = 0; i < PassList.size(); ++i)
+	{
+		std::string passArg = PassList[i]->getPassArgument();
+		if (skipArgs.count(passArg))
+		{
+			skip[i] = true;
+		}
+		else if (passArg == "simple-types")
+		{
+			// Later iterations only refine the result of the first one.
+			skip[i] = collapseSimpleTypes && simpleTypesSeen;
+			simpleTypesSeen = true;
+		}
+	}
+	return skip;
+}
+
 /**
  * Add the pass to the pass manager + possible verification.
  */
@@ -352,6 +714,64 @@ std::unique_ptr<Module> createLlvmModule(LLVMContext& Context)
 	return M;
 }
 
+/**
+ * If checkpoint files from a previous, interrupted run exist and match the
+ * current pass list, load the snapshotted module and report how many passes
+ * it has already completed.
+ * @return The snapshotted module, or @c nullptr when there is nothing to
+ * resume from.
+ */
+std::unique_ptr<Module> loadCheckpointedModule(
+		LLVMContext& Context,
+		unsigned& passesCompleted)
+{
+	passesCompleted = 0;
+	if (CheckpointFile.empty())
+	{
+		return nullptr;
+	}
+
+	std::ifstream progress(CheckpointFile + ".progress");
+	std::string countLine;
+	std::string passListId;
+	if (!std::getline(progress, countLine)
+			|| !std::getline(progress, passListId))
+	{
+		return nullptr;
+	}
+
+	unsigned count = 0;
+	if (!retdec::utils::strToNum(countLine, count) || count == 0)
+	{
+		return nullptr;
+	}
+
+	if (passListId != getPassListId())
+	{
+		std::cerr << "Warning: ignoring checkpoint '" << CheckpointFile
+				<< "' recorded with a different pass list." << std::endl;
+		return nullptr;
+	}
+
+	SMDiagnostic Err;
+	std::unique_ptr<Module> M = parseIRFile(
+			CheckpointFile + ".bc",
+			Err,
+			Context);
+	if (M == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (!NoVerify && verifyModule(*M, &errs()))
+	{
+		throw std::runtime_error("checkpointed llvm::Module is broken");
+	}
+
+	passesCompleted = count;
+	return M;
+}
+
 /**
  * Create bitcode output file object.
  */
@@ -408,19 +828,11 @@ std::unique_ptr<tool_output_file> createAssemblyOutputFile()
 }
 
 /**
- * Real main -- it does all the work.
+ * Runs one decompilation job with the given command line. In daemon mode,
+ * this runs in a forked worker; otherwise it is just the rest of _main().
  */
-int _main(int argc, char **argv)
+int runJob(int argc, char **argv)
 {
-	std::transform (
-			llvmPasses.begin(),
-			llvmPasses.end(),
-			std::inserter(llvmPassesNormalized, llvmPassesNormalized.end()),
-			retdec::utils::toLower);
-
-	retdec::llvm_support::printPhase("Initialization");
-	initializeLlvmPasses();
-
 	cl::ParseCommandLineOptions(
 			argc,
 			argv,
@@ -429,8 +841,25 @@ int _main(int argc, char **argv)
 
 	limitMaximalMemoryIfRequested();
 
+	// Must happen before the measured work starts, so the phases of the run
+	// get recorded even when RETDEC_PROFILE is unset.
+	if (MemoryReport)
+	{
+		retdec::utils::instrumentation::enable();
+	}
+
 	LLVMContext Context;
-	std::unique_ptr<Module> M = createLlvmModule(Context);
+	unsigned passesCompleted = 0;
+	std::unique_ptr<Module> M = loadCheckpointedModule(Context, passesCompleted);
+	if (M == nullptr)
+	{
+		M = createLlvmModule(Context);
+	}
+	else
+	{
+		retdec::llvm_support::printPhase("Resuming from checkpoint after "
+				+ std::to_string(passesCompleted) + " passes");
+	}
 
 	// Add an appropriate TargetLibraryInfo pass for the module's triple.
 	Triple ModuleTriple(M->getTargetTriple());
@@ -453,9 +882,32 @@ int _main(int argc, char **argv)
 			createTargetTransformInfoWrapperPass(TargetIRAnalysis()));
 
 	// Create a new optimization pass for each one specified on the command line
+	std::set<std::string> checkpointAfter(
+			CheckpointAfter.begin(),
+			CheckpointAfter.end());
+	const std::vector<bool> passSkipMask = getPassSkipMask();
+	const bool recordPassStats = !PassStatsFile.empty();
 	for (unsigned i = 0; i < PassList.size(); ++i)
 	{
 		const PassInfo *PassInf = PassList[i];
+		std::string passArg = PassInf->getPassArgument();
+
+		// Passes completed before the checkpoint are skipped on resume.
+		// Provider initialization is the exception -- providers live only in
+		// memory, so the resumed run has to initialize them again (from the
+		// config persisted together with the checkpoint).
+		if (i < passesCompleted && passArg != "provider-init")
+		{
+			continue;
+		}
+
+		if (passSkipMask[i])
+		{
+			std::cerr << "Pipeline policy: skipping pass '" << passArg
+					<< "'." << std::endl;
+			continue;
+		}
+
 		Pass *P = nullptr;
 		if (PassInf->getTargetMachineCtor())
 		{
@@ -473,7 +925,25 @@ int _main(int argc, char **argv)
 
 		if (P)
 		{
+			if (recordPassStats)
+			{
+				Passes.add(new PassStatsBegin());
+			}
 			addPassWithPossibleVerification(Passes, P);
+			if (recordPassStats)
+			{
+				Passes.add(new PassStatsEnd(passArg));
+			}
+
+			if (!CheckpointFile.empty()
+					&& (checkpointAfter.empty()
+							|| checkpointAfter.count(passArg)))
+			{
+				addPassWithoutVerification(
+						Passes,
+						new CheckpointWriter(i + 1),
+						"Checkpoint");
+			}
 		}
 	}
 
@@ -491,14 +961,19 @@ int _main(int argc, char **argv)
 			Passes,
 			createBitcodeWriterPass(*bcOs, PreserveBitcodeUseListOrder));
 
-	// Write assembly to the output as the last step.
-	std::unique_ptr<tool_output_file> llOut = createAssemblyOutputFile();
-	raw_ostream *llOs = &llOut->os();
-	bool PreserveAssemblyUseListOrder = true;
-	addPassWithoutVerification(
-			Passes,
-			createPrintModulePass(*llOs, "", PreserveAssemblyUseListOrder),
-			"Assembly Writer"); // original name = "Print module to stderr"
+	// If requested, also write the module as textual IR. The bitcode above is
+	// what the next tool in the pipeline reads; the textual form is opt-in.
+	std::unique_ptr<tool_output_file> llOut;
+	if (EmitTextIr)
+	{
+		llOut = createAssemblyOutputFile();
+		raw_ostream *llOs = &llOut->os();
+		bool PreserveAssemblyUseListOrder = true;
+		addPassWithoutVerification(
+				Passes,
+				createPrintModulePass(*llOs, "", PreserveAssemblyUseListOrder),
+				"Assembly Writer"); // original name = "Print module to stderr"
+	}
 
 	// Before executing passes, print the final values of the LLVM options.
 	cl::PrintOptionValues();
@@ -509,10 +984,85 @@ int _main(int argc, char **argv)
 	// Declare success.
 	retdec::llvm_support::printPhase("Cleanup");
 	bcOut->keep();
-	llOut->keep();
+	if (llOut)
+	{
+		llOut->keep();
+	}
+
+	if (!CheckpointFile.empty())
+	{
+		// The run finished, so the checkpoint is no longer needed. Keeping it
+		// would also make another run with the same file skip all passes.
+		sys::fs::remove(CheckpointFile + ".bc");
+		sys::fs::remove(CheckpointFile + ".progress");
+	}
+
+	if (MemoryReport)
+	{
+		retdec::utils::instrumentation::printMemoryReport(std::cerr);
+	}
+
 	return EXIT_SUCCESS;
 }
 
+/**
+ * Real main -- it does all the work.
+ *
+ * The expensive, job-independent initialization happens here. In daemon
+ * mode (-daemon SOCKET), it is therefore paid once -- the jobs run in
+ * forked workers that inherit the initialized state and only pay for the
+ * decompilation itself.
+ */
+int _main(int argc, char **argv)
+{
+	// Must happen before the LLVM command-line parsing -- in daemon mode,
+	// the parsing runs in the workers, once per job.
+	const auto daemonSocket
+			= retdec::utils::JobServer::extractDaemonOption(argc, argv);
+
+	std::transform (
+			llvmPasses.begin(),
+			llvmPasses.end(),
+			std::inserter(llvmPassesNormalized, llvmPassesNormalized.end()),
+			retdec::utils::toLower);
+
+	retdec::llvm_support::printPhase("Initialization");
+	initializeLlvmPasses();
+
+	if (!daemonSocket.empty())
+	{
+		retdec::utils::JobServer server(daemonSocket);
+		if (!server.listenOn())
+		{
+			throw std::runtime_error(
+					"failed to listen on socket: " + daemonSocket);
+		}
+		return server.run([argv](const std::vector<std::string>& args)
+		{
+			auto jobArgs = args;
+			std::vector<char*> jobArgv;
+			jobArgv.push_back(argv[0]);
+			for (auto& arg : jobArgs)
+			{
+				jobArgv.push_back(&arg[0]);
+			}
+			try
+			{
+				return runJob(
+						static_cast<int>(jobArgv.size()),
+						jobArgv.data());
+			}
+			catch (const std::runtime_error& e)
+			{
+				std::cerr << "Error: " << e.what() << std::endl;
+				return int(EXIT_FAILURE);
+			}
+		});
+	}
+
+	return runJob(argc, argv);
+}
+
 /**
  * Main function -- calls real main and handles exceptions.
  */
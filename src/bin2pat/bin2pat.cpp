@@ -4,12 +4,15 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <ostream>
 #include <vector>
 
 #include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/thread_pool.h"
 #include "retdec/patterngen/pattern_extractor/pattern_extractor.h"
 #include "yaramod/yaramod.h"
 
@@ -97,11 +100,21 @@ int processArgs(
 	// Prepare builder.
 	yaramod::YaraFileBuilder builder;
 
-	// Process files.
-	unsigned index = 0;
+	// Extract patterns on a thread pool. Extraction of each file is
+	// independent, so archive members can be processed concurrently. Rules
+	// are added to the builder serially afterwards in input order, so the
+	// output does not depend on thread scheduling.
+	std::vector<std::unique_ptr<PatternExtractor>> extractors(inPaths.size());
+	parallelFor(inPaths.size(), [&](std::size_t i) {
+		extractors[i] = std::make_unique<PatternExtractor>(
+			inPaths[i], "file_" + std::to_string(i));
+	});
+
+	// Merge results deterministically.
 	bool atLeastOne = false;
-	for (const auto &path : inPaths) {
-		PatternExtractor extractor(path, "file_" + std::to_string(index++));
+	for (std::size_t i = 0, e = inPaths.size(); i < e; ++i) {
+		const auto &path = inPaths[i];
+		const auto &extractor = *extractors[i];
 
 		// Add rules if valid.
 		if (!extractor.isValid()) {
@@ -1159,11 +1159,9 @@ void Capstone2LlvmIrTranslatorArm::translateInstruction(
 		return;
 	}
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	auto f = i->id < ARM_INS_ENDING ? _i2fm.fns[i->id] : nullptr;
+	if (f != nullptr)
 	{
-		auto f = fIt->second;
-
 		bool branchInsn = i->id == ARM_INS_B || i->id == ARM_INS_BX
 				|| i->id == ARM_INS_BL || i->id == ARM_INS_BLX
 				|| i->id == ARM_INS_CBZ || i->id == ARM_INS_CBNZ;
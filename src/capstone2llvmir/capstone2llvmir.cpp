@@ -5,6 +5,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
@@ -33,6 +34,7 @@ Capstone2LlvmIrTranslator::Capstone2LlvmIrTranslator(
 
 Capstone2LlvmIrTranslator::~Capstone2LlvmIrTranslator()
 {
+	clearTranslationCache();
 	closeHandle();
 }
 
@@ -421,6 +423,20 @@ void Capstone2LlvmIrTranslator::generateEnvironment()
 	generateBranchFunction();
 	generateCondBranchFunction();
 
+	// Register maps are complete at this point -- pre-size the dense
+	// register cache once, so createRegister() fills it in a single pass
+	// without reallocations.
+	std::size_t regNum = _reg2name.empty()
+			? 0
+			: static_cast<std::size_t>(_reg2name.rbegin()->first) + 1;
+	if (!_reg2type.empty())
+	{
+		regNum = std::max(
+				regNum,
+				static_cast<std::size_t>(_reg2type.rbegin()->first) + 1);
+	}
+	_capstoneReg2llvmGv.assign(regNum, nullptr);
+
 	generateEnvironmentArchSpecific();
 	generateRegisters();
 	generateDataLayout();
@@ -810,8 +826,50 @@ Capstone2LlvmIrTranslator::TranslationResult Capstone2LlvmIrTranslator::translat
 		retdec::utils::Address a,
 		llvm::IRBuilder<>& irb,
 		bool stopOnBranch)
+{
+	return translateInternal(bytes, a, irb, stopOnBranch, 0, nullptr);
+}
+
+/**
+ * Translate a straight-line run of @a bytes at address @a a that the caller
+ * has already bounded. The whole run is emitted with a single builder setup
+ * and the result carries one entry per translated instruction.
+ * @param count Translate at most this many instructions, @c 0 -> no bound.
+ */
+Capstone2LlvmIrTranslator::BlockTranslationResult Capstone2LlvmIrTranslator::translateBlock(
+		const std::vector<uint8_t>& bytes,
+		retdec::utils::Address a,
+		llvm::IRBuilder<>& irb,
+		std::size_t count,
+		bool stopOnBranch)
+{
+	BlockTranslationResult res;
+	res.block = translateInternal(
+			bytes,
+			a,
+			irb,
+			stopOnBranch,
+			count,
+			&res.instructions);
+	return res;
+}
+
+/**
+ * Common worker of @c translate() and @c translateBlock().
+ * @param count Translate at most this many instructions, @c 0 -> no bound.
+ * @param insns If not @c nullptr, one entry per translated instruction is
+ *              appended here.
+ */
+Capstone2LlvmIrTranslator::TranslationResult Capstone2LlvmIrTranslator::translateInternal(
+		const std::vector<uint8_t>& bytes,
+		retdec::utils::Address a,
+		llvm::IRBuilder<>& irb,
+		bool stopOnBranch,
+		std::size_t count,
+		std::vector<std::pair<llvm::StoreInst*, cs_insn*>>* insns)
 {
 	TranslationResult res;
+	std::size_t translated = 0;
 
 	cs_insn* insn = cs_malloc(_handle);
 
@@ -840,8 +898,22 @@ Capstone2LlvmIrTranslator::TranslationResult Capstone2LlvmIrTranslator::translat
 		}
 		res.last = a2l;
 		res.size = (insn->address + insn->size) - a;
+		++translated;
+		if (insns)
+		{
+			insns->emplace_back(a2l, insn);
+		}
 
-		translateInstruction(insn, irb);
+		if (!translateFromCache(insn, irb))
+		{
+			auto* bodyBb = irb.GetInsertBlock();
+			auto* lastBefore = bodyBb->empty() ? nullptr : &bodyBb->back();
+			auto* branchBefore = _branchGenerated;
+
+			translateInstruction(insn, irb);
+
+			addToTranslationCache(insn, irb, bodyBb, lastBefore, branchBefore);
+		}
 
 		// TODO: Optimize -- to make generation easier and nicer, some things
 		// can be generated suboptimally. We should inspect every generated
@@ -875,6 +947,22 @@ Capstone2LlvmIrTranslator::TranslationResult Capstone2LlvmIrTranslator::translat
 		{
 			res.branchCall = _branchGenerated;
 			res.inCondition = _inCondition;
+			if (!_inCondition)
+			{
+				res.delaySlots = translateDelaySlots(
+						insn->id,
+						&code,
+						&size,
+						&address,
+						a,
+						irb,
+						res,
+						insns);
+			}
+			return res;
+		}
+		if (count != 0 && translated == count)
+		{
 			return res;
 		}
 
@@ -898,6 +986,248 @@ Capstone2LlvmIrTranslator::TranslationResult Capstone2LlvmIrTranslator::translat
 	return res;
 }
 
+/**
+ * Finish a straight-line run that ended on a branch with a delay slot:
+ * keep disassembling the caller-provided Capstone iteration state and
+ * translate the slot instruction(s) right after the branch pseudo call,
+ * which is exactly where a separate decoding step would have put them.
+ * This saves the decoder one full jump-target round trip per branch on
+ * delay-slot architectures (i.e. one per basic block on MIPS).
+ *
+ * An undecodable instruction, or another control-flow instruction, in the
+ * slot is left alone -- the caller has to resolve such a slot itself.
+ *
+ * @param branchInsnId Capstone id of the branch that ended the run.
+ * @return Number of delay slot instructions translated. @a res is updated
+ *         accordingly (@c last, @c size).
+ */
+std::size_t Capstone2LlvmIrTranslator::translateDelaySlots(
+		uint32_t branchInsnId,
+		const uint8_t** code,
+		std::size_t* size,
+		uint64_t* address,
+		retdec::utils::Address a,
+		llvm::IRBuilder<>& irb,
+		TranslationResult& res,
+		std::vector<std::pair<llvm::StoreInst*, cs_insn*>>* insns)
+{
+	std::size_t translated = 0;
+	std::size_t ds = getDelaySlot(branchInsnId);
+
+	while (translated < ds)
+	{
+		cs_insn* insn = cs_malloc(_handle);
+		if (!cs_disasm_iter(_handle, code, size, address, insn)
+				|| hasDelaySlot(insn->id))
+		{
+			cs_free(insn, 1);
+			break;
+		}
+
+		auto* a2l = generateSpecialAsm2LlvmInstr(irb, insn);
+		res.last = a2l;
+		res.size = (insn->address + insn->size) - a;
+		++translated;
+		if (insns)
+		{
+			insns->emplace_back(a2l, insn);
+		}
+
+		if (!translateFromCache(insn, irb))
+		{
+			auto* bodyBb = irb.GetInsertBlock();
+			auto* lastBefore = bodyBb->empty() ? nullptr : &bodyBb->back();
+			auto* branchBefore = _branchGenerated;
+
+			translateInstruction(insn, irb);
+
+			addToTranslationCache(insn, irb, bodyBb, lastBefore, branchBefore);
+		}
+	}
+
+	return translated;
+}
+
+/**
+ * @return Cache key of instruction @a i -- basic mode + raw encoding bytes.
+ */
+std::string Capstone2LlvmIrTranslator::getTranslationCacheKey(cs_insn* i) const
+{
+	std::string key = std::to_string(static_cast<int>(_basicMode));
+	key += ':';
+	key.append(reinterpret_cast<const char*>(i->bytes), i->size);
+	return key;
+}
+
+/**
+ * Structurally compare two translations. @c True if they consist of the same
+ * operations and every operand is either the very same value (constants,
+ * globals, asm pseudo-functions) or the result of the corresponding earlier
+ * instruction of the own sequence.
+ */
+bool Capstone2LlvmIrTranslator::isSameTranslation(
+		const std::vector<llvm::Instruction*>& a,
+		const std::vector<llvm::Instruction*>& b)
+{
+	if (a.size() != b.size())
+	{
+		return false;
+	}
+
+	std::map<const llvm::Value*, const llvm::Value*> a2b;
+	for (std::size_t k = 0; k < a.size(); ++k)
+	{
+		auto* ai = a[k];
+		auto* bi = b[k];
+		if (!ai->isSameOperationAs(bi))
+		{
+			return false;
+		}
+		for (unsigned j = 0, e = ai->getNumOperands(); j < e; ++j)
+		{
+			auto* av = ai->getOperand(j);
+			auto* bv = bi->getOperand(j);
+			if (av == bv)
+			{
+				continue;
+			}
+			auto mIt = a2b.find(av);
+			if (mIt == a2b.end() || mIt->second != bv)
+			{
+				return false;
+			}
+		}
+		a2b.emplace(ai, bi);
+	}
+	return true;
+}
+
+/**
+ * If a reusable translation of instruction @a i is cached, clone it into the
+ * current insert point of @a irb and return @c true. Return @c false if the
+ * instruction has to go through the full translation routine.
+ */
+bool Capstone2LlvmIrTranslator::translateFromCache(
+		cs_insn* i,
+		llvm::IRBuilder<>& irb)
+{
+	auto fIt = _translationCache.find(getTranslationCacheKey(i));
+	if (fIt == _translationCache.end() || !fIt->second.cacheable)
+	{
+		return false;
+	}
+
+	std::map<llvm::Value*, llvm::Value*> v2v;
+	for (auto* ti : fIt->second.insns)
+	{
+		auto* c = ti->clone();
+		for (unsigned j = 0, e = c->getNumOperands(); j < e; ++j)
+		{
+			auto vIt = v2v.find(c->getOperand(j));
+			if (vIt != v2v.end())
+			{
+				c->setOperand(j, vIt->second);
+			}
+		}
+		irb.Insert(c);
+		v2v.emplace(ti, c);
+	}
+	return true;
+}
+
+/**
+ * Decide if the translation of instruction @a i that was just generated into
+ * @a bodyBb (after @a lastBefore, @c nullptr -> from the block's beginning)
+ * can be reused for other occurrences of the same encoding, and if so, cache
+ * it. Branching and multi-block translations are never reused. Address
+ * dependence is detected by translating the encoding once more at a shifted
+ * address and structurally comparing both results.
+ */
+void Capstone2LlvmIrTranslator::addToTranslationCache(
+		cs_insn* i,
+		llvm::IRBuilder<>& irb,
+		llvm::BasicBlock* bodyBb,
+		llvm::Instruction* lastBefore,
+		llvm::CallInst* branchBefore)
+{
+	auto& entry = _translationCache[getTranslationCacheKey(i)];
+	if (entry.evaluated)
+	{
+		return;
+	}
+	// Mark the entry evaluated whatever the outcome below, so the probe
+	// (body collection, scratch re-translation, structural compare) runs at
+	// most once per encoding.
+	entry.evaluated = true;
+
+	if (_branchGenerated != branchBefore || irb.GetInsertBlock() != bodyBb)
+	{
+		return;
+	}
+
+	std::vector<llvm::Instruction*> body;
+	auto it = lastBefore
+			? ++llvm::BasicBlock::iterator(lastBefore)
+			: bodyBb->begin();
+	for (; it != bodyBb->end(); ++it)
+	{
+		body.push_back(&*it);
+	}
+
+	auto* savedBranch = _branchGenerated;
+	bool savedInCondition = _inCondition;
+	uint64_t savedAddr = i->address;
+
+	i->address = savedAddr + 0x1000;
+	auto* scratchBb = llvm::BasicBlock::Create(_module->getContext());
+	llvm::IRBuilder<> scratchIrb(scratchBb);
+	translateInstruction(i, scratchIrb);
+
+	i->address = savedAddr;
+	_branchGenerated = savedBranch;
+	_inCondition = savedInCondition;
+
+	std::vector<llvm::Instruction*> scratch;
+	for (auto& si : *scratchBb)
+	{
+		scratch.push_back(&si);
+	}
+
+	if (isSameTranslation(body, scratch))
+	{
+		// The scratch instructions become the unparented template.
+		entry.insns.reserve(scratch.size());
+		for (auto* si : scratch)
+		{
+			si->removeFromParent();
+			entry.insns.push_back(si);
+		}
+		entry.cacheable = true;
+	}
+
+	// Deletes any instructions still in the block.
+	delete scratchBb;
+}
+
+/**
+ * Free all cached translation templates.
+ */
+void Capstone2LlvmIrTranslator::clearTranslationCache()
+{
+	for (auto& p : _translationCache)
+	{
+		for (auto* i : p.second.insns)
+		{
+			i->dropAllReferences();
+		}
+		for (auto* i : p.second.insns)
+		{
+			delete i;
+		}
+	}
+	_translationCache.clear();
+}
+
 llvm::GlobalVariable* Capstone2LlvmIrTranslator::createRegister(
 		uint32_t r,
 		llvm::GlobalValue::LinkageTypes lt,
@@ -936,6 +1266,12 @@ llvm::GlobalVariable* Capstone2LlvmIrTranslator::createRegister(
 
 	_allLlvmRegs[gv] = r;
 
+	if (r >= _capstoneReg2llvmGv.size())
+	{
+		_capstoneReg2llvmGv.resize(r + 1, nullptr);
+	}
+	_capstoneReg2llvmGv[r] = gv;
+
 	return gv;
 }
 
@@ -1012,13 +1348,21 @@ llvm::Type* Capstone2LlvmIrTranslator::getRegisterType(uint32_t r) const
 }
 
 /**
- * If this becomes a bottleneck it could be optimized using cache.
- * Either local cache here initialized as this method is used,
- * or global cache initialized at register generation.
+ * Registers created by @c createRegister() are resolved by a plain index
+ * into the dense register cache. Only registers the translator did not
+ * create itself go through the name-based module lookup.
  * @return LLVM global for the specified register, or @c nullptr if not found.
  */
 llvm::GlobalVariable* Capstone2LlvmIrTranslator::getRegister(uint32_t r)
 {
+	if (r < _capstoneReg2llvmGv.size())
+	{
+		if (auto* gv = _capstoneReg2llvmGv[r])
+		{
+			return gv;
+		}
+	}
+
 	auto rn = getRegisterName(r);
 	return _module->getNamedGlobal(rn);
 }
@@ -241,645 +241,647 @@ void Capstone2LlvmIrTranslatorMips::initializeArchSpecific()
 	// Nothing.
 }
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorMips::*)(cs_insn* i, cs_mips*, llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorMips::_i2fm =
+constexpr Capstone2LlvmIrTranslatorMips::DispatchTable Capstone2LlvmIrTranslatorMips::makeDispatchTable()
 {
-		{MIPS_INS_INVALID, nullptr},
+	DispatchTable t = {};
 
-		{MIPS_INS_ABSQ_S, nullptr},
-		{MIPS_INS_ADD, &Capstone2LlvmIrTranslatorMips::translateAdd},
-		{MIPS_INS_ADDIUPC, nullptr},
-		{MIPS_INS_ADDIUR1SP, nullptr},
-		{MIPS_INS_ADDIUR2, nullptr},
-		{MIPS_INS_ADDIUS5, nullptr},
-		{MIPS_INS_ADDIUSP, nullptr},
-		{MIPS_INS_ADDQH, nullptr},
-		{MIPS_INS_ADDQH_R, nullptr},
-		{MIPS_INS_ADDQ, nullptr},
-		{MIPS_INS_ADDQ_S, nullptr},
-		{MIPS_INS_ADDSC, nullptr},
-		{MIPS_INS_ADDS_A, nullptr},
-		{MIPS_INS_ADDS_S, nullptr},
-		{MIPS_INS_ADDS_U, nullptr},
-		{MIPS_INS_ADDU16, nullptr},
-		{MIPS_INS_ADDUH, nullptr},
-		{MIPS_INS_ADDUH_R, nullptr},
-		{MIPS_INS_ADDU, &Capstone2LlvmIrTranslatorMips::translateAdd},
-		{MIPS_INS_ADDU_S, nullptr},
-		{MIPS_INS_ADDVI, nullptr},
-		{MIPS_INS_ADDV, nullptr},
-		{MIPS_INS_ADDWC, nullptr},
-		{MIPS_INS_ADD_A, nullptr},
-		{MIPS_INS_ADDI, &Capstone2LlvmIrTranslatorMips::translateAdd},
-		{MIPS_INS_ADDIU, &Capstone2LlvmIrTranslatorMips::translateAdd},
-		{MIPS_INS_ALIGN, nullptr},
-		{MIPS_INS_ALUIPC, nullptr},
-		{MIPS_INS_AND, &Capstone2LlvmIrTranslatorMips::translateAnd},
-		{MIPS_INS_AND16, nullptr},
-		{MIPS_INS_ANDI16, nullptr},
-		{MIPS_INS_ANDI, &Capstone2LlvmIrTranslatorMips::translateAnd},
-		{MIPS_INS_APPEND, nullptr},
-		{MIPS_INS_ASUB_S, nullptr},
-		{MIPS_INS_ASUB_U, nullptr},
-		{MIPS_INS_AUI, nullptr},
-		{MIPS_INS_AUIPC, nullptr},
-		{MIPS_INS_AVER_S, nullptr},
-		{MIPS_INS_AVER_U, nullptr},
-		{MIPS_INS_AVE_S, nullptr},
-		{MIPS_INS_AVE_U, nullptr},
-		{MIPS_INS_B16, nullptr},
-		{MIPS_INS_BADDU, nullptr},
-		{MIPS_INS_BAL, nullptr},
-		{MIPS_INS_BALC, nullptr},
-		{MIPS_INS_BALIGN, nullptr},
-		{MIPS_INS_BBIT0, nullptr},
-		{MIPS_INS_BBIT032, nullptr},
-		{MIPS_INS_BBIT1, nullptr},
-		{MIPS_INS_BBIT132, nullptr},
-		{MIPS_INS_BC, nullptr},
-		{MIPS_INS_BC0F, nullptr},
-		{MIPS_INS_BC0FL, nullptr},
-		{MIPS_INS_BC0T, nullptr},
-		{MIPS_INS_BC0TL, nullptr},
-		{MIPS_INS_BC1EQZ, nullptr},
-		{MIPS_INS_BC1F, &Capstone2LlvmIrTranslatorMips::translateBc1f},
-		{MIPS_INS_BC1FL, &Capstone2LlvmIrTranslatorMips::translateBc1f},
-		{MIPS_INS_BC1NEZ, nullptr},
-		{MIPS_INS_BC1T, &Capstone2LlvmIrTranslatorMips::translateBc1t},
-		{MIPS_INS_BC1TL, &Capstone2LlvmIrTranslatorMips::translateBc1t},
-		{MIPS_INS_BC2EQZ, nullptr},
-		{MIPS_INS_BC2F, nullptr},
-		{MIPS_INS_BC2FL, nullptr},
-		{MIPS_INS_BC2NEZ, nullptr},
-		{MIPS_INS_BC2T, nullptr},
-		{MIPS_INS_BC2TL, nullptr},
-		{MIPS_INS_BC3F, nullptr},
-		{MIPS_INS_BC3FL, nullptr},
-		{MIPS_INS_BC3T, nullptr},
-		{MIPS_INS_BC3TL, nullptr},
-		{MIPS_INS_BCLRI, nullptr},
-		{MIPS_INS_BCLR, nullptr},
-		{MIPS_INS_BEQ, &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary},
-		{MIPS_INS_BEQC, nullptr},
-		{MIPS_INS_BEQL, &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary},
-		{MIPS_INS_BEQZ16, nullptr},
-		{MIPS_INS_BEQZALC, nullptr},
-		{MIPS_INS_BEQZC, nullptr},
-		{MIPS_INS_BGEC, nullptr},
-		{MIPS_INS_BGEUC, nullptr},
-		{MIPS_INS_BGEZ, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BGEZAL, &Capstone2LlvmIrTranslatorMips::translateBcondal},
-		{MIPS_INS_BGEZALC, nullptr},
-		{MIPS_INS_BGEZALL, &Capstone2LlvmIrTranslatorMips::translateBcondal},
-		{MIPS_INS_BGEZALS, nullptr},
-		{MIPS_INS_BGEZC, nullptr},
-		{MIPS_INS_BGEZL, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BGTZ, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BGTZALC, nullptr},
-		{MIPS_INS_BGTZC, nullptr},
-		{MIPS_INS_BGTZL, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BINSLI, nullptr},
-		{MIPS_INS_BINSL, nullptr},
-		{MIPS_INS_BINSRI, nullptr},
-		{MIPS_INS_BINSR, nullptr},
-		{MIPS_INS_BITREV, &Capstone2LlvmIrTranslatorMips::translateBitrev},
-		{MIPS_INS_BITSWAP, nullptr},
-		{MIPS_INS_BLEZ, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BLEZALC, nullptr},
-		{MIPS_INS_BLEZC, nullptr},
-		{MIPS_INS_BLEZL, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BLTC, nullptr},
-		{MIPS_INS_BLTUC, nullptr},
-		{MIPS_INS_BLTZ, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BLTZAL, &Capstone2LlvmIrTranslatorMips::translateBcondal},
-		{MIPS_INS_BLTZALC, nullptr},
-		{MIPS_INS_BLTZALL, &Capstone2LlvmIrTranslatorMips::translateBcondal},
-		{MIPS_INS_BLTZALS, nullptr},
-		{MIPS_INS_BLTZC, nullptr},
-		{MIPS_INS_BLTZL, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BMNZI, nullptr},
-		{MIPS_INS_BMNZ, nullptr},
-		{MIPS_INS_BMZI, nullptr},
-		{MIPS_INS_BMZ, nullptr},
-		{MIPS_INS_BNE, &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary},
-		{MIPS_INS_BNEC, nullptr},
-		{MIPS_INS_BNEGI, nullptr},
-		{MIPS_INS_BNEG, nullptr},
-		{MIPS_INS_BNEL, &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary},
-		{MIPS_INS_BNEZ16, nullptr},
-		{MIPS_INS_BNEZALC, nullptr},
-		{MIPS_INS_BNEZC, nullptr},
-		{MIPS_INS_BNVC, nullptr},
-		{MIPS_INS_BNZ, nullptr},
-		{MIPS_INS_BOVC, nullptr},
-		{MIPS_INS_BPOSGE32, nullptr},
-		{MIPS_INS_BREAK, &Capstone2LlvmIrTranslatorMips::translateBreak},
-		{MIPS_INS_BREAK16, nullptr},
-		{MIPS_INS_BSELI, nullptr},
-		{MIPS_INS_BSEL, nullptr},
-		{MIPS_INS_BSETI, nullptr},
-		{MIPS_INS_BSET, nullptr},
-		{MIPS_INS_BZ, nullptr},
-		{MIPS_INS_BEQZ, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_B, nullptr},
-		{MIPS_INS_BNEZ, &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary},
-		{MIPS_INS_BTEQZ, nullptr},
-		{MIPS_INS_BTNEZ, nullptr},
-		{MIPS_INS_CACHE, nullptr},
-		{MIPS_INS_CEIL, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_CEQI, nullptr},
-		{MIPS_INS_CEQ, nullptr},
-		{MIPS_INS_CFC1, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_CFCMSA, nullptr},
-		{MIPS_INS_CINS, nullptr},
-		{MIPS_INS_CINS32, nullptr},
-		{MIPS_INS_CLASS, nullptr},
-		{MIPS_INS_CLEI_S, nullptr},
-		{MIPS_INS_CLEI_U, nullptr},
-		{MIPS_INS_CLE_S, nullptr},
-		{MIPS_INS_CLE_U, nullptr},
-		{MIPS_INS_CLO, &Capstone2LlvmIrTranslatorMips::translateClo},
-		{MIPS_INS_CLTI_S, nullptr},
-		{MIPS_INS_CLTI_U, nullptr},
-		{MIPS_INS_CLT_S, nullptr},
-		{MIPS_INS_CLT_U, nullptr},
-		{MIPS_INS_CLZ, &Capstone2LlvmIrTranslatorMips::translateClz},
-		{MIPS_INS_CMPGDU, nullptr},
-		{MIPS_INS_CMPGU, nullptr},
-		{MIPS_INS_CMPU, nullptr},
-		{MIPS_INS_CMP, nullptr},
-		{MIPS_INS_COPY_S, nullptr},
-		{MIPS_INS_COPY_U, nullptr},
-		{MIPS_INS_CTC1, &Capstone2LlvmIrTranslatorMips::translateCtc1},
-		{MIPS_INS_CTCMSA, nullptr},
-		{MIPS_INS_CVT, &Capstone2LlvmIrTranslatorMips::translateCvt},
-		{MIPS_INS_C, &Capstone2LlvmIrTranslatorMips::translateC},
-		{MIPS_INS_CMPI, nullptr},
-		{MIPS_INS_DADD, nullptr},
-		{MIPS_INS_DADDI, nullptr},
-		{MIPS_INS_DADDIU, nullptr},
-		{MIPS_INS_DADDU, nullptr},
-		{MIPS_INS_DAHI, nullptr},
-		{MIPS_INS_DALIGN, nullptr},
-		{MIPS_INS_DATI, nullptr},
-		{MIPS_INS_DAUI, nullptr},
-		{MIPS_INS_DBITSWAP, nullptr},
-		{MIPS_INS_DCLO, nullptr},
-		{MIPS_INS_DCLZ, nullptr},
-		{MIPS_INS_DDIV, nullptr},
-		{MIPS_INS_DDIVU, nullptr},
-		{MIPS_INS_DERET, nullptr},
-		{MIPS_INS_DEXT, nullptr},
-		{MIPS_INS_DEXTM, nullptr},
-		{MIPS_INS_DEXTU, nullptr},
-		{MIPS_INS_DI, nullptr},
-		{MIPS_INS_DINS, nullptr},
-		{MIPS_INS_DINSM, nullptr},
-		{MIPS_INS_DINSU, nullptr},
-		{MIPS_INS_DIV, &Capstone2LlvmIrTranslatorMips::translateDiv},
-		{MIPS_INS_DIVU, &Capstone2LlvmIrTranslatorMips::translateDivu},
-		{MIPS_INS_DIV_S, nullptr},
-		{MIPS_INS_DIV_U, nullptr},
-		{MIPS_INS_DLSA, nullptr},
-		{MIPS_INS_DMFC0, nullptr},
-		{MIPS_INS_DMFC1, nullptr},
-		{MIPS_INS_DMFC2, nullptr},
-		{MIPS_INS_DMOD, nullptr},
-		{MIPS_INS_DMODU, nullptr},
-		{MIPS_INS_DMTC0, nullptr},
-		{MIPS_INS_DMTC1, nullptr},
-		{MIPS_INS_DMTC2, nullptr},
-		{MIPS_INS_DMUH, nullptr},
-		{MIPS_INS_DMUHU, nullptr},
-		{MIPS_INS_DMUL, nullptr},
-		{MIPS_INS_DMULT, nullptr},
-		{MIPS_INS_DMULTU, nullptr},
-		{MIPS_INS_DMULU, nullptr},
-		{MIPS_INS_DOTP_S, nullptr},
-		{MIPS_INS_DOTP_U, nullptr},
-		{MIPS_INS_DPADD_S, nullptr},
-		{MIPS_INS_DPADD_U, nullptr},
-		{MIPS_INS_DPAQX_SA, nullptr},
-		{MIPS_INS_DPAQX_S, nullptr},
-		{MIPS_INS_DPAQ_SA, nullptr},
-		{MIPS_INS_DPAQ_S, nullptr},
-		{MIPS_INS_DPAU, nullptr},
-		{MIPS_INS_DPAX, nullptr},
-		{MIPS_INS_DPA, nullptr},
-		{MIPS_INS_DPOP, nullptr},
-		{MIPS_INS_DPSQX_SA, nullptr},
-		{MIPS_INS_DPSQX_S, nullptr},
-		{MIPS_INS_DPSQ_SA, nullptr},
-		{MIPS_INS_DPSQ_S, nullptr},
-		{MIPS_INS_DPSUB_S, nullptr},
-		{MIPS_INS_DPSUB_U, nullptr},
-		{MIPS_INS_DPSU, nullptr},
-		{MIPS_INS_DPSX, nullptr},
-		{MIPS_INS_DPS, nullptr},
-		{MIPS_INS_DROTR, nullptr},
-		{MIPS_INS_DROTR32, nullptr},
-		{MIPS_INS_DROTRV, nullptr},
-		{MIPS_INS_DSBH, nullptr},
-		{MIPS_INS_DSHD, nullptr},
-		{MIPS_INS_DSLL, nullptr},
-		{MIPS_INS_DSLL32, nullptr},
-		{MIPS_INS_DSLLV, nullptr},
-		{MIPS_INS_DSRA, nullptr},
-		{MIPS_INS_DSRA32, nullptr},
-		{MIPS_INS_DSRAV, nullptr},
-		{MIPS_INS_DSRL, nullptr},
-		{MIPS_INS_DSRL32, nullptr},
-		{MIPS_INS_DSRLV, nullptr},
-		{MIPS_INS_DSUB, nullptr},
-		{MIPS_INS_DSUBU, nullptr},
-		{MIPS_INS_EHB, nullptr},
-		{MIPS_INS_EI, nullptr},
-		{MIPS_INS_ERET, nullptr},
-		{MIPS_INS_EXT, &Capstone2LlvmIrTranslatorMips::translateExt},
-		{MIPS_INS_EXTP, nullptr},
-		{MIPS_INS_EXTPDP, nullptr},
-		{MIPS_INS_EXTPDPV, nullptr},
-		{MIPS_INS_EXTPV, nullptr},
-		{MIPS_INS_EXTRV_RS, nullptr},
-		{MIPS_INS_EXTRV_R, nullptr},
-		{MIPS_INS_EXTRV_S, nullptr},
-		{MIPS_INS_EXTRV, nullptr},
-		{MIPS_INS_EXTR_RS, nullptr},
-		{MIPS_INS_EXTR_R, nullptr},
-		{MIPS_INS_EXTR_S, nullptr},
-		{MIPS_INS_EXTR, nullptr},
-		{MIPS_INS_EXTS, nullptr},
-		{MIPS_INS_EXTS32, nullptr},
-		{MIPS_INS_ABS, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_FADD, nullptr},
-		{MIPS_INS_FCAF, nullptr},
-		{MIPS_INS_FCEQ, nullptr},
-		{MIPS_INS_FCLASS, nullptr},
-		{MIPS_INS_FCLE, nullptr},
-		{MIPS_INS_FCLT, nullptr},
-		{MIPS_INS_FCNE, nullptr},
-		{MIPS_INS_FCOR, nullptr},
-		{MIPS_INS_FCUEQ, nullptr},
-		{MIPS_INS_FCULE, nullptr},
-		{MIPS_INS_FCULT, nullptr},
-		{MIPS_INS_FCUNE, nullptr},
-		{MIPS_INS_FCUN, nullptr},
-		{MIPS_INS_FDIV, nullptr},
-		{MIPS_INS_FEXDO, nullptr},
-		{MIPS_INS_FEXP2, nullptr},
-		{MIPS_INS_FEXUPL, nullptr},
-		{MIPS_INS_FEXUPR, nullptr},
-		{MIPS_INS_FFINT_S, nullptr},
-		{MIPS_INS_FFINT_U, nullptr},
-		{MIPS_INS_FFQL, nullptr},
-		{MIPS_INS_FFQR, nullptr},
-		{MIPS_INS_FILL, nullptr},
-		{MIPS_INS_FLOG2, nullptr},
-		{MIPS_INS_FLOOR, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_FMADD, nullptr},
-		{MIPS_INS_FMAX_A, nullptr},
-		{MIPS_INS_FMAX, nullptr},
-		{MIPS_INS_FMIN_A, nullptr},
-		{MIPS_INS_FMIN, nullptr},
-		{MIPS_INS_MOV, &Capstone2LlvmIrTranslatorMips::translateMov},
-		{MIPS_INS_FMSUB, nullptr},
-		{MIPS_INS_FMUL, nullptr},
-		{MIPS_INS_MUL, &Capstone2LlvmIrTranslatorMips::translateMul},
-		{MIPS_INS_NEG, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_FRCP, nullptr},
-		{MIPS_INS_FRINT, nullptr},
-		{MIPS_INS_FRSQRT, nullptr},
-		{MIPS_INS_FSAF, nullptr},
-		{MIPS_INS_FSEQ, nullptr},
-		{MIPS_INS_FSLE, nullptr},
-		{MIPS_INS_FSLT, nullptr},
-		{MIPS_INS_FSNE, nullptr},
-		{MIPS_INS_FSOR, nullptr},
-		{MIPS_INS_FSQRT, nullptr},
-		{MIPS_INS_SQRT, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_FSUB, nullptr},
-		{MIPS_INS_SUB, &Capstone2LlvmIrTranslatorMips::translateSub},
-		{MIPS_INS_FSUEQ, nullptr},
-		{MIPS_INS_FSULE, nullptr},
-		{MIPS_INS_FSULT, nullptr},
-		{MIPS_INS_FSUNE, nullptr},
-		{MIPS_INS_FSUN, nullptr},
-		{MIPS_INS_FTINT_S, nullptr},
-		{MIPS_INS_FTINT_U, nullptr},
-		{MIPS_INS_FTQ, nullptr},
-		{MIPS_INS_FTRUNC_S, nullptr},
-		{MIPS_INS_FTRUNC_U, nullptr},
-		{MIPS_INS_HADD_S, nullptr},
-		{MIPS_INS_HADD_U, nullptr},
-		{MIPS_INS_HSUB_S, nullptr},
-		{MIPS_INS_HSUB_U, nullptr},
-		{MIPS_INS_ILVEV, nullptr},
-		{MIPS_INS_ILVL, nullptr},
-		{MIPS_INS_ILVOD, nullptr},
-		{MIPS_INS_ILVR, nullptr},
-		{MIPS_INS_INS, &Capstone2LlvmIrTranslatorMips::translateIns},
-		{MIPS_INS_INSERT, nullptr},
-		{MIPS_INS_INSV, nullptr},
-		{MIPS_INS_INSVE, nullptr},
-		{MIPS_INS_J, &Capstone2LlvmIrTranslatorMips::translateJ},
-		{MIPS_INS_JAL, &Capstone2LlvmIrTranslatorMips::translateJal},
-		{MIPS_INS_JALR, &Capstone2LlvmIrTranslatorMips::translateJal},
-		{MIPS_INS_JALRS16, nullptr},
-		{MIPS_INS_JALRS, nullptr},
-		{MIPS_INS_JALS, nullptr},
-		{MIPS_INS_JALX, nullptr},
-		{MIPS_INS_JIALC, nullptr},
-		{MIPS_INS_JIC, nullptr},
-		{MIPS_INS_JR, &Capstone2LlvmIrTranslatorMips::translateJ},
-		{MIPS_INS_JR16, nullptr},
-		{MIPS_INS_JRADDIUSP, nullptr},
-		{MIPS_INS_JRC, nullptr},
-		{MIPS_INS_JALRC, nullptr},
-		{MIPS_INS_LB, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LBU16, nullptr},
-		{MIPS_INS_LBUX, nullptr},
-		{MIPS_INS_LBU, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LD, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LDC1, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LDC2, nullptr},
-		{MIPS_INS_LDC3, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LDI, nullptr},
-		{MIPS_INS_LDL, nullptr},
-		{MIPS_INS_LDPC, nullptr},
-		{MIPS_INS_LDR, nullptr},
-		{MIPS_INS_LDXC1, nullptr},
-		{MIPS_INS_LH, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LHU16, nullptr},
-		{MIPS_INS_LHX, nullptr},
-		{MIPS_INS_LHU, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LI16, nullptr},
-		{MIPS_INS_LL, nullptr},
-		{MIPS_INS_LLD, nullptr},
-		{MIPS_INS_LSA, nullptr},
-		{MIPS_INS_LUXC1, nullptr},
-		{MIPS_INS_LUI, &Capstone2LlvmIrTranslatorMips::translateLui},
-		{MIPS_INS_LW, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LW16, nullptr},
-		{MIPS_INS_LWC1, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LWC2, nullptr},
-		{MIPS_INS_LWC3, nullptr},
-		{MIPS_INS_LWL, &Capstone2LlvmIrTranslatorMips::translateLwl},
-		{MIPS_INS_LWM16, nullptr},
-		{MIPS_INS_LWM32, nullptr},
-		{MIPS_INS_LWPC, nullptr},
-		{MIPS_INS_LWP, nullptr},
-		{MIPS_INS_LWR, &Capstone2LlvmIrTranslatorMips::translateLwr},
-		{MIPS_INS_LWUPC, nullptr},
-		{MIPS_INS_LWU, &Capstone2LlvmIrTranslatorMips::translateLoadMemory},
-		{MIPS_INS_LWX, nullptr},
-		{MIPS_INS_LWXC1, nullptr},
-		{MIPS_INS_LWXS, nullptr},
-		{MIPS_INS_LI, nullptr},
-		{MIPS_INS_MADD, &Capstone2LlvmIrTranslatorMips::translateMadd},
-		{MIPS_INS_MADDF, nullptr},
-		{MIPS_INS_MADDR_Q, nullptr},
-		{MIPS_INS_MADDU, &Capstone2LlvmIrTranslatorMips::translateMadd},
-		{MIPS_INS_MADDV, nullptr},
-		{MIPS_INS_MADD_Q, nullptr},
-		{MIPS_INS_MAQ_SA, nullptr},
-		{MIPS_INS_MAQ_S, nullptr},
-		{MIPS_INS_MAXA, nullptr},
-		{MIPS_INS_MAXI_S, nullptr},
-		{MIPS_INS_MAXI_U, nullptr},
-		{MIPS_INS_MAX_A, nullptr},
-		{MIPS_INS_MAX, &Capstone2LlvmIrTranslatorMips::translateMax},
-		{MIPS_INS_MAX_S, nullptr},
-		{MIPS_INS_MAX_U, nullptr},
-		{MIPS_INS_MFC0, nullptr},
-		{MIPS_INS_MFC1, &Capstone2LlvmIrTranslatorMips::translateMfc1},
-		{MIPS_INS_MFC2, nullptr},
-		{MIPS_INS_MFHC1, nullptr},
-		{MIPS_INS_MFHI, &Capstone2LlvmIrTranslatorMips::translateMfhi},
-		{MIPS_INS_MFLO, &Capstone2LlvmIrTranslatorMips::translateMflo},
-		{MIPS_INS_MINA, nullptr},
-		{MIPS_INS_MINI_S, nullptr},
-		{MIPS_INS_MINI_U, nullptr},
-		{MIPS_INS_MIN_A, nullptr},
-		{MIPS_INS_MIN, &Capstone2LlvmIrTranslatorMips::translateMin},
-		{MIPS_INS_MIN_S, nullptr},
-		{MIPS_INS_MIN_U, nullptr},
-		{MIPS_INS_MOD, nullptr},
-		{MIPS_INS_MODSUB, nullptr},
-		{MIPS_INS_MODU, nullptr},
-		{MIPS_INS_MOD_S, nullptr},
-		{MIPS_INS_MOD_U, nullptr},
-		{MIPS_INS_MOVE, &Capstone2LlvmIrTranslatorMips::translateMov},
-		{MIPS_INS_MOVEP, nullptr},
-		{MIPS_INS_MOVF, &Capstone2LlvmIrTranslatorMips::translateMovf},
-		{MIPS_INS_MOVN, &Capstone2LlvmIrTranslatorMips::translateMovn},
-		{MIPS_INS_MOVT, &Capstone2LlvmIrTranslatorMips::translateMovt},
-		{MIPS_INS_MOVZ, &Capstone2LlvmIrTranslatorMips::translateMovz},
-		{MIPS_INS_MSUB, &Capstone2LlvmIrTranslatorMips::translateMsub},
-		{MIPS_INS_MSUBF, nullptr},
-		{MIPS_INS_MSUBR_Q, nullptr},
-		{MIPS_INS_MSUBU, &Capstone2LlvmIrTranslatorMips::translateMsub},
-		{MIPS_INS_MSUBV, nullptr},
-		{MIPS_INS_MSUB_Q, nullptr},
-		{MIPS_INS_MTC0, nullptr},
-		{MIPS_INS_MTC1, &Capstone2LlvmIrTranslatorMips::translateMtc1},
-		{MIPS_INS_MTC2, nullptr},
-		{MIPS_INS_MTHC1, nullptr},
-		{MIPS_INS_MTHI, &Capstone2LlvmIrTranslatorMips::translateMthi},
-		{MIPS_INS_MTHLIP, nullptr},
-		{MIPS_INS_MTLO, &Capstone2LlvmIrTranslatorMips::translateMtlo},
-		{MIPS_INS_MTM0, nullptr},
-		{MIPS_INS_MTM1, nullptr},
-		{MIPS_INS_MTM2, nullptr},
-		{MIPS_INS_MTP0, nullptr},
-		{MIPS_INS_MTP1, nullptr},
-		{MIPS_INS_MTP2, nullptr},
-		{MIPS_INS_MUH, nullptr},
-		{MIPS_INS_MUHU, nullptr},
-		{MIPS_INS_MULEQ_S, nullptr},
-		{MIPS_INS_MULEU_S, nullptr},
-		{MIPS_INS_MULQ_RS, nullptr},
-		{MIPS_INS_MULQ_S, nullptr},
-		{MIPS_INS_MULR_Q, nullptr},
-		{MIPS_INS_MULSAQ_S, nullptr},
-		{MIPS_INS_MULSA, nullptr},
-		{MIPS_INS_MULT, &Capstone2LlvmIrTranslatorMips::translateMult},
-		{MIPS_INS_MULTU, &Capstone2LlvmIrTranslatorMips::translateMult},
-		{MIPS_INS_MULU, nullptr},
-		{MIPS_INS_MULV, nullptr},
-		{MIPS_INS_MUL_Q, nullptr},
-		{MIPS_INS_MUL_S, nullptr},
-		{MIPS_INS_NLOC, nullptr},
-		{MIPS_INS_NLZC, nullptr},
-		{MIPS_INS_NMADD, &Capstone2LlvmIrTranslatorMips::translateNmadd},
-		{MIPS_INS_NMSUB, &Capstone2LlvmIrTranslatorMips::translateNmsub},
-		{MIPS_INS_NOR, &Capstone2LlvmIrTranslatorMips::translateNor},
-		{MIPS_INS_NORI, &Capstone2LlvmIrTranslatorMips::translateNor},
-		{MIPS_INS_NOT16, nullptr},
-		{MIPS_INS_NOT, nullptr},
-		{MIPS_INS_OR, &Capstone2LlvmIrTranslatorMips::translateOr},
-		{MIPS_INS_OR16, nullptr},
-		{MIPS_INS_ORI, &Capstone2LlvmIrTranslatorMips::translateOr},
-		{MIPS_INS_PACKRL, nullptr},
-		{MIPS_INS_PAUSE, nullptr},
-		{MIPS_INS_PCKEV, nullptr},
-		{MIPS_INS_PCKOD, nullptr},
-		{MIPS_INS_PCNT, nullptr},
-		{MIPS_INS_PICK, nullptr},
-		{MIPS_INS_POP, nullptr},
-		{MIPS_INS_PRECEQU, nullptr},
-		{MIPS_INS_PRECEQ, nullptr},
-		{MIPS_INS_PRECEU, nullptr},
-		{MIPS_INS_PRECRQU_S, nullptr},
-		{MIPS_INS_PRECRQ, nullptr},
-		{MIPS_INS_PRECRQ_RS, nullptr},
-		{MIPS_INS_PRECR, nullptr},
-		{MIPS_INS_PRECR_SRA, nullptr},
-		{MIPS_INS_PRECR_SRA_R, nullptr},
-		{MIPS_INS_PREF, nullptr},
-		{MIPS_INS_PREPEND, nullptr},
-		{MIPS_INS_RADDU, nullptr},
-		{MIPS_INS_RDDSP, nullptr},
-		{MIPS_INS_RDHWR, nullptr},
-		{MIPS_INS_REPLV, nullptr},
-		{MIPS_INS_REPL, nullptr},
-		{MIPS_INS_RINT, nullptr},
-		{MIPS_INS_ROTR, &Capstone2LlvmIrTranslatorMips::translateRotr},
-		{MIPS_INS_ROTRV, &Capstone2LlvmIrTranslatorMips::translateRotr},
-		{MIPS_INS_ROUND, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_SAT_S, nullptr},
-		{MIPS_INS_SAT_U, nullptr},
-		{MIPS_INS_SB, &Capstone2LlvmIrTranslatorMips::translateStoreMemory},
-		{MIPS_INS_SB16, nullptr},
-		{MIPS_INS_SC, nullptr},
-		{MIPS_INS_SCD, nullptr},
-		{MIPS_INS_SD, &Capstone2LlvmIrTranslatorMips::translateStoreMemory},
-		{MIPS_INS_SDBBP, nullptr},
-		{MIPS_INS_SDBBP16, nullptr},
-		{MIPS_INS_SDC1, &Capstone2LlvmIrTranslatorMips::translateStoreMemory},
-		{MIPS_INS_SDC2, nullptr},
-		{MIPS_INS_SDC3, &Capstone2LlvmIrTranslatorMips::translateStoreMemory},
-		{MIPS_INS_SDL, nullptr},
-		{MIPS_INS_SDR, nullptr},
-		{MIPS_INS_SDXC1, nullptr},
-		{MIPS_INS_SEB, &Capstone2LlvmIrTranslatorMips::translateSeb},
-		{MIPS_INS_SEH, &Capstone2LlvmIrTranslatorMips::translateSeh},
-		{MIPS_INS_SELEQZ, nullptr},
-		{MIPS_INS_SELNEZ, nullptr},
-		{MIPS_INS_SEL, nullptr},
-		{MIPS_INS_SEQ, nullptr},
-		{MIPS_INS_SEQI, nullptr},
-		{MIPS_INS_SH, &Capstone2LlvmIrTranslatorMips::translateStoreMemory},
-		{MIPS_INS_SH16, nullptr},
-		{MIPS_INS_SHF, nullptr},
-		{MIPS_INS_SHILO, nullptr},
-		{MIPS_INS_SHILOV, nullptr},
-		{MIPS_INS_SHLLV, nullptr},
-		{MIPS_INS_SHLLV_S, nullptr},
-		{MIPS_INS_SHLL, nullptr},
-		{MIPS_INS_SHLL_S, nullptr},
-		{MIPS_INS_SHRAV, nullptr},
-		{MIPS_INS_SHRAV_R, nullptr},
-		{MIPS_INS_SHRA, nullptr},
-		{MIPS_INS_SHRA_R, nullptr},
-		{MIPS_INS_SHRLV, nullptr},
-		{MIPS_INS_SHRL, nullptr},
-		{MIPS_INS_SLDI, nullptr},
-		{MIPS_INS_SLD, nullptr},
-		{MIPS_INS_SLL, &Capstone2LlvmIrTranslatorMips::translateSll},
-		{MIPS_INS_SLL16, nullptr},
-		{MIPS_INS_SLLI, nullptr},
-		{MIPS_INS_SLLV, &Capstone2LlvmIrTranslatorMips::translateSll},
-		{MIPS_INS_SLT, &Capstone2LlvmIrTranslatorMips::translateSlt},
-		{MIPS_INS_SLTI, &Capstone2LlvmIrTranslatorMips::translateSlt},
-		{MIPS_INS_SLTIU, &Capstone2LlvmIrTranslatorMips::translateSltu},
-		{MIPS_INS_SLTU, &Capstone2LlvmIrTranslatorMips::translateSltu},
-		{MIPS_INS_SNE, nullptr},
-		{MIPS_INS_SNEI, nullptr},
-		{MIPS_INS_SPLATI, nullptr},
-		{MIPS_INS_SPLAT, nullptr},
-		{MIPS_INS_SRA, &Capstone2LlvmIrTranslatorMips::translateSra},
-		{MIPS_INS_SRAI, nullptr},
-		{MIPS_INS_SRARI, nullptr},
-		{MIPS_INS_SRAR, nullptr},
-		{MIPS_INS_SRAV, &Capstone2LlvmIrTranslatorMips::translateSra},
-		{MIPS_INS_SRL, &Capstone2LlvmIrTranslatorMips::translateSrl},
-		{MIPS_INS_SRL16, nullptr},
-		{MIPS_INS_SRLI, nullptr},
-		{MIPS_INS_SRLRI, nullptr},
-		{MIPS_INS_SRLR, nullptr},
-		{MIPS_INS_SRLV, &Capstone2LlvmIrTranslatorMips::translateSrl},
-		{MIPS_INS_SSNOP, nullptr},
-		{MIPS_INS_ST, nullptr},
-		{MIPS_INS_SUBQH, nullptr},
-		{MIPS_INS_SUBQH_R, nullptr},
-		{MIPS_INS_SUBQ, nullptr},
-		{MIPS_INS_SUBQ_S, nullptr},
-		{MIPS_INS_SUBSUS_U, nullptr},
-		{MIPS_INS_SUBSUU_S, nullptr},
-		{MIPS_INS_SUBS_S, nullptr},
-		{MIPS_INS_SUBS_U, nullptr},
-		{MIPS_INS_SUBU16, nullptr},
-		{MIPS_INS_SUBUH, nullptr},
-		{MIPS_INS_SUBUH_R, nullptr},
-		{MIPS_INS_SUBU, &Capstone2LlvmIrTranslatorMips::translateSub},
-		{MIPS_INS_SUBU_S, nullptr},
-		{MIPS_INS_SUBVI, nullptr},
-		{MIPS_INS_SUBV, nullptr},
-		{MIPS_INS_SUXC1, nullptr},
-		{MIPS_INS_SW, &Capstone2LlvmIrTranslatorMips::translateStoreMemory},
-		{MIPS_INS_SW16, nullptr},
-		{MIPS_INS_SWC1, &Capstone2LlvmIrTranslatorMips::translateStoreMemory},
-		{MIPS_INS_SWC2, nullptr},
-		{MIPS_INS_SWC3, nullptr},
-		{MIPS_INS_SWL, &Capstone2LlvmIrTranslatorMips::translateSwl},
-		{MIPS_INS_SWM16, nullptr},
-		{MIPS_INS_SWM32, nullptr},
-		{MIPS_INS_SWP, nullptr},
-		{MIPS_INS_SWR, &Capstone2LlvmIrTranslatorMips::translateSwr},
-		{MIPS_INS_SWXC1, nullptr},
-		{MIPS_INS_SYNC, nullptr},
-		{MIPS_INS_SYNCI, nullptr},
-		{MIPS_INS_SYSCALL, &Capstone2LlvmIrTranslatorMips::translateSyscall},
-		{MIPS_INS_TEQ, nullptr},
-		{MIPS_INS_TEQI, nullptr},
-		{MIPS_INS_TGE, nullptr},
-		{MIPS_INS_TGEI, nullptr},
-		{MIPS_INS_TGEIU, nullptr},
-		{MIPS_INS_TGEU, nullptr},
-		{MIPS_INS_TLBP, nullptr},
-		{MIPS_INS_TLBR, nullptr},
-		{MIPS_INS_TLBWI, nullptr},
-		{MIPS_INS_TLBWR, nullptr},
-		{MIPS_INS_TLT, nullptr},
-		{MIPS_INS_TLTI, nullptr},
-		{MIPS_INS_TLTIU, nullptr},
-		{MIPS_INS_TLTU, nullptr},
-		{MIPS_INS_TNE, nullptr},
-		{MIPS_INS_TNEI, nullptr},
-		{MIPS_INS_TRUNC, &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm},
-		{MIPS_INS_V3MULU, nullptr},
-		{MIPS_INS_VMM0, nullptr},
-		{MIPS_INS_VMULU, nullptr},
-		{MIPS_INS_VSHF, nullptr},
-		{MIPS_INS_WAIT, nullptr},
-		{MIPS_INS_WRDSP, nullptr},
-		{MIPS_INS_WSBH, &Capstone2LlvmIrTranslatorMips::translateWsbh},
-		{MIPS_INS_XOR, &Capstone2LlvmIrTranslatorMips::translateXor},
-		{MIPS_INS_XOR16, nullptr},
-		{MIPS_INS_XORI, &Capstone2LlvmIrTranslatorMips::translateXor},
+	t.fns[MIPS_INS_INVALID] = nullptr;
 
-		// some alias instructions
-		{MIPS_INS_NOP, &Capstone2LlvmIrTranslatorMips::translateNop},
-		{MIPS_INS_NEGU, &Capstone2LlvmIrTranslatorMips::translateNegu},
+	t.fns[MIPS_INS_ABSQ_S] = nullptr;
+	t.fns[MIPS_INS_ADD] = &Capstone2LlvmIrTranslatorMips::translateAdd;
+	t.fns[MIPS_INS_ADDIUPC] = nullptr;
+	t.fns[MIPS_INS_ADDIUR1SP] = nullptr;
+	t.fns[MIPS_INS_ADDIUR2] = nullptr;
+	t.fns[MIPS_INS_ADDIUS5] = nullptr;
+	t.fns[MIPS_INS_ADDIUSP] = nullptr;
+	t.fns[MIPS_INS_ADDQH] = nullptr;
+	t.fns[MIPS_INS_ADDQH_R] = nullptr;
+	t.fns[MIPS_INS_ADDQ] = nullptr;
+	t.fns[MIPS_INS_ADDQ_S] = nullptr;
+	t.fns[MIPS_INS_ADDSC] = nullptr;
+	t.fns[MIPS_INS_ADDS_A] = nullptr;
+	t.fns[MIPS_INS_ADDS_S] = nullptr;
+	t.fns[MIPS_INS_ADDS_U] = nullptr;
+	t.fns[MIPS_INS_ADDU16] = nullptr;
+	t.fns[MIPS_INS_ADDUH] = nullptr;
+	t.fns[MIPS_INS_ADDUH_R] = nullptr;
+	t.fns[MIPS_INS_ADDU] = &Capstone2LlvmIrTranslatorMips::translateAdd;
+	t.fns[MIPS_INS_ADDU_S] = nullptr;
+	t.fns[MIPS_INS_ADDVI] = nullptr;
+	t.fns[MIPS_INS_ADDV] = nullptr;
+	t.fns[MIPS_INS_ADDWC] = nullptr;
+	t.fns[MIPS_INS_ADD_A] = nullptr;
+	t.fns[MIPS_INS_ADDI] = &Capstone2LlvmIrTranslatorMips::translateAdd;
+	t.fns[MIPS_INS_ADDIU] = &Capstone2LlvmIrTranslatorMips::translateAdd;
+	t.fns[MIPS_INS_ALIGN] = nullptr;
+	t.fns[MIPS_INS_ALUIPC] = nullptr;
+	t.fns[MIPS_INS_AND] = &Capstone2LlvmIrTranslatorMips::translateAnd;
+	t.fns[MIPS_INS_AND16] = nullptr;
+	t.fns[MIPS_INS_ANDI16] = nullptr;
+	t.fns[MIPS_INS_ANDI] = &Capstone2LlvmIrTranslatorMips::translateAnd;
+	t.fns[MIPS_INS_APPEND] = nullptr;
+	t.fns[MIPS_INS_ASUB_S] = nullptr;
+	t.fns[MIPS_INS_ASUB_U] = nullptr;
+	t.fns[MIPS_INS_AUI] = nullptr;
+	t.fns[MIPS_INS_AUIPC] = nullptr;
+	t.fns[MIPS_INS_AVER_S] = nullptr;
+	t.fns[MIPS_INS_AVER_U] = nullptr;
+	t.fns[MIPS_INS_AVE_S] = nullptr;
+	t.fns[MIPS_INS_AVE_U] = nullptr;
+	t.fns[MIPS_INS_B16] = nullptr;
+	t.fns[MIPS_INS_BADDU] = nullptr;
+	t.fns[MIPS_INS_BAL] = nullptr;
+	t.fns[MIPS_INS_BALC] = nullptr;
+	t.fns[MIPS_INS_BALIGN] = nullptr;
+	t.fns[MIPS_INS_BBIT0] = nullptr;
+	t.fns[MIPS_INS_BBIT032] = nullptr;
+	t.fns[MIPS_INS_BBIT1] = nullptr;
+	t.fns[MIPS_INS_BBIT132] = nullptr;
+	t.fns[MIPS_INS_BC] = nullptr;
+	t.fns[MIPS_INS_BC0F] = nullptr;
+	t.fns[MIPS_INS_BC0FL] = nullptr;
+	t.fns[MIPS_INS_BC0T] = nullptr;
+	t.fns[MIPS_INS_BC0TL] = nullptr;
+	t.fns[MIPS_INS_BC1EQZ] = nullptr;
+	t.fns[MIPS_INS_BC1F] = &Capstone2LlvmIrTranslatorMips::translateBc1f;
+	t.fns[MIPS_INS_BC1FL] = &Capstone2LlvmIrTranslatorMips::translateBc1f;
+	t.fns[MIPS_INS_BC1NEZ] = nullptr;
+	t.fns[MIPS_INS_BC1T] = &Capstone2LlvmIrTranslatorMips::translateBc1t;
+	t.fns[MIPS_INS_BC1TL] = &Capstone2LlvmIrTranslatorMips::translateBc1t;
+	t.fns[MIPS_INS_BC2EQZ] = nullptr;
+	t.fns[MIPS_INS_BC2F] = nullptr;
+	t.fns[MIPS_INS_BC2FL] = nullptr;
+	t.fns[MIPS_INS_BC2NEZ] = nullptr;
+	t.fns[MIPS_INS_BC2T] = nullptr;
+	t.fns[MIPS_INS_BC2TL] = nullptr;
+	t.fns[MIPS_INS_BC3F] = nullptr;
+	t.fns[MIPS_INS_BC3FL] = nullptr;
+	t.fns[MIPS_INS_BC3T] = nullptr;
+	t.fns[MIPS_INS_BC3TL] = nullptr;
+	t.fns[MIPS_INS_BCLRI] = nullptr;
+	t.fns[MIPS_INS_BCLR] = nullptr;
+	t.fns[MIPS_INS_BEQ] = &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary;
+	t.fns[MIPS_INS_BEQC] = nullptr;
+	t.fns[MIPS_INS_BEQL] = &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary;
+	t.fns[MIPS_INS_BEQZ16] = nullptr;
+	t.fns[MIPS_INS_BEQZALC] = nullptr;
+	t.fns[MIPS_INS_BEQZC] = nullptr;
+	t.fns[MIPS_INS_BGEC] = nullptr;
+	t.fns[MIPS_INS_BGEUC] = nullptr;
+	t.fns[MIPS_INS_BGEZ] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BGEZAL] = &Capstone2LlvmIrTranslatorMips::translateBcondal;
+	t.fns[MIPS_INS_BGEZALC] = nullptr;
+	t.fns[MIPS_INS_BGEZALL] = &Capstone2LlvmIrTranslatorMips::translateBcondal;
+	t.fns[MIPS_INS_BGEZALS] = nullptr;
+	t.fns[MIPS_INS_BGEZC] = nullptr;
+	t.fns[MIPS_INS_BGEZL] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BGTZ] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BGTZALC] = nullptr;
+	t.fns[MIPS_INS_BGTZC] = nullptr;
+	t.fns[MIPS_INS_BGTZL] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BINSLI] = nullptr;
+	t.fns[MIPS_INS_BINSL] = nullptr;
+	t.fns[MIPS_INS_BINSRI] = nullptr;
+	t.fns[MIPS_INS_BINSR] = nullptr;
+	t.fns[MIPS_INS_BITREV] = &Capstone2LlvmIrTranslatorMips::translateBitrev;
+	t.fns[MIPS_INS_BITSWAP] = nullptr;
+	t.fns[MIPS_INS_BLEZ] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BLEZALC] = nullptr;
+	t.fns[MIPS_INS_BLEZC] = nullptr;
+	t.fns[MIPS_INS_BLEZL] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BLTC] = nullptr;
+	t.fns[MIPS_INS_BLTUC] = nullptr;
+	t.fns[MIPS_INS_BLTZ] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BLTZAL] = &Capstone2LlvmIrTranslatorMips::translateBcondal;
+	t.fns[MIPS_INS_BLTZALC] = nullptr;
+	t.fns[MIPS_INS_BLTZALL] = &Capstone2LlvmIrTranslatorMips::translateBcondal;
+	t.fns[MIPS_INS_BLTZALS] = nullptr;
+	t.fns[MIPS_INS_BLTZC] = nullptr;
+	t.fns[MIPS_INS_BLTZL] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BMNZI] = nullptr;
+	t.fns[MIPS_INS_BMNZ] = nullptr;
+	t.fns[MIPS_INS_BMZI] = nullptr;
+	t.fns[MIPS_INS_BMZ] = nullptr;
+	t.fns[MIPS_INS_BNE] = &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary;
+	t.fns[MIPS_INS_BNEC] = nullptr;
+	t.fns[MIPS_INS_BNEGI] = nullptr;
+	t.fns[MIPS_INS_BNEG] = nullptr;
+	t.fns[MIPS_INS_BNEL] = &Capstone2LlvmIrTranslatorMips::translateCondBranchTernary;
+	t.fns[MIPS_INS_BNEZ16] = nullptr;
+	t.fns[MIPS_INS_BNEZALC] = nullptr;
+	t.fns[MIPS_INS_BNEZC] = nullptr;
+	t.fns[MIPS_INS_BNVC] = nullptr;
+	t.fns[MIPS_INS_BNZ] = nullptr;
+	t.fns[MIPS_INS_BOVC] = nullptr;
+	t.fns[MIPS_INS_BPOSGE32] = nullptr;
+	t.fns[MIPS_INS_BREAK] = &Capstone2LlvmIrTranslatorMips::translateBreak;
+	t.fns[MIPS_INS_BREAK16] = nullptr;
+	t.fns[MIPS_INS_BSELI] = nullptr;
+	t.fns[MIPS_INS_BSEL] = nullptr;
+	t.fns[MIPS_INS_BSETI] = nullptr;
+	t.fns[MIPS_INS_BSET] = nullptr;
+	t.fns[MIPS_INS_BZ] = nullptr;
+	t.fns[MIPS_INS_BEQZ] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_B] = nullptr;
+	t.fns[MIPS_INS_BNEZ] = &Capstone2LlvmIrTranslatorMips::translateCondBranchBinary;
+	t.fns[MIPS_INS_BTEQZ] = nullptr;
+	t.fns[MIPS_INS_BTNEZ] = nullptr;
+	t.fns[MIPS_INS_CACHE] = nullptr;
+	t.fns[MIPS_INS_CEIL] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_CEQI] = nullptr;
+	t.fns[MIPS_INS_CEQ] = nullptr;
+	t.fns[MIPS_INS_CFC1] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_CFCMSA] = nullptr;
+	t.fns[MIPS_INS_CINS] = nullptr;
+	t.fns[MIPS_INS_CINS32] = nullptr;
+	t.fns[MIPS_INS_CLASS] = nullptr;
+	t.fns[MIPS_INS_CLEI_S] = nullptr;
+	t.fns[MIPS_INS_CLEI_U] = nullptr;
+	t.fns[MIPS_INS_CLE_S] = nullptr;
+	t.fns[MIPS_INS_CLE_U] = nullptr;
+	t.fns[MIPS_INS_CLO] = &Capstone2LlvmIrTranslatorMips::translateClo;
+	t.fns[MIPS_INS_CLTI_S] = nullptr;
+	t.fns[MIPS_INS_CLTI_U] = nullptr;
+	t.fns[MIPS_INS_CLT_S] = nullptr;
+	t.fns[MIPS_INS_CLT_U] = nullptr;
+	t.fns[MIPS_INS_CLZ] = &Capstone2LlvmIrTranslatorMips::translateClz;
+	t.fns[MIPS_INS_CMPGDU] = nullptr;
+	t.fns[MIPS_INS_CMPGU] = nullptr;
+	t.fns[MIPS_INS_CMPU] = nullptr;
+	t.fns[MIPS_INS_CMP] = nullptr;
+	t.fns[MIPS_INS_COPY_S] = nullptr;
+	t.fns[MIPS_INS_COPY_U] = nullptr;
+	t.fns[MIPS_INS_CTC1] = &Capstone2LlvmIrTranslatorMips::translateCtc1;
+	t.fns[MIPS_INS_CTCMSA] = nullptr;
+	t.fns[MIPS_INS_CVT] = &Capstone2LlvmIrTranslatorMips::translateCvt;
+	t.fns[MIPS_INS_C] = &Capstone2LlvmIrTranslatorMips::translateC;
+	t.fns[MIPS_INS_CMPI] = nullptr;
+	t.fns[MIPS_INS_DADD] = nullptr;
+	t.fns[MIPS_INS_DADDI] = nullptr;
+	t.fns[MIPS_INS_DADDIU] = nullptr;
+	t.fns[MIPS_INS_DADDU] = nullptr;
+	t.fns[MIPS_INS_DAHI] = nullptr;
+	t.fns[MIPS_INS_DALIGN] = nullptr;
+	t.fns[MIPS_INS_DATI] = nullptr;
+	t.fns[MIPS_INS_DAUI] = nullptr;
+	t.fns[MIPS_INS_DBITSWAP] = nullptr;
+	t.fns[MIPS_INS_DCLO] = nullptr;
+	t.fns[MIPS_INS_DCLZ] = nullptr;
+	t.fns[MIPS_INS_DDIV] = nullptr;
+	t.fns[MIPS_INS_DDIVU] = nullptr;
+	t.fns[MIPS_INS_DERET] = nullptr;
+	t.fns[MIPS_INS_DEXT] = nullptr;
+	t.fns[MIPS_INS_DEXTM] = nullptr;
+	t.fns[MIPS_INS_DEXTU] = nullptr;
+	t.fns[MIPS_INS_DI] = nullptr;
+	t.fns[MIPS_INS_DINS] = nullptr;
+	t.fns[MIPS_INS_DINSM] = nullptr;
+	t.fns[MIPS_INS_DINSU] = nullptr;
+	t.fns[MIPS_INS_DIV] = &Capstone2LlvmIrTranslatorMips::translateDiv;
+	t.fns[MIPS_INS_DIVU] = &Capstone2LlvmIrTranslatorMips::translateDivu;
+	t.fns[MIPS_INS_DIV_S] = nullptr;
+	t.fns[MIPS_INS_DIV_U] = nullptr;
+	t.fns[MIPS_INS_DLSA] = nullptr;
+	t.fns[MIPS_INS_DMFC0] = nullptr;
+	t.fns[MIPS_INS_DMFC1] = nullptr;
+	t.fns[MIPS_INS_DMFC2] = nullptr;
+	t.fns[MIPS_INS_DMOD] = nullptr;
+	t.fns[MIPS_INS_DMODU] = nullptr;
+	t.fns[MIPS_INS_DMTC0] = nullptr;
+	t.fns[MIPS_INS_DMTC1] = nullptr;
+	t.fns[MIPS_INS_DMTC2] = nullptr;
+	t.fns[MIPS_INS_DMUH] = nullptr;
+	t.fns[MIPS_INS_DMUHU] = nullptr;
+	t.fns[MIPS_INS_DMUL] = nullptr;
+	t.fns[MIPS_INS_DMULT] = nullptr;
+	t.fns[MIPS_INS_DMULTU] = nullptr;
+	t.fns[MIPS_INS_DMULU] = nullptr;
+	t.fns[MIPS_INS_DOTP_S] = nullptr;
+	t.fns[MIPS_INS_DOTP_U] = nullptr;
+	t.fns[MIPS_INS_DPADD_S] = nullptr;
+	t.fns[MIPS_INS_DPADD_U] = nullptr;
+	t.fns[MIPS_INS_DPAQX_SA] = nullptr;
+	t.fns[MIPS_INS_DPAQX_S] = nullptr;
+	t.fns[MIPS_INS_DPAQ_SA] = nullptr;
+	t.fns[MIPS_INS_DPAQ_S] = nullptr;
+	t.fns[MIPS_INS_DPAU] = nullptr;
+	t.fns[MIPS_INS_DPAX] = nullptr;
+	t.fns[MIPS_INS_DPA] = nullptr;
+	t.fns[MIPS_INS_DPOP] = nullptr;
+	t.fns[MIPS_INS_DPSQX_SA] = nullptr;
+	t.fns[MIPS_INS_DPSQX_S] = nullptr;
+	t.fns[MIPS_INS_DPSQ_SA] = nullptr;
+	t.fns[MIPS_INS_DPSQ_S] = nullptr;
+	t.fns[MIPS_INS_DPSUB_S] = nullptr;
+	t.fns[MIPS_INS_DPSUB_U] = nullptr;
+	t.fns[MIPS_INS_DPSU] = nullptr;
+	t.fns[MIPS_INS_DPSX] = nullptr;
+	t.fns[MIPS_INS_DPS] = nullptr;
+	t.fns[MIPS_INS_DROTR] = nullptr;
+	t.fns[MIPS_INS_DROTR32] = nullptr;
+	t.fns[MIPS_INS_DROTRV] = nullptr;
+	t.fns[MIPS_INS_DSBH] = nullptr;
+	t.fns[MIPS_INS_DSHD] = nullptr;
+	t.fns[MIPS_INS_DSLL] = nullptr;
+	t.fns[MIPS_INS_DSLL32] = nullptr;
+	t.fns[MIPS_INS_DSLLV] = nullptr;
+	t.fns[MIPS_INS_DSRA] = nullptr;
+	t.fns[MIPS_INS_DSRA32] = nullptr;
+	t.fns[MIPS_INS_DSRAV] = nullptr;
+	t.fns[MIPS_INS_DSRL] = nullptr;
+	t.fns[MIPS_INS_DSRL32] = nullptr;
+	t.fns[MIPS_INS_DSRLV] = nullptr;
+	t.fns[MIPS_INS_DSUB] = nullptr;
+	t.fns[MIPS_INS_DSUBU] = nullptr;
+	t.fns[MIPS_INS_EHB] = nullptr;
+	t.fns[MIPS_INS_EI] = nullptr;
+	t.fns[MIPS_INS_ERET] = nullptr;
+	t.fns[MIPS_INS_EXT] = &Capstone2LlvmIrTranslatorMips::translateExt;
+	t.fns[MIPS_INS_EXTP] = nullptr;
+	t.fns[MIPS_INS_EXTPDP] = nullptr;
+	t.fns[MIPS_INS_EXTPDPV] = nullptr;
+	t.fns[MIPS_INS_EXTPV] = nullptr;
+	t.fns[MIPS_INS_EXTRV_RS] = nullptr;
+	t.fns[MIPS_INS_EXTRV_R] = nullptr;
+	t.fns[MIPS_INS_EXTRV_S] = nullptr;
+	t.fns[MIPS_INS_EXTRV] = nullptr;
+	t.fns[MIPS_INS_EXTR_RS] = nullptr;
+	t.fns[MIPS_INS_EXTR_R] = nullptr;
+	t.fns[MIPS_INS_EXTR_S] = nullptr;
+	t.fns[MIPS_INS_EXTR] = nullptr;
+	t.fns[MIPS_INS_EXTS] = nullptr;
+	t.fns[MIPS_INS_EXTS32] = nullptr;
+	t.fns[MIPS_INS_ABS] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_FADD] = nullptr;
+	t.fns[MIPS_INS_FCAF] = nullptr;
+	t.fns[MIPS_INS_FCEQ] = nullptr;
+	t.fns[MIPS_INS_FCLASS] = nullptr;
+	t.fns[MIPS_INS_FCLE] = nullptr;
+	t.fns[MIPS_INS_FCLT] = nullptr;
+	t.fns[MIPS_INS_FCNE] = nullptr;
+	t.fns[MIPS_INS_FCOR] = nullptr;
+	t.fns[MIPS_INS_FCUEQ] = nullptr;
+	t.fns[MIPS_INS_FCULE] = nullptr;
+	t.fns[MIPS_INS_FCULT] = nullptr;
+	t.fns[MIPS_INS_FCUNE] = nullptr;
+	t.fns[MIPS_INS_FCUN] = nullptr;
+	t.fns[MIPS_INS_FDIV] = nullptr;
+	t.fns[MIPS_INS_FEXDO] = nullptr;
+	t.fns[MIPS_INS_FEXP2] = nullptr;
+	t.fns[MIPS_INS_FEXUPL] = nullptr;
+	t.fns[MIPS_INS_FEXUPR] = nullptr;
+	t.fns[MIPS_INS_FFINT_S] = nullptr;
+	t.fns[MIPS_INS_FFINT_U] = nullptr;
+	t.fns[MIPS_INS_FFQL] = nullptr;
+	t.fns[MIPS_INS_FFQR] = nullptr;
+	t.fns[MIPS_INS_FILL] = nullptr;
+	t.fns[MIPS_INS_FLOG2] = nullptr;
+	t.fns[MIPS_INS_FLOOR] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_FMADD] = nullptr;
+	t.fns[MIPS_INS_FMAX_A] = nullptr;
+	t.fns[MIPS_INS_FMAX] = nullptr;
+	t.fns[MIPS_INS_FMIN_A] = nullptr;
+	t.fns[MIPS_INS_FMIN] = nullptr;
+	t.fns[MIPS_INS_MOV] = &Capstone2LlvmIrTranslatorMips::translateMov;
+	t.fns[MIPS_INS_FMSUB] = nullptr;
+	t.fns[MIPS_INS_FMUL] = nullptr;
+	t.fns[MIPS_INS_MUL] = &Capstone2LlvmIrTranslatorMips::translateMul;
+	t.fns[MIPS_INS_NEG] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_FRCP] = nullptr;
+	t.fns[MIPS_INS_FRINT] = nullptr;
+	t.fns[MIPS_INS_FRSQRT] = nullptr;
+	t.fns[MIPS_INS_FSAF] = nullptr;
+	t.fns[MIPS_INS_FSEQ] = nullptr;
+	t.fns[MIPS_INS_FSLE] = nullptr;
+	t.fns[MIPS_INS_FSLT] = nullptr;
+	t.fns[MIPS_INS_FSNE] = nullptr;
+	t.fns[MIPS_INS_FSOR] = nullptr;
+	t.fns[MIPS_INS_FSQRT] = nullptr;
+	t.fns[MIPS_INS_SQRT] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_FSUB] = nullptr;
+	t.fns[MIPS_INS_SUB] = &Capstone2LlvmIrTranslatorMips::translateSub;
+	t.fns[MIPS_INS_FSUEQ] = nullptr;
+	t.fns[MIPS_INS_FSULE] = nullptr;
+	t.fns[MIPS_INS_FSULT] = nullptr;
+	t.fns[MIPS_INS_FSUNE] = nullptr;
+	t.fns[MIPS_INS_FSUN] = nullptr;
+	t.fns[MIPS_INS_FTINT_S] = nullptr;
+	t.fns[MIPS_INS_FTINT_U] = nullptr;
+	t.fns[MIPS_INS_FTQ] = nullptr;
+	t.fns[MIPS_INS_FTRUNC_S] = nullptr;
+	t.fns[MIPS_INS_FTRUNC_U] = nullptr;
+	t.fns[MIPS_INS_HADD_S] = nullptr;
+	t.fns[MIPS_INS_HADD_U] = nullptr;
+	t.fns[MIPS_INS_HSUB_S] = nullptr;
+	t.fns[MIPS_INS_HSUB_U] = nullptr;
+	t.fns[MIPS_INS_ILVEV] = nullptr;
+	t.fns[MIPS_INS_ILVL] = nullptr;
+	t.fns[MIPS_INS_ILVOD] = nullptr;
+	t.fns[MIPS_INS_ILVR] = nullptr;
+	t.fns[MIPS_INS_INS] = &Capstone2LlvmIrTranslatorMips::translateIns;
+	t.fns[MIPS_INS_INSERT] = nullptr;
+	t.fns[MIPS_INS_INSV] = nullptr;
+	t.fns[MIPS_INS_INSVE] = nullptr;
+	t.fns[MIPS_INS_J] = &Capstone2LlvmIrTranslatorMips::translateJ;
+	t.fns[MIPS_INS_JAL] = &Capstone2LlvmIrTranslatorMips::translateJal;
+	t.fns[MIPS_INS_JALR] = &Capstone2LlvmIrTranslatorMips::translateJal;
+	t.fns[MIPS_INS_JALRS16] = nullptr;
+	t.fns[MIPS_INS_JALRS] = nullptr;
+	t.fns[MIPS_INS_JALS] = nullptr;
+	t.fns[MIPS_INS_JALX] = nullptr;
+	t.fns[MIPS_INS_JIALC] = nullptr;
+	t.fns[MIPS_INS_JIC] = nullptr;
+	t.fns[MIPS_INS_JR] = &Capstone2LlvmIrTranslatorMips::translateJ;
+	t.fns[MIPS_INS_JR16] = nullptr;
+	t.fns[MIPS_INS_JRADDIUSP] = nullptr;
+	t.fns[MIPS_INS_JRC] = nullptr;
+	t.fns[MIPS_INS_JALRC] = nullptr;
+	t.fns[MIPS_INS_LB] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LBU16] = nullptr;
+	t.fns[MIPS_INS_LBUX] = nullptr;
+	t.fns[MIPS_INS_LBU] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LD] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LDC1] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LDC2] = nullptr;
+	t.fns[MIPS_INS_LDC3] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LDI] = nullptr;
+	t.fns[MIPS_INS_LDL] = nullptr;
+	t.fns[MIPS_INS_LDPC] = nullptr;
+	t.fns[MIPS_INS_LDR] = nullptr;
+	t.fns[MIPS_INS_LDXC1] = nullptr;
+	t.fns[MIPS_INS_LH] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LHU16] = nullptr;
+	t.fns[MIPS_INS_LHX] = nullptr;
+	t.fns[MIPS_INS_LHU] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LI16] = nullptr;
+	t.fns[MIPS_INS_LL] = nullptr;
+	t.fns[MIPS_INS_LLD] = nullptr;
+	t.fns[MIPS_INS_LSA] = nullptr;
+	t.fns[MIPS_INS_LUXC1] = nullptr;
+	t.fns[MIPS_INS_LUI] = &Capstone2LlvmIrTranslatorMips::translateLui;
+	t.fns[MIPS_INS_LW] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LW16] = nullptr;
+	t.fns[MIPS_INS_LWC1] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LWC2] = nullptr;
+	t.fns[MIPS_INS_LWC3] = nullptr;
+	t.fns[MIPS_INS_LWL] = &Capstone2LlvmIrTranslatorMips::translateLwl;
+	t.fns[MIPS_INS_LWM16] = nullptr;
+	t.fns[MIPS_INS_LWM32] = nullptr;
+	t.fns[MIPS_INS_LWPC] = nullptr;
+	t.fns[MIPS_INS_LWP] = nullptr;
+	t.fns[MIPS_INS_LWR] = &Capstone2LlvmIrTranslatorMips::translateLwr;
+	t.fns[MIPS_INS_LWUPC] = nullptr;
+	t.fns[MIPS_INS_LWU] = &Capstone2LlvmIrTranslatorMips::translateLoadMemory;
+	t.fns[MIPS_INS_LWX] = nullptr;
+	t.fns[MIPS_INS_LWXC1] = nullptr;
+	t.fns[MIPS_INS_LWXS] = nullptr;
+	t.fns[MIPS_INS_LI] = nullptr;
+	t.fns[MIPS_INS_MADD] = &Capstone2LlvmIrTranslatorMips::translateMadd;
+	t.fns[MIPS_INS_MADDF] = nullptr;
+	t.fns[MIPS_INS_MADDR_Q] = nullptr;
+	t.fns[MIPS_INS_MADDU] = &Capstone2LlvmIrTranslatorMips::translateMadd;
+	t.fns[MIPS_INS_MADDV] = nullptr;
+	t.fns[MIPS_INS_MADD_Q] = nullptr;
+	t.fns[MIPS_INS_MAQ_SA] = nullptr;
+	t.fns[MIPS_INS_MAQ_S] = nullptr;
+	t.fns[MIPS_INS_MAXA] = nullptr;
+	t.fns[MIPS_INS_MAXI_S] = nullptr;
+	t.fns[MIPS_INS_MAXI_U] = nullptr;
+	t.fns[MIPS_INS_MAX_A] = nullptr;
+	t.fns[MIPS_INS_MAX] = &Capstone2LlvmIrTranslatorMips::translateMax;
+	t.fns[MIPS_INS_MAX_S] = nullptr;
+	t.fns[MIPS_INS_MAX_U] = nullptr;
+	t.fns[MIPS_INS_MFC0] = nullptr;
+	t.fns[MIPS_INS_MFC1] = &Capstone2LlvmIrTranslatorMips::translateMfc1;
+	t.fns[MIPS_INS_MFC2] = nullptr;
+	t.fns[MIPS_INS_MFHC1] = nullptr;
+	t.fns[MIPS_INS_MFHI] = &Capstone2LlvmIrTranslatorMips::translateMfhi;
+	t.fns[MIPS_INS_MFLO] = &Capstone2LlvmIrTranslatorMips::translateMflo;
+	t.fns[MIPS_INS_MINA] = nullptr;
+	t.fns[MIPS_INS_MINI_S] = nullptr;
+	t.fns[MIPS_INS_MINI_U] = nullptr;
+	t.fns[MIPS_INS_MIN_A] = nullptr;
+	t.fns[MIPS_INS_MIN] = &Capstone2LlvmIrTranslatorMips::translateMin;
+	t.fns[MIPS_INS_MIN_S] = nullptr;
+	t.fns[MIPS_INS_MIN_U] = nullptr;
+	t.fns[MIPS_INS_MOD] = nullptr;
+	t.fns[MIPS_INS_MODSUB] = nullptr;
+	t.fns[MIPS_INS_MODU] = nullptr;
+	t.fns[MIPS_INS_MOD_S] = nullptr;
+	t.fns[MIPS_INS_MOD_U] = nullptr;
+	t.fns[MIPS_INS_MOVE] = &Capstone2LlvmIrTranslatorMips::translateMov;
+	t.fns[MIPS_INS_MOVEP] = nullptr;
+	t.fns[MIPS_INS_MOVF] = &Capstone2LlvmIrTranslatorMips::translateMovf;
+	t.fns[MIPS_INS_MOVN] = &Capstone2LlvmIrTranslatorMips::translateMovn;
+	t.fns[MIPS_INS_MOVT] = &Capstone2LlvmIrTranslatorMips::translateMovt;
+	t.fns[MIPS_INS_MOVZ] = &Capstone2LlvmIrTranslatorMips::translateMovz;
+	t.fns[MIPS_INS_MSUB] = &Capstone2LlvmIrTranslatorMips::translateMsub;
+	t.fns[MIPS_INS_MSUBF] = nullptr;
+	t.fns[MIPS_INS_MSUBR_Q] = nullptr;
+	t.fns[MIPS_INS_MSUBU] = &Capstone2LlvmIrTranslatorMips::translateMsub;
+	t.fns[MIPS_INS_MSUBV] = nullptr;
+	t.fns[MIPS_INS_MSUB_Q] = nullptr;
+	t.fns[MIPS_INS_MTC0] = nullptr;
+	t.fns[MIPS_INS_MTC1] = &Capstone2LlvmIrTranslatorMips::translateMtc1;
+	t.fns[MIPS_INS_MTC2] = nullptr;
+	t.fns[MIPS_INS_MTHC1] = nullptr;
+	t.fns[MIPS_INS_MTHI] = &Capstone2LlvmIrTranslatorMips::translateMthi;
+	t.fns[MIPS_INS_MTHLIP] = nullptr;
+	t.fns[MIPS_INS_MTLO] = &Capstone2LlvmIrTranslatorMips::translateMtlo;
+	t.fns[MIPS_INS_MTM0] = nullptr;
+	t.fns[MIPS_INS_MTM1] = nullptr;
+	t.fns[MIPS_INS_MTM2] = nullptr;
+	t.fns[MIPS_INS_MTP0] = nullptr;
+	t.fns[MIPS_INS_MTP1] = nullptr;
+	t.fns[MIPS_INS_MTP2] = nullptr;
+	t.fns[MIPS_INS_MUH] = nullptr;
+	t.fns[MIPS_INS_MUHU] = nullptr;
+	t.fns[MIPS_INS_MULEQ_S] = nullptr;
+	t.fns[MIPS_INS_MULEU_S] = nullptr;
+	t.fns[MIPS_INS_MULQ_RS] = nullptr;
+	t.fns[MIPS_INS_MULQ_S] = nullptr;
+	t.fns[MIPS_INS_MULR_Q] = nullptr;
+	t.fns[MIPS_INS_MULSAQ_S] = nullptr;
+	t.fns[MIPS_INS_MULSA] = nullptr;
+	t.fns[MIPS_INS_MULT] = &Capstone2LlvmIrTranslatorMips::translateMult;
+	t.fns[MIPS_INS_MULTU] = &Capstone2LlvmIrTranslatorMips::translateMult;
+	t.fns[MIPS_INS_MULU] = nullptr;
+	t.fns[MIPS_INS_MULV] = nullptr;
+	t.fns[MIPS_INS_MUL_Q] = nullptr;
+	t.fns[MIPS_INS_MUL_S] = nullptr;
+	t.fns[MIPS_INS_NLOC] = nullptr;
+	t.fns[MIPS_INS_NLZC] = nullptr;
+	t.fns[MIPS_INS_NMADD] = &Capstone2LlvmIrTranslatorMips::translateNmadd;
+	t.fns[MIPS_INS_NMSUB] = &Capstone2LlvmIrTranslatorMips::translateNmsub;
+	t.fns[MIPS_INS_NOR] = &Capstone2LlvmIrTranslatorMips::translateNor;
+	t.fns[MIPS_INS_NORI] = &Capstone2LlvmIrTranslatorMips::translateNor;
+	t.fns[MIPS_INS_NOT16] = nullptr;
+	t.fns[MIPS_INS_NOT] = nullptr;
+	t.fns[MIPS_INS_OR] = &Capstone2LlvmIrTranslatorMips::translateOr;
+	t.fns[MIPS_INS_OR16] = nullptr;
+	t.fns[MIPS_INS_ORI] = &Capstone2LlvmIrTranslatorMips::translateOr;
+	t.fns[MIPS_INS_PACKRL] = nullptr;
+	t.fns[MIPS_INS_PAUSE] = nullptr;
+	t.fns[MIPS_INS_PCKEV] = nullptr;
+	t.fns[MIPS_INS_PCKOD] = nullptr;
+	t.fns[MIPS_INS_PCNT] = nullptr;
+	t.fns[MIPS_INS_PICK] = nullptr;
+	t.fns[MIPS_INS_POP] = nullptr;
+	t.fns[MIPS_INS_PRECEQU] = nullptr;
+	t.fns[MIPS_INS_PRECEQ] = nullptr;
+	t.fns[MIPS_INS_PRECEU] = nullptr;
+	t.fns[MIPS_INS_PRECRQU_S] = nullptr;
+	t.fns[MIPS_INS_PRECRQ] = nullptr;
+	t.fns[MIPS_INS_PRECRQ_RS] = nullptr;
+	t.fns[MIPS_INS_PRECR] = nullptr;
+	t.fns[MIPS_INS_PRECR_SRA] = nullptr;
+	t.fns[MIPS_INS_PRECR_SRA_R] = nullptr;
+	t.fns[MIPS_INS_PREF] = nullptr;
+	t.fns[MIPS_INS_PREPEND] = nullptr;
+	t.fns[MIPS_INS_RADDU] = nullptr;
+	t.fns[MIPS_INS_RDDSP] = nullptr;
+	t.fns[MIPS_INS_RDHWR] = nullptr;
+	t.fns[MIPS_INS_REPLV] = nullptr;
+	t.fns[MIPS_INS_REPL] = nullptr;
+	t.fns[MIPS_INS_RINT] = nullptr;
+	t.fns[MIPS_INS_ROTR] = &Capstone2LlvmIrTranslatorMips::translateRotr;
+	t.fns[MIPS_INS_ROTRV] = &Capstone2LlvmIrTranslatorMips::translateRotr;
+	t.fns[MIPS_INS_ROUND] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_SAT_S] = nullptr;
+	t.fns[MIPS_INS_SAT_U] = nullptr;
+	t.fns[MIPS_INS_SB] = &Capstone2LlvmIrTranslatorMips::translateStoreMemory;
+	t.fns[MIPS_INS_SB16] = nullptr;
+	t.fns[MIPS_INS_SC] = nullptr;
+	t.fns[MIPS_INS_SCD] = nullptr;
+	t.fns[MIPS_INS_SD] = &Capstone2LlvmIrTranslatorMips::translateStoreMemory;
+	t.fns[MIPS_INS_SDBBP] = nullptr;
+	t.fns[MIPS_INS_SDBBP16] = nullptr;
+	t.fns[MIPS_INS_SDC1] = &Capstone2LlvmIrTranslatorMips::translateStoreMemory;
+	t.fns[MIPS_INS_SDC2] = nullptr;
+	t.fns[MIPS_INS_SDC3] = &Capstone2LlvmIrTranslatorMips::translateStoreMemory;
+	t.fns[MIPS_INS_SDL] = nullptr;
+	t.fns[MIPS_INS_SDR] = nullptr;
+	t.fns[MIPS_INS_SDXC1] = nullptr;
+	t.fns[MIPS_INS_SEB] = &Capstone2LlvmIrTranslatorMips::translateSeb;
+	t.fns[MIPS_INS_SEH] = &Capstone2LlvmIrTranslatorMips::translateSeh;
+	t.fns[MIPS_INS_SELEQZ] = nullptr;
+	t.fns[MIPS_INS_SELNEZ] = nullptr;
+	t.fns[MIPS_INS_SEL] = nullptr;
+	t.fns[MIPS_INS_SEQ] = nullptr;
+	t.fns[MIPS_INS_SEQI] = nullptr;
+	t.fns[MIPS_INS_SH] = &Capstone2LlvmIrTranslatorMips::translateStoreMemory;
+	t.fns[MIPS_INS_SH16] = nullptr;
+	t.fns[MIPS_INS_SHF] = nullptr;
+	t.fns[MIPS_INS_SHILO] = nullptr;
+	t.fns[MIPS_INS_SHILOV] = nullptr;
+	t.fns[MIPS_INS_SHLLV] = nullptr;
+	t.fns[MIPS_INS_SHLLV_S] = nullptr;
+	t.fns[MIPS_INS_SHLL] = nullptr;
+	t.fns[MIPS_INS_SHLL_S] = nullptr;
+	t.fns[MIPS_INS_SHRAV] = nullptr;
+	t.fns[MIPS_INS_SHRAV_R] = nullptr;
+	t.fns[MIPS_INS_SHRA] = nullptr;
+	t.fns[MIPS_INS_SHRA_R] = nullptr;
+	t.fns[MIPS_INS_SHRLV] = nullptr;
+	t.fns[MIPS_INS_SHRL] = nullptr;
+	t.fns[MIPS_INS_SLDI] = nullptr;
+	t.fns[MIPS_INS_SLD] = nullptr;
+	t.fns[MIPS_INS_SLL] = &Capstone2LlvmIrTranslatorMips::translateSll;
+	t.fns[MIPS_INS_SLL16] = nullptr;
+	t.fns[MIPS_INS_SLLI] = nullptr;
+	t.fns[MIPS_INS_SLLV] = &Capstone2LlvmIrTranslatorMips::translateSll;
+	t.fns[MIPS_INS_SLT] = &Capstone2LlvmIrTranslatorMips::translateSlt;
+	t.fns[MIPS_INS_SLTI] = &Capstone2LlvmIrTranslatorMips::translateSlt;
+	t.fns[MIPS_INS_SLTIU] = &Capstone2LlvmIrTranslatorMips::translateSltu;
+	t.fns[MIPS_INS_SLTU] = &Capstone2LlvmIrTranslatorMips::translateSltu;
+	t.fns[MIPS_INS_SNE] = nullptr;
+	t.fns[MIPS_INS_SNEI] = nullptr;
+	t.fns[MIPS_INS_SPLATI] = nullptr;
+	t.fns[MIPS_INS_SPLAT] = nullptr;
+	t.fns[MIPS_INS_SRA] = &Capstone2LlvmIrTranslatorMips::translateSra;
+	t.fns[MIPS_INS_SRAI] = nullptr;
+	t.fns[MIPS_INS_SRARI] = nullptr;
+	t.fns[MIPS_INS_SRAR] = nullptr;
+	t.fns[MIPS_INS_SRAV] = &Capstone2LlvmIrTranslatorMips::translateSra;
+	t.fns[MIPS_INS_SRL] = &Capstone2LlvmIrTranslatorMips::translateSrl;
+	t.fns[MIPS_INS_SRL16] = nullptr;
+	t.fns[MIPS_INS_SRLI] = nullptr;
+	t.fns[MIPS_INS_SRLRI] = nullptr;
+	t.fns[MIPS_INS_SRLR] = nullptr;
+	t.fns[MIPS_INS_SRLV] = &Capstone2LlvmIrTranslatorMips::translateSrl;
+	t.fns[MIPS_INS_SSNOP] = nullptr;
+	t.fns[MIPS_INS_ST] = nullptr;
+	t.fns[MIPS_INS_SUBQH] = nullptr;
+	t.fns[MIPS_INS_SUBQH_R] = nullptr;
+	t.fns[MIPS_INS_SUBQ] = nullptr;
+	t.fns[MIPS_INS_SUBQ_S] = nullptr;
+	t.fns[MIPS_INS_SUBSUS_U] = nullptr;
+	t.fns[MIPS_INS_SUBSUU_S] = nullptr;
+	t.fns[MIPS_INS_SUBS_S] = nullptr;
+	t.fns[MIPS_INS_SUBS_U] = nullptr;
+	t.fns[MIPS_INS_SUBU16] = nullptr;
+	t.fns[MIPS_INS_SUBUH] = nullptr;
+	t.fns[MIPS_INS_SUBUH_R] = nullptr;
+	t.fns[MIPS_INS_SUBU] = &Capstone2LlvmIrTranslatorMips::translateSub;
+	t.fns[MIPS_INS_SUBU_S] = nullptr;
+	t.fns[MIPS_INS_SUBVI] = nullptr;
+	t.fns[MIPS_INS_SUBV] = nullptr;
+	t.fns[MIPS_INS_SUXC1] = nullptr;
+	t.fns[MIPS_INS_SW] = &Capstone2LlvmIrTranslatorMips::translateStoreMemory;
+	t.fns[MIPS_INS_SW16] = nullptr;
+	t.fns[MIPS_INS_SWC1] = &Capstone2LlvmIrTranslatorMips::translateStoreMemory;
+	t.fns[MIPS_INS_SWC2] = nullptr;
+	t.fns[MIPS_INS_SWC3] = nullptr;
+	t.fns[MIPS_INS_SWL] = &Capstone2LlvmIrTranslatorMips::translateSwl;
+	t.fns[MIPS_INS_SWM16] = nullptr;
+	t.fns[MIPS_INS_SWM32] = nullptr;
+	t.fns[MIPS_INS_SWP] = nullptr;
+	t.fns[MIPS_INS_SWR] = &Capstone2LlvmIrTranslatorMips::translateSwr;
+	t.fns[MIPS_INS_SWXC1] = nullptr;
+	t.fns[MIPS_INS_SYNC] = nullptr;
+	t.fns[MIPS_INS_SYNCI] = nullptr;
+	t.fns[MIPS_INS_SYSCALL] = &Capstone2LlvmIrTranslatorMips::translateSyscall;
+	t.fns[MIPS_INS_TEQ] = nullptr;
+	t.fns[MIPS_INS_TEQI] = nullptr;
+	t.fns[MIPS_INS_TGE] = nullptr;
+	t.fns[MIPS_INS_TGEI] = nullptr;
+	t.fns[MIPS_INS_TGEIU] = nullptr;
+	t.fns[MIPS_INS_TGEU] = nullptr;
+	t.fns[MIPS_INS_TLBP] = nullptr;
+	t.fns[MIPS_INS_TLBR] = nullptr;
+	t.fns[MIPS_INS_TLBWI] = nullptr;
+	t.fns[MIPS_INS_TLBWR] = nullptr;
+	t.fns[MIPS_INS_TLT] = nullptr;
+	t.fns[MIPS_INS_TLTI] = nullptr;
+	t.fns[MIPS_INS_TLTIU] = nullptr;
+	t.fns[MIPS_INS_TLTU] = nullptr;
+	t.fns[MIPS_INS_TNE] = nullptr;
+	t.fns[MIPS_INS_TNEI] = nullptr;
+	t.fns[MIPS_INS_TRUNC] = &Capstone2LlvmIrTranslatorMips::translateBinaryPseudoAsm;
+	t.fns[MIPS_INS_V3MULU] = nullptr;
+	t.fns[MIPS_INS_VMM0] = nullptr;
+	t.fns[MIPS_INS_VMULU] = nullptr;
+	t.fns[MIPS_INS_VSHF] = nullptr;
+	t.fns[MIPS_INS_WAIT] = nullptr;
+	t.fns[MIPS_INS_WRDSP] = nullptr;
+	t.fns[MIPS_INS_WSBH] = &Capstone2LlvmIrTranslatorMips::translateWsbh;
+	t.fns[MIPS_INS_XOR] = &Capstone2LlvmIrTranslatorMips::translateXor;
+	t.fns[MIPS_INS_XOR16] = nullptr;
+	t.fns[MIPS_INS_XORI] = &Capstone2LlvmIrTranslatorMips::translateXor;
 
-		// special instructions
-		{MIPS_INS_JALR_HB, nullptr}, // jump and link with Hazard Barrier
-		{MIPS_INS_JR_HB, nullptr}, // jump register with Hazard Barrier
+	// some alias instructions
+	t.fns[MIPS_INS_NOP] = &Capstone2LlvmIrTranslatorMips::translateNop;
+	t.fns[MIPS_INS_NEGU] = &Capstone2LlvmIrTranslatorMips::translateNegu;
 
-		{MIPS_INS_ENDING, nullptr},
-};
+	// special instructions
+	t.fns[MIPS_INS_JALR_HB] = nullptr; // jump and link with Hazard Barrier
+	t.fns[MIPS_INS_JR_HB] = nullptr; // jump register with Hazard Barrier
+
+	return t;
+}
+
+const Capstone2LlvmIrTranslatorMips::DispatchTable Capstone2LlvmIrTranslatorMips::_i2fm =
+		Capstone2LlvmIrTranslatorMips::makeDispatchTable();
 
 } // namespace capstone2llvmir
 } // namespace retdec
@@ -265,10 +265,9 @@ void Capstone2LlvmIrTranslatorPowerpc::translateInstruction(
 
 //std::cout << std::hex << i->address << " @ " << i->mnemonic << " " << i->op_str << std::endl;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	auto f = i->id < PPC_INS_ENDING ? _i2fm.fns[i->id] : nullptr;
+	if (f != nullptr)
 	{
-		auto f = fIt->second;
 		(this->*f)(i, pi, irb);
 	}
 	else
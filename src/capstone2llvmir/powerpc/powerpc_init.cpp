@@ -370,1158 +370,1161 @@ void Capstone2LlvmIrTranslatorPowerpc::initializeRegTypeMap()
 	_reg2type = std::move(r2t);
 }
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorPowerpc::*)(cs_insn* i, cs_ppc*, llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorPowerpc::_i2fm =
+constexpr Capstone2LlvmIrTranslatorPowerpc::DispatchTable Capstone2LlvmIrTranslatorPowerpc::makeDispatchTable()
 {
-		{PPC_INS_INVALID, nullptr},
+	DispatchTable t = {};
 
-		{PPC_INS_ADD, &Capstone2LlvmIrTranslatorPowerpc::translateAdd},
-		{PPC_INS_ADDC, &Capstone2LlvmIrTranslatorPowerpc::translateAddc},
-		{PPC_INS_ADDE, &Capstone2LlvmIrTranslatorPowerpc::translateAdde},
-		{PPC_INS_ADDI, &Capstone2LlvmIrTranslatorPowerpc::translateAdd},
-		{PPC_INS_ADDIC, &Capstone2LlvmIrTranslatorPowerpc::translateAddc},
-		{PPC_INS_ADDIS, &Capstone2LlvmIrTranslatorPowerpc::translateAddis},
-		{PPC_INS_ADDME, &Capstone2LlvmIrTranslatorPowerpc::translateAddme},
-		{PPC_INS_ADDZE, &Capstone2LlvmIrTranslatorPowerpc::translateAddze},
-		{PPC_INS_AND, &Capstone2LlvmIrTranslatorPowerpc::translateAnd},
-		{PPC_INS_ANDC, &Capstone2LlvmIrTranslatorPowerpc::translateAndc},
-		{PPC_INS_ANDIS, &Capstone2LlvmIrTranslatorPowerpc::translateAndis},
-		{PPC_INS_ANDI, &Capstone2LlvmIrTranslatorPowerpc::translateAnd},
-		{PPC_INS_ATTN, nullptr},
-		{PPC_INS_BRINC, nullptr},
-		{PPC_INS_CMPB, nullptr},
-		{PPC_INS_CMPD, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CMPDI, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CMPLD, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CMPLDI, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CMPLW, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CMPLWI, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CMPW, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CMPWI, &Capstone2LlvmIrTranslatorPowerpc::translateCmp},
-		{PPC_INS_CNTLZD, nullptr},
-		{PPC_INS_CNTLZW, &Capstone2LlvmIrTranslatorPowerpc::translateCntlzw},
-		{PPC_INS_CREQV, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_CRXOR, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_CRAND, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_CRANDC, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_CRNAND, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_CRNOR, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_CROR, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_CRORC, &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary},
-		{PPC_INS_DCBA, nullptr},
-		{PPC_INS_DCBF, nullptr},
-		{PPC_INS_DCBI, nullptr},
-		{PPC_INS_DCBST, nullptr},
-		{PPC_INS_DCBT, nullptr},
-		{PPC_INS_DCBTST, nullptr},
-		{PPC_INS_DCBZ, nullptr},
-		{PPC_INS_DCBZL, nullptr},
-		{PPC_INS_DCCCI, nullptr},
-		{PPC_INS_DIVD, nullptr},
-		{PPC_INS_DIVDU, nullptr},
-		{PPC_INS_DIVW, &Capstone2LlvmIrTranslatorPowerpc::translateDivw},
-		{PPC_INS_DIVWU, &Capstone2LlvmIrTranslatorPowerpc::translateDivw},
-		{PPC_INS_DSS, nullptr},
-		{PPC_INS_DSSALL, nullptr},
-		{PPC_INS_DST, nullptr},
-		{PPC_INS_DSTST, nullptr},
-		{PPC_INS_DSTSTT, nullptr},
-		{PPC_INS_DSTT, nullptr},
-		{PPC_INS_EQV, &Capstone2LlvmIrTranslatorPowerpc::translateEqv},
-		{PPC_INS_EVABS, nullptr},
-		{PPC_INS_EVADDIW, nullptr},
-		{PPC_INS_EVADDSMIAAW, nullptr},
-		{PPC_INS_EVADDSSIAAW, nullptr},
-		{PPC_INS_EVADDUMIAAW, nullptr},
-		{PPC_INS_EVADDUSIAAW, nullptr},
-		{PPC_INS_EVADDW, nullptr},
-		{PPC_INS_EVAND, nullptr},
-		{PPC_INS_EVANDC, nullptr},
-		{PPC_INS_EVCMPEQ, nullptr},
-		{PPC_INS_EVCMPGTS, nullptr},
-		{PPC_INS_EVCMPGTU, nullptr},
-		{PPC_INS_EVCMPLTS, nullptr},
-		{PPC_INS_EVCMPLTU, nullptr},
-		{PPC_INS_EVCNTLSW, nullptr},
-		{PPC_INS_EVCNTLZW, nullptr},
-		{PPC_INS_EVDIVWS, nullptr},
-		{PPC_INS_EVDIVWU, nullptr},
-		{PPC_INS_EVEQV, nullptr},
-		{PPC_INS_EVEXTSB, nullptr},
-		{PPC_INS_EVEXTSH, nullptr},
-		{PPC_INS_EVLDD, nullptr},
-		{PPC_INS_EVLDDX, nullptr},
-		{PPC_INS_EVLDH, nullptr},
-		{PPC_INS_EVLDHX, nullptr},
-		{PPC_INS_EVLDW, nullptr},
-		{PPC_INS_EVLDWX, nullptr},
-		{PPC_INS_EVLHHESPLAT, nullptr},
-		{PPC_INS_EVLHHESPLATX, nullptr},
-		{PPC_INS_EVLHHOSSPLAT, nullptr},
-		{PPC_INS_EVLHHOSSPLATX, nullptr},
-		{PPC_INS_EVLHHOUSPLAT, nullptr},
-		{PPC_INS_EVLHHOUSPLATX, nullptr},
-		{PPC_INS_EVLWHE, nullptr},
-		{PPC_INS_EVLWHEX, nullptr},
-		{PPC_INS_EVLWHOS, nullptr},
-		{PPC_INS_EVLWHOSX, nullptr},
-		{PPC_INS_EVLWHOU, nullptr},
-		{PPC_INS_EVLWHOUX, nullptr},
-		{PPC_INS_EVLWHSPLAT, nullptr},
-		{PPC_INS_EVLWHSPLATX, nullptr},
-		{PPC_INS_EVLWWSPLAT, nullptr},
-		{PPC_INS_EVLWWSPLATX, nullptr},
-		{PPC_INS_EVMERGEHI, nullptr},
-		{PPC_INS_EVMERGEHILO, nullptr},
-		{PPC_INS_EVMERGELO, nullptr},
-		{PPC_INS_EVMERGELOHI, nullptr},
-		{PPC_INS_EVMHEGSMFAA, nullptr},
-		{PPC_INS_EVMHEGSMFAN, nullptr},
-		{PPC_INS_EVMHEGSMIAA, nullptr},
-		{PPC_INS_EVMHEGSMIAN, nullptr},
-		{PPC_INS_EVMHEGUMIAA, nullptr},
-		{PPC_INS_EVMHEGUMIAN, nullptr},
-		{PPC_INS_EVMHESMF, nullptr},
-		{PPC_INS_EVMHESMFA, nullptr},
-		{PPC_INS_EVMHESMFAAW, nullptr},
-		{PPC_INS_EVMHESMFANW, nullptr},
-		{PPC_INS_EVMHESMI, nullptr},
-		{PPC_INS_EVMHESMIA, nullptr},
-		{PPC_INS_EVMHESMIAAW, nullptr},
-		{PPC_INS_EVMHESMIANW, nullptr},
-		{PPC_INS_EVMHESSF, nullptr},
-		{PPC_INS_EVMHESSFA, nullptr},
-		{PPC_INS_EVMHESSFAAW, nullptr},
-		{PPC_INS_EVMHESSFANW, nullptr},
-		{PPC_INS_EVMHESSIAAW, nullptr},
-		{PPC_INS_EVMHESSIANW, nullptr},
-		{PPC_INS_EVMHEUMI, nullptr},
-		{PPC_INS_EVMHEUMIA, nullptr},
-		{PPC_INS_EVMHEUMIAAW, nullptr},
-		{PPC_INS_EVMHEUMIANW, nullptr},
-		{PPC_INS_EVMHEUSIAAW, nullptr},
-		{PPC_INS_EVMHEUSIANW, nullptr},
-		{PPC_INS_EVMHOGSMFAA, nullptr},
-		{PPC_INS_EVMHOGSMFAN, nullptr},
-		{PPC_INS_EVMHOGSMIAA, nullptr},
-		{PPC_INS_EVMHOGSMIAN, nullptr},
-		{PPC_INS_EVMHOGUMIAA, nullptr},
-		{PPC_INS_EVMHOGUMIAN, nullptr},
-		{PPC_INS_EVMHOSMF, nullptr},
-		{PPC_INS_EVMHOSMFA, nullptr},
-		{PPC_INS_EVMHOSMFAAW, nullptr},
-		{PPC_INS_EVMHOSMFANW, nullptr},
-		{PPC_INS_EVMHOSMI, nullptr},
-		{PPC_INS_EVMHOSMIA, nullptr},
-		{PPC_INS_EVMHOSMIAAW, nullptr},
-		{PPC_INS_EVMHOSMIANW, nullptr},
-		{PPC_INS_EVMHOSSF, nullptr},
-		{PPC_INS_EVMHOSSFA, nullptr},
-		{PPC_INS_EVMHOSSFAAW, nullptr},
-		{PPC_INS_EVMHOSSFANW, nullptr},
-		{PPC_INS_EVMHOSSIAAW, nullptr},
-		{PPC_INS_EVMHOSSIANW, nullptr},
-		{PPC_INS_EVMHOUMI, nullptr},
-		{PPC_INS_EVMHOUMIA, nullptr},
-		{PPC_INS_EVMHOUMIAAW, nullptr},
-		{PPC_INS_EVMHOUMIANW, nullptr},
-		{PPC_INS_EVMHOUSIAAW, nullptr},
-		{PPC_INS_EVMHOUSIANW, nullptr},
-		{PPC_INS_EVMRA, nullptr},
-		{PPC_INS_EVMWHSMF, nullptr},
-		{PPC_INS_EVMWHSMFA, nullptr},
-		{PPC_INS_EVMWHSMI, nullptr},
-		{PPC_INS_EVMWHSMIA, nullptr},
-		{PPC_INS_EVMWHSSF, nullptr},
-		{PPC_INS_EVMWHSSFA, nullptr},
-		{PPC_INS_EVMWHUMI, nullptr},
-		{PPC_INS_EVMWHUMIA, nullptr},
-		{PPC_INS_EVMWLSMIAAW, nullptr},
-		{PPC_INS_EVMWLSMIANW, nullptr},
-		{PPC_INS_EVMWLSSIAAW, nullptr},
-		{PPC_INS_EVMWLSSIANW, nullptr},
-		{PPC_INS_EVMWLUMI, nullptr},
-		{PPC_INS_EVMWLUMIA, nullptr},
-		{PPC_INS_EVMWLUMIAAW, nullptr},
-		{PPC_INS_EVMWLUMIANW, nullptr},
-		{PPC_INS_EVMWLUSIAAW, nullptr},
-		{PPC_INS_EVMWLUSIANW, nullptr},
-		{PPC_INS_EVMWSMF, nullptr},
-		{PPC_INS_EVMWSMFA, nullptr},
-		{PPC_INS_EVMWSMFAA, nullptr},
-		{PPC_INS_EVMWSMFAN, nullptr},
-		{PPC_INS_EVMWSMI, nullptr},
-		{PPC_INS_EVMWSMIA, nullptr},
-		{PPC_INS_EVMWSMIAA, nullptr},
-		{PPC_INS_EVMWSMIAN, nullptr},
-		{PPC_INS_EVMWSSF, nullptr},
-		{PPC_INS_EVMWSSFA, nullptr},
-		{PPC_INS_EVMWSSFAA, nullptr},
-		{PPC_INS_EVMWSSFAN, nullptr},
-		{PPC_INS_EVMWUMI, nullptr},
-		{PPC_INS_EVMWUMIA, nullptr},
-		{PPC_INS_EVMWUMIAA, nullptr},
-		{PPC_INS_EVMWUMIAN, nullptr},
-		{PPC_INS_EVNAND, nullptr},
-		{PPC_INS_EVNEG, nullptr},
-		{PPC_INS_EVNOR, nullptr},
-		{PPC_INS_EVOR, nullptr},
-		{PPC_INS_EVORC, nullptr},
-		{PPC_INS_EVRLW, nullptr},
-		{PPC_INS_EVRLWI, nullptr},
-		{PPC_INS_EVRNDW, nullptr},
-		{PPC_INS_EVSLW, nullptr},
-		{PPC_INS_EVSLWI, nullptr},
-		{PPC_INS_EVSPLATFI, nullptr},
-		{PPC_INS_EVSPLATI, nullptr},
-		{PPC_INS_EVSRWIS, nullptr},
-		{PPC_INS_EVSRWIU, nullptr},
-		{PPC_INS_EVSRWS, nullptr},
-		{PPC_INS_EVSRWU, nullptr},
-		{PPC_INS_EVSTDD, nullptr},
-		{PPC_INS_EVSTDDX, nullptr},
-		{PPC_INS_EVSTDH, nullptr},
-		{PPC_INS_EVSTDHX, nullptr},
-		{PPC_INS_EVSTDW, nullptr},
-		{PPC_INS_EVSTDWX, nullptr},
-		{PPC_INS_EVSTWHE, nullptr},
-		{PPC_INS_EVSTWHEX, nullptr},
-		{PPC_INS_EVSTWHO, nullptr},
-		{PPC_INS_EVSTWHOX, nullptr},
-		{PPC_INS_EVSTWWE, nullptr},
-		{PPC_INS_EVSTWWEX, nullptr},
-		{PPC_INS_EVSTWWO, nullptr},
-		{PPC_INS_EVSTWWOX, nullptr},
-		{PPC_INS_EVSUBFSMIAAW, nullptr},
-		{PPC_INS_EVSUBFSSIAAW, nullptr},
-		{PPC_INS_EVSUBFUMIAAW, nullptr},
-		{PPC_INS_EVSUBFUSIAAW, nullptr},
-		{PPC_INS_EVSUBFW, nullptr},
-		{PPC_INS_EVSUBIFW, nullptr},
-		{PPC_INS_EVXOR, nullptr},
-		{PPC_INS_EXTSB, &Capstone2LlvmIrTranslatorPowerpc::translateExtendSign},
-		{PPC_INS_EXTSH, &Capstone2LlvmIrTranslatorPowerpc::translateExtendSign},
-		{PPC_INS_EXTSW, &Capstone2LlvmIrTranslatorPowerpc::translateExtendSign},
-		{PPC_INS_EIEIO, nullptr},
-		{PPC_INS_FABS, nullptr},
-		{PPC_INS_FADD, nullptr},
-		{PPC_INS_FADDS, nullptr},
-		{PPC_INS_FCFID, nullptr},
-		{PPC_INS_FCFIDS, nullptr},
-		{PPC_INS_FCFIDU, nullptr},
-		{PPC_INS_FCFIDUS, nullptr},
-		{PPC_INS_FCMPU, nullptr},
-		{PPC_INS_FCPSGN, nullptr},
-		{PPC_INS_FCTID, nullptr},
-		{PPC_INS_FCTIDUZ, nullptr},
-		{PPC_INS_FCTIDZ, nullptr},
-		{PPC_INS_FCTIW, nullptr},
-		{PPC_INS_FCTIWUZ, nullptr},
-		{PPC_INS_FCTIWZ, nullptr},
-		{PPC_INS_FDIV, nullptr},
-		{PPC_INS_FDIVS, nullptr},
-		{PPC_INS_FMADD, nullptr},
-		{PPC_INS_FMADDS, nullptr},
-		{PPC_INS_FMR, nullptr},
-		{PPC_INS_FMSUB, nullptr},
-		{PPC_INS_FMSUBS, nullptr},
-		{PPC_INS_FMUL, nullptr},
-		{PPC_INS_FMULS, nullptr},
-		{PPC_INS_FNABS, nullptr},
-		{PPC_INS_FNEG, nullptr},
-		{PPC_INS_FNMADD, nullptr},
-		{PPC_INS_FNMADDS, nullptr},
-		{PPC_INS_FNMSUB, nullptr},
-		{PPC_INS_FNMSUBS, nullptr},
-		{PPC_INS_FRE, nullptr},
-		{PPC_INS_FRES, nullptr},
-		{PPC_INS_FRIM, nullptr},
-		{PPC_INS_FRIN, nullptr},
-		{PPC_INS_FRIP, nullptr},
-		{PPC_INS_FRIZ, nullptr},
-		{PPC_INS_FRSP, nullptr},
-		{PPC_INS_FRSQRTE, nullptr},
-		{PPC_INS_FRSQRTES, nullptr},
-		{PPC_INS_FSEL, nullptr},
-		{PPC_INS_FSQRT, nullptr},
-		{PPC_INS_FSQRTS, nullptr},
-		{PPC_INS_FSUB, nullptr},
-		{PPC_INS_FSUBS, nullptr},
-		{PPC_INS_ICBI, nullptr},
-		{PPC_INS_ICBT, nullptr},
-		{PPC_INS_ICCCI, nullptr},
-		{PPC_INS_ISEL, nullptr},
-		{PPC_INS_ISYNC, nullptr},
+	t.fns[PPC_INS_INVALID] = nullptr;
 
-		{PPC_INS_LA, &Capstone2LlvmIrTranslatorPowerpc::translateAdd},
-		{PPC_INS_LBZ, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LBZCIX, nullptr},
-		{PPC_INS_LBZU, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LBZUX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
-		{PPC_INS_LBZX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
-		{PPC_INS_LD, nullptr},
-		{PPC_INS_LDARX, nullptr},
-		{PPC_INS_LDBRX, nullptr},
-		{PPC_INS_LDCIX, nullptr},
-		{PPC_INS_LDU, nullptr},
-		{PPC_INS_LDUX, nullptr},
-		{PPC_INS_LDX, nullptr},
-		{PPC_INS_LFD, nullptr},
-		{PPC_INS_LFDU, nullptr},
-		{PPC_INS_LFDUX, nullptr},
-		{PPC_INS_LFDX, nullptr},
-		{PPC_INS_LFIWAX, nullptr},
-		{PPC_INS_LFIWZX, nullptr},
-		{PPC_INS_LFS, nullptr},
-		{PPC_INS_LFSU, nullptr},
-		{PPC_INS_LFSUX, nullptr},
-		{PPC_INS_LFSX, nullptr},
-		{PPC_INS_LHA, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LHAU, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LHAUX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
-		{PPC_INS_LHAX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
-		{PPC_INS_LHBRX, &Capstone2LlvmIrTranslatorPowerpc::translateLhbrx},
-		{PPC_INS_LHZ, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LHZCIX, nullptr},
-		{PPC_INS_LHZU, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LHZUX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
-		{PPC_INS_LHZX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
-		{PPC_INS_LI, &Capstone2LlvmIrTranslatorPowerpc::translateLi},
-		{PPC_INS_LIS, &Capstone2LlvmIrTranslatorPowerpc::translateLis},
-		{PPC_INS_LMW, nullptr},
-		{PPC_INS_LSWI, nullptr},
-		{PPC_INS_LVEBX, nullptr},
-		{PPC_INS_LVEHX, nullptr},
-		{PPC_INS_LVEWX, nullptr},
-		{PPC_INS_LVSL, nullptr},
-		{PPC_INS_LVSR, nullptr},
-		{PPC_INS_LVX, nullptr},
-		{PPC_INS_LVXL, nullptr},
-		{PPC_INS_LWA, nullptr},
-		{PPC_INS_LWARX, nullptr},
-		{PPC_INS_LWAUX, nullptr},
-		{PPC_INS_LWAX, nullptr},
-		{PPC_INS_LWBRX, &Capstone2LlvmIrTranslatorPowerpc::translateLwbrx},
-		{PPC_INS_LWZ, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LWZCIX, nullptr},
-		{PPC_INS_LWZU, &Capstone2LlvmIrTranslatorPowerpc::translateLoad},
-		{PPC_INS_LWZUX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
-		{PPC_INS_LWZX, &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed},
+	t.fns[PPC_INS_ADD] = &Capstone2LlvmIrTranslatorPowerpc::translateAdd;
+	t.fns[PPC_INS_ADDC] = &Capstone2LlvmIrTranslatorPowerpc::translateAddc;
+	t.fns[PPC_INS_ADDE] = &Capstone2LlvmIrTranslatorPowerpc::translateAdde;
+	t.fns[PPC_INS_ADDI] = &Capstone2LlvmIrTranslatorPowerpc::translateAdd;
+	t.fns[PPC_INS_ADDIC] = &Capstone2LlvmIrTranslatorPowerpc::translateAddc;
+	t.fns[PPC_INS_ADDIS] = &Capstone2LlvmIrTranslatorPowerpc::translateAddis;
+	t.fns[PPC_INS_ADDME] = &Capstone2LlvmIrTranslatorPowerpc::translateAddme;
+	t.fns[PPC_INS_ADDZE] = &Capstone2LlvmIrTranslatorPowerpc::translateAddze;
+	t.fns[PPC_INS_AND] = &Capstone2LlvmIrTranslatorPowerpc::translateAnd;
+	t.fns[PPC_INS_ANDC] = &Capstone2LlvmIrTranslatorPowerpc::translateAndc;
+	t.fns[PPC_INS_ANDIS] = &Capstone2LlvmIrTranslatorPowerpc::translateAndis;
+	t.fns[PPC_INS_ANDI] = &Capstone2LlvmIrTranslatorPowerpc::translateAnd;
+	t.fns[PPC_INS_ATTN] = nullptr;
+	t.fns[PPC_INS_BRINC] = nullptr;
+	t.fns[PPC_INS_CMPB] = nullptr;
+	t.fns[PPC_INS_CMPD] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CMPDI] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CMPLD] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CMPLDI] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CMPLW] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CMPLWI] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CMPW] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CMPWI] = &Capstone2LlvmIrTranslatorPowerpc::translateCmp;
+	t.fns[PPC_INS_CNTLZD] = nullptr;
+	t.fns[PPC_INS_CNTLZW] = &Capstone2LlvmIrTranslatorPowerpc::translateCntlzw;
+	t.fns[PPC_INS_CREQV] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_CRXOR] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_CRAND] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_CRANDC] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_CRNAND] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_CRNOR] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_CROR] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_CRORC] = &Capstone2LlvmIrTranslatorPowerpc::translateCrModifTernary;
+	t.fns[PPC_INS_DCBA] = nullptr;
+	t.fns[PPC_INS_DCBF] = nullptr;
+	t.fns[PPC_INS_DCBI] = nullptr;
+	t.fns[PPC_INS_DCBST] = nullptr;
+	t.fns[PPC_INS_DCBT] = nullptr;
+	t.fns[PPC_INS_DCBTST] = nullptr;
+	t.fns[PPC_INS_DCBZ] = nullptr;
+	t.fns[PPC_INS_DCBZL] = nullptr;
+	t.fns[PPC_INS_DCCCI] = nullptr;
+	t.fns[PPC_INS_DIVD] = nullptr;
+	t.fns[PPC_INS_DIVDU] = nullptr;
+	t.fns[PPC_INS_DIVW] = &Capstone2LlvmIrTranslatorPowerpc::translateDivw;
+	t.fns[PPC_INS_DIVWU] = &Capstone2LlvmIrTranslatorPowerpc::translateDivw;
+	t.fns[PPC_INS_DSS] = nullptr;
+	t.fns[PPC_INS_DSSALL] = nullptr;
+	t.fns[PPC_INS_DST] = nullptr;
+	t.fns[PPC_INS_DSTST] = nullptr;
+	t.fns[PPC_INS_DSTSTT] = nullptr;
+	t.fns[PPC_INS_DSTT] = nullptr;
+	t.fns[PPC_INS_EQV] = &Capstone2LlvmIrTranslatorPowerpc::translateEqv;
+	t.fns[PPC_INS_EVABS] = nullptr;
+	t.fns[PPC_INS_EVADDIW] = nullptr;
+	t.fns[PPC_INS_EVADDSMIAAW] = nullptr;
+	t.fns[PPC_INS_EVADDSSIAAW] = nullptr;
+	t.fns[PPC_INS_EVADDUMIAAW] = nullptr;
+	t.fns[PPC_INS_EVADDUSIAAW] = nullptr;
+	t.fns[PPC_INS_EVADDW] = nullptr;
+	t.fns[PPC_INS_EVAND] = nullptr;
+	t.fns[PPC_INS_EVANDC] = nullptr;
+	t.fns[PPC_INS_EVCMPEQ] = nullptr;
+	t.fns[PPC_INS_EVCMPGTS] = nullptr;
+	t.fns[PPC_INS_EVCMPGTU] = nullptr;
+	t.fns[PPC_INS_EVCMPLTS] = nullptr;
+	t.fns[PPC_INS_EVCMPLTU] = nullptr;
+	t.fns[PPC_INS_EVCNTLSW] = nullptr;
+	t.fns[PPC_INS_EVCNTLZW] = nullptr;
+	t.fns[PPC_INS_EVDIVWS] = nullptr;
+	t.fns[PPC_INS_EVDIVWU] = nullptr;
+	t.fns[PPC_INS_EVEQV] = nullptr;
+	t.fns[PPC_INS_EVEXTSB] = nullptr;
+	t.fns[PPC_INS_EVEXTSH] = nullptr;
+	t.fns[PPC_INS_EVLDD] = nullptr;
+	t.fns[PPC_INS_EVLDDX] = nullptr;
+	t.fns[PPC_INS_EVLDH] = nullptr;
+	t.fns[PPC_INS_EVLDHX] = nullptr;
+	t.fns[PPC_INS_EVLDW] = nullptr;
+	t.fns[PPC_INS_EVLDWX] = nullptr;
+	t.fns[PPC_INS_EVLHHESPLAT] = nullptr;
+	t.fns[PPC_INS_EVLHHESPLATX] = nullptr;
+	t.fns[PPC_INS_EVLHHOSSPLAT] = nullptr;
+	t.fns[PPC_INS_EVLHHOSSPLATX] = nullptr;
+	t.fns[PPC_INS_EVLHHOUSPLAT] = nullptr;
+	t.fns[PPC_INS_EVLHHOUSPLATX] = nullptr;
+	t.fns[PPC_INS_EVLWHE] = nullptr;
+	t.fns[PPC_INS_EVLWHEX] = nullptr;
+	t.fns[PPC_INS_EVLWHOS] = nullptr;
+	t.fns[PPC_INS_EVLWHOSX] = nullptr;
+	t.fns[PPC_INS_EVLWHOU] = nullptr;
+	t.fns[PPC_INS_EVLWHOUX] = nullptr;
+	t.fns[PPC_INS_EVLWHSPLAT] = nullptr;
+	t.fns[PPC_INS_EVLWHSPLATX] = nullptr;
+	t.fns[PPC_INS_EVLWWSPLAT] = nullptr;
+	t.fns[PPC_INS_EVLWWSPLATX] = nullptr;
+	t.fns[PPC_INS_EVMERGEHI] = nullptr;
+	t.fns[PPC_INS_EVMERGEHILO] = nullptr;
+	t.fns[PPC_INS_EVMERGELO] = nullptr;
+	t.fns[PPC_INS_EVMERGELOHI] = nullptr;
+	t.fns[PPC_INS_EVMHEGSMFAA] = nullptr;
+	t.fns[PPC_INS_EVMHEGSMFAN] = nullptr;
+	t.fns[PPC_INS_EVMHEGSMIAA] = nullptr;
+	t.fns[PPC_INS_EVMHEGSMIAN] = nullptr;
+	t.fns[PPC_INS_EVMHEGUMIAA] = nullptr;
+	t.fns[PPC_INS_EVMHEGUMIAN] = nullptr;
+	t.fns[PPC_INS_EVMHESMF] = nullptr;
+	t.fns[PPC_INS_EVMHESMFA] = nullptr;
+	t.fns[PPC_INS_EVMHESMFAAW] = nullptr;
+	t.fns[PPC_INS_EVMHESMFANW] = nullptr;
+	t.fns[PPC_INS_EVMHESMI] = nullptr;
+	t.fns[PPC_INS_EVMHESMIA] = nullptr;
+	t.fns[PPC_INS_EVMHESMIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHESMIANW] = nullptr;
+	t.fns[PPC_INS_EVMHESSF] = nullptr;
+	t.fns[PPC_INS_EVMHESSFA] = nullptr;
+	t.fns[PPC_INS_EVMHESSFAAW] = nullptr;
+	t.fns[PPC_INS_EVMHESSFANW] = nullptr;
+	t.fns[PPC_INS_EVMHESSIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHESSIANW] = nullptr;
+	t.fns[PPC_INS_EVMHEUMI] = nullptr;
+	t.fns[PPC_INS_EVMHEUMIA] = nullptr;
+	t.fns[PPC_INS_EVMHEUMIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHEUMIANW] = nullptr;
+	t.fns[PPC_INS_EVMHEUSIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHEUSIANW] = nullptr;
+	t.fns[PPC_INS_EVMHOGSMFAA] = nullptr;
+	t.fns[PPC_INS_EVMHOGSMFAN] = nullptr;
+	t.fns[PPC_INS_EVMHOGSMIAA] = nullptr;
+	t.fns[PPC_INS_EVMHOGSMIAN] = nullptr;
+	t.fns[PPC_INS_EVMHOGUMIAA] = nullptr;
+	t.fns[PPC_INS_EVMHOGUMIAN] = nullptr;
+	t.fns[PPC_INS_EVMHOSMF] = nullptr;
+	t.fns[PPC_INS_EVMHOSMFA] = nullptr;
+	t.fns[PPC_INS_EVMHOSMFAAW] = nullptr;
+	t.fns[PPC_INS_EVMHOSMFANW] = nullptr;
+	t.fns[PPC_INS_EVMHOSMI] = nullptr;
+	t.fns[PPC_INS_EVMHOSMIA] = nullptr;
+	t.fns[PPC_INS_EVMHOSMIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHOSMIANW] = nullptr;
+	t.fns[PPC_INS_EVMHOSSF] = nullptr;
+	t.fns[PPC_INS_EVMHOSSFA] = nullptr;
+	t.fns[PPC_INS_EVMHOSSFAAW] = nullptr;
+	t.fns[PPC_INS_EVMHOSSFANW] = nullptr;
+	t.fns[PPC_INS_EVMHOSSIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHOSSIANW] = nullptr;
+	t.fns[PPC_INS_EVMHOUMI] = nullptr;
+	t.fns[PPC_INS_EVMHOUMIA] = nullptr;
+	t.fns[PPC_INS_EVMHOUMIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHOUMIANW] = nullptr;
+	t.fns[PPC_INS_EVMHOUSIAAW] = nullptr;
+	t.fns[PPC_INS_EVMHOUSIANW] = nullptr;
+	t.fns[PPC_INS_EVMRA] = nullptr;
+	t.fns[PPC_INS_EVMWHSMF] = nullptr;
+	t.fns[PPC_INS_EVMWHSMFA] = nullptr;
+	t.fns[PPC_INS_EVMWHSMI] = nullptr;
+	t.fns[PPC_INS_EVMWHSMIA] = nullptr;
+	t.fns[PPC_INS_EVMWHSSF] = nullptr;
+	t.fns[PPC_INS_EVMWHSSFA] = nullptr;
+	t.fns[PPC_INS_EVMWHUMI] = nullptr;
+	t.fns[PPC_INS_EVMWHUMIA] = nullptr;
+	t.fns[PPC_INS_EVMWLSMIAAW] = nullptr;
+	t.fns[PPC_INS_EVMWLSMIANW] = nullptr;
+	t.fns[PPC_INS_EVMWLSSIAAW] = nullptr;
+	t.fns[PPC_INS_EVMWLSSIANW] = nullptr;
+	t.fns[PPC_INS_EVMWLUMI] = nullptr;
+	t.fns[PPC_INS_EVMWLUMIA] = nullptr;
+	t.fns[PPC_INS_EVMWLUMIAAW] = nullptr;
+	t.fns[PPC_INS_EVMWLUMIANW] = nullptr;
+	t.fns[PPC_INS_EVMWLUSIAAW] = nullptr;
+	t.fns[PPC_INS_EVMWLUSIANW] = nullptr;
+	t.fns[PPC_INS_EVMWSMF] = nullptr;
+	t.fns[PPC_INS_EVMWSMFA] = nullptr;
+	t.fns[PPC_INS_EVMWSMFAA] = nullptr;
+	t.fns[PPC_INS_EVMWSMFAN] = nullptr;
+	t.fns[PPC_INS_EVMWSMI] = nullptr;
+	t.fns[PPC_INS_EVMWSMIA] = nullptr;
+	t.fns[PPC_INS_EVMWSMIAA] = nullptr;
+	t.fns[PPC_INS_EVMWSMIAN] = nullptr;
+	t.fns[PPC_INS_EVMWSSF] = nullptr;
+	t.fns[PPC_INS_EVMWSSFA] = nullptr;
+	t.fns[PPC_INS_EVMWSSFAA] = nullptr;
+	t.fns[PPC_INS_EVMWSSFAN] = nullptr;
+	t.fns[PPC_INS_EVMWUMI] = nullptr;
+	t.fns[PPC_INS_EVMWUMIA] = nullptr;
+	t.fns[PPC_INS_EVMWUMIAA] = nullptr;
+	t.fns[PPC_INS_EVMWUMIAN] = nullptr;
+	t.fns[PPC_INS_EVNAND] = nullptr;
+	t.fns[PPC_INS_EVNEG] = nullptr;
+	t.fns[PPC_INS_EVNOR] = nullptr;
+	t.fns[PPC_INS_EVOR] = nullptr;
+	t.fns[PPC_INS_EVORC] = nullptr;
+	t.fns[PPC_INS_EVRLW] = nullptr;
+	t.fns[PPC_INS_EVRLWI] = nullptr;
+	t.fns[PPC_INS_EVRNDW] = nullptr;
+	t.fns[PPC_INS_EVSLW] = nullptr;
+	t.fns[PPC_INS_EVSLWI] = nullptr;
+	t.fns[PPC_INS_EVSPLATFI] = nullptr;
+	t.fns[PPC_INS_EVSPLATI] = nullptr;
+	t.fns[PPC_INS_EVSRWIS] = nullptr;
+	t.fns[PPC_INS_EVSRWIU] = nullptr;
+	t.fns[PPC_INS_EVSRWS] = nullptr;
+	t.fns[PPC_INS_EVSRWU] = nullptr;
+	t.fns[PPC_INS_EVSTDD] = nullptr;
+	t.fns[PPC_INS_EVSTDDX] = nullptr;
+	t.fns[PPC_INS_EVSTDH] = nullptr;
+	t.fns[PPC_INS_EVSTDHX] = nullptr;
+	t.fns[PPC_INS_EVSTDW] = nullptr;
+	t.fns[PPC_INS_EVSTDWX] = nullptr;
+	t.fns[PPC_INS_EVSTWHE] = nullptr;
+	t.fns[PPC_INS_EVSTWHEX] = nullptr;
+	t.fns[PPC_INS_EVSTWHO] = nullptr;
+	t.fns[PPC_INS_EVSTWHOX] = nullptr;
+	t.fns[PPC_INS_EVSTWWE] = nullptr;
+	t.fns[PPC_INS_EVSTWWEX] = nullptr;
+	t.fns[PPC_INS_EVSTWWO] = nullptr;
+	t.fns[PPC_INS_EVSTWWOX] = nullptr;
+	t.fns[PPC_INS_EVSUBFSMIAAW] = nullptr;
+	t.fns[PPC_INS_EVSUBFSSIAAW] = nullptr;
+	t.fns[PPC_INS_EVSUBFUMIAAW] = nullptr;
+	t.fns[PPC_INS_EVSUBFUSIAAW] = nullptr;
+	t.fns[PPC_INS_EVSUBFW] = nullptr;
+	t.fns[PPC_INS_EVSUBIFW] = nullptr;
+	t.fns[PPC_INS_EVXOR] = nullptr;
+	t.fns[PPC_INS_EXTSB] = &Capstone2LlvmIrTranslatorPowerpc::translateExtendSign;
+	t.fns[PPC_INS_EXTSH] = &Capstone2LlvmIrTranslatorPowerpc::translateExtendSign;
+	t.fns[PPC_INS_EXTSW] = &Capstone2LlvmIrTranslatorPowerpc::translateExtendSign;
+	t.fns[PPC_INS_EIEIO] = nullptr;
+	t.fns[PPC_INS_FABS] = nullptr;
+	t.fns[PPC_INS_FADD] = nullptr;
+	t.fns[PPC_INS_FADDS] = nullptr;
+	t.fns[PPC_INS_FCFID] = nullptr;
+	t.fns[PPC_INS_FCFIDS] = nullptr;
+	t.fns[PPC_INS_FCFIDU] = nullptr;
+	t.fns[PPC_INS_FCFIDUS] = nullptr;
+	t.fns[PPC_INS_FCMPU] = nullptr;
+	t.fns[PPC_INS_FCPSGN] = nullptr;
+	t.fns[PPC_INS_FCTID] = nullptr;
+	t.fns[PPC_INS_FCTIDUZ] = nullptr;
+	t.fns[PPC_INS_FCTIDZ] = nullptr;
+	t.fns[PPC_INS_FCTIW] = nullptr;
+	t.fns[PPC_INS_FCTIWUZ] = nullptr;
+	t.fns[PPC_INS_FCTIWZ] = nullptr;
+	t.fns[PPC_INS_FDIV] = nullptr;
+	t.fns[PPC_INS_FDIVS] = nullptr;
+	t.fns[PPC_INS_FMADD] = nullptr;
+	t.fns[PPC_INS_FMADDS] = nullptr;
+	t.fns[PPC_INS_FMR] = nullptr;
+	t.fns[PPC_INS_FMSUB] = nullptr;
+	t.fns[PPC_INS_FMSUBS] = nullptr;
+	t.fns[PPC_INS_FMUL] = nullptr;
+	t.fns[PPC_INS_FMULS] = nullptr;
+	t.fns[PPC_INS_FNABS] = nullptr;
+	t.fns[PPC_INS_FNEG] = nullptr;
+	t.fns[PPC_INS_FNMADD] = nullptr;
+	t.fns[PPC_INS_FNMADDS] = nullptr;
+	t.fns[PPC_INS_FNMSUB] = nullptr;
+	t.fns[PPC_INS_FNMSUBS] = nullptr;
+	t.fns[PPC_INS_FRE] = nullptr;
+	t.fns[PPC_INS_FRES] = nullptr;
+	t.fns[PPC_INS_FRIM] = nullptr;
+	t.fns[PPC_INS_FRIN] = nullptr;
+	t.fns[PPC_INS_FRIP] = nullptr;
+	t.fns[PPC_INS_FRIZ] = nullptr;
+	t.fns[PPC_INS_FRSP] = nullptr;
+	t.fns[PPC_INS_FRSQRTE] = nullptr;
+	t.fns[PPC_INS_FRSQRTES] = nullptr;
+	t.fns[PPC_INS_FSEL] = nullptr;
+	t.fns[PPC_INS_FSQRT] = nullptr;
+	t.fns[PPC_INS_FSQRTS] = nullptr;
+	t.fns[PPC_INS_FSUB] = nullptr;
+	t.fns[PPC_INS_FSUBS] = nullptr;
+	t.fns[PPC_INS_ICBI] = nullptr;
+	t.fns[PPC_INS_ICBT] = nullptr;
+	t.fns[PPC_INS_ICCCI] = nullptr;
+	t.fns[PPC_INS_ISEL] = nullptr;
+	t.fns[PPC_INS_ISYNC] = nullptr;
 
-		{PPC_INS_LXSDX, nullptr},
-		{PPC_INS_LXVD2X, nullptr},
-		{PPC_INS_LXVDSX, nullptr},
-		{PPC_INS_LXVW4X, nullptr},
-		{PPC_INS_MBAR, nullptr},
-		{PPC_INS_MCRF, &Capstone2LlvmIrTranslatorPowerpc::translateMcrf},
-		{PPC_INS_MCRFS, nullptr},
-		{PPC_INS_MFCR, &Capstone2LlvmIrTranslatorPowerpc::translateMfcr},
-		{PPC_INS_MFCTR, &Capstone2LlvmIrTranslatorPowerpc::translateMfctr},
-		{PPC_INS_MFDCR, nullptr},
-		{PPC_INS_MFFS, nullptr},
-		{PPC_INS_MFLR, &Capstone2LlvmIrTranslatorPowerpc::translateMflr},
-		{PPC_INS_MFMSR, nullptr},
-		{PPC_INS_MFOCRF, nullptr},
-		{PPC_INS_MFSPR, &Capstone2LlvmIrTranslatorPowerpc::translateMfspr},
-		{PPC_INS_MFSR, nullptr},
-		{PPC_INS_MFSRIN, nullptr},
-		{PPC_INS_MFTB, nullptr},
-		{PPC_INS_MFVSCR, nullptr},
-		{PPC_INS_MSYNC, nullptr},
-		{PPC_INS_MTCRF, &Capstone2LlvmIrTranslatorPowerpc::translateMtcrf},
-		{PPC_INS_MTCTR, &Capstone2LlvmIrTranslatorPowerpc::translateMtctr},
-		{PPC_INS_MTDCR, nullptr},
-		{PPC_INS_MTFSB0, nullptr},
-		{PPC_INS_MTFSB1, nullptr},
-		{PPC_INS_MTFSF, nullptr},
-		{PPC_INS_MTFSFI, nullptr},
-		{PPC_INS_MTLR, &Capstone2LlvmIrTranslatorPowerpc::translateMtlr},
-		{PPC_INS_MTMSR, nullptr},
-		{PPC_INS_MTMSRD, nullptr},
-		{PPC_INS_MTOCRF, nullptr},
-		{PPC_INS_MTSPR, &Capstone2LlvmIrTranslatorPowerpc::translateMtspr},
-		{PPC_INS_MTSR, nullptr},
-		{PPC_INS_MTSRIN, nullptr},
-		{PPC_INS_MTVSCR, nullptr},
-		{PPC_INS_MULHD, nullptr},
-		{PPC_INS_MULHDU, nullptr},
-		{PPC_INS_MULHW, &Capstone2LlvmIrTranslatorPowerpc::translateMulhw},
-		{PPC_INS_MULHWU, &Capstone2LlvmIrTranslatorPowerpc::translateMulhw},
-		{PPC_INS_MULLD, nullptr},
-		{PPC_INS_MULLI, &Capstone2LlvmIrTranslatorPowerpc::translateMullw},
-		{PPC_INS_MULLW, &Capstone2LlvmIrTranslatorPowerpc::translateMullw},
-		{PPC_INS_NAND, &Capstone2LlvmIrTranslatorPowerpc::translateNand},
-		{PPC_INS_NEG, &Capstone2LlvmIrTranslatorPowerpc::translateNeg},
-		{PPC_INS_NOP, &Capstone2LlvmIrTranslatorPowerpc::translateNop},
-		{PPC_INS_ORI, &Capstone2LlvmIrTranslatorPowerpc::translateOr},
-		{PPC_INS_NOR, &Capstone2LlvmIrTranslatorPowerpc::translateNor},
-		{PPC_INS_OR, &Capstone2LlvmIrTranslatorPowerpc::translateOr},
-		{PPC_INS_ORC, &Capstone2LlvmIrTranslatorPowerpc::translateOrc},
-		{PPC_INS_ORIS, &Capstone2LlvmIrTranslatorPowerpc::translateOris},
-		{PPC_INS_POPCNTD, nullptr},
-		{PPC_INS_POPCNTW, nullptr},
-		{PPC_INS_QVALIGNI, nullptr},
-		{PPC_INS_QVESPLATI, nullptr},
-		{PPC_INS_QVFABS, nullptr},
-		{PPC_INS_QVFADD, nullptr},
-		{PPC_INS_QVFADDS, nullptr},
-		{PPC_INS_QVFCFID, nullptr},
-		{PPC_INS_QVFCFIDS, nullptr},
-		{PPC_INS_QVFCFIDU, nullptr},
-		{PPC_INS_QVFCFIDUS, nullptr},
-		{PPC_INS_QVFCMPEQ, nullptr},
-		{PPC_INS_QVFCMPGT, nullptr},
-		{PPC_INS_QVFCMPLT, nullptr},
-		{PPC_INS_QVFCPSGN, nullptr},
-		{PPC_INS_QVFCTID, nullptr},
-		{PPC_INS_QVFCTIDU, nullptr},
-		{PPC_INS_QVFCTIDUZ, nullptr},
-		{PPC_INS_QVFCTIDZ, nullptr},
-		{PPC_INS_QVFCTIW, nullptr},
-		{PPC_INS_QVFCTIWU, nullptr},
-		{PPC_INS_QVFCTIWUZ, nullptr},
-		{PPC_INS_QVFCTIWZ, nullptr},
-		{PPC_INS_QVFLOGICAL, nullptr},
-		{PPC_INS_QVFMADD, nullptr},
-		{PPC_INS_QVFMADDS, nullptr},
-		{PPC_INS_QVFMR, nullptr},
-		{PPC_INS_QVFMSUB, nullptr},
-		{PPC_INS_QVFMSUBS, nullptr},
-		{PPC_INS_QVFMUL, nullptr},
-		{PPC_INS_QVFMULS, nullptr},
-		{PPC_INS_QVFNABS, nullptr},
-		{PPC_INS_QVFNEG, nullptr},
-		{PPC_INS_QVFNMADD, nullptr},
-		{PPC_INS_QVFNMADDS, nullptr},
-		{PPC_INS_QVFNMSUB, nullptr},
-		{PPC_INS_QVFNMSUBS, nullptr},
-		{PPC_INS_QVFPERM, nullptr},
-		{PPC_INS_QVFRE, nullptr},
-		{PPC_INS_QVFRES, nullptr},
-		{PPC_INS_QVFRIM, nullptr},
-		{PPC_INS_QVFRIN, nullptr},
-		{PPC_INS_QVFRIP, nullptr},
-		{PPC_INS_QVFRIZ, nullptr},
-		{PPC_INS_QVFRSP, nullptr},
-		{PPC_INS_QVFRSQRTE, nullptr},
-		{PPC_INS_QVFRSQRTES, nullptr},
-		{PPC_INS_QVFSEL, nullptr},
-		{PPC_INS_QVFSUB, nullptr},
-		{PPC_INS_QVFSUBS, nullptr},
-		{PPC_INS_QVFTSTNAN, nullptr},
-		{PPC_INS_QVFXMADD, nullptr},
-		{PPC_INS_QVFXMADDS, nullptr},
-		{PPC_INS_QVFXMUL, nullptr},
-		{PPC_INS_QVFXMULS, nullptr},
-		{PPC_INS_QVFXXCPNMADD, nullptr},
-		{PPC_INS_QVFXXCPNMADDS, nullptr},
-		{PPC_INS_QVFXXMADD, nullptr},
-		{PPC_INS_QVFXXMADDS, nullptr},
-		{PPC_INS_QVFXXNPMADD, nullptr},
-		{PPC_INS_QVFXXNPMADDS, nullptr},
-		{PPC_INS_QVGPCI, nullptr},
-		{PPC_INS_QVLFCDUX, nullptr},
-		{PPC_INS_QVLFCDUXA, nullptr},
-		{PPC_INS_QVLFCDX, nullptr},
-		{PPC_INS_QVLFCDXA, nullptr},
-		{PPC_INS_QVLFCSUX, nullptr},
-		{PPC_INS_QVLFCSUXA, nullptr},
-		{PPC_INS_QVLFCSX, nullptr},
-		{PPC_INS_QVLFCSXA, nullptr},
-		{PPC_INS_QVLFDUX, nullptr},
-		{PPC_INS_QVLFDUXA, nullptr},
-		{PPC_INS_QVLFDX, nullptr},
-		{PPC_INS_QVLFDXA, nullptr},
-		{PPC_INS_QVLFIWAX, nullptr},
-		{PPC_INS_QVLFIWAXA, nullptr},
-		{PPC_INS_QVLFIWZX, nullptr},
-		{PPC_INS_QVLFIWZXA, nullptr},
-		{PPC_INS_QVLFSUX, nullptr},
-		{PPC_INS_QVLFSUXA, nullptr},
-		{PPC_INS_QVLFSX, nullptr},
-		{PPC_INS_QVLFSXA, nullptr},
-		{PPC_INS_QVLPCLDX, nullptr},
-		{PPC_INS_QVLPCLSX, nullptr},
-		{PPC_INS_QVLPCRDX, nullptr},
-		{PPC_INS_QVLPCRSX, nullptr},
-		{PPC_INS_QVSTFCDUX, nullptr},
-		{PPC_INS_QVSTFCDUXA, nullptr},
-		{PPC_INS_QVSTFCDUXI, nullptr},
-		{PPC_INS_QVSTFCDUXIA, nullptr},
-		{PPC_INS_QVSTFCDX, nullptr},
-		{PPC_INS_QVSTFCDXA, nullptr},
-		{PPC_INS_QVSTFCDXI, nullptr},
-		{PPC_INS_QVSTFCDXIA, nullptr},
-		{PPC_INS_QVSTFCSUX, nullptr},
-		{PPC_INS_QVSTFCSUXA, nullptr},
-		{PPC_INS_QVSTFCSUXI, nullptr},
-		{PPC_INS_QVSTFCSUXIA, nullptr},
-		{PPC_INS_QVSTFCSX, nullptr},
-		{PPC_INS_QVSTFCSXA, nullptr},
-		{PPC_INS_QVSTFCSXI, nullptr},
-		{PPC_INS_QVSTFCSXIA, nullptr},
-		{PPC_INS_QVSTFDUX, nullptr},
-		{PPC_INS_QVSTFDUXA, nullptr},
-		{PPC_INS_QVSTFDUXI, nullptr},
-		{PPC_INS_QVSTFDUXIA, nullptr},
-		{PPC_INS_QVSTFDX, nullptr},
-		{PPC_INS_QVSTFDXA, nullptr},
-		{PPC_INS_QVSTFDXI, nullptr},
-		{PPC_INS_QVSTFDXIA, nullptr},
-		{PPC_INS_QVSTFIWX, nullptr},
-		{PPC_INS_QVSTFIWXA, nullptr},
-		{PPC_INS_QVSTFSUX, nullptr},
-		{PPC_INS_QVSTFSUXA, nullptr},
-		{PPC_INS_QVSTFSUXI, nullptr},
-		{PPC_INS_QVSTFSUXIA, nullptr},
-		{PPC_INS_QVSTFSX, nullptr},
-		{PPC_INS_QVSTFSXA, nullptr},
-		{PPC_INS_QVSTFSXI, nullptr},
-		{PPC_INS_QVSTFSXIA, nullptr},
-		{PPC_INS_RFCI, nullptr},
-		{PPC_INS_RFDI, nullptr},
-		{PPC_INS_RFI, nullptr},
-		{PPC_INS_RFID, nullptr},
-		{PPC_INS_RFMCI, nullptr},
-		{PPC_INS_RLDCL, nullptr},
-		{PPC_INS_RLDCR, nullptr},
-		{PPC_INS_RLDIC, nullptr},
-		{PPC_INS_RLDICL, nullptr},
-		{PPC_INS_RLDICR, nullptr},
-		{PPC_INS_RLDIMI, nullptr},
-		{PPC_INS_RLWIMI, &Capstone2LlvmIrTranslatorPowerpc::translateRotateComplex5op},
-		{PPC_INS_RLWINM, &Capstone2LlvmIrTranslatorPowerpc::translateRotateComplex5op},
-		{PPC_INS_RLWNM, &Capstone2LlvmIrTranslatorPowerpc::translateRotateComplex5op},
-		{PPC_INS_SC, nullptr},
-		{PPC_INS_SLBIA, nullptr},
-		{PPC_INS_SLBIE, nullptr},
-		{PPC_INS_SLBMFEE, nullptr},
-		{PPC_INS_SLBMTE, nullptr},
-		{PPC_INS_SLD, nullptr},
-		{PPC_INS_SLW, &Capstone2LlvmIrTranslatorPowerpc::translateShiftLeft},
-		{PPC_INS_SRAD, nullptr},
-		{PPC_INS_SRADI, nullptr},
-		{PPC_INS_SRAW, &Capstone2LlvmIrTranslatorPowerpc::translateSraw},
-		{PPC_INS_SRAWI, &Capstone2LlvmIrTranslatorPowerpc::translateSraw},
-		{PPC_INS_SRD, nullptr},
-		{PPC_INS_SRW, &Capstone2LlvmIrTranslatorPowerpc::translateShiftRight},
-		{PPC_INS_STB, &Capstone2LlvmIrTranslatorPowerpc::translateStore},
-		{PPC_INS_STBCIX, nullptr},
-		{PPC_INS_STBU, &Capstone2LlvmIrTranslatorPowerpc::translateStore},
-		{PPC_INS_STBUX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed},
-		{PPC_INS_STBX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed},
-		{PPC_INS_STD, nullptr},
-		{PPC_INS_STDBRX, nullptr},
-		{PPC_INS_STDCIX, nullptr},
-		{PPC_INS_STDCX, nullptr},
-		{PPC_INS_STDU, nullptr},
-		{PPC_INS_STDUX, nullptr},
-		{PPC_INS_STDX, nullptr},
-		{PPC_INS_STFD, nullptr},
-		{PPC_INS_STFDU, nullptr},
-		{PPC_INS_STFDUX, nullptr},
-		{PPC_INS_STFDX, nullptr},
-		{PPC_INS_STFIWX, nullptr},
-		{PPC_INS_STFS, nullptr},
-		{PPC_INS_STFSU, nullptr},
-		{PPC_INS_STFSUX, nullptr},
-		{PPC_INS_STFSX, nullptr},
-		{PPC_INS_STH, &Capstone2LlvmIrTranslatorPowerpc::translateStore},
-		{PPC_INS_STHBRX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreReverseIndexed},
-		{PPC_INS_STHCIX, nullptr},
-		{PPC_INS_STHU, &Capstone2LlvmIrTranslatorPowerpc::translateStore},
-		{PPC_INS_STHUX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed},
-		{PPC_INS_STHX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed},
-		{PPC_INS_STMW, nullptr},
-		{PPC_INS_STSWI, nullptr},
-		{PPC_INS_STVEBX, nullptr},
-		{PPC_INS_STVEHX, nullptr},
-		{PPC_INS_STVEWX, nullptr},
-		{PPC_INS_STVX, nullptr},
-		{PPC_INS_STVXL, nullptr},
-		{PPC_INS_STW, &Capstone2LlvmIrTranslatorPowerpc::translateStore},
-		{PPC_INS_STWBRX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreReverseIndexed},
-		{PPC_INS_STWCIX, nullptr},
-		{PPC_INS_STWCX, nullptr},
-		{PPC_INS_STWU, &Capstone2LlvmIrTranslatorPowerpc::translateStore},
-		{PPC_INS_STWUX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed},
-		{PPC_INS_STWX, &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed},
-		{PPC_INS_STXSDX, nullptr},
-		{PPC_INS_STXVD2X, nullptr},
-		{PPC_INS_STXVW4X, nullptr},
-		{PPC_INS_SUBF, &Capstone2LlvmIrTranslatorPowerpc::translateSubf},
-		{PPC_INS_SUBFC, &Capstone2LlvmIrTranslatorPowerpc::translateSubfc},
-		{PPC_INS_SUBFE, &Capstone2LlvmIrTranslatorPowerpc::translateSubfe},
-		{PPC_INS_SUBFIC, &Capstone2LlvmIrTranslatorPowerpc::translateSubfc},
-		{PPC_INS_SUBFME, &Capstone2LlvmIrTranslatorPowerpc::translateSubfme},
-		{PPC_INS_SUBFZE, &Capstone2LlvmIrTranslatorPowerpc::translateSubfze},
-		{PPC_INS_SYNC, nullptr},
-		{PPC_INS_TD, nullptr},
-		{PPC_INS_TDI, nullptr},
-		{PPC_INS_TLBIA, nullptr},
-		{PPC_INS_TLBIE, nullptr},
-		{PPC_INS_TLBIEL, nullptr},
-		{PPC_INS_TLBIVAX, nullptr},
-		{PPC_INS_TLBLD, nullptr},
-		{PPC_INS_TLBLI, nullptr},
-		{PPC_INS_TLBRE, nullptr},
-		{PPC_INS_TLBSX, nullptr},
-		{PPC_INS_TLBSYNC, nullptr},
-		{PPC_INS_TLBWE, nullptr},
-		{PPC_INS_TRAP, nullptr},
-		{PPC_INS_TW, nullptr},
-		{PPC_INS_TWI, nullptr},
-		{PPC_INS_VADDCUW, nullptr},
-		{PPC_INS_VADDFP, nullptr},
-		{PPC_INS_VADDSBS, nullptr},
-		{PPC_INS_VADDSHS, nullptr},
-		{PPC_INS_VADDSWS, nullptr},
-		{PPC_INS_VADDUBM, nullptr},
-		{PPC_INS_VADDUBS, nullptr},
-		{PPC_INS_VADDUDM, nullptr},
-		{PPC_INS_VADDUHM, nullptr},
-		{PPC_INS_VADDUHS, nullptr},
-		{PPC_INS_VADDUWM, nullptr},
-		{PPC_INS_VADDUWS, nullptr},
-		{PPC_INS_VAND, nullptr},
-		{PPC_INS_VANDC, nullptr},
-		{PPC_INS_VAVGSB, nullptr},
-		{PPC_INS_VAVGSH, nullptr},
-		{PPC_INS_VAVGSW, nullptr},
-		{PPC_INS_VAVGUB, nullptr},
-		{PPC_INS_VAVGUH, nullptr},
-		{PPC_INS_VAVGUW, nullptr},
-		{PPC_INS_VCFSX, nullptr},
-		{PPC_INS_VCFUX, nullptr},
-		{PPC_INS_VCLZB, nullptr},
-		{PPC_INS_VCLZD, nullptr},
-		{PPC_INS_VCLZH, nullptr},
-		{PPC_INS_VCLZW, nullptr},
-		{PPC_INS_VCMPBFP, nullptr},
-		{PPC_INS_VCMPEQFP, nullptr},
-		{PPC_INS_VCMPEQUB, nullptr},
-		{PPC_INS_VCMPEQUD, nullptr},
-		{PPC_INS_VCMPEQUH, nullptr},
-		{PPC_INS_VCMPEQUW, nullptr},
-		{PPC_INS_VCMPGEFP, nullptr},
-		{PPC_INS_VCMPGTFP, nullptr},
-		{PPC_INS_VCMPGTSB, nullptr},
-		{PPC_INS_VCMPGTSD, nullptr},
-		{PPC_INS_VCMPGTSH, nullptr},
-		{PPC_INS_VCMPGTSW, nullptr},
-		{PPC_INS_VCMPGTUB, nullptr},
-		{PPC_INS_VCMPGTUD, nullptr},
-		{PPC_INS_VCMPGTUH, nullptr},
-		{PPC_INS_VCMPGTUW, nullptr},
-		{PPC_INS_VCTSXS, nullptr},
-		{PPC_INS_VCTUXS, nullptr},
-		{PPC_INS_VEQV, nullptr},
-		{PPC_INS_VEXPTEFP, nullptr},
-		{PPC_INS_VLOGEFP, nullptr},
-		{PPC_INS_VMADDFP, nullptr},
-		{PPC_INS_VMAXFP, nullptr},
-		{PPC_INS_VMAXSB, nullptr},
-		{PPC_INS_VMAXSD, nullptr},
-		{PPC_INS_VMAXSH, nullptr},
-		{PPC_INS_VMAXSW, nullptr},
-		{PPC_INS_VMAXUB, nullptr},
-		{PPC_INS_VMAXUD, nullptr},
-		{PPC_INS_VMAXUH, nullptr},
-		{PPC_INS_VMAXUW, nullptr},
-		{PPC_INS_VMHADDSHS, nullptr},
-		{PPC_INS_VMHRADDSHS, nullptr},
-		{PPC_INS_VMINUD, nullptr},
-		{PPC_INS_VMINFP, nullptr},
-		{PPC_INS_VMINSB, nullptr},
-		{PPC_INS_VMINSD, nullptr},
-		{PPC_INS_VMINSH, nullptr},
-		{PPC_INS_VMINSW, nullptr},
-		{PPC_INS_VMINUB, nullptr},
-		{PPC_INS_VMINUH, nullptr},
-		{PPC_INS_VMINUW, nullptr},
-		{PPC_INS_VMLADDUHM, nullptr},
-		{PPC_INS_VMRGHB, nullptr},
-		{PPC_INS_VMRGHH, nullptr},
-		{PPC_INS_VMRGHW, nullptr},
-		{PPC_INS_VMRGLB, nullptr},
-		{PPC_INS_VMRGLH, nullptr},
-		{PPC_INS_VMRGLW, nullptr},
-		{PPC_INS_VMSUMMBM, nullptr},
-		{PPC_INS_VMSUMSHM, nullptr},
-		{PPC_INS_VMSUMSHS, nullptr},
-		{PPC_INS_VMSUMUBM, nullptr},
-		{PPC_INS_VMSUMUHM, nullptr},
-		{PPC_INS_VMSUMUHS, nullptr},
-		{PPC_INS_VMULESB, nullptr},
-		{PPC_INS_VMULESH, nullptr},
-		{PPC_INS_VMULESW, nullptr},
-		{PPC_INS_VMULEUB, nullptr},
-		{PPC_INS_VMULEUH, nullptr},
-		{PPC_INS_VMULEUW, nullptr},
-		{PPC_INS_VMULOSB, nullptr},
-		{PPC_INS_VMULOSH, nullptr},
-		{PPC_INS_VMULOSW, nullptr},
-		{PPC_INS_VMULOUB, nullptr},
-		{PPC_INS_VMULOUH, nullptr},
-		{PPC_INS_VMULOUW, nullptr},
-		{PPC_INS_VMULUWM, nullptr},
-		{PPC_INS_VNAND, nullptr},
-		{PPC_INS_VNMSUBFP, nullptr},
-		{PPC_INS_VNOR, nullptr},
-		{PPC_INS_VOR, nullptr},
-		{PPC_INS_VORC, nullptr},
-		{PPC_INS_VPERM, nullptr},
-		{PPC_INS_VPKPX, nullptr},
-		{PPC_INS_VPKSHSS, nullptr},
-		{PPC_INS_VPKSHUS, nullptr},
-		{PPC_INS_VPKSWSS, nullptr},
-		{PPC_INS_VPKSWUS, nullptr},
-		{PPC_INS_VPKUHUM, nullptr},
-		{PPC_INS_VPKUHUS, nullptr},
-		{PPC_INS_VPKUWUM, nullptr},
-		{PPC_INS_VPKUWUS, nullptr},
-		{PPC_INS_VPOPCNTB, nullptr},
-		{PPC_INS_VPOPCNTD, nullptr},
-		{PPC_INS_VPOPCNTH, nullptr},
-		{PPC_INS_VPOPCNTW, nullptr},
-		{PPC_INS_VREFP, nullptr},
-		{PPC_INS_VRFIM, nullptr},
-		{PPC_INS_VRFIN, nullptr},
-		{PPC_INS_VRFIP, nullptr},
-		{PPC_INS_VRFIZ, nullptr},
-		{PPC_INS_VRLB, nullptr},
-		{PPC_INS_VRLD, nullptr},
-		{PPC_INS_VRLH, nullptr},
-		{PPC_INS_VRLW, nullptr},
-		{PPC_INS_VRSQRTEFP, nullptr},
-		{PPC_INS_VSEL, nullptr},
-		{PPC_INS_VSL, nullptr},
-		{PPC_INS_VSLB, nullptr},
-		{PPC_INS_VSLD, nullptr},
-		{PPC_INS_VSLDOI, nullptr},
-		{PPC_INS_VSLH, nullptr},
-		{PPC_INS_VSLO, nullptr},
-		{PPC_INS_VSLW, nullptr},
-		{PPC_INS_VSPLTB, nullptr},
-		{PPC_INS_VSPLTH, nullptr},
-		{PPC_INS_VSPLTISB, nullptr},
-		{PPC_INS_VSPLTISH, nullptr},
-		{PPC_INS_VSPLTISW, nullptr},
-		{PPC_INS_VSPLTW, nullptr},
-		{PPC_INS_VSR, nullptr},
-		{PPC_INS_VSRAB, nullptr},
-		{PPC_INS_VSRAD, nullptr},
-		{PPC_INS_VSRAH, nullptr},
-		{PPC_INS_VSRAW, nullptr},
-		{PPC_INS_VSRB, nullptr},
-		{PPC_INS_VSRD, nullptr},
-		{PPC_INS_VSRH, nullptr},
-		{PPC_INS_VSRO, nullptr},
-		{PPC_INS_VSRW, nullptr},
-		{PPC_INS_VSUBCUW, nullptr},
-		{PPC_INS_VSUBFP, nullptr},
-		{PPC_INS_VSUBSBS, nullptr},
-		{PPC_INS_VSUBSHS, nullptr},
-		{PPC_INS_VSUBSWS, nullptr},
-		{PPC_INS_VSUBUBM, nullptr},
-		{PPC_INS_VSUBUBS, nullptr},
-		{PPC_INS_VSUBUDM, nullptr},
-		{PPC_INS_VSUBUHM, nullptr},
-		{PPC_INS_VSUBUHS, nullptr},
-		{PPC_INS_VSUBUWM, nullptr},
-		{PPC_INS_VSUBUWS, nullptr},
-		{PPC_INS_VSUM2SWS, nullptr},
-		{PPC_INS_VSUM4SBS, nullptr},
-		{PPC_INS_VSUM4SHS, nullptr},
-		{PPC_INS_VSUM4UBS, nullptr},
-		{PPC_INS_VSUMSWS, nullptr},
-		{PPC_INS_VUPKHPX, nullptr},
-		{PPC_INS_VUPKHSB, nullptr},
-		{PPC_INS_VUPKHSH, nullptr},
-		{PPC_INS_VUPKLPX, nullptr},
-		{PPC_INS_VUPKLSB, nullptr},
-		{PPC_INS_VUPKLSH, nullptr},
-		{PPC_INS_VXOR, nullptr},
-		{PPC_INS_WAIT, nullptr},
-		{PPC_INS_WRTEE, nullptr},
-		{PPC_INS_WRTEEI, nullptr},
-		{PPC_INS_XOR, &Capstone2LlvmIrTranslatorPowerpc::translateXor},
-		{PPC_INS_XORI, &Capstone2LlvmIrTranslatorPowerpc::translateXor},
-		{PPC_INS_XORIS, &Capstone2LlvmIrTranslatorPowerpc::translateXoris},
-		{PPC_INS_XSABSDP, nullptr},
-		{PPC_INS_XSADDDP, nullptr},
-		{PPC_INS_XSCMPODP, nullptr},
-		{PPC_INS_XSCMPUDP, nullptr},
-		{PPC_INS_XSCPSGNDP, nullptr},
-		{PPC_INS_XSCVDPSP, nullptr},
-		{PPC_INS_XSCVDPSXDS, nullptr},
-		{PPC_INS_XSCVDPSXWS, nullptr},
-		{PPC_INS_XSCVDPUXDS, nullptr},
-		{PPC_INS_XSCVDPUXWS, nullptr},
-		{PPC_INS_XSCVSPDP, nullptr},
-		{PPC_INS_XSCVSXDDP, nullptr},
-		{PPC_INS_XSCVUXDDP, nullptr},
-		{PPC_INS_XSDIVDP, nullptr},
-		{PPC_INS_XSMADDADP, nullptr},
-		{PPC_INS_XSMADDMDP, nullptr},
-		{PPC_INS_XSMAXDP, nullptr},
-		{PPC_INS_XSMINDP, nullptr},
-		{PPC_INS_XSMSUBADP, nullptr},
-		{PPC_INS_XSMSUBMDP, nullptr},
-		{PPC_INS_XSMULDP, nullptr},
-		{PPC_INS_XSNABSDP, nullptr},
-		{PPC_INS_XSNEGDP, nullptr},
-		{PPC_INS_XSNMADDADP, nullptr},
-		{PPC_INS_XSNMADDMDP, nullptr},
-		{PPC_INS_XSNMSUBADP, nullptr},
-		{PPC_INS_XSNMSUBMDP, nullptr},
-		{PPC_INS_XSRDPI, nullptr},
-		{PPC_INS_XSRDPIC, nullptr},
-		{PPC_INS_XSRDPIM, nullptr},
-		{PPC_INS_XSRDPIP, nullptr},
-		{PPC_INS_XSRDPIZ, nullptr},
-		{PPC_INS_XSREDP, nullptr},
-		{PPC_INS_XSRSQRTEDP, nullptr},
-		{PPC_INS_XSSQRTDP, nullptr},
-		{PPC_INS_XSSUBDP, nullptr},
-		{PPC_INS_XSTDIVDP, nullptr},
-		{PPC_INS_XSTSQRTDP, nullptr},
-		{PPC_INS_XVABSDP, nullptr},
-		{PPC_INS_XVABSSP, nullptr},
-		{PPC_INS_XVADDDP, nullptr},
-		{PPC_INS_XVADDSP, nullptr},
-		{PPC_INS_XVCMPEQDP, nullptr},
-		{PPC_INS_XVCMPEQSP, nullptr},
-		{PPC_INS_XVCMPGEDP, nullptr},
-		{PPC_INS_XVCMPGESP, nullptr},
-		{PPC_INS_XVCMPGTDP, nullptr},
-		{PPC_INS_XVCMPGTSP, nullptr},
-		{PPC_INS_XVCPSGNDP, nullptr},
-		{PPC_INS_XVCPSGNSP, nullptr},
-		{PPC_INS_XVCVDPSP, nullptr},
-		{PPC_INS_XVCVDPSXDS, nullptr},
-		{PPC_INS_XVCVDPSXWS, nullptr},
-		{PPC_INS_XVCVDPUXDS, nullptr},
-		{PPC_INS_XVCVDPUXWS, nullptr},
-		{PPC_INS_XVCVSPDP, nullptr},
-		{PPC_INS_XVCVSPSXDS, nullptr},
-		{PPC_INS_XVCVSPSXWS, nullptr},
-		{PPC_INS_XVCVSPUXDS, nullptr},
-		{PPC_INS_XVCVSPUXWS, nullptr},
-		{PPC_INS_XVCVSXDDP, nullptr},
-		{PPC_INS_XVCVSXDSP, nullptr},
-		{PPC_INS_XVCVSXWDP, nullptr},
-		{PPC_INS_XVCVSXWSP, nullptr},
-		{PPC_INS_XVCVUXDDP, nullptr},
-		{PPC_INS_XVCVUXDSP, nullptr},
-		{PPC_INS_XVCVUXWDP, nullptr},
-		{PPC_INS_XVCVUXWSP, nullptr},
-		{PPC_INS_XVDIVDP, nullptr},
-		{PPC_INS_XVDIVSP, nullptr},
-		{PPC_INS_XVMADDADP, nullptr},
-		{PPC_INS_XVMADDASP, nullptr},
-		{PPC_INS_XVMADDMDP, nullptr},
-		{PPC_INS_XVMADDMSP, nullptr},
-		{PPC_INS_XVMAXDP, nullptr},
-		{PPC_INS_XVMAXSP, nullptr},
-		{PPC_INS_XVMINDP, nullptr},
-		{PPC_INS_XVMINSP, nullptr},
-		{PPC_INS_XVMSUBADP, nullptr},
-		{PPC_INS_XVMSUBASP, nullptr},
-		{PPC_INS_XVMSUBMDP, nullptr},
-		{PPC_INS_XVMSUBMSP, nullptr},
-		{PPC_INS_XVMULDP, nullptr},
-		{PPC_INS_XVMULSP, nullptr},
-		{PPC_INS_XVNABSDP, nullptr},
-		{PPC_INS_XVNABSSP, nullptr},
-		{PPC_INS_XVNEGDP, nullptr},
-		{PPC_INS_XVNEGSP, nullptr},
-		{PPC_INS_XVNMADDADP, nullptr},
-		{PPC_INS_XVNMADDASP, nullptr},
-		{PPC_INS_XVNMADDMDP, nullptr},
-		{PPC_INS_XVNMADDMSP, nullptr},
-		{PPC_INS_XVNMSUBADP, nullptr},
-		{PPC_INS_XVNMSUBASP, nullptr},
-		{PPC_INS_XVNMSUBMDP, nullptr},
-		{PPC_INS_XVNMSUBMSP, nullptr},
-		{PPC_INS_XVRDPI, nullptr},
-		{PPC_INS_XVRDPIC, nullptr},
-		{PPC_INS_XVRDPIM, nullptr},
-		{PPC_INS_XVRDPIP, nullptr},
-		{PPC_INS_XVRDPIZ, nullptr},
-		{PPC_INS_XVREDP, nullptr},
-		{PPC_INS_XVRESP, nullptr},
-		{PPC_INS_XVRSPI, nullptr},
-		{PPC_INS_XVRSPIC, nullptr},
-		{PPC_INS_XVRSPIM, nullptr},
-		{PPC_INS_XVRSPIP, nullptr},
-		{PPC_INS_XVRSPIZ, nullptr},
-		{PPC_INS_XVRSQRTEDP, nullptr},
-		{PPC_INS_XVRSQRTESP, nullptr},
-		{PPC_INS_XVSQRTDP, nullptr},
-		{PPC_INS_XVSQRTSP, nullptr},
-		{PPC_INS_XVSUBDP, nullptr},
-		{PPC_INS_XVSUBSP, nullptr},
-		{PPC_INS_XVTDIVDP, nullptr},
-		{PPC_INS_XVTDIVSP, nullptr},
-		{PPC_INS_XVTSQRTDP, nullptr},
-		{PPC_INS_XVTSQRTSP, nullptr},
-		{PPC_INS_XXLAND, nullptr},
-		{PPC_INS_XXLANDC, nullptr},
-		{PPC_INS_XXLEQV, nullptr},
-		{PPC_INS_XXLNAND, nullptr},
-		{PPC_INS_XXLNOR, nullptr},
-		{PPC_INS_XXLOR, nullptr},
-		{PPC_INS_XXLORC, nullptr},
-		{PPC_INS_XXLXOR, nullptr},
-		{PPC_INS_XXMRGHW, nullptr},
-		{PPC_INS_XXMRGLW, nullptr},
-		{PPC_INS_XXPERMDI, nullptr},
-		{PPC_INS_XXSEL, nullptr},
-		{PPC_INS_XXSLDWI, nullptr},
-		{PPC_INS_XXSPLTW, nullptr},
+	t.fns[PPC_INS_LA] = &Capstone2LlvmIrTranslatorPowerpc::translateAdd;
+	t.fns[PPC_INS_LBZ] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LBZCIX] = nullptr;
+	t.fns[PPC_INS_LBZU] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LBZUX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
+	t.fns[PPC_INS_LBZX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
+	t.fns[PPC_INS_LD] = nullptr;
+	t.fns[PPC_INS_LDARX] = nullptr;
+	t.fns[PPC_INS_LDBRX] = nullptr;
+	t.fns[PPC_INS_LDCIX] = nullptr;
+	t.fns[PPC_INS_LDU] = nullptr;
+	t.fns[PPC_INS_LDUX] = nullptr;
+	t.fns[PPC_INS_LDX] = nullptr;
+	t.fns[PPC_INS_LFD] = nullptr;
+	t.fns[PPC_INS_LFDU] = nullptr;
+	t.fns[PPC_INS_LFDUX] = nullptr;
+	t.fns[PPC_INS_LFDX] = nullptr;
+	t.fns[PPC_INS_LFIWAX] = nullptr;
+	t.fns[PPC_INS_LFIWZX] = nullptr;
+	t.fns[PPC_INS_LFS] = nullptr;
+	t.fns[PPC_INS_LFSU] = nullptr;
+	t.fns[PPC_INS_LFSUX] = nullptr;
+	t.fns[PPC_INS_LFSX] = nullptr;
+	t.fns[PPC_INS_LHA] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LHAU] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LHAUX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
+	t.fns[PPC_INS_LHAX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
+	t.fns[PPC_INS_LHBRX] = &Capstone2LlvmIrTranslatorPowerpc::translateLhbrx;
+	t.fns[PPC_INS_LHZ] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LHZCIX] = nullptr;
+	t.fns[PPC_INS_LHZU] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LHZUX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
+	t.fns[PPC_INS_LHZX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
+	t.fns[PPC_INS_LI] = &Capstone2LlvmIrTranslatorPowerpc::translateLi;
+	t.fns[PPC_INS_LIS] = &Capstone2LlvmIrTranslatorPowerpc::translateLis;
+	t.fns[PPC_INS_LMW] = nullptr;
+	t.fns[PPC_INS_LSWI] = nullptr;
+	t.fns[PPC_INS_LVEBX] = nullptr;
+	t.fns[PPC_INS_LVEHX] = nullptr;
+	t.fns[PPC_INS_LVEWX] = nullptr;
+	t.fns[PPC_INS_LVSL] = nullptr;
+	t.fns[PPC_INS_LVSR] = nullptr;
+	t.fns[PPC_INS_LVX] = nullptr;
+	t.fns[PPC_INS_LVXL] = nullptr;
+	t.fns[PPC_INS_LWA] = nullptr;
+	t.fns[PPC_INS_LWARX] = nullptr;
+	t.fns[PPC_INS_LWAUX] = nullptr;
+	t.fns[PPC_INS_LWAX] = nullptr;
+	t.fns[PPC_INS_LWBRX] = &Capstone2LlvmIrTranslatorPowerpc::translateLwbrx;
+	t.fns[PPC_INS_LWZ] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LWZCIX] = nullptr;
+	t.fns[PPC_INS_LWZU] = &Capstone2LlvmIrTranslatorPowerpc::translateLoad;
+	t.fns[PPC_INS_LWZUX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
+	t.fns[PPC_INS_LWZX] = &Capstone2LlvmIrTranslatorPowerpc::translateLoadIndexed;
 
-		// extra & alias instructions
-		{PPC_INS_SLWI, &Capstone2LlvmIrTranslatorPowerpc::translateSlwi},
-		{PPC_INS_SRWI, &Capstone2LlvmIrTranslatorPowerpc::translateSrwi},
-		{PPC_INS_SLDI, nullptr},
+	t.fns[PPC_INS_LXSDX] = nullptr;
+	t.fns[PPC_INS_LXVD2X] = nullptr;
+	t.fns[PPC_INS_LXVDSX] = nullptr;
+	t.fns[PPC_INS_LXVW4X] = nullptr;
+	t.fns[PPC_INS_MBAR] = nullptr;
+	t.fns[PPC_INS_MCRF] = &Capstone2LlvmIrTranslatorPowerpc::translateMcrf;
+	t.fns[PPC_INS_MCRFS] = nullptr;
+	t.fns[PPC_INS_MFCR] = &Capstone2LlvmIrTranslatorPowerpc::translateMfcr;
+	t.fns[PPC_INS_MFCTR] = &Capstone2LlvmIrTranslatorPowerpc::translateMfctr;
+	t.fns[PPC_INS_MFDCR] = nullptr;
+	t.fns[PPC_INS_MFFS] = nullptr;
+	t.fns[PPC_INS_MFLR] = &Capstone2LlvmIrTranslatorPowerpc::translateMflr;
+	t.fns[PPC_INS_MFMSR] = nullptr;
+	t.fns[PPC_INS_MFOCRF] = nullptr;
+	t.fns[PPC_INS_MFSPR] = &Capstone2LlvmIrTranslatorPowerpc::translateMfspr;
+	t.fns[PPC_INS_MFSR] = nullptr;
+	t.fns[PPC_INS_MFSRIN] = nullptr;
+	t.fns[PPC_INS_MFTB] = nullptr;
+	t.fns[PPC_INS_MFVSCR] = nullptr;
+	t.fns[PPC_INS_MSYNC] = nullptr;
+	t.fns[PPC_INS_MTCRF] = &Capstone2LlvmIrTranslatorPowerpc::translateMtcrf;
+	t.fns[PPC_INS_MTCTR] = &Capstone2LlvmIrTranslatorPowerpc::translateMtctr;
+	t.fns[PPC_INS_MTDCR] = nullptr;
+	t.fns[PPC_INS_MTFSB0] = nullptr;
+	t.fns[PPC_INS_MTFSB1] = nullptr;
+	t.fns[PPC_INS_MTFSF] = nullptr;
+	t.fns[PPC_INS_MTFSFI] = nullptr;
+	t.fns[PPC_INS_MTLR] = &Capstone2LlvmIrTranslatorPowerpc::translateMtlr;
+	t.fns[PPC_INS_MTMSR] = nullptr;
+	t.fns[PPC_INS_MTMSRD] = nullptr;
+	t.fns[PPC_INS_MTOCRF] = nullptr;
+	t.fns[PPC_INS_MTSPR] = &Capstone2LlvmIrTranslatorPowerpc::translateMtspr;
+	t.fns[PPC_INS_MTSR] = nullptr;
+	t.fns[PPC_INS_MTSRIN] = nullptr;
+	t.fns[PPC_INS_MTVSCR] = nullptr;
+	t.fns[PPC_INS_MULHD] = nullptr;
+	t.fns[PPC_INS_MULHDU] = nullptr;
+	t.fns[PPC_INS_MULHW] = &Capstone2LlvmIrTranslatorPowerpc::translateMulhw;
+	t.fns[PPC_INS_MULHWU] = &Capstone2LlvmIrTranslatorPowerpc::translateMulhw;
+	t.fns[PPC_INS_MULLD] = nullptr;
+	t.fns[PPC_INS_MULLI] = &Capstone2LlvmIrTranslatorPowerpc::translateMullw;
+	t.fns[PPC_INS_MULLW] = &Capstone2LlvmIrTranslatorPowerpc::translateMullw;
+	t.fns[PPC_INS_NAND] = &Capstone2LlvmIrTranslatorPowerpc::translateNand;
+	t.fns[PPC_INS_NEG] = &Capstone2LlvmIrTranslatorPowerpc::translateNeg;
+	t.fns[PPC_INS_NOP] = &Capstone2LlvmIrTranslatorPowerpc::translateNop;
+	t.fns[PPC_INS_ORI] = &Capstone2LlvmIrTranslatorPowerpc::translateOr;
+	t.fns[PPC_INS_NOR] = &Capstone2LlvmIrTranslatorPowerpc::translateNor;
+	t.fns[PPC_INS_OR] = &Capstone2LlvmIrTranslatorPowerpc::translateOr;
+	t.fns[PPC_INS_ORC] = &Capstone2LlvmIrTranslatorPowerpc::translateOrc;
+	t.fns[PPC_INS_ORIS] = &Capstone2LlvmIrTranslatorPowerpc::translateOris;
+	t.fns[PPC_INS_POPCNTD] = nullptr;
+	t.fns[PPC_INS_POPCNTW] = nullptr;
+	t.fns[PPC_INS_QVALIGNI] = nullptr;
+	t.fns[PPC_INS_QVESPLATI] = nullptr;
+	t.fns[PPC_INS_QVFABS] = nullptr;
+	t.fns[PPC_INS_QVFADD] = nullptr;
+	t.fns[PPC_INS_QVFADDS] = nullptr;
+	t.fns[PPC_INS_QVFCFID] = nullptr;
+	t.fns[PPC_INS_QVFCFIDS] = nullptr;
+	t.fns[PPC_INS_QVFCFIDU] = nullptr;
+	t.fns[PPC_INS_QVFCFIDUS] = nullptr;
+	t.fns[PPC_INS_QVFCMPEQ] = nullptr;
+	t.fns[PPC_INS_QVFCMPGT] = nullptr;
+	t.fns[PPC_INS_QVFCMPLT] = nullptr;
+	t.fns[PPC_INS_QVFCPSGN] = nullptr;
+	t.fns[PPC_INS_QVFCTID] = nullptr;
+	t.fns[PPC_INS_QVFCTIDU] = nullptr;
+	t.fns[PPC_INS_QVFCTIDUZ] = nullptr;
+	t.fns[PPC_INS_QVFCTIDZ] = nullptr;
+	t.fns[PPC_INS_QVFCTIW] = nullptr;
+	t.fns[PPC_INS_QVFCTIWU] = nullptr;
+	t.fns[PPC_INS_QVFCTIWUZ] = nullptr;
+	t.fns[PPC_INS_QVFCTIWZ] = nullptr;
+	t.fns[PPC_INS_QVFLOGICAL] = nullptr;
+	t.fns[PPC_INS_QVFMADD] = nullptr;
+	t.fns[PPC_INS_QVFMADDS] = nullptr;
+	t.fns[PPC_INS_QVFMR] = nullptr;
+	t.fns[PPC_INS_QVFMSUB] = nullptr;
+	t.fns[PPC_INS_QVFMSUBS] = nullptr;
+	t.fns[PPC_INS_QVFMUL] = nullptr;
+	t.fns[PPC_INS_QVFMULS] = nullptr;
+	t.fns[PPC_INS_QVFNABS] = nullptr;
+	t.fns[PPC_INS_QVFNEG] = nullptr;
+	t.fns[PPC_INS_QVFNMADD] = nullptr;
+	t.fns[PPC_INS_QVFNMADDS] = nullptr;
+	t.fns[PPC_INS_QVFNMSUB] = nullptr;
+	t.fns[PPC_INS_QVFNMSUBS] = nullptr;
+	t.fns[PPC_INS_QVFPERM] = nullptr;
+	t.fns[PPC_INS_QVFRE] = nullptr;
+	t.fns[PPC_INS_QVFRES] = nullptr;
+	t.fns[PPC_INS_QVFRIM] = nullptr;
+	t.fns[PPC_INS_QVFRIN] = nullptr;
+	t.fns[PPC_INS_QVFRIP] = nullptr;
+	t.fns[PPC_INS_QVFRIZ] = nullptr;
+	t.fns[PPC_INS_QVFRSP] = nullptr;
+	t.fns[PPC_INS_QVFRSQRTE] = nullptr;
+	t.fns[PPC_INS_QVFRSQRTES] = nullptr;
+	t.fns[PPC_INS_QVFSEL] = nullptr;
+	t.fns[PPC_INS_QVFSUB] = nullptr;
+	t.fns[PPC_INS_QVFSUBS] = nullptr;
+	t.fns[PPC_INS_QVFTSTNAN] = nullptr;
+	t.fns[PPC_INS_QVFXMADD] = nullptr;
+	t.fns[PPC_INS_QVFXMADDS] = nullptr;
+	t.fns[PPC_INS_QVFXMUL] = nullptr;
+	t.fns[PPC_INS_QVFXMULS] = nullptr;
+	t.fns[PPC_INS_QVFXXCPNMADD] = nullptr;
+	t.fns[PPC_INS_QVFXXCPNMADDS] = nullptr;
+	t.fns[PPC_INS_QVFXXMADD] = nullptr;
+	t.fns[PPC_INS_QVFXXMADDS] = nullptr;
+	t.fns[PPC_INS_QVFXXNPMADD] = nullptr;
+	t.fns[PPC_INS_QVFXXNPMADDS] = nullptr;
+	t.fns[PPC_INS_QVGPCI] = nullptr;
+	t.fns[PPC_INS_QVLFCDUX] = nullptr;
+	t.fns[PPC_INS_QVLFCDUXA] = nullptr;
+	t.fns[PPC_INS_QVLFCDX] = nullptr;
+	t.fns[PPC_INS_QVLFCDXA] = nullptr;
+	t.fns[PPC_INS_QVLFCSUX] = nullptr;
+	t.fns[PPC_INS_QVLFCSUXA] = nullptr;
+	t.fns[PPC_INS_QVLFCSX] = nullptr;
+	t.fns[PPC_INS_QVLFCSXA] = nullptr;
+	t.fns[PPC_INS_QVLFDUX] = nullptr;
+	t.fns[PPC_INS_QVLFDUXA] = nullptr;
+	t.fns[PPC_INS_QVLFDX] = nullptr;
+	t.fns[PPC_INS_QVLFDXA] = nullptr;
+	t.fns[PPC_INS_QVLFIWAX] = nullptr;
+	t.fns[PPC_INS_QVLFIWAXA] = nullptr;
+	t.fns[PPC_INS_QVLFIWZX] = nullptr;
+	t.fns[PPC_INS_QVLFIWZXA] = nullptr;
+	t.fns[PPC_INS_QVLFSUX] = nullptr;
+	t.fns[PPC_INS_QVLFSUXA] = nullptr;
+	t.fns[PPC_INS_QVLFSX] = nullptr;
+	t.fns[PPC_INS_QVLFSXA] = nullptr;
+	t.fns[PPC_INS_QVLPCLDX] = nullptr;
+	t.fns[PPC_INS_QVLPCLSX] = nullptr;
+	t.fns[PPC_INS_QVLPCRDX] = nullptr;
+	t.fns[PPC_INS_QVLPCRSX] = nullptr;
+	t.fns[PPC_INS_QVSTFCDUX] = nullptr;
+	t.fns[PPC_INS_QVSTFCDUXA] = nullptr;
+	t.fns[PPC_INS_QVSTFCDUXI] = nullptr;
+	t.fns[PPC_INS_QVSTFCDUXIA] = nullptr;
+	t.fns[PPC_INS_QVSTFCDX] = nullptr;
+	t.fns[PPC_INS_QVSTFCDXA] = nullptr;
+	t.fns[PPC_INS_QVSTFCDXI] = nullptr;
+	t.fns[PPC_INS_QVSTFCDXIA] = nullptr;
+	t.fns[PPC_INS_QVSTFCSUX] = nullptr;
+	t.fns[PPC_INS_QVSTFCSUXA] = nullptr;
+	t.fns[PPC_INS_QVSTFCSUXI] = nullptr;
+	t.fns[PPC_INS_QVSTFCSUXIA] = nullptr;
+	t.fns[PPC_INS_QVSTFCSX] = nullptr;
+	t.fns[PPC_INS_QVSTFCSXA] = nullptr;
+	t.fns[PPC_INS_QVSTFCSXI] = nullptr;
+	t.fns[PPC_INS_QVSTFCSXIA] = nullptr;
+	t.fns[PPC_INS_QVSTFDUX] = nullptr;
+	t.fns[PPC_INS_QVSTFDUXA] = nullptr;
+	t.fns[PPC_INS_QVSTFDUXI] = nullptr;
+	t.fns[PPC_INS_QVSTFDUXIA] = nullptr;
+	t.fns[PPC_INS_QVSTFDX] = nullptr;
+	t.fns[PPC_INS_QVSTFDXA] = nullptr;
+	t.fns[PPC_INS_QVSTFDXI] = nullptr;
+	t.fns[PPC_INS_QVSTFDXIA] = nullptr;
+	t.fns[PPC_INS_QVSTFIWX] = nullptr;
+	t.fns[PPC_INS_QVSTFIWXA] = nullptr;
+	t.fns[PPC_INS_QVSTFSUX] = nullptr;
+	t.fns[PPC_INS_QVSTFSUXA] = nullptr;
+	t.fns[PPC_INS_QVSTFSUXI] = nullptr;
+	t.fns[PPC_INS_QVSTFSUXIA] = nullptr;
+	t.fns[PPC_INS_QVSTFSX] = nullptr;
+	t.fns[PPC_INS_QVSTFSXA] = nullptr;
+	t.fns[PPC_INS_QVSTFSXI] = nullptr;
+	t.fns[PPC_INS_QVSTFSXIA] = nullptr;
+	t.fns[PPC_INS_RFCI] = nullptr;
+	t.fns[PPC_INS_RFDI] = nullptr;
+	t.fns[PPC_INS_RFI] = nullptr;
+	t.fns[PPC_INS_RFID] = nullptr;
+	t.fns[PPC_INS_RFMCI] = nullptr;
+	t.fns[PPC_INS_RLDCL] = nullptr;
+	t.fns[PPC_INS_RLDCR] = nullptr;
+	t.fns[PPC_INS_RLDIC] = nullptr;
+	t.fns[PPC_INS_RLDICL] = nullptr;
+	t.fns[PPC_INS_RLDICR] = nullptr;
+	t.fns[PPC_INS_RLDIMI] = nullptr;
+	t.fns[PPC_INS_RLWIMI] = &Capstone2LlvmIrTranslatorPowerpc::translateRotateComplex5op;
+	t.fns[PPC_INS_RLWINM] = &Capstone2LlvmIrTranslatorPowerpc::translateRotateComplex5op;
+	t.fns[PPC_INS_RLWNM] = &Capstone2LlvmIrTranslatorPowerpc::translateRotateComplex5op;
+	t.fns[PPC_INS_SC] = nullptr;
+	t.fns[PPC_INS_SLBIA] = nullptr;
+	t.fns[PPC_INS_SLBIE] = nullptr;
+	t.fns[PPC_INS_SLBMFEE] = nullptr;
+	t.fns[PPC_INS_SLBMTE] = nullptr;
+	t.fns[PPC_INS_SLD] = nullptr;
+	t.fns[PPC_INS_SLW] = &Capstone2LlvmIrTranslatorPowerpc::translateShiftLeft;
+	t.fns[PPC_INS_SRAD] = nullptr;
+	t.fns[PPC_INS_SRADI] = nullptr;
+	t.fns[PPC_INS_SRAW] = &Capstone2LlvmIrTranslatorPowerpc::translateSraw;
+	t.fns[PPC_INS_SRAWI] = &Capstone2LlvmIrTranslatorPowerpc::translateSraw;
+	t.fns[PPC_INS_SRD] = nullptr;
+	t.fns[PPC_INS_SRW] = &Capstone2LlvmIrTranslatorPowerpc::translateShiftRight;
+	t.fns[PPC_INS_STB] = &Capstone2LlvmIrTranslatorPowerpc::translateStore;
+	t.fns[PPC_INS_STBCIX] = nullptr;
+	t.fns[PPC_INS_STBU] = &Capstone2LlvmIrTranslatorPowerpc::translateStore;
+	t.fns[PPC_INS_STBUX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed;
+	t.fns[PPC_INS_STBX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed;
+	t.fns[PPC_INS_STD] = nullptr;
+	t.fns[PPC_INS_STDBRX] = nullptr;
+	t.fns[PPC_INS_STDCIX] = nullptr;
+	t.fns[PPC_INS_STDCX] = nullptr;
+	t.fns[PPC_INS_STDU] = nullptr;
+	t.fns[PPC_INS_STDUX] = nullptr;
+	t.fns[PPC_INS_STDX] = nullptr;
+	t.fns[PPC_INS_STFD] = nullptr;
+	t.fns[PPC_INS_STFDU] = nullptr;
+	t.fns[PPC_INS_STFDUX] = nullptr;
+	t.fns[PPC_INS_STFDX] = nullptr;
+	t.fns[PPC_INS_STFIWX] = nullptr;
+	t.fns[PPC_INS_STFS] = nullptr;
+	t.fns[PPC_INS_STFSU] = nullptr;
+	t.fns[PPC_INS_STFSUX] = nullptr;
+	t.fns[PPC_INS_STFSX] = nullptr;
+	t.fns[PPC_INS_STH] = &Capstone2LlvmIrTranslatorPowerpc::translateStore;
+	t.fns[PPC_INS_STHBRX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreReverseIndexed;
+	t.fns[PPC_INS_STHCIX] = nullptr;
+	t.fns[PPC_INS_STHU] = &Capstone2LlvmIrTranslatorPowerpc::translateStore;
+	t.fns[PPC_INS_STHUX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed;
+	t.fns[PPC_INS_STHX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed;
+	t.fns[PPC_INS_STMW] = nullptr;
+	t.fns[PPC_INS_STSWI] = nullptr;
+	t.fns[PPC_INS_STVEBX] = nullptr;
+	t.fns[PPC_INS_STVEHX] = nullptr;
+	t.fns[PPC_INS_STVEWX] = nullptr;
+	t.fns[PPC_INS_STVX] = nullptr;
+	t.fns[PPC_INS_STVXL] = nullptr;
+	t.fns[PPC_INS_STW] = &Capstone2LlvmIrTranslatorPowerpc::translateStore;
+	t.fns[PPC_INS_STWBRX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreReverseIndexed;
+	t.fns[PPC_INS_STWCIX] = nullptr;
+	t.fns[PPC_INS_STWCX] = nullptr;
+	t.fns[PPC_INS_STWU] = &Capstone2LlvmIrTranslatorPowerpc::translateStore;
+	t.fns[PPC_INS_STWUX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed;
+	t.fns[PPC_INS_STWX] = &Capstone2LlvmIrTranslatorPowerpc::translateStoreIndexed;
+	t.fns[PPC_INS_STXSDX] = nullptr;
+	t.fns[PPC_INS_STXVD2X] = nullptr;
+	t.fns[PPC_INS_STXVW4X] = nullptr;
+	t.fns[PPC_INS_SUBF] = &Capstone2LlvmIrTranslatorPowerpc::translateSubf;
+	t.fns[PPC_INS_SUBFC] = &Capstone2LlvmIrTranslatorPowerpc::translateSubfc;
+	t.fns[PPC_INS_SUBFE] = &Capstone2LlvmIrTranslatorPowerpc::translateSubfe;
+	t.fns[PPC_INS_SUBFIC] = &Capstone2LlvmIrTranslatorPowerpc::translateSubfc;
+	t.fns[PPC_INS_SUBFME] = &Capstone2LlvmIrTranslatorPowerpc::translateSubfme;
+	t.fns[PPC_INS_SUBFZE] = &Capstone2LlvmIrTranslatorPowerpc::translateSubfze;
+	t.fns[PPC_INS_SYNC] = nullptr;
+	t.fns[PPC_INS_TD] = nullptr;
+	t.fns[PPC_INS_TDI] = nullptr;
+	t.fns[PPC_INS_TLBIA] = nullptr;
+	t.fns[PPC_INS_TLBIE] = nullptr;
+	t.fns[PPC_INS_TLBIEL] = nullptr;
+	t.fns[PPC_INS_TLBIVAX] = nullptr;
+	t.fns[PPC_INS_TLBLD] = nullptr;
+	t.fns[PPC_INS_TLBLI] = nullptr;
+	t.fns[PPC_INS_TLBRE] = nullptr;
+	t.fns[PPC_INS_TLBSX] = nullptr;
+	t.fns[PPC_INS_TLBSYNC] = nullptr;
+	t.fns[PPC_INS_TLBWE] = nullptr;
+	t.fns[PPC_INS_TRAP] = nullptr;
+	t.fns[PPC_INS_TW] = nullptr;
+	t.fns[PPC_INS_TWI] = nullptr;
+	t.fns[PPC_INS_VADDCUW] = nullptr;
+	t.fns[PPC_INS_VADDFP] = nullptr;
+	t.fns[PPC_INS_VADDSBS] = nullptr;
+	t.fns[PPC_INS_VADDSHS] = nullptr;
+	t.fns[PPC_INS_VADDSWS] = nullptr;
+	t.fns[PPC_INS_VADDUBM] = nullptr;
+	t.fns[PPC_INS_VADDUBS] = nullptr;
+	t.fns[PPC_INS_VADDUDM] = nullptr;
+	t.fns[PPC_INS_VADDUHM] = nullptr;
+	t.fns[PPC_INS_VADDUHS] = nullptr;
+	t.fns[PPC_INS_VADDUWM] = nullptr;
+	t.fns[PPC_INS_VADDUWS] = nullptr;
+	t.fns[PPC_INS_VAND] = nullptr;
+	t.fns[PPC_INS_VANDC] = nullptr;
+	t.fns[PPC_INS_VAVGSB] = nullptr;
+	t.fns[PPC_INS_VAVGSH] = nullptr;
+	t.fns[PPC_INS_VAVGSW] = nullptr;
+	t.fns[PPC_INS_VAVGUB] = nullptr;
+	t.fns[PPC_INS_VAVGUH] = nullptr;
+	t.fns[PPC_INS_VAVGUW] = nullptr;
+	t.fns[PPC_INS_VCFSX] = nullptr;
+	t.fns[PPC_INS_VCFUX] = nullptr;
+	t.fns[PPC_INS_VCLZB] = nullptr;
+	t.fns[PPC_INS_VCLZD] = nullptr;
+	t.fns[PPC_INS_VCLZH] = nullptr;
+	t.fns[PPC_INS_VCLZW] = nullptr;
+	t.fns[PPC_INS_VCMPBFP] = nullptr;
+	t.fns[PPC_INS_VCMPEQFP] = nullptr;
+	t.fns[PPC_INS_VCMPEQUB] = nullptr;
+	t.fns[PPC_INS_VCMPEQUD] = nullptr;
+	t.fns[PPC_INS_VCMPEQUH] = nullptr;
+	t.fns[PPC_INS_VCMPEQUW] = nullptr;
+	t.fns[PPC_INS_VCMPGEFP] = nullptr;
+	t.fns[PPC_INS_VCMPGTFP] = nullptr;
+	t.fns[PPC_INS_VCMPGTSB] = nullptr;
+	t.fns[PPC_INS_VCMPGTSD] = nullptr;
+	t.fns[PPC_INS_VCMPGTSH] = nullptr;
+	t.fns[PPC_INS_VCMPGTSW] = nullptr;
+	t.fns[PPC_INS_VCMPGTUB] = nullptr;
+	t.fns[PPC_INS_VCMPGTUD] = nullptr;
+	t.fns[PPC_INS_VCMPGTUH] = nullptr;
+	t.fns[PPC_INS_VCMPGTUW] = nullptr;
+	t.fns[PPC_INS_VCTSXS] = nullptr;
+	t.fns[PPC_INS_VCTUXS] = nullptr;
+	t.fns[PPC_INS_VEQV] = nullptr;
+	t.fns[PPC_INS_VEXPTEFP] = nullptr;
+	t.fns[PPC_INS_VLOGEFP] = nullptr;
+	t.fns[PPC_INS_VMADDFP] = nullptr;
+	t.fns[PPC_INS_VMAXFP] = nullptr;
+	t.fns[PPC_INS_VMAXSB] = nullptr;
+	t.fns[PPC_INS_VMAXSD] = nullptr;
+	t.fns[PPC_INS_VMAXSH] = nullptr;
+	t.fns[PPC_INS_VMAXSW] = nullptr;
+	t.fns[PPC_INS_VMAXUB] = nullptr;
+	t.fns[PPC_INS_VMAXUD] = nullptr;
+	t.fns[PPC_INS_VMAXUH] = nullptr;
+	t.fns[PPC_INS_VMAXUW] = nullptr;
+	t.fns[PPC_INS_VMHADDSHS] = nullptr;
+	t.fns[PPC_INS_VMHRADDSHS] = nullptr;
+	t.fns[PPC_INS_VMINUD] = nullptr;
+	t.fns[PPC_INS_VMINFP] = nullptr;
+	t.fns[PPC_INS_VMINSB] = nullptr;
+	t.fns[PPC_INS_VMINSD] = nullptr;
+	t.fns[PPC_INS_VMINSH] = nullptr;
+	t.fns[PPC_INS_VMINSW] = nullptr;
+	t.fns[PPC_INS_VMINUB] = nullptr;
+	t.fns[PPC_INS_VMINUH] = nullptr;
+	t.fns[PPC_INS_VMINUW] = nullptr;
+	t.fns[PPC_INS_VMLADDUHM] = nullptr;
+	t.fns[PPC_INS_VMRGHB] = nullptr;
+	t.fns[PPC_INS_VMRGHH] = nullptr;
+	t.fns[PPC_INS_VMRGHW] = nullptr;
+	t.fns[PPC_INS_VMRGLB] = nullptr;
+	t.fns[PPC_INS_VMRGLH] = nullptr;
+	t.fns[PPC_INS_VMRGLW] = nullptr;
+	t.fns[PPC_INS_VMSUMMBM] = nullptr;
+	t.fns[PPC_INS_VMSUMSHM] = nullptr;
+	t.fns[PPC_INS_VMSUMSHS] = nullptr;
+	t.fns[PPC_INS_VMSUMUBM] = nullptr;
+	t.fns[PPC_INS_VMSUMUHM] = nullptr;
+	t.fns[PPC_INS_VMSUMUHS] = nullptr;
+	t.fns[PPC_INS_VMULESB] = nullptr;
+	t.fns[PPC_INS_VMULESH] = nullptr;
+	t.fns[PPC_INS_VMULESW] = nullptr;
+	t.fns[PPC_INS_VMULEUB] = nullptr;
+	t.fns[PPC_INS_VMULEUH] = nullptr;
+	t.fns[PPC_INS_VMULEUW] = nullptr;
+	t.fns[PPC_INS_VMULOSB] = nullptr;
+	t.fns[PPC_INS_VMULOSH] = nullptr;
+	t.fns[PPC_INS_VMULOSW] = nullptr;
+	t.fns[PPC_INS_VMULOUB] = nullptr;
+	t.fns[PPC_INS_VMULOUH] = nullptr;
+	t.fns[PPC_INS_VMULOUW] = nullptr;
+	t.fns[PPC_INS_VMULUWM] = nullptr;
+	t.fns[PPC_INS_VNAND] = nullptr;
+	t.fns[PPC_INS_VNMSUBFP] = nullptr;
+	t.fns[PPC_INS_VNOR] = nullptr;
+	t.fns[PPC_INS_VOR] = nullptr;
+	t.fns[PPC_INS_VORC] = nullptr;
+	t.fns[PPC_INS_VPERM] = nullptr;
+	t.fns[PPC_INS_VPKPX] = nullptr;
+	t.fns[PPC_INS_VPKSHSS] = nullptr;
+	t.fns[PPC_INS_VPKSHUS] = nullptr;
+	t.fns[PPC_INS_VPKSWSS] = nullptr;
+	t.fns[PPC_INS_VPKSWUS] = nullptr;
+	t.fns[PPC_INS_VPKUHUM] = nullptr;
+	t.fns[PPC_INS_VPKUHUS] = nullptr;
+	t.fns[PPC_INS_VPKUWUM] = nullptr;
+	t.fns[PPC_INS_VPKUWUS] = nullptr;
+	t.fns[PPC_INS_VPOPCNTB] = nullptr;
+	t.fns[PPC_INS_VPOPCNTD] = nullptr;
+	t.fns[PPC_INS_VPOPCNTH] = nullptr;
+	t.fns[PPC_INS_VPOPCNTW] = nullptr;
+	t.fns[PPC_INS_VREFP] = nullptr;
+	t.fns[PPC_INS_VRFIM] = nullptr;
+	t.fns[PPC_INS_VRFIN] = nullptr;
+	t.fns[PPC_INS_VRFIP] = nullptr;
+	t.fns[PPC_INS_VRFIZ] = nullptr;
+	t.fns[PPC_INS_VRLB] = nullptr;
+	t.fns[PPC_INS_VRLD] = nullptr;
+	t.fns[PPC_INS_VRLH] = nullptr;
+	t.fns[PPC_INS_VRLW] = nullptr;
+	t.fns[PPC_INS_VRSQRTEFP] = nullptr;
+	t.fns[PPC_INS_VSEL] = nullptr;
+	t.fns[PPC_INS_VSL] = nullptr;
+	t.fns[PPC_INS_VSLB] = nullptr;
+	t.fns[PPC_INS_VSLD] = nullptr;
+	t.fns[PPC_INS_VSLDOI] = nullptr;
+	t.fns[PPC_INS_VSLH] = nullptr;
+	t.fns[PPC_INS_VSLO] = nullptr;
+	t.fns[PPC_INS_VSLW] = nullptr;
+	t.fns[PPC_INS_VSPLTB] = nullptr;
+	t.fns[PPC_INS_VSPLTH] = nullptr;
+	t.fns[PPC_INS_VSPLTISB] = nullptr;
+	t.fns[PPC_INS_VSPLTISH] = nullptr;
+	t.fns[PPC_INS_VSPLTISW] = nullptr;
+	t.fns[PPC_INS_VSPLTW] = nullptr;
+	t.fns[PPC_INS_VSR] = nullptr;
+	t.fns[PPC_INS_VSRAB] = nullptr;
+	t.fns[PPC_INS_VSRAD] = nullptr;
+	t.fns[PPC_INS_VSRAH] = nullptr;
+	t.fns[PPC_INS_VSRAW] = nullptr;
+	t.fns[PPC_INS_VSRB] = nullptr;
+	t.fns[PPC_INS_VSRD] = nullptr;
+	t.fns[PPC_INS_VSRH] = nullptr;
+	t.fns[PPC_INS_VSRO] = nullptr;
+	t.fns[PPC_INS_VSRW] = nullptr;
+	t.fns[PPC_INS_VSUBCUW] = nullptr;
+	t.fns[PPC_INS_VSUBFP] = nullptr;
+	t.fns[PPC_INS_VSUBSBS] = nullptr;
+	t.fns[PPC_INS_VSUBSHS] = nullptr;
+	t.fns[PPC_INS_VSUBSWS] = nullptr;
+	t.fns[PPC_INS_VSUBUBM] = nullptr;
+	t.fns[PPC_INS_VSUBUBS] = nullptr;
+	t.fns[PPC_INS_VSUBUDM] = nullptr;
+	t.fns[PPC_INS_VSUBUHM] = nullptr;
+	t.fns[PPC_INS_VSUBUHS] = nullptr;
+	t.fns[PPC_INS_VSUBUWM] = nullptr;
+	t.fns[PPC_INS_VSUBUWS] = nullptr;
+	t.fns[PPC_INS_VSUM2SWS] = nullptr;
+	t.fns[PPC_INS_VSUM4SBS] = nullptr;
+	t.fns[PPC_INS_VSUM4SHS] = nullptr;
+	t.fns[PPC_INS_VSUM4UBS] = nullptr;
+	t.fns[PPC_INS_VSUMSWS] = nullptr;
+	t.fns[PPC_INS_VUPKHPX] = nullptr;
+	t.fns[PPC_INS_VUPKHSB] = nullptr;
+	t.fns[PPC_INS_VUPKHSH] = nullptr;
+	t.fns[PPC_INS_VUPKLPX] = nullptr;
+	t.fns[PPC_INS_VUPKLSB] = nullptr;
+	t.fns[PPC_INS_VUPKLSH] = nullptr;
+	t.fns[PPC_INS_VXOR] = nullptr;
+	t.fns[PPC_INS_WAIT] = nullptr;
+	t.fns[PPC_INS_WRTEE] = nullptr;
+	t.fns[PPC_INS_WRTEEI] = nullptr;
+	t.fns[PPC_INS_XOR] = &Capstone2LlvmIrTranslatorPowerpc::translateXor;
+	t.fns[PPC_INS_XORI] = &Capstone2LlvmIrTranslatorPowerpc::translateXor;
+	t.fns[PPC_INS_XORIS] = &Capstone2LlvmIrTranslatorPowerpc::translateXoris;
+	t.fns[PPC_INS_XSABSDP] = nullptr;
+	t.fns[PPC_INS_XSADDDP] = nullptr;
+	t.fns[PPC_INS_XSCMPODP] = nullptr;
+	t.fns[PPC_INS_XSCMPUDP] = nullptr;
+	t.fns[PPC_INS_XSCPSGNDP] = nullptr;
+	t.fns[PPC_INS_XSCVDPSP] = nullptr;
+	t.fns[PPC_INS_XSCVDPSXDS] = nullptr;
+	t.fns[PPC_INS_XSCVDPSXWS] = nullptr;
+	t.fns[PPC_INS_XSCVDPUXDS] = nullptr;
+	t.fns[PPC_INS_XSCVDPUXWS] = nullptr;
+	t.fns[PPC_INS_XSCVSPDP] = nullptr;
+	t.fns[PPC_INS_XSCVSXDDP] = nullptr;
+	t.fns[PPC_INS_XSCVUXDDP] = nullptr;
+	t.fns[PPC_INS_XSDIVDP] = nullptr;
+	t.fns[PPC_INS_XSMADDADP] = nullptr;
+	t.fns[PPC_INS_XSMADDMDP] = nullptr;
+	t.fns[PPC_INS_XSMAXDP] = nullptr;
+	t.fns[PPC_INS_XSMINDP] = nullptr;
+	t.fns[PPC_INS_XSMSUBADP] = nullptr;
+	t.fns[PPC_INS_XSMSUBMDP] = nullptr;
+	t.fns[PPC_INS_XSMULDP] = nullptr;
+	t.fns[PPC_INS_XSNABSDP] = nullptr;
+	t.fns[PPC_INS_XSNEGDP] = nullptr;
+	t.fns[PPC_INS_XSNMADDADP] = nullptr;
+	t.fns[PPC_INS_XSNMADDMDP] = nullptr;
+	t.fns[PPC_INS_XSNMSUBADP] = nullptr;
+	t.fns[PPC_INS_XSNMSUBMDP] = nullptr;
+	t.fns[PPC_INS_XSRDPI] = nullptr;
+	t.fns[PPC_INS_XSRDPIC] = nullptr;
+	t.fns[PPC_INS_XSRDPIM] = nullptr;
+	t.fns[PPC_INS_XSRDPIP] = nullptr;
+	t.fns[PPC_INS_XSRDPIZ] = nullptr;
+	t.fns[PPC_INS_XSREDP] = nullptr;
+	t.fns[PPC_INS_XSRSQRTEDP] = nullptr;
+	t.fns[PPC_INS_XSSQRTDP] = nullptr;
+	t.fns[PPC_INS_XSSUBDP] = nullptr;
+	t.fns[PPC_INS_XSTDIVDP] = nullptr;
+	t.fns[PPC_INS_XSTSQRTDP] = nullptr;
+	t.fns[PPC_INS_XVABSDP] = nullptr;
+	t.fns[PPC_INS_XVABSSP] = nullptr;
+	t.fns[PPC_INS_XVADDDP] = nullptr;
+	t.fns[PPC_INS_XVADDSP] = nullptr;
+	t.fns[PPC_INS_XVCMPEQDP] = nullptr;
+	t.fns[PPC_INS_XVCMPEQSP] = nullptr;
+	t.fns[PPC_INS_XVCMPGEDP] = nullptr;
+	t.fns[PPC_INS_XVCMPGESP] = nullptr;
+	t.fns[PPC_INS_XVCMPGTDP] = nullptr;
+	t.fns[PPC_INS_XVCMPGTSP] = nullptr;
+	t.fns[PPC_INS_XVCPSGNDP] = nullptr;
+	t.fns[PPC_INS_XVCPSGNSP] = nullptr;
+	t.fns[PPC_INS_XVCVDPSP] = nullptr;
+	t.fns[PPC_INS_XVCVDPSXDS] = nullptr;
+	t.fns[PPC_INS_XVCVDPSXWS] = nullptr;
+	t.fns[PPC_INS_XVCVDPUXDS] = nullptr;
+	t.fns[PPC_INS_XVCVDPUXWS] = nullptr;
+	t.fns[PPC_INS_XVCVSPDP] = nullptr;
+	t.fns[PPC_INS_XVCVSPSXDS] = nullptr;
+	t.fns[PPC_INS_XVCVSPSXWS] = nullptr;
+	t.fns[PPC_INS_XVCVSPUXDS] = nullptr;
+	t.fns[PPC_INS_XVCVSPUXWS] = nullptr;
+	t.fns[PPC_INS_XVCVSXDDP] = nullptr;
+	t.fns[PPC_INS_XVCVSXDSP] = nullptr;
+	t.fns[PPC_INS_XVCVSXWDP] = nullptr;
+	t.fns[PPC_INS_XVCVSXWSP] = nullptr;
+	t.fns[PPC_INS_XVCVUXDDP] = nullptr;
+	t.fns[PPC_INS_XVCVUXDSP] = nullptr;
+	t.fns[PPC_INS_XVCVUXWDP] = nullptr;
+	t.fns[PPC_INS_XVCVUXWSP] = nullptr;
+	t.fns[PPC_INS_XVDIVDP] = nullptr;
+	t.fns[PPC_INS_XVDIVSP] = nullptr;
+	t.fns[PPC_INS_XVMADDADP] = nullptr;
+	t.fns[PPC_INS_XVMADDASP] = nullptr;
+	t.fns[PPC_INS_XVMADDMDP] = nullptr;
+	t.fns[PPC_INS_XVMADDMSP] = nullptr;
+	t.fns[PPC_INS_XVMAXDP] = nullptr;
+	t.fns[PPC_INS_XVMAXSP] = nullptr;
+	t.fns[PPC_INS_XVMINDP] = nullptr;
+	t.fns[PPC_INS_XVMINSP] = nullptr;
+	t.fns[PPC_INS_XVMSUBADP] = nullptr;
+	t.fns[PPC_INS_XVMSUBASP] = nullptr;
+	t.fns[PPC_INS_XVMSUBMDP] = nullptr;
+	t.fns[PPC_INS_XVMSUBMSP] = nullptr;
+	t.fns[PPC_INS_XVMULDP] = nullptr;
+	t.fns[PPC_INS_XVMULSP] = nullptr;
+	t.fns[PPC_INS_XVNABSDP] = nullptr;
+	t.fns[PPC_INS_XVNABSSP] = nullptr;
+	t.fns[PPC_INS_XVNEGDP] = nullptr;
+	t.fns[PPC_INS_XVNEGSP] = nullptr;
+	t.fns[PPC_INS_XVNMADDADP] = nullptr;
+	t.fns[PPC_INS_XVNMADDASP] = nullptr;
+	t.fns[PPC_INS_XVNMADDMDP] = nullptr;
+	t.fns[PPC_INS_XVNMADDMSP] = nullptr;
+	t.fns[PPC_INS_XVNMSUBADP] = nullptr;
+	t.fns[PPC_INS_XVNMSUBASP] = nullptr;
+	t.fns[PPC_INS_XVNMSUBMDP] = nullptr;
+	t.fns[PPC_INS_XVNMSUBMSP] = nullptr;
+	t.fns[PPC_INS_XVRDPI] = nullptr;
+	t.fns[PPC_INS_XVRDPIC] = nullptr;
+	t.fns[PPC_INS_XVRDPIM] = nullptr;
+	t.fns[PPC_INS_XVRDPIP] = nullptr;
+	t.fns[PPC_INS_XVRDPIZ] = nullptr;
+	t.fns[PPC_INS_XVREDP] = nullptr;
+	t.fns[PPC_INS_XVRESP] = nullptr;
+	t.fns[PPC_INS_XVRSPI] = nullptr;
+	t.fns[PPC_INS_XVRSPIC] = nullptr;
+	t.fns[PPC_INS_XVRSPIM] = nullptr;
+	t.fns[PPC_INS_XVRSPIP] = nullptr;
+	t.fns[PPC_INS_XVRSPIZ] = nullptr;
+	t.fns[PPC_INS_XVRSQRTEDP] = nullptr;
+	t.fns[PPC_INS_XVRSQRTESP] = nullptr;
+	t.fns[PPC_INS_XVSQRTDP] = nullptr;
+	t.fns[PPC_INS_XVSQRTSP] = nullptr;
+	t.fns[PPC_INS_XVSUBDP] = nullptr;
+	t.fns[PPC_INS_XVSUBSP] = nullptr;
+	t.fns[PPC_INS_XVTDIVDP] = nullptr;
+	t.fns[PPC_INS_XVTDIVSP] = nullptr;
+	t.fns[PPC_INS_XVTSQRTDP] = nullptr;
+	t.fns[PPC_INS_XVTSQRTSP] = nullptr;
+	t.fns[PPC_INS_XXLAND] = nullptr;
+	t.fns[PPC_INS_XXLANDC] = nullptr;
+	t.fns[PPC_INS_XXLEQV] = nullptr;
+	t.fns[PPC_INS_XXLNAND] = nullptr;
+	t.fns[PPC_INS_XXLNOR] = nullptr;
+	t.fns[PPC_INS_XXLOR] = nullptr;
+	t.fns[PPC_INS_XXLORC] = nullptr;
+	t.fns[PPC_INS_XXLXOR] = nullptr;
+	t.fns[PPC_INS_XXMRGHW] = nullptr;
+	t.fns[PPC_INS_XXMRGLW] = nullptr;
+	t.fns[PPC_INS_XXPERMDI] = nullptr;
+	t.fns[PPC_INS_XXSEL] = nullptr;
+	t.fns[PPC_INS_XXSLDWI] = nullptr;
+	t.fns[PPC_INS_XXSPLTW] = nullptr;
 
-		{PPC_INS_CRSET, &Capstone2LlvmIrTranslatorPowerpc::translateCrSetClr},
-		{PPC_INS_CRCLR, &Capstone2LlvmIrTranslatorPowerpc::translateCrSetClr},
-		{PPC_INS_CRNOT, &Capstone2LlvmIrTranslatorPowerpc::translateCrNotMove},
-		{PPC_INS_CRMOVE, &Capstone2LlvmIrTranslatorPowerpc::translateCrNotMove},
+	// extra & alias instructions
+	t.fns[PPC_INS_SLWI] = &Capstone2LlvmIrTranslatorPowerpc::translateSlwi;
+	t.fns[PPC_INS_SRWI] = &Capstone2LlvmIrTranslatorPowerpc::translateSrwi;
+	t.fns[PPC_INS_SLDI] = nullptr;
 
-		{PPC_INS_MFBR0, nullptr},
-		{PPC_INS_MFBR1, nullptr},
-		{PPC_INS_MFBR2, nullptr},
-		{PPC_INS_MFBR3, nullptr},
-		{PPC_INS_MFBR4, nullptr},
-		{PPC_INS_MFBR5, nullptr},
-		{PPC_INS_MFBR6, nullptr},
-		{PPC_INS_MFBR7, nullptr},
-		{PPC_INS_MFXER, nullptr},
-		{PPC_INS_MFRTCU, nullptr},
-		{PPC_INS_MFRTCL, nullptr},
-		{PPC_INS_MFDSCR, nullptr},
-		{PPC_INS_MFDSISR, nullptr},
-		{PPC_INS_MFDAR, nullptr},
-		{PPC_INS_MFSRR2, nullptr},
-		{PPC_INS_MFSRR3, nullptr},
-		{PPC_INS_MFCFAR, nullptr},
-		{PPC_INS_MFAMR, nullptr},
-		{PPC_INS_MFPID, nullptr},
-		{PPC_INS_MFTBLO, nullptr},
-		{PPC_INS_MFTBHI, nullptr},
-		{PPC_INS_MFDBATU, nullptr},
-		{PPC_INS_MFDBATL, nullptr},
-		{PPC_INS_MFIBATU, nullptr},
-		{PPC_INS_MFIBATL, nullptr},
-		{PPC_INS_MFDCCR, nullptr},
-		{PPC_INS_MFICCR, nullptr},
-		{PPC_INS_MFDEAR, nullptr},
-		{PPC_INS_MFESR, nullptr},
-		{PPC_INS_MFSPEFSCR, nullptr},
-		{PPC_INS_MFTCR, nullptr},
-		{PPC_INS_MFASR, nullptr},
-		{PPC_INS_MFPVR, nullptr},
-		{PPC_INS_MFTBU, nullptr},
-		{PPC_INS_MTCR, &Capstone2LlvmIrTranslatorPowerpc::translateMtcr},
-		{PPC_INS_MTBR0, nullptr},
-		{PPC_INS_MTBR1, nullptr},
-		{PPC_INS_MTBR2, nullptr},
-		{PPC_INS_MTBR3, nullptr},
-		{PPC_INS_MTBR4, nullptr},
-		{PPC_INS_MTBR5, nullptr},
-		{PPC_INS_MTBR6, nullptr},
-		{PPC_INS_MTBR7, nullptr},
-		{PPC_INS_MTXER, nullptr},
-		{PPC_INS_MTDSCR, nullptr},
-		{PPC_INS_MTDSISR, nullptr},
-		{PPC_INS_MTDAR, nullptr},
-		{PPC_INS_MTSRR2, nullptr},
-		{PPC_INS_MTSRR3, nullptr},
-		{PPC_INS_MTCFAR, nullptr},
-		{PPC_INS_MTAMR, nullptr},
-		{PPC_INS_MTPID, nullptr},
-		{PPC_INS_MTTBL, nullptr},
-		{PPC_INS_MTTBU, nullptr},
-		{PPC_INS_MTTBLO, nullptr},
-		{PPC_INS_MTTBHI, nullptr},
-		{PPC_INS_MTDBATU, nullptr},
-		{PPC_INS_MTDBATL, nullptr},
-		{PPC_INS_MTIBATU, nullptr},
-		{PPC_INS_MTIBATL, nullptr},
-		{PPC_INS_MTDCCR, nullptr},
-		{PPC_INS_MTICCR, nullptr},
-		{PPC_INS_MTDEAR, nullptr},
-		{PPC_INS_MTESR, nullptr},
-		{PPC_INS_MTSPEFSCR, nullptr},
-		{PPC_INS_MTTCR, nullptr},
-		{PPC_INS_NOT, &Capstone2LlvmIrTranslatorPowerpc::translateNot},
-		{PPC_INS_MR, &Capstone2LlvmIrTranslatorPowerpc::translateMr},
-		{PPC_INS_ROTLD, nullptr},
-		{PPC_INS_ROTLDI, nullptr},
-		{PPC_INS_CLRLDI, nullptr},
-		{PPC_INS_ROTLWI, &Capstone2LlvmIrTranslatorPowerpc::translateRotlw},
-		{PPC_INS_CLRLWI, &Capstone2LlvmIrTranslatorPowerpc::translateClrlwi},
-		{PPC_INS_ROTLW, &Capstone2LlvmIrTranslatorPowerpc::translateRotlw},
-		{PPC_INS_SUB, &Capstone2LlvmIrTranslatorPowerpc::translateSubf},
-		{PPC_INS_SUBC, &Capstone2LlvmIrTranslatorPowerpc::translateSubfc},
-		{PPC_INS_LWSYNC, nullptr},
-		{PPC_INS_PTESYNC, nullptr},
-		{PPC_INS_TDLT, nullptr},
-		{PPC_INS_TDEQ, nullptr},
-		{PPC_INS_TDGT, nullptr},
-		{PPC_INS_TDNE, nullptr},
-		{PPC_INS_TDLLT, nullptr},
-		{PPC_INS_TDLGT, nullptr},
-		{PPC_INS_TDU, nullptr},
-		{PPC_INS_TDLTI, nullptr},
-		{PPC_INS_TDEQI, nullptr},
-		{PPC_INS_TDGTI, nullptr},
-		{PPC_INS_TDNEI, nullptr},
-		{PPC_INS_TDLLTI, nullptr},
-		{PPC_INS_TDLGTI, nullptr},
-		{PPC_INS_TDUI, nullptr},
-		{PPC_INS_TLBREHI, nullptr},
-		{PPC_INS_TLBRELO, nullptr},
-		{PPC_INS_TLBWEHI, nullptr},
-		{PPC_INS_TLBWELO, nullptr},
-		{PPC_INS_TWLT, nullptr},
-		{PPC_INS_TWEQ, nullptr},
-		{PPC_INS_TWGT, nullptr},
-		{PPC_INS_TWNE, nullptr},
-		{PPC_INS_TWLLT, nullptr},
-		{PPC_INS_TWLGT, nullptr},
-		{PPC_INS_TWU, nullptr},
-		{PPC_INS_TWLTI, nullptr},
-		{PPC_INS_TWEQI, nullptr},
-		{PPC_INS_TWGTI, nullptr},
-		{PPC_INS_TWNEI, nullptr},
-		{PPC_INS_TWLLTI, nullptr},
-		{PPC_INS_TWLGTI, nullptr},
-		{PPC_INS_TWUI, nullptr},
-		{PPC_INS_WAITRSV, nullptr},
-		{PPC_INS_WAITIMPL, nullptr},
-		{PPC_INS_XNOP, nullptr},
-		{PPC_INS_XVMOVDP, nullptr},
-		{PPC_INS_XVMOVSP, nullptr},
-		{PPC_INS_XXSPLTD, nullptr},
-		{PPC_INS_XXMRGHD, nullptr},
-		{PPC_INS_XXMRGLD, nullptr},
-		{PPC_INS_XXSWAPD, nullptr},
+	t.fns[PPC_INS_CRSET] = &Capstone2LlvmIrTranslatorPowerpc::translateCrSetClr;
+	t.fns[PPC_INS_CRCLR] = &Capstone2LlvmIrTranslatorPowerpc::translateCrSetClr;
+	t.fns[PPC_INS_CRNOT] = &Capstone2LlvmIrTranslatorPowerpc::translateCrNotMove;
+	t.fns[PPC_INS_CRMOVE] = &Capstone2LlvmIrTranslatorPowerpc::translateCrNotMove;
 
-		// QPX
-		{PPC_INS_QVFAND, nullptr},
-		{PPC_INS_QVFCLR, nullptr},
-		{PPC_INS_QVFANDC, nullptr},
-		{PPC_INS_QVFCTFB, nullptr},
-		{PPC_INS_QVFXOR, nullptr},
-		{PPC_INS_QVFOR, nullptr},
-		{PPC_INS_QVFNOR, nullptr},
-		{PPC_INS_QVFEQU, nullptr},
-		{PPC_INS_QVFNOT, nullptr},
-		{PPC_INS_QVFORC, nullptr},
-		{PPC_INS_QVFNAND, nullptr},
-		{PPC_INS_QVFSET, nullptr},
+	t.fns[PPC_INS_MFBR0] = nullptr;
+	t.fns[PPC_INS_MFBR1] = nullptr;
+	t.fns[PPC_INS_MFBR2] = nullptr;
+	t.fns[PPC_INS_MFBR3] = nullptr;
+	t.fns[PPC_INS_MFBR4] = nullptr;
+	t.fns[PPC_INS_MFBR5] = nullptr;
+	t.fns[PPC_INS_MFBR6] = nullptr;
+	t.fns[PPC_INS_MFBR7] = nullptr;
+	t.fns[PPC_INS_MFXER] = nullptr;
+	t.fns[PPC_INS_MFRTCU] = nullptr;
+	t.fns[PPC_INS_MFRTCL] = nullptr;
+	t.fns[PPC_INS_MFDSCR] = nullptr;
+	t.fns[PPC_INS_MFDSISR] = nullptr;
+	t.fns[PPC_INS_MFDAR] = nullptr;
+	t.fns[PPC_INS_MFSRR2] = nullptr;
+	t.fns[PPC_INS_MFSRR3] = nullptr;
+	t.fns[PPC_INS_MFCFAR] = nullptr;
+	t.fns[PPC_INS_MFAMR] = nullptr;
+	t.fns[PPC_INS_MFPID] = nullptr;
+	t.fns[PPC_INS_MFTBLO] = nullptr;
+	t.fns[PPC_INS_MFTBHI] = nullptr;
+	t.fns[PPC_INS_MFDBATU] = nullptr;
+	t.fns[PPC_INS_MFDBATL] = nullptr;
+	t.fns[PPC_INS_MFIBATU] = nullptr;
+	t.fns[PPC_INS_MFIBATL] = nullptr;
+	t.fns[PPC_INS_MFDCCR] = nullptr;
+	t.fns[PPC_INS_MFICCR] = nullptr;
+	t.fns[PPC_INS_MFDEAR] = nullptr;
+	t.fns[PPC_INS_MFESR] = nullptr;
+	t.fns[PPC_INS_MFSPEFSCR] = nullptr;
+	t.fns[PPC_INS_MFTCR] = nullptr;
+	t.fns[PPC_INS_MFASR] = nullptr;
+	t.fns[PPC_INS_MFPVR] = nullptr;
+	t.fns[PPC_INS_MFTBU] = nullptr;
+	t.fns[PPC_INS_MTCR] = &Capstone2LlvmIrTranslatorPowerpc::translateMtcr;
+	t.fns[PPC_INS_MTBR0] = nullptr;
+	t.fns[PPC_INS_MTBR1] = nullptr;
+	t.fns[PPC_INS_MTBR2] = nullptr;
+	t.fns[PPC_INS_MTBR3] = nullptr;
+	t.fns[PPC_INS_MTBR4] = nullptr;
+	t.fns[PPC_INS_MTBR5] = nullptr;
+	t.fns[PPC_INS_MTBR6] = nullptr;
+	t.fns[PPC_INS_MTBR7] = nullptr;
+	t.fns[PPC_INS_MTXER] = nullptr;
+	t.fns[PPC_INS_MTDSCR] = nullptr;
+	t.fns[PPC_INS_MTDSISR] = nullptr;
+	t.fns[PPC_INS_MTDAR] = nullptr;
+	t.fns[PPC_INS_MTSRR2] = nullptr;
+	t.fns[PPC_INS_MTSRR3] = nullptr;
+	t.fns[PPC_INS_MTCFAR] = nullptr;
+	t.fns[PPC_INS_MTAMR] = nullptr;
+	t.fns[PPC_INS_MTPID] = nullptr;
+	t.fns[PPC_INS_MTTBL] = nullptr;
+	t.fns[PPC_INS_MTTBU] = nullptr;
+	t.fns[PPC_INS_MTTBLO] = nullptr;
+	t.fns[PPC_INS_MTTBHI] = nullptr;
+	t.fns[PPC_INS_MTDBATU] = nullptr;
+	t.fns[PPC_INS_MTDBATL] = nullptr;
+	t.fns[PPC_INS_MTIBATU] = nullptr;
+	t.fns[PPC_INS_MTIBATL] = nullptr;
+	t.fns[PPC_INS_MTDCCR] = nullptr;
+	t.fns[PPC_INS_MTICCR] = nullptr;
+	t.fns[PPC_INS_MTDEAR] = nullptr;
+	t.fns[PPC_INS_MTESR] = nullptr;
+	t.fns[PPC_INS_MTSPEFSCR] = nullptr;
+	t.fns[PPC_INS_MTTCR] = nullptr;
+	t.fns[PPC_INS_NOT] = &Capstone2LlvmIrTranslatorPowerpc::translateNot;
+	t.fns[PPC_INS_MR] = &Capstone2LlvmIrTranslatorPowerpc::translateMr;
+	t.fns[PPC_INS_ROTLD] = nullptr;
+	t.fns[PPC_INS_ROTLDI] = nullptr;
+	t.fns[PPC_INS_CLRLDI] = nullptr;
+	t.fns[PPC_INS_ROTLWI] = &Capstone2LlvmIrTranslatorPowerpc::translateRotlw;
+	t.fns[PPC_INS_CLRLWI] = &Capstone2LlvmIrTranslatorPowerpc::translateClrlwi;
+	t.fns[PPC_INS_ROTLW] = &Capstone2LlvmIrTranslatorPowerpc::translateRotlw;
+	t.fns[PPC_INS_SUB] = &Capstone2LlvmIrTranslatorPowerpc::translateSubf;
+	t.fns[PPC_INS_SUBC] = &Capstone2LlvmIrTranslatorPowerpc::translateSubfc;
+	t.fns[PPC_INS_LWSYNC] = nullptr;
+	t.fns[PPC_INS_PTESYNC] = nullptr;
+	t.fns[PPC_INS_TDLT] = nullptr;
+	t.fns[PPC_INS_TDEQ] = nullptr;
+	t.fns[PPC_INS_TDGT] = nullptr;
+	t.fns[PPC_INS_TDNE] = nullptr;
+	t.fns[PPC_INS_TDLLT] = nullptr;
+	t.fns[PPC_INS_TDLGT] = nullptr;
+	t.fns[PPC_INS_TDU] = nullptr;
+	t.fns[PPC_INS_TDLTI] = nullptr;
+	t.fns[PPC_INS_TDEQI] = nullptr;
+	t.fns[PPC_INS_TDGTI] = nullptr;
+	t.fns[PPC_INS_TDNEI] = nullptr;
+	t.fns[PPC_INS_TDLLTI] = nullptr;
+	t.fns[PPC_INS_TDLGTI] = nullptr;
+	t.fns[PPC_INS_TDUI] = nullptr;
+	t.fns[PPC_INS_TLBREHI] = nullptr;
+	t.fns[PPC_INS_TLBRELO] = nullptr;
+	t.fns[PPC_INS_TLBWEHI] = nullptr;
+	t.fns[PPC_INS_TLBWELO] = nullptr;
+	t.fns[PPC_INS_TWLT] = nullptr;
+	t.fns[PPC_INS_TWEQ] = nullptr;
+	t.fns[PPC_INS_TWGT] = nullptr;
+	t.fns[PPC_INS_TWNE] = nullptr;
+	t.fns[PPC_INS_TWLLT] = nullptr;
+	t.fns[PPC_INS_TWLGT] = nullptr;
+	t.fns[PPC_INS_TWU] = nullptr;
+	t.fns[PPC_INS_TWLTI] = nullptr;
+	t.fns[PPC_INS_TWEQI] = nullptr;
+	t.fns[PPC_INS_TWGTI] = nullptr;
+	t.fns[PPC_INS_TWNEI] = nullptr;
+	t.fns[PPC_INS_TWLLTI] = nullptr;
+	t.fns[PPC_INS_TWLGTI] = nullptr;
+	t.fns[PPC_INS_TWUI] = nullptr;
+	t.fns[PPC_INS_WAITRSV] = nullptr;
+	t.fns[PPC_INS_WAITIMPL] = nullptr;
+	t.fns[PPC_INS_XNOP] = nullptr;
+	t.fns[PPC_INS_XVMOVDP] = nullptr;
+	t.fns[PPC_INS_XVMOVSP] = nullptr;
+	t.fns[PPC_INS_XXSPLTD] = nullptr;
+	t.fns[PPC_INS_XXMRGHD] = nullptr;
+	t.fns[PPC_INS_XXMRGLD] = nullptr;
+	t.fns[PPC_INS_XXSWAPD] = nullptr;
 
-		{PPC_INS_ENDING, nullptr},
+	// QPX
+	t.fns[PPC_INS_QVFAND] = nullptr;
+	t.fns[PPC_INS_QVFCLR] = nullptr;
+	t.fns[PPC_INS_QVFANDC] = nullptr;
+	t.fns[PPC_INS_QVFCTFB] = nullptr;
+	t.fns[PPC_INS_QVFXOR] = nullptr;
+	t.fns[PPC_INS_QVFOR] = nullptr;
+	t.fns[PPC_INS_QVFNOR] = nullptr;
+	t.fns[PPC_INS_QVFEQU] = nullptr;
+	t.fns[PPC_INS_QVFNOT] = nullptr;
+	t.fns[PPC_INS_QVFORC] = nullptr;
+	t.fns[PPC_INS_QVFNAND] = nullptr;
+	t.fns[PPC_INS_QVFSET] = nullptr;
 
-		// Branches.
-		//
 
-		// Basic unconditional.
-		{PPC_INS_B, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
+	// Branches.
+	//
 
-		// Basic conditional.
-		{PPC_INS_BC, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCCTR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCCTRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
+	// Basic unconditional.
+	t.fns[PPC_INS_B] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
 
-		// Branch unconditionally.
-		{PPC_INS_BLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCTR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BCTRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
+	// Basic conditional.
+	t.fns[PPC_INS_BC] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCCTR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCCTRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
 
-		// Branch if condition true.
-		{PPC_INS_BT, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BTA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BTLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BTCTR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BTL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BTLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BTLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BTCTRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
+	// Branch unconditionally.
+	t.fns[PPC_INS_BLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCTR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BCTRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
 
-		// Branch if condition false.
-		{PPC_INS_BF, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BFA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BFLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BFCTR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BFL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BFLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BFLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BFCTRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
+	// Branch if condition true.
+	t.fns[PPC_INS_BT] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BTA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BTLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BTCTR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BTL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BTLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BTLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BTCTRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
 
-		// Decrement CTR, branch if CTR != 0
-		{PPC_INS_BDNZ, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		// Decrement CTR, branch if CTR != 0 & cond true
-		{PPC_INS_BDNZT, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZTA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZTLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZTL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZTLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZTLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		// Decrement CTR, branch if CTR != 0 & cond false
-		{PPC_INS_BDNZF, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZFA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		// TODO: Where is bdnzflr? Report Capstone bug?
-		{PPC_INS_BDNZFL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZFLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDNZFLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
+	// Branch if condition false.
+	t.fns[PPC_INS_BF] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BFA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BFLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BFCTR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BFL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BFLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BFLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BFCTRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
 
-		// Decrement CTR, branch if CTR == 0
-		//
-		{PPC_INS_BDZ, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		// Decrement CTR, branch if CTR == 0 & cond true
-		{PPC_INS_BDZT, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZTA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZTLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZTL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZTLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZTLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		// Decrement CTR, branch if CTR == 0 & cond false
-		{PPC_INS_BDZF, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZFA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZFLR, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZFL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZFLA, &Capstone2LlvmIrTranslatorPowerpc::translateB},
-		{PPC_INS_BDZFLRL, &Capstone2LlvmIrTranslatorPowerpc::translateB},
+	// Decrement CTR, branch if CTR != 0
+	t.fns[PPC_INS_BDNZ] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	// Decrement CTR, branch if CTR != 0 & cond true
+	t.fns[PPC_INS_BDNZT] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZTA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZTLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZTL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZTLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZTLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	// Decrement CTR, branch if CTR != 0 & cond false
+	t.fns[PPC_INS_BDNZF] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZFA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	// TODO: Where is bdnzflr? Report Capstone bug?
+	t.fns[PPC_INS_BDNZFL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZFLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDNZFLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
 
-		// TODO: What is this? It is not in specification. Is it even branch?
-		{PPC_INS_BCT, nullptr}, // &Capstone2LlvmIrTranslatorPowerpc::translateASSERT
-};
+	// Decrement CTR, branch if CTR == 0
+	//
+	t.fns[PPC_INS_BDZ] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	// Decrement CTR, branch if CTR == 0 & cond true
+	t.fns[PPC_INS_BDZT] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZTA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZTLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZTL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZTLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZTLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	// Decrement CTR, branch if CTR == 0 & cond false
+	t.fns[PPC_INS_BDZF] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZFA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZFLR] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZFL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZFLA] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+	t.fns[PPC_INS_BDZFLRL] = &Capstone2LlvmIrTranslatorPowerpc::translateB;
+
+	// TODO: What is this? It is not in specification. Is it even branch?
+	t.fns[PPC_INS_BCT] = nullptr; // &Capstone2LlvmIrTranslatorPowerpc::translateASSERT
+
+	return t;
+}
+
+const Capstone2LlvmIrTranslatorPowerpc::DispatchTable Capstone2LlvmIrTranslatorPowerpc::_i2fm =
+		Capstone2LlvmIrTranslatorPowerpc::makeDispatchTable();
 
 } // namespace capstone2llvmir
 } // namespace retdec
@@ -0,0 +1,146 @@
+/**
+ * @file src/capstone2llvmir/translator_pool.cpp
+ * @brief Pool of translators for concurrent decoding.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cassert>
+
+#include "retdec/capstone2llvmir/translator_pool.h"
+
+namespace retdec {
+namespace capstone2llvmir {
+
+//
+//=============================================================================
+//  Capstone2LlvmIrTranslatorPool
+//=============================================================================
+//
+
+/**
+ * Create one translator instance for architecture @a a and modes @a basic,
+ * @a extra per module in @a modules. Modules are typically per-thread
+ * temporary modules that the caller links together after decoding.
+ * @c Capstone2LlvmIrError is propagated if any instance cannot be created.
+ */
+Capstone2LlvmIrTranslatorPool::Capstone2LlvmIrTranslatorPool(
+		cs_arch a,
+		const std::vector<llvm::Module*>& modules,
+		cs_mode basic,
+		cs_mode extra)
+{
+	_translators.reserve(modules.size());
+	_available.reserve(modules.size());
+	for (auto* m : modules)
+	{
+		_translators.push_back(
+				Capstone2LlvmIrTranslator::createArch(a, m, basic, extra));
+		_available.push_back(_translators.back().get());
+	}
+}
+
+/**
+ * Check out a translator instance. Blocks until one is available.
+ */
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator
+Capstone2LlvmIrTranslatorPool::checkOut()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_cond.wait(lock, [this]() { return !_available.empty(); });
+	auto* t = _available.back();
+	_available.pop_back();
+	return CheckedOutTranslator(this, t);
+}
+
+/**
+ * @return Number of instances in the pool, both available and checked out.
+ */
+std::size_t Capstone2LlvmIrTranslatorPool::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _translators.size();
+}
+
+void Capstone2LlvmIrTranslatorPool::checkIn(Capstone2LlvmIrTranslator* t)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_available.push_back(t);
+	}
+	_cond.notify_one();
+}
+
+//
+//=============================================================================
+//  Capstone2LlvmIrTranslatorPool::CheckedOutTranslator
+//=============================================================================
+//
+
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator::CheckedOutTranslator(
+		Capstone2LlvmIrTranslatorPool* pool,
+		Capstone2LlvmIrTranslator* translator)
+		:
+		_pool(pool),
+		_translator(translator)
+{
+
+}
+
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator::CheckedOutTranslator(
+		CheckedOutTranslator&& other)
+		:
+		_pool(other._pool),
+		_translator(other._translator)
+{
+	other._pool = nullptr;
+	other._translator = nullptr;
+}
+
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator&
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator::operator=(
+		CheckedOutTranslator&& other)
+{
+	if (this != &other)
+	{
+		if (_pool)
+		{
+			_pool->checkIn(_translator);
+		}
+		_pool = other._pool;
+		_translator = other._translator;
+		other._pool = nullptr;
+		other._translator = nullptr;
+	}
+	return *this;
+}
+
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator::~CheckedOutTranslator()
+{
+	if (_pool)
+	{
+		_pool->checkIn(_translator);
+	}
+}
+
+Capstone2LlvmIrTranslator*
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator::get() const
+{
+	return _translator;
+}
+
+Capstone2LlvmIrTranslator*
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator::operator->() const
+{
+	assert(_translator);
+	return _translator;
+}
+
+Capstone2LlvmIrTranslator&
+Capstone2LlvmIrTranslatorPool::CheckedOutTranslator::operator*() const
+{
+	assert(_translator);
+	return *_translator;
+}
+
+} // namespace capstone2llvmir
+} // namespace retdec
@@ -579,10 +579,9 @@ void Capstone2LlvmIrTranslatorX86::translateInstruction(
 //	assert(!xi->avx_sae);
 //	assert(!xi->avx_rm);
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	auto f = i->id < X86_INS_ENDING ? _i2fm.fns[i->id] : nullptr;
+	if (f != nullptr)
 	{
-		auto f = fIt->second;
 //std::cout << std::hex << i->address << " @ " << i->mnemonic << " " << i->op_str << std::endl;
 		(this->*f)(i, xi, irb);
 	}
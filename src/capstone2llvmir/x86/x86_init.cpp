@@ -432,1522 +432,1524 @@ void Capstone2LlvmIrTranslatorX86::initializeRegTypeMap()
 	_reg2type = std::move(r2t);
 }
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorX86::*)(cs_insn* i, cs_x86*, llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorX86::_i2fm =
+constexpr Capstone2LlvmIrTranslatorX86::DispatchTable Capstone2LlvmIrTranslatorX86::makeDispatchTable()
 {
-		{X86_INS_INVALID, nullptr},
+	DispatchTable t = {};
 
-		{X86_INS_AAA, &Capstone2LlvmIrTranslatorX86::translateAaa},
-		{X86_INS_AAD, &Capstone2LlvmIrTranslatorX86::translateAad},
-		{X86_INS_AAM, &Capstone2LlvmIrTranslatorX86::translateAam},
-		{X86_INS_AAS, &Capstone2LlvmIrTranslatorX86::translateAaa},
-		{X86_INS_FABS, &Capstone2LlvmIrTranslatorX86::translateFabs},
-		{X86_INS_ADC, &Capstone2LlvmIrTranslatorX86::translateAdc},
-		{X86_INS_ADCX, &Capstone2LlvmIrTranslatorX86::translateAdc},
-		{X86_INS_ADD, &Capstone2LlvmIrTranslatorX86::translateAdd},
-		{X86_INS_ADDPD, nullptr},
-		{X86_INS_ADDPS, nullptr},
-		{X86_INS_ADDSD, nullptr},
-		{X86_INS_ADDSS, nullptr},
-		{X86_INS_ADDSUBPD, nullptr},
-		{X86_INS_ADDSUBPS, nullptr},
-		{X86_INS_FADD, &Capstone2LlvmIrTranslatorX86::translateFadd},
-		{X86_INS_FIADD, &Capstone2LlvmIrTranslatorX86::translateFadd},
-		{X86_INS_FADDP, &Capstone2LlvmIrTranslatorX86::translateFadd},
-		{X86_INS_ADOX, &Capstone2LlvmIrTranslatorX86::translateAdc},
-		{X86_INS_AESDECLAST, nullptr},
-		{X86_INS_AESDEC, nullptr},
-		{X86_INS_AESENCLAST, nullptr},
-		{X86_INS_AESENC, nullptr},
-		{X86_INS_AESIMC, nullptr},
-		{X86_INS_AESKEYGENASSIST, nullptr},
-		{X86_INS_AND, &Capstone2LlvmIrTranslatorX86::translateAnd},
-		{X86_INS_ANDN, nullptr},
-		{X86_INS_ANDNPD, nullptr},
-		{X86_INS_ANDNPS, nullptr},
-		{X86_INS_ANDPD, nullptr},
-		{X86_INS_ANDPS, nullptr},
-		{X86_INS_ARPL, nullptr},
-		{X86_INS_BEXTR, nullptr},
-		{X86_INS_BLCFILL, nullptr},
-		{X86_INS_BLCI, nullptr},
-		{X86_INS_BLCIC, nullptr},
-		{X86_INS_BLCMSK, nullptr},
-		{X86_INS_BLCS, nullptr},
-		{X86_INS_BLENDPD, nullptr},
-		{X86_INS_BLENDPS, nullptr},
-		{X86_INS_BLENDVPD, nullptr},
-		{X86_INS_BLENDVPS, nullptr},
-		{X86_INS_BLSFILL, nullptr},
-		{X86_INS_BLSI, nullptr},
-		{X86_INS_BLSIC, nullptr},
-		{X86_INS_BLSMSK, nullptr},
-		{X86_INS_BLSR, nullptr},
-		{X86_INS_BOUND, &Capstone2LlvmIrTranslatorX86::translateBound},
-		{X86_INS_BSF, &Capstone2LlvmIrTranslatorX86::translateBsf},
-		{X86_INS_BSR, &Capstone2LlvmIrTranslatorX86::translateBsf},
-		{X86_INS_BSWAP, &Capstone2LlvmIrTranslatorX86::translateBswap},
-		{X86_INS_BT, &Capstone2LlvmIrTranslatorX86::translateBt},
-		{X86_INS_BTC, &Capstone2LlvmIrTranslatorX86::translateBtc},
-		{X86_INS_BTR, &Capstone2LlvmIrTranslatorX86::translateBtr},
-		{X86_INS_BTS, &Capstone2LlvmIrTranslatorX86::translateBts},
-		{X86_INS_BZHI, nullptr},
-		{X86_INS_CALL, &Capstone2LlvmIrTranslatorX86::translateCall},
-		{X86_INS_CBW, &Capstone2LlvmIrTranslatorX86::translateCbw},
-		{X86_INS_CDQ, &Capstone2LlvmIrTranslatorX86::translateCdq},
-		{X86_INS_CDQE, &Capstone2LlvmIrTranslatorX86::translateCdqe},
-		{X86_INS_FCHS, &Capstone2LlvmIrTranslatorX86::translateFchs},
-		{X86_INS_CLAC, nullptr},
-		{X86_INS_CLC, &Capstone2LlvmIrTranslatorX86::translateClc},
-		{X86_INS_CLD, &Capstone2LlvmIrTranslatorX86::translateCld},
-		{X86_INS_CLFLUSH, nullptr},
-		{X86_INS_CLFLUSHOPT, nullptr},
-		{X86_INS_CLGI, nullptr},
-		{X86_INS_CLI, &Capstone2LlvmIrTranslatorX86::translateCli},
-		{X86_INS_CLTS, nullptr},
-		{X86_INS_CLWB, nullptr},
-		{X86_INS_CMC, &Capstone2LlvmIrTranslatorX86::translateCmc},
-		{X86_INS_CMOVA, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVAE, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVB, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVBE, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_FCMOVBE, nullptr},
-		{X86_INS_FCMOVB, nullptr},
-		{X86_INS_CMOVE, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_FCMOVE, nullptr},
-		{X86_INS_CMOVG, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVGE, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVL, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVLE, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_FCMOVNBE, nullptr},
-		{X86_INS_FCMOVNB, nullptr},
-		{X86_INS_CMOVNE, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_FCMOVNE, nullptr},
-		{X86_INS_CMOVNO, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVNP, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_FCMOVNU, nullptr},
-		{X86_INS_CMOVNS, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVO, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMOVP, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_FCMOVU, nullptr},
-		{X86_INS_CMOVS, &Capstone2LlvmIrTranslatorX86::translateCMovCc},
-		{X86_INS_CMP, &Capstone2LlvmIrTranslatorX86::translateSub},
-		{X86_INS_CMPSB, &Capstone2LlvmIrTranslatorX86::translateCompareString},
-		{X86_INS_CMPSQ, &Capstone2LlvmIrTranslatorX86::translateCompareString},
-		{X86_INS_CMPSW, &Capstone2LlvmIrTranslatorX86::translateCompareString},
-		{X86_INS_CMPXCHG16B, &Capstone2LlvmIrTranslatorX86::translateCmpxchg16b},
-		{X86_INS_CMPXCHG, &Capstone2LlvmIrTranslatorX86::translateCmpxchg},
-		{X86_INS_CMPXCHG8B, &Capstone2LlvmIrTranslatorX86::translateCmpxchg8b},
-		{X86_INS_COMISD, nullptr},
-		{X86_INS_COMISS, nullptr},
-		{X86_INS_FCOMP, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FCOMIP, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FCOMI, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FCOM, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FCOS, &Capstone2LlvmIrTranslatorX86::translateFcos},
-		{X86_INS_CPUID, &Capstone2LlvmIrTranslatorX86::translateCpuid},
-		{X86_INS_CQO, &Capstone2LlvmIrTranslatorX86::translateCqo},
-		{X86_INS_CRC32, nullptr},
-		{X86_INS_CVTDQ2PD, nullptr},
-		{X86_INS_CVTDQ2PS, nullptr},
-		{X86_INS_CVTPD2DQ, nullptr},
-		{X86_INS_CVTPD2PS, nullptr},
-		{X86_INS_CVTPS2DQ, nullptr},
-		{X86_INS_CVTPS2PD, nullptr},
-		{X86_INS_CVTSD2SI, nullptr},
-		{X86_INS_CVTSD2SS, nullptr},
-		{X86_INS_CVTSI2SD, nullptr},
-		{X86_INS_CVTSI2SS, nullptr},
-		{X86_INS_CVTSS2SD, nullptr},
-		{X86_INS_CVTSS2SI, nullptr},
-		{X86_INS_CVTTPD2DQ, nullptr},
-		{X86_INS_CVTTPS2DQ, nullptr},
-		{X86_INS_CVTTSD2SI, nullptr},
-		{X86_INS_CVTTSS2SI, nullptr},
-		{X86_INS_CWD, &Capstone2LlvmIrTranslatorX86::translateCwd},
-		{X86_INS_CWDE, &Capstone2LlvmIrTranslatorX86::translateCwde},
-		{X86_INS_DAA, &Capstone2LlvmIrTranslatorX86::translateDaaDas},
-		{X86_INS_DAS, &Capstone2LlvmIrTranslatorX86::translateDaaDas},
-		{X86_INS_DATA16, nullptr},
-		{X86_INS_DEC, &Capstone2LlvmIrTranslatorX86::translateDec},
-		{X86_INS_DIV, &Capstone2LlvmIrTranslatorX86::translateDiv},
-		{X86_INS_DIVPD, nullptr},
-		{X86_INS_DIVPS, nullptr},
-		{X86_INS_FDIVR, &Capstone2LlvmIrTranslatorX86::translateFdivr},
-		{X86_INS_FIDIVR, &Capstone2LlvmIrTranslatorX86::translateFdivr},
-		{X86_INS_FDIVRP, &Capstone2LlvmIrTranslatorX86::translateFdivr},
-		{X86_INS_DIVSD, nullptr},
-		{X86_INS_DIVSS, nullptr},
-		{X86_INS_FDIV, &Capstone2LlvmIrTranslatorX86::translateFdiv},
-		{X86_INS_FIDIV, &Capstone2LlvmIrTranslatorX86::translateFdiv},
-		{X86_INS_FDIVP, &Capstone2LlvmIrTranslatorX86::translateFdiv},
-		{X86_INS_DPPD, nullptr},
-		{X86_INS_DPPS, nullptr},
-		{X86_INS_RET, &Capstone2LlvmIrTranslatorX86::translateRet},
-		{X86_INS_ENCLS, nullptr},
-		{X86_INS_ENCLU, nullptr},
-		{X86_INS_ENTER, &Capstone2LlvmIrTranslatorX86::translateEnter},
-		{X86_INS_EXTRACTPS, nullptr},
-		{X86_INS_EXTRQ, nullptr},
-		{X86_INS_F2XM1, nullptr},
-		{X86_INS_LCALL, &Capstone2LlvmIrTranslatorX86::translateLcall},
-		{X86_INS_LJMP, &Capstone2LlvmIrTranslatorX86::translateLjmp},
-		{X86_INS_FBLD, nullptr},
-		{X86_INS_FBSTP, nullptr},
-		{X86_INS_FCOMPP, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FDECSTP, &Capstone2LlvmIrTranslatorX86::translateFdecstp},
-		{X86_INS_FEMMS, nullptr},
-		{X86_INS_FFREE, nullptr},
-		{X86_INS_FICOM, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FICOMP, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FINCSTP, &Capstone2LlvmIrTranslatorX86::translateFincstp},
-		{X86_INS_FLDCW, &Capstone2LlvmIrTranslatorX86::translateFldcw},
-		{X86_INS_FLDENV, &Capstone2LlvmIrTranslatorX86::translateFldenv},
-		{X86_INS_FLDL2E, &Capstone2LlvmIrTranslatorX86::translateFloadConstant},
-		{X86_INS_FLDL2T, &Capstone2LlvmIrTranslatorX86::translateFloadConstant},
-		{X86_INS_FLDLG2, &Capstone2LlvmIrTranslatorX86::translateFloadConstant},
-		{X86_INS_FLDLN2, &Capstone2LlvmIrTranslatorX86::translateFloadConstant},
-		{X86_INS_FLDPI, &Capstone2LlvmIrTranslatorX86::translateFloadConstant},
-		{X86_INS_FNCLEX, nullptr},
-		{X86_INS_FNINIT, &Capstone2LlvmIrTranslatorX86::translateFninit},
-		{X86_INS_FNOP, &Capstone2LlvmIrTranslatorX86::translateNop},
-		{X86_INS_FNSTCW, &Capstone2LlvmIrTranslatorX86::translateFnstcw},
-		{X86_INS_FNSTSW, &Capstone2LlvmIrTranslatorX86::translateFnstsw},
-		{X86_INS_FPATAN, nullptr},
-		{X86_INS_FPREM, nullptr},
-		{X86_INS_FPREM1, nullptr},
-		{X86_INS_FPTAN, nullptr},
-		{X86_INS_FFREEP, nullptr},
-		{X86_INS_FRNDINT, &Capstone2LlvmIrTranslatorX86::translateFrndint},
-		{X86_INS_FRSTOR, nullptr},
-		{X86_INS_FNSAVE, nullptr},
-		{X86_INS_FSCALE, nullptr},
-		{X86_INS_FSETPM, nullptr},
-		{X86_INS_FSINCOS, &Capstone2LlvmIrTranslatorX86::translateFsincos},
-		{X86_INS_FNSTENV, &Capstone2LlvmIrTranslatorX86::translateFnstenv},
-		{X86_INS_FXAM, &Capstone2LlvmIrTranslatorX86::translateFxam},
-		{X86_INS_FXRSTOR, nullptr},
-		{X86_INS_FXRSTOR64, nullptr},
-		{X86_INS_FXSAVE, nullptr},
-		{X86_INS_FXSAVE64, nullptr},
-		{X86_INS_FXTRACT, nullptr},
-		{X86_INS_FYL2X, nullptr},
-		{X86_INS_FYL2XP1, nullptr},
-		{X86_INS_MOVAPD, nullptr},
-		{X86_INS_MOVAPS, nullptr},
-		{X86_INS_ORPD, nullptr},
-		{X86_INS_ORPS, nullptr},
-		{X86_INS_VMOVAPD, nullptr},
-		{X86_INS_VMOVAPS, nullptr},
-		{X86_INS_XORPD, nullptr},
-		{X86_INS_XORPS, nullptr},
-		{X86_INS_GETSEC, nullptr},
-		{X86_INS_HADDPD, nullptr},
-		{X86_INS_HADDPS, nullptr},
-		{X86_INS_HLT, &Capstone2LlvmIrTranslatorX86::translateHlt},
-		{X86_INS_HSUBPD, nullptr},
-		{X86_INS_HSUBPS, nullptr},
-		{X86_INS_IDIV, &Capstone2LlvmIrTranslatorX86::translateDiv},
-		{X86_INS_FILD, &Capstone2LlvmIrTranslatorX86::translateFld},
-		{X86_INS_IMUL, &Capstone2LlvmIrTranslatorX86::translateImul},
-		{X86_INS_IN, nullptr},
-		{X86_INS_INC, &Capstone2LlvmIrTranslatorX86::translateInc},
-		{X86_INS_INSB, &Capstone2LlvmIrTranslatorX86::translateIns},
-		{X86_INS_INSERTPS, nullptr},
-		{X86_INS_INSERTQ, nullptr},
-		{X86_INS_INSD, &Capstone2LlvmIrTranslatorX86::translateIns},
-		{X86_INS_INSW, &Capstone2LlvmIrTranslatorX86::translateIns},
-		{X86_INS_INT, &Capstone2LlvmIrTranslatorX86::translateInt},
-		{X86_INS_INT1, &Capstone2LlvmIrTranslatorX86::translateInt1},
-		{X86_INS_INT3, &Capstone2LlvmIrTranslatorX86::translateInt3},
-		{X86_INS_INTO, &Capstone2LlvmIrTranslatorX86::translateInto},
-		{X86_INS_INVD, nullptr},
-		{X86_INS_INVEPT, nullptr},
-		{X86_INS_INVLPG, nullptr},
-		{X86_INS_INVLPGA, nullptr},
-		{X86_INS_INVPCID, nullptr},
-		{X86_INS_INVVPID, nullptr},
-		{X86_INS_IRET, nullptr},
-		{X86_INS_IRETD, nullptr},
-		{X86_INS_IRETQ, nullptr},
-		{X86_INS_FISTTP, nullptr},
-		{X86_INS_FIST, &Capstone2LlvmIrTranslatorX86::translateFist},
-		{X86_INS_FISTP, &Capstone2LlvmIrTranslatorX86::translateFist},
-		{X86_INS_UCOMISD, nullptr},
-		{X86_INS_UCOMISS, nullptr},
-		{X86_INS_VCOMISD, nullptr},
-		{X86_INS_VCOMISS, nullptr},
-		{X86_INS_VCVTSD2SS, nullptr},
-		{X86_INS_VCVTSI2SD, nullptr},
-		{X86_INS_VCVTSI2SS, nullptr},
-		{X86_INS_VCVTSS2SD, nullptr},
-		{X86_INS_VCVTTSD2SI, nullptr},
-		{X86_INS_VCVTTSD2USI, nullptr},
-		{X86_INS_VCVTTSS2SI, nullptr},
-		{X86_INS_VCVTTSS2USI, nullptr},
-		{X86_INS_VCVTUSI2SD, nullptr},
-		{X86_INS_VCVTUSI2SS, nullptr},
-		{X86_INS_VUCOMISD, nullptr},
-		{X86_INS_VUCOMISS, nullptr},
-		{X86_INS_JAE, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JA, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JBE, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JB, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JCXZ, &Capstone2LlvmIrTranslatorX86::translateJecxz},
-		{X86_INS_JECXZ, &Capstone2LlvmIrTranslatorX86::translateJecxz},
-		{X86_INS_JE, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JGE, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JG, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JLE, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JL, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JMP, &Capstone2LlvmIrTranslatorX86::translateJmp},
-		{X86_INS_JNE, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JNO, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JNP, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JNS, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JO, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JP, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_JRCXZ, &Capstone2LlvmIrTranslatorX86::translateJecxz},
-		{X86_INS_JS, &Capstone2LlvmIrTranslatorX86::translateJCc},
-		{X86_INS_KANDB, nullptr},
-		{X86_INS_KANDD, nullptr},
-		{X86_INS_KANDNB, nullptr},
-		{X86_INS_KANDND, nullptr},
-		{X86_INS_KANDNQ, nullptr},
-		{X86_INS_KANDNW, nullptr},
-		{X86_INS_KANDQ, nullptr},
-		{X86_INS_KANDW, nullptr},
-		{X86_INS_KMOVB, nullptr},
-		{X86_INS_KMOVD, nullptr},
-		{X86_INS_KMOVQ, nullptr},
-		{X86_INS_KMOVW, nullptr},
-		{X86_INS_KNOTB, nullptr},
-		{X86_INS_KNOTD, nullptr},
-		{X86_INS_KNOTQ, nullptr},
-		{X86_INS_KNOTW, nullptr},
-		{X86_INS_KORB, nullptr},
-		{X86_INS_KORD, nullptr},
-		{X86_INS_KORQ, nullptr},
-		{X86_INS_KORTESTB, nullptr},
-		{X86_INS_KORTESTD, nullptr},
-		{X86_INS_KORTESTQ, nullptr},
-		{X86_INS_KORTESTW, nullptr},
-		{X86_INS_KORW, nullptr},
-		{X86_INS_KSHIFTLB, nullptr},
-		{X86_INS_KSHIFTLD, nullptr},
-		{X86_INS_KSHIFTLQ, nullptr},
-		{X86_INS_KSHIFTLW, nullptr},
-		{X86_INS_KSHIFTRB, nullptr},
-		{X86_INS_KSHIFTRD, nullptr},
-		{X86_INS_KSHIFTRQ, nullptr},
-		{X86_INS_KSHIFTRW, nullptr},
-		{X86_INS_KUNPCKBW, nullptr},
-		{X86_INS_KXNORB, nullptr},
-		{X86_INS_KXNORD, nullptr},
-		{X86_INS_KXNORQ, nullptr},
-		{X86_INS_KXNORW, nullptr},
-		{X86_INS_KXORB, nullptr},
-		{X86_INS_KXORD, nullptr},
-		{X86_INS_KXORQ, nullptr},
-		{X86_INS_KXORW, nullptr},
-		{X86_INS_LAHF, &Capstone2LlvmIrTranslatorX86::translateLahf},
-		{X86_INS_LAR, nullptr},
-		{X86_INS_LDDQU, nullptr},
-		{X86_INS_LDMXCSR, nullptr},
-		{X86_INS_LDS, &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr},
-		{X86_INS_FLDZ, &Capstone2LlvmIrTranslatorX86::translateFloadConstant},
-		{X86_INS_FLD1, &Capstone2LlvmIrTranslatorX86::translateFloadConstant},
-		{X86_INS_FLD, &Capstone2LlvmIrTranslatorX86::translateFld},
-		{X86_INS_LEA, &Capstone2LlvmIrTranslatorX86::translateLea},
-		{X86_INS_LEAVE, &Capstone2LlvmIrTranslatorX86::translateLeave},
-		{X86_INS_LES, &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr},
-		{X86_INS_LFENCE, nullptr},
-		{X86_INS_LFS, &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr},
-		{X86_INS_LGDT, nullptr},
-		{X86_INS_LGS, &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr},
-		{X86_INS_LIDT, nullptr},
-		{X86_INS_LLDT, nullptr},
-		{X86_INS_LMSW, nullptr},
-		{X86_INS_OR, &Capstone2LlvmIrTranslatorX86::translateOr},
-		{X86_INS_SUB, &Capstone2LlvmIrTranslatorX86::translateSub},
-		{X86_INS_XOR, &Capstone2LlvmIrTranslatorX86::translateXor},
-		{X86_INS_LODSB, &Capstone2LlvmIrTranslatorX86::translateLoadString},
-		{X86_INS_LODSD, &Capstone2LlvmIrTranslatorX86::translateLoadString},
-		{X86_INS_LODSQ, &Capstone2LlvmIrTranslatorX86::translateLoadString},
-		{X86_INS_LODSW, &Capstone2LlvmIrTranslatorX86::translateLoadString},
-		{X86_INS_LOOP, &Capstone2LlvmIrTranslatorX86::translateLoop},
-		{X86_INS_LOOPE, &Capstone2LlvmIrTranslatorX86::translateLoop},
-		{X86_INS_LOOPNE, &Capstone2LlvmIrTranslatorX86::translateLoop},
-		{X86_INS_RETF, &Capstone2LlvmIrTranslatorX86::translateRet},
-		{X86_INS_RETFQ, &Capstone2LlvmIrTranslatorX86::translateRet},
-		{X86_INS_LSL, nullptr},
-		{X86_INS_LSS, &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr},
-		{X86_INS_LTR, nullptr},
-		{X86_INS_XADD, &Capstone2LlvmIrTranslatorX86::translateAdd},
-		{X86_INS_LZCNT, nullptr},
-		{X86_INS_MASKMOVDQU, nullptr},
-		{X86_INS_MAXPD, nullptr},
-		{X86_INS_MAXPS, nullptr},
-		{X86_INS_MAXSD, nullptr},
-		{X86_INS_MAXSS, nullptr},
-		{X86_INS_MFENCE, nullptr},
-		{X86_INS_MINPD, nullptr},
-		{X86_INS_MINPS, nullptr},
-		{X86_INS_MINSD, nullptr},
-		{X86_INS_MINSS, nullptr},
-		{X86_INS_CVTPD2PI, nullptr},
-		{X86_INS_CVTPI2PD, nullptr},
-		{X86_INS_CVTPI2PS, nullptr},
-		{X86_INS_CVTPS2PI, nullptr},
-		{X86_INS_CVTTPD2PI, nullptr},
-		{X86_INS_CVTTPS2PI, nullptr},
-		{X86_INS_EMMS, nullptr},
-		{X86_INS_MASKMOVQ, nullptr},
-		{X86_INS_MOVD, nullptr},
-		{X86_INS_MOVDQ2Q, nullptr},
-		{X86_INS_MOVNTQ, nullptr},
-		{X86_INS_MOVQ2DQ, nullptr},
-		{X86_INS_MOVQ, nullptr},
-		{X86_INS_PABSB, nullptr},
-		{X86_INS_PABSD, nullptr},
-		{X86_INS_PABSW, nullptr},
-		{X86_INS_PACKSSDW, nullptr},
-		{X86_INS_PACKSSWB, nullptr},
-		{X86_INS_PACKUSWB, nullptr},
-		{X86_INS_PADDB, nullptr},
-		{X86_INS_PADDD, nullptr},
-		{X86_INS_PADDQ, nullptr},
-		{X86_INS_PADDSB, nullptr},
-		{X86_INS_PADDSW, nullptr},
-		{X86_INS_PADDUSB, nullptr},
-		{X86_INS_PADDUSW, nullptr},
-		{X86_INS_PADDW, nullptr},
-		{X86_INS_PALIGNR, nullptr},
-		{X86_INS_PANDN, nullptr},
-		{X86_INS_PAND, nullptr},
-		{X86_INS_PAVGB, nullptr},
-		{X86_INS_PAVGW, nullptr},
-		{X86_INS_PCMPEQB, nullptr},
-		{X86_INS_PCMPEQD, nullptr},
-		{X86_INS_PCMPEQW, nullptr},
-		{X86_INS_PCMPGTB, nullptr},
-		{X86_INS_PCMPGTD, nullptr},
-		{X86_INS_PCMPGTW, nullptr},
-		{X86_INS_PEXTRW, nullptr},
-		{X86_INS_PHADDSW, nullptr},
-		{X86_INS_PHADDW, nullptr},
-		{X86_INS_PHADDD, nullptr},
-		{X86_INS_PHSUBD, nullptr},
-		{X86_INS_PHSUBSW, nullptr},
-		{X86_INS_PHSUBW, nullptr},
-		{X86_INS_PINSRW, nullptr},
-		{X86_INS_PMADDUBSW, nullptr},
-		{X86_INS_PMADDWD, nullptr},
-		{X86_INS_PMAXSW, nullptr},
-		{X86_INS_PMAXUB, nullptr},
-		{X86_INS_PMINSW, nullptr},
-		{X86_INS_PMINUB, nullptr},
-		{X86_INS_PMOVMSKB, nullptr},
-		{X86_INS_PMULHRSW, nullptr},
-		{X86_INS_PMULHUW, nullptr},
-		{X86_INS_PMULHW, nullptr},
-		{X86_INS_PMULLW, nullptr},
-		{X86_INS_PMULUDQ, nullptr},
-		{X86_INS_POR, nullptr},
-		{X86_INS_PSADBW, nullptr},
-		{X86_INS_PSHUFB, nullptr},
-		{X86_INS_PSHUFW, nullptr},
-		{X86_INS_PSIGNB, nullptr},
-		{X86_INS_PSIGND, nullptr},
-		{X86_INS_PSIGNW, nullptr},
-		{X86_INS_PSLLD, nullptr},
-		{X86_INS_PSLLQ, nullptr},
-		{X86_INS_PSLLW, nullptr},
-		{X86_INS_PSRAD, nullptr},
-		{X86_INS_PSRAW, nullptr},
-		{X86_INS_PSRLD, nullptr},
-		{X86_INS_PSRLQ, nullptr},
-		{X86_INS_PSRLW, nullptr},
-		{X86_INS_PSUBB, nullptr},
-		{X86_INS_PSUBD, nullptr},
-		{X86_INS_PSUBQ, nullptr},
-		{X86_INS_PSUBSB, nullptr},
-		{X86_INS_PSUBSW, nullptr},
-		{X86_INS_PSUBUSB, nullptr},
-		{X86_INS_PSUBUSW, nullptr},
-		{X86_INS_PSUBW, nullptr},
-		{X86_INS_PUNPCKHBW, nullptr},
-		{X86_INS_PUNPCKHDQ, nullptr},
-		{X86_INS_PUNPCKHWD, nullptr},
-		{X86_INS_PUNPCKLBW, nullptr},
-		{X86_INS_PUNPCKLDQ, nullptr},
-		{X86_INS_PUNPCKLWD, nullptr},
-		{X86_INS_PXOR, nullptr},
-		{X86_INS_MONITOR, nullptr},
-		{X86_INS_MONTMUL, nullptr},
-		{X86_INS_MOV, &Capstone2LlvmIrTranslatorX86::translateMov},
-		{X86_INS_MOVABS, &Capstone2LlvmIrTranslatorX86::translateMov},
-		{X86_INS_MOVBE, nullptr},
-		{X86_INS_MOVDDUP, nullptr},
-		{X86_INS_MOVDQA, nullptr},
-		{X86_INS_MOVDQU, nullptr},
-		{X86_INS_MOVHLPS, nullptr},
-		{X86_INS_MOVHPD, nullptr},
-		{X86_INS_MOVHPS, nullptr},
-		{X86_INS_MOVLHPS, nullptr},
-		{X86_INS_MOVLPD, nullptr},
-		{X86_INS_MOVLPS, nullptr},
-		{X86_INS_MOVMSKPD, nullptr},
-		{X86_INS_MOVMSKPS, nullptr},
-		{X86_INS_MOVNTDQA, nullptr},
-		{X86_INS_MOVNTDQ, nullptr},
-		{X86_INS_MOVNTI, nullptr},
-		{X86_INS_MOVNTPD, nullptr},
-		{X86_INS_MOVNTPS, nullptr},
-		{X86_INS_MOVNTSD, nullptr},
-		{X86_INS_MOVNTSS, nullptr},
-		{X86_INS_MOVSB, &Capstone2LlvmIrTranslatorX86::translateMoveString},
-		{X86_INS_MOVSD, &Capstone2LlvmIrTranslatorX86::translateMoveString},
-		{X86_INS_MOVSHDUP, nullptr},
-		{X86_INS_MOVSLDUP, nullptr},
-		{X86_INS_MOVSQ, &Capstone2LlvmIrTranslatorX86::translateMoveString},
-		{X86_INS_MOVSS, nullptr},
-		{X86_INS_MOVSW, &Capstone2LlvmIrTranslatorX86::translateMoveString},
-		{X86_INS_MOVSX, &Capstone2LlvmIrTranslatorX86::translateMov},
-		{X86_INS_MOVSXD, &Capstone2LlvmIrTranslatorX86::translateMov},
-		{X86_INS_MOVUPD, nullptr},
-		{X86_INS_MOVUPS, nullptr},
-		{X86_INS_MOVZX, &Capstone2LlvmIrTranslatorX86::translateMov},
-		{X86_INS_MPSADBW, nullptr},
-		{X86_INS_MUL, &Capstone2LlvmIrTranslatorX86::translateMul},
-		{X86_INS_MULPD, nullptr},
-		{X86_INS_MULPS, nullptr},
-		{X86_INS_MULSD, nullptr},
-		{X86_INS_MULSS, nullptr},
-		{X86_INS_MULX, nullptr},
-		{X86_INS_FMUL, &Capstone2LlvmIrTranslatorX86::translateFmul},
-		{X86_INS_FIMUL, &Capstone2LlvmIrTranslatorX86::translateFmul},
-		{X86_INS_FMULP, &Capstone2LlvmIrTranslatorX86::translateFmul},
-		{X86_INS_MWAIT, nullptr},
-		{X86_INS_NEG, &Capstone2LlvmIrTranslatorX86::translateNeg},
-		{X86_INS_NOP, &Capstone2LlvmIrTranslatorX86::translateNop},
-		{X86_INS_NOT, &Capstone2LlvmIrTranslatorX86::translateNot},
-		{X86_INS_OUT, nullptr},
-		{X86_INS_OUTSB, &Capstone2LlvmIrTranslatorX86::translateOuts},
-		{X86_INS_OUTSD, &Capstone2LlvmIrTranslatorX86::translateOuts},
-		{X86_INS_OUTSW, &Capstone2LlvmIrTranslatorX86::translateOuts},
-		{X86_INS_PACKUSDW, nullptr},
-		{X86_INS_PAUSE, nullptr},
-		{X86_INS_PAVGUSB, nullptr},
-		{X86_INS_PBLENDVB, nullptr},
-		{X86_INS_PBLENDW, nullptr},
-		{X86_INS_PCLMULQDQ, nullptr},
-		{X86_INS_PCMPEQQ, nullptr},
-		{X86_INS_PCMPESTRI, nullptr},
-		{X86_INS_PCMPESTRM, nullptr},
-		{X86_INS_PCMPGTQ, nullptr},
-		{X86_INS_PCMPISTRI, nullptr},
-		{X86_INS_PCMPISTRM, nullptr},
-		{X86_INS_PCOMMIT, nullptr},
-		{X86_INS_PDEP, nullptr},
-		{X86_INS_PEXT, nullptr},
-		{X86_INS_PEXTRB, nullptr},
-		{X86_INS_PEXTRD, nullptr},
-		{X86_INS_PEXTRQ, nullptr},
-		{X86_INS_PF2ID, nullptr},
-		{X86_INS_PF2IW, nullptr},
-		{X86_INS_PFACC, nullptr},
-		{X86_INS_PFADD, nullptr},
-		{X86_INS_PFCMPEQ, nullptr},
-		{X86_INS_PFCMPGE, nullptr},
-		{X86_INS_PFCMPGT, nullptr},
-		{X86_INS_PFMAX, nullptr},
-		{X86_INS_PFMIN, nullptr},
-		{X86_INS_PFMUL, nullptr},
-		{X86_INS_PFNACC, nullptr},
-		{X86_INS_PFPNACC, nullptr},
-		{X86_INS_PFRCPIT1, nullptr},
-		{X86_INS_PFRCPIT2, nullptr},
-		{X86_INS_PFRCP, nullptr},
-		{X86_INS_PFRSQIT1, nullptr},
-		{X86_INS_PFRSQRT, nullptr},
-		{X86_INS_PFSUBR, nullptr},
-		{X86_INS_PFSUB, nullptr},
-		{X86_INS_PHMINPOSUW, nullptr},
-		{X86_INS_PI2FD, nullptr},
-		{X86_INS_PI2FW, nullptr},
-		{X86_INS_PINSRB, nullptr},
-		{X86_INS_PINSRD, nullptr},
-		{X86_INS_PINSRQ, nullptr},
-		{X86_INS_PMAXSB, nullptr},
-		{X86_INS_PMAXSD, nullptr},
-		{X86_INS_PMAXUD, nullptr},
-		{X86_INS_PMAXUW, nullptr},
-		{X86_INS_PMINSB, nullptr},
-		{X86_INS_PMINSD, nullptr},
-		{X86_INS_PMINUD, nullptr},
-		{X86_INS_PMINUW, nullptr},
-		{X86_INS_PMOVSXBD, nullptr},
-		{X86_INS_PMOVSXBQ, nullptr},
-		{X86_INS_PMOVSXBW, nullptr},
-		{X86_INS_PMOVSXDQ, nullptr},
-		{X86_INS_PMOVSXWD, nullptr},
-		{X86_INS_PMOVSXWQ, nullptr},
-		{X86_INS_PMOVZXBD, nullptr},
-		{X86_INS_PMOVZXBQ, nullptr},
-		{X86_INS_PMOVZXBW, nullptr},
-		{X86_INS_PMOVZXDQ, nullptr},
-		{X86_INS_PMOVZXWD, nullptr},
-		{X86_INS_PMOVZXWQ, nullptr},
-		{X86_INS_PMULDQ, nullptr},
-		{X86_INS_PMULHRW, nullptr},
-		{X86_INS_PMULLD, nullptr},
-		{X86_INS_POP, &Capstone2LlvmIrTranslatorX86::translatePop},
-		{X86_INS_POPAW, &Capstone2LlvmIrTranslatorX86::translatePopa}, // X86_INS_POPAW == POPA
-		{X86_INS_POPAL, &Capstone2LlvmIrTranslatorX86::translatePopa}, // X86_INS_POPAL == POPAD
-		{X86_INS_POPCNT, nullptr},
-		{X86_INS_POPF, &Capstone2LlvmIrTranslatorX86::translatePopEflags},
-		{X86_INS_POPFD, &Capstone2LlvmIrTranslatorX86::translatePopEflags},
-		{X86_INS_POPFQ, &Capstone2LlvmIrTranslatorX86::translatePopEflags},
-		{X86_INS_PREFETCH, nullptr},
-		{X86_INS_PREFETCHNTA, nullptr},
-		{X86_INS_PREFETCHT0, nullptr},
-		{X86_INS_PREFETCHT1, nullptr},
-		{X86_INS_PREFETCHT2, nullptr},
-		{X86_INS_PREFETCHW, nullptr},
-		{X86_INS_PSHUFD, nullptr},
-		{X86_INS_PSHUFHW, nullptr},
-		{X86_INS_PSHUFLW, nullptr},
-		{X86_INS_PSLLDQ, nullptr},
-		{X86_INS_PSRLDQ, nullptr},
-		{X86_INS_PSWAPD, nullptr},
-		{X86_INS_PTEST, nullptr},
-		{X86_INS_PUNPCKHQDQ, nullptr},
-		{X86_INS_PUNPCKLQDQ, nullptr},
-		{X86_INS_PUSH, &Capstone2LlvmIrTranslatorX86::translatePush},
-		{X86_INS_PUSHAW, &Capstone2LlvmIrTranslatorX86::translatePusha}, // X86_INS_PUSHAW = PUSHA
-		{X86_INS_PUSHAL, &Capstone2LlvmIrTranslatorX86::translatePusha}, // X86_INS_PUSHAL = PUSHAD
-		{X86_INS_PUSHF, &Capstone2LlvmIrTranslatorX86::translatePushEflags},
-		{X86_INS_PUSHFD, &Capstone2LlvmIrTranslatorX86::translatePushEflags},
-		{X86_INS_PUSHFQ, &Capstone2LlvmIrTranslatorX86::translatePushEflags},
-		{X86_INS_RCL, &Capstone2LlvmIrTranslatorX86::translateRcl},
-		{X86_INS_RCPPS, nullptr},
-		{X86_INS_RCPSS, nullptr},
-		{X86_INS_RCR, &Capstone2LlvmIrTranslatorX86::translateRcr},
-		{X86_INS_RDFSBASE, nullptr},
-		{X86_INS_RDGSBASE, nullptr},
-		{X86_INS_RDMSR, nullptr},
-		{X86_INS_RDPMC, nullptr},
-		{X86_INS_RDRAND, nullptr},
-		{X86_INS_RDSEED, nullptr},
-		{X86_INS_RDTSC, &Capstone2LlvmIrTranslatorX86::translateRdtsc},
-		{X86_INS_RDTSCP, &Capstone2LlvmIrTranslatorX86::translateRdtscp},
-		{X86_INS_ROL, &Capstone2LlvmIrTranslatorX86::translateRol},
-		{X86_INS_ROR, &Capstone2LlvmIrTranslatorX86::translateRor},
-		{X86_INS_RORX, nullptr},
-		{X86_INS_ROUNDPD, nullptr},
-		{X86_INS_ROUNDPS, nullptr},
-		{X86_INS_ROUNDSD, nullptr},
-		{X86_INS_ROUNDSS, nullptr},
-		{X86_INS_RSM, nullptr},
-		{X86_INS_RSQRTPS, nullptr},
-		{X86_INS_RSQRTSS, nullptr},
-		{X86_INS_SAHF, &Capstone2LlvmIrTranslatorX86::translateSahf},
-		{X86_INS_SAL, &Capstone2LlvmIrTranslatorX86::translateShiftLeft},
-		{X86_INS_SALC, &Capstone2LlvmIrTranslatorX86::translateSalc},
-		{X86_INS_SAR, &Capstone2LlvmIrTranslatorX86::translateShiftRight},
-		{X86_INS_SARX, nullptr},
-		{X86_INS_SBB, &Capstone2LlvmIrTranslatorX86::translateSbb},
-		{X86_INS_SCASB, &Capstone2LlvmIrTranslatorX86::translateScanString},
-		{X86_INS_SCASD, &Capstone2LlvmIrTranslatorX86::translateScanString},
-		{X86_INS_SCASQ, &Capstone2LlvmIrTranslatorX86::translateScanString},
-		{X86_INS_SCASW, &Capstone2LlvmIrTranslatorX86::translateScanString},
-		{X86_INS_SETAE, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETA, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETBE, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETB, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETE, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETGE, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETG, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETLE, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETL, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETNE, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETNO, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETNP, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETNS, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETO, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETP, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SETS, &Capstone2LlvmIrTranslatorX86::translateSetCc},
-		{X86_INS_SFENCE, nullptr},
-		{X86_INS_SGDT, nullptr},
-		{X86_INS_SHA1MSG1, nullptr},
-		{X86_INS_SHA1MSG2, nullptr},
-		{X86_INS_SHA1NEXTE, nullptr},
-		{X86_INS_SHA1RNDS4, nullptr},
-		{X86_INS_SHA256MSG1, nullptr},
-		{X86_INS_SHA256MSG2, nullptr},
-		{X86_INS_SHA256RNDS2, nullptr},
-		{X86_INS_SHL, &Capstone2LlvmIrTranslatorX86::translateShiftLeft},
-		{X86_INS_SHLD, &Capstone2LlvmIrTranslatorX86::translateShld},
-		{X86_INS_SHLX, nullptr},
-		{X86_INS_SHR, &Capstone2LlvmIrTranslatorX86::translateShiftRight},
-		{X86_INS_SHRD, &Capstone2LlvmIrTranslatorX86::translateShrd},
-		{X86_INS_SHRX, nullptr},
-		{X86_INS_SHUFPD, nullptr},
-		{X86_INS_SHUFPS, nullptr},
-		{X86_INS_SIDT, nullptr},
-		{X86_INS_FSIN, &Capstone2LlvmIrTranslatorX86::translateFsin},
-		{X86_INS_SKINIT, nullptr},
-		{X86_INS_SLDT, nullptr},
-		{X86_INS_SMSW, nullptr},
-		{X86_INS_SQRTPD, nullptr},
-		{X86_INS_SQRTPS, nullptr},
-		{X86_INS_SQRTSD, nullptr},
-		{X86_INS_SQRTSS, nullptr},
-		{X86_INS_FSQRT, &Capstone2LlvmIrTranslatorX86::translateFsqrt},
-		{X86_INS_STAC, nullptr},
-		{X86_INS_STC, &Capstone2LlvmIrTranslatorX86::translateStc},
-		{X86_INS_STD, &Capstone2LlvmIrTranslatorX86::translateStd},
-		{X86_INS_STGI, nullptr},
-		{X86_INS_STI, nullptr},
-		{X86_INS_STMXCSR, nullptr},
-		{X86_INS_STOSB, &Capstone2LlvmIrTranslatorX86::translateStoreString},
-		{X86_INS_STOSD, &Capstone2LlvmIrTranslatorX86::translateStoreString},
-		{X86_INS_STOSQ, &Capstone2LlvmIrTranslatorX86::translateStoreString},
-		{X86_INS_STOSW, &Capstone2LlvmIrTranslatorX86::translateStoreString},
-		{X86_INS_STR, nullptr},
-		{X86_INS_FST, &Capstone2LlvmIrTranslatorX86::translateFst},
-		{X86_INS_FSTP, &Capstone2LlvmIrTranslatorX86::translateFst},
-		{X86_INS_FSTPNCE, nullptr},
-		{X86_INS_FXCH, &Capstone2LlvmIrTranslatorX86::translateFxch},
-		{X86_INS_SUBPD, nullptr},
-		{X86_INS_SUBPS, nullptr},
-		{X86_INS_FSUBR, &Capstone2LlvmIrTranslatorX86::translateFsubr},
-		{X86_INS_FISUBR, &Capstone2LlvmIrTranslatorX86::translateFsubr},
-		{X86_INS_FSUBRP, &Capstone2LlvmIrTranslatorX86::translateFsubr},
-		{X86_INS_SUBSD, nullptr},
-		{X86_INS_SUBSS, nullptr},
-		{X86_INS_FSUB, &Capstone2LlvmIrTranslatorX86::translateFsub},
-		{X86_INS_FISUB, &Capstone2LlvmIrTranslatorX86::translateFsub},
-		{X86_INS_FSUBP, &Capstone2LlvmIrTranslatorX86::translateFsub},
-		{X86_INS_SWAPGS, nullptr},
-		{X86_INS_SYSCALL, nullptr},
-		{X86_INS_SYSENTER, nullptr},
-		{X86_INS_SYSEXIT, nullptr},
-		{X86_INS_SYSRET, nullptr},
-		{X86_INS_T1MSKC, nullptr},
-		{X86_INS_TEST, &Capstone2LlvmIrTranslatorX86::translateAnd},
-		{X86_INS_UD2, &Capstone2LlvmIrTranslatorX86::translateNop},
-		{X86_INS_FTST, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_TZCNT, nullptr},
-		{X86_INS_TZMSK, nullptr},
-		{X86_INS_FUCOMIP, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FUCOMI, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FUCOMPP, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FUCOMP, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_FUCOM, &Capstone2LlvmIrTranslatorX86::translateFucomPop},
-		{X86_INS_UD2B, &Capstone2LlvmIrTranslatorX86::translateNop},
-		{X86_INS_UNPCKHPD, nullptr},
-		{X86_INS_UNPCKHPS, nullptr},
-		{X86_INS_UNPCKLPD, nullptr},
-		{X86_INS_UNPCKLPS, nullptr},
-		{X86_INS_VADDPD, nullptr},
-		{X86_INS_VADDPS, nullptr},
-		{X86_INS_VADDSD, nullptr},
-		{X86_INS_VADDSS, nullptr},
-		{X86_INS_VADDSUBPD, nullptr},
-		{X86_INS_VADDSUBPS, nullptr},
-		{X86_INS_VAESDECLAST, nullptr},
-		{X86_INS_VAESDEC, nullptr},
-		{X86_INS_VAESENCLAST, nullptr},
-		{X86_INS_VAESENC, nullptr},
-		{X86_INS_VAESIMC, nullptr},
-		{X86_INS_VAESKEYGENASSIST, nullptr},
-		{X86_INS_VALIGND, nullptr},
-		{X86_INS_VALIGNQ, nullptr},
-		{X86_INS_VANDNPD, nullptr},
-		{X86_INS_VANDNPS, nullptr},
-		{X86_INS_VANDPD, nullptr},
-		{X86_INS_VANDPS, nullptr},
-		{X86_INS_VBLENDMPD, nullptr},
-		{X86_INS_VBLENDMPS, nullptr},
-		{X86_INS_VBLENDPD, nullptr},
-		{X86_INS_VBLENDPS, nullptr},
-		{X86_INS_VBLENDVPD, nullptr},
-		{X86_INS_VBLENDVPS, nullptr},
-		{X86_INS_VBROADCASTF128, nullptr},
-		{X86_INS_VBROADCASTI32X4, nullptr},
-		{X86_INS_VBROADCASTI64X4, nullptr},
-		{X86_INS_VBROADCASTSD, nullptr},
-		{X86_INS_VBROADCASTSS, nullptr},
-		{X86_INS_VCOMPRESSPD, nullptr},
-		{X86_INS_VCOMPRESSPS, nullptr},
-		{X86_INS_VCVTDQ2PD, nullptr},
-		{X86_INS_VCVTDQ2PS, nullptr},
-		{X86_INS_VCVTPD2DQX, nullptr},
-		{X86_INS_VCVTPD2DQ, nullptr},
-		{X86_INS_VCVTPD2PSX, nullptr},
-		{X86_INS_VCVTPD2PS, nullptr},
-		{X86_INS_VCVTPD2UDQ, nullptr},
-		{X86_INS_VCVTPH2PS, nullptr},
-		{X86_INS_VCVTPS2DQ, nullptr},
-		{X86_INS_VCVTPS2PD, nullptr},
-		{X86_INS_VCVTPS2PH, nullptr},
-		{X86_INS_VCVTPS2UDQ, nullptr},
-		{X86_INS_VCVTSD2SI, nullptr},
-		{X86_INS_VCVTSD2USI, nullptr},
-		{X86_INS_VCVTSS2SI, nullptr},
-		{X86_INS_VCVTSS2USI, nullptr},
-		{X86_INS_VCVTTPD2DQX, nullptr},
-		{X86_INS_VCVTTPD2DQ, nullptr},
-		{X86_INS_VCVTTPD2UDQ, nullptr},
-		{X86_INS_VCVTTPS2DQ, nullptr},
-		{X86_INS_VCVTTPS2UDQ, nullptr},
-		{X86_INS_VCVTUDQ2PD, nullptr},
-		{X86_INS_VCVTUDQ2PS, nullptr},
-		{X86_INS_VDIVPD, nullptr},
-		{X86_INS_VDIVPS, nullptr},
-		{X86_INS_VDIVSD, nullptr},
-		{X86_INS_VDIVSS, nullptr},
-		{X86_INS_VDPPD, nullptr},
-		{X86_INS_VDPPS, nullptr},
-		{X86_INS_VERR, nullptr},
-		{X86_INS_VERW, nullptr},
-		{X86_INS_VEXP2PD, nullptr},
-		{X86_INS_VEXP2PS, nullptr},
-		{X86_INS_VEXPANDPD, nullptr},
-		{X86_INS_VEXPANDPS, nullptr},
-		{X86_INS_VEXTRACTF128, nullptr},
-		{X86_INS_VEXTRACTF32X4, nullptr},
-		{X86_INS_VEXTRACTF64X4, nullptr},
-		{X86_INS_VEXTRACTI128, nullptr},
-		{X86_INS_VEXTRACTI32X4, nullptr},
-		{X86_INS_VEXTRACTI64X4, nullptr},
-		{X86_INS_VEXTRACTPS, nullptr},
-		{X86_INS_VFMADD132PD, nullptr},
-		{X86_INS_VFMADD132PS, nullptr},
-		{X86_INS_VFMADDPD, nullptr},
-		{X86_INS_VFMADD213PD, nullptr},
-		{X86_INS_VFMADD231PD, nullptr},
-		{X86_INS_VFMADDPS, nullptr},
-		{X86_INS_VFMADD213PS, nullptr},
-		{X86_INS_VFMADD231PS, nullptr},
-		{X86_INS_VFMADDSD, nullptr},
-		{X86_INS_VFMADD213SD, nullptr},
-		{X86_INS_VFMADD132SD, nullptr},
-		{X86_INS_VFMADD231SD, nullptr},
-		{X86_INS_VFMADDSS, nullptr},
-		{X86_INS_VFMADD213SS, nullptr},
-		{X86_INS_VFMADD132SS, nullptr},
-		{X86_INS_VFMADD231SS, nullptr},
-		{X86_INS_VFMADDSUB132PD, nullptr},
-		{X86_INS_VFMADDSUB132PS, nullptr},
-		{X86_INS_VFMADDSUBPD, nullptr},
-		{X86_INS_VFMADDSUB213PD, nullptr},
-		{X86_INS_VFMADDSUB231PD, nullptr},
-		{X86_INS_VFMADDSUBPS, nullptr},
-		{X86_INS_VFMADDSUB213PS, nullptr},
-		{X86_INS_VFMADDSUB231PS, nullptr},
-		{X86_INS_VFMSUB132PD, nullptr},
-		{X86_INS_VFMSUB132PS, nullptr},
-		{X86_INS_VFMSUBADD132PD, nullptr},
-		{X86_INS_VFMSUBADD132PS, nullptr},
-		{X86_INS_VFMSUBADDPD, nullptr},
-		{X86_INS_VFMSUBADD213PD, nullptr},
-		{X86_INS_VFMSUBADD231PD, nullptr},
-		{X86_INS_VFMSUBADDPS, nullptr},
-		{X86_INS_VFMSUBADD213PS, nullptr},
-		{X86_INS_VFMSUBADD231PS, nullptr},
-		{X86_INS_VFMSUBPD, nullptr},
-		{X86_INS_VFMSUB213PD, nullptr},
-		{X86_INS_VFMSUB231PD, nullptr},
-		{X86_INS_VFMSUBPS, nullptr},
-		{X86_INS_VFMSUB213PS, nullptr},
-		{X86_INS_VFMSUB231PS, nullptr},
-		{X86_INS_VFMSUBSD, nullptr},
-		{X86_INS_VFMSUB213SD, nullptr},
-		{X86_INS_VFMSUB132SD, nullptr},
-		{X86_INS_VFMSUB231SD, nullptr},
-		{X86_INS_VFMSUBSS, nullptr},
-		{X86_INS_VFMSUB213SS, nullptr},
-		{X86_INS_VFMSUB132SS, nullptr},
-		{X86_INS_VFMSUB231SS, nullptr},
-		{X86_INS_VFNMADD132PD, nullptr},
-		{X86_INS_VFNMADD132PS, nullptr},
-		{X86_INS_VFNMADDPD, nullptr},
-		{X86_INS_VFNMADD213PD, nullptr},
-		{X86_INS_VFNMADD231PD, nullptr},
-		{X86_INS_VFNMADDPS, nullptr},
-		{X86_INS_VFNMADD213PS, nullptr},
-		{X86_INS_VFNMADD231PS, nullptr},
-		{X86_INS_VFNMADDSD, nullptr},
-		{X86_INS_VFNMADD213SD, nullptr},
-		{X86_INS_VFNMADD132SD, nullptr},
-		{X86_INS_VFNMADD231SD, nullptr},
-		{X86_INS_VFNMADDSS, nullptr},
-		{X86_INS_VFNMADD213SS, nullptr},
-		{X86_INS_VFNMADD132SS, nullptr},
-		{X86_INS_VFNMADD231SS, nullptr},
-		{X86_INS_VFNMSUB132PD, nullptr},
-		{X86_INS_VFNMSUB132PS, nullptr},
-		{X86_INS_VFNMSUBPD, nullptr},
-		{X86_INS_VFNMSUB213PD, nullptr},
-		{X86_INS_VFNMSUB231PD, nullptr},
-		{X86_INS_VFNMSUBPS, nullptr},
-		{X86_INS_VFNMSUB213PS, nullptr},
-		{X86_INS_VFNMSUB231PS, nullptr},
-		{X86_INS_VFNMSUBSD, nullptr},
-		{X86_INS_VFNMSUB213SD, nullptr},
-		{X86_INS_VFNMSUB132SD, nullptr},
-		{X86_INS_VFNMSUB231SD, nullptr},
-		{X86_INS_VFNMSUBSS, nullptr},
-		{X86_INS_VFNMSUB213SS, nullptr},
-		{X86_INS_VFNMSUB132SS, nullptr},
-		{X86_INS_VFNMSUB231SS, nullptr},
-		{X86_INS_VFRCZPD, nullptr},
-		{X86_INS_VFRCZPS, nullptr},
-		{X86_INS_VFRCZSD, nullptr},
-		{X86_INS_VFRCZSS, nullptr},
-		{X86_INS_VORPD, nullptr},
-		{X86_INS_VORPS, nullptr},
-		{X86_INS_VXORPD, nullptr},
-		{X86_INS_VXORPS, nullptr},
-		{X86_INS_VGATHERDPD, nullptr},
-		{X86_INS_VGATHERDPS, nullptr},
-		{X86_INS_VGATHERPF0DPD, nullptr},
-		{X86_INS_VGATHERPF0DPS, nullptr},
-		{X86_INS_VGATHERPF0QPD, nullptr},
-		{X86_INS_VGATHERPF0QPS, nullptr},
-		{X86_INS_VGATHERPF1DPD, nullptr},
-		{X86_INS_VGATHERPF1DPS, nullptr},
-		{X86_INS_VGATHERPF1QPD, nullptr},
-		{X86_INS_VGATHERPF1QPS, nullptr},
-		{X86_INS_VGATHERQPD, nullptr},
-		{X86_INS_VGATHERQPS, nullptr},
-		{X86_INS_VHADDPD, nullptr},
-		{X86_INS_VHADDPS, nullptr},
-		{X86_INS_VHSUBPD, nullptr},
-		{X86_INS_VHSUBPS, nullptr},
-		{X86_INS_VINSERTF128, nullptr},
-		{X86_INS_VINSERTF32X4, nullptr},
-		{X86_INS_VINSERTF32X8, nullptr},
-		{X86_INS_VINSERTF64X2, nullptr},
-		{X86_INS_VINSERTF64X4, nullptr},
-		{X86_INS_VINSERTI128, nullptr},
-		{X86_INS_VINSERTI32X4, nullptr},
-		{X86_INS_VINSERTI32X8, nullptr},
-		{X86_INS_VINSERTI64X2, nullptr},
-		{X86_INS_VINSERTI64X4, nullptr},
-		{X86_INS_VINSERTPS, nullptr},
-		{X86_INS_VLDDQU, nullptr},
-		{X86_INS_VLDMXCSR, nullptr},
-		{X86_INS_VMASKMOVDQU, nullptr},
-		{X86_INS_VMASKMOVPD, nullptr},
-		{X86_INS_VMASKMOVPS, nullptr},
-		{X86_INS_VMAXPD, nullptr},
-		{X86_INS_VMAXPS, nullptr},
-		{X86_INS_VMAXSD, nullptr},
-		{X86_INS_VMAXSS, nullptr},
-		{X86_INS_VMCALL, nullptr},
-		{X86_INS_VMCLEAR, nullptr},
-		{X86_INS_VMFUNC, nullptr},
-		{X86_INS_VMINPD, nullptr},
-		{X86_INS_VMINPS, nullptr},
-		{X86_INS_VMINSD, nullptr},
-		{X86_INS_VMINSS, nullptr},
-		{X86_INS_VMLAUNCH, nullptr},
-		{X86_INS_VMLOAD, nullptr},
-		{X86_INS_VMMCALL, nullptr},
-		{X86_INS_VMOVQ, nullptr},
-		{X86_INS_VMOVDDUP, nullptr},
-		{X86_INS_VMOVD, nullptr},
-		{X86_INS_VMOVDQA32, nullptr},
-		{X86_INS_VMOVDQA64, nullptr},
-		{X86_INS_VMOVDQA, nullptr},
-		{X86_INS_VMOVDQU16, nullptr},
-		{X86_INS_VMOVDQU32, nullptr},
-		{X86_INS_VMOVDQU64, nullptr},
-		{X86_INS_VMOVDQU8, nullptr},
-		{X86_INS_VMOVDQU, nullptr},
-		{X86_INS_VMOVHLPS, nullptr},
-		{X86_INS_VMOVHPD, nullptr},
-		{X86_INS_VMOVHPS, nullptr},
-		{X86_INS_VMOVLHPS, nullptr},
-		{X86_INS_VMOVLPD, nullptr},
-		{X86_INS_VMOVLPS, nullptr},
-		{X86_INS_VMOVMSKPD, nullptr},
-		{X86_INS_VMOVMSKPS, nullptr},
-		{X86_INS_VMOVNTDQA, nullptr},
-		{X86_INS_VMOVNTDQ, nullptr},
-		{X86_INS_VMOVNTPD, nullptr},
-		{X86_INS_VMOVNTPS, nullptr},
-		{X86_INS_VMOVSD, nullptr},
-		{X86_INS_VMOVSHDUP, nullptr},
-		{X86_INS_VMOVSLDUP, nullptr},
-		{X86_INS_VMOVSS, nullptr},
-		{X86_INS_VMOVUPD, nullptr},
-		{X86_INS_VMOVUPS, nullptr},
-		{X86_INS_VMPSADBW, nullptr},
-		{X86_INS_VMPTRLD, nullptr},
-		{X86_INS_VMPTRST, nullptr},
-		{X86_INS_VMREAD, nullptr},
-		{X86_INS_VMRESUME, nullptr},
-		{X86_INS_VMRUN, nullptr},
-		{X86_INS_VMSAVE, nullptr},
-		{X86_INS_VMULPD, nullptr},
-		{X86_INS_VMULPS, nullptr},
-		{X86_INS_VMULSD, nullptr},
-		{X86_INS_VMULSS, nullptr},
-		{X86_INS_VMWRITE, nullptr},
-		{X86_INS_VMXOFF, nullptr},
-		{X86_INS_VMXON, nullptr},
-		{X86_INS_VPABSB, nullptr},
-		{X86_INS_VPABSD, nullptr},
-		{X86_INS_VPABSQ, nullptr},
-		{X86_INS_VPABSW, nullptr},
-		{X86_INS_VPACKSSDW, nullptr},
-		{X86_INS_VPACKSSWB, nullptr},
-		{X86_INS_VPACKUSDW, nullptr},
-		{X86_INS_VPACKUSWB, nullptr},
-		{X86_INS_VPADDB, nullptr},
-		{X86_INS_VPADDD, nullptr},
-		{X86_INS_VPADDQ, nullptr},
-		{X86_INS_VPADDSB, nullptr},
-		{X86_INS_VPADDSW, nullptr},
-		{X86_INS_VPADDUSB, nullptr},
-		{X86_INS_VPADDUSW, nullptr},
-		{X86_INS_VPADDW, nullptr},
-		{X86_INS_VPALIGNR, nullptr},
-		{X86_INS_VPANDD, nullptr},
-		{X86_INS_VPANDND, nullptr},
-		{X86_INS_VPANDNQ, nullptr},
-		{X86_INS_VPANDN, nullptr},
-		{X86_INS_VPANDQ, nullptr},
-		{X86_INS_VPAND, nullptr},
-		{X86_INS_VPAVGB, nullptr},
-		{X86_INS_VPAVGW, nullptr},
-		{X86_INS_VPBLENDD, nullptr},
-		{X86_INS_VPBLENDMB, nullptr},
-		{X86_INS_VPBLENDMD, nullptr},
-		{X86_INS_VPBLENDMQ, nullptr},
-		{X86_INS_VPBLENDMW, nullptr},
-		{X86_INS_VPBLENDVB, nullptr},
-		{X86_INS_VPBLENDW, nullptr},
-		{X86_INS_VPBROADCASTB, nullptr},
-		{X86_INS_VPBROADCASTD, nullptr},
-		{X86_INS_VPBROADCASTMB2Q, nullptr},
-		{X86_INS_VPBROADCASTMW2D, nullptr},
-		{X86_INS_VPBROADCASTQ, nullptr},
-		{X86_INS_VPBROADCASTW, nullptr},
-		{X86_INS_VPCLMULQDQ, nullptr},
-		{X86_INS_VPCMOV, nullptr},
-		{X86_INS_VPCMPB, nullptr},
-		{X86_INS_VPCMPD, nullptr},
-		{X86_INS_VPCMPEQB, nullptr},
-		{X86_INS_VPCMPEQD, nullptr},
-		{X86_INS_VPCMPEQQ, nullptr},
-		{X86_INS_VPCMPEQW, nullptr},
-		{X86_INS_VPCMPESTRI, nullptr},
-		{X86_INS_VPCMPESTRM, nullptr},
-		{X86_INS_VPCMPGTB, nullptr},
-		{X86_INS_VPCMPGTD, nullptr},
-		{X86_INS_VPCMPGTQ, nullptr},
-		{X86_INS_VPCMPGTW, nullptr},
-		{X86_INS_VPCMPISTRI, nullptr},
-		{X86_INS_VPCMPISTRM, nullptr},
-		{X86_INS_VPCMPQ, nullptr},
-		{X86_INS_VPCMPUB, nullptr},
-		{X86_INS_VPCMPUD, nullptr},
-		{X86_INS_VPCMPUQ, nullptr},
-		{X86_INS_VPCMPUW, nullptr},
-		{X86_INS_VPCMPW, nullptr},
-		{X86_INS_VPCOMB, nullptr},
-		{X86_INS_VPCOMD, nullptr},
-		{X86_INS_VPCOMPRESSD, nullptr},
-		{X86_INS_VPCOMPRESSQ, nullptr},
-		{X86_INS_VPCOMQ, nullptr},
-		{X86_INS_VPCOMUB, nullptr},
-		{X86_INS_VPCOMUD, nullptr},
-		{X86_INS_VPCOMUQ, nullptr},
-		{X86_INS_VPCOMUW, nullptr},
-		{X86_INS_VPCOMW, nullptr},
-		{X86_INS_VPCONFLICTD, nullptr},
-		{X86_INS_VPCONFLICTQ, nullptr},
-		{X86_INS_VPERM2F128, nullptr},
-		{X86_INS_VPERM2I128, nullptr},
-		{X86_INS_VPERMD, nullptr},
-		{X86_INS_VPERMI2D, nullptr},
-		{X86_INS_VPERMI2PD, nullptr},
-		{X86_INS_VPERMI2PS, nullptr},
-		{X86_INS_VPERMI2Q, nullptr},
-		{X86_INS_VPERMIL2PD, nullptr},
-		{X86_INS_VPERMIL2PS, nullptr},
-		{X86_INS_VPERMILPD, nullptr},
-		{X86_INS_VPERMILPS, nullptr},
-		{X86_INS_VPERMPD, nullptr},
-		{X86_INS_VPERMPS, nullptr},
-		{X86_INS_VPERMQ, nullptr},
-		{X86_INS_VPERMT2D, nullptr},
-		{X86_INS_VPERMT2PD, nullptr},
-		{X86_INS_VPERMT2PS, nullptr},
-		{X86_INS_VPERMT2Q, nullptr},
-		{X86_INS_VPEXPANDD, nullptr},
-		{X86_INS_VPEXPANDQ, nullptr},
-		{X86_INS_VPEXTRB, nullptr},
-		{X86_INS_VPEXTRD, nullptr},
-		{X86_INS_VPEXTRQ, nullptr},
-		{X86_INS_VPEXTRW, nullptr},
-		{X86_INS_VPGATHERDD, nullptr},
-		{X86_INS_VPGATHERDQ, nullptr},
-		{X86_INS_VPGATHERQD, nullptr},
-		{X86_INS_VPGATHERQQ, nullptr},
-		{X86_INS_VPHADDBD, nullptr},
-		{X86_INS_VPHADDBQ, nullptr},
-		{X86_INS_VPHADDBW, nullptr},
-		{X86_INS_VPHADDDQ, nullptr},
-		{X86_INS_VPHADDD, nullptr},
-		{X86_INS_VPHADDSW, nullptr},
-		{X86_INS_VPHADDUBD, nullptr},
-		{X86_INS_VPHADDUBQ, nullptr},
-		{X86_INS_VPHADDUBW, nullptr},
-		{X86_INS_VPHADDUDQ, nullptr},
-		{X86_INS_VPHADDUWD, nullptr},
-		{X86_INS_VPHADDUWQ, nullptr},
-		{X86_INS_VPHADDWD, nullptr},
-		{X86_INS_VPHADDWQ, nullptr},
-		{X86_INS_VPHADDW, nullptr},
-		{X86_INS_VPHMINPOSUW, nullptr},
-		{X86_INS_VPHSUBBW, nullptr},
-		{X86_INS_VPHSUBDQ, nullptr},
-		{X86_INS_VPHSUBD, nullptr},
-		{X86_INS_VPHSUBSW, nullptr},
-		{X86_INS_VPHSUBWD, nullptr},
-		{X86_INS_VPHSUBW, nullptr},
-		{X86_INS_VPINSRB, nullptr},
-		{X86_INS_VPINSRD, nullptr},
-		{X86_INS_VPINSRQ, nullptr},
-		{X86_INS_VPINSRW, nullptr},
-		{X86_INS_VPLZCNTD, nullptr},
-		{X86_INS_VPLZCNTQ, nullptr},
-		{X86_INS_VPMACSDD, nullptr},
-		{X86_INS_VPMACSDQH, nullptr},
-		{X86_INS_VPMACSDQL, nullptr},
-		{X86_INS_VPMACSSDD, nullptr},
-		{X86_INS_VPMACSSDQH, nullptr},
-		{X86_INS_VPMACSSDQL, nullptr},
-		{X86_INS_VPMACSSWD, nullptr},
-		{X86_INS_VPMACSSWW, nullptr},
-		{X86_INS_VPMACSWD, nullptr},
-		{X86_INS_VPMACSWW, nullptr},
-		{X86_INS_VPMADCSSWD, nullptr},
-		{X86_INS_VPMADCSWD, nullptr},
-		{X86_INS_VPMADDUBSW, nullptr},
-		{X86_INS_VPMADDWD, nullptr},
-		{X86_INS_VPMASKMOVD, nullptr},
-		{X86_INS_VPMASKMOVQ, nullptr},
-		{X86_INS_VPMAXSB, nullptr},
-		{X86_INS_VPMAXSD, nullptr},
-		{X86_INS_VPMAXSQ, nullptr},
-		{X86_INS_VPMAXSW, nullptr},
-		{X86_INS_VPMAXUB, nullptr},
-		{X86_INS_VPMAXUD, nullptr},
-		{X86_INS_VPMAXUQ, nullptr},
-		{X86_INS_VPMAXUW, nullptr},
-		{X86_INS_VPMINSB, nullptr},
-		{X86_INS_VPMINSD, nullptr},
-		{X86_INS_VPMINSQ, nullptr},
-		{X86_INS_VPMINSW, nullptr},
-		{X86_INS_VPMINUB, nullptr},
-		{X86_INS_VPMINUD, nullptr},
-		{X86_INS_VPMINUQ, nullptr},
-		{X86_INS_VPMINUW, nullptr},
-		{X86_INS_VPMOVDB, nullptr},
-		{X86_INS_VPMOVDW, nullptr},
-		{X86_INS_VPMOVM2B, nullptr},
-		{X86_INS_VPMOVM2D, nullptr},
-		{X86_INS_VPMOVM2Q, nullptr},
-		{X86_INS_VPMOVM2W, nullptr},
-		{X86_INS_VPMOVMSKB, nullptr},
-		{X86_INS_VPMOVQB, nullptr},
-		{X86_INS_VPMOVQD, nullptr},
-		{X86_INS_VPMOVQW, nullptr},
-		{X86_INS_VPMOVSDB, nullptr},
-		{X86_INS_VPMOVSDW, nullptr},
-		{X86_INS_VPMOVSQB, nullptr},
-		{X86_INS_VPMOVSQD, nullptr},
-		{X86_INS_VPMOVSQW, nullptr},
-		{X86_INS_VPMOVSXBD, nullptr},
-		{X86_INS_VPMOVSXBQ, nullptr},
-		{X86_INS_VPMOVSXBW, nullptr},
-		{X86_INS_VPMOVSXDQ, nullptr},
-		{X86_INS_VPMOVSXWD, nullptr},
-		{X86_INS_VPMOVSXWQ, nullptr},
-		{X86_INS_VPMOVUSDB, nullptr},
-		{X86_INS_VPMOVUSDW, nullptr},
-		{X86_INS_VPMOVUSQB, nullptr},
-		{X86_INS_VPMOVUSQD, nullptr},
-		{X86_INS_VPMOVUSQW, nullptr},
-		{X86_INS_VPMOVZXBD, nullptr},
-		{X86_INS_VPMOVZXBQ, nullptr},
-		{X86_INS_VPMOVZXBW, nullptr},
-		{X86_INS_VPMOVZXDQ, nullptr},
-		{X86_INS_VPMOVZXWD, nullptr},
-		{X86_INS_VPMOVZXWQ, nullptr},
-		{X86_INS_VPMULDQ, nullptr},
-		{X86_INS_VPMULHRSW, nullptr},
-		{X86_INS_VPMULHUW, nullptr},
-		{X86_INS_VPMULHW, nullptr},
-		{X86_INS_VPMULLD, nullptr},
-		{X86_INS_VPMULLQ, nullptr},
-		{X86_INS_VPMULLW, nullptr},
-		{X86_INS_VPMULUDQ, nullptr},
-		{X86_INS_VPORD, nullptr},
-		{X86_INS_VPORQ, nullptr},
-		{X86_INS_VPOR, nullptr},
-		{X86_INS_VPPERM, nullptr},
-		{X86_INS_VPROTB, nullptr},
-		{X86_INS_VPROTD, nullptr},
-		{X86_INS_VPROTQ, nullptr},
-		{X86_INS_VPROTW, nullptr},
-		{X86_INS_VPSADBW, nullptr},
-		{X86_INS_VPSCATTERDD, nullptr},
-		{X86_INS_VPSCATTERDQ, nullptr},
-		{X86_INS_VPSCATTERQD, nullptr},
-		{X86_INS_VPSCATTERQQ, nullptr},
-		{X86_INS_VPSHAB, nullptr},
-		{X86_INS_VPSHAD, nullptr},
-		{X86_INS_VPSHAQ, nullptr},
-		{X86_INS_VPSHAW, nullptr},
-		{X86_INS_VPSHLB, nullptr},
-		{X86_INS_VPSHLD, nullptr},
-		{X86_INS_VPSHLQ, nullptr},
-		{X86_INS_VPSHLW, nullptr},
-		{X86_INS_VPSHUFB, nullptr},
-		{X86_INS_VPSHUFD, nullptr},
-		{X86_INS_VPSHUFHW, nullptr},
-		{X86_INS_VPSHUFLW, nullptr},
-		{X86_INS_VPSIGNB, nullptr},
-		{X86_INS_VPSIGND, nullptr},
-		{X86_INS_VPSIGNW, nullptr},
-		{X86_INS_VPSLLDQ, nullptr},
-		{X86_INS_VPSLLD, nullptr},
-		{X86_INS_VPSLLQ, nullptr},
-		{X86_INS_VPSLLVD, nullptr},
-		{X86_INS_VPSLLVQ, nullptr},
-		{X86_INS_VPSLLW, nullptr},
-		{X86_INS_VPSRAD, nullptr},
-		{X86_INS_VPSRAQ, nullptr},
-		{X86_INS_VPSRAVD, nullptr},
-		{X86_INS_VPSRAVQ, nullptr},
-		{X86_INS_VPSRAW, nullptr},
-		{X86_INS_VPSRLDQ, nullptr},
-		{X86_INS_VPSRLD, nullptr},
-		{X86_INS_VPSRLQ, nullptr},
-		{X86_INS_VPSRLVD, nullptr},
-		{X86_INS_VPSRLVQ, nullptr},
-		{X86_INS_VPSRLW, nullptr},
-		{X86_INS_VPSUBB, nullptr},
-		{X86_INS_VPSUBD, nullptr},
-		{X86_INS_VPSUBQ, nullptr},
-		{X86_INS_VPSUBSB, nullptr},
-		{X86_INS_VPSUBSW, nullptr},
-		{X86_INS_VPSUBUSB, nullptr},
-		{X86_INS_VPSUBUSW, nullptr},
-		{X86_INS_VPSUBW, nullptr},
-		{X86_INS_VPTESTMD, nullptr},
-		{X86_INS_VPTESTMQ, nullptr},
-		{X86_INS_VPTESTNMD, nullptr},
-		{X86_INS_VPTESTNMQ, nullptr},
-		{X86_INS_VPTEST, nullptr},
-		{X86_INS_VPUNPCKHBW, nullptr},
-		{X86_INS_VPUNPCKHDQ, nullptr},
-		{X86_INS_VPUNPCKHQDQ, nullptr},
-		{X86_INS_VPUNPCKHWD, nullptr},
-		{X86_INS_VPUNPCKLBW, nullptr},
-		{X86_INS_VPUNPCKLDQ, nullptr},
-		{X86_INS_VPUNPCKLQDQ, nullptr},
-		{X86_INS_VPUNPCKLWD, nullptr},
-		{X86_INS_VPXORD, nullptr},
-		{X86_INS_VPXORQ, nullptr},
-		{X86_INS_VPXOR, nullptr},
-		{X86_INS_VRCP14PD, nullptr},
-		{X86_INS_VRCP14PS, nullptr},
-		{X86_INS_VRCP14SD, nullptr},
-		{X86_INS_VRCP14SS, nullptr},
-		{X86_INS_VRCP28PD, nullptr},
-		{X86_INS_VRCP28PS, nullptr},
-		{X86_INS_VRCP28SD, nullptr},
-		{X86_INS_VRCP28SS, nullptr},
-		{X86_INS_VRCPPS, nullptr},
-		{X86_INS_VRCPSS, nullptr},
-		{X86_INS_VRNDSCALEPD, nullptr},
-		{X86_INS_VRNDSCALEPS, nullptr},
-		{X86_INS_VRNDSCALESD, nullptr},
-		{X86_INS_VRNDSCALESS, nullptr},
-		{X86_INS_VROUNDPD, nullptr},
-		{X86_INS_VROUNDPS, nullptr},
-		{X86_INS_VROUNDSD, nullptr},
-		{X86_INS_VROUNDSS, nullptr},
-		{X86_INS_VRSQRT14PD, nullptr},
-		{X86_INS_VRSQRT14PS, nullptr},
-		{X86_INS_VRSQRT14SD, nullptr},
-		{X86_INS_VRSQRT14SS, nullptr},
-		{X86_INS_VRSQRT28PD, nullptr},
-		{X86_INS_VRSQRT28PS, nullptr},
-		{X86_INS_VRSQRT28SD, nullptr},
-		{X86_INS_VRSQRT28SS, nullptr},
-		{X86_INS_VRSQRTPS, nullptr},
-		{X86_INS_VRSQRTSS, nullptr},
-		{X86_INS_VSCATTERDPD, nullptr},
-		{X86_INS_VSCATTERDPS, nullptr},
-		{X86_INS_VSCATTERPF0DPD, nullptr},
-		{X86_INS_VSCATTERPF0DPS, nullptr},
-		{X86_INS_VSCATTERPF0QPD, nullptr},
-		{X86_INS_VSCATTERPF0QPS, nullptr},
-		{X86_INS_VSCATTERPF1DPD, nullptr},
-		{X86_INS_VSCATTERPF1DPS, nullptr},
-		{X86_INS_VSCATTERPF1QPD, nullptr},
-		{X86_INS_VSCATTERPF1QPS, nullptr},
-		{X86_INS_VSCATTERQPD, nullptr},
-		{X86_INS_VSCATTERQPS, nullptr},
-		{X86_INS_VSHUFPD, nullptr},
-		{X86_INS_VSHUFPS, nullptr},
-		{X86_INS_VSQRTPD, nullptr},
-		{X86_INS_VSQRTPS, nullptr},
-		{X86_INS_VSQRTSD, nullptr},
-		{X86_INS_VSQRTSS, nullptr},
-		{X86_INS_VSTMXCSR, nullptr},
-		{X86_INS_VSUBPD, nullptr},
-		{X86_INS_VSUBPS, nullptr},
-		{X86_INS_VSUBSD, nullptr},
-		{X86_INS_VSUBSS, nullptr},
-		{X86_INS_VTESTPD, nullptr},
-		{X86_INS_VTESTPS, nullptr},
-		{X86_INS_VUNPCKHPD, nullptr},
-		{X86_INS_VUNPCKHPS, nullptr},
-		{X86_INS_VUNPCKLPD, nullptr},
-		{X86_INS_VUNPCKLPS, nullptr},
-		{X86_INS_VZEROALL, nullptr},
-		{X86_INS_VZEROUPPER, nullptr},
-		{X86_INS_WAIT, &Capstone2LlvmIrTranslatorX86::translateWait},
-		{X86_INS_WBINVD, nullptr},
-		{X86_INS_WRFSBASE, nullptr},
-		{X86_INS_WRGSBASE, nullptr},
-		{X86_INS_WRMSR, nullptr},
-		{X86_INS_XABORT, nullptr},
-		{X86_INS_XACQUIRE, nullptr},
-		{X86_INS_XBEGIN, nullptr},
-		{X86_INS_XCHG, &Capstone2LlvmIrTranslatorX86::translateXchg},
-		{X86_INS_XCRYPTCBC, nullptr},
-		{X86_INS_XCRYPTCFB, nullptr},
-		{X86_INS_XCRYPTCTR, nullptr},
-		{X86_INS_XCRYPTECB, nullptr},
-		{X86_INS_XCRYPTOFB, nullptr},
-		{X86_INS_XEND, nullptr},
-		{X86_INS_XGETBV, nullptr},
-		{X86_INS_XLATB, &Capstone2LlvmIrTranslatorX86::translateXlatb},
-		{X86_INS_XRELEASE, nullptr},
-		{X86_INS_XRSTOR, nullptr},
-		{X86_INS_XRSTOR64, nullptr},
-		{X86_INS_XRSTORS, nullptr},
-		{X86_INS_XRSTORS64, nullptr},
-		{X86_INS_XSAVE, nullptr},
-		{X86_INS_XSAVE64, nullptr},
-		{X86_INS_XSAVEC, nullptr},
-		{X86_INS_XSAVEC64, nullptr},
-		{X86_INS_XSAVEOPT, nullptr},
-		{X86_INS_XSAVEOPT64, nullptr},
-		{X86_INS_XSAVES, nullptr},
-		{X86_INS_XSAVES64, nullptr},
-		{X86_INS_XSETBV, nullptr},
-		{X86_INS_XSHA1, nullptr},
-		{X86_INS_XSHA256, nullptr},
-		{X86_INS_XSTORE, nullptr},
-		{X86_INS_XTEST, nullptr},
-		{X86_INS_FDISI8087_NOP, &Capstone2LlvmIrTranslatorX86::translateNop},
-		{X86_INS_FENI8087_NOP, &Capstone2LlvmIrTranslatorX86::translateNop},
+	t.fns[X86_INS_INVALID] = nullptr;
 
-		// pseudo instructions
-		{X86_INS_CMPSS, nullptr},
-		{X86_INS_CMPEQSS, nullptr},
-		{X86_INS_CMPLTSS, nullptr},
-		{X86_INS_CMPLESS, nullptr},
-		{X86_INS_CMPUNORDSS, nullptr},
-		{X86_INS_CMPNEQSS, nullptr},
-		{X86_INS_CMPNLTSS, nullptr},
-		{X86_INS_CMPNLESS, nullptr},
-		{X86_INS_CMPORDSS, nullptr},
+	t.fns[X86_INS_AAA] = &Capstone2LlvmIrTranslatorX86::translateAaa;
+	t.fns[X86_INS_AAD] = &Capstone2LlvmIrTranslatorX86::translateAad;
+	t.fns[X86_INS_AAM] = &Capstone2LlvmIrTranslatorX86::translateAam;
+	t.fns[X86_INS_AAS] = &Capstone2LlvmIrTranslatorX86::translateAaa;
+	t.fns[X86_INS_FABS] = &Capstone2LlvmIrTranslatorX86::translateFabs;
+	t.fns[X86_INS_ADC] = &Capstone2LlvmIrTranslatorX86::translateAdc;
+	t.fns[X86_INS_ADCX] = &Capstone2LlvmIrTranslatorX86::translateAdc;
+	t.fns[X86_INS_ADD] = &Capstone2LlvmIrTranslatorX86::translateAdd;
+	t.fns[X86_INS_ADDPD] = nullptr;
+	t.fns[X86_INS_ADDPS] = nullptr;
+	t.fns[X86_INS_ADDSD] = nullptr;
+	t.fns[X86_INS_ADDSS] = nullptr;
+	t.fns[X86_INS_ADDSUBPD] = nullptr;
+	t.fns[X86_INS_ADDSUBPS] = nullptr;
+	t.fns[X86_INS_FADD] = &Capstone2LlvmIrTranslatorX86::translateFadd;
+	t.fns[X86_INS_FIADD] = &Capstone2LlvmIrTranslatorX86::translateFadd;
+	t.fns[X86_INS_FADDP] = &Capstone2LlvmIrTranslatorX86::translateFadd;
+	t.fns[X86_INS_ADOX] = &Capstone2LlvmIrTranslatorX86::translateAdc;
+	t.fns[X86_INS_AESDECLAST] = nullptr;
+	t.fns[X86_INS_AESDEC] = nullptr;
+	t.fns[X86_INS_AESENCLAST] = nullptr;
+	t.fns[X86_INS_AESENC] = nullptr;
+	t.fns[X86_INS_AESIMC] = nullptr;
+	t.fns[X86_INS_AESKEYGENASSIST] = nullptr;
+	t.fns[X86_INS_AND] = &Capstone2LlvmIrTranslatorX86::translateAnd;
+	t.fns[X86_INS_ANDN] = nullptr;
+	t.fns[X86_INS_ANDNPD] = nullptr;
+	t.fns[X86_INS_ANDNPS] = nullptr;
+	t.fns[X86_INS_ANDPD] = nullptr;
+	t.fns[X86_INS_ANDPS] = nullptr;
+	t.fns[X86_INS_ARPL] = nullptr;
+	t.fns[X86_INS_BEXTR] = nullptr;
+	t.fns[X86_INS_BLCFILL] = nullptr;
+	t.fns[X86_INS_BLCI] = nullptr;
+	t.fns[X86_INS_BLCIC] = nullptr;
+	t.fns[X86_INS_BLCMSK] = nullptr;
+	t.fns[X86_INS_BLCS] = nullptr;
+	t.fns[X86_INS_BLENDPD] = nullptr;
+	t.fns[X86_INS_BLENDPS] = nullptr;
+	t.fns[X86_INS_BLENDVPD] = nullptr;
+	t.fns[X86_INS_BLENDVPS] = nullptr;
+	t.fns[X86_INS_BLSFILL] = nullptr;
+	t.fns[X86_INS_BLSI] = nullptr;
+	t.fns[X86_INS_BLSIC] = nullptr;
+	t.fns[X86_INS_BLSMSK] = nullptr;
+	t.fns[X86_INS_BLSR] = nullptr;
+	t.fns[X86_INS_BOUND] = &Capstone2LlvmIrTranslatorX86::translateBound;
+	t.fns[X86_INS_BSF] = &Capstone2LlvmIrTranslatorX86::translateBsf;
+	t.fns[X86_INS_BSR] = &Capstone2LlvmIrTranslatorX86::translateBsf;
+	t.fns[X86_INS_BSWAP] = &Capstone2LlvmIrTranslatorX86::translateBswap;
+	t.fns[X86_INS_BT] = &Capstone2LlvmIrTranslatorX86::translateBt;
+	t.fns[X86_INS_BTC] = &Capstone2LlvmIrTranslatorX86::translateBtc;
+	t.fns[X86_INS_BTR] = &Capstone2LlvmIrTranslatorX86::translateBtr;
+	t.fns[X86_INS_BTS] = &Capstone2LlvmIrTranslatorX86::translateBts;
+	t.fns[X86_INS_BZHI] = nullptr;
+	t.fns[X86_INS_CALL] = &Capstone2LlvmIrTranslatorX86::translateCall;
+	t.fns[X86_INS_CBW] = &Capstone2LlvmIrTranslatorX86::translateCbw;
+	t.fns[X86_INS_CDQ] = &Capstone2LlvmIrTranslatorX86::translateCdq;
+	t.fns[X86_INS_CDQE] = &Capstone2LlvmIrTranslatorX86::translateCdqe;
+	t.fns[X86_INS_FCHS] = &Capstone2LlvmIrTranslatorX86::translateFchs;
+	t.fns[X86_INS_CLAC] = nullptr;
+	t.fns[X86_INS_CLC] = &Capstone2LlvmIrTranslatorX86::translateClc;
+	t.fns[X86_INS_CLD] = &Capstone2LlvmIrTranslatorX86::translateCld;
+	t.fns[X86_INS_CLFLUSH] = nullptr;
+	t.fns[X86_INS_CLFLUSHOPT] = nullptr;
+	t.fns[X86_INS_CLGI] = nullptr;
+	t.fns[X86_INS_CLI] = &Capstone2LlvmIrTranslatorX86::translateCli;
+	t.fns[X86_INS_CLTS] = nullptr;
+	t.fns[X86_INS_CLWB] = nullptr;
+	t.fns[X86_INS_CMC] = &Capstone2LlvmIrTranslatorX86::translateCmc;
+	t.fns[X86_INS_CMOVA] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVAE] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVB] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVBE] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_FCMOVBE] = nullptr;
+	t.fns[X86_INS_FCMOVB] = nullptr;
+	t.fns[X86_INS_CMOVE] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_FCMOVE] = nullptr;
+	t.fns[X86_INS_CMOVG] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVGE] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVL] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVLE] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_FCMOVNBE] = nullptr;
+	t.fns[X86_INS_FCMOVNB] = nullptr;
+	t.fns[X86_INS_CMOVNE] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_FCMOVNE] = nullptr;
+	t.fns[X86_INS_CMOVNO] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVNP] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_FCMOVNU] = nullptr;
+	t.fns[X86_INS_CMOVNS] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVO] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMOVP] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_FCMOVU] = nullptr;
+	t.fns[X86_INS_CMOVS] = &Capstone2LlvmIrTranslatorX86::translateCMovCc;
+	t.fns[X86_INS_CMP] = &Capstone2LlvmIrTranslatorX86::translateSub;
+	t.fns[X86_INS_CMPSB] = &Capstone2LlvmIrTranslatorX86::translateCompareString;
+	t.fns[X86_INS_CMPSQ] = &Capstone2LlvmIrTranslatorX86::translateCompareString;
+	t.fns[X86_INS_CMPSW] = &Capstone2LlvmIrTranslatorX86::translateCompareString;
+	t.fns[X86_INS_CMPXCHG16B] = &Capstone2LlvmIrTranslatorX86::translateCmpxchg16b;
+	t.fns[X86_INS_CMPXCHG] = &Capstone2LlvmIrTranslatorX86::translateCmpxchg;
+	t.fns[X86_INS_CMPXCHG8B] = &Capstone2LlvmIrTranslatorX86::translateCmpxchg8b;
+	t.fns[X86_INS_COMISD] = nullptr;
+	t.fns[X86_INS_COMISS] = nullptr;
+	t.fns[X86_INS_FCOMP] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FCOMIP] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FCOMI] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FCOM] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FCOS] = &Capstone2LlvmIrTranslatorX86::translateFcos;
+	t.fns[X86_INS_CPUID] = &Capstone2LlvmIrTranslatorX86::translateCpuid;
+	t.fns[X86_INS_CQO] = &Capstone2LlvmIrTranslatorX86::translateCqo;
+	t.fns[X86_INS_CRC32] = nullptr;
+	t.fns[X86_INS_CVTDQ2PD] = nullptr;
+	t.fns[X86_INS_CVTDQ2PS] = nullptr;
+	t.fns[X86_INS_CVTPD2DQ] = nullptr;
+	t.fns[X86_INS_CVTPD2PS] = nullptr;
+	t.fns[X86_INS_CVTPS2DQ] = nullptr;
+	t.fns[X86_INS_CVTPS2PD] = nullptr;
+	t.fns[X86_INS_CVTSD2SI] = nullptr;
+	t.fns[X86_INS_CVTSD2SS] = nullptr;
+	t.fns[X86_INS_CVTSI2SD] = nullptr;
+	t.fns[X86_INS_CVTSI2SS] = nullptr;
+	t.fns[X86_INS_CVTSS2SD] = nullptr;
+	t.fns[X86_INS_CVTSS2SI] = nullptr;
+	t.fns[X86_INS_CVTTPD2DQ] = nullptr;
+	t.fns[X86_INS_CVTTPS2DQ] = nullptr;
+	t.fns[X86_INS_CVTTSD2SI] = nullptr;
+	t.fns[X86_INS_CVTTSS2SI] = nullptr;
+	t.fns[X86_INS_CWD] = &Capstone2LlvmIrTranslatorX86::translateCwd;
+	t.fns[X86_INS_CWDE] = &Capstone2LlvmIrTranslatorX86::translateCwde;
+	t.fns[X86_INS_DAA] = &Capstone2LlvmIrTranslatorX86::translateDaaDas;
+	t.fns[X86_INS_DAS] = &Capstone2LlvmIrTranslatorX86::translateDaaDas;
+	t.fns[X86_INS_DATA16] = nullptr;
+	t.fns[X86_INS_DEC] = &Capstone2LlvmIrTranslatorX86::translateDec;
+	t.fns[X86_INS_DIV] = &Capstone2LlvmIrTranslatorX86::translateDiv;
+	t.fns[X86_INS_DIVPD] = nullptr;
+	t.fns[X86_INS_DIVPS] = nullptr;
+	t.fns[X86_INS_FDIVR] = &Capstone2LlvmIrTranslatorX86::translateFdivr;
+	t.fns[X86_INS_FIDIVR] = &Capstone2LlvmIrTranslatorX86::translateFdivr;
+	t.fns[X86_INS_FDIVRP] = &Capstone2LlvmIrTranslatorX86::translateFdivr;
+	t.fns[X86_INS_DIVSD] = nullptr;
+	t.fns[X86_INS_DIVSS] = nullptr;
+	t.fns[X86_INS_FDIV] = &Capstone2LlvmIrTranslatorX86::translateFdiv;
+	t.fns[X86_INS_FIDIV] = &Capstone2LlvmIrTranslatorX86::translateFdiv;
+	t.fns[X86_INS_FDIVP] = &Capstone2LlvmIrTranslatorX86::translateFdiv;
+	t.fns[X86_INS_DPPD] = nullptr;
+	t.fns[X86_INS_DPPS] = nullptr;
+	t.fns[X86_INS_RET] = &Capstone2LlvmIrTranslatorX86::translateRet;
+	t.fns[X86_INS_ENCLS] = nullptr;
+	t.fns[X86_INS_ENCLU] = nullptr;
+	t.fns[X86_INS_ENTER] = &Capstone2LlvmIrTranslatorX86::translateEnter;
+	t.fns[X86_INS_EXTRACTPS] = nullptr;
+	t.fns[X86_INS_EXTRQ] = nullptr;
+	t.fns[X86_INS_F2XM1] = nullptr;
+	t.fns[X86_INS_LCALL] = &Capstone2LlvmIrTranslatorX86::translateLcall;
+	t.fns[X86_INS_LJMP] = &Capstone2LlvmIrTranslatorX86::translateLjmp;
+	t.fns[X86_INS_FBLD] = nullptr;
+	t.fns[X86_INS_FBSTP] = nullptr;
+	t.fns[X86_INS_FCOMPP] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FDECSTP] = &Capstone2LlvmIrTranslatorX86::translateFdecstp;
+	t.fns[X86_INS_FEMMS] = nullptr;
+	t.fns[X86_INS_FFREE] = nullptr;
+	t.fns[X86_INS_FICOM] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FICOMP] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FINCSTP] = &Capstone2LlvmIrTranslatorX86::translateFincstp;
+	t.fns[X86_INS_FLDCW] = &Capstone2LlvmIrTranslatorX86::translateFldcw;
+	t.fns[X86_INS_FLDENV] = &Capstone2LlvmIrTranslatorX86::translateFldenv;
+	t.fns[X86_INS_FLDL2E] = &Capstone2LlvmIrTranslatorX86::translateFloadConstant;
+	t.fns[X86_INS_FLDL2T] = &Capstone2LlvmIrTranslatorX86::translateFloadConstant;
+	t.fns[X86_INS_FLDLG2] = &Capstone2LlvmIrTranslatorX86::translateFloadConstant;
+	t.fns[X86_INS_FLDLN2] = &Capstone2LlvmIrTranslatorX86::translateFloadConstant;
+	t.fns[X86_INS_FLDPI] = &Capstone2LlvmIrTranslatorX86::translateFloadConstant;
+	t.fns[X86_INS_FNCLEX] = nullptr;
+	t.fns[X86_INS_FNINIT] = &Capstone2LlvmIrTranslatorX86::translateFninit;
+	t.fns[X86_INS_FNOP] = &Capstone2LlvmIrTranslatorX86::translateNop;
+	t.fns[X86_INS_FNSTCW] = &Capstone2LlvmIrTranslatorX86::translateFnstcw;
+	t.fns[X86_INS_FNSTSW] = &Capstone2LlvmIrTranslatorX86::translateFnstsw;
+	t.fns[X86_INS_FPATAN] = nullptr;
+	t.fns[X86_INS_FPREM] = nullptr;
+	t.fns[X86_INS_FPREM1] = nullptr;
+	t.fns[X86_INS_FPTAN] = nullptr;
+	t.fns[X86_INS_FFREEP] = nullptr;
+	t.fns[X86_INS_FRNDINT] = &Capstone2LlvmIrTranslatorX86::translateFrndint;
+	t.fns[X86_INS_FRSTOR] = nullptr;
+	t.fns[X86_INS_FNSAVE] = nullptr;
+	t.fns[X86_INS_FSCALE] = nullptr;
+	t.fns[X86_INS_FSETPM] = nullptr;
+	t.fns[X86_INS_FSINCOS] = &Capstone2LlvmIrTranslatorX86::translateFsincos;
+	t.fns[X86_INS_FNSTENV] = &Capstone2LlvmIrTranslatorX86::translateFnstenv;
+	t.fns[X86_INS_FXAM] = &Capstone2LlvmIrTranslatorX86::translateFxam;
+	t.fns[X86_INS_FXRSTOR] = nullptr;
+	t.fns[X86_INS_FXRSTOR64] = nullptr;
+	t.fns[X86_INS_FXSAVE] = nullptr;
+	t.fns[X86_INS_FXSAVE64] = nullptr;
+	t.fns[X86_INS_FXTRACT] = nullptr;
+	t.fns[X86_INS_FYL2X] = nullptr;
+	t.fns[X86_INS_FYL2XP1] = nullptr;
+	t.fns[X86_INS_MOVAPD] = nullptr;
+	t.fns[X86_INS_MOVAPS] = nullptr;
+	t.fns[X86_INS_ORPD] = nullptr;
+	t.fns[X86_INS_ORPS] = nullptr;
+	t.fns[X86_INS_VMOVAPD] = nullptr;
+	t.fns[X86_INS_VMOVAPS] = nullptr;
+	t.fns[X86_INS_XORPD] = nullptr;
+	t.fns[X86_INS_XORPS] = nullptr;
+	t.fns[X86_INS_GETSEC] = nullptr;
+	t.fns[X86_INS_HADDPD] = nullptr;
+	t.fns[X86_INS_HADDPS] = nullptr;
+	t.fns[X86_INS_HLT] = &Capstone2LlvmIrTranslatorX86::translateHlt;
+	t.fns[X86_INS_HSUBPD] = nullptr;
+	t.fns[X86_INS_HSUBPS] = nullptr;
+	t.fns[X86_INS_IDIV] = &Capstone2LlvmIrTranslatorX86::translateDiv;
+	t.fns[X86_INS_FILD] = &Capstone2LlvmIrTranslatorX86::translateFld;
+	t.fns[X86_INS_IMUL] = &Capstone2LlvmIrTranslatorX86::translateImul;
+	t.fns[X86_INS_IN] = nullptr;
+	t.fns[X86_INS_INC] = &Capstone2LlvmIrTranslatorX86::translateInc;
+	t.fns[X86_INS_INSB] = &Capstone2LlvmIrTranslatorX86::translateIns;
+	t.fns[X86_INS_INSERTPS] = nullptr;
+	t.fns[X86_INS_INSERTQ] = nullptr;
+	t.fns[X86_INS_INSD] = &Capstone2LlvmIrTranslatorX86::translateIns;
+	t.fns[X86_INS_INSW] = &Capstone2LlvmIrTranslatorX86::translateIns;
+	t.fns[X86_INS_INT] = &Capstone2LlvmIrTranslatorX86::translateInt;
+	t.fns[X86_INS_INT1] = &Capstone2LlvmIrTranslatorX86::translateInt1;
+	t.fns[X86_INS_INT3] = &Capstone2LlvmIrTranslatorX86::translateInt3;
+	t.fns[X86_INS_INTO] = &Capstone2LlvmIrTranslatorX86::translateInto;
+	t.fns[X86_INS_INVD] = nullptr;
+	t.fns[X86_INS_INVEPT] = nullptr;
+	t.fns[X86_INS_INVLPG] = nullptr;
+	t.fns[X86_INS_INVLPGA] = nullptr;
+	t.fns[X86_INS_INVPCID] = nullptr;
+	t.fns[X86_INS_INVVPID] = nullptr;
+	t.fns[X86_INS_IRET] = nullptr;
+	t.fns[X86_INS_IRETD] = nullptr;
+	t.fns[X86_INS_IRETQ] = nullptr;
+	t.fns[X86_INS_FISTTP] = nullptr;
+	t.fns[X86_INS_FIST] = &Capstone2LlvmIrTranslatorX86::translateFist;
+	t.fns[X86_INS_FISTP] = &Capstone2LlvmIrTranslatorX86::translateFist;
+	t.fns[X86_INS_UCOMISD] = nullptr;
+	t.fns[X86_INS_UCOMISS] = nullptr;
+	t.fns[X86_INS_VCOMISD] = nullptr;
+	t.fns[X86_INS_VCOMISS] = nullptr;
+	t.fns[X86_INS_VCVTSD2SS] = nullptr;
+	t.fns[X86_INS_VCVTSI2SD] = nullptr;
+	t.fns[X86_INS_VCVTSI2SS] = nullptr;
+	t.fns[X86_INS_VCVTSS2SD] = nullptr;
+	t.fns[X86_INS_VCVTTSD2SI] = nullptr;
+	t.fns[X86_INS_VCVTTSD2USI] = nullptr;
+	t.fns[X86_INS_VCVTTSS2SI] = nullptr;
+	t.fns[X86_INS_VCVTTSS2USI] = nullptr;
+	t.fns[X86_INS_VCVTUSI2SD] = nullptr;
+	t.fns[X86_INS_VCVTUSI2SS] = nullptr;
+	t.fns[X86_INS_VUCOMISD] = nullptr;
+	t.fns[X86_INS_VUCOMISS] = nullptr;
+	t.fns[X86_INS_JAE] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JA] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JBE] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JB] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JCXZ] = &Capstone2LlvmIrTranslatorX86::translateJecxz;
+	t.fns[X86_INS_JECXZ] = &Capstone2LlvmIrTranslatorX86::translateJecxz;
+	t.fns[X86_INS_JE] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JGE] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JG] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JLE] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JL] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JMP] = &Capstone2LlvmIrTranslatorX86::translateJmp;
+	t.fns[X86_INS_JNE] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JNO] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JNP] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JNS] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JO] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JP] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_JRCXZ] = &Capstone2LlvmIrTranslatorX86::translateJecxz;
+	t.fns[X86_INS_JS] = &Capstone2LlvmIrTranslatorX86::translateJCc;
+	t.fns[X86_INS_KANDB] = nullptr;
+	t.fns[X86_INS_KANDD] = nullptr;
+	t.fns[X86_INS_KANDNB] = nullptr;
+	t.fns[X86_INS_KANDND] = nullptr;
+	t.fns[X86_INS_KANDNQ] = nullptr;
+	t.fns[X86_INS_KANDNW] = nullptr;
+	t.fns[X86_INS_KANDQ] = nullptr;
+	t.fns[X86_INS_KANDW] = nullptr;
+	t.fns[X86_INS_KMOVB] = nullptr;
+	t.fns[X86_INS_KMOVD] = nullptr;
+	t.fns[X86_INS_KMOVQ] = nullptr;
+	t.fns[X86_INS_KMOVW] = nullptr;
+	t.fns[X86_INS_KNOTB] = nullptr;
+	t.fns[X86_INS_KNOTD] = nullptr;
+	t.fns[X86_INS_KNOTQ] = nullptr;
+	t.fns[X86_INS_KNOTW] = nullptr;
+	t.fns[X86_INS_KORB] = nullptr;
+	t.fns[X86_INS_KORD] = nullptr;
+	t.fns[X86_INS_KORQ] = nullptr;
+	t.fns[X86_INS_KORTESTB] = nullptr;
+	t.fns[X86_INS_KORTESTD] = nullptr;
+	t.fns[X86_INS_KORTESTQ] = nullptr;
+	t.fns[X86_INS_KORTESTW] = nullptr;
+	t.fns[X86_INS_KORW] = nullptr;
+	t.fns[X86_INS_KSHIFTLB] = nullptr;
+	t.fns[X86_INS_KSHIFTLD] = nullptr;
+	t.fns[X86_INS_KSHIFTLQ] = nullptr;
+	t.fns[X86_INS_KSHIFTLW] = nullptr;
+	t.fns[X86_INS_KSHIFTRB] = nullptr;
+	t.fns[X86_INS_KSHIFTRD] = nullptr;
+	t.fns[X86_INS_KSHIFTRQ] = nullptr;
+	t.fns[X86_INS_KSHIFTRW] = nullptr;
+	t.fns[X86_INS_KUNPCKBW] = nullptr;
+	t.fns[X86_INS_KXNORB] = nullptr;
+	t.fns[X86_INS_KXNORD] = nullptr;
+	t.fns[X86_INS_KXNORQ] = nullptr;
+	t.fns[X86_INS_KXNORW] = nullptr;
+	t.fns[X86_INS_KXORB] = nullptr;
+	t.fns[X86_INS_KXORD] = nullptr;
+	t.fns[X86_INS_KXORQ] = nullptr;
+	t.fns[X86_INS_KXORW] = nullptr;
+	t.fns[X86_INS_LAHF] = &Capstone2LlvmIrTranslatorX86::translateLahf;
+	t.fns[X86_INS_LAR] = nullptr;
+	t.fns[X86_INS_LDDQU] = nullptr;
+	t.fns[X86_INS_LDMXCSR] = nullptr;
+	t.fns[X86_INS_LDS] = &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr;
+	t.fns[X86_INS_FLDZ] = &Capstone2LlvmIrTranslatorX86::translateFloadConstant;
+	t.fns[X86_INS_FLD1] = &Capstone2LlvmIrTranslatorX86::translateFloadConstant;
+	t.fns[X86_INS_FLD] = &Capstone2LlvmIrTranslatorX86::translateFld;
+	t.fns[X86_INS_LEA] = &Capstone2LlvmIrTranslatorX86::translateLea;
+	t.fns[X86_INS_LEAVE] = &Capstone2LlvmIrTranslatorX86::translateLeave;
+	t.fns[X86_INS_LES] = &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr;
+	t.fns[X86_INS_LFENCE] = nullptr;
+	t.fns[X86_INS_LFS] = &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr;
+	t.fns[X86_INS_LGDT] = nullptr;
+	t.fns[X86_INS_LGS] = &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr;
+	t.fns[X86_INS_LIDT] = nullptr;
+	t.fns[X86_INS_LLDT] = nullptr;
+	t.fns[X86_INS_LMSW] = nullptr;
+	t.fns[X86_INS_OR] = &Capstone2LlvmIrTranslatorX86::translateOr;
+	t.fns[X86_INS_SUB] = &Capstone2LlvmIrTranslatorX86::translateSub;
+	t.fns[X86_INS_XOR] = &Capstone2LlvmIrTranslatorX86::translateXor;
+	t.fns[X86_INS_LODSB] = &Capstone2LlvmIrTranslatorX86::translateLoadString;
+	t.fns[X86_INS_LODSD] = &Capstone2LlvmIrTranslatorX86::translateLoadString;
+	t.fns[X86_INS_LODSQ] = &Capstone2LlvmIrTranslatorX86::translateLoadString;
+	t.fns[X86_INS_LODSW] = &Capstone2LlvmIrTranslatorX86::translateLoadString;
+	t.fns[X86_INS_LOOP] = &Capstone2LlvmIrTranslatorX86::translateLoop;
+	t.fns[X86_INS_LOOPE] = &Capstone2LlvmIrTranslatorX86::translateLoop;
+	t.fns[X86_INS_LOOPNE] = &Capstone2LlvmIrTranslatorX86::translateLoop;
+	t.fns[X86_INS_RETF] = &Capstone2LlvmIrTranslatorX86::translateRet;
+	t.fns[X86_INS_RETFQ] = &Capstone2LlvmIrTranslatorX86::translateRet;
+	t.fns[X86_INS_LSL] = nullptr;
+	t.fns[X86_INS_LSS] = &Capstone2LlvmIrTranslatorX86::translateLoadFarPtr;
+	t.fns[X86_INS_LTR] = nullptr;
+	t.fns[X86_INS_XADD] = &Capstone2LlvmIrTranslatorX86::translateAdd;
+	t.fns[X86_INS_LZCNT] = nullptr;
+	t.fns[X86_INS_MASKMOVDQU] = nullptr;
+	t.fns[X86_INS_MAXPD] = nullptr;
+	t.fns[X86_INS_MAXPS] = nullptr;
+	t.fns[X86_INS_MAXSD] = nullptr;
+	t.fns[X86_INS_MAXSS] = nullptr;
+	t.fns[X86_INS_MFENCE] = nullptr;
+	t.fns[X86_INS_MINPD] = nullptr;
+	t.fns[X86_INS_MINPS] = nullptr;
+	t.fns[X86_INS_MINSD] = nullptr;
+	t.fns[X86_INS_MINSS] = nullptr;
+	t.fns[X86_INS_CVTPD2PI] = nullptr;
+	t.fns[X86_INS_CVTPI2PD] = nullptr;
+	t.fns[X86_INS_CVTPI2PS] = nullptr;
+	t.fns[X86_INS_CVTPS2PI] = nullptr;
+	t.fns[X86_INS_CVTTPD2PI] = nullptr;
+	t.fns[X86_INS_CVTTPS2PI] = nullptr;
+	t.fns[X86_INS_EMMS] = nullptr;
+	t.fns[X86_INS_MASKMOVQ] = nullptr;
+	t.fns[X86_INS_MOVD] = nullptr;
+	t.fns[X86_INS_MOVDQ2Q] = nullptr;
+	t.fns[X86_INS_MOVNTQ] = nullptr;
+	t.fns[X86_INS_MOVQ2DQ] = nullptr;
+	t.fns[X86_INS_MOVQ] = nullptr;
+	t.fns[X86_INS_PABSB] = nullptr;
+	t.fns[X86_INS_PABSD] = nullptr;
+	t.fns[X86_INS_PABSW] = nullptr;
+	t.fns[X86_INS_PACKSSDW] = nullptr;
+	t.fns[X86_INS_PACKSSWB] = nullptr;
+	t.fns[X86_INS_PACKUSWB] = nullptr;
+	t.fns[X86_INS_PADDB] = nullptr;
+	t.fns[X86_INS_PADDD] = nullptr;
+	t.fns[X86_INS_PADDQ] = nullptr;
+	t.fns[X86_INS_PADDSB] = nullptr;
+	t.fns[X86_INS_PADDSW] = nullptr;
+	t.fns[X86_INS_PADDUSB] = nullptr;
+	t.fns[X86_INS_PADDUSW] = nullptr;
+	t.fns[X86_INS_PADDW] = nullptr;
+	t.fns[X86_INS_PALIGNR] = nullptr;
+	t.fns[X86_INS_PANDN] = nullptr;
+	t.fns[X86_INS_PAND] = nullptr;
+	t.fns[X86_INS_PAVGB] = nullptr;
+	t.fns[X86_INS_PAVGW] = nullptr;
+	t.fns[X86_INS_PCMPEQB] = nullptr;
+	t.fns[X86_INS_PCMPEQD] = nullptr;
+	t.fns[X86_INS_PCMPEQW] = nullptr;
+	t.fns[X86_INS_PCMPGTB] = nullptr;
+	t.fns[X86_INS_PCMPGTD] = nullptr;
+	t.fns[X86_INS_PCMPGTW] = nullptr;
+	t.fns[X86_INS_PEXTRW] = nullptr;
+	t.fns[X86_INS_PHADDSW] = nullptr;
+	t.fns[X86_INS_PHADDW] = nullptr;
+	t.fns[X86_INS_PHADDD] = nullptr;
+	t.fns[X86_INS_PHSUBD] = nullptr;
+	t.fns[X86_INS_PHSUBSW] = nullptr;
+	t.fns[X86_INS_PHSUBW] = nullptr;
+	t.fns[X86_INS_PINSRW] = nullptr;
+	t.fns[X86_INS_PMADDUBSW] = nullptr;
+	t.fns[X86_INS_PMADDWD] = nullptr;
+	t.fns[X86_INS_PMAXSW] = nullptr;
+	t.fns[X86_INS_PMAXUB] = nullptr;
+	t.fns[X86_INS_PMINSW] = nullptr;
+	t.fns[X86_INS_PMINUB] = nullptr;
+	t.fns[X86_INS_PMOVMSKB] = nullptr;
+	t.fns[X86_INS_PMULHRSW] = nullptr;
+	t.fns[X86_INS_PMULHUW] = nullptr;
+	t.fns[X86_INS_PMULHW] = nullptr;
+	t.fns[X86_INS_PMULLW] = nullptr;
+	t.fns[X86_INS_PMULUDQ] = nullptr;
+	t.fns[X86_INS_POR] = nullptr;
+	t.fns[X86_INS_PSADBW] = nullptr;
+	t.fns[X86_INS_PSHUFB] = nullptr;
+	t.fns[X86_INS_PSHUFW] = nullptr;
+	t.fns[X86_INS_PSIGNB] = nullptr;
+	t.fns[X86_INS_PSIGND] = nullptr;
+	t.fns[X86_INS_PSIGNW] = nullptr;
+	t.fns[X86_INS_PSLLD] = nullptr;
+	t.fns[X86_INS_PSLLQ] = nullptr;
+	t.fns[X86_INS_PSLLW] = nullptr;
+	t.fns[X86_INS_PSRAD] = nullptr;
+	t.fns[X86_INS_PSRAW] = nullptr;
+	t.fns[X86_INS_PSRLD] = nullptr;
+	t.fns[X86_INS_PSRLQ] = nullptr;
+	t.fns[X86_INS_PSRLW] = nullptr;
+	t.fns[X86_INS_PSUBB] = nullptr;
+	t.fns[X86_INS_PSUBD] = nullptr;
+	t.fns[X86_INS_PSUBQ] = nullptr;
+	t.fns[X86_INS_PSUBSB] = nullptr;
+	t.fns[X86_INS_PSUBSW] = nullptr;
+	t.fns[X86_INS_PSUBUSB] = nullptr;
+	t.fns[X86_INS_PSUBUSW] = nullptr;
+	t.fns[X86_INS_PSUBW] = nullptr;
+	t.fns[X86_INS_PUNPCKHBW] = nullptr;
+	t.fns[X86_INS_PUNPCKHDQ] = nullptr;
+	t.fns[X86_INS_PUNPCKHWD] = nullptr;
+	t.fns[X86_INS_PUNPCKLBW] = nullptr;
+	t.fns[X86_INS_PUNPCKLDQ] = nullptr;
+	t.fns[X86_INS_PUNPCKLWD] = nullptr;
+	t.fns[X86_INS_PXOR] = nullptr;
+	t.fns[X86_INS_MONITOR] = nullptr;
+	t.fns[X86_INS_MONTMUL] = nullptr;
+	t.fns[X86_INS_MOV] = &Capstone2LlvmIrTranslatorX86::translateMov;
+	t.fns[X86_INS_MOVABS] = &Capstone2LlvmIrTranslatorX86::translateMov;
+	t.fns[X86_INS_MOVBE] = nullptr;
+	t.fns[X86_INS_MOVDDUP] = nullptr;
+	t.fns[X86_INS_MOVDQA] = nullptr;
+	t.fns[X86_INS_MOVDQU] = nullptr;
+	t.fns[X86_INS_MOVHLPS] = nullptr;
+	t.fns[X86_INS_MOVHPD] = nullptr;
+	t.fns[X86_INS_MOVHPS] = nullptr;
+	t.fns[X86_INS_MOVLHPS] = nullptr;
+	t.fns[X86_INS_MOVLPD] = nullptr;
+	t.fns[X86_INS_MOVLPS] = nullptr;
+	t.fns[X86_INS_MOVMSKPD] = nullptr;
+	t.fns[X86_INS_MOVMSKPS] = nullptr;
+	t.fns[X86_INS_MOVNTDQA] = nullptr;
+	t.fns[X86_INS_MOVNTDQ] = nullptr;
+	t.fns[X86_INS_MOVNTI] = nullptr;
+	t.fns[X86_INS_MOVNTPD] = nullptr;
+	t.fns[X86_INS_MOVNTPS] = nullptr;
+	t.fns[X86_INS_MOVNTSD] = nullptr;
+	t.fns[X86_INS_MOVNTSS] = nullptr;
+	t.fns[X86_INS_MOVSB] = &Capstone2LlvmIrTranslatorX86::translateMoveString;
+	t.fns[X86_INS_MOVSD] = &Capstone2LlvmIrTranslatorX86::translateMoveString;
+	t.fns[X86_INS_MOVSHDUP] = nullptr;
+	t.fns[X86_INS_MOVSLDUP] = nullptr;
+	t.fns[X86_INS_MOVSQ] = &Capstone2LlvmIrTranslatorX86::translateMoveString;
+	t.fns[X86_INS_MOVSS] = nullptr;
+	t.fns[X86_INS_MOVSW] = &Capstone2LlvmIrTranslatorX86::translateMoveString;
+	t.fns[X86_INS_MOVSX] = &Capstone2LlvmIrTranslatorX86::translateMov;
+	t.fns[X86_INS_MOVSXD] = &Capstone2LlvmIrTranslatorX86::translateMov;
+	t.fns[X86_INS_MOVUPD] = nullptr;
+	t.fns[X86_INS_MOVUPS] = nullptr;
+	t.fns[X86_INS_MOVZX] = &Capstone2LlvmIrTranslatorX86::translateMov;
+	t.fns[X86_INS_MPSADBW] = nullptr;
+	t.fns[X86_INS_MUL] = &Capstone2LlvmIrTranslatorX86::translateMul;
+	t.fns[X86_INS_MULPD] = nullptr;
+	t.fns[X86_INS_MULPS] = nullptr;
+	t.fns[X86_INS_MULSD] = nullptr;
+	t.fns[X86_INS_MULSS] = nullptr;
+	t.fns[X86_INS_MULX] = nullptr;
+	t.fns[X86_INS_FMUL] = &Capstone2LlvmIrTranslatorX86::translateFmul;
+	t.fns[X86_INS_FIMUL] = &Capstone2LlvmIrTranslatorX86::translateFmul;
+	t.fns[X86_INS_FMULP] = &Capstone2LlvmIrTranslatorX86::translateFmul;
+	t.fns[X86_INS_MWAIT] = nullptr;
+	t.fns[X86_INS_NEG] = &Capstone2LlvmIrTranslatorX86::translateNeg;
+	t.fns[X86_INS_NOP] = &Capstone2LlvmIrTranslatorX86::translateNop;
+	t.fns[X86_INS_NOT] = &Capstone2LlvmIrTranslatorX86::translateNot;
+	t.fns[X86_INS_OUT] = nullptr;
+	t.fns[X86_INS_OUTSB] = &Capstone2LlvmIrTranslatorX86::translateOuts;
+	t.fns[X86_INS_OUTSD] = &Capstone2LlvmIrTranslatorX86::translateOuts;
+	t.fns[X86_INS_OUTSW] = &Capstone2LlvmIrTranslatorX86::translateOuts;
+	t.fns[X86_INS_PACKUSDW] = nullptr;
+	t.fns[X86_INS_PAUSE] = nullptr;
+	t.fns[X86_INS_PAVGUSB] = nullptr;
+	t.fns[X86_INS_PBLENDVB] = nullptr;
+	t.fns[X86_INS_PBLENDW] = nullptr;
+	t.fns[X86_INS_PCLMULQDQ] = nullptr;
+	t.fns[X86_INS_PCMPEQQ] = nullptr;
+	t.fns[X86_INS_PCMPESTRI] = nullptr;
+	t.fns[X86_INS_PCMPESTRM] = nullptr;
+	t.fns[X86_INS_PCMPGTQ] = nullptr;
+	t.fns[X86_INS_PCMPISTRI] = nullptr;
+	t.fns[X86_INS_PCMPISTRM] = nullptr;
+	t.fns[X86_INS_PCOMMIT] = nullptr;
+	t.fns[X86_INS_PDEP] = nullptr;
+	t.fns[X86_INS_PEXT] = nullptr;
+	t.fns[X86_INS_PEXTRB] = nullptr;
+	t.fns[X86_INS_PEXTRD] = nullptr;
+	t.fns[X86_INS_PEXTRQ] = nullptr;
+	t.fns[X86_INS_PF2ID] = nullptr;
+	t.fns[X86_INS_PF2IW] = nullptr;
+	t.fns[X86_INS_PFACC] = nullptr;
+	t.fns[X86_INS_PFADD] = nullptr;
+	t.fns[X86_INS_PFCMPEQ] = nullptr;
+	t.fns[X86_INS_PFCMPGE] = nullptr;
+	t.fns[X86_INS_PFCMPGT] = nullptr;
+	t.fns[X86_INS_PFMAX] = nullptr;
+	t.fns[X86_INS_PFMIN] = nullptr;
+	t.fns[X86_INS_PFMUL] = nullptr;
+	t.fns[X86_INS_PFNACC] = nullptr;
+	t.fns[X86_INS_PFPNACC] = nullptr;
+	t.fns[X86_INS_PFRCPIT1] = nullptr;
+	t.fns[X86_INS_PFRCPIT2] = nullptr;
+	t.fns[X86_INS_PFRCP] = nullptr;
+	t.fns[X86_INS_PFRSQIT1] = nullptr;
+	t.fns[X86_INS_PFRSQRT] = nullptr;
+	t.fns[X86_INS_PFSUBR] = nullptr;
+	t.fns[X86_INS_PFSUB] = nullptr;
+	t.fns[X86_INS_PHMINPOSUW] = nullptr;
+	t.fns[X86_INS_PI2FD] = nullptr;
+	t.fns[X86_INS_PI2FW] = nullptr;
+	t.fns[X86_INS_PINSRB] = nullptr;
+	t.fns[X86_INS_PINSRD] = nullptr;
+	t.fns[X86_INS_PINSRQ] = nullptr;
+	t.fns[X86_INS_PMAXSB] = nullptr;
+	t.fns[X86_INS_PMAXSD] = nullptr;
+	t.fns[X86_INS_PMAXUD] = nullptr;
+	t.fns[X86_INS_PMAXUW] = nullptr;
+	t.fns[X86_INS_PMINSB] = nullptr;
+	t.fns[X86_INS_PMINSD] = nullptr;
+	t.fns[X86_INS_PMINUD] = nullptr;
+	t.fns[X86_INS_PMINUW] = nullptr;
+	t.fns[X86_INS_PMOVSXBD] = nullptr;
+	t.fns[X86_INS_PMOVSXBQ] = nullptr;
+	t.fns[X86_INS_PMOVSXBW] = nullptr;
+	t.fns[X86_INS_PMOVSXDQ] = nullptr;
+	t.fns[X86_INS_PMOVSXWD] = nullptr;
+	t.fns[X86_INS_PMOVSXWQ] = nullptr;
+	t.fns[X86_INS_PMOVZXBD] = nullptr;
+	t.fns[X86_INS_PMOVZXBQ] = nullptr;
+	t.fns[X86_INS_PMOVZXBW] = nullptr;
+	t.fns[X86_INS_PMOVZXDQ] = nullptr;
+	t.fns[X86_INS_PMOVZXWD] = nullptr;
+	t.fns[X86_INS_PMOVZXWQ] = nullptr;
+	t.fns[X86_INS_PMULDQ] = nullptr;
+	t.fns[X86_INS_PMULHRW] = nullptr;
+	t.fns[X86_INS_PMULLD] = nullptr;
+	t.fns[X86_INS_POP] = &Capstone2LlvmIrTranslatorX86::translatePop;
+	t.fns[X86_INS_POPAW] = &Capstone2LlvmIrTranslatorX86::translatePopa; // X86_INS_POPAW == POPA
+	t.fns[X86_INS_POPAL] = &Capstone2LlvmIrTranslatorX86::translatePopa; // X86_INS_POPAL == POPAD
+	t.fns[X86_INS_POPCNT] = nullptr;
+	t.fns[X86_INS_POPF] = &Capstone2LlvmIrTranslatorX86::translatePopEflags;
+	t.fns[X86_INS_POPFD] = &Capstone2LlvmIrTranslatorX86::translatePopEflags;
+	t.fns[X86_INS_POPFQ] = &Capstone2LlvmIrTranslatorX86::translatePopEflags;
+	t.fns[X86_INS_PREFETCH] = nullptr;
+	t.fns[X86_INS_PREFETCHNTA] = nullptr;
+	t.fns[X86_INS_PREFETCHT0] = nullptr;
+	t.fns[X86_INS_PREFETCHT1] = nullptr;
+	t.fns[X86_INS_PREFETCHT2] = nullptr;
+	t.fns[X86_INS_PREFETCHW] = nullptr;
+	t.fns[X86_INS_PSHUFD] = nullptr;
+	t.fns[X86_INS_PSHUFHW] = nullptr;
+	t.fns[X86_INS_PSHUFLW] = nullptr;
+	t.fns[X86_INS_PSLLDQ] = nullptr;
+	t.fns[X86_INS_PSRLDQ] = nullptr;
+	t.fns[X86_INS_PSWAPD] = nullptr;
+	t.fns[X86_INS_PTEST] = nullptr;
+	t.fns[X86_INS_PUNPCKHQDQ] = nullptr;
+	t.fns[X86_INS_PUNPCKLQDQ] = nullptr;
+	t.fns[X86_INS_PUSH] = &Capstone2LlvmIrTranslatorX86::translatePush;
+	t.fns[X86_INS_PUSHAW] = &Capstone2LlvmIrTranslatorX86::translatePusha; // X86_INS_PUSHAW = PUSHA
+	t.fns[X86_INS_PUSHAL] = &Capstone2LlvmIrTranslatorX86::translatePusha; // X86_INS_PUSHAL = PUSHAD
+	t.fns[X86_INS_PUSHF] = &Capstone2LlvmIrTranslatorX86::translatePushEflags;
+	t.fns[X86_INS_PUSHFD] = &Capstone2LlvmIrTranslatorX86::translatePushEflags;
+	t.fns[X86_INS_PUSHFQ] = &Capstone2LlvmIrTranslatorX86::translatePushEflags;
+	t.fns[X86_INS_RCL] = &Capstone2LlvmIrTranslatorX86::translateRcl;
+	t.fns[X86_INS_RCPPS] = nullptr;
+	t.fns[X86_INS_RCPSS] = nullptr;
+	t.fns[X86_INS_RCR] = &Capstone2LlvmIrTranslatorX86::translateRcr;
+	t.fns[X86_INS_RDFSBASE] = nullptr;
+	t.fns[X86_INS_RDGSBASE] = nullptr;
+	t.fns[X86_INS_RDMSR] = nullptr;
+	t.fns[X86_INS_RDPMC] = nullptr;
+	t.fns[X86_INS_RDRAND] = nullptr;
+	t.fns[X86_INS_RDSEED] = nullptr;
+	t.fns[X86_INS_RDTSC] = &Capstone2LlvmIrTranslatorX86::translateRdtsc;
+	t.fns[X86_INS_RDTSCP] = &Capstone2LlvmIrTranslatorX86::translateRdtscp;
+	t.fns[X86_INS_ROL] = &Capstone2LlvmIrTranslatorX86::translateRol;
+	t.fns[X86_INS_ROR] = &Capstone2LlvmIrTranslatorX86::translateRor;
+	t.fns[X86_INS_RORX] = nullptr;
+	t.fns[X86_INS_ROUNDPD] = nullptr;
+	t.fns[X86_INS_ROUNDPS] = nullptr;
+	t.fns[X86_INS_ROUNDSD] = nullptr;
+	t.fns[X86_INS_ROUNDSS] = nullptr;
+	t.fns[X86_INS_RSM] = nullptr;
+	t.fns[X86_INS_RSQRTPS] = nullptr;
+	t.fns[X86_INS_RSQRTSS] = nullptr;
+	t.fns[X86_INS_SAHF] = &Capstone2LlvmIrTranslatorX86::translateSahf;
+	t.fns[X86_INS_SAL] = &Capstone2LlvmIrTranslatorX86::translateShiftLeft;
+	t.fns[X86_INS_SALC] = &Capstone2LlvmIrTranslatorX86::translateSalc;
+	t.fns[X86_INS_SAR] = &Capstone2LlvmIrTranslatorX86::translateShiftRight;
+	t.fns[X86_INS_SARX] = nullptr;
+	t.fns[X86_INS_SBB] = &Capstone2LlvmIrTranslatorX86::translateSbb;
+	t.fns[X86_INS_SCASB] = &Capstone2LlvmIrTranslatorX86::translateScanString;
+	t.fns[X86_INS_SCASD] = &Capstone2LlvmIrTranslatorX86::translateScanString;
+	t.fns[X86_INS_SCASQ] = &Capstone2LlvmIrTranslatorX86::translateScanString;
+	t.fns[X86_INS_SCASW] = &Capstone2LlvmIrTranslatorX86::translateScanString;
+	t.fns[X86_INS_SETAE] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETA] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETBE] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETB] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETE] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETGE] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETG] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETLE] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETL] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETNE] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETNO] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETNP] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETNS] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETO] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETP] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SETS] = &Capstone2LlvmIrTranslatorX86::translateSetCc;
+	t.fns[X86_INS_SFENCE] = nullptr;
+	t.fns[X86_INS_SGDT] = nullptr;
+	t.fns[X86_INS_SHA1MSG1] = nullptr;
+	t.fns[X86_INS_SHA1MSG2] = nullptr;
+	t.fns[X86_INS_SHA1NEXTE] = nullptr;
+	t.fns[X86_INS_SHA1RNDS4] = nullptr;
+	t.fns[X86_INS_SHA256MSG1] = nullptr;
+	t.fns[X86_INS_SHA256MSG2] = nullptr;
+	t.fns[X86_INS_SHA256RNDS2] = nullptr;
+	t.fns[X86_INS_SHL] = &Capstone2LlvmIrTranslatorX86::translateShiftLeft;
+	t.fns[X86_INS_SHLD] = &Capstone2LlvmIrTranslatorX86::translateShld;
+	t.fns[X86_INS_SHLX] = nullptr;
+	t.fns[X86_INS_SHR] = &Capstone2LlvmIrTranslatorX86::translateShiftRight;
+	t.fns[X86_INS_SHRD] = &Capstone2LlvmIrTranslatorX86::translateShrd;
+	t.fns[X86_INS_SHRX] = nullptr;
+	t.fns[X86_INS_SHUFPD] = nullptr;
+	t.fns[X86_INS_SHUFPS] = nullptr;
+	t.fns[X86_INS_SIDT] = nullptr;
+	t.fns[X86_INS_FSIN] = &Capstone2LlvmIrTranslatorX86::translateFsin;
+	t.fns[X86_INS_SKINIT] = nullptr;
+	t.fns[X86_INS_SLDT] = nullptr;
+	t.fns[X86_INS_SMSW] = nullptr;
+	t.fns[X86_INS_SQRTPD] = nullptr;
+	t.fns[X86_INS_SQRTPS] = nullptr;
+	t.fns[X86_INS_SQRTSD] = nullptr;
+	t.fns[X86_INS_SQRTSS] = nullptr;
+	t.fns[X86_INS_FSQRT] = &Capstone2LlvmIrTranslatorX86::translateFsqrt;
+	t.fns[X86_INS_STAC] = nullptr;
+	t.fns[X86_INS_STC] = &Capstone2LlvmIrTranslatorX86::translateStc;
+	t.fns[X86_INS_STD] = &Capstone2LlvmIrTranslatorX86::translateStd;
+	t.fns[X86_INS_STGI] = nullptr;
+	t.fns[X86_INS_STI] = nullptr;
+	t.fns[X86_INS_STMXCSR] = nullptr;
+	t.fns[X86_INS_STOSB] = &Capstone2LlvmIrTranslatorX86::translateStoreString;
+	t.fns[X86_INS_STOSD] = &Capstone2LlvmIrTranslatorX86::translateStoreString;
+	t.fns[X86_INS_STOSQ] = &Capstone2LlvmIrTranslatorX86::translateStoreString;
+	t.fns[X86_INS_STOSW] = &Capstone2LlvmIrTranslatorX86::translateStoreString;
+	t.fns[X86_INS_STR] = nullptr;
+	t.fns[X86_INS_FST] = &Capstone2LlvmIrTranslatorX86::translateFst;
+	t.fns[X86_INS_FSTP] = &Capstone2LlvmIrTranslatorX86::translateFst;
+	t.fns[X86_INS_FSTPNCE] = nullptr;
+	t.fns[X86_INS_FXCH] = &Capstone2LlvmIrTranslatorX86::translateFxch;
+	t.fns[X86_INS_SUBPD] = nullptr;
+	t.fns[X86_INS_SUBPS] = nullptr;
+	t.fns[X86_INS_FSUBR] = &Capstone2LlvmIrTranslatorX86::translateFsubr;
+	t.fns[X86_INS_FISUBR] = &Capstone2LlvmIrTranslatorX86::translateFsubr;
+	t.fns[X86_INS_FSUBRP] = &Capstone2LlvmIrTranslatorX86::translateFsubr;
+	t.fns[X86_INS_SUBSD] = nullptr;
+	t.fns[X86_INS_SUBSS] = nullptr;
+	t.fns[X86_INS_FSUB] = &Capstone2LlvmIrTranslatorX86::translateFsub;
+	t.fns[X86_INS_FISUB] = &Capstone2LlvmIrTranslatorX86::translateFsub;
+	t.fns[X86_INS_FSUBP] = &Capstone2LlvmIrTranslatorX86::translateFsub;
+	t.fns[X86_INS_SWAPGS] = nullptr;
+	t.fns[X86_INS_SYSCALL] = nullptr;
+	t.fns[X86_INS_SYSENTER] = nullptr;
+	t.fns[X86_INS_SYSEXIT] = nullptr;
+	t.fns[X86_INS_SYSRET] = nullptr;
+	t.fns[X86_INS_T1MSKC] = nullptr;
+	t.fns[X86_INS_TEST] = &Capstone2LlvmIrTranslatorX86::translateAnd;
+	t.fns[X86_INS_UD2] = &Capstone2LlvmIrTranslatorX86::translateNop;
+	t.fns[X86_INS_FTST] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_TZCNT] = nullptr;
+	t.fns[X86_INS_TZMSK] = nullptr;
+	t.fns[X86_INS_FUCOMIP] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FUCOMI] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FUCOMPP] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FUCOMP] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_FUCOM] = &Capstone2LlvmIrTranslatorX86::translateFucomPop;
+	t.fns[X86_INS_UD2B] = &Capstone2LlvmIrTranslatorX86::translateNop;
+	t.fns[X86_INS_UNPCKHPD] = nullptr;
+	t.fns[X86_INS_UNPCKHPS] = nullptr;
+	t.fns[X86_INS_UNPCKLPD] = nullptr;
+	t.fns[X86_INS_UNPCKLPS] = nullptr;
+	t.fns[X86_INS_VADDPD] = nullptr;
+	t.fns[X86_INS_VADDPS] = nullptr;
+	t.fns[X86_INS_VADDSD] = nullptr;
+	t.fns[X86_INS_VADDSS] = nullptr;
+	t.fns[X86_INS_VADDSUBPD] = nullptr;
+	t.fns[X86_INS_VADDSUBPS] = nullptr;
+	t.fns[X86_INS_VAESDECLAST] = nullptr;
+	t.fns[X86_INS_VAESDEC] = nullptr;
+	t.fns[X86_INS_VAESENCLAST] = nullptr;
+	t.fns[X86_INS_VAESENC] = nullptr;
+	t.fns[X86_INS_VAESIMC] = nullptr;
+	t.fns[X86_INS_VAESKEYGENASSIST] = nullptr;
+	t.fns[X86_INS_VALIGND] = nullptr;
+	t.fns[X86_INS_VALIGNQ] = nullptr;
+	t.fns[X86_INS_VANDNPD] = nullptr;
+	t.fns[X86_INS_VANDNPS] = nullptr;
+	t.fns[X86_INS_VANDPD] = nullptr;
+	t.fns[X86_INS_VANDPS] = nullptr;
+	t.fns[X86_INS_VBLENDMPD] = nullptr;
+	t.fns[X86_INS_VBLENDMPS] = nullptr;
+	t.fns[X86_INS_VBLENDPD] = nullptr;
+	t.fns[X86_INS_VBLENDPS] = nullptr;
+	t.fns[X86_INS_VBLENDVPD] = nullptr;
+	t.fns[X86_INS_VBLENDVPS] = nullptr;
+	t.fns[X86_INS_VBROADCASTF128] = nullptr;
+	t.fns[X86_INS_VBROADCASTI32X4] = nullptr;
+	t.fns[X86_INS_VBROADCASTI64X4] = nullptr;
+	t.fns[X86_INS_VBROADCASTSD] = nullptr;
+	t.fns[X86_INS_VBROADCASTSS] = nullptr;
+	t.fns[X86_INS_VCOMPRESSPD] = nullptr;
+	t.fns[X86_INS_VCOMPRESSPS] = nullptr;
+	t.fns[X86_INS_VCVTDQ2PD] = nullptr;
+	t.fns[X86_INS_VCVTDQ2PS] = nullptr;
+	t.fns[X86_INS_VCVTPD2DQX] = nullptr;
+	t.fns[X86_INS_VCVTPD2DQ] = nullptr;
+	t.fns[X86_INS_VCVTPD2PSX] = nullptr;
+	t.fns[X86_INS_VCVTPD2PS] = nullptr;
+	t.fns[X86_INS_VCVTPD2UDQ] = nullptr;
+	t.fns[X86_INS_VCVTPH2PS] = nullptr;
+	t.fns[X86_INS_VCVTPS2DQ] = nullptr;
+	t.fns[X86_INS_VCVTPS2PD] = nullptr;
+	t.fns[X86_INS_VCVTPS2PH] = nullptr;
+	t.fns[X86_INS_VCVTPS2UDQ] = nullptr;
+	t.fns[X86_INS_VCVTSD2SI] = nullptr;
+	t.fns[X86_INS_VCVTSD2USI] = nullptr;
+	t.fns[X86_INS_VCVTSS2SI] = nullptr;
+	t.fns[X86_INS_VCVTSS2USI] = nullptr;
+	t.fns[X86_INS_VCVTTPD2DQX] = nullptr;
+	t.fns[X86_INS_VCVTTPD2DQ] = nullptr;
+	t.fns[X86_INS_VCVTTPD2UDQ] = nullptr;
+	t.fns[X86_INS_VCVTTPS2DQ] = nullptr;
+	t.fns[X86_INS_VCVTTPS2UDQ] = nullptr;
+	t.fns[X86_INS_VCVTUDQ2PD] = nullptr;
+	t.fns[X86_INS_VCVTUDQ2PS] = nullptr;
+	t.fns[X86_INS_VDIVPD] = nullptr;
+	t.fns[X86_INS_VDIVPS] = nullptr;
+	t.fns[X86_INS_VDIVSD] = nullptr;
+	t.fns[X86_INS_VDIVSS] = nullptr;
+	t.fns[X86_INS_VDPPD] = nullptr;
+	t.fns[X86_INS_VDPPS] = nullptr;
+	t.fns[X86_INS_VERR] = nullptr;
+	t.fns[X86_INS_VERW] = nullptr;
+	t.fns[X86_INS_VEXP2PD] = nullptr;
+	t.fns[X86_INS_VEXP2PS] = nullptr;
+	t.fns[X86_INS_VEXPANDPD] = nullptr;
+	t.fns[X86_INS_VEXPANDPS] = nullptr;
+	t.fns[X86_INS_VEXTRACTF128] = nullptr;
+	t.fns[X86_INS_VEXTRACTF32X4] = nullptr;
+	t.fns[X86_INS_VEXTRACTF64X4] = nullptr;
+	t.fns[X86_INS_VEXTRACTI128] = nullptr;
+	t.fns[X86_INS_VEXTRACTI32X4] = nullptr;
+	t.fns[X86_INS_VEXTRACTI64X4] = nullptr;
+	t.fns[X86_INS_VEXTRACTPS] = nullptr;
+	t.fns[X86_INS_VFMADD132PD] = nullptr;
+	t.fns[X86_INS_VFMADD132PS] = nullptr;
+	t.fns[X86_INS_VFMADDPD] = nullptr;
+	t.fns[X86_INS_VFMADD213PD] = nullptr;
+	t.fns[X86_INS_VFMADD231PD] = nullptr;
+	t.fns[X86_INS_VFMADDPS] = nullptr;
+	t.fns[X86_INS_VFMADD213PS] = nullptr;
+	t.fns[X86_INS_VFMADD231PS] = nullptr;
+	t.fns[X86_INS_VFMADDSD] = nullptr;
+	t.fns[X86_INS_VFMADD213SD] = nullptr;
+	t.fns[X86_INS_VFMADD132SD] = nullptr;
+	t.fns[X86_INS_VFMADD231SD] = nullptr;
+	t.fns[X86_INS_VFMADDSS] = nullptr;
+	t.fns[X86_INS_VFMADD213SS] = nullptr;
+	t.fns[X86_INS_VFMADD132SS] = nullptr;
+	t.fns[X86_INS_VFMADD231SS] = nullptr;
+	t.fns[X86_INS_VFMADDSUB132PD] = nullptr;
+	t.fns[X86_INS_VFMADDSUB132PS] = nullptr;
+	t.fns[X86_INS_VFMADDSUBPD] = nullptr;
+	t.fns[X86_INS_VFMADDSUB213PD] = nullptr;
+	t.fns[X86_INS_VFMADDSUB231PD] = nullptr;
+	t.fns[X86_INS_VFMADDSUBPS] = nullptr;
+	t.fns[X86_INS_VFMADDSUB213PS] = nullptr;
+	t.fns[X86_INS_VFMADDSUB231PS] = nullptr;
+	t.fns[X86_INS_VFMSUB132PD] = nullptr;
+	t.fns[X86_INS_VFMSUB132PS] = nullptr;
+	t.fns[X86_INS_VFMSUBADD132PD] = nullptr;
+	t.fns[X86_INS_VFMSUBADD132PS] = nullptr;
+	t.fns[X86_INS_VFMSUBADDPD] = nullptr;
+	t.fns[X86_INS_VFMSUBADD213PD] = nullptr;
+	t.fns[X86_INS_VFMSUBADD231PD] = nullptr;
+	t.fns[X86_INS_VFMSUBADDPS] = nullptr;
+	t.fns[X86_INS_VFMSUBADD213PS] = nullptr;
+	t.fns[X86_INS_VFMSUBADD231PS] = nullptr;
+	t.fns[X86_INS_VFMSUBPD] = nullptr;
+	t.fns[X86_INS_VFMSUB213PD] = nullptr;
+	t.fns[X86_INS_VFMSUB231PD] = nullptr;
+	t.fns[X86_INS_VFMSUBPS] = nullptr;
+	t.fns[X86_INS_VFMSUB213PS] = nullptr;
+	t.fns[X86_INS_VFMSUB231PS] = nullptr;
+	t.fns[X86_INS_VFMSUBSD] = nullptr;
+	t.fns[X86_INS_VFMSUB213SD] = nullptr;
+	t.fns[X86_INS_VFMSUB132SD] = nullptr;
+	t.fns[X86_INS_VFMSUB231SD] = nullptr;
+	t.fns[X86_INS_VFMSUBSS] = nullptr;
+	t.fns[X86_INS_VFMSUB213SS] = nullptr;
+	t.fns[X86_INS_VFMSUB132SS] = nullptr;
+	t.fns[X86_INS_VFMSUB231SS] = nullptr;
+	t.fns[X86_INS_VFNMADD132PD] = nullptr;
+	t.fns[X86_INS_VFNMADD132PS] = nullptr;
+	t.fns[X86_INS_VFNMADDPD] = nullptr;
+	t.fns[X86_INS_VFNMADD213PD] = nullptr;
+	t.fns[X86_INS_VFNMADD231PD] = nullptr;
+	t.fns[X86_INS_VFNMADDPS] = nullptr;
+	t.fns[X86_INS_VFNMADD213PS] = nullptr;
+	t.fns[X86_INS_VFNMADD231PS] = nullptr;
+	t.fns[X86_INS_VFNMADDSD] = nullptr;
+	t.fns[X86_INS_VFNMADD213SD] = nullptr;
+	t.fns[X86_INS_VFNMADD132SD] = nullptr;
+	t.fns[X86_INS_VFNMADD231SD] = nullptr;
+	t.fns[X86_INS_VFNMADDSS] = nullptr;
+	t.fns[X86_INS_VFNMADD213SS] = nullptr;
+	t.fns[X86_INS_VFNMADD132SS] = nullptr;
+	t.fns[X86_INS_VFNMADD231SS] = nullptr;
+	t.fns[X86_INS_VFNMSUB132PD] = nullptr;
+	t.fns[X86_INS_VFNMSUB132PS] = nullptr;
+	t.fns[X86_INS_VFNMSUBPD] = nullptr;
+	t.fns[X86_INS_VFNMSUB213PD] = nullptr;
+	t.fns[X86_INS_VFNMSUB231PD] = nullptr;
+	t.fns[X86_INS_VFNMSUBPS] = nullptr;
+	t.fns[X86_INS_VFNMSUB213PS] = nullptr;
+	t.fns[X86_INS_VFNMSUB231PS] = nullptr;
+	t.fns[X86_INS_VFNMSUBSD] = nullptr;
+	t.fns[X86_INS_VFNMSUB213SD] = nullptr;
+	t.fns[X86_INS_VFNMSUB132SD] = nullptr;
+	t.fns[X86_INS_VFNMSUB231SD] = nullptr;
+	t.fns[X86_INS_VFNMSUBSS] = nullptr;
+	t.fns[X86_INS_VFNMSUB213SS] = nullptr;
+	t.fns[X86_INS_VFNMSUB132SS] = nullptr;
+	t.fns[X86_INS_VFNMSUB231SS] = nullptr;
+	t.fns[X86_INS_VFRCZPD] = nullptr;
+	t.fns[X86_INS_VFRCZPS] = nullptr;
+	t.fns[X86_INS_VFRCZSD] = nullptr;
+	t.fns[X86_INS_VFRCZSS] = nullptr;
+	t.fns[X86_INS_VORPD] = nullptr;
+	t.fns[X86_INS_VORPS] = nullptr;
+	t.fns[X86_INS_VXORPD] = nullptr;
+	t.fns[X86_INS_VXORPS] = nullptr;
+	t.fns[X86_INS_VGATHERDPD] = nullptr;
+	t.fns[X86_INS_VGATHERDPS] = nullptr;
+	t.fns[X86_INS_VGATHERPF0DPD] = nullptr;
+	t.fns[X86_INS_VGATHERPF0DPS] = nullptr;
+	t.fns[X86_INS_VGATHERPF0QPD] = nullptr;
+	t.fns[X86_INS_VGATHERPF0QPS] = nullptr;
+	t.fns[X86_INS_VGATHERPF1DPD] = nullptr;
+	t.fns[X86_INS_VGATHERPF1DPS] = nullptr;
+	t.fns[X86_INS_VGATHERPF1QPD] = nullptr;
+	t.fns[X86_INS_VGATHERPF1QPS] = nullptr;
+	t.fns[X86_INS_VGATHERQPD] = nullptr;
+	t.fns[X86_INS_VGATHERQPS] = nullptr;
+	t.fns[X86_INS_VHADDPD] = nullptr;
+	t.fns[X86_INS_VHADDPS] = nullptr;
+	t.fns[X86_INS_VHSUBPD] = nullptr;
+	t.fns[X86_INS_VHSUBPS] = nullptr;
+	t.fns[X86_INS_VINSERTF128] = nullptr;
+	t.fns[X86_INS_VINSERTF32X4] = nullptr;
+	t.fns[X86_INS_VINSERTF32X8] = nullptr;
+	t.fns[X86_INS_VINSERTF64X2] = nullptr;
+	t.fns[X86_INS_VINSERTF64X4] = nullptr;
+	t.fns[X86_INS_VINSERTI128] = nullptr;
+	t.fns[X86_INS_VINSERTI32X4] = nullptr;
+	t.fns[X86_INS_VINSERTI32X8] = nullptr;
+	t.fns[X86_INS_VINSERTI64X2] = nullptr;
+	t.fns[X86_INS_VINSERTI64X4] = nullptr;
+	t.fns[X86_INS_VINSERTPS] = nullptr;
+	t.fns[X86_INS_VLDDQU] = nullptr;
+	t.fns[X86_INS_VLDMXCSR] = nullptr;
+	t.fns[X86_INS_VMASKMOVDQU] = nullptr;
+	t.fns[X86_INS_VMASKMOVPD] = nullptr;
+	t.fns[X86_INS_VMASKMOVPS] = nullptr;
+	t.fns[X86_INS_VMAXPD] = nullptr;
+	t.fns[X86_INS_VMAXPS] = nullptr;
+	t.fns[X86_INS_VMAXSD] = nullptr;
+	t.fns[X86_INS_VMAXSS] = nullptr;
+	t.fns[X86_INS_VMCALL] = nullptr;
+	t.fns[X86_INS_VMCLEAR] = nullptr;
+	t.fns[X86_INS_VMFUNC] = nullptr;
+	t.fns[X86_INS_VMINPD] = nullptr;
+	t.fns[X86_INS_VMINPS] = nullptr;
+	t.fns[X86_INS_VMINSD] = nullptr;
+	t.fns[X86_INS_VMINSS] = nullptr;
+	t.fns[X86_INS_VMLAUNCH] = nullptr;
+	t.fns[X86_INS_VMLOAD] = nullptr;
+	t.fns[X86_INS_VMMCALL] = nullptr;
+	t.fns[X86_INS_VMOVQ] = nullptr;
+	t.fns[X86_INS_VMOVDDUP] = nullptr;
+	t.fns[X86_INS_VMOVD] = nullptr;
+	t.fns[X86_INS_VMOVDQA32] = nullptr;
+	t.fns[X86_INS_VMOVDQA64] = nullptr;
+	t.fns[X86_INS_VMOVDQA] = nullptr;
+	t.fns[X86_INS_VMOVDQU16] = nullptr;
+	t.fns[X86_INS_VMOVDQU32] = nullptr;
+	t.fns[X86_INS_VMOVDQU64] = nullptr;
+	t.fns[X86_INS_VMOVDQU8] = nullptr;
+	t.fns[X86_INS_VMOVDQU] = nullptr;
+	t.fns[X86_INS_VMOVHLPS] = nullptr;
+	t.fns[X86_INS_VMOVHPD] = nullptr;
+	t.fns[X86_INS_VMOVHPS] = nullptr;
+	t.fns[X86_INS_VMOVLHPS] = nullptr;
+	t.fns[X86_INS_VMOVLPD] = nullptr;
+	t.fns[X86_INS_VMOVLPS] = nullptr;
+	t.fns[X86_INS_VMOVMSKPD] = nullptr;
+	t.fns[X86_INS_VMOVMSKPS] = nullptr;
+	t.fns[X86_INS_VMOVNTDQA] = nullptr;
+	t.fns[X86_INS_VMOVNTDQ] = nullptr;
+	t.fns[X86_INS_VMOVNTPD] = nullptr;
+	t.fns[X86_INS_VMOVNTPS] = nullptr;
+	t.fns[X86_INS_VMOVSD] = nullptr;
+	t.fns[X86_INS_VMOVSHDUP] = nullptr;
+	t.fns[X86_INS_VMOVSLDUP] = nullptr;
+	t.fns[X86_INS_VMOVSS] = nullptr;
+	t.fns[X86_INS_VMOVUPD] = nullptr;
+	t.fns[X86_INS_VMOVUPS] = nullptr;
+	t.fns[X86_INS_VMPSADBW] = nullptr;
+	t.fns[X86_INS_VMPTRLD] = nullptr;
+	t.fns[X86_INS_VMPTRST] = nullptr;
+	t.fns[X86_INS_VMREAD] = nullptr;
+	t.fns[X86_INS_VMRESUME] = nullptr;
+	t.fns[X86_INS_VMRUN] = nullptr;
+	t.fns[X86_INS_VMSAVE] = nullptr;
+	t.fns[X86_INS_VMULPD] = nullptr;
+	t.fns[X86_INS_VMULPS] = nullptr;
+	t.fns[X86_INS_VMULSD] = nullptr;
+	t.fns[X86_INS_VMULSS] = nullptr;
+	t.fns[X86_INS_VMWRITE] = nullptr;
+	t.fns[X86_INS_VMXOFF] = nullptr;
+	t.fns[X86_INS_VMXON] = nullptr;
+	t.fns[X86_INS_VPABSB] = nullptr;
+	t.fns[X86_INS_VPABSD] = nullptr;
+	t.fns[X86_INS_VPABSQ] = nullptr;
+	t.fns[X86_INS_VPABSW] = nullptr;
+	t.fns[X86_INS_VPACKSSDW] = nullptr;
+	t.fns[X86_INS_VPACKSSWB] = nullptr;
+	t.fns[X86_INS_VPACKUSDW] = nullptr;
+	t.fns[X86_INS_VPACKUSWB] = nullptr;
+	t.fns[X86_INS_VPADDB] = nullptr;
+	t.fns[X86_INS_VPADDD] = nullptr;
+	t.fns[X86_INS_VPADDQ] = nullptr;
+	t.fns[X86_INS_VPADDSB] = nullptr;
+	t.fns[X86_INS_VPADDSW] = nullptr;
+	t.fns[X86_INS_VPADDUSB] = nullptr;
+	t.fns[X86_INS_VPADDUSW] = nullptr;
+	t.fns[X86_INS_VPADDW] = nullptr;
+	t.fns[X86_INS_VPALIGNR] = nullptr;
+	t.fns[X86_INS_VPANDD] = nullptr;
+	t.fns[X86_INS_VPANDND] = nullptr;
+	t.fns[X86_INS_VPANDNQ] = nullptr;
+	t.fns[X86_INS_VPANDN] = nullptr;
+	t.fns[X86_INS_VPANDQ] = nullptr;
+	t.fns[X86_INS_VPAND] = nullptr;
+	t.fns[X86_INS_VPAVGB] = nullptr;
+	t.fns[X86_INS_VPAVGW] = nullptr;
+	t.fns[X86_INS_VPBLENDD] = nullptr;
+	t.fns[X86_INS_VPBLENDMB] = nullptr;
+	t.fns[X86_INS_VPBLENDMD] = nullptr;
+	t.fns[X86_INS_VPBLENDMQ] = nullptr;
+	t.fns[X86_INS_VPBLENDMW] = nullptr;
+	t.fns[X86_INS_VPBLENDVB] = nullptr;
+	t.fns[X86_INS_VPBLENDW] = nullptr;
+	t.fns[X86_INS_VPBROADCASTB] = nullptr;
+	t.fns[X86_INS_VPBROADCASTD] = nullptr;
+	t.fns[X86_INS_VPBROADCASTMB2Q] = nullptr;
+	t.fns[X86_INS_VPBROADCASTMW2D] = nullptr;
+	t.fns[X86_INS_VPBROADCASTQ] = nullptr;
+	t.fns[X86_INS_VPBROADCASTW] = nullptr;
+	t.fns[X86_INS_VPCLMULQDQ] = nullptr;
+	t.fns[X86_INS_VPCMOV] = nullptr;
+	t.fns[X86_INS_VPCMPB] = nullptr;
+	t.fns[X86_INS_VPCMPD] = nullptr;
+	t.fns[X86_INS_VPCMPEQB] = nullptr;
+	t.fns[X86_INS_VPCMPEQD] = nullptr;
+	t.fns[X86_INS_VPCMPEQQ] = nullptr;
+	t.fns[X86_INS_VPCMPEQW] = nullptr;
+	t.fns[X86_INS_VPCMPESTRI] = nullptr;
+	t.fns[X86_INS_VPCMPESTRM] = nullptr;
+	t.fns[X86_INS_VPCMPGTB] = nullptr;
+	t.fns[X86_INS_VPCMPGTD] = nullptr;
+	t.fns[X86_INS_VPCMPGTQ] = nullptr;
+	t.fns[X86_INS_VPCMPGTW] = nullptr;
+	t.fns[X86_INS_VPCMPISTRI] = nullptr;
+	t.fns[X86_INS_VPCMPISTRM] = nullptr;
+	t.fns[X86_INS_VPCMPQ] = nullptr;
+	t.fns[X86_INS_VPCMPUB] = nullptr;
+	t.fns[X86_INS_VPCMPUD] = nullptr;
+	t.fns[X86_INS_VPCMPUQ] = nullptr;
+	t.fns[X86_INS_VPCMPUW] = nullptr;
+	t.fns[X86_INS_VPCMPW] = nullptr;
+	t.fns[X86_INS_VPCOMB] = nullptr;
+	t.fns[X86_INS_VPCOMD] = nullptr;
+	t.fns[X86_INS_VPCOMPRESSD] = nullptr;
+	t.fns[X86_INS_VPCOMPRESSQ] = nullptr;
+	t.fns[X86_INS_VPCOMQ] = nullptr;
+	t.fns[X86_INS_VPCOMUB] = nullptr;
+	t.fns[X86_INS_VPCOMUD] = nullptr;
+	t.fns[X86_INS_VPCOMUQ] = nullptr;
+	t.fns[X86_INS_VPCOMUW] = nullptr;
+	t.fns[X86_INS_VPCOMW] = nullptr;
+	t.fns[X86_INS_VPCONFLICTD] = nullptr;
+	t.fns[X86_INS_VPCONFLICTQ] = nullptr;
+	t.fns[X86_INS_VPERM2F128] = nullptr;
+	t.fns[X86_INS_VPERM2I128] = nullptr;
+	t.fns[X86_INS_VPERMD] = nullptr;
+	t.fns[X86_INS_VPERMI2D] = nullptr;
+	t.fns[X86_INS_VPERMI2PD] = nullptr;
+	t.fns[X86_INS_VPERMI2PS] = nullptr;
+	t.fns[X86_INS_VPERMI2Q] = nullptr;
+	t.fns[X86_INS_VPERMIL2PD] = nullptr;
+	t.fns[X86_INS_VPERMIL2PS] = nullptr;
+	t.fns[X86_INS_VPERMILPD] = nullptr;
+	t.fns[X86_INS_VPERMILPS] = nullptr;
+	t.fns[X86_INS_VPERMPD] = nullptr;
+	t.fns[X86_INS_VPERMPS] = nullptr;
+	t.fns[X86_INS_VPERMQ] = nullptr;
+	t.fns[X86_INS_VPERMT2D] = nullptr;
+	t.fns[X86_INS_VPERMT2PD] = nullptr;
+	t.fns[X86_INS_VPERMT2PS] = nullptr;
+	t.fns[X86_INS_VPERMT2Q] = nullptr;
+	t.fns[X86_INS_VPEXPANDD] = nullptr;
+	t.fns[X86_INS_VPEXPANDQ] = nullptr;
+	t.fns[X86_INS_VPEXTRB] = nullptr;
+	t.fns[X86_INS_VPEXTRD] = nullptr;
+	t.fns[X86_INS_VPEXTRQ] = nullptr;
+	t.fns[X86_INS_VPEXTRW] = nullptr;
+	t.fns[X86_INS_VPGATHERDD] = nullptr;
+	t.fns[X86_INS_VPGATHERDQ] = nullptr;
+	t.fns[X86_INS_VPGATHERQD] = nullptr;
+	t.fns[X86_INS_VPGATHERQQ] = nullptr;
+	t.fns[X86_INS_VPHADDBD] = nullptr;
+	t.fns[X86_INS_VPHADDBQ] = nullptr;
+	t.fns[X86_INS_VPHADDBW] = nullptr;
+	t.fns[X86_INS_VPHADDDQ] = nullptr;
+	t.fns[X86_INS_VPHADDD] = nullptr;
+	t.fns[X86_INS_VPHADDSW] = nullptr;
+	t.fns[X86_INS_VPHADDUBD] = nullptr;
+	t.fns[X86_INS_VPHADDUBQ] = nullptr;
+	t.fns[X86_INS_VPHADDUBW] = nullptr;
+	t.fns[X86_INS_VPHADDUDQ] = nullptr;
+	t.fns[X86_INS_VPHADDUWD] = nullptr;
+	t.fns[X86_INS_VPHADDUWQ] = nullptr;
+	t.fns[X86_INS_VPHADDWD] = nullptr;
+	t.fns[X86_INS_VPHADDWQ] = nullptr;
+	t.fns[X86_INS_VPHADDW] = nullptr;
+	t.fns[X86_INS_VPHMINPOSUW] = nullptr;
+	t.fns[X86_INS_VPHSUBBW] = nullptr;
+	t.fns[X86_INS_VPHSUBDQ] = nullptr;
+	t.fns[X86_INS_VPHSUBD] = nullptr;
+	t.fns[X86_INS_VPHSUBSW] = nullptr;
+	t.fns[X86_INS_VPHSUBWD] = nullptr;
+	t.fns[X86_INS_VPHSUBW] = nullptr;
+	t.fns[X86_INS_VPINSRB] = nullptr;
+	t.fns[X86_INS_VPINSRD] = nullptr;
+	t.fns[X86_INS_VPINSRQ] = nullptr;
+	t.fns[X86_INS_VPINSRW] = nullptr;
+	t.fns[X86_INS_VPLZCNTD] = nullptr;
+	t.fns[X86_INS_VPLZCNTQ] = nullptr;
+	t.fns[X86_INS_VPMACSDD] = nullptr;
+	t.fns[X86_INS_VPMACSDQH] = nullptr;
+	t.fns[X86_INS_VPMACSDQL] = nullptr;
+	t.fns[X86_INS_VPMACSSDD] = nullptr;
+	t.fns[X86_INS_VPMACSSDQH] = nullptr;
+	t.fns[X86_INS_VPMACSSDQL] = nullptr;
+	t.fns[X86_INS_VPMACSSWD] = nullptr;
+	t.fns[X86_INS_VPMACSSWW] = nullptr;
+	t.fns[X86_INS_VPMACSWD] = nullptr;
+	t.fns[X86_INS_VPMACSWW] = nullptr;
+	t.fns[X86_INS_VPMADCSSWD] = nullptr;
+	t.fns[X86_INS_VPMADCSWD] = nullptr;
+	t.fns[X86_INS_VPMADDUBSW] = nullptr;
+	t.fns[X86_INS_VPMADDWD] = nullptr;
+	t.fns[X86_INS_VPMASKMOVD] = nullptr;
+	t.fns[X86_INS_VPMASKMOVQ] = nullptr;
+	t.fns[X86_INS_VPMAXSB] = nullptr;
+	t.fns[X86_INS_VPMAXSD] = nullptr;
+	t.fns[X86_INS_VPMAXSQ] = nullptr;
+	t.fns[X86_INS_VPMAXSW] = nullptr;
+	t.fns[X86_INS_VPMAXUB] = nullptr;
+	t.fns[X86_INS_VPMAXUD] = nullptr;
+	t.fns[X86_INS_VPMAXUQ] = nullptr;
+	t.fns[X86_INS_VPMAXUW] = nullptr;
+	t.fns[X86_INS_VPMINSB] = nullptr;
+	t.fns[X86_INS_VPMINSD] = nullptr;
+	t.fns[X86_INS_VPMINSQ] = nullptr;
+	t.fns[X86_INS_VPMINSW] = nullptr;
+	t.fns[X86_INS_VPMINUB] = nullptr;
+	t.fns[X86_INS_VPMINUD] = nullptr;
+	t.fns[X86_INS_VPMINUQ] = nullptr;
+	t.fns[X86_INS_VPMINUW] = nullptr;
+	t.fns[X86_INS_VPMOVDB] = nullptr;
+	t.fns[X86_INS_VPMOVDW] = nullptr;
+	t.fns[X86_INS_VPMOVM2B] = nullptr;
+	t.fns[X86_INS_VPMOVM2D] = nullptr;
+	t.fns[X86_INS_VPMOVM2Q] = nullptr;
+	t.fns[X86_INS_VPMOVM2W] = nullptr;
+	t.fns[X86_INS_VPMOVMSKB] = nullptr;
+	t.fns[X86_INS_VPMOVQB] = nullptr;
+	t.fns[X86_INS_VPMOVQD] = nullptr;
+	t.fns[X86_INS_VPMOVQW] = nullptr;
+	t.fns[X86_INS_VPMOVSDB] = nullptr;
+	t.fns[X86_INS_VPMOVSDW] = nullptr;
+	t.fns[X86_INS_VPMOVSQB] = nullptr;
+	t.fns[X86_INS_VPMOVSQD] = nullptr;
+	t.fns[X86_INS_VPMOVSQW] = nullptr;
+	t.fns[X86_INS_VPMOVSXBD] = nullptr;
+	t.fns[X86_INS_VPMOVSXBQ] = nullptr;
+	t.fns[X86_INS_VPMOVSXBW] = nullptr;
+	t.fns[X86_INS_VPMOVSXDQ] = nullptr;
+	t.fns[X86_INS_VPMOVSXWD] = nullptr;
+	t.fns[X86_INS_VPMOVSXWQ] = nullptr;
+	t.fns[X86_INS_VPMOVUSDB] = nullptr;
+	t.fns[X86_INS_VPMOVUSDW] = nullptr;
+	t.fns[X86_INS_VPMOVUSQB] = nullptr;
+	t.fns[X86_INS_VPMOVUSQD] = nullptr;
+	t.fns[X86_INS_VPMOVUSQW] = nullptr;
+	t.fns[X86_INS_VPMOVZXBD] = nullptr;
+	t.fns[X86_INS_VPMOVZXBQ] = nullptr;
+	t.fns[X86_INS_VPMOVZXBW] = nullptr;
+	t.fns[X86_INS_VPMOVZXDQ] = nullptr;
+	t.fns[X86_INS_VPMOVZXWD] = nullptr;
+	t.fns[X86_INS_VPMOVZXWQ] = nullptr;
+	t.fns[X86_INS_VPMULDQ] = nullptr;
+	t.fns[X86_INS_VPMULHRSW] = nullptr;
+	t.fns[X86_INS_VPMULHUW] = nullptr;
+	t.fns[X86_INS_VPMULHW] = nullptr;
+	t.fns[X86_INS_VPMULLD] = nullptr;
+	t.fns[X86_INS_VPMULLQ] = nullptr;
+	t.fns[X86_INS_VPMULLW] = nullptr;
+	t.fns[X86_INS_VPMULUDQ] = nullptr;
+	t.fns[X86_INS_VPORD] = nullptr;
+	t.fns[X86_INS_VPORQ] = nullptr;
+	t.fns[X86_INS_VPOR] = nullptr;
+	t.fns[X86_INS_VPPERM] = nullptr;
+	t.fns[X86_INS_VPROTB] = nullptr;
+	t.fns[X86_INS_VPROTD] = nullptr;
+	t.fns[X86_INS_VPROTQ] = nullptr;
+	t.fns[X86_INS_VPROTW] = nullptr;
+	t.fns[X86_INS_VPSADBW] = nullptr;
+	t.fns[X86_INS_VPSCATTERDD] = nullptr;
+	t.fns[X86_INS_VPSCATTERDQ] = nullptr;
+	t.fns[X86_INS_VPSCATTERQD] = nullptr;
+	t.fns[X86_INS_VPSCATTERQQ] = nullptr;
+	t.fns[X86_INS_VPSHAB] = nullptr;
+	t.fns[X86_INS_VPSHAD] = nullptr;
+	t.fns[X86_INS_VPSHAQ] = nullptr;
+	t.fns[X86_INS_VPSHAW] = nullptr;
+	t.fns[X86_INS_VPSHLB] = nullptr;
+	t.fns[X86_INS_VPSHLD] = nullptr;
+	t.fns[X86_INS_VPSHLQ] = nullptr;
+	t.fns[X86_INS_VPSHLW] = nullptr;
+	t.fns[X86_INS_VPSHUFB] = nullptr;
+	t.fns[X86_INS_VPSHUFD] = nullptr;
+	t.fns[X86_INS_VPSHUFHW] = nullptr;
+	t.fns[X86_INS_VPSHUFLW] = nullptr;
+	t.fns[X86_INS_VPSIGNB] = nullptr;
+	t.fns[X86_INS_VPSIGND] = nullptr;
+	t.fns[X86_INS_VPSIGNW] = nullptr;
+	t.fns[X86_INS_VPSLLDQ] = nullptr;
+	t.fns[X86_INS_VPSLLD] = nullptr;
+	t.fns[X86_INS_VPSLLQ] = nullptr;
+	t.fns[X86_INS_VPSLLVD] = nullptr;
+	t.fns[X86_INS_VPSLLVQ] = nullptr;
+	t.fns[X86_INS_VPSLLW] = nullptr;
+	t.fns[X86_INS_VPSRAD] = nullptr;
+	t.fns[X86_INS_VPSRAQ] = nullptr;
+	t.fns[X86_INS_VPSRAVD] = nullptr;
+	t.fns[X86_INS_VPSRAVQ] = nullptr;
+	t.fns[X86_INS_VPSRAW] = nullptr;
+	t.fns[X86_INS_VPSRLDQ] = nullptr;
+	t.fns[X86_INS_VPSRLD] = nullptr;
+	t.fns[X86_INS_VPSRLQ] = nullptr;
+	t.fns[X86_INS_VPSRLVD] = nullptr;
+	t.fns[X86_INS_VPSRLVQ] = nullptr;
+	t.fns[X86_INS_VPSRLW] = nullptr;
+	t.fns[X86_INS_VPSUBB] = nullptr;
+	t.fns[X86_INS_VPSUBD] = nullptr;
+	t.fns[X86_INS_VPSUBQ] = nullptr;
+	t.fns[X86_INS_VPSUBSB] = nullptr;
+	t.fns[X86_INS_VPSUBSW] = nullptr;
+	t.fns[X86_INS_VPSUBUSB] = nullptr;
+	t.fns[X86_INS_VPSUBUSW] = nullptr;
+	t.fns[X86_INS_VPSUBW] = nullptr;
+	t.fns[X86_INS_VPTESTMD] = nullptr;
+	t.fns[X86_INS_VPTESTMQ] = nullptr;
+	t.fns[X86_INS_VPTESTNMD] = nullptr;
+	t.fns[X86_INS_VPTESTNMQ] = nullptr;
+	t.fns[X86_INS_VPTEST] = nullptr;
+	t.fns[X86_INS_VPUNPCKHBW] = nullptr;
+	t.fns[X86_INS_VPUNPCKHDQ] = nullptr;
+	t.fns[X86_INS_VPUNPCKHQDQ] = nullptr;
+	t.fns[X86_INS_VPUNPCKHWD] = nullptr;
+	t.fns[X86_INS_VPUNPCKLBW] = nullptr;
+	t.fns[X86_INS_VPUNPCKLDQ] = nullptr;
+	t.fns[X86_INS_VPUNPCKLQDQ] = nullptr;
+	t.fns[X86_INS_VPUNPCKLWD] = nullptr;
+	t.fns[X86_INS_VPXORD] = nullptr;
+	t.fns[X86_INS_VPXORQ] = nullptr;
+	t.fns[X86_INS_VPXOR] = nullptr;
+	t.fns[X86_INS_VRCP14PD] = nullptr;
+	t.fns[X86_INS_VRCP14PS] = nullptr;
+	t.fns[X86_INS_VRCP14SD] = nullptr;
+	t.fns[X86_INS_VRCP14SS] = nullptr;
+	t.fns[X86_INS_VRCP28PD] = nullptr;
+	t.fns[X86_INS_VRCP28PS] = nullptr;
+	t.fns[X86_INS_VRCP28SD] = nullptr;
+	t.fns[X86_INS_VRCP28SS] = nullptr;
+	t.fns[X86_INS_VRCPPS] = nullptr;
+	t.fns[X86_INS_VRCPSS] = nullptr;
+	t.fns[X86_INS_VRNDSCALEPD] = nullptr;
+	t.fns[X86_INS_VRNDSCALEPS] = nullptr;
+	t.fns[X86_INS_VRNDSCALESD] = nullptr;
+	t.fns[X86_INS_VRNDSCALESS] = nullptr;
+	t.fns[X86_INS_VROUNDPD] = nullptr;
+	t.fns[X86_INS_VROUNDPS] = nullptr;
+	t.fns[X86_INS_VROUNDSD] = nullptr;
+	t.fns[X86_INS_VROUNDSS] = nullptr;
+	t.fns[X86_INS_VRSQRT14PD] = nullptr;
+	t.fns[X86_INS_VRSQRT14PS] = nullptr;
+	t.fns[X86_INS_VRSQRT14SD] = nullptr;
+	t.fns[X86_INS_VRSQRT14SS] = nullptr;
+	t.fns[X86_INS_VRSQRT28PD] = nullptr;
+	t.fns[X86_INS_VRSQRT28PS] = nullptr;
+	t.fns[X86_INS_VRSQRT28SD] = nullptr;
+	t.fns[X86_INS_VRSQRT28SS] = nullptr;
+	t.fns[X86_INS_VRSQRTPS] = nullptr;
+	t.fns[X86_INS_VRSQRTSS] = nullptr;
+	t.fns[X86_INS_VSCATTERDPD] = nullptr;
+	t.fns[X86_INS_VSCATTERDPS] = nullptr;
+	t.fns[X86_INS_VSCATTERPF0DPD] = nullptr;
+	t.fns[X86_INS_VSCATTERPF0DPS] = nullptr;
+	t.fns[X86_INS_VSCATTERPF0QPD] = nullptr;
+	t.fns[X86_INS_VSCATTERPF0QPS] = nullptr;
+	t.fns[X86_INS_VSCATTERPF1DPD] = nullptr;
+	t.fns[X86_INS_VSCATTERPF1DPS] = nullptr;
+	t.fns[X86_INS_VSCATTERPF1QPD] = nullptr;
+	t.fns[X86_INS_VSCATTERPF1QPS] = nullptr;
+	t.fns[X86_INS_VSCATTERQPD] = nullptr;
+	t.fns[X86_INS_VSCATTERQPS] = nullptr;
+	t.fns[X86_INS_VSHUFPD] = nullptr;
+	t.fns[X86_INS_VSHUFPS] = nullptr;
+	t.fns[X86_INS_VSQRTPD] = nullptr;
+	t.fns[X86_INS_VSQRTPS] = nullptr;
+	t.fns[X86_INS_VSQRTSD] = nullptr;
+	t.fns[X86_INS_VSQRTSS] = nullptr;
+	t.fns[X86_INS_VSTMXCSR] = nullptr;
+	t.fns[X86_INS_VSUBPD] = nullptr;
+	t.fns[X86_INS_VSUBPS] = nullptr;
+	t.fns[X86_INS_VSUBSD] = nullptr;
+	t.fns[X86_INS_VSUBSS] = nullptr;
+	t.fns[X86_INS_VTESTPD] = nullptr;
+	t.fns[X86_INS_VTESTPS] = nullptr;
+	t.fns[X86_INS_VUNPCKHPD] = nullptr;
+	t.fns[X86_INS_VUNPCKHPS] = nullptr;
+	t.fns[X86_INS_VUNPCKLPD] = nullptr;
+	t.fns[X86_INS_VUNPCKLPS] = nullptr;
+	t.fns[X86_INS_VZEROALL] = nullptr;
+	t.fns[X86_INS_VZEROUPPER] = nullptr;
+	t.fns[X86_INS_WAIT] = &Capstone2LlvmIrTranslatorX86::translateWait;
+	t.fns[X86_INS_WBINVD] = nullptr;
+	t.fns[X86_INS_WRFSBASE] = nullptr;
+	t.fns[X86_INS_WRGSBASE] = nullptr;
+	t.fns[X86_INS_WRMSR] = nullptr;
+	t.fns[X86_INS_XABORT] = nullptr;
+	t.fns[X86_INS_XACQUIRE] = nullptr;
+	t.fns[X86_INS_XBEGIN] = nullptr;
+	t.fns[X86_INS_XCHG] = &Capstone2LlvmIrTranslatorX86::translateXchg;
+	t.fns[X86_INS_XCRYPTCBC] = nullptr;
+	t.fns[X86_INS_XCRYPTCFB] = nullptr;
+	t.fns[X86_INS_XCRYPTCTR] = nullptr;
+	t.fns[X86_INS_XCRYPTECB] = nullptr;
+	t.fns[X86_INS_XCRYPTOFB] = nullptr;
+	t.fns[X86_INS_XEND] = nullptr;
+	t.fns[X86_INS_XGETBV] = nullptr;
+	t.fns[X86_INS_XLATB] = &Capstone2LlvmIrTranslatorX86::translateXlatb;
+	t.fns[X86_INS_XRELEASE] = nullptr;
+	t.fns[X86_INS_XRSTOR] = nullptr;
+	t.fns[X86_INS_XRSTOR64] = nullptr;
+	t.fns[X86_INS_XRSTORS] = nullptr;
+	t.fns[X86_INS_XRSTORS64] = nullptr;
+	t.fns[X86_INS_XSAVE] = nullptr;
+	t.fns[X86_INS_XSAVE64] = nullptr;
+	t.fns[X86_INS_XSAVEC] = nullptr;
+	t.fns[X86_INS_XSAVEC64] = nullptr;
+	t.fns[X86_INS_XSAVEOPT] = nullptr;
+	t.fns[X86_INS_XSAVEOPT64] = nullptr;
+	t.fns[X86_INS_XSAVES] = nullptr;
+	t.fns[X86_INS_XSAVES64] = nullptr;
+	t.fns[X86_INS_XSETBV] = nullptr;
+	t.fns[X86_INS_XSHA1] = nullptr;
+	t.fns[X86_INS_XSHA256] = nullptr;
+	t.fns[X86_INS_XSTORE] = nullptr;
+	t.fns[X86_INS_XTEST] = nullptr;
+	t.fns[X86_INS_FDISI8087_NOP] = &Capstone2LlvmIrTranslatorX86::translateNop;
+	t.fns[X86_INS_FENI8087_NOP] = &Capstone2LlvmIrTranslatorX86::translateNop;
 
-		{X86_INS_CMPSD, &Capstone2LlvmIrTranslatorX86::translateCompareString},
-		{X86_INS_CMPEQSD, nullptr},
-		{X86_INS_CMPLTSD, nullptr},
-		{X86_INS_CMPLESD, nullptr},
-		{X86_INS_CMPUNORDSD, nullptr},
-		{X86_INS_CMPNEQSD, nullptr},
-		{X86_INS_CMPNLTSD, nullptr},
-		{X86_INS_CMPNLESD, nullptr},
-		{X86_INS_CMPORDSD, nullptr},
+	// pseudo instructions
+	t.fns[X86_INS_CMPSS] = nullptr;
+	t.fns[X86_INS_CMPEQSS] = nullptr;
+	t.fns[X86_INS_CMPLTSS] = nullptr;
+	t.fns[X86_INS_CMPLESS] = nullptr;
+	t.fns[X86_INS_CMPUNORDSS] = nullptr;
+	t.fns[X86_INS_CMPNEQSS] = nullptr;
+	t.fns[X86_INS_CMPNLTSS] = nullptr;
+	t.fns[X86_INS_CMPNLESS] = nullptr;
+	t.fns[X86_INS_CMPORDSS] = nullptr;
 
-		{X86_INS_CMPPS, nullptr},
-		{X86_INS_CMPEQPS, nullptr},
-		{X86_INS_CMPLTPS, nullptr},
-		{X86_INS_CMPLEPS, nullptr},
-		{X86_INS_CMPUNORDPS, nullptr},
-		{X86_INS_CMPNEQPS, nullptr},
-		{X86_INS_CMPNLTPS, nullptr},
-		{X86_INS_CMPNLEPS, nullptr},
-		{X86_INS_CMPORDPS, nullptr},
+	t.fns[X86_INS_CMPSD] = &Capstone2LlvmIrTranslatorX86::translateCompareString;
+	t.fns[X86_INS_CMPEQSD] = nullptr;
+	t.fns[X86_INS_CMPLTSD] = nullptr;
+	t.fns[X86_INS_CMPLESD] = nullptr;
+	t.fns[X86_INS_CMPUNORDSD] = nullptr;
+	t.fns[X86_INS_CMPNEQSD] = nullptr;
+	t.fns[X86_INS_CMPNLTSD] = nullptr;
+	t.fns[X86_INS_CMPNLESD] = nullptr;
+	t.fns[X86_INS_CMPORDSD] = nullptr;
 
-		{X86_INS_CMPPD, nullptr},
-		{X86_INS_CMPEQPD, nullptr},
-		{X86_INS_CMPLTPD, nullptr},
-		{X86_INS_CMPLEPD, nullptr},
-		{X86_INS_CMPUNORDPD, nullptr},
-		{X86_INS_CMPNEQPD, nullptr},
-		{X86_INS_CMPNLTPD, nullptr},
-		{X86_INS_CMPNLEPD, nullptr},
-		{X86_INS_CMPORDPD, nullptr},
+	t.fns[X86_INS_CMPPS] = nullptr;
+	t.fns[X86_INS_CMPEQPS] = nullptr;
+	t.fns[X86_INS_CMPLTPS] = nullptr;
+	t.fns[X86_INS_CMPLEPS] = nullptr;
+	t.fns[X86_INS_CMPUNORDPS] = nullptr;
+	t.fns[X86_INS_CMPNEQPS] = nullptr;
+	t.fns[X86_INS_CMPNLTPS] = nullptr;
+	t.fns[X86_INS_CMPNLEPS] = nullptr;
+	t.fns[X86_INS_CMPORDPS] = nullptr;
 
-		{X86_INS_VCMPSS, nullptr},
-		{X86_INS_VCMPEQSS, nullptr},
-		{X86_INS_VCMPLTSS, nullptr},
-		{X86_INS_VCMPLESS, nullptr},
-		{X86_INS_VCMPUNORDSS, nullptr},
-		{X86_INS_VCMPNEQSS, nullptr},
-		{X86_INS_VCMPNLTSS, nullptr},
-		{X86_INS_VCMPNLESS, nullptr},
-		{X86_INS_VCMPORDSS, nullptr},
-		{X86_INS_VCMPEQ_UQSS, nullptr},
-		{X86_INS_VCMPNGESS, nullptr},
-		{X86_INS_VCMPNGTSS, nullptr},
-		{X86_INS_VCMPFALSESS, nullptr},
-		{X86_INS_VCMPNEQ_OQSS, nullptr},
-		{X86_INS_VCMPGESS, nullptr},
-		{X86_INS_VCMPGTSS, nullptr},
-		{X86_INS_VCMPTRUESS, nullptr},
-		{X86_INS_VCMPEQ_OSSS, nullptr},
-		{X86_INS_VCMPLT_OQSS, nullptr},
-		{X86_INS_VCMPLE_OQSS, nullptr},
-		{X86_INS_VCMPUNORD_SSS, nullptr},
-		{X86_INS_VCMPNEQ_USSS, nullptr},
-		{X86_INS_VCMPNLT_UQSS, nullptr},
-		{X86_INS_VCMPNLE_UQSS, nullptr},
-		{X86_INS_VCMPORD_SSS, nullptr},
-		{X86_INS_VCMPEQ_USSS, nullptr},
-		{X86_INS_VCMPNGE_UQSS, nullptr},
-		{X86_INS_VCMPNGT_UQSS, nullptr},
-		{X86_INS_VCMPFALSE_OSSS, nullptr},
-		{X86_INS_VCMPNEQ_OSSS, nullptr},
-		{X86_INS_VCMPGE_OQSS, nullptr},
-		{X86_INS_VCMPGT_OQSS, nullptr},
-		{X86_INS_VCMPTRUE_USSS, nullptr},
+	t.fns[X86_INS_CMPPD] = nullptr;
+	t.fns[X86_INS_CMPEQPD] = nullptr;
+	t.fns[X86_INS_CMPLTPD] = nullptr;
+	t.fns[X86_INS_CMPLEPD] = nullptr;
+	t.fns[X86_INS_CMPUNORDPD] = nullptr;
+	t.fns[X86_INS_CMPNEQPD] = nullptr;
+	t.fns[X86_INS_CMPNLTPD] = nullptr;
+	t.fns[X86_INS_CMPNLEPD] = nullptr;
+	t.fns[X86_INS_CMPORDPD] = nullptr;
 
-		{X86_INS_VCMPSD, nullptr},
-		{X86_INS_VCMPEQSD, nullptr},
-		{X86_INS_VCMPLTSD, nullptr},
-		{X86_INS_VCMPLESD, nullptr},
-		{X86_INS_VCMPUNORDSD, nullptr},
-		{X86_INS_VCMPNEQSD, nullptr},
-		{X86_INS_VCMPNLTSD, nullptr},
-		{X86_INS_VCMPNLESD, nullptr},
-		{X86_INS_VCMPORDSD, nullptr},
-		{X86_INS_VCMPEQ_UQSD, nullptr},
-		{X86_INS_VCMPNGESD, nullptr},
-		{X86_INS_VCMPNGTSD, nullptr},
-		{X86_INS_VCMPFALSESD, nullptr},
-		{X86_INS_VCMPNEQ_OQSD, nullptr},
-		{X86_INS_VCMPGESD, nullptr},
-		{X86_INS_VCMPGTSD, nullptr},
-		{X86_INS_VCMPTRUESD, nullptr},
-		{X86_INS_VCMPEQ_OSSD, nullptr},
-		{X86_INS_VCMPLT_OQSD, nullptr},
-		{X86_INS_VCMPLE_OQSD, nullptr},
-		{X86_INS_VCMPUNORD_SSD, nullptr},
-		{X86_INS_VCMPNEQ_USSD, nullptr},
-		{X86_INS_VCMPNLT_UQSD, nullptr},
-		{X86_INS_VCMPNLE_UQSD, nullptr},
-		{X86_INS_VCMPORD_SSD, nullptr},
-		{X86_INS_VCMPEQ_USSD, nullptr},
-		{X86_INS_VCMPNGE_UQSD, nullptr},
-		{X86_INS_VCMPNGT_UQSD, nullptr},
-		{X86_INS_VCMPFALSE_OSSD, nullptr},
-		{X86_INS_VCMPNEQ_OSSD, nullptr},
-		{X86_INS_VCMPGE_OQSD, nullptr},
-		{X86_INS_VCMPGT_OQSD, nullptr},
-		{X86_INS_VCMPTRUE_USSD, nullptr},
+	t.fns[X86_INS_VCMPSS] = nullptr;
+	t.fns[X86_INS_VCMPEQSS] = nullptr;
+	t.fns[X86_INS_VCMPLTSS] = nullptr;
+	t.fns[X86_INS_VCMPLESS] = nullptr;
+	t.fns[X86_INS_VCMPUNORDSS] = nullptr;
+	t.fns[X86_INS_VCMPNEQSS] = nullptr;
+	t.fns[X86_INS_VCMPNLTSS] = nullptr;
+	t.fns[X86_INS_VCMPNLESS] = nullptr;
+	t.fns[X86_INS_VCMPORDSS] = nullptr;
+	t.fns[X86_INS_VCMPEQ_UQSS] = nullptr;
+	t.fns[X86_INS_VCMPNGESS] = nullptr;
+	t.fns[X86_INS_VCMPNGTSS] = nullptr;
+	t.fns[X86_INS_VCMPFALSESS] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OQSS] = nullptr;
+	t.fns[X86_INS_VCMPGESS] = nullptr;
+	t.fns[X86_INS_VCMPGTSS] = nullptr;
+	t.fns[X86_INS_VCMPTRUESS] = nullptr;
+	t.fns[X86_INS_VCMPEQ_OSSS] = nullptr;
+	t.fns[X86_INS_VCMPLT_OQSS] = nullptr;
+	t.fns[X86_INS_VCMPLE_OQSS] = nullptr;
+	t.fns[X86_INS_VCMPUNORD_SSS] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_USSS] = nullptr;
+	t.fns[X86_INS_VCMPNLT_UQSS] = nullptr;
+	t.fns[X86_INS_VCMPNLE_UQSS] = nullptr;
+	t.fns[X86_INS_VCMPORD_SSS] = nullptr;
+	t.fns[X86_INS_VCMPEQ_USSS] = nullptr;
+	t.fns[X86_INS_VCMPNGE_UQSS] = nullptr;
+	t.fns[X86_INS_VCMPNGT_UQSS] = nullptr;
+	t.fns[X86_INS_VCMPFALSE_OSSS] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OSSS] = nullptr;
+	t.fns[X86_INS_VCMPGE_OQSS] = nullptr;
+	t.fns[X86_INS_VCMPGT_OQSS] = nullptr;
+	t.fns[X86_INS_VCMPTRUE_USSS] = nullptr;
 
-		{X86_INS_VCMPPS, nullptr},
-		{X86_INS_VCMPEQPS, nullptr},
-		{X86_INS_VCMPLTPS, nullptr},
-		{X86_INS_VCMPLEPS, nullptr},
-		{X86_INS_VCMPUNORDPS, nullptr},
-		{X86_INS_VCMPNEQPS, nullptr},
-		{X86_INS_VCMPNLTPS, nullptr},
-		{X86_INS_VCMPNLEPS, nullptr},
-		{X86_INS_VCMPORDPS, nullptr},
-		{X86_INS_VCMPEQ_UQPS, nullptr},
-		{X86_INS_VCMPNGEPS, nullptr},
-		{X86_INS_VCMPNGTPS, nullptr},
-		{X86_INS_VCMPFALSEPS, nullptr},
-		{X86_INS_VCMPNEQ_OQPS, nullptr},
-		{X86_INS_VCMPGEPS, nullptr},
-		{X86_INS_VCMPGTPS, nullptr},
-		{X86_INS_VCMPTRUEPS, nullptr},
-		{X86_INS_VCMPEQ_OSPS, nullptr},
-		{X86_INS_VCMPLT_OQPS, nullptr},
-		{X86_INS_VCMPLE_OQPS, nullptr},
-		{X86_INS_VCMPUNORD_SPS, nullptr},
-		{X86_INS_VCMPNEQ_USPS, nullptr},
-		{X86_INS_VCMPNLT_UQPS, nullptr},
-		{X86_INS_VCMPNLE_UQPS, nullptr},
-		{X86_INS_VCMPORD_SPS, nullptr},
-		{X86_INS_VCMPEQ_USPS, nullptr},
-		{X86_INS_VCMPNGE_UQPS, nullptr},
-		{X86_INS_VCMPNGT_UQPS, nullptr},
-		{X86_INS_VCMPFALSE_OSPS, nullptr},
-		{X86_INS_VCMPNEQ_OSPS, nullptr},
-		{X86_INS_VCMPGE_OQPS, nullptr},
-		{X86_INS_VCMPGT_OQPS, nullptr},
-		{X86_INS_VCMPTRUE_USPS, nullptr},
+	t.fns[X86_INS_VCMPSD] = nullptr;
+	t.fns[X86_INS_VCMPEQSD] = nullptr;
+	t.fns[X86_INS_VCMPLTSD] = nullptr;
+	t.fns[X86_INS_VCMPLESD] = nullptr;
+	t.fns[X86_INS_VCMPUNORDSD] = nullptr;
+	t.fns[X86_INS_VCMPNEQSD] = nullptr;
+	t.fns[X86_INS_VCMPNLTSD] = nullptr;
+	t.fns[X86_INS_VCMPNLESD] = nullptr;
+	t.fns[X86_INS_VCMPORDSD] = nullptr;
+	t.fns[X86_INS_VCMPEQ_UQSD] = nullptr;
+	t.fns[X86_INS_VCMPNGESD] = nullptr;
+	t.fns[X86_INS_VCMPNGTSD] = nullptr;
+	t.fns[X86_INS_VCMPFALSESD] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OQSD] = nullptr;
+	t.fns[X86_INS_VCMPGESD] = nullptr;
+	t.fns[X86_INS_VCMPGTSD] = nullptr;
+	t.fns[X86_INS_VCMPTRUESD] = nullptr;
+	t.fns[X86_INS_VCMPEQ_OSSD] = nullptr;
+	t.fns[X86_INS_VCMPLT_OQSD] = nullptr;
+	t.fns[X86_INS_VCMPLE_OQSD] = nullptr;
+	t.fns[X86_INS_VCMPUNORD_SSD] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_USSD] = nullptr;
+	t.fns[X86_INS_VCMPNLT_UQSD] = nullptr;
+	t.fns[X86_INS_VCMPNLE_UQSD] = nullptr;
+	t.fns[X86_INS_VCMPORD_SSD] = nullptr;
+	t.fns[X86_INS_VCMPEQ_USSD] = nullptr;
+	t.fns[X86_INS_VCMPNGE_UQSD] = nullptr;
+	t.fns[X86_INS_VCMPNGT_UQSD] = nullptr;
+	t.fns[X86_INS_VCMPFALSE_OSSD] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OSSD] = nullptr;
+	t.fns[X86_INS_VCMPGE_OQSD] = nullptr;
+	t.fns[X86_INS_VCMPGT_OQSD] = nullptr;
+	t.fns[X86_INS_VCMPTRUE_USSD] = nullptr;
 
-		{X86_INS_VCMPPD, nullptr},
-		{X86_INS_VCMPEQPD, nullptr},
-		{X86_INS_VCMPLTPD, nullptr},
-		{X86_INS_VCMPLEPD, nullptr},
-		{X86_INS_VCMPUNORDPD, nullptr},
-		{X86_INS_VCMPNEQPD, nullptr},
-		{X86_INS_VCMPNLTPD, nullptr},
-		{X86_INS_VCMPNLEPD, nullptr},
-		{X86_INS_VCMPORDPD, nullptr},
-		{X86_INS_VCMPEQ_UQPD, nullptr},
-		{X86_INS_VCMPNGEPD, nullptr},
-		{X86_INS_VCMPNGTPD, nullptr},
-		{X86_INS_VCMPFALSEPD, nullptr},
-		{X86_INS_VCMPNEQ_OQPD, nullptr},
-		{X86_INS_VCMPGEPD, nullptr},
-		{X86_INS_VCMPGTPD, nullptr},
-		{X86_INS_VCMPTRUEPD, nullptr},
-		{X86_INS_VCMPEQ_OSPD, nullptr},
-		{X86_INS_VCMPLT_OQPD, nullptr},
-		{X86_INS_VCMPLE_OQPD, nullptr},
-		{X86_INS_VCMPUNORD_SPD, nullptr},
-		{X86_INS_VCMPNEQ_USPD, nullptr},
-		{X86_INS_VCMPNLT_UQPD, nullptr},
-		{X86_INS_VCMPNLE_UQPD, nullptr},
-		{X86_INS_VCMPORD_SPD, nullptr},
-		{X86_INS_VCMPEQ_USPD, nullptr},
-		{X86_INS_VCMPNGE_UQPD, nullptr},
-		{X86_INS_VCMPNGT_UQPD, nullptr},
-		{X86_INS_VCMPFALSE_OSPD, nullptr},
-		{X86_INS_VCMPNEQ_OSPD, nullptr},
-		{X86_INS_VCMPGE_OQPD, nullptr},
-		{X86_INS_VCMPGT_OQPD, nullptr},
-		{X86_INS_VCMPTRUE_USPD, nullptr},
+	t.fns[X86_INS_VCMPPS] = nullptr;
+	t.fns[X86_INS_VCMPEQPS] = nullptr;
+	t.fns[X86_INS_VCMPLTPS] = nullptr;
+	t.fns[X86_INS_VCMPLEPS] = nullptr;
+	t.fns[X86_INS_VCMPUNORDPS] = nullptr;
+	t.fns[X86_INS_VCMPNEQPS] = nullptr;
+	t.fns[X86_INS_VCMPNLTPS] = nullptr;
+	t.fns[X86_INS_VCMPNLEPS] = nullptr;
+	t.fns[X86_INS_VCMPORDPS] = nullptr;
+	t.fns[X86_INS_VCMPEQ_UQPS] = nullptr;
+	t.fns[X86_INS_VCMPNGEPS] = nullptr;
+	t.fns[X86_INS_VCMPNGTPS] = nullptr;
+	t.fns[X86_INS_VCMPFALSEPS] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OQPS] = nullptr;
+	t.fns[X86_INS_VCMPGEPS] = nullptr;
+	t.fns[X86_INS_VCMPGTPS] = nullptr;
+	t.fns[X86_INS_VCMPTRUEPS] = nullptr;
+	t.fns[X86_INS_VCMPEQ_OSPS] = nullptr;
+	t.fns[X86_INS_VCMPLT_OQPS] = nullptr;
+	t.fns[X86_INS_VCMPLE_OQPS] = nullptr;
+	t.fns[X86_INS_VCMPUNORD_SPS] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_USPS] = nullptr;
+	t.fns[X86_INS_VCMPNLT_UQPS] = nullptr;
+	t.fns[X86_INS_VCMPNLE_UQPS] = nullptr;
+	t.fns[X86_INS_VCMPORD_SPS] = nullptr;
+	t.fns[X86_INS_VCMPEQ_USPS] = nullptr;
+	t.fns[X86_INS_VCMPNGE_UQPS] = nullptr;
+	t.fns[X86_INS_VCMPNGT_UQPS] = nullptr;
+	t.fns[X86_INS_VCMPFALSE_OSPS] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OSPS] = nullptr;
+	t.fns[X86_INS_VCMPGE_OQPS] = nullptr;
+	t.fns[X86_INS_VCMPGT_OQPS] = nullptr;
+	t.fns[X86_INS_VCMPTRUE_USPS] = nullptr;
 
-		{X86_INS_ENDING, nullptr}, // mark the end of the list of insn
-};
+	t.fns[X86_INS_VCMPPD] = nullptr;
+	t.fns[X86_INS_VCMPEQPD] = nullptr;
+	t.fns[X86_INS_VCMPLTPD] = nullptr;
+	t.fns[X86_INS_VCMPLEPD] = nullptr;
+	t.fns[X86_INS_VCMPUNORDPD] = nullptr;
+	t.fns[X86_INS_VCMPNEQPD] = nullptr;
+	t.fns[X86_INS_VCMPNLTPD] = nullptr;
+	t.fns[X86_INS_VCMPNLEPD] = nullptr;
+	t.fns[X86_INS_VCMPORDPD] = nullptr;
+	t.fns[X86_INS_VCMPEQ_UQPD] = nullptr;
+	t.fns[X86_INS_VCMPNGEPD] = nullptr;
+	t.fns[X86_INS_VCMPNGTPD] = nullptr;
+	t.fns[X86_INS_VCMPFALSEPD] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OQPD] = nullptr;
+	t.fns[X86_INS_VCMPGEPD] = nullptr;
+	t.fns[X86_INS_VCMPGTPD] = nullptr;
+	t.fns[X86_INS_VCMPTRUEPD] = nullptr;
+	t.fns[X86_INS_VCMPEQ_OSPD] = nullptr;
+	t.fns[X86_INS_VCMPLT_OQPD] = nullptr;
+	t.fns[X86_INS_VCMPLE_OQPD] = nullptr;
+	t.fns[X86_INS_VCMPUNORD_SPD] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_USPD] = nullptr;
+	t.fns[X86_INS_VCMPNLT_UQPD] = nullptr;
+	t.fns[X86_INS_VCMPNLE_UQPD] = nullptr;
+	t.fns[X86_INS_VCMPORD_SPD] = nullptr;
+	t.fns[X86_INS_VCMPEQ_USPD] = nullptr;
+	t.fns[X86_INS_VCMPNGE_UQPD] = nullptr;
+	t.fns[X86_INS_VCMPNGT_UQPD] = nullptr;
+	t.fns[X86_INS_VCMPFALSE_OSPD] = nullptr;
+	t.fns[X86_INS_VCMPNEQ_OSPD] = nullptr;
+	t.fns[X86_INS_VCMPGE_OQPD] = nullptr;
+	t.fns[X86_INS_VCMPGT_OQPD] = nullptr;
+	t.fns[X86_INS_VCMPTRUE_USPD] = nullptr;
+
+	return t;
+}
+
+const Capstone2LlvmIrTranslatorX86::DispatchTable Capstone2LlvmIrTranslatorX86::_i2fm =
+		Capstone2LlvmIrTranslatorX86::makeDispatchTable();
 
 } // namespace capstone2llvmir
 } // namespace retdec
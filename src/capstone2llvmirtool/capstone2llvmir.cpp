@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 
@@ -100,6 +101,27 @@ class ProgramOptions
 				{
 					outFile = getParamOrDie(argc, argv, i);
 				}
+				else if (c == "--bench")
+				{
+					bench = true;
+				}
+				else if (c == "--bench-iters")
+				{
+					_benchIters = getParamOrDie(argc, argv, i);
+					if (!retdec::utils::strToNum(_benchIters, benchIters)
+							|| benchIters == 0)
+					{
+						printHelpAndDie();
+					}
+				}
+				else if (c == "--bench-warmup")
+				{
+					_benchWarmup = getParamOrDie(argc, argv, i);
+					if (!retdec::utils::strToNum(_benchWarmup, benchWarmup))
+					{
+						printHelpAndDie();
+					}
+				}
 				else if (c == "-h")
 				{
 					printHelpAndDie();
@@ -159,11 +181,25 @@ class ProgramOptions
 				"\t          Possible values: little, big, micro, mclass, v8, v9.\n"
 				"\t          Default value: little.\n"
 				"\t-o out    Output file name where LLVM IR will be generated.\n"
-				"\t          Default value: x86-decoder-out.ll\n";
+				"\t          Default value: x86-decoder-out.ll\n"
+				"\t--bench   Benchmark mode: repeatedly translate the code and\n"
+				"\t          print a JSON throughput report to standard output\n"
+				"\t          instead of generating LLVM IR output.\n"
+				"\t--bench-iters n\n"
+				"\t          Number of measured benchmark iterations.\n"
+				"\t          Default value: 100.\n"
+				"\t--bench-warmup n\n"
+				"\t          Number of warm-up iterations excluded from the\n"
+				"\t          measurement. Default value: 10.\n";
 
 			exit(0);
 		}
 
+	public:
+		const string& getArchName() const { return _arch; }
+		const string& getBasicModeName() const { return _basicMode; }
+		const string& getExtraModeName() const { return _extraMode; }
+
 	public:
 		cs_arch arch = CS_ARCH_X86;
 		uint64_t base = 0x1000;
@@ -172,14 +208,19 @@ class ProgramOptions
 		cs_mode basicMode = CS_MODE_32;
 		cs_mode extraMode = CS_MODE_LITTLE_ENDIAN;
 		string outFile = "x86-decoder-out.ll";
+		bool bench = false;
+		std::size_t benchIters = 100;
+		std::size_t benchWarmup = 10;
 
 	private:
 		string _programName = "capstone2llvmir";
-		string _arch;
+		string _arch = "x86";
 		string _base;
 		string _code;
-		string _basicMode;
-		string _extraMode;
+		string _basicMode = "32";
+		string _extraMode = "little";
+		string _benchIters;
+		string _benchWarmup;
 };
 
 /**
@@ -333,6 +374,95 @@ void assemble(ProgramOptions& po)
 
 using namespace retdec::capstone2llvmir;
 
+/**
+ * Repeatedly translate the code from @a po and print a JSON throughput
+ * report to standard output.
+ *
+ * Every iteration translates into a fresh module with a fresh translator,
+ * so the iterations are independent and the translator's internal caches
+ * do not turn the measurement into a cache benchmark. The first
+ * @c po.benchWarmup iterations are excluded from the measurement; only
+ * the translation itself is timed, not the module and translator set-up.
+ */
+int benchmark(ProgramOptions& po)
+{
+	std::size_t asmInsns = 0;
+	std::size_t irInsns = 0;
+	double seconds = 0.0;
+
+	for (std::size_t i = 0; i < po.benchWarmup + po.benchIters; ++i)
+	{
+		llvm::LLVMContext ctx;
+		llvm::Module module("bench", ctx);
+
+		auto* f = llvm::Function::Create(
+				llvm::FunctionType::get(llvm::Type::getVoidTy(ctx), false),
+				llvm::GlobalValue::ExternalLinkage,
+				"root",
+				&module);
+		llvm::BasicBlock::Create(module.getContext(), "entry", f);
+		llvm::IRBuilder<> irb(&f->front());
+
+		auto* ret = irb.CreateRetVoid();
+		irb.SetInsertPoint(ret);
+
+		try
+		{
+			auto c2l = Capstone2LlvmIrTranslator::createArch(
+					po.arch,
+					&module,
+					po.basicMode,
+					po.extraMode);
+
+			auto begin = chrono::steady_clock::now();
+			auto bRes = c2l->translateBlock(po.code, po.base, irb);
+			auto end = chrono::steady_clock::now();
+
+			if (bRes.block.failed())
+			{
+				cerr << "Translation failed, nothing to benchmark." << endl;
+				return EXIT_FAILURE;
+			}
+			if (i < po.benchWarmup)
+			{
+				continue;
+			}
+
+			seconds += chrono::duration<double>(end - begin).count();
+			asmInsns += bRes.instructions.size();
+			for (llvm::BasicBlock& bb : *f)
+			{
+				irInsns += bb.size();
+			}
+			--irInsns; // The terminating ret is not translated IR.
+		}
+		catch (const Capstone2LlvmIrBaseError& e)
+		{
+			cerr << e.what() << endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	cout << "{" << endl;
+	cout << "\t\"arch\": \"" << po.getArchName() << "\"," << endl;
+	cout << "\t\"basic_mode\": \"" << po.getBasicModeName() << "\"," << endl;
+	cout << "\t\"extra_mode\": \"" << po.getExtraModeName() << "\"," << endl;
+	cout << "\t\"code_bytes\": " << po.code.size() << "," << endl;
+	cout << "\t\"iterations\": " << po.benchIters << "," << endl;
+	cout << "\t\"warmup_iterations\": " << po.benchWarmup << "," << endl;
+	cout << "\t\"asm_instructions\": " << asmInsns << "," << endl;
+	cout << "\t\"ir_instructions\": " << irInsns << "," << endl;
+	cout << "\t\"seconds\": " << seconds << "," << endl;
+	cout << "\t\"asm_instructions_per_second\": "
+			<< (seconds > 0.0 ? asmInsns / seconds : 0.0) << "," << endl;
+	cout << "\t\"ir_instructions_per_asm_instruction\": "
+			<< (asmInsns ? static_cast<double>(irInsns) / asmInsns : 0.0)
+			<< endl;
+	cout << "}" << endl;
+
+	return EXIT_SUCCESS;
+}
+
 int main(int argc, char *argv[])
 {
 	ProgramOptions po(argc, argv);
@@ -342,6 +472,13 @@ int main(int argc, char *argv[])
 		assemble(po);
 	}
 
+	if (po.bench)
+	{
+		// Only the JSON report goes to standard output in benchmark mode,
+		// so it can be consumed by scripts comparing releases.
+		return benchmark(po);
+	}
+
 	printVersion();
 
 	llvm::LLVMContext ctx;
@@ -22,6 +22,82 @@
 namespace retdec {
 namespace config {
 
+//
+//=============================================================================
+// JsonStreamWriter
+//=============================================================================
+//
+
+JsonStreamWriter::JsonStreamWriter(std::ostream& out) :
+		_out(out)
+{
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "";
+	_subtreeWriter.reset( builder.newStreamWriter() );
+}
+
+void JsonStreamWriter::beginObject()
+{
+	separateInArray();
+	_out << '{';
+	_levels.push_back( {true, false} );
+}
+
+void JsonStreamWriter::endObject()
+{
+	_levels.pop_back();
+	_out << '}';
+}
+
+void JsonStreamWriter::beginArray()
+{
+	separateInArray();
+	_out << '[';
+	_levels.push_back( {false, false} );
+}
+
+void JsonStreamWriter::endArray()
+{
+	_levels.pop_back();
+	_out << ']';
+}
+
+void JsonStreamWriter::key(const std::string& name)
+{
+	auto& top = _levels.back();
+	if (top.hasMembers)
+	{
+		_out << ',';
+	}
+	top.hasMembers = true;
+	_out << Json::valueToQuotedString( name.c_str() ) << ':';
+}
+
+void JsonStreamWriter::value(const Json::Value& val)
+{
+	separateInArray();
+	_subtreeWriter->write(val, &_out);
+}
+
+/**
+ * Writes the separating comma if a value is emitted into an array that
+ * already has members. Values emitted into objects are separated by their
+ * key() instead.
+ */
+void JsonStreamWriter::separateInArray()
+{
+	if (_levels.empty() || _levels.back().isObject)
+	{
+		return;
+	}
+
+	if (_levels.back().hasMembers)
+	{
+		_out << ',';
+	}
+	_levels.back().hasMembers = true;
+}
+
 /**
  * If JSON value is not an object value, throw an internal exception.
  * @param val Value to check.
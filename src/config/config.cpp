@@ -4,7 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <sstream>
 
 #include "retdec/config/config.h"
 #include "retdec/utils/string.h"
@@ -45,6 +48,519 @@ const std::string JSON_patterns          = "patterns";
 namespace retdec {
 namespace config {
 
+namespace {
+
+/**
+ * Binary configuration format -- a compact, length-prefixed encoding of the
+ * same value tree that the JSON representation uses. Every value starts with
+ * a one-byte tag; integers are fixed 64-bit little endian, strings and
+ * containers are prefixed with a 32-bit little endian size. The file starts
+ * with a magic and a format version, so readers can tell the two formats
+ * apart and old readers reject newer files.
+ */
+const char BIN_magic[4] = { 'R', 'D', 'C', 'B' };
+const std::uint32_t BIN_version = 1;
+
+enum eBinaryTag
+{
+	BIN_TAG_NULL   = 0,
+	BIN_TAG_FALSE  = 1,
+	BIN_TAG_TRUE   = 2,
+	BIN_TAG_INT    = 3,
+	BIN_TAG_UINT   = 4,
+	BIN_TAG_DOUBLE = 5,
+	BIN_TAG_STRING = 6,
+	BIN_TAG_ARRAY  = 7,
+	BIN_TAG_OBJECT = 8
+};
+
+bool binHasMagic(const std::string& data)
+{
+	return data.size() >= sizeof(BIN_magic)
+			&& std::memcmp(data.data(), BIN_magic, sizeof(BIN_magic)) == 0;
+}
+
+void binAppendU32(std::string& out, std::uint32_t v)
+{
+	for (unsigned i = 0; i < 4; ++i)
+	{
+		out.push_back( static_cast<char>((v >> (8*i)) & 0xff) );
+	}
+}
+
+void binAppendU64(std::string& out, std::uint64_t v)
+{
+	for (unsigned i = 0; i < 8; ++i)
+	{
+		out.push_back( static_cast<char>((v >> (8*i)) & 0xff) );
+	}
+}
+
+std::uint32_t binReadU32(const std::string& data, std::size_t& pos)
+{
+	if (data.size() < pos + 4)
+		throw ParseException("Truncated binary configuration", 0, 0);
+
+	std::uint32_t v = 0;
+	for (unsigned i = 0; i < 4; ++i)
+	{
+		v |= std::uint32_t(static_cast<unsigned char>(data[pos + i])) << (8*i);
+	}
+	pos += 4;
+	return v;
+}
+
+std::uint64_t binReadU64(const std::string& data, std::size_t& pos)
+{
+	if (data.size() < pos + 8)
+		throw ParseException("Truncated binary configuration", 0, 0);
+
+	std::uint64_t v = 0;
+	for (unsigned i = 0; i < 8; ++i)
+	{
+		v |= std::uint64_t(static_cast<unsigned char>(data[pos + i])) << (8*i);
+	}
+	pos += 8;
+	return v;
+}
+
+std::string binReadString(const std::string& data, std::size_t& pos)
+{
+	auto len = binReadU32(data, pos);
+	if (data.size() - pos < len)
+		throw ParseException("Truncated binary configuration", 0, 0);
+
+	std::string s = data.substr(pos, len);
+	pos += len;
+	return s;
+}
+
+void binWriteValue(const Json::Value& val, std::string& out)
+{
+	switch (val.type())
+	{
+		case Json::nullValue:
+			out.push_back(BIN_TAG_NULL);
+			break;
+
+		case Json::booleanValue:
+			out.push_back(val.asBool() ? BIN_TAG_TRUE : BIN_TAG_FALSE);
+			break;
+
+		case Json::intValue:
+			out.push_back(BIN_TAG_INT);
+			binAppendU64(out, static_cast<std::uint64_t>(val.asInt64()));
+			break;
+
+		case Json::uintValue:
+			out.push_back(BIN_TAG_UINT);
+			binAppendU64(out, val.asUInt64());
+			break;
+
+		case Json::realValue:
+		{
+			out.push_back(BIN_TAG_DOUBLE);
+			double d = val.asDouble();
+			std::uint64_t bits;
+			std::memcpy(&bits, &d, sizeof(bits));
+			binAppendU64(out, bits);
+			break;
+		}
+
+		case Json::stringValue:
+		{
+			out.push_back(BIN_TAG_STRING);
+			auto s = val.asString();
+			binAppendU32(out, s.size());
+			out.append(s);
+			break;
+		}
+
+		case Json::arrayValue:
+			out.push_back(BIN_TAG_ARRAY);
+			binAppendU32(out, val.size());
+			for (const auto& item : val)
+			{
+				binWriteValue(item, out);
+			}
+			break;
+
+		case Json::objectValue:
+			out.push_back(BIN_TAG_OBJECT);
+			binAppendU32(out, val.size());
+			for (const auto& name : val.getMemberNames())
+			{
+				binAppendU32(out, name.size());
+				out.append(name);
+				binWriteValue(val[name], out);
+			}
+			break;
+	}
+}
+
+Json::Value binReadValue(const std::string& data, std::size_t& pos)
+{
+	if (pos >= data.size())
+		throw ParseException("Truncated binary configuration", 0, 0);
+
+	auto tag = static_cast<unsigned char>(data[pos++]);
+	switch (tag)
+	{
+		case BIN_TAG_NULL:
+			return Json::Value();
+
+		case BIN_TAG_FALSE:
+			return Json::Value(false);
+
+		case BIN_TAG_TRUE:
+			return Json::Value(true);
+
+		case BIN_TAG_INT:
+			return Json::Value(
+					static_cast<Json::Int64>(binReadU64(data, pos)));
+
+		case BIN_TAG_UINT:
+			return Json::Value(
+					static_cast<Json::UInt64>(binReadU64(data, pos)));
+
+		case BIN_TAG_DOUBLE:
+		{
+			auto bits = binReadU64(data, pos);
+			double d;
+			std::memcpy(&d, &bits, sizeof(d));
+			return Json::Value(d);
+		}
+
+		case BIN_TAG_STRING:
+			return Json::Value(binReadString(data, pos));
+
+		case BIN_TAG_ARRAY:
+		{
+			auto cnt = binReadU32(data, pos);
+			Json::Value v(Json::arrayValue);
+			for (std::uint32_t i = 0; i < cnt; ++i)
+			{
+				v.append(binReadValue(data, pos));
+			}
+			return v;
+		}
+
+		case BIN_TAG_OBJECT:
+		{
+			auto cnt = binReadU32(data, pos);
+			Json::Value v(Json::objectValue);
+			for (std::uint32_t i = 0; i < cnt; ++i)
+			{
+				auto key = binReadString(data, pos);
+				v[key] = binReadValue(data, pos);
+			}
+			return v;
+		}
+
+		default:
+			throw ParseException("Unknown tag in binary configuration", 0, 0);
+	}
+}
+
+/**
+ * Streaming emitter of the binary configuration format.
+ *
+ * Objects and arrays are length-prefixed with their member counts, which
+ * are not known upfront when streaming; begin*() therefore reserves the
+ * count field and end*() patches it in place once the count is known.
+ */
+class BinaryStreamWriter : public ConfigStreamWriter
+{
+	public:
+		explicit BinaryStreamWriter(std::string& out) :
+				_out(out)
+		{
+
+		}
+
+		virtual void beginObject() override
+		{
+			countInArray();
+			_out.push_back(BIN_TAG_OBJECT);
+			_levels.push_back( {true, _out.size(), 0} );
+			binAppendU32(_out, 0);
+		}
+
+		virtual void endObject() override
+		{
+			patchCount();
+		}
+
+		virtual void beginArray() override
+		{
+			countInArray();
+			_out.push_back(BIN_TAG_ARRAY);
+			_levels.push_back( {false, _out.size(), 0} );
+			binAppendU32(_out, 0);
+		}
+
+		virtual void endArray() override
+		{
+			patchCount();
+		}
+
+		virtual void key(const std::string& name) override
+		{
+			++_levels.back().count;
+			binAppendU32(_out, name.size());
+			_out.append(name);
+		}
+
+		virtual void value(const Json::Value& val) override
+		{
+			countInArray();
+			binWriteValue(val, _out);
+		}
+
+	private:
+		/// Object members are counted by their key() -- only values emitted
+		/// directly into an array have to be counted here.
+		void countInArray()
+		{
+			if (!_levels.empty() && !_levels.back().isObject)
+			{
+				++_levels.back().count;
+			}
+		}
+
+		void patchCount()
+		{
+			auto level = _levels.back();
+			_levels.pop_back();
+			for (unsigned i = 0; i < 4; ++i)
+			{
+				_out[level.countPos + i] =
+						static_cast<char>((level.count >> (8*i)) & 0xff);
+			}
+		}
+
+	private:
+		/// One entry per open object or array.
+		struct Level
+		{
+			bool isObject;
+			std::size_t countPos;
+			std::uint32_t count;
+		};
+
+	private:
+		std::string& _out;
+		std::vector<Level> _levels;
+};
+
+/**
+ * Structural scanner over a JSON document.
+ *
+ * The scanner does not build any values - it only finds the spans of values
+ * in the document, so a streaming parser can split a huge configuration into
+ * top-level members and array elements and hand every span separately to the
+ * (DOM building) JsonCpp reader. Whitespace and comments are skipped the
+ * same way the JsonCpp reader skips them.
+ */
+class JsonSpanScanner
+{
+	public:
+		explicit JsonSpanScanner(const std::string& json) :
+				_s(json)
+		{
+
+		}
+
+		/**
+		 * Peek at the first character of the next token.
+		 * @return Character, or '\0' at the end of the document.
+		 */
+		char peek()
+		{
+			skipSpace();
+			return _pos < _s.size() ? _s[_pos] : '\0';
+		}
+
+		/**
+		 * Consume the expected character.
+		 * @param c Expected character.
+		 * @return @c true if the character was consumed, @c false otherwise.
+		 */
+		bool eat(char c)
+		{
+			if (peek() != c)
+			{
+				return false;
+			}
+			++_pos;
+			return true;
+		}
+
+		/**
+		 * Scan over one string literal.
+		 * @param raw Where to store the raw (still escaped) content. May be
+		 * @c nullptr if the content is not needed.
+		 * @return @c true if a whole string literal was scanned.
+		 */
+		bool scanString(std::string* raw = nullptr)
+		{
+			if (!eat('"'))
+			{
+				return false;
+			}
+
+			std::size_t begin = _pos;
+			while (_pos < _s.size())
+			{
+				char c = _s[_pos];
+				if (c == '\\')
+				{
+					_pos += 2;
+					continue;
+				}
+				if (c == '"')
+				{
+					if (raw)
+					{
+						*raw = _s.substr(begin, _pos - begin);
+					}
+					++_pos;
+					return true;
+				}
+				++_pos;
+			}
+
+			return false;
+		}
+
+		/**
+		 * Scan over one value of any type.
+		 * @param begin Where to store the span start.
+		 * @param end Where to store the span end.
+		 * @return @c true if a whole well-formed value was scanned.
+		 */
+		bool scanValue(std::size_t& begin, std::size_t& end)
+		{
+			skipSpace();
+			begin = _pos;
+			if (!skipValue())
+			{
+				return false;
+			}
+			end = _pos;
+			return true;
+		}
+
+		/**
+		 * Check that nothing but whitespace and comments remains.
+		 * @return @c true at the end of the document.
+		 */
+		bool atEnd()
+		{
+			skipSpace();
+			return _pos >= _s.size();
+		}
+
+	private:
+		/**
+		 * Skip whitespace and comments before the next token.
+		 */
+		void skipSpace()
+		{
+			while (_pos < _s.size())
+			{
+				char c = _s[_pos];
+				if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+				{
+					++_pos;
+				}
+				else if (c == '/' && _pos + 1 < _s.size() && _s[_pos+1] == '/')
+				{
+					while (_pos < _s.size() && _s[_pos] != '\n')
+					{
+						++_pos;
+					}
+				}
+				else if (c == '/' && _pos + 1 < _s.size() && _s[_pos+1] == '*')
+				{
+					_pos += 2;
+					while (_pos + 1 < _s.size()
+							&& !(_s[_pos] == '*' && _s[_pos+1] == '/'))
+					{
+						++_pos;
+					}
+					_pos = std::min(_pos + 2, _s.size());
+				}
+				else
+				{
+					break;
+				}
+			}
+		}
+
+		/**
+		 * Scan over one value without recording its span.
+		 * @return @c true if a whole well-formed value was scanned.
+		 */
+		bool skipValue()
+		{
+			switch (peek())
+			{
+				case '"':
+					return scanString();
+
+				case '{':
+				case '[':
+				{
+					char open = _s[_pos++];
+					char close = open == '{' ? '}' : ']';
+					if (eat(close))
+					{
+						return true;
+					}
+					while (true)
+					{
+						if (open == '{' && (!scanString() || !eat(':')))
+						{
+							return false;
+						}
+						if (!skipValue())
+						{
+							return false;
+						}
+						if (eat(','))
+						{
+							continue;
+						}
+						return eat(close);
+					}
+				}
+
+				case '\0':
+					return false;
+
+				default:
+				{
+					// Number, true, false, null - everything up to the next
+					// structural character.
+					auto begin = _pos;
+					while (_pos < _s.size()
+							&& std::strchr(",}] \t\r\n/", _s[_pos]) == nullptr)
+					{
+						++_pos;
+					}
+					return _pos > begin;
+				}
+			}
+		}
+
+	private:
+		const std::string& _s; ///< scanned document
+		std::size_t _pos = 0;  ///< actual position
+};
+
+} // anonymous namespace
+
 Config Config::empty(const std::string& path)
 {
 	Config config;
@@ -55,7 +571,7 @@ Config Config::empty(const std::string& path)
 Config Config::fromFile(const std::string& path)
 {
 	Config config;
-	config.readJsonFile(path);
+	config.readFile(path);
 	return config;
 }
 
@@ -117,6 +633,69 @@ void Config::readJsonFile(const std::string& input)
 	_configFileName = input;
 }
 
+/**
+ * Reads binary configuration file into internal representation.
+ * If file can not be opened, an instance of @c FileNotFoundException is thrown.
+ * If file can not be decoded, an instance of @c ParseException is thrown.
+ * @param input Path to input binary configuration file.
+ */
+void Config::readBinaryFile(const std::string& input)
+{
+	std::ifstream binFile(input, std::ios::in | std::ios::binary);
+	if (!binFile)
+	{
+		_configFileName.clear();
+		std::string msg = "Input file \"" + input + "\" can not be opened.";
+		throw FileNotFoundException(msg);
+	}
+
+	std::string content;
+	binFile.seekg(0, std::ios::end);
+	content.resize(binFile.tellg());
+	binFile.seekg(0, std::ios::beg);
+	binFile.read(&content[0], content.size());
+	binFile.close();
+
+	readBinaryString(content);
+	_configFileName = input;
+}
+
+/**
+ * Reads configuration file into internal representation. The format is
+ * detected by file magic -- binary configurations are decoded directly,
+ * anything else is parsed as JSON.
+ * If file can not be opened, an instance of @c FileNotFoundException is thrown.
+ * If file can not be parsed, an instance of @c ParseException is thrown.
+ * @param input Path to input configuration file.
+ */
+void Config::readFile(const std::string& input)
+{
+	std::ifstream cFile(input, std::ios::in | std::ios::binary);
+	if (!cFile)
+	{
+		_configFileName.clear();
+		std::string msg = "Input file \"" + input + "\" can not be opened.";
+		throw FileNotFoundException(msg);
+	}
+
+	std::string content;
+	cFile.seekg(0, std::ios::end);
+	content.resize(cFile.tellg());
+	cFile.seekg(0, std::ios::beg);
+	cFile.read(&content[0], content.size());
+	cFile.close();
+
+	if (binHasMagic(content))
+	{
+		readBinaryString(content);
+	}
+	else
+	{
+		readJsonString(content);
+	}
+	_configFileName = input;
+}
+
 /**
  * Generates JSON configuration file.
  * @return Path to generated JSON file.
@@ -139,49 +718,91 @@ std::string Config::generateJsonFile(const std::string& outputFilePath) const
 	std::string jsonName = (outputFilePath.empty()) ? (getInputFile() + ".json") : (outputFilePath);
 
 	std::ofstream jsonFile( jsonName.c_str() );
-	jsonFile << generateJsonString();
+	JsonStreamWriter writer(jsonFile);
+	writeJsonValue(writer);
 
 	return jsonName;
 }
 
+/**
+ * Generates binary configuration file.
+ * The file contains the same data as the JSON representation in the compact
+ * binary encoding and can be read back by readBinaryFile() or readFile().
+ * @param outputFilePath Path to output file. If not set, use 'inputName'.
+ * @return Path to generated binary configuration file.
+ */
+std::string Config::generateBinaryFile(const std::string& outputFilePath) const
+{
+	std::string binName = (outputFilePath.empty()) ? (getInputFile() + ".config.bin") : (outputFilePath);
+
+	std::string out;
+	out.append(BIN_magic, sizeof(BIN_magic));
+	binAppendU32(out, BIN_version);
+	BinaryStreamWriter writer(out);
+	writeJsonValue(writer);
+
+	std::ofstream binFile(binName.c_str(), std::ios::out | std::ios::binary);
+	binFile.write(out.data(), out.size());
+
+	return binName;
+}
+
+/**
+ * Generates JSON value tree representing the configuration.
+ * @return JSON value tree.
+ */
+/**
+ * Streams configuration into the provided writer.
+ * Simple members are emitted as (small) JSON values; the big containers
+ * are streamed element by element, so the whole configuration never
+ * exists as one JSON value tree.
+ * @param w Writer to stream into.
+ */
+void Config::writeJsonValue(ConfigStreamWriter& w) const
+{
+	w.beginObject();
+
+	w.key(JSON_date);      w.value( retdec::utils::getCurrentDate() );
+	w.key(JSON_time);      w.value( retdec::utils::getCurrentTime() );
+	w.key(JSON_inputFile); w.value( getInputFile() );
+
+	if (isIda()) { w.key(JSON_ida); w.value( isIda() ); }
+	if (!getUnpackedInputFile().empty()) { w.key(JSON_unpackedInputFile); w.value( getUnpackedInputFile() ); }
+	if (!getPdbInputFile().empty()) { w.key(JSON_pdbInputFile); w.value( getPdbInputFile() ); }
+	if (!getFrontendVersion().empty()) { w.key(JSON_frontendVersion); w.value( getFrontendVersion() ); }
+	if (getEntryPoint().isDefined()) { w.key(JSON_entryPoint); w.value( getEntryPoint().getValue() ); }
+	if (getMainAddress().isDefined()) { w.key(JSON_mainAddress); w.value( getMainAddress().getValue() ); }
+	if (getSectionVMA().isDefined()) { w.key(JSON_sectionVMA); w.value( getSectionVMA().getValue() ); }
+	if (getImageBase().isDefined()) { w.key(JSON_imageBase); w.value( getImageBase().getValue() ); }
+
+	w.key(JSON_parameters);   w.value( parameters.getJsonValue() );
+	w.key(JSON_architecture); w.value( architecture.getJsonValue() );
+	w.key(JSON_fileType);     w.value( fileType.getJsonValue() );
+	w.key(JSON_fileFormat);   w.value( fileFormat.getJsonValue() );
+	w.key(JSON_tools);        tools.writeJsonValue(w);
+	w.key(JSON_languages);    languages.writeJsonValue(w);
+	w.key(JSON_functions);    functions.writeJsonValue(w);
+	w.key(JSON_globals);      globals.writeJsonValue(w);
+	w.key(JSON_registers);    registers.writeJsonValue(w);
+	w.key(JSON_structures);   structures.writeJsonValue(w);
+	w.key(JSON_segments);     segments.writeJsonValue(w);
+	w.key(JSON_vtables);      vtables.writeJsonValue(w);
+	w.key(JSON_classes);      classes.writeJsonValue(w);
+	w.key(JSON_patterns);     patterns.writeJsonValue(w);
+
+	w.endObject();
+}
+
 /**
  * Generates string containing JSON representation of configuration.
  * @return JSON string.
  */
 std::string Config::generateJsonString() const
 {
-	Json::Value root;
-
-	root[JSON_date]           = retdec::utils::getCurrentDate();
-	root[JSON_time]           = retdec::utils::getCurrentTime();
-	root[JSON_inputFile]      = getInputFile();
-
-	if (isIda()) root[JSON_ida] = isIda();
-	if (!getUnpackedInputFile().empty()) root[JSON_unpackedInputFile] = getUnpackedInputFile();
-	if (!getPdbInputFile().empty()) root[JSON_pdbInputFile] = getPdbInputFile();
-	if (!getFrontendVersion().empty()) root[JSON_frontendVersion] = getFrontendVersion();
-	if (getEntryPoint().isDefined()) root[JSON_entryPoint] = getEntryPoint().getValue();
-	if (getMainAddress().isDefined()) root[JSON_mainAddress] = getMainAddress().getValue();
-	if (getSectionVMA().isDefined()) root[JSON_sectionVMA] = getSectionVMA().getValue();
-	if (getImageBase().isDefined()) root[JSON_imageBase] = getImageBase().getValue();
-
-	root[JSON_parameters]     = parameters.getJsonValue();
-	root[JSON_architecture]   = architecture.getJsonValue();
-	root[JSON_fileType]       = fileType.getJsonValue();
-	root[JSON_fileFormat]     = fileFormat.getJsonValue();
-	root[JSON_tools]          = tools.getJsonValue();
-	root[JSON_languages]      = languages.getJsonValue();
-	root[JSON_functions]      = functions.getJsonValue();
-	root[JSON_globals]        = globals.getJsonValue();
-	root[JSON_registers]      = registers.getJsonValue();
-	root[JSON_structures]     = structures.getJsonValue();
-	root[JSON_segments]       = segments.getJsonValue();
-	root[JSON_vtables]        = vtables.getJsonValue();
-	root[JSON_classes]        = classes.getJsonValue();
-	root[JSON_patterns]       = patterns.getJsonValue();
-
-	StreamWriterBuilder builder;
-	return writeString(builder, root);
+	std::ostringstream out;
+	JsonStreamWriter writer(out);
+	writeJsonValue(writer);
+	return out.str();
 }
 
 /**
@@ -191,6 +812,26 @@ std::string Config::generateJsonString() const
  */
 void Config::readJsonString(const std::string& json)
 {
+	// Stream into a temporary configuration, so a failed parse leaves this
+	// configuration untouched.
+	try
+	{
+		Config streamed;
+		if (streamed.readJsonStringStreaming(json))
+		{
+			*this = std::move(streamed);
+			return;
+		}
+	}
+	catch (const InternalException& e)
+	{
+		auto loc = retdec::utils::getLineAndColumnFromPosition(json, e.getPosition());
+		throw ParseException(e.getMessage(), loc.first, loc.second);
+	}
+
+	// The streaming parse did not succeed - fall back to the DOM parser,
+	// which also produces the error positions to report for malformed
+	// documents.
 	Json::Value root;
 	std::string errs;
 
@@ -226,34 +867,9 @@ void Config::readJsonString(const std::string& json)
 		throw ParseException(errMsg, line, column);
 	}
 
-	*this = Config();
-
 	try
 	{
-		setIsIda( safeGetBool(root, JSON_ida) );
-		setInputFile( safeGetString(root, JSON_inputFile) );
-		setUnpackedInputFile( safeGetString(root, JSON_unpackedInputFile) );
-		setPdbInputFile( safeGetString(root, JSON_pdbInputFile) );
-		setFrontendVersion( safeGetString(root, JSON_frontendVersion) );
-		setEntryPoint( safeGetAddress(root, JSON_entryPoint) );
-		setMainAddress( safeGetAddress(root, JSON_mainAddress) );
-		setSectionVMA( safeGetAddress(root, JSON_sectionVMA) );
-		setImageBase( safeGetAddress(root, JSON_imageBase) );
-
-		parameters.readJsonValue( root[JSON_parameters] );
-		architecture.readJsonValue( root[JSON_architecture] );
-		fileType.readJsonValue( root[JSON_fileType] );
-		fileFormat.readJsonValue( root[JSON_fileFormat] );
-		tools.readJsonValue( root[JSON_tools] );
-		languages.readJsonValue( root[JSON_languages] );
-		functions.readJsonValue( root[JSON_functions] );
-		globals.readJsonValue( root[JSON_globals] );
-		registers.readJsonValue( root[JSON_registers] );
-		structures.readJsonValue( root[JSON_structures] );
-		segments.readJsonValue( root[JSON_segments] );
-		vtables.readJsonValue( root[JSON_vtables] );
-		classes.readJsonValue( root[JSON_classes] );
-		patterns.readJsonValue( root[JSON_patterns] );
+		readJsonValue(root);
 	}
 	catch (const InternalException& e)
 	{
@@ -262,5 +878,241 @@ void Config::readJsonString(const std::string& json)
 	}
 }
 
+/**
+ * Reads string containing JSON representation of configuration by splitting
+ * it into top-level member spans and parsing every span separately. The big
+ * containers are populated element by element, so only one element's JSON
+ * tree exists at a time and the whole document is never materialized as one
+ * value tree.
+ * If a value has a wrong type, an instance of @c InternalException is thrown,
+ * with a position relative to the whole document.
+ * @param json JSON string.
+ * @return @c true if the configuration was read, @c false if the document
+ * does not scan and the caller should fall back to the DOM parser.
+ */
+bool Config::readJsonStringStreaming(const std::string& json)
+{
+	JsonSpanScanner scanner(json);
+	if (!scanner.eat('{'))
+	{
+		return false;
+	}
+
+	*this = Config();
+
+	Json::CharReaderBuilder rbuilder;
+	std::unique_ptr<Json::CharReader> reader(rbuilder.newCharReader());
+
+	// Parse one value span into a (small) JSON value tree.
+	auto parseSpan = [&](std::size_t begin, std::size_t end, Json::Value& out)
+	{
+		std::string errs;
+		return reader->parse(json.data() + begin, json.data() + end, &out, &errs);
+	};
+
+	// Read elements of a container member one by one.
+	auto readContainer = [&](auto& container) -> bool
+	{
+		if (scanner.peek() != '[')
+		{
+			// Same as reading a non-array value with the DOM parser - the
+			// container only gets cleared.
+			std::size_t begin, end;
+			Json::Value val;
+			if (!scanner.scanValue(begin, end) || !parseSpan(begin, end, val))
+			{
+				return false;
+			}
+			container.readJsonValue(val);
+			return true;
+		}
+
+		scanner.eat('[');
+		container.beginReadingJson();
+		if (scanner.eat(']'))
+		{
+			return true;
+		}
+		while (true)
+		{
+			std::size_t begin, end;
+			Json::Value elem;
+			if (!scanner.scanValue(begin, end) || !parseSpan(begin, end, elem))
+			{
+				return false;
+			}
+			try
+			{
+				container.readJsonElement(elem);
+			}
+			catch (const InternalException& e)
+			{
+				// Positions in the element tree are relative to its span.
+				throw InternalException(e.getMessage(), begin + e.getPosition());
+			}
+			if (scanner.eat(','))
+			{
+				continue;
+			}
+			return scanner.eat(']');
+		}
+	};
+
+	if (!scanner.eat('}'))
+	{
+		while (true)
+		{
+			std::string key;
+			if (!scanner.scanString(&key) || !scanner.eat(':'))
+			{
+				return false;
+			}
+			if (key.find('\\') != std::string::npos)
+			{
+				// Escaped keys are rare enough to leave to the DOM parser.
+				return false;
+			}
+
+			bool ok = true;
+			if (key == JSON_tools)           ok = readContainer(tools);
+			else if (key == JSON_languages)  ok = readContainer(languages);
+			else if (key == JSON_functions)  ok = readContainer(functions);
+			else if (key == JSON_globals)    ok = readContainer(globals);
+			else if (key == JSON_registers)  ok = readContainer(registers);
+			else if (key == JSON_structures) ok = readContainer(structures);
+			else if (key == JSON_segments)   ok = readContainer(segments);
+			else if (key == JSON_vtables)    ok = readContainer(vtables);
+			else if (key == JSON_classes)    ok = readContainer(classes);
+			else if (key == JSON_patterns)   ok = readContainer(patterns);
+			else
+			{
+				std::size_t begin, end;
+				Json::Value val;
+				if (!scanner.scanValue(begin, end)
+						|| !parseSpan(begin, end, val))
+				{
+					return false;
+				}
+
+				// Wrap the value under its name, so type errors from
+				// safeGet*() carry the same messages as with the DOM parser.
+				Json::Value member(Json::objectValue);
+				member[key].swap(val);
+
+				try
+				{
+					if (key == JSON_ida) setIsIda( safeGetBool(member, key) );
+					else if (key == JSON_inputFile) setInputFile( safeGetString(member, key) );
+					else if (key == JSON_unpackedInputFile) setUnpackedInputFile( safeGetString(member, key) );
+					else if (key == JSON_pdbInputFile) setPdbInputFile( safeGetString(member, key) );
+					else if (key == JSON_frontendVersion) setFrontendVersion( safeGetString(member, key) );
+					else if (key == JSON_entryPoint) setEntryPoint( safeGetAddress(member, key) );
+					else if (key == JSON_mainAddress) setMainAddress( safeGetAddress(member, key) );
+					else if (key == JSON_sectionVMA) setSectionVMA( safeGetAddress(member, key) );
+					else if (key == JSON_imageBase) setImageBase( safeGetAddress(member, key) );
+					else if (key == JSON_parameters) parameters.readJsonValue( member[key] );
+					else if (key == JSON_architecture) architecture.readJsonValue( member[key] );
+					else if (key == JSON_fileType) fileType.readJsonValue( member[key] );
+					else if (key == JSON_fileFormat) fileFormat.readJsonValue( member[key] );
+					// Unknown members are ignored, same as with the DOM
+					// parser. Absent members keep the defaults of a fresh
+					// configuration, which is what reading a null value
+					// would set as well.
+				}
+				catch (const InternalException& e)
+				{
+					// Positions in the member tree are relative to its span.
+					throw InternalException(e.getMessage(), begin + e.getPosition());
+				}
+			}
+			if (!ok)
+			{
+				return false;
+			}
+
+			if (scanner.eat(','))
+			{
+				continue;
+			}
+			if (!scanner.eat('}'))
+			{
+				return false;
+			}
+			break;
+		}
+	}
+
+	return scanner.atEnd();
+}
+
+/**
+ * Reads string containing the binary representation of configuration.
+ * If data can not be decoded, an instance of @c ParseException is thrown.
+ * @param data Binary configuration data.
+ */
+void Config::readBinaryString(const std::string& data)
+{
+	if (!binHasMagic(data))
+	{
+		throw ParseException("Missing binary configuration magic", 0, 0);
+	}
+
+	std::size_t pos = sizeof(BIN_magic);
+	auto version = binReadU32(data, pos);
+	if (version != BIN_version)
+	{
+		throw ParseException("Unsupported binary configuration version", 0, 0);
+	}
+
+	Json::Value root = binReadValue(data, pos);
+	if (root.isNull() || !root.isObject())
+	{
+		throw ParseException("Invalid binary configuration", 0, 0);
+	}
+
+	try
+	{
+		readJsonValue(root);
+	}
+	catch (const InternalException& e)
+	{
+		throw ParseException(e.getMessage(), 0, 0);
+	}
+}
+
+/**
+ * Reads JSON value tree into internal representation.
+ * @param root JSON value tree.
+ */
+void Config::readJsonValue(const Json::Value& root)
+{
+	*this = Config();
+
+	setIsIda( safeGetBool(root, JSON_ida) );
+	setInputFile( safeGetString(root, JSON_inputFile) );
+	setUnpackedInputFile( safeGetString(root, JSON_unpackedInputFile) );
+	setPdbInputFile( safeGetString(root, JSON_pdbInputFile) );
+	setFrontendVersion( safeGetString(root, JSON_frontendVersion) );
+	setEntryPoint( safeGetAddress(root, JSON_entryPoint) );
+	setMainAddress( safeGetAddress(root, JSON_mainAddress) );
+	setSectionVMA( safeGetAddress(root, JSON_sectionVMA) );
+	setImageBase( safeGetAddress(root, JSON_imageBase) );
+
+	parameters.readJsonValue( root[JSON_parameters] );
+	architecture.readJsonValue( root[JSON_architecture] );
+	fileType.readJsonValue( root[JSON_fileType] );
+	fileFormat.readJsonValue( root[JSON_fileFormat] );
+	tools.readJsonValue( root[JSON_tools] );
+	languages.readJsonValue( root[JSON_languages] );
+	functions.readJsonValue( root[JSON_functions] );
+	globals.readJsonValue( root[JSON_globals] );
+	registers.readJsonValue( root[JSON_registers] );
+	structures.readJsonValue( root[JSON_structures] );
+	segments.readJsonValue( root[JSON_segments] );
+	vtables.readJsonValue( root[JSON_vtables] );
+	classes.readJsonValue( root[JSON_classes] );
+	patterns.readJsonValue( root[JSON_patterns] );
+}
+
 } // namespace config
 } // namespace retdec
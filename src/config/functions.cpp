@@ -8,6 +8,7 @@
 
 #include "retdec/config/functions.h"
 #include "retdec/utils/const.h"
+#include "retdec/utils/string_pool.h"
 
 using retdec::utils::likeConstVersion;
 
@@ -39,6 +40,7 @@ const std::string JSON_isExported    = "isExported";
 const std::string JSON_isVariadic    = "isVariadic";
 const std::string JSON_isThumb       = "isThumb";
 const std::string JSON_usedCrypto    = "usedCryptoConstants";
+const std::string JSON_contentHash   = "contentHash";
 
 std::vector<std::string> fncTypes =
 {
@@ -61,7 +63,7 @@ namespace config {
 //
 
 Function::Function(const std::string& id) :
-		_name(id)
+		_name(&retdec::utils::internString(id))
 {
 
 }
@@ -94,6 +96,7 @@ Function Function::fromJsonValue(const Json::Value& val)
 	ret.setIsExported( safeGetBool(val, JSON_isExported) );
 	ret.setIsVariadic( safeGetBool(val, JSON_isVariadic) );
 	ret.setIsThumb( safeGetBool(val, JSON_isThumb) );
+	ret.setContentHash( safeGetString(val, JSON_contentHash) );
 
 	ret.callingConvention.readJsonValue( val[JSON_cc] );
 	ret.returnStorage.readJsonValue( val[JSON_returnStorage] );
@@ -143,6 +146,7 @@ Json::Value Function::getJsonValue() const
 	if (isExported()) fnc[JSON_isExported] = isExported();
 	if (isVariadic()) fnc[JSON_isVariadic] = isVariadic();
 	if (isThumb()) fnc[JSON_isThumb] = isThumb();
+	if (!getContentHash().empty()) fnc[JSON_contentHash] = getContentHash();
 
 	if (!parameters.empty()) fnc[JSON_parameters] = parameters.getJsonValue();
 	if (!locals.empty()) fnc[JSON_locals] = locals.getJsonValue();
@@ -176,7 +180,7 @@ bool Function::isThumb() const             { return _thumb; }
  */
 bool Function::isWrapper() const           { return !getWrappedFunctionName().empty(); }
 
-void Function::setName(const std::string& n)                { _name = n; }
+void Function::setName(const std::string& n)                { _name = &retdec::utils::internString(n); }
 void Function::setRealName(const std::string& n)            { _realName = n; }
 void Function::setDemangledName(const std::string& n)       { _demangledName = n; }
 void Function::setComment(const std::string& c)             { _comment = c; }
@@ -199,9 +203,10 @@ void Function::setIsVirtual(bool f)                         { _virtualFunction =
 void Function::setIsExported(bool f)                        { _exported = f; }
 void Function::setIsVariadic(bool f)                        { _variadic = f; }
 void Function::setIsThumb(bool f)                           { _thumb = f; }
+void Function::setContentHash(const std::string& h)         { _contentHash = h; }
 
 const std::string& Function::getId() const           { return getName(); }
-const std::string& Function::getName() const         { return _name; }
+const std::string& Function::getName() const         { return *_name; }
 const std::string& Function::getRealName() const     { return _realName; }
 std::string Function::getDemangledName() const       { return _demangledName; }
 std::string Function::getComment() const             { return _comment; }
@@ -210,6 +215,7 @@ std::string Function::getSourceFileName() const      { return _sourceFileName; }
 std::string Function::getWrappedFunctionName() const { return _wrapperdFunctionName; }
 LineNumber Function::getStartLine() const            { return _startLine; }
 LineNumber Function::getEndLine() const              { return _endLine; }
+const std::string& Function::getContentHash() const  { return _contentHash; }
 
 /**
  *
@@ -218,7 +224,7 @@ LineNumber Function::getEndLine() const              { return _endLine; }
  */
 bool Function::operator<(const Function& o) const
 {
-	return _name < o._name;
+	return *_name < *o._name;
 }
 /**
  *
@@ -227,6 +233,7 @@ bool Function::operator<(const Function& o) const
  */
 bool Function::operator==(const Function& o) const
 {
+	// Names are interned -- equal names share one pooled copy.
 	return _name == o._name;
 }
 /**
@@ -245,6 +252,30 @@ bool Function::operator!=(const Function& o) const
 //=============================================================================
 //
 
+FunctionContainer::FunctionContainer() :
+		BaseAssociativeContainer()
+{
+
+}
+
+FunctionContainer::FunctionContainer(const FunctionContainer& o) :
+		BaseAssociativeContainer(o)
+{
+	// Pointers in the copied index would point into the other container.
+	_addrIndexValid = false;
+}
+
+FunctionContainer& FunctionContainer::operator=(const FunctionContainer& o)
+{
+	if (this != &o)
+	{
+		BaseAssociativeContainer::operator=(o);
+		_addrIndex.clear();
+		_addrIndexValid = false;
+	}
+	return *this;
+}
+
 /**
  * @return @c True if container contains a function of the specified name.
  */
@@ -272,15 +303,36 @@ const Function* FunctionContainer::getFunctionByName(const std::string& name) co
  */
 Function* FunctionContainer::getFunctionByStartAddress(const retdec::utils::Address& addr)
 {
-	for (auto& elem : _data)
+	if (!_addrIndexValid)
 	{
-		if (addr == elem.second.getStart())
+		_addrIndex.clear();
+		_addrIndex.reserve(_data.size());
+		for (auto& elem : _data)
 		{
-			return &elem.second;
+			_addrIndex.push_back(&elem.second);
 		}
+		std::sort(
+				_addrIndex.begin(),
+				_addrIndex.end(),
+				[](const Function* a, const Function* b)
+				{
+					return a->getStart() < b->getStart();
+				});
+		_addrIndexValid = true;
 	}
 
-	return nullptr;
+	auto it = std::lower_bound(
+			_addrIndex.begin(),
+			_addrIndex.end(),
+			addr,
+			[](const Function* f, const retdec::utils::Address& a)
+			{
+				return f->getStart() < a;
+			});
+
+	return it != _addrIndex.end() && addr == (*it)->getStart()
+			? *it
+			: nullptr;
 }
 
 Function* FunctionContainer::getFunctionByRealName(const std::string& name)
@@ -296,5 +348,35 @@ Function* FunctionContainer::getFunctionByRealName(const std::string& name)
 	return nullptr;
 }
 
+/**
+ * Insert into underlying container and invalidate @c _addrIndex -- the new
+ * (or updated) element changes the address ordering.
+ */
+std::pair<FunctionContainer::iterator,bool> FunctionContainer::insert(
+		const Function& e)
+{
+	_addrIndexValid = false;
+	return BaseAssociativeContainer::insert(e);
+}
+
+/**
+ * Clear both underlying container and @c _addrIndex.
+ */
+void FunctionContainer::clear()
+{
+	_data.clear();
+	_addrIndex.clear();
+	_addrIndexValid = false;
+}
+
+/**
+ * Erase from underlying container and invalidate @c _addrIndex.
+ */
+size_t FunctionContainer::erase(const std::string& name)
+{
+	_addrIndexValid = false;
+	return _data.erase(name);
+}
+
 } // namespace config
 } // namespace retdec
@@ -4,9 +4,11 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <cassert>
 
 #include "retdec/config/objects.h"
+#include "retdec/utils/string_pool.h"
 
 namespace {
 
@@ -29,7 +31,7 @@ namespace config {
 //
 
 Object::Object(const std::string& name, const Storage& storage) :
-		_name(name),
+		_name(&retdec::utils::internString(name)),
 		_storage(storage)
 {
 	assert( !getName().empty() );
@@ -81,6 +83,7 @@ Json::Value Object::getJsonValue() const
  */
 bool Object::operator==(const Object& o) const
 {
+	// Names are interned -- equal names share one pooled copy.
 	return _name == o._name;
 }
 
@@ -89,7 +92,7 @@ bool Object::operator==(const Object& o) const
  */
 bool Object::operator<(const Object& o) const
 {
-	return _name < o._name;
+	return *_name < *o._name;
 }
 
 void Object::setRealName(const std::string& n)
@@ -122,7 +125,7 @@ const std::string& Object::getId() const
 
 const std::string& Object::getName() const
 {
-	return _name;
+	return *_name;
 }
 
 /**
@@ -282,21 +285,54 @@ GlobalVarContainer& GlobalVarContainer::operator=(const GlobalVarContainer& o)
 	{
 		ObjectSetContainer::operator=(o);
 		_addr2global.clear();
+		_addr2global.reserve(_data.size());
 		for (auto& p : _data)
 		{
-			_addr2global[p.second.getStorage().getAddress()] = &p.second;
+			_addr2global.emplace_back(
+					p.second.getStorage().getAddress(),
+					&p.second);
 		}
+		std::sort(
+				_addr2global.begin(),
+				_addr2global.end(),
+				[](const std::pair<retdec::utils::Address, const Object*>& a,
+						const std::pair<retdec::utils::Address, const Object*>& b)
+				{
+					return a.first < b.first;
+				});
 	}
 	return *this;
 }
 
+/**
+ * @return Iterator into @c _addr2global pointing to the entry with
+ * the specified address, or @c _addr2global.end() if there is none.
+ */
+std::vector<std::pair<retdec::utils::Address, const Object*>>::iterator
+GlobalVarContainer::addrFind(const retdec::utils::Address& address)
+{
+	auto it = std::lower_bound(
+			_addr2global.begin(),
+			_addr2global.end(),
+			address,
+			[](const std::pair<retdec::utils::Address, const Object*>& p,
+					const retdec::utils::Address& a)
+			{
+				return p.first < a;
+			});
+
+	return it != _addr2global.end() && it->first == address
+			? it
+			: _addr2global.end();
+}
+
 /**
  * @return Pointer to global object or @c nullptr if not found.
  */
 const Object* GlobalVarContainer::getObjectByAddress(
 		const retdec::utils::Address& address) const
 {
-	auto fIt = _addr2global.find(address);
+	auto fIt = const_cast<GlobalVarContainer*>(this)->addrFind(address);
 	return fIt != _addr2global.end() ? fIt->second : nullptr;
 }
 
@@ -327,12 +363,24 @@ std::pair<GlobalVarContainer::iterator,bool> GlobalVarContainer::insert(
 
 	const Object* obj = &retPair.first->second;
 	const auto& addr = e.getStorage().getAddress();
-	auto res = _addr2global.emplace(addr,obj);
-	if (!res.second)
+	auto pos = std::lower_bound(
+			_addr2global.begin(),
+			_addr2global.end(),
+			addr,
+			[](const std::pair<retdec::utils::Address, const Object*>& p,
+					const retdec::utils::Address& a)
+			{
+				return p.first < a;
+			});
+	if (pos != _addr2global.end() && pos->first == addr)
 	{
 		// There is already an object on this address, so overwrite it
 		// to ensure that it is updated.
-		res.first->second = obj;
+		pos->second = obj;
+	}
+	else
+	{
+		_addr2global.emplace(pos, addr, obj);
 	}
 
 	return retPair;
@@ -355,7 +403,11 @@ size_t GlobalVarContainer::erase(const Object& val)
 	assert(val.getStorage().isMemory());
 	if (val.getStorage().isMemory())
 	{
-		_addr2global.erase(val.getStorage().getAddress());
+		auto fIt = addrFind(val.getStorage().getAddress());
+		if (fIt != _addr2global.end())
+		{
+			_addr2global.erase(fIt);
+		}
 	}
 	return _data.erase(val.getId());
 }
@@ -11,6 +11,9 @@ namespace {
 const std::string JSON_verboseOut               = "verboseOut";
 const std::string JSON_keepAllFuncs             = "keepAllFuncs";
 const std::string JSON_selectedDecodeOnly       = "selectedDecodeOnly";
+const std::string JSON_lazyDecoding             = "lazyDecoding";
+const std::string JSON_incremental              = "incremental";
+const std::string JSON_staticCodeDecoding       = "staticCodeDecoding";
 const std::string JSON_outputFile               = "outputFile";
 const std::string JSON_frontendOutputFile       = "frontEndOutputFile";
 const std::string JSON_ordinalNumDir            = "ordinalNumDirectory";
@@ -54,6 +57,25 @@ bool Parameters::isKeepAllFunctions() const
  */
 bool Parameters::isSelectedDecodeOnly() const { return _selectedDecodeOnly; }
 
+/**
+ * @return Decode only code reachable from entry points, exports, and
+ * user-selected addresses. Other parts are decoded lazily, on demand.
+ */
+bool Parameters::isLazyDecoding() const { return _lazyDecoding; }
+
+/**
+ * @return Prune functions whose content hash matches a hash recorded in the
+ * input config -- only changed and new functions make it into the output.
+ */
+bool Parameters::isIncremental() const { return _incremental; }
+
+/**
+ * @return Decode and translate bodies of detected statically linked
+ * functions. If disabled (the default), detected library functions are
+ * turned into body-less known functions.
+ */
+bool Parameters::isStaticCodeDecoding() const { return _staticCodeDecoding; }
+
 /**
  * Find out if some functions or ranges were selected in selective decompilation.
  * @return @c True if @c selectedFunctions or @c selectedRanges not empty,
@@ -93,6 +115,18 @@ void Parameters::setIsSelectedDecodeOnly(bool b)
 {
 	_selectedDecodeOnly = b;
 }
+void Parameters::setIsLazyDecoding(bool b)
+{
+	_lazyDecoding = b;
+}
+void Parameters::setIsIncremental(bool b)
+{
+	_incremental = b;
+}
+void Parameters::setIsStaticCodeDecoding(bool b)
+{
+	_staticCodeDecoding = b;
+}
 
 void Parameters::setOutputFile(const std::string& n)
 {
@@ -135,6 +169,9 @@ Json::Value Parameters::getJsonValue() const
 	params[JSON_verboseOut]         = isVerboseOutput();
 	params[JSON_keepAllFuncs]       = isKeepAllFunctions();
 	params[JSON_selectedDecodeOnly] = isSelectedDecodeOnly();
+	params[JSON_lazyDecoding]       = isLazyDecoding();
+	params[JSON_incremental]        = isIncremental();
+	params[JSON_staticCodeDecoding] = isStaticCodeDecoding();
 	params[JSON_outputFile]         = getOutputFile();
 	params[JSON_frontendOutputFile] = getFrontendOutputFile();
 
@@ -168,6 +205,9 @@ void Parameters::readJsonValue(const Json::Value& val)
 	setIsVerboseOutput( safeGetBool(val, JSON_verboseOut, false) );
 	setIsKeepAllFunctions( safeGetBool(val, JSON_keepAllFuncs) );
 	setIsSelectedDecodeOnly( safeGetBool(val, JSON_selectedDecodeOnly) );
+	setIsLazyDecoding( safeGetBool(val, JSON_lazyDecoding) );
+	setIsIncremental( safeGetBool(val, JSON_incremental) );
+	setIsStaticCodeDecoding( safeGetBool(val, JSON_staticCodeDecoding) );
 	setOrdinalNumbersDirectory( safeGetString(val, JSON_ordinalNumDir) );
 	setOutputFile( safeGetString(val, JSON_outputFile) );
 	setFrontendOutputFile( safeGetString(val, JSON_frontendOutputFile) );
@@ -49,6 +49,8 @@ void printHelp()
 	std::cout << "\t--bytecode" << std::endl;
 	std::cout << "\t--input-file" << std::endl;
 	std::cout << "\t--unpacked-input-file" << std::endl;
+	std::cout << "\t--list-funcs" << std::endl;
+	std::cout << "\t--list-funcs-prioritized" << std::endl;
 	std::cout << std::endl;
 	std::cout << "W_OPTION:" << std::endl;
 	std::cout << "\t--compiler name" << std::endl;
@@ -71,7 +73,9 @@ void printHelp()
 	std::cout << "\t--output-file path" << std::endl;
 	std::cout << "\t--frontend-output-file path" << std::endl;
 	std::cout << "\t--decode-only-selected true/false" << std::endl;
+	std::cout << "\t--incremental true/false" << std::endl;
 	std::cout << "\t--selected-func name" << std::endl;
+	std::cout << "\t--selected-funcs-file path" << std::endl;
 	std::cout << "\t--selected-range range" << std::endl;
 	std::cout << "\t--set-fnc-fixed fncName" << std::endl;
 	std::cout << std::endl;
@@ -127,7 +131,7 @@ int handleArguments(std::vector<std::string> &args)
 
 	try
 	{
-		config.readJsonFile(configName);
+		config.readFile(configName);
 	}
 	catch (const retdec::config::Exception& e)
 	{
@@ -205,6 +209,46 @@ int handleArguments(std::vector<std::string> &args)
 			{
 				std::cout << config.getUnpackedInputFile() << std::endl;
 			}
+			else if (opt == "--list-funcs")
+			{
+				for (auto& p : config.functions)
+				{
+					std::cout << p.second.getName() << std::endl;
+				}
+			}
+			else if (opt == "--list-funcs-prioritized")
+			{
+				// The entry-point function and main first, then exports,
+				// then the rest. Used by the budgeted decompilation to
+				// order the work so the most interesting functions are
+				// decompiled before the budget runs out.
+				std::vector<std::string> prioritized[3];
+				for (auto& p : config.functions)
+				{
+					auto& f = p.second;
+					if (f.getName() == "main"
+							|| (config.getEntryPoint().isDefined()
+									&& f.getStart() == config.getEntryPoint()))
+					{
+						prioritized[0].push_back(f.getName());
+					}
+					else if (f.isExported())
+					{
+						prioritized[1].push_back(f.getName());
+					}
+					else
+					{
+						prioritized[2].push_back(f.getName());
+					}
+				}
+				for (auto& names : prioritized)
+				{
+					for (auto& n : names)
+					{
+						std::cout << n << std::endl;
+					}
+				}
+			}
 			else
 			{
 				printHelp();
@@ -346,10 +390,26 @@ int handleArguments(std::vector<std::string> &args)
 			{
 				config.parameters.setIsSelectedDecodeOnly( (val == "true") ? (true) : (false) );
 			}
+			else if (opt == "--incremental")
+			{
+				config.parameters.setIsIncremental( (val == "true") ? (true) : (false) );
+			}
 			else if (opt == "--selected-func")
 			{
 				config.parameters.selectedFunctions.insert(val);
 			}
+			else if (opt == "--selected-funcs-file")
+			{
+				std::ifstream file(val);
+				std::string line;
+				while (std::getline(file, line))
+				{
+					if (!line.empty())
+					{
+						config.parameters.selectedFunctions.insert(line);
+					}
+				}
+			}
 			else if (opt == "--selected-range")
 			{
 				config.parameters.selectedRanges.insert( retdec::config::AddressRangeJson(val) );
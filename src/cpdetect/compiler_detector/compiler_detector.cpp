@@ -12,6 +12,7 @@
 #include "retdec/cpdetect/compiler_detector/compiler_detector.h"
 #include "retdec/cpdetect/settings.h"
 #include "retdec/cpdetect/utils/version_solver.h"
+#include "retdec/yara-cache/yara_cache.h"
 
 
 using namespace retdec::fileformat;
@@ -161,6 +162,75 @@ ToolType metaToTool(const std::string &toolMeta)
 	return ToolType::UNKNOWN;
 }
 
+/**
+ * Get name of the database shard directory for the given file format
+ * @param format File format of the analyzed file
+ * @return Shard directory name or empty string for unknown formats
+ */
+std::string getFormatShardName(fileformat::Format format)
+{
+	switch (format)
+	{
+		case fileformat::Format::PE:
+			return "pe";
+		case fileformat::Format::ELF:
+			return "elf";
+		case fileformat::Format::COFF:
+			return "coff";
+		case fileformat::Format::MACHO:
+			return "macho";
+		case fileformat::Format::INTEL_HEX:
+			return "intelhex";
+		case fileformat::Format::RAW_DATA:
+			return "raw";
+		default:
+			return {};
+	}
+}
+
+/**
+ * Get name of the database shard for the given architecture and bit width
+ * @param architecture Target architecture of the analyzed file
+ * @param bitWidth Bit width of the target architecture
+ * @return Shard name (same naming as the internal signature store) or empty
+ *         string for unknown architectures
+ */
+std::string getArchitectureShardName(fileformat::Architecture architecture, std::size_t bitWidth)
+{
+	switch (architecture)
+	{
+		case fileformat::Architecture::X86:
+			return "x86";
+		case fileformat::Architecture::X86_64:
+			return "x64";
+		case fileformat::Architecture::ARM:
+			return bitWidth == 32 ? "arm" : "arm64";
+		case fileformat::Architecture::MIPS:
+			return bitWidth == 32 ? "mips" : "mips64";
+		case fileformat::Architecture::POWERPC:
+			return bitWidth == 32 ? "ppc" : "ppc64";
+		default:
+			return {};
+	}
+}
+
+/// All architecture shard names an external database may use.
+const std::set<std::string> ARCHITECTURE_SHARD_NAMES =
+{
+	"x86", "x64", "arm", "arm64", "mips", "mips64", "ppc", "ppc64"
+};
+
+/**
+ * Get last component of the given path
+ * @param path Path to get the component from
+ * @return Last path component
+ */
+std::string getLeafName(const std::string &path)
+{
+	const auto separator = path.find_last_of("/\\");
+	return separator == std::string::npos ? path : path.substr(separator + 1);
+}
+
 } // anonymous namespace
 
 /**
@@ -189,27 +259,74 @@ CompilerDetector::~CompilerDetector()
 /**
  * External databases parsing
  * @return @c true if at least one external database was detected, @c false otherwise
+ *
+ * Database files directly in the working directory are always loaded. A
+ * database may additionally be sharded the same way as the internal signature
+ * store -- a <tt>&lt;format&gt;</tt> subdirectory with files named after the
+ * architecture shard (e.g. <tt>pe/x86.yara</tt>, <tt>elf/mips64.yara</tt>) --
+ * in which case only the shards matching the analyzed file are loaded. Files
+ * in a format directory with names outside the architecture shard set apply
+ * to the whole format.
  */
 bool CompilerDetector::getExternalDatabases()
 {
 	auto thisDir = FilesystemPath(".");
 	auto result = false;
 
-	// iterating over all files in directory
-	for (const auto *subpath : thisDir)
+	const auto hasExternalSuffix = [&] (const std::string &path)
 	{
-		if (subpath->isFile() && std::any_of(externalSuffixes.begin(), externalSuffixes.end(),
+		return std::any_of(externalSuffixes.begin(), externalSuffixes.end(),
 			[&] (const auto &suffix)
 			{
-				return endsWith(subpath->getPath(), suffix);
-			}
-		))
+				return endsWith(path, suffix);
+			});
+	};
+
+	// iterating over all files in directory
+	for (const auto *subpath : thisDir)
+	{
+		if (subpath->isFile() && hasExternalSuffix(subpath->getPath()))
 		{
 			result = true;
 			externalDatabase.push_back(subpath->getPath());
 		}
 	}
 
+	// load matching shards of a sharded database
+	const auto formatShard = getFormatShardName(fileParser.getFileFormat());
+	const auto architectureShard = getArchitectureShardName(
+		targetArchitecture, fileParser.getWordLength());
+	if (formatShard.empty())
+	{
+		return result;
+	}
+
+	for (const auto *subpath : thisDir)
+	{
+		if (!subpath->isDirectory() || getLeafName(subpath->getPath()) != formatShard)
+		{
+			continue;
+		}
+
+		for (const auto *shard : *subpath)
+		{
+			if (!shard->isFile() || !hasExternalSuffix(shard->getPath()))
+			{
+				continue;
+			}
+
+			auto shardName = getLeafName(shard->getPath());
+			shardName = shardName.substr(0, shardName.find_last_of('.'));
+			if (ARCHITECTURE_SHARD_NAMES.count(shardName) && shardName != architectureShard)
+			{
+				continue;
+			}
+
+			result = true;
+			externalDatabase.push_back(shard->getPath());
+		}
+	}
+
 	return result;
 }
 
@@ -298,7 +415,7 @@ void CompilerDetector::getAllHeuristics()
 {
 	if (heuristics)
 	{
-		heuristics->getAllHeuristics();
+		heuristics->getAllHeuristics(cpParams.triage);
 	}
 }
 
@@ -320,7 +437,9 @@ ReturnCode CompilerDetector::getAllSignatures()
 	{
 		for (const auto &item : externalDatabase)
 		{
-			yara.addRuleFile(item);
+			// External databases are textual -- use their cached compiled
+			// form so the signatures are not re-compiled on every run.
+			yara.addRuleFile(retdec::yara_cache::getCompiledRuleFile(item));
 		}
 	}
 
@@ -6,6 +6,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
@@ -134,9 +135,22 @@ void ElfHeuristics::getDynamicEntriesHeuristics()
 
 void ElfHeuristics::getFormatSpecificCompilerHeuristics()
 {
-	getUpxHeuristics();
-	getBorlandKylixHeuristics();
-	getDynamicEntriesHeuristics();
+	static const std::vector<void (ElfHeuristics::*)()> heuristics =
+	{
+		&ElfHeuristics::getUpxHeuristics,
+		&ElfHeuristics::getBorlandKylixHeuristics,
+		&ElfHeuristics::getDynamicEntriesHeuristics
+	};
+
+	for (const auto &heuristic : heuristics)
+	{
+		if (canStopDetection())
+		{
+			return;
+		}
+
+		(this->*heuristic)();
+	}
 }
 
 } // namespace cpdetect
@@ -5,6 +5,7 @@
  */
 
 #include <regex>
+#include <vector>
 
 #include "retdec/fileformat-libdwarf-interface/bin_interface.h"
 
@@ -566,14 +567,13 @@ void Heuristics::getCommentSectionsHeuristics()
 {
 	for (const auto *sec : fileParser.getSections({".comment", ".rdata"}))
 	{
-		std::string secContent;
-		if (!sec || !sec->getString(secContent))
+		if (!sec)
 		{
 			continue;
 		}
 
 		std::vector<std::string> records;
-		separateStrings(secContent, records);
+		separateStrings(sec->getBytes(), records);
 
 		for (const auto &item : records)
 		{
@@ -777,20 +777,20 @@ std::string Heuristics::getEmbarcaderoVersion()
 	// Get comment section name
 	auto sectionName = commentSectionNameByFormat(fileParser.getFileFormat());
 
-	std::string content;
 	const Section* section = fileParser.getSection(sectionName);
-	if (section && section->getString(content, 0, 0))
+	if (section)
 	{
 		// Get offset to version in compiler ID string
+		const auto content = section->getBytes();
 		auto startOffset = content.find("Embarcadero Delphi ");
-		if (startOffset != std::string::npos)
+		if (startOffset != llvm::StringRef::npos)
 		{
 			// Search for platform specific string
-			std::string::size_type offset = startOffset + 19;
+			std::size_t offset = startOffset + 19;
 			for (const auto pair : delphiStrings)
 			{
 				offset = content.find(pair.first, startOffset);
-				if (offset != std::string::npos)
+				if (offset != llvm::StringRef::npos)
 				{
 					offset = pair.second;
 					break;
@@ -798,9 +798,9 @@ std::string Heuristics::getEmbarcaderoVersion()
 			}
 
 			// Search for compiler version in xx.x format
-			if (offset != std::string::npos)
+			if (offset != llvm::StringRef::npos)
 			{
-				auto version = content.substr(startOffset + offset, 4);
+				auto version = content.substr(startOffset + offset, 4).str();
 				if (std::regex_match(version, std::regex("[[:digit:]]+.[[:digit:]]")))
 				{
 					return version;
@@ -898,11 +898,26 @@ void Heuristics::getSymbolHeuristic()
  */
 void Heuristics::getCommonToolsHeuristics()
 {
-	getSymbolHeuristic();
-	getEmbarcaderoHeuristics();
-	getSectionHeuristics();
-	getDwarfInfo();
-	getCommentSectionsHeuristics();
+	// Cheap metadata lookups run before heuristics scanning file content,
+	// so triage mode can stop before the expensive ones.
+	static const std::vector<void (Heuristics::*)()> heuristics =
+	{
+		&Heuristics::getSymbolHeuristic,
+		&Heuristics::getEmbarcaderoHeuristics,
+		&Heuristics::getSectionHeuristics,
+		&Heuristics::getDwarfInfo,
+		&Heuristics::getCommentSectionsHeuristics
+	};
+
+	for (const auto &heuristic : heuristics)
+	{
+		if (canStopDetection())
+		{
+			return;
+		}
+
+		(this->*heuristic)();
+	}
 }
 
 /**
@@ -932,6 +947,32 @@ const DetectResult* Heuristics::isDetected(
 	return nullptr;
 }
 
+/**
+ * Check whether remaining heuristics may be skipped
+ *
+ * In triage mode the first detection of at least high strength answers the
+ * question, further heuristics would only extend an already sufficient list.
+ * Outside of triage mode detection never stops early.
+ * @return @c true if remaining heuristics may be skipped, @c false otherwise
+ */
+bool Heuristics::canStopDetection() const
+{
+	if (!triageMode)
+	{
+		return false;
+	}
+
+	for (const auto &detection : toolInfo.detectedTools)
+	{
+		if (detection.strength >= DetectionStrength::HIGH)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 /**
  * Try detect version of UPX packer
  * @return Detected version of UPX or empty string is version is not detected
@@ -970,16 +1011,27 @@ void Heuristics::getFormatSpecificLanguageHeuristics()
 
 /**
  * Try detect compiler based on all available heuristics
+ * @param triage If @c true, tool heuristics stop once one sufficiently
+ *    strong detection exists (@see canStopDetection)
+ *
+ * Heuristics share @c toolInfo and may consult previous detections, so they
+ * always run serially in their declared order. Triage mode only shortens the
+ * chain, it never reorders it.
  */
-void Heuristics::getAllHeuristics()
+void Heuristics::getAllHeuristics(bool triage)
 {
+	triageMode = triage;
+
 	// Detect languages
 	getCommonLanguageHeuristics();
 	getFormatSpecificLanguageHeuristics();
 
 	// Detect compilers
 	getCommonToolsHeuristics();
-	getFormatSpecificCompilerHeuristics();
+	if (!canStopDetection())
+	{
+		getFormatSpecificCompilerHeuristics();
+	}
 }
 
 } // namespace cpdetect
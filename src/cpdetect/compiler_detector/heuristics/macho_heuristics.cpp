@@ -60,21 +60,18 @@ void MachOHeuristics::getGoHeuristic()
 		return;
 	}
 
-	std::string content;
-	if (section->getString(content))
+	const auto content = section->getBytes();
+	const auto offset = content.find("Go cmd/compile go");
+	if (offset != llvm::StringRef::npos)
 	{
-		const auto offset = content.find("Go cmd/compile go");
-		if (offset != std::string::npos)
+		const auto start = offset + 17;
+		const auto end = content.find_first_of('\0', offset);
+
+		std::string version = content.substr(start, end - start).str();
+		if (!version.empty())
 		{
-			const auto start = offset + 17;
-			const auto end = content.find_first_of('\0', offset);
-
-			std::string version = content.substr(start, end - start);
-			if (!version.empty())
-			{
-				addCompiler(source, strength, "gc", version);
-				addLanguage("Go");
-			}
+			addCompiler(source, strength, "gc", version);
+			addLanguage("Go");
 		}
 	}
 }
@@ -129,10 +126,23 @@ void MachOHeuristics::getImportTableHeuristic()
 
 void MachOHeuristics::getFormatSpecificCompilerHeuristics()
 {
-	getUpxHeuristic();
-	getGoHeuristic();
-	getImportTableHeuristic();
-	getSectionTableHeuristic();
+	static const std::vector<void (MachOHeuristics::*)()> heuristics =
+	{
+		&MachOHeuristics::getUpxHeuristic,
+		&MachOHeuristics::getGoHeuristic,
+		&MachOHeuristics::getImportTableHeuristic,
+		&MachOHeuristics::getSectionTableHeuristic
+	};
+
+	for (const auto &heuristic : heuristics)
+	{
+		if (canStopDetection())
+		{
+			return;
+		}
+
+		(this->*heuristic)();
+	}
 }
 
 } // namespace cpdetect
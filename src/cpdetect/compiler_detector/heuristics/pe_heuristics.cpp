@@ -7,6 +7,7 @@
 #include <initializer_list>
 #include <map>
 #include <regex>
+#include <vector>
 
 #include <tinyxml2.h>
 
@@ -720,11 +721,21 @@ void PeHeuristics::getAdeptProtectorHeuristics()
 	auto source = DetectionMethod::STRING_SEARCH_H;
 	auto strength = DetectionStrength::MEDIUM;
 
-	if (peParser.isDotNet()
-			&& search.hasStringInSection("ByAdeptProtector", std::size_t(0)))
+	if (!peParser.isDotNet())
+	{
+		return;
+	}
+
+	// Both strings are searched for in one pass over the section.
+	const std::vector<std::string> strs = {
+		"ByAdeptProtector",
+		"STAThreadAttribute"
+	};
+	const auto found = search.findStringsInSection(strs, std::size_t(0));
+	if (found[0])
 	{
 		std::string version;
-		if (search.hasStringInSection("STAThreadAttribute", std::size_t(0)))
+		if (found[1])
 		{
 			version = "2.1";
 		}
@@ -760,17 +771,24 @@ void PeHeuristics::getNetHeuristic()
 		return;
 	}
 
-	// normal string search
+	// normal string search -- all strings are searched for in one pass
+	// over the section
 	std::size_t idx = 0;
-	if (search.hasStringInSection("Protected_By_Attribute\0NETSpider.Attribute"s, idx))
+	const std::vector<std::string> strs = {
+		"Protected_By_Attribute\0NETSpider.Attribute"s,
+		"Protected/Packed with ReNET-Pack by stx",
+		"\0NetzStarter\0netz\0"s
+	};
+	const auto found = search.findStringsInSection(strs, idx);
+	if (found[0])
 	{
 		addPacker(source, strength, ".NET Spider", "0.5 - 1.3");
 	}
-	if (search.hasStringInSection("Protected/Packed with ReNET-Pack by stx", idx))
+	if (found[1])
 	{
 		addPacker(source, strength, "ReNET-pack");
 	}
-	if (search.hasStringInSection("\0NetzStarter\0netz\0"s, idx))
+	if (found[2])
 	{
 		addPacker(source, strength, ".NETZ");
 	}
@@ -977,8 +995,7 @@ void PeHeuristics::getArmadilloHeuristic()
 	{
 		for (const Section* section : peParser.getSections())
 		{
-			std::string bytes;
-			if (section->getString(bytes, 0, 8) && startsWith(bytes, "PDATA000"))
+			if (section->getBytes(0, 8) == "PDATA000")
 			{
 				strength = DetectionStrength::HIGH;
 				break;
@@ -1158,15 +1175,14 @@ void PeHeuristics::getRdataHeuristic()
 	auto source = DetectionMethod::COMMENT_H;
 	auto strength = DetectionStrength::MEDIUM;
 
-	std::string content;
 	const Section* section = fileParser.getSection(".rdata");
-	if (!section || !section->getString(content))
+	if (!section)
 	{
 		return;
 	}
 
 	std::vector<std::string> records;
-	separateStrings(content, records);
+	separateStrings(section->getBytes(), records);
 
 	std::string name, version, extra;
 	for (const auto& record : records)
@@ -1265,33 +1281,26 @@ void PeHeuristics::getManifestHeuristic()
 
 	if (fileParser.getOverlaySize() && contains(manifest, "WinRAR SFX module"))
 	{
-		std::string magic;
-		if (fileParser.getString(magic, declaredLength, 4))
+		const auto magic = fileParser.getLoadedBytes(declaredLength, 4);
+		if (magic == "Rar!")
 		{
-			if (magic == "Rar!")
-			{
-				addInstaller(source, strength, "WinRAR SFX");
-				return;
-			}
+			addInstaller(source, strength, "WinRAR SFX");
+			return;
+		}
 
-			if (startsWith(magic, "PK"))
-			{
-				addInstaller(source, strength, "WinRAR SFX", "", "with ZIP payload");
-				return;
-			}
+		if (magic.startswith("PK"))
+		{
+			addInstaller(source, strength, "WinRAR SFX", "", "with ZIP payload");
+			return;
 		}
 	}
 
 	if (fileParser.getOverlaySize() && contains(manifest, "WinRAR archiver"))
 	{
-		std::string magic;
-		if (fileParser.getString(magic, declaredLength, 4))
+		if (fileParser.getLoadedBytes(declaredLength, 4) == "Rar!")
 		{
-			if (magic == "Rar!")
-			{
-				addInstaller(source, strength, "WinRAR SFX", "", "console version");
-				return;
-			}
+			addInstaller(source, strength, "WinRAR SFX", "", "console version");
+			return;
 		}
 	}
 }
@@ -1310,20 +1319,13 @@ void PeHeuristics::getSevenZipHeuristics()
 	}
 
 	bool detected = false;
-	std::string magic;
-	if (fileParser.getString(magic, declaredLength, 18))
+	if (fileParser.getLoadedBytes(declaredLength, 18) == ";!@Install@!UTF-8!")
 	{
-		if (magic == ";!@Install@!UTF-8!")
-		{
-			detected = true;
-		}
+		detected = true;
 	}
-	if (fileParser.getString(magic, declaredLength, 6))
+	if (fileParser.getLoadedBytes(declaredLength, 6) == "7z\xBC\xAF\x27\x1C")
 	{
-		if (magic == "7z\xBC\xAF\x27\x1C")
-		{
-			detected = true;
-		}
+		detected = true;
 	}
 
 	if (detected)
@@ -1672,33 +1674,48 @@ void PeHeuristics::getFormatSpecificLanguageHeuristics()
 
 void PeHeuristics::getFormatSpecificCompilerHeuristics()
 {
-	getSlashedSignatures();
-	getMorphineHeuristics();
-	getPelockHeuristics();
-	getEzirizReactorHeuristics();
-	getUpxHeuristics();
-	getFsgHeuristics();
-	getPeCompactHeuristics();
-	getAndpakkHeuristics();
-	getEnigmaHeuristics();
-	getVBoxHeuristics();
-	getActiveDeliveryHeuristics();
-	getAdeptProtectorHeuristics();
-	getCodeLockHeuristics();
-	getNetHeuristic();
-	getExcelsiorHeuristics();
-	getVmProtectHeuristics();
-	getBorlandDelphiHeuristics();
-	getBeRoHeuristics();
-	getMsvcIntelHeuristics();
-	getStarforceHeuristic();
-	getArmadilloHeuristic();
-	getRdataHeuristic();
-	getNullsoftHeuristic();
-	getLinkerVersionHeuristic();
-	getManifestHeuristic();
-	getSevenZipHeuristics();
-	getPeSectionHeuristics();
+	// The order is significant -- later heuristics consult the detections of
+	// earlier ones. Triage mode may cut the chain short but never reorders it.
+	static const std::vector<void (PeHeuristics::*)()> heuristics =
+	{
+		&PeHeuristics::getSlashedSignatures,
+		&PeHeuristics::getMorphineHeuristics,
+		&PeHeuristics::getPelockHeuristics,
+		&PeHeuristics::getEzirizReactorHeuristics,
+		&PeHeuristics::getUpxHeuristics,
+		&PeHeuristics::getFsgHeuristics,
+		&PeHeuristics::getPeCompactHeuristics,
+		&PeHeuristics::getAndpakkHeuristics,
+		&PeHeuristics::getEnigmaHeuristics,
+		&PeHeuristics::getVBoxHeuristics,
+		&PeHeuristics::getActiveDeliveryHeuristics,
+		&PeHeuristics::getAdeptProtectorHeuristics,
+		&PeHeuristics::getCodeLockHeuristics,
+		&PeHeuristics::getNetHeuristic,
+		&PeHeuristics::getExcelsiorHeuristics,
+		&PeHeuristics::getVmProtectHeuristics,
+		&PeHeuristics::getBorlandDelphiHeuristics,
+		&PeHeuristics::getBeRoHeuristics,
+		&PeHeuristics::getMsvcIntelHeuristics,
+		&PeHeuristics::getStarforceHeuristic,
+		&PeHeuristics::getArmadilloHeuristic,
+		&PeHeuristics::getRdataHeuristic,
+		&PeHeuristics::getNullsoftHeuristic,
+		&PeHeuristics::getLinkerVersionHeuristic,
+		&PeHeuristics::getManifestHeuristic,
+		&PeHeuristics::getSevenZipHeuristics,
+		&PeHeuristics::getPeSectionHeuristics
+	};
+
+	for (const auto &heuristic : heuristics)
+	{
+		if (canStopDetection())
+		{
+			return;
+		}
+
+		(this->*heuristic)();
+	}
 }
 
 } // namespace cpdetect
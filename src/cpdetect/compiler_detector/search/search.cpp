@@ -13,6 +13,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/cpdetect/compiler_detector/search/search.h"
 #include "retdec/cpdetect/signatures/avg/signature_checker.h"
+#include "retdec/cpdetect/utils/byte_search.h"
 #include "retdec/fileformat/utils/conversions.h"
 #include "retdec/fileformat/utils/file_io.h"
 
@@ -480,7 +481,8 @@ bool Search::areaSimilarity(const std::string &signPattern, Similarity &sim, std
  */
 bool Search::hasString(const std::string &str) const
 {
-	return contains(plain, str);
+	return plain.empty() ? str.empty() :
+		findSubstringInArea(plain, str, 0, plain.length() - 1) != std::string::npos;
 }
 
 /**
@@ -503,7 +505,7 @@ bool Search::hasString(const std::string &str, std::size_t fileOffset) const
  */
 bool Search::hasString(const std::string &str, std::size_t startOffset, std::size_t stopOffset) const
 {
-	return hasSubstringInArea(plain, str, startOffset, stopOffset);
+	return findSubstringInArea(plain, str, startOffset, stopOffset) != std::string::npos;
 }
 
 /**
@@ -539,6 +541,55 @@ bool Search::hasStringInSection(const std::string &str, const std::string &secti
 	return hasStringInSection(str, parser.getSection(sectionName));
 }
 
+/**
+ * Find which strings are present in selected area of file
+ * @param strs Coveted strings
+ * @param startOffset Start offset in file (in bytes)
+ * @param stopOffset Stop offset in file (in bytes)
+ * @return Vector with one flag per string from @a strs telling whether the
+ *    string is present in the selected area
+ *
+ * All strings are searched for in a single pass over the area, so prefer
+ * this method over repeated calls of hasString() whenever several strings
+ * are checked against the same bytes.
+ */
+std::vector<bool> Search::findStringsInArea(const std::vector<std::string> &strs, std::size_t startOffset, std::size_t stopOffset) const
+{
+	MultiPatternSearch searcher(strs);
+	return searcher.findInArea(plain, startOffset, stopOffset);
+}
+
+/**
+ * Find which strings are present in selected section
+ * @param strs Coveted strings
+ * @param section Selected section
+ * @return Vector with one flag per string from @a strs telling whether the
+ *    string is present in the selected section
+ *
+ * If @a section is @c nullptr, no string is reported as present.
+ */
+std::vector<bool> Search::findStringsInSection(const std::vector<std::string> &strs, const retdec::fileformat::Section *section) const
+{
+	if(!section)
+	{
+		return std::vector<bool>(strs.size(), false);
+	}
+
+	return findStringsInArea(strs, section->getOffset(), section->getOffset() + section->getLoadedSize() - 1);
+}
+
+/**
+ * Find which strings are present in selected section
+ * @param strs Coveted strings
+ * @param sectionIndex Index of selected section (indexed from 0)
+ * @return Vector with one flag per string from @a strs telling whether the
+ *    string is present in the selected section
+ */
+std::vector<bool> Search::findStringsInSection(const std::vector<std::string> &strs, std::size_t sectionIndex) const
+{
+	return findStringsInSection(strs, parser.getSection(sectionIndex));
+}
+
 /**
  * Create signature from specified offset
  * @param pattern Into this parameter is stored resulted signature
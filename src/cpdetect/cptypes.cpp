@@ -12,8 +12,10 @@ namespace cpdetect {
 /**
  * Constructor of DetectParams structure
  */
-DetectParams::DetectParams(SearchType searchType_, bool internal_, bool external_) :
-		searchType(searchType_), internal(internal_), external(external_)
+DetectParams::DetectParams(
+		SearchType searchType_, bool internal_, bool external_, bool triage_) :
+		searchType(searchType_), internal(internal_), external(external_),
+		triage(triage_)
 {
 
 }
@@ -0,0 +1,211 @@
+/**
+ * @file src/cpdetect/utils/byte_search.cpp
+ * @brief Fast substring search over file content.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <array>
+#include <queue>
+
+#include "retdec/cpdetect/utils/byte_search.h"
+
+namespace retdec {
+namespace cpdetect {
+
+/**
+ * Find the first occurrence of a substring in the selected area
+ * @param haystack Content to search in
+ * @param needle Coveted substring
+ * @param startOffset Start offset of the area (in bytes)
+ * @param stopOffset Stop offset of the area (in bytes)
+ * @return Offset of the first occurrence, or @c std::string::npos if the
+ *    substring is not present in the area
+ *
+ * The occurrence has to end inside the area, i.e. no later than on
+ * @a stopOffset. The search uses the Boyer-Moore-Horspool algorithm, so
+ * unlike a naive scan, most positions of the area are skipped without
+ * being compared at all.
+ */
+std::size_t findSubstringInArea(const std::string &haystack, const std::string &needle,
+	std::size_t startOffset, std::size_t stopOffset)
+{
+	if(startOffset > stopOffset)
+	{
+		return std::string::npos;
+	}
+	if(needle.empty())
+	{
+		return startOffset <= haystack.length() ? startOffset : std::string::npos;
+	}
+
+	// End of the area (exclusive).
+	const auto stopIndex = stopOffset >= haystack.length() ? haystack.length() : stopOffset + 1;
+	if(startOffset >= stopIndex || stopIndex - startOffset < needle.length())
+	{
+		return std::string::npos;
+	}
+
+	// Bad-character skip table: how far can we shift the needle when the
+	// byte under its last position does not match.
+	std::array<std::size_t, 256> skip;
+	skip.fill(needle.length());
+	for(std::size_t i = 0, e = needle.length() - 1; i < e; ++i)
+	{
+		skip[static_cast<unsigned char>(needle[i])] = needle.length() - 1 - i;
+	}
+
+	const auto lastPosition = stopIndex - needle.length();
+	for(std::size_t position = startOffset; position <= lastPosition;)
+	{
+		std::size_t i = needle.length();
+		while(i > 0 && haystack[position + i - 1] == needle[i - 1])
+		{
+			--i;
+		}
+		if(!i)
+		{
+			return position;
+		}
+
+		position += skip[static_cast<unsigned char>(haystack[position + needle.length() - 1])];
+	}
+
+	return std::string::npos;
+}
+
+/**
+ * Constructor
+ * @param patterns Patterns to be searched for
+ *
+ * Builds the automaton, which takes time proportional to the total length
+ * of the patterns.
+ */
+MultiPatternSearch::MultiPatternSearch(const std::vector<std::string> &patterns) :
+	states(1), numberOfPatterns(patterns.size()), emptyPatterns(patterns.size(), false)
+{
+	// Build the trie of the patterns.
+	for(std::size_t patternIndex = 0; patternIndex < patterns.size(); ++patternIndex)
+	{
+		const auto &pattern = patterns[patternIndex];
+		if(pattern.empty())
+		{
+			emptyPatterns[patternIndex] = true;
+			continue;
+		}
+
+		std::size_t state = 0;
+		for(const auto c : pattern)
+		{
+			const auto byte = static_cast<unsigned char>(c);
+			const auto transition = states[state].next.find(byte);
+			if(transition != states[state].next.end())
+			{
+				state = transition->second;
+			}
+			else
+			{
+				states.emplace_back();
+				states[state].next.emplace(byte, states.size() - 1);
+				state = states.size() - 1;
+			}
+		}
+		states[state].matches.push_back(patternIndex);
+	}
+
+	// Compute the failure links in breadth-first order. A state inherits the
+	// matches of the state its failure link points to, so every occurrence is
+	// reported even when one pattern is a suffix of another.
+	std::queue<std::size_t> queue;
+	for(const auto &transition : states[0].next)
+	{
+		queue.push(transition.second);
+	}
+	while(!queue.empty())
+	{
+		const auto state = queue.front();
+		queue.pop();
+
+		for(const auto &transition : states[state].next)
+		{
+			auto fail = states[state].fail;
+			while(fail && !states[fail].next.count(transition.first))
+			{
+				fail = states[fail].fail;
+			}
+			const auto failTransition = states[fail].next.find(transition.first);
+			if(failTransition != states[fail].next.end() && failTransition->second != transition.second)
+			{
+				fail = failTransition->second;
+			}
+			else
+			{
+				fail = 0;
+			}
+
+			states[transition.second].fail = fail;
+			const auto &failMatches = states[fail].matches;
+			states[transition.second].matches.insert(
+				states[transition.second].matches.end(),
+				failMatches.begin(), failMatches.end());
+			queue.push(transition.second);
+		}
+	}
+}
+
+/**
+ * Destructor
+ */
+MultiPatternSearch::~MultiPatternSearch()
+{
+
+}
+
+/**
+ * Find which patterns occur in the selected area
+ * @param haystack Content to search in
+ * @param startOffset Start offset of the area (in bytes)
+ * @param stopOffset Stop offset of the area (in bytes)
+ * @return Vector with one flag per pattern (in the order in which the
+ *    patterns were given to the constructor) telling whether the pattern
+ *    occurs in the area
+ *
+ * All patterns are searched for in a single pass over the area.
+ */
+std::vector<bool> MultiPatternSearch::findInArea(const std::string &haystack,
+	std::size_t startOffset, std::size_t stopOffset) const
+{
+	std::vector<bool> found(numberOfPatterns, false);
+	if(startOffset > stopOffset || startOffset > haystack.length())
+	{
+		return found;
+	}
+
+	// Empty patterns occur everywhere.
+	for(std::size_t i = 0; i < numberOfPatterns; ++i)
+	{
+		found[i] = emptyPatterns[i];
+	}
+
+	const auto stopIndex = stopOffset >= haystack.length() ? haystack.length() : stopOffset + 1;
+	std::size_t state = 0;
+	for(auto position = startOffset; position < stopIndex; ++position)
+	{
+		const auto byte = static_cast<unsigned char>(haystack[position]);
+		while(state && !states[state].next.count(byte))
+		{
+			state = states[state].fail;
+		}
+		const auto transition = states[state].next.find(byte);
+		state = transition != states[state].next.end() ? transition->second : 0;
+
+		for(const auto patternIndex : states[state].matches)
+		{
+			found[patternIndex] = true;
+		}
+	}
+
+	return found;
+}
+
+} // namespace cpdetect
+} // namespace retdec
@@ -11,6 +11,20 @@
 
 #include "retdec/crypto/crc32.h"
 
+// Hardware acceleration of the CRC32 computation. On x86-64 the folding via
+// carry-less multiplication (PCLMULQDQ) is used - the SSE4.2 crc32 instruction
+// computes CRC-32C (Castagnoli polynomial) and would produce different hashes.
+// On AArch64 the CRC32 extension implements exactly this polynomial, so the
+// crc32x instructions can be used directly.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	#define CRC32_HW_CARRYLESS 1
+	#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+	#define CRC32_HW_ARMV8 1
+	#include <arm_acle.h>
+	#include <cstring>
+#endif
+
 /// same as reset()
 CRC32::CRC32()
 {
@@ -333,15 +347,166 @@ namespace
 				(x << 24);
 	}
 #endif
+
+#ifdef CRC32_HW_CARRYLESS
+	// Folding and reduction constants for the CRC-32 polynomial 0x04C11DB7 in
+	// the bit-reflected domain, taken from "Fast CRC Computation for Generic
+	// Polynomials Using PCLMULQDQ Instruction" (Intel white paper, 2009).
+	alignas(16) static const uint64_t crc32FoldBy4[2] = { 0x0154442bd4, 0x01c6e41596 };
+	alignas(16) static const uint64_t crc32FoldBy1[2] = { 0x01751997d0, 0x00ccaa009e };
+	alignas(16) static const uint64_t crc32Shift64[2] = { 0x0163cd6124, 0x0000000000 };
+	alignas(16) static const uint64_t crc32Barrett[2] = { 0x01db710641, 0x01f7011641 };
+
+	/// @return @c true if the CPU supports PCLMULQDQ and SSE4.1.
+	inline bool crc32HardwareSupported()
+	{
+		static const bool supported = __builtin_cpu_supports("pclmul")
+				&& __builtin_cpu_supports("sse4.1");
+		return supported;
+	}
+
+	/**
+	 * Folds a block of data into the running CRC via carry-less multiplication,
+	 * processing 64 bytes per iteration.
+	 *
+	 * @param crc Running CRC value (already inverted).
+	 * @param data Data to fold in.
+	 * @param numBytes Number of bytes - at least 64 and a multiple of 16.
+	 *
+	 * @return Updated CRC value.
+	 */
+	__attribute__((target("pclmul,sse4.1")))
+	uint32_t crc32CarrylessFold(uint32_t crc, const unsigned char* data, size_t numBytes)
+	{
+		const __m128i* buffer = reinterpret_cast<const __m128i*>(data);
+
+		__m128i x1 = _mm_loadu_si128(buffer + 0);
+		__m128i x2 = _mm_loadu_si128(buffer + 1);
+		__m128i x3 = _mm_loadu_si128(buffer + 2);
+		__m128i x4 = _mm_loadu_si128(buffer + 3);
+		x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+		__m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(crc32FoldBy4));
+		buffer += 4;
+		numBytes -= 64;
+
+		// fold blocks of 64 bytes
+		while (numBytes >= 64)
+		{
+			__m128i t1 = _mm_clmulepi64_si128(x1, k, 0x00);
+			__m128i t2 = _mm_clmulepi64_si128(x2, k, 0x00);
+			__m128i t3 = _mm_clmulepi64_si128(x3, k, 0x00);
+			__m128i t4 = _mm_clmulepi64_si128(x4, k, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+			x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+			x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+			x4 = _mm_clmulepi64_si128(x4, k, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, t1), _mm_loadu_si128(buffer + 0));
+			x2 = _mm_xor_si128(_mm_xor_si128(x2, t2), _mm_loadu_si128(buffer + 1));
+			x3 = _mm_xor_si128(_mm_xor_si128(x3, t3), _mm_loadu_si128(buffer + 2));
+			x4 = _mm_xor_si128(_mm_xor_si128(x4, t4), _mm_loadu_si128(buffer + 3));
+			buffer += 4;
+			numBytes -= 64;
+		}
+
+		// fold the four 128-bit accumulators into one
+		k = _mm_load_si128(reinterpret_cast<const __m128i*>(crc32FoldBy1));
+
+		__m128i t = _mm_clmulepi64_si128(x1, k, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, t), x2);
+		t = _mm_clmulepi64_si128(x1, k, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, t), x3);
+		t = _mm_clmulepi64_si128(x1, k, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, t), x4);
+
+		// fold remaining blocks of 16 bytes
+		while (numBytes >= 16)
+		{
+			t = _mm_clmulepi64_si128(x1, k, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, t), _mm_loadu_si128(buffer));
+			++buffer;
+			numBytes -= 16;
+		}
+
+		// fold 128 bits to 64 bits
+		const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+		t = _mm_clmulepi64_si128(x1, k, 0x10);
+		x1 = _mm_srli_si128(x1, 8);
+		x1 = _mm_xor_si128(x1, t);
+
+		k = _mm_load_si128(reinterpret_cast<const __m128i*>(crc32Shift64));
+		t = _mm_srli_si128(x1, 4);
+		x1 = _mm_and_si128(x1, mask);
+		x1 = _mm_clmulepi64_si128(x1, k, 0x00);
+		x1 = _mm_xor_si128(x1, t);
+
+		// Barrett reduction to 32 bits
+		k = _mm_load_si128(reinterpret_cast<const __m128i*>(crc32Barrett));
+		t = _mm_and_si128(x1, mask);
+		t = _mm_clmulepi64_si128(t, k, 0x10);
+		t = _mm_and_si128(t, mask);
+		t = _mm_clmulepi64_si128(t, k, 0x00);
+		x1 = _mm_xor_si128(x1, t);
+
+		return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+	}
+#endif
+
+#ifdef CRC32_HW_ARMV8
+	/**
+	 * Computes the CRC of a block of data with the AArch64 CRC32 instructions,
+	 * which implement exactly the polynomial used here.
+	 *
+	 * @param crc Running CRC value (already inverted).
+	 * @param data Data to process.
+	 * @param numBytes Number of bytes.
+	 *
+	 * @return Updated CRC value.
+	 */
+	uint32_t crc32ArmCompute(uint32_t crc, const unsigned char* data, size_t numBytes)
+	{
+		while (numBytes >= 8)
+		{
+			uint64_t chunk;
+			std::memcpy(&chunk, data, 8);
+			crc = __crc32d(crc, chunk);
+			data += 8;
+			numBytes -= 8;
+		}
+		while (numBytes--)
+			crc = __crc32b(crc, *data++);
+		return crc;
+	}
+#endif
 }
 
 
 /// add arbitrary number of bytes
 void CRC32::add(const void* data, size_t numBytes)
 {
-	const uint32_t* current = reinterpret_cast<const uint32_t*>(data);
 	uint32_t crc = ~m_hash;
 
+#if defined(CRC32_HW_CARRYLESS)
+	// the folding needs at least 64 bytes and works on multiples of 16 bytes,
+	// the rest of the data falls through to the table-based code below
+	if (numBytes >= 64 && crc32HardwareSupported())
+	{
+		size_t foldedBytes = numBytes & ~static_cast<size_t>(15);
+		crc = crc32CarrylessFold(crc, reinterpret_cast<const unsigned char*>(data), foldedBytes);
+		data = reinterpret_cast<const unsigned char*>(data) + foldedBytes;
+		numBytes -= foldedBytes;
+	}
+#elif defined(CRC32_HW_ARMV8)
+	crc = crc32ArmCompute(crc, reinterpret_cast<const unsigned char*>(data), numBytes);
+	numBytes = 0;
+#endif
+
+	const uint32_t* current = reinterpret_cast<const uint32_t*>(data);
+
 	// process eight bytes at once
 	while (numBytes >= 8)
 	{
@@ -4,8 +4,10 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
 #include <climits>
 #include <cmath>
+#include <thread>
 #include <vector>
 
 #include <openssl/md5.h>
@@ -13,6 +15,7 @@
 
 #include "retdec/crypto/crc32.h"
 #include "retdec/crypto/crypto.h"
+#include "retdec/crypto/hash_context.h"
 #include "retdec/utils/conversion.h"
 
 namespace retdec {
@@ -22,6 +25,15 @@ namespace {
 
 constexpr auto CRC16_POLY = 0x8408U;
 
+/// Inputs smaller than this are digested serially -- the thread startup
+/// overhead would outweigh the gain.
+constexpr std::uint64_t DIGEST_MIN_PARALLEL_LENGTH = 1ULL << 20;
+
+/// Size of one chunk of the parallel digest pipeline. All digest contexts
+/// consume a chunk before the pipeline moves on, so the chunk stays in the
+/// cache and the data is effectively read from memory only once.
+constexpr std::uint64_t DIGEST_CHUNK_LENGTH = 32ULL << 20;
+
 } // anonymous namespace
 
 /**
@@ -126,5 +138,52 @@ std::string getSha256(const unsigned char *data, std::uint64_t length)
 	return sha;
 }
 
+/**
+ * @brief Count CRC32, MD5, and SHA256 of @a data in one pass.
+ * @param[in] data Input data.
+ * @param[in] length Length of input data.
+ * @param[out] crc32 Into this parameter is stored CRC32 of input data.
+ * @param[out] md5 Into this parameter is stored MD5 of input data.
+ * @param[out] sha256 Into this parameter is stored SHA256 of input data.
+ *
+ * Large inputs are processed in chunks and the three digests of each chunk
+ * are computed on separate threads. MD5 and SHA256 go through the OpenSSL
+ * envelope contexts, which dispatch to hardware implementations (e.g. SHA
+ * instructions) where the CPU provides them.
+ */
+void getCrc32Md5Sha256(const unsigned char *data, std::uint64_t length,
+	std::string &crc32, std::string &md5, std::string &sha256)
+{
+	CRC32 crcContext;
+	HashContext md5Context, sha256Context;
+
+	if (length < DIGEST_MIN_PARALLEL_LENGTH
+			|| !md5Context.init(HashAlgorithm::Md5)
+			|| !sha256Context.init(HashAlgorithm::Sha256))
+	{
+		crc32 = getCrc32(data, length);
+		md5 = getMd5(data, length);
+		sha256 = getSha256(data, length);
+		return;
+	}
+
+	for (std::uint64_t offset = 0; offset < length; offset += DIGEST_CHUNK_LENGTH)
+	{
+		const auto *chunk = data + offset;
+		const auto chunkLength = static_cast<std::size_t>(
+			std::min(DIGEST_CHUNK_LENGTH, length - offset));
+
+		std::thread crcThread([&] { crcContext.add(chunk, chunkLength); });
+		std::thread md5Thread([&] { md5Context.addData(chunk, chunkLength); });
+		sha256Context.addData(chunk, chunkLength);
+		crcThread.join();
+		md5Thread.join();
+	}
+
+	crc32 = crcContext.getHash();
+	md5 = md5Context.getHash(false);
+	sha256 = sha256Context.getHash(false);
+}
+
 } // namespace crypto
 } // namespace retdec
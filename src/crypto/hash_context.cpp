@@ -86,9 +86,11 @@ bool HashContext::addData(const std::vector<std::uint8_t>& data)
 /**
  * Gets the final hash of all added data.
  *
+ * @param uppercase Whether to use uppercase hexadecimal digits.
+ *
  * @return The final hash of the algorithm. Empty string in case of an error.
  */
-std::string HashContext::getHash()
+std::string HashContext::getHash(bool uppercase)
 {
 	if (_currentAlgo == nullptr)
 		return {};
@@ -98,7 +100,7 @@ std::string HashContext::getHash()
 		return {};
 
 	std::string ret;
-	retdec::utils::bytesToHexString(hash, ret);
+	retdec::utils::bytesToHexString(hash, ret, 0, 0, uppercase);
 	return ret;
 }
 
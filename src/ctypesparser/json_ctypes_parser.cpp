@@ -251,6 +251,115 @@ void JSONCTypesParser::parseInto(
 	parseJsonIntoModule(root, module);
 }
 
+/**
+* @brief Registers a JSON type database for lazy parsing.
+*
+* @param[in] stream Input stream containing C-types in JSON.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @throw CTypesParseError when the input JSON is invalid.
+*
+* Only the JSON DOM and an index of function names are built here -- this is
+* much cheaper than materializing C-types for every function in the database.
+* Functions are materialized one by one by materializeFunction() when they
+* are first queried.
+*/
+void JSONCTypesParser::addLazySource(
+	std::istream &stream,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	auto src = std::make_unique<LazySource>();
+
+	src->buffer = loadJson(stream);
+	// The rapidjson library requires a null-terminated string.
+	src->buffer.push_back('\0');
+	src->doc = parseJson(&src->buffer[0]);
+	src->typeWidths = typeWidths;
+	src->callConvention = callConvention;
+
+	const rapidjson::Value &functions = safeGetObject(*src->doc, JSON_functions);
+	for (auto i = functions.MemberBegin(), e = functions.MemberEnd(); i != e; ++i)
+	{
+		src->functions.emplace(i->name.GetString(), &i->value);
+	}
+
+	const rapidjson::Value &types = safeGetObject(*src->doc, JSON_types);
+	for (auto i = types.MemberBegin(), e = types.MemberEnd(); i != e; ++i)
+	{
+		src->typesMap.emplace(i->name.GetString(), i);
+	}
+
+	lazySources.push_back(std::move(src));
+}
+
+/**
+* @brief Materializes a function from the registered lazy sources.
+*
+* @param[in] name Name of the function to materialize.
+* @param[in] module Module to materialize the function into.
+*
+* @return Materialized function, or @c nullptr when no lazy source
+*         contains a function with @c name.
+*
+* @throw CTypesParseError when the function's JSON representation is invalid.
+*
+* Sources are searched in the order they were registered, so (like with
+* eager parsing) the first database containing the name wins. The
+* materialized function is added to @c module, so repeated queries are
+* answered from its context.
+*/
+std::shared_ptr<retdec::ctypes::Function> JSONCTypesParser::materializeFunction(
+	const std::string &name,
+	std::unique_ptr<retdec::ctypes::Module> &module)
+{
+	assert(module && "violated precondition - module cannot be null");
+
+	auto cachedFunc = module->getContext()->getFunctionWithName(name);
+	if (cachedFunc)
+	{
+		return cachedFunc;
+	}
+
+	for (auto &src : lazySources)
+	{
+		auto fIt = src->functions.find(name);
+		if (fIt == src->functions.end())
+		{
+			continue;
+		}
+
+		// Swap in the parsing state of the source the function comes from;
+		// types may have different keys in each JSON.
+		context = module->getContext();
+		defaultCallConv = src->callConvention;
+		this->typeWidths = src->typeWidths;
+		std::swap(typesMap, src->typesMap);
+		std::swap(parserContext, src->parserContext);
+
+		std::shared_ptr<retdec::ctypes::Function> newFunction;
+		try
+		{
+			newFunction = parseFunction(*fIt->second, name);
+		}
+		catch (...)
+		{
+			std::swap(typesMap, src->typesMap);
+			std::swap(parserContext, src->parserContext);
+			throw;
+		}
+
+		std::swap(typesMap, src->typesMap);
+		std::swap(parserContext, src->parserContext);
+
+		module->addFunction(newFunction);
+		return newFunction;
+	}
+
+	return nullptr;
+}
+
 /**
 * @brief Loads JSON from the input stream to a string.
 */
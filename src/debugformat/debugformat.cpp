@@ -8,6 +8,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 #include "retdec/utils/debug.h"
 #include "retdec/debugformat/debugformat.h"
@@ -38,9 +39,16 @@ DebugFormat::DebugFormat(
 		_inFile(inFile),
 		_demangler(demangler)
 {
+	// Probe both candidate debug sources concurrently -- only one of them is
+	// used in the end, but the probes are independent and I/O bound, so there
+	// is no reason to pay for them sequentially.
 	_pdbFile = new retdec::pdbparser::PDBFile();
-	auto s = _pdbFile->load_pdb_file(pdbFile.c_str());
+	retdec::pdbparser::PDBFileState s = retdec::pdbparser::PDB_STATE_ERR_FILE_OPEN;
+	std::thread pdbLoader([&]() {
+		s = _pdbFile->load_pdb_file(pdbFile.c_str());
+	});
 	_dwarfFile = new retdec::dwarfparser::DwarfFile(_inFile->getFileFormat()->getPathToFile(), _inFile->getFileFormat());
+	pdbLoader.join();
 
 	if (s == retdec::pdbparser::PDB_STATE_OK)
 	{
@@ -71,13 +71,9 @@ void DebugFormat::loadDwarfGlobalVariables()
 
 void DebugFormat::loadDwarfFunctions()
 {
-	// Lines
+	// Lines -- container provides binary searchable address based queries.
 	//
-	std::map<retdec::utils::Address, int> lines;
-	for (auto* line : *_dwarfFile->getLines())
-	{
-		lines[line->addr] = line->lineNum;
-	}
+	auto* lines = _dwarfFile->getLines();
 
 	// Functions
 	//
@@ -112,11 +108,10 @@ void DebugFormat::loadDwarfFunctions()
 		dif.returnType = loadDwarfType(df->type);
 
 		dif.setStartLine(df->line);
-		auto lastLine = lines.find(dif.getStart());
-		while (lastLine != lines.end() && lastLine->first < dif.getEnd())
+		auto fncLines = lines->getLinesInRange(dif.getStart(), dif.getEnd());
+		if (!fncLines.empty() && fncLines.front()->addr == dif.getStart())
 		{
-			dif.setEndLine(lastLine->second);
-			++lastLine;
+			dif.setEndLine(fncLines.back()->lineNum);
 		}
 
 		auto* sym = _inFile->getFileFormat()->getSymbol(df->lowAddr + 1);
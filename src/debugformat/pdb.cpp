@@ -28,14 +28,14 @@ void DebugFormat::loadPdb()
 void DebugFormat::loadPdbTypes()
 {
 	auto* ts = _pdbFile->get_types_container();
-	for (auto& item : ts->types)
+	for (auto& item : ts->get_types())
 	{
 		if (item.second)
 		{
 			types.insert(loadPdbType(item.second));
 		}
 	}
-	for (auto& item : ts->types_fully_defined)
+	for (auto& item : ts->get_types_fully_defined())
 	{
 		if (item.second)
 		{
@@ -5,6 +5,7 @@
  */
 
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 
@@ -121,6 +122,34 @@ std::string CDemangler::demangleToString(std::string inputName) {
 	return retvalue;
 }
 
+/**
+ * @brief Demangle a whole batch of names in one call. errState is reset before every name,
+ * so a failed name does not poison the rest of the batch.
+ * The names are demangled in sorted order, so duplicates -- which repeat massively in
+ * symbol tables of real binaries -- are adjacent and parsed only once.
+ * @param inputNames The names to be demangled.
+ * @return Map of input names to their demangled forms. Names that could not be demangled
+ * are left out.
+ */
+std::map<std::string, std::string> CDemangler::demangleBatchToStrings(std::vector<std::string> inputNames) {
+	std::map<std::string, std::string> results;
+
+	std::sort(inputNames.begin(), inputNames.end());
+	for (std::size_t i = 0; i < inputNames.size(); ++i) {
+		if (i > 0 && inputNames[i] == inputNames[i - 1]) {
+			//duplicate of the previous name, result is already in the map
+			continue;
+		}
+
+		std::string retvalue = demangleToString(inputNames[i]);
+		if (isOk() && !retvalue.empty()) {
+			results[inputNames[i]] = retvalue;
+		}
+	}
+
+	return results;
+}
+
 /**
  * @brief Set substitution analysis manually to enabled or disabled.
  * @param x Boolean value. True means enable, false means disable.
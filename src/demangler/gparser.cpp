@@ -2026,7 +2026,8 @@ cGram::errcode cGram::generateIgrammar(const string inputfilename, const string
 	ofsIgH << "\tstatic cGram::ruleaddr_t ruleaddrs[" << newIG_ruleaddrs_x << "];\n";
 	ofsIgH << "\tstatic cGram::gelem_t ruleelements[" << newIG_ruleelements_x << "];\n";
 	ofsIgH << "\tstatic cGram::gelem_t root;\n";
-	ofsIgH << "\tcGram::igram_t getInternalGrammar();\n";
+	ofsIgH << "\tstatic cGram::llelem_t* llst_rows[" << newIG_llst_x << "];\n";
+	ofsIgH << "\tstatic cGram::igram_t getInternalGrammar();\n";
 	ofsIgH << "};\n";
 	ofsIgH << "\n";
 	ofsIgH << "} /* namespace demangler */\n";
@@ -2075,6 +2076,16 @@ cGram::errcode cGram::generateIgrammar(const string inputfilename, const string
 	ofsIgCpp << "\n};\n";
 	ofsIgCpp << "\n";
 	ofsIgCpp << "/**\n";
+	ofsIgCpp << " * @brief Static table of row pointers into llst. All demangler instances share\n";
+	ofsIgCpp << " * these read-only tables, so no runtime construction is needed.\n";
+	ofsIgCpp << " */\n";
+	ofsIgCpp << "cGram::llelem_t* cIgram_" << outputname << "ll::llst_rows[" << newIG_llst_x << "] = {\n";
+	for (std::size_t i = 0; i < newIG_llst_x; i++) {
+		ofsIgCpp << "\tllst[" << i << "],\n";
+	}
+	ofsIgCpp << "};\n";
+	ofsIgCpp << "\n";
+	ofsIgCpp << "/**\n";
 	ofsIgCpp << " * @brief Export internal grammar data for use in demangler.\n";
 	ofsIgCpp << " * @return igram_t structure containing the internal grammar data.\n";
 	ofsIgCpp << " */\n";
@@ -2089,15 +2100,9 @@ cGram::errcode cGram::generateIgrammar(const string inputfilename, const string
 	ofsIgCpp << "\t\tterminal_static,\n";
 	ofsIgCpp << "\t\truleaddrs,\n";
 	ofsIgCpp << "\t\truleelements,\n";
-	ofsIgCpp << "\t\tNULL\n";
+	ofsIgCpp << "\t\tllst_rows\n";
 	ofsIgCpp << "\t};\n";
 	ofsIgCpp << "\t\n";
-	ofsIgCpp << "\t//dynamic allocation of the llst\n";
-	ofsIgCpp << "\tretvalue.llst = static_cast<cGram::llelem_t**>(malloc(sizeof(cGram::llelem_t*) * retvalue.llst_x));\n";
-	ofsIgCpp << "\tfor (unsigned int i=0; i<retvalue.llst_x; i++) {\n";
-	ofsIgCpp << "\t\tretvalue.llst[i] = llst[i];\n";
-	ofsIgCpp << "\t}\n";
-	ofsIgCpp << "\t\n";
 	ofsIgCpp << "\treturn retvalue;\n";
 	ofsIgCpp << "}\n";
 	ofsIgCpp << "\n";
@@ -2304,6 +2309,35 @@ cGram::llelem_t cGram::getllpair(string nt, unsigned int ntst, unsigned char t)
 	return retvalue;
 }
 
+/**
+ * @brief Clear the reusable working containers before analysis of a new
+ * symbol. The containers keep their allocated capacity, so the memory is
+ * reused by all subsequent symbols.
+ */
+void cGram::workmem_t::reset() {
+	while (!elemstack.empty()) {elemstack.pop();}
+	used_rules.clear();
+	current_param_vector.clear();
+	name_substitution_vector.clear();
+	type_substitution_vector.clear();
+	while (!param_stack.empty()) {param_stack.pop();}
+	while (!param_vector_stack.empty()) {param_vector_stack.pop();}
+	while (!name_vector_stack.empty()) {name_vector_stack.pop();}
+	while (!name_substitution_stack.empty()) {name_substitution_stack.pop();}
+	while (!type_substitution_stack.empty()) {type_substitution_stack.pop();}
+	while (!btypesub_stack.empty()) {btypesub_stack.pop();}
+	current_name.clear();
+	while (!sub_elemstack.empty()) {sub_elemstack.pop();}
+	while (!name_stack.empty()) {name_stack.pop();}
+	while (!paramm_stack.empty()) {paramm_stack.pop();}
+	while (!params_stack.empty()) {params_stack.pop();}
+	while (!arrays_stack.empty()) {arrays_stack.pop();}
+	template_subs.clear();
+	substitutions.clear();
+	arrays.clear();
+	sub_used_rules.clear();
+}
+
 /**
  * @brief The pre-analyzer which expands substitutions.
  * @param input The mangled name.
@@ -2315,7 +2349,6 @@ string cGram::subanalyze(const string input, cGram::errcode *err) {
 
 	string current_part;
 	bool last_rule = false;
-	stack<gelem_t> elemstack;
 	size_t position = 0;
 	bool builtin = false;
 	bool pexpr = false;
@@ -2339,19 +2372,22 @@ string cGram::subanalyze(const string input, cGram::errcode *err) {
 	string current_retvalue;
 	string current_input;
 
-	stack<string> name_stack;
-	stack<string> paramm_stack;
-	stack<string> params_stack;
-	stack<vector<string>> arrays_stack;
-	vector<string> template_subs;
-	vector<string> substitutions;
+	//working containers are reused between symbols, cleared for this one
+	workmem.reset();
+	stack<gelem_t> & elemstack = workmem.sub_elemstack;
+	stack<string> & name_stack = workmem.name_stack;
+	stack<string> & paramm_stack = workmem.paramm_stack;
+	stack<string> & params_stack = workmem.params_stack;
+	stack<vector<string>> & arrays_stack = workmem.arrays_stack;
+	vector<string> & template_subs = workmem.template_subs;
+	vector<string> & substitutions = workmem.substitutions;
 
-	vector<string> arrays;
+	vector<string> & arrays = workmem.arrays;
 
 	//grammar element from the top of stack
 	gelem_t current_element;
 	//vector of rules used during the analysis
-	vector<unsigned int> used_rules;
+	vector<unsigned int> & used_rules = workmem.sub_used_rules;
 	//currently used rule. contains the semantic action as well
 	llelem_t current_rule;
 
@@ -3323,31 +3359,34 @@ cGram::errcode cGram::analyze(string input, cName & pName) {
 	bool last_rule = false;
 	bool rettype = false;
 	bool btypesub = false;
-	stack<gelem_t> elemstack;
 	size_t position = 0;
 	bool tempbool = false; //a bool variable for temporary use
 
+	//working containers are reused between symbols, cleared for this one
+	workmem.reset();
+	stack<gelem_t> & elemstack = workmem.elemstack;
+
 	//grammar element from the top of stack
 	gelem_t current_element;
 	//vector of rules used during the analysis
-	vector<unsigned int> used_rules;
+	vector<unsigned int> & used_rules = workmem.used_rules;
 	//currently used rule. contains the semantic action as well
 	llelem_t current_rule;
 	//currently built parameter
 	cName::type_t current_param;
 	pName.type_t_clear(current_param);
 	//current vector of parameters
-	vector<cName::type_t> current_param_vector;
-	vector<cName::name_t> name_substitution_vector;
-	vector<cName::type_t> type_substitution_vector;
+	vector<cName::type_t> & current_param_vector = workmem.current_param_vector;
+	vector<cName::name_t> & name_substitution_vector = workmem.name_substitution_vector;
+	vector<cName::type_t> & type_substitution_vector = workmem.type_substitution_vector;
 
 	//stacks to store current state when entering a new level of recursion
-	stack<cName::type_t> param_stack;
-	stack<vector<cName::type_t>> param_vector_stack;
-	stack<vector<cName::name_t>> name_vector_stack;
-	stack<vector<cName::name_t>> name_substitution_stack;
-	stack<vector<cName::type_t>> type_substitution_stack;
-	stack<bool> btypesub_stack;
+	stack<cName::type_t> & param_stack = workmem.param_stack;
+	stack<vector<cName::type_t>> & param_vector_stack = workmem.param_vector_stack;
+	stack<vector<cName::name_t>> & name_vector_stack = workmem.name_vector_stack;
+	stack<vector<cName::name_t>> & name_substitution_stack = workmem.name_substitution_stack;
+	stack<vector<cName::type_t>> & type_substitution_stack = workmem.type_substitution_stack;
+	stack<bool> & btypesub_stack = workmem.btypesub_stack;
 
 
 	//current unqualified name
@@ -3355,7 +3394,7 @@ cGram::errcode cGram::analyze(string input, cName & pName) {
 	current_unq_name.tpl = nullptr;
 	current_unq_name.op = false;
 	//current qualified name
-	vector<cName::name_t> current_name;
+	vector<cName::name_t> & current_name = workmem.current_name;
 
 	//id length used for loading IDs
 	unsigned int current_id_length = 0;
@@ -4,8 +4,6 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
-#include <cstdlib>
-
 #include "retdec/demangler/demglobal.h"
 #include "retdec/demangler/igrams.h"
 
@@ -14,19 +12,14 @@ using namespace std;
 namespace retdec {
 namespace demangler {
 
-/**
- * @brief Classes containing internal grammar.
- */
-cIgram_msll* igram_msll = nullptr; //Microsoft Visual C++
-cIgram_gccll* igram_gccll = nullptr; //GCC
-cIgram_borlandll* igram_borlandll = nullptr; //Borland
-
-//[igram] add pointers to internal grammars here
+//[igram] add internal grammars to initIgram below
 
 /**
- * @brief Function which allocates an internal grammar class and sets the internal grammar structure.
+ * @brief Function which sets the internal grammar structure of the parser.
+ * The grammars are static read-only tables shared by all demangler instances,
+ * so no allocation or other runtime construction is done here.
  * @param gname Grammar name. The particular internal grammar is selected using this name.
- * @param gParser Pointer to a cGram to send pointers to newly allocated grammar to.
+ * @param gParser Pointer to a cGram to send pointers to the static grammar to.
  * @return Was the initialisation successful?
  * @retval false Grammar with the specified name was not found.
  */
@@ -35,57 +28,34 @@ bool initIgram(string gname, cGram* gParser) {
 
 	//Microsoft Visual C++ (msll)
 	if (gname == "ms") {
-		igram_msll = new cIgram_msll;
-		gParser->internalGrammarStruct = igram_msll->getInternalGrammar();
+		gParser->internalGrammarStruct = cIgram_msll::getInternalGrammar();
 		return true;
 	}
 	//GCC (gccll)
 	else if (gname == "gcc") {
-		igram_gccll = new cIgram_gccll;
-		gParser->internalGrammarStruct = igram_gccll->getInternalGrammar();
+		gParser->internalGrammarStruct = cIgram_gccll::getInternalGrammar();
 		return true;
 	}
 	//Borland (borlandll)
 	else if (gname == "borland") {
-		igram_borlandll = new cIgram_borlandll;
-		gParser->internalGrammarStruct = igram_borlandll->getInternalGrammar();
+		gParser->internalGrammarStruct = cIgram_borlandll::getInternalGrammar();
 		return true;
 	}
 
-	//[igram] add allocation of internal grammars here
+	//[igram] add selection of internal grammars here
 
 	return retvalue;
 }
 
 /**
- * @brief Function which deallocates all used internal grammar classes.
+ * @brief Function which detaches the internal grammar from the parser.
+ * The grammar tables themselves are static and are never deallocated.
  * @param gParser Pointer to a cGram to clean internal grammars from.
  */
 void deleteIgrams(cGram* gParser) {
 
-	//first, delete the dynamically allocated internal llst if there is any
-	if (gParser->internalGrammarStruct.llst != nullptr) {
-		free(gParser->internalGrammarStruct.llst);
-		gParser->internalGrammarStruct.llst = nullptr;
-	}
-
-	//dealocate all internal grammars here...
-	if (igram_msll != nullptr) {
-		delete igram_msll;
-		igram_msll = nullptr;
-	}
-
-	if (igram_gccll != nullptr) {
-		delete igram_gccll;
-		igram_gccll = nullptr;
-	}
-
-	if (igram_borlandll != nullptr) {
-		delete igram_borlandll;
-		igram_borlandll = nullptr;
-	}
-
-	//[igram] add deallocation of internal grammars here
+	//the tables are static, just drop the pointer to them
+	gParser->internalGrammarStruct.llst = nullptr;
 
 }
 
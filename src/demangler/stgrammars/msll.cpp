@@ -4,8 +4,6 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
-#include <cstdlib>
-
 #include "retdec/demangler/stgrammars/msll.h"
 
 namespace retdec {
@@ -5420,6 +5418,262 @@ cGram::llelem_t cIgram_msll::llst[249][68] = {
 	}
 };
 
+/**
+ * @brief Static table of row pointers into llst. All demangler instances share
+ * these read-only tables, so no runtime construction is needed.
+ */
+cGram::llelem_t* cIgram_msll::llst_rows[249] = {
+	llst[0],
+	llst[1],
+	llst[2],
+	llst[3],
+	llst[4],
+	llst[5],
+	llst[6],
+	llst[7],
+	llst[8],
+	llst[9],
+	llst[10],
+	llst[11],
+	llst[12],
+	llst[13],
+	llst[14],
+	llst[15],
+	llst[16],
+	llst[17],
+	llst[18],
+	llst[19],
+	llst[20],
+	llst[21],
+	llst[22],
+	llst[23],
+	llst[24],
+	llst[25],
+	llst[26],
+	llst[27],
+	llst[28],
+	llst[29],
+	llst[30],
+	llst[31],
+	llst[32],
+	llst[33],
+	llst[34],
+	llst[35],
+	llst[36],
+	llst[37],
+	llst[38],
+	llst[39],
+	llst[40],
+	llst[41],
+	llst[42],
+	llst[43],
+	llst[44],
+	llst[45],
+	llst[46],
+	llst[47],
+	llst[48],
+	llst[49],
+	llst[50],
+	llst[51],
+	llst[52],
+	llst[53],
+	llst[54],
+	llst[55],
+	llst[56],
+	llst[57],
+	llst[58],
+	llst[59],
+	llst[60],
+	llst[61],
+	llst[62],
+	llst[63],
+	llst[64],
+	llst[65],
+	llst[66],
+	llst[67],
+	llst[68],
+	llst[69],
+	llst[70],
+	llst[71],
+	llst[72],
+	llst[73],
+	llst[74],
+	llst[75],
+	llst[76],
+	llst[77],
+	llst[78],
+	llst[79],
+	llst[80],
+	llst[81],
+	llst[82],
+	llst[83],
+	llst[84],
+	llst[85],
+	llst[86],
+	llst[87],
+	llst[88],
+	llst[89],
+	llst[90],
+	llst[91],
+	llst[92],
+	llst[93],
+	llst[94],
+	llst[95],
+	llst[96],
+	llst[97],
+	llst[98],
+	llst[99],
+	llst[100],
+	llst[101],
+	llst[102],
+	llst[103],
+	llst[104],
+	llst[105],
+	llst[106],
+	llst[107],
+	llst[108],
+	llst[109],
+	llst[110],
+	llst[111],
+	llst[112],
+	llst[113],
+	llst[114],
+	llst[115],
+	llst[116],
+	llst[117],
+	llst[118],
+	llst[119],
+	llst[120],
+	llst[121],
+	llst[122],
+	llst[123],
+	llst[124],
+	llst[125],
+	llst[126],
+	llst[127],
+	llst[128],
+	llst[129],
+	llst[130],
+	llst[131],
+	llst[132],
+	llst[133],
+	llst[134],
+	llst[135],
+	llst[136],
+	llst[137],
+	llst[138],
+	llst[139],
+	llst[140],
+	llst[141],
+	llst[142],
+	llst[143],
+	llst[144],
+	llst[145],
+	llst[146],
+	llst[147],
+	llst[148],
+	llst[149],
+	llst[150],
+	llst[151],
+	llst[152],
+	llst[153],
+	llst[154],
+	llst[155],
+	llst[156],
+	llst[157],
+	llst[158],
+	llst[159],
+	llst[160],
+	llst[161],
+	llst[162],
+	llst[163],
+	llst[164],
+	llst[165],
+	llst[166],
+	llst[167],
+	llst[168],
+	llst[169],
+	llst[170],
+	llst[171],
+	llst[172],
+	llst[173],
+	llst[174],
+	llst[175],
+	llst[176],
+	llst[177],
+	llst[178],
+	llst[179],
+	llst[180],
+	llst[181],
+	llst[182],
+	llst[183],
+	llst[184],
+	llst[185],
+	llst[186],
+	llst[187],
+	llst[188],
+	llst[189],
+	llst[190],
+	llst[191],
+	llst[192],
+	llst[193],
+	llst[194],
+	llst[195],
+	llst[196],
+	llst[197],
+	llst[198],
+	llst[199],
+	llst[200],
+	llst[201],
+	llst[202],
+	llst[203],
+	llst[204],
+	llst[205],
+	llst[206],
+	llst[207],
+	llst[208],
+	llst[209],
+	llst[210],
+	llst[211],
+	llst[212],
+	llst[213],
+	llst[214],
+	llst[215],
+	llst[216],
+	llst[217],
+	llst[218],
+	llst[219],
+	llst[220],
+	llst[221],
+	llst[222],
+	llst[223],
+	llst[224],
+	llst[225],
+	llst[226],
+	llst[227],
+	llst[228],
+	llst[229],
+	llst[230],
+	llst[231],
+	llst[232],
+	llst[233],
+	llst[234],
+	llst[235],
+	llst[236],
+	llst[237],
+	llst[238],
+	llst[239],
+	llst[240],
+	llst[241],
+	llst[242],
+	llst[243],
+	llst[244],
+	llst[245],
+	llst[246],
+	llst[247],
+	llst[248],
+};
+
 /**
  * @brief Export internal grammar data for use in demangler.
  * @return igram_t structure containing the internal grammar data.
@@ -5435,15 +5689,9 @@ cGram::igram_t cIgram_msll::getInternalGrammar() {
 		terminal_static,
 		ruleaddrs,
 		ruleelements,
-		nullptr
+		llst_rows
 	};
 
-	//dynamic allocation of the llst
-	retvalue.llst = static_cast<cGram::llelem_t**>(malloc(sizeof(cGram::llelem_t*) * retvalue.llst_x));
-	for (unsigned int i=0; i<retvalue.llst_x; i++) {
-		retvalue.llst[i] = llst[i];
-	}
-
 	return retvalue;
 }
 
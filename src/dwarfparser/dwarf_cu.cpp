@@ -120,7 +120,7 @@ std::size_t DwarfCU::srcFilesCount()
  */
 void DwarfCU::addSrcFile(string f)
 {
-	m_srcFiles.push_back(f);
+	m_srcFiles.push_back(getParentFile()->internString(std::move(f)));
 }
 
 /**
@@ -128,13 +128,11 @@ void DwarfCU::addSrcFile(string f)
  * @param idx Index of source file to get.
  * @return Pointer to source file name or nullptr if index out of range.
  */
-string *DwarfCU::getSrcFile(unsigned idx)
+const string *DwarfCU::getSrcFile(unsigned idx)
 {
 	if (idx < srcFilesCount())
 	{
-		list<string>::iterator srcFileIt = m_srcFiles.begin();
-		advance(srcFileIt, idx);
-		return &(*srcFileIt);
+		return m_srcFiles[idx];
 	}
 	else
 	{
@@ -152,16 +150,13 @@ string *DwarfCU::getSrcFile(unsigned idx)
  */
 int DwarfCU::findSrcFile(string f, const string **ret)
 {
-	list<string>::const_iterator srcFileIt = m_srcFiles.begin();
-	while (srcFileIt != m_srcFiles.end())
+	for (const auto *srcFile : m_srcFiles)
 	{
-		if (*srcFileIt == f)
+		if (*srcFile == f)
 		{
-			*ret = &(*srcFileIt);
+			*ret = srcFile;
 			return DW_DLV_OK;
 		}
-
-		++srcFileIt;
 	}
 
 	// If it gets here, no record was found.
@@ -192,11 +187,9 @@ void DwarfCU::dump() const
 	cout << "CU lowpc  :  " << hex << lowAddr << endl;
 	cout << "CU highpc :  " << hex << highAddr << endl;
 
-	list<string>::const_iterator srcFileIt = m_srcFiles.begin();
-	while (srcFileIt != m_srcFiles.end())
+	for (const auto *srcFile : m_srcFiles)
 	{
-		cout << "\t" << *(srcFileIt) << endl;
-		++srcFileIt;
+		cout << "\t" << *srcFile << endl;
 	}
 
 	cout << endl;
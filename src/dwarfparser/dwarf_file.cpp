@@ -38,7 +38,8 @@ DwarfFile::DwarfFile(string fileName, retdec::fileformat::FileFormat *fileParser
 		m_dbg(nullptr),
 		m_fd(0),
 		m_error(nullptr),
-		m_activeCU(nullptr)
+		m_activeCU(nullptr),
+		m_allCUsLoaded(false)
 {
 	loadFile(fileName, fileParser);
 }
@@ -71,6 +72,9 @@ DwarfFile::~DwarfFile()
  *
  * Binary interface is used to access input file at first.
  * If it fails standard ELF interface provided by libdwarf is used.
+ *
+ * Only a cheap index of compilation units is built here -- DIE subtrees are
+ * parsed lazily when DWARF records are queried for the first time.
  */
 bool DwarfFile::loadFile(string fileName, retdec::fileformat::FileFormat *fileParser)
 {
@@ -99,7 +103,7 @@ bool DwarfFile::loadFile(string fileName, retdec::fileformat::FileFormat *filePa
 
 		resources.initMappingDefault();
 
-		loadFileCUs();
+		indexFileCUs();
 		m_hasDwarf = true;
 	}
 
@@ -135,15 +139,27 @@ bool DwarfFile::loadFile(string fileName, retdec::fileformat::FileFormat *filePa
 		// Init register mapping by default values.
 		resources.initMappingDefault();
 
-		loadFileCUs();
+		indexFileCUs();
 		m_hasDwarf = true;
 	}
 
-	makeStructTypesUnique();
-
 	return m_hasDwarf;
 }
 
+/**
+ * @brief Get pointer to a shared copy of the given string.
+ * @param s String to intern.
+ * @return Pointer to the shared copy, valid for the whole lifetime of this file.
+ *
+ * The same strings -- source file paths above all -- repeat in every
+ * compilation unit of the file. Interning them makes all compilation units
+ * share one copy of each distinct string instead of allocating their own.
+ */
+const std::string *DwarfFile::internString(std::string s)
+{
+	return &(*m_internedStrings.insert(std::move(s)).first);
+}
+
 /**
  * Same-named structures may exist. We need to rename them -> make them unique,
  * otherwise, string based (LLVM) type representation can not be used.
@@ -181,9 +197,12 @@ bool DwarfFile::hasDwarfInfo()
 }
 
 /**
- * @brief Iterate over DWARF file's CUs.
+ * @brief Iterate over DWARF file's CUs and build their index.
+ *
+ * Only CU DIE offsets and address ranges are recorded here -- DIE subtrees
+ * are parsed later by loadIndexedCU() when somebody asks for their contents.
  */
-void DwarfFile::loadFileCUs()
+void DwarfFile::indexFileCUs()
 {
 	Dwarf_Unsigned cu_header_length = 0;
 	Dwarf_Half version_stamp = 0;
@@ -225,13 +244,124 @@ void DwarfFile::loadFileCUs()
 			return;
 		}
 
-		int lvl = 0;
-		loadCUtree(cuDie, nullptr, lvl);
+		CUIndexEntry entry;
+		entry.loaded = false;
+
+		if (dwarf_dieoffset(cuDie, &entry.dieOffset, &m_error) != DW_DLV_OK)
+		{
+			DWARF_ERROR("Libdwarf error: " << getDwarfError(m_error));
+			dwarf_dealloc(m_dbg, cuDie, DW_DLA_DIE);
+			return;
+		}
+
+		AttrProcessor ap(m_dbg, cuDie, this);
+		ap.get(DW_AT_low_pc, entry.lowAddr);
+		ap.get(DW_AT_high_pc, entry.highAddr);
+
+		m_cuIndex.push_back(entry);
 
 		dwarf_dealloc(m_dbg, cuDie, DW_DLA_DIE);
 	}
 }
 
+/**
+ * @brief Parse DIE subtree of the indexed CU, if it was not parsed already.
+ * @param entry Index record of the CU to parse.
+ * @return True if CU contents are available in containers, false otherwise.
+ */
+bool DwarfFile::loadIndexedCU(CUIndexEntry &entry)
+{
+	if (entry.loaded)
+	{
+		return true;
+	}
+
+	Dwarf_Die cuDie = nullptr;
+	m_res = dwarf_offdie_b(m_dbg, entry.dieOffset, is_info, &cuDie, &m_error);
+	if (m_res != DW_DLV_OK)
+	{
+		DWARF_ERROR("Libdwarf error: " << getDwarfError(m_error));
+		return false;
+	}
+
+	int lvl = 0;
+	loadCUtree(cuDie, nullptr, lvl);
+
+	dwarf_dealloc(m_dbg, cuDie, DW_DLA_DIE);
+
+	entry.loaded = true;
+	return true;
+}
+
+/**
+ * @brief Parse all indexed CUs that were not parsed yet.
+ *
+ * CUs are parsed one by one on purpose. Parsing them on multiple threads
+ * would need one Dwarf_Debug per thread, and every element created during
+ * parsing stays tied to the handle it was created from -- names, location
+ * lists and on-demand attribute reads all go through
+ * DwarfBaseElement::getLibdwarfDebug(), and libdwarf data may be deallocated
+ * only through the handle that allocated it. Elements produced by short-lived
+ * per-thread handles therefore can not be merged into the shared containers
+ * safely.
+ */
+void DwarfFile::loadAllCUs()
+{
+	if (m_allCUsLoaded)
+	{
+		return;
+	}
+
+	for (auto &entry : m_cuIndex)
+	{
+		loadIndexedCU(entry);
+	}
+
+	m_allCUsLoaded = true;
+	makeStructTypesUnique();
+}
+
+/**
+ * @brief Parse only the CU which covers the given address.
+ * @param address Address to search for.
+ * @return True if some CU covering the address was parsed, false otherwise.
+ *
+ * Containers then hold records of all CUs parsed so far, not of the whole
+ * file. Use this instead of the get*() methods when only one location is
+ * interesting -- it avoids materializing debug info of all the other CUs.
+ */
+bool DwarfFile::loadCUAtAddress(Dwarf_Unsigned address)
+{
+	bool loaded = false;
+
+	for (auto &entry : m_cuIndex)
+	{
+		if (entry.lowAddr == EMPTY_UNSIGNED)
+		{
+			continue;
+		}
+
+		// DW_AT_high_pc may be an offset from DW_AT_low_pc.
+		Dwarf_Unsigned high = entry.highAddr;
+		if (high != EMPTY_UNSIGNED && high < entry.lowAddr)
+		{
+			high = entry.lowAddr + high;
+		}
+
+		if (entry.lowAddr <= address
+				&& (high == EMPTY_UNSIGNED || address < high))
+		{
+			loaded |= loadIndexedCU(entry);
+		}
+	}
+
+	if (loaded)
+	{
+		makeStructTypesUnique();
+	}
+	return loaded;
+}
+
 /**
  * @brief Gets a CU DIE at first and recursively load all DIEs in tree.
  * @param inDie Input die
@@ -658,6 +788,7 @@ Dwarf_Debug &DwarfFile::getDwarfDebug()
  */
 DwarfCUContainer *DwarfFile::getCUs()
 {
+	loadAllCUs();
 	return &m_CUs;
 }
 
@@ -667,6 +798,7 @@ DwarfCUContainer *DwarfFile::getCUs()
  */
 DwarfLineContainer *DwarfFile::getLines()
 {
+	loadAllCUs();
 	return &m_lines;
 }
 
@@ -676,6 +808,7 @@ DwarfLineContainer *DwarfFile::getLines()
  */
 DwarfFunctionContainer *DwarfFile::getFunctions()
 {
+	loadAllCUs();
 	return &m_functions;
 }
 
@@ -685,6 +818,7 @@ DwarfFunctionContainer *DwarfFile::getFunctions()
  */
 DwarfTypeContainer *DwarfFile::getTypes()
 {
+	loadAllCUs();
 	return &m_types;
 }
 
@@ -694,6 +828,7 @@ DwarfTypeContainer *DwarfFile::getTypes()
  */
 DwarfVarContainer *DwarfFile::getGlobalVars()
 {
+	loadAllCUs();
 	return &m_globalVars;
 }
 
@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -22,9 +23,11 @@ namespace dwarfparser {
  * @param elem Pointer to parent element that owns this container.
  */
 DwarfLineContainer::DwarfLineContainer(DwarfFile *file, DwarfBaseElement *elem) :
-		DwarfBaseContainer<DwarfLine>(file, elem)
+		DwarfBaseContainer<DwarfLine>(file, elem),
+		m_lastSrcFile(nullptr),
+		m_addrTableValid(false)
 {
-	m_srcFiles.push_back(EMPTY_STR);
+
 }
 
 /**
@@ -169,7 +172,7 @@ void DwarfLineContainer::loadLine(Dwarf_Line line)
 	}
 
 	// Create line record.
-	DwarfLine *l = new DwarfLine(this, *findSrcFile(f));
+	DwarfLine *l = new DwarfLine(this, *findSrcFile(std::move(f)));
 
 	l->lineNum = lineno;
 	l->addr = addr;
@@ -182,30 +185,28 @@ void DwarfLineContainer::loadLine(Dwarf_Line line)
 	if (epilogueBegin) l->flags += DwarfLine::EPILOGUE_BEGIN;
 
 	m_data.push_back(l);
+	m_addrTableValid = false;
 }
 
 /**
  * @brief Find source file name and return pointer to it.
- *        If specified name is not in list yet, add it.
+ *        If specified name was not seen yet, remember it.
  * @param f Source file name to find.
- * @return Pointer to file name in list.
+ * @return Pointer to the shared file name.
+ *
+ * Names are interned in the parent file, so lines, compilation units and all
+ * the other records share one copy of each distinct name.
  */
-string *DwarfLineContainer::findSrcFile(string f)
+const string *DwarfLineContainer::findSrcFile(string f)
 {
-	list<string>::iterator srcFilesIter = m_srcFiles.begin();
-	while (srcFilesIter != m_srcFiles.end())
+	// Consecutive lines mostly come from the same file.
+	if (m_lastSrcFile && *m_lastSrcFile == f)
 	{
-		if (*srcFilesIter == f)
-		{
-			return &(*srcFilesIter);
-		}
-
-		++srcFilesIter;
+		return m_lastSrcFile;
 	}
 
-	// If it gets here, no record was found.
-	m_srcFiles.push_back(f);
-	return &(m_srcFiles.back());
+	m_lastSrcFile = m_parentFile->internString(std::move(f));
+	return m_lastSrcFile;
 }
 
 /**
@@ -230,21 +231,82 @@ vector <Dwarf_Addr> DwarfLineContainer::getAddrByLine(string file, Dwarf_Unsigne
 	return ret;
 }
 
+/**
+ * @brief Build the flat table of lines sorted by address.
+ *        Address based queries then use binary search instead of scanning
+ *        the whole container. Table is rebuilt only when new lines were
+ *        loaded since the last query.
+ */
+void DwarfLineContainer::buildAddrTable()
+{
+	if (m_addrTableValid)
+	{
+		return;
+	}
+
+	m_addrTable.clear();
+	m_addrTable.reserve(m_data.size());
+	for (iterator it=begin(); it!=end(); ++it)
+	{
+		m_addrTable.push_back(*it);
+	}
+
+	// Stable sort keeps load order of lines on the same address.
+	stable_sort(m_addrTable.begin(), m_addrTable.end(),
+			[](const DwarfLine *a, const DwarfLine *b)
+			{
+				return a->addr < b->addr;
+			});
+
+	m_addrTableValid = true;
+}
+
 /**
  * @brief Gets line associated with particular addresses.
  * @return Dwarfparser representation of line.
  */
 DwarfLine *DwarfLineContainer::getLineByAddr(Dwarf_Addr addr)
 {
-	for (iterator it=begin(); it!=end(); ++it)
+	buildAddrTable();
+
+	auto it = lower_bound(m_addrTable.begin(), m_addrTable.end(), addr,
+			[](const DwarfLine *l, Dwarf_Addr a)
+			{
+				return l->addr < a;
+			});
+
+	if (it != m_addrTable.end() && (*it)->addr == addr)
 	{
-		if ((*it)->addr == addr)
-			return (*it);
+		return *it;
 	}
 
 	return nullptr;
 }
 
+/**
+ * @brief Gets all lines with address in range <@p lowAddr, @p highAddr).
+ * @param lowAddr  Start of address range (inclusive).
+ * @param highAddr End of address range (exclusive).
+ * @return Lines in the range, sorted by address.
+ */
+vector<DwarfLine*> DwarfLineContainer::getLinesInRange(
+		Dwarf_Addr lowAddr,
+		Dwarf_Addr highAddr)
+{
+	buildAddrTable();
+
+	auto cmp = [](const DwarfLine *l, Dwarf_Addr a)
+	{
+		return l->addr < a;
+	};
+
+	auto first = lower_bound(m_addrTable.begin(), m_addrTable.end(),
+			lowAddr, cmp);
+	auto last = lower_bound(first, m_addrTable.end(), highAddr, cmp);
+
+	return vector<DwarfLine*>(first, last);
+}
+
 /**
  * @brief Prints content of line number container.
  * @note Debugging purposes.
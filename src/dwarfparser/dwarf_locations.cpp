@@ -69,7 +69,11 @@ bool DwarfLocationDesc::cLocType::failed()
  */
 DwarfLocationDesc::DwarfLocationDesc() :
 		m_baseFunc(nullptr),
-		m_parent(nullptr)
+		m_parent(nullptr),
+		m_cacheValid(false),
+		m_cachePc(0),
+		m_cacheType(FAIL),
+		m_cacheAddr(0)
 {
 
 }
@@ -81,6 +85,7 @@ DwarfLocationDesc::DwarfLocationDesc() :
 void DwarfLocationDesc::addExpr(Expression e)
 {
 	m_exprs.push_back(e);
+	m_cacheValid = false;
 }
 
 /**
@@ -99,6 +104,7 @@ DwarfResources *DwarfLocationDesc::getResources()
 void DwarfLocationDesc::setBaseFunc(DwarfFunction *f)
 {
 	m_baseFunc = f;
+	m_cacheValid = false;
 }
 
 /**
@@ -337,6 +343,39 @@ void DwarfLocationDesc::dump()
  */
 DwarfLocationDesc::cLocType DwarfLocationDesc::computeLocation(string *n,
 	Dwarf_Addr *a, Dwarf_Addr pc, Dwarf_Addr base, bool hasBase)
+{
+	// Location expressions do not change, so the result of the last evaluation
+	// is cached and replayed as long as the query stays the same. This pays off
+	// mainly for frame bases, which are re-evaluated for every DW_OP_fbreg of
+	// every variable of the function.
+	if (!hasBase && m_cacheValid && pc == m_cachePc)
+	{
+		*n = m_cacheName;
+		*a = m_cacheAddr;
+		return cLocType(m_cacheType);
+	}
+
+	cLocType ret = computeLocationImpl(n, a, pc, base, hasBase);
+
+	// Results with a base address are not cached, the base differs per query.
+	// Failures are not cached either -- they may leave output arguments unset.
+	if (!hasBase && !ret.failed())
+	{
+		m_cacheValid = true;
+		m_cachePc = pc;
+		m_cacheType = ret.isRegister() ? REGISTER : (ret.isValue() ? VALUE : ADDRESS);
+		m_cacheName = *n;
+		m_cacheAddr = *a;
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Compute location without using the cache. See @ref computeLocation.
+ */
+DwarfLocationDesc::cLocType DwarfLocationDesc::computeLocationImpl(string *n,
+	Dwarf_Addr *a, Dwarf_Addr pc, Dwarf_Addr base, bool hasBase)
 {
 	n->clear();
 
@@ -520,6 +559,28 @@ DwarfLocationDesc::evaluateExpression(Expression &expr, string *retN,
 		return cLocType(REGISTER);
 	}
 
+	//
+	// Fast path for the most common expression -- a single DW_OP_fbreg atom.
+	// The frame base is resolved directly (and served from its cache on
+	// repeated queries), the offset is added and the stack machine below
+	// is not set up at all.
+	//
+
+	if (!hasBase && expr.count() == 1 && expr.atoms[0].opcode == DW_OP_fbreg)
+	{
+		string name;
+		Dwarf_Addr fbase;
+
+		if (!getBaseLoc()->computeLocation(&name, &fbase, pc).isAddress())
+		{
+			// PC may be outside of frame base range, or frame base is a register.
+			return cLocType(FAIL);
+		}
+
+		*retA = fbase + Dwarf_Signed(expr.atoms[0].op1);
+		return cLocType(ADDRESS);
+	}
+
 	//
 	// Address Location Descriptions.
 	//
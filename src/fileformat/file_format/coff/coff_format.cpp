@@ -9,6 +9,7 @@
 
 #include <pelib/PeLibInc.h>
 
+#include "retdec/utils/allocator.h"
 #include "retdec/utils/string.h"
 #include "retdec/fileformat/file_format/coff/coff_format.h"
 
@@ -215,7 +216,12 @@ Symbol::UsageType getSymbolUsageType(std::uint8_t storageClass, std::uint8_t com
  * @param pathToFile Path to input file
  * @param loadFlags Load flags
  */
-CoffFormat::CoffFormat(std::string pathToFile, LoadFlags loadFlags) : FileFormat(pathToFile, loadFlags), fileBuffer(MemoryBuffer::getFile(Twine(pathToFile)))
+CoffFormat::CoffFormat(std::string pathToFile, LoadFlags loadFlags) : FileFormat(pathToFile, loadFlags),
+	// Without the null terminator requirement the file can be mapped into
+	// memory instead of being copied to the heap. This matters for batch
+	// flows (e.g. bin2pat) that open thousands of small objects.
+	fileBuffer(MemoryBuffer::getFile(Twine(pathToFile), -1,
+		/*RequiresNullTerminator=*/false))
 {
 	initStructures();
 }
@@ -308,10 +314,13 @@ void CoffFormat::loadSymbols()
 {
 	auto *table = new SymbolTable();
 	std::size_t index = 0;
+	// allocate all symbols including their control blocks from one arena,
+	// see PeFormat::loadSymbols()
+	retdec::utils::ArenaAllocator<Symbol> symbolAllocator(std::make_shared<retdec::utils::BumpArena>());
 
 	for(const auto &item : file->symbols())
 	{
-		auto symbol = std::make_shared<Symbol>();
+		auto symbol = std::allocate_shared<Symbol>(symbolAllocator);
 		const auto symbolRef = file->getCOFFSymbol(item);
 		StringRef name;
 		if(file->getSymbolName(symbolRef, name))
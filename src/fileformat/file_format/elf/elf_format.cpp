@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <climits>
 #include <map>
 
 #include "retdec/utils/conversion.h"
@@ -983,6 +984,78 @@ void getRelatedRelocationTables(const ELFIO::elfio *file, const ELFIO::section *
 	}
 }
 
+// Type of the GNU hash section (not provided by all versions of ELFIO).
+const Elf_Word SHT_GNU_HASH_SECTION = 0x6ffffff6;
+
+/**
+ * Read one unsigned word from mapped section data
+ * @param data Mapped section data
+ * @param dataSize Size of mapped data
+ * @param offset Offset of word in @a data
+ * @param wordSize Size of word in bytes
+ * @param isBigEndian @c true if words are stored as big endian
+ * @param result Into this parameter the read word is stored
+ * @return @c true if the whole word lies inside @a data, @c false otherwise
+ */
+bool getWordFromSectionData(const char *data, std::size_t dataSize, std::size_t offset,
+	std::size_t wordSize, bool isBigEndian, std::uint64_t &result)
+{
+	if(!data || offset + wordSize > dataSize)
+	{
+		return false;
+	}
+
+	result = 0;
+
+	for(std::size_t i = 0; i < wordSize; ++i)
+	{
+		const auto index = isBigEndian ? offset + i : offset + wordSize - i - 1;
+		result = (result << 8) | static_cast<unsigned char>(data[index]);
+	}
+
+	return true;
+}
+
+/**
+ * Compute hash of symbol name as used in GNU hash sections
+ * @param name Name of symbol
+ * @return Hash of @a name
+ */
+std::uint32_t getGnuSymbolHash(const std::string &name)
+{
+	std::uint32_t hash = 5381;
+
+	for(const unsigned char c : name)
+	{
+		hash = hash * 33 + c;
+	}
+
+	return hash;
+}
+
+/**
+ * Compute hash of symbol name as used in SysV hash sections
+ * @param name Name of symbol
+ * @return Hash of @a name
+ */
+std::uint32_t getElfSymbolHash(const std::string &name)
+{
+	std::uint32_t hash = 0;
+
+	for(const unsigned char c : name)
+	{
+		hash = (hash << 4) + c;
+		const std::uint32_t overflow = hash & 0xF0000000;
+		if(overflow)
+		{
+			hash ^= overflow >> 24;
+		}
+		hash &= ~overflow;
+	}
+
+	return hash;
+}
+
 /**
  * Fix symbol name
  * @param symbolName Name of symbol
@@ -1403,7 +1476,7 @@ ELFIO::section* ElfFormat::addGlobalOffsetTable(ELFIO::section *dynamicSection,
 			{
 				const auto w = std::min<std::size_t>(gotTable->get_size(), seg->get_data_size() - (gotAddr - gotSeg->getAddress()));
 				const auto gotSegOffset = gotAddr - gotSeg->getAddress();
-				if (seg->get_offset() + gotSegOffset + w > bytes.size())
+				if (seg->get_offset() + gotSegOffset + w > getFileLength())
 				{
 					return nullptr;
 				}
@@ -1629,9 +1702,17 @@ void ElfFormat::loadSymbols(const ELFIO::elfio *file, const ELFIO::symbol_sectio
 	std::unordered_multimap<std::string, unsigned long long> importNameAddressMap;
 	loadRelocations(file, section, importNameAddressMap);
 
-	for(std::size_t i = 0, e = elfSymbolTable->get_loaded_symbols_num(); i < e; ++i)
+	// Statically linked binaries may contain hundreds of thousands of
+	// symbols, so we allocate all of them at once in one contiguous arena
+	// and hand out aliasing shared pointers into it. This replaces two heap
+	// allocations per symbol (object and control block) with two per table.
+	const std::size_t numberOfSymbols = elfSymbolTable->get_loaded_symbols_num();
+	auto symbolArena = std::make_shared<std::vector<ElfSymbol>>(numberOfSymbols);
+	symtab->reserve(numberOfSymbols);
+
+	for(std::size_t i = 0; i < numberOfSymbols; ++i)
 	{
-		auto symbol = std::make_shared<ElfSymbol>();
+		auto *symbol = &(*symbolArena)[i];
 		elfSymbolTable->get_symbol(i, name, value, size, bind, type, link, other);
 		size ? symbol->setSize(size) : symbol->invalidateSize();
 		symbol->setType(getSymbolType(bind, type, link));
@@ -1686,7 +1767,7 @@ void ElfFormat::loadSymbols(const ELFIO::elfio *file, const ELFIO::symbol_sectio
 				exportTable->addExport(newExport);
 			}
 		}
-		symtab->addSymbol(std::move(symbol));
+		symtab->addSymbol(std::shared_ptr<Symbol>(symbolArena, symbol));
 	}
 
 	symtab->setName(section->get_name());
@@ -2432,5 +2513,228 @@ unsigned long long ElfFormat::getBaseOffset() const
 	return minOffset == std::numeric_limits<unsigned long long>::max() ? 0 : minOffset;
 }
 
+/**
+ * Look up symbol by name in mapped GNU hash section
+ * @param hashSec GNU hash section from @a reader
+ * @param symTab Loaded symbol table of dynamic symbols covered by @a hashSec
+ * @param name Name of searched symbol
+ * @param symbolIndex Into this parameter the index of found symbol is stored
+ * @return @c true if symbol was found, @c false otherwise
+ *
+ * The lookup walks the section exactly as the dynamic linker does: the Bloom
+ * filter rejects most absent names without touching the buckets, and only
+ * chain entries with a matching hash are compared by name.
+ */
+bool ElfFormat::lookupSymbolInGnuHashTable(const ELFIO::section *hashSec, const SymbolTable &symTab,
+	const std::string &name, std::size_t &symbolIndex) const
+{
+	const auto *data = hashSec->get_data();
+	const std::size_t dataSize = hashSec->get_data_size();
+	const bool bigEndian = isBigEndian();
+	const std::size_t bloomWordSize = (elfClass == ELFCLASS64) ? 8 : 4;
+
+	std::uint64_t noOfBuckets, firstSymbolIndex, bloomSize, bloomShift;
+	if(!getWordFromSectionData(data, dataSize, 0, 4, bigEndian, noOfBuckets)
+		|| !getWordFromSectionData(data, dataSize, 4, 4, bigEndian, firstSymbolIndex)
+		|| !getWordFromSectionData(data, dataSize, 8, 4, bigEndian, bloomSize)
+		|| !getWordFromSectionData(data, dataSize, 12, 4, bigEndian, bloomShift)
+		|| !noOfBuckets || !bloomSize)
+	{
+		return false;
+	}
+
+	const auto hash = getGnuSymbolHash(name);
+	const std::size_t bloomBits = bloomWordSize * CHAR_BIT;
+	std::uint64_t bloomWord;
+	if(!getWordFromSectionData(data, dataSize, 16 + (hash / bloomBits) % bloomSize * bloomWordSize,
+		bloomWordSize, bigEndian, bloomWord))
+	{
+		return false;
+	}
+
+	// Every stored symbol sets two bits derived from its hash, so a missing
+	// bit means the name is definitely not present.
+	const auto bloomMask = (std::uint64_t(1) << (hash % bloomBits))
+		| (std::uint64_t(1) << ((hash >> bloomShift) % bloomBits));
+	if((bloomWord & bloomMask) != bloomMask)
+	{
+		return false;
+	}
+
+	const std::size_t bucketsOffset = 16 + bloomSize * bloomWordSize;
+	const std::size_t chainsOffset = bucketsOffset + noOfBuckets * 4;
+	std::uint64_t current;
+	if(!getWordFromSectionData(data, dataSize, bucketsOffset + (hash % noOfBuckets) * 4, 4, bigEndian, current)
+		|| current < firstSymbolIndex)
+	{
+		return false;
+	}
+
+	for(;; ++current)
+	{
+		std::uint64_t chainValue;
+		if(!getWordFromSectionData(data, dataSize, chainsOffset + (current - firstSymbolIndex) * 4,
+			4, bigEndian, chainValue))
+		{
+			return false;
+		}
+
+		// The lowest bit of a chain entry terminates the chain, so it is
+		// ignored when hashes are compared.
+		if((chainValue | 1) == (hash | 1))
+		{
+			const auto *symbol = symTab.getSymbol(current);
+			if(symbol && symbol->getOriginalName() == name)
+			{
+				symbolIndex = current;
+				return true;
+			}
+		}
+
+		if(chainValue & 1)
+		{
+			return false;
+		}
+	}
+}
+
+/**
+ * Look up symbol by name in mapped SysV hash section
+ * @param hashSec Hash section from @a reader
+ * @param symTab Loaded symbol table of dynamic symbols covered by @a hashSec
+ * @param name Name of searched symbol
+ * @param symbolIndex Into this parameter the index of found symbol is stored
+ * @return @c true if symbol was found, @c false otherwise
+ */
+bool ElfFormat::lookupSymbolInHashTable(const ELFIO::section *hashSec, const SymbolTable &symTab,
+	const std::string &name, std::size_t &symbolIndex) const
+{
+	const auto *data = hashSec->get_data();
+	const std::size_t dataSize = hashSec->get_data_size();
+	const bool bigEndian = isBigEndian();
+
+	std::uint64_t noOfBuckets, noOfChains;
+	if(!getWordFromSectionData(data, dataSize, 0, 4, bigEndian, noOfBuckets)
+		|| !getWordFromSectionData(data, dataSize, 4, 4, bigEndian, noOfChains)
+		|| !noOfBuckets)
+	{
+		return false;
+	}
+
+	const auto hash = getElfSymbolHash(name);
+	std::uint64_t current;
+	if(!getWordFromSectionData(data, dataSize, 8 + (hash % noOfBuckets) * 4, 4, bigEndian, current))
+	{
+		return false;
+	}
+
+	// Corrupted files may contain cyclic chains, so visit every chain entry
+	// at most once.
+	std::uint64_t visited = 0;
+
+	while(current != STN_UNDEF && visited++ < noOfChains)
+	{
+		const auto *symbol = symTab.getSymbol(current);
+		if(symbol && symbol->getOriginalName() == name)
+		{
+			symbolIndex = current;
+			return true;
+		}
+
+		if(!getWordFromSectionData(data, dataSize, 8 + (noOfBuckets + current) * 4, 4, bigEndian, current))
+		{
+			return false;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Look up dynamic symbol by name using hash sections of input file
+ * @param name Name of searched symbol
+ * @return Pointer to found symbol or @c nullptr if symbol was not found
+ *
+ * The lookup is answered directly from the mapped @c .gnu.hash section
+ * (or @c .hash if only that one is present), so no name-lookup index is
+ * built over the dynamic symbol table. The returned symbol comes from the
+ * symbol table loaded from the section the hash section is linked to.
+ */
+const Symbol* ElfFormat::getDynamicSymbol(const std::string &name) const
+{
+	const ELFIO::section *gnuHashSec = nullptr, *hashSec = nullptr;
+
+	for(Elf_Half i = 0, e = reader.sections.size(); i < e; ++i)
+	{
+		const auto *sec = reader.sections[i];
+		if(!sec || sec->get_link() >= e || !reader.sections[sec->get_link()])
+		{
+			continue;
+		}
+		else if(sec->get_type() == SHT_GNU_HASH_SECTION && !gnuHashSec)
+		{
+			gnuHashSec = sec;
+		}
+		else if(sec->get_type() == SHT_HASH && !hashSec)
+		{
+			hashSec = sec;
+		}
+	}
+
+	// The GNU hash section is preferred because its Bloom filter rejects
+	// most absent names without walking any chain.
+	const auto *usedSec = gnuHashSec ? gnuHashSec : hashSec;
+	if(!usedSec)
+	{
+		return nullptr;
+	}
+
+	const SymbolTable *symTab = nullptr;
+	const auto linkedSecName = reader.sections[usedSec->get_link()]->get_name();
+	for(const auto *table : symbolTables)
+	{
+		if(table->getName() == linkedSecName)
+		{
+			symTab = table;
+			break;
+		}
+	}
+	if(!symTab)
+	{
+		return nullptr;
+	}
+
+	std::size_t symbolIndex = 0;
+	if(usedSec == gnuHashSec
+		? lookupSymbolInGnuHashTable(usedSec, *symTab, name, symbolIndex)
+		: lookupSymbolInHashTable(usedSec, *symTab, name, symbolIndex))
+	{
+		return symTab->getSymbol(symbolIndex);
+	}
+
+	return nullptr;
+}
+
+/**
+ * Find symbol with name @a name
+ * @param name Name of symbol
+ * @return Pointer to symbol or @c nullptr if symbol was not found
+ *
+ * Dynamic symbols are answered from the mapped hash sections first, so the
+ * common lookups of exported names do not force construction of a name
+ * index over every loaded symbol table. Names which the hash sections do
+ * not cover (symbols from other tables or names changed by fixSymbolName())
+ * fall back to the generic lookup.
+ */
+const Symbol* ElfFormat::getSymbol(const std::string &name) const
+{
+	if(const auto *symbol = getDynamicSymbol(name))
+	{
+		return symbol;
+	}
+
+	return FileFormat::getSymbol(name);
+}
+
 } // namespace fileformat
 } // namespace retdec
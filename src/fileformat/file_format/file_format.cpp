@@ -16,6 +16,7 @@
 
 #include "retdec/crypto/crypto.h"
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/instrumentation.h"
 #include "retdec/utils/file_io.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
@@ -23,6 +24,7 @@
 #include "retdec/fileformat/file_format/intel_hex/intel_hex_format.h"
 #include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
 #include "retdec/fileformat/types/strings/character_iterator.h"
+#include "retdec/fileformat/types/strings/string_scanner.h"
 #include "retdec/fileformat/utils/conversions.h"
 #include "retdec/fileformat/utils/file_io.h"
 #include "retdec/fileformat/utils/other.h"
@@ -131,6 +133,10 @@ FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) : loadedB
 FileFormat::FileFormat(std::string pathToFile, LoadFlags loadFlags) : loadedBytes(&bytes),
 	loadFlags(loadFlags), filePath(pathToFile), fileStream(auxStream)
 {
+	if(loadFlags & LoadFlags::MAP_INPUT_FILE)
+	{
+		mappedFile.map(filePath);
+	}
 	auxStream.open(filePath, std::ifstream::binary);
 	stateIsValid = auxStream.is_open();
 	init();
@@ -149,6 +155,8 @@ FileFormat::~FileFormat()
  */
 void FileFormat::init()
 {
+	retdec::utils::instrumentation::ScopedPhase phase("fileformat/load");
+
 	importTable = nullptr;
 	exportTable = nullptr;
 	resourceTable = nullptr;
@@ -157,7 +165,14 @@ void FileFormat::init()
 	pdbInfo = nullptr;
 	certificateTable = nullptr;
 	fileFormat = Format::UNDETECTABLE;
-	stateIsValid = readFile(fileStream, bytes) && stateIsValid;
+	if(!mappedFile.isMapped())
+	{
+		// Without a memory mapping, the content of the file has to be copied
+		// into @c bytes. With one, the content is served directly from the
+		// mapping and is copied out lazily, only when someone asks for the
+		// owned vector (see materializeBytes()).
+		stateIsValid = readFile(fileStream, bytes) && stateIsValid;
+	}
 	if (getLoadFlags() & LoadFlags::NO_FILE_HASHES)
 	{
 		crc32.clear();
@@ -166,9 +181,11 @@ void FileFormat::init()
 	}
 	else
 	{
-		crc32 = retdec::crypto::getCrc32(bytes.data(), bytes.size());
-		md5 = retdec::crypto::getMd5(bytes.data(), bytes.size());
-		sha256 = retdec::crypto::getSha256(bytes.data(), bytes.size());
+		// The hash pass streams through the whole file once, the parsers
+		// afterwards jump around in it.
+		mappedFile.advise(retdec::utils::MemoryMappedFile::AccessPattern::Sequential);
+		retdec::crypto::getCrc32Md5Sha256(getBytesData(), getFileLength(), crc32, md5, sha256);
+		mappedFile.advise(retdec::utils::MemoryMappedFile::AccessPattern::Random);
 	}
 	initStream();
 }
@@ -182,6 +199,21 @@ void FileFormat::initStream()
 	fileStream.seekg(0);
 }
 
+/**
+ * Copy the content of the memory-mapped input file into member @c bytes
+ *
+ * The copy is made at most once and only when the input file is memory-mapped.
+ * Otherwise, @c bytes own the content already and the method does nothing.
+ * It has to be called before anything hands out a reference to @c bytes.
+ */
+void FileFormat::materializeBytes() const
+{
+	if(mappedFile.isMapped() && bytes.size() != mappedFile.getSize())
+	{
+		bytes.assign(mappedFile.getData(), mappedFile.getData() + mappedFile.getSize());
+	}
+}
+
 /**
  * Provides architecture information for formats which do not store such information eg. Intel HEX
  * @param derivedPtr Pointer to derived FileFormat class
@@ -278,6 +310,46 @@ void FileFormat::clear()
 	dynamicTables.clear();
 }
 
+/**
+ * Load the rich header if the format parses it lazily
+ *
+ * The default implementation does nothing -- formats without lazy parsing
+ * load everything upfront.
+ */
+void FileFormat::loadRichHeaderOnDemand() const
+{
+}
+
+/**
+ * Load the PDB debug information if the format parses it lazily
+ *
+ * The default implementation does nothing -- formats without lazy parsing
+ * load everything upfront.
+ */
+void FileFormat::loadPdbInfoOnDemand() const
+{
+}
+
+/**
+ * Load the resources if the format parses them lazily
+ *
+ * The default implementation does nothing -- formats without lazy parsing
+ * load everything upfront.
+ */
+void FileFormat::loadResourcesOnDemand() const
+{
+}
+
+/**
+ * Load the certificates if the format parses them lazily
+ *
+ * The default implementation does nothing -- formats without lazy parsing
+ * load everything upfront.
+ */
+void FileFormat::loadCertificatesOnDemand() const
+{
+}
+
 /**
  * Compute hashes of section table. This method must be called after
  * sections are loaded.
@@ -326,9 +398,8 @@ void FileFormat::computeSectionTableHashes()
 
 	if(!data.empty())
 	{
-		sectionCrc32 = retdec::crypto::getCrc32(data.data(), data.size());
-		sectionMd5 = retdec::crypto::getMd5(data.data(), data.size());
-		sectionSha256 = retdec::crypto::getSha256(data.data(), data.size());
+		retdec::crypto::getCrc32Md5Sha256(data.data(), data.size(),
+			sectionCrc32, sectionMd5, sectionSha256);
 	}
 }
 
@@ -423,24 +494,27 @@ void FileFormat::loadStrings(StringType type, std::size_t charSize)
 void FileFormat::loadStrings(StringType type, std::size_t charSize, const SecSeg* secSeg)
 {
 	CharacterEndianness endian = isLittleEndian() ? CharacterEndianness::Little : CharacterEndianness::Big;
+	const auto secSegBytes = secSeg->getBytes();
+	const auto* data = reinterpret_cast<const unsigned char*>(secSegBytes.data());
+	const std::size_t size = secSegBytes.size();
+	std::string str;
 
-	for (auto begin = secSeg->getBytes().begin(), end = secSeg->getBytes().end(), itr = begin; itr != end;)
+	for (auto pos = findNextCharacterStart(data, size, 0, charSize, endian); pos < size;
+		pos = findNextCharacterStart(data, size, pos, charSize, endian))
 	{
-		if (makeCharacterIterator(itr, begin, end, charSize).pointsToValidCharacter(endian))
+		const auto runEnd = findCharacterRunEnd(data, size, pos, charSize, endian);
+		const auto runLength = (runEnd - pos) / charSize;
+		if (runLength >= DefaultMinStringLength)
 		{
-			auto stringBeginItr = makeCharacterIterator(itr, begin, end, charSize);
-			auto stringDataEndItr = makeCharacterIterator(end, begin, end, charSize);
-			auto stringEndItr = stringBeginItr + 1;
-			while (stringEndItr != stringDataEndItr && stringEndItr.pointsToValidCharacter(endian))
-				++stringEndItr;
-
-			if (static_cast<std::size_t>(stringEndItr - stringBeginItr) >= DefaultMinStringLength)
-				strings.emplace_back(type, secSeg->getOffset() + (itr - begin), secSeg->getName(), std::string{stringBeginItr, stringEndItr});
+			str.clear();
+			str.reserve(runLength);
+			for (std::size_t i = 0; i < runLength; ++i)
+				str.push_back(static_cast<char>(data[pos + i * charSize]));
 
-			itr = stringEndItr.getUnderlyingIterator();
+			strings.emplace_back(type, secSeg->getOffset() + pos, secSeg->getName(), str);
 		}
-		else
-			++itr;
+
+		pos = runEnd;
 	}
 }
 
@@ -1030,7 +1104,7 @@ std::size_t FileFormat::getNumberOfDynamicTables() const
  */
 std::size_t FileFormat::getFileLength() const
 {
-	return bytes.size();
+	return mappedFile.isMapped() ? mappedFile.getSize() : bytes.size();
 }
 
 /**
@@ -1039,7 +1113,7 @@ std::size_t FileFormat::getFileLength() const
  */
 std::size_t FileFormat::getLoadedFileLength() const
 {
-	return loadedBytes->size();
+	return loadedBytes == &bytes ? getFileLength() : loadedBytes->size();
 }
 
 /**
@@ -1141,9 +1215,8 @@ bool FileFormat::getBytes(std::vector<std::uint8_t> &result, unsigned long long
 	}
 
 	numberOfBytes = offset + numberOfBytes > getLoadedFileLength() ? getLoadedFileLength() - offset : numberOfBytes;
-	result.clear();
-	result.reserve(numberOfBytes);
-	std::copy(loadedBytes->begin() + offset, loadedBytes->begin() + offset + numberOfBytes, std::back_inserter(result));
+	const auto *data = getLoadedBytesData();
+	result.assign(data + offset, data + offset + numberOfBytes);
 	return true;
 }
 
@@ -1179,7 +1252,7 @@ bool FileFormat::getEpBytes(std::vector<std::uint8_t> &result, unsigned long lon
  */
 bool FileFormat::getHexBytes(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToHexString(*loadedBytes, result, offset, numberOfBytes);
+	bytesToHexString(getLoadedBytesData(), getLoadedFileLength(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1230,7 +1303,7 @@ bool FileFormat::getHexBytesFromEnd(std::string &result, unsigned long long numb
  */
 bool FileFormat::getString(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToString(*loadedBytes, result, offset, numberOfBytes);
+	bytesToString(getLoadedBytesData(), getLoadedFileLength(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1248,6 +1321,29 @@ bool FileFormat::getStringFromEnd(std::string &result, unsigned long long number
 	return getString(result, getLoadedFileLength() - numberOfBytes, numberOfBytes);
 }
 
+/**
+ * Get reference to bytes from specified offset
+ * @param offset Start offset of the area (in bytes)
+ * @param numberOfBytes Number of bytes to get. If this parameter is set to
+ *    zero, method returns all bytes from @a offset until end of loaded content.
+ * @return Reference to the requested bytes, or reference to an empty string
+ *    if @a offset is out of the loaded content
+ *
+ * Unlike @a getBytes() or @a getString(), no copy of the content is made. The
+ * returned reference is valid as long as this instance of class exists.
+ */
+const llvm::StringRef FileFormat::getLoadedBytes(unsigned long long offset, unsigned long long numberOfBytes) const
+{
+	if(offset >= getLoadedFileLength())
+	{
+		return llvm::StringRef("");
+	}
+
+	return llvm::StringRef(
+			reinterpret_cast<const char*>(getLoadedBytesData()) + offset,
+			getRealSizeInRegion(offset, numberOfBytes, getLoadedFileLength()));
+}
+
 /**
  * Get information about section containing entry point
  * @return Pointer to EP section if file has entry point and EP section was detected, @c nullptr otherwise
@@ -1470,6 +1566,7 @@ const ExportTable* FileFormat::getExportTable() const
  */
 const ResourceTable* FileFormat::getResourceTable() const
 {
+	loadResourcesOnDemand();
 	return resourceTable;
 }
 
@@ -1479,6 +1576,7 @@ const ResourceTable* FileFormat::getResourceTable() const
  */
 const ResourceTree* FileFormat::getResourceTree() const
 {
+	loadResourcesOnDemand();
 	return resourceTree;
 }
 
@@ -1488,6 +1586,7 @@ const ResourceTree* FileFormat::getResourceTree() const
  */
 const RichHeader* FileFormat::getRichHeader() const
 {
+	loadRichHeaderOnDemand();
 	return richHeader;
 }
 
@@ -1497,6 +1596,7 @@ const RichHeader* FileFormat::getRichHeader() const
  */
 const PdbInfo* FileFormat::getPdbInfo() const
 {
+	loadPdbInfoOnDemand();
 	return pdbInfo;
 }
 
@@ -1506,6 +1606,7 @@ const PdbInfo* FileFormat::getPdbInfo() const
  */
 const CertificateTable* FileFormat::getCertificateTable() const
 {
+	loadCertificatesOnDemand();
 	return certificateTable;
 }
 
@@ -1643,6 +1744,7 @@ const Export* FileFormat::getExport(unsigned long long address) const
  */
 const Resource* FileFormat::getManifestResource() const
 {
+	loadResourcesOnDemand();
 	return resourceTable ? resourceTable->getResourceWithType(PELIB_RT_MANIFEST) : nullptr;
 }
 
@@ -1652,6 +1754,7 @@ const Resource* FileFormat::getManifestResource() const
  */
 const Resource* FileFormat::getVersionResource() const
 {
+	loadResourcesOnDemand();
 	return resourceTable ? resourceTable->getResourceWithType(PELIB_RT_VERSION) : nullptr;
 }
 
@@ -1661,6 +1764,7 @@ const Resource* FileFormat::getVersionResource() const
  */
 bool FileFormat::isSignaturePresent() const
 {
+	loadCertificatesOnDemand();
 	return signatureVerified.isDefined();
 }
 
@@ -1670,6 +1774,7 @@ bool FileFormat::isSignaturePresent() const
  */
 bool FileFormat::isSignatureVerified() const
 {
+	loadCertificatesOnDemand();
 	return signatureVerified.isDefined() && signatureVerified.getValue();
 }
 
@@ -1783,6 +1888,7 @@ const std::vector<DynamicTable*>& FileFormat::getDynamicTables() const
  */
 const std::vector<unsigned char>& FileFormat::getBytes() const
 {
+	materializeBytes();
 	return bytes;
 }
 
@@ -1792,6 +1898,10 @@ const std::vector<unsigned char>& FileFormat::getBytes() const
  */
 const std::vector<unsigned char>& FileFormat::getLoadedBytes() const
 {
+	if(loadedBytes == &bytes)
+	{
+		materializeBytes();
+	}
 	return *loadedBytes;
 }
 
@@ -1801,7 +1911,7 @@ const std::vector<unsigned char>& FileFormat::getLoadedBytes() const
  */
 const unsigned char* FileFormat::getBytesData() const
 {
-	return bytes.data();
+	return mappedFile.isMapped() ? mappedFile.getData() : bytes.data();
 }
 
 /**
@@ -1810,7 +1920,7 @@ const unsigned char* FileFormat::getBytesData() const
  */
 const unsigned char* FileFormat::getLoadedBytesData() const
 {
-	return loadedBytes->data();
+	return loadedBytes == &bytes ? getBytesData() : loadedBytes->data();
 }
 
 /**
@@ -1851,7 +1961,7 @@ bool FileFormat::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t
 	const auto secOffset = address - secSeg->getAddress();
 	const auto offset = secSeg->getOffset() + secOffset;
 	return (secOffset + x > secSeg->getLoadedSize() || offset + x > getLoadedFileLength()) ?
-		false : createValueFromBytes(*loadedBytes, res, e, offset, x);
+		false : createValueFromBytes(getLoadedBytesData(), getLoadedFileLength(), res, e, offset, x);
 }
 
 /**
@@ -1981,7 +2091,7 @@ bool FileFormat::getXByteOffset(std::uint64_t offset, std::uint64_t x, std::uint
 		return true;
 	}
 
-	return createValueFromBytes(*loadedBytes, res, e, offset, x);
+	return createValueFromBytes(getLoadedBytesData(), getLoadedFileLength(), res, e, offset, x);
 }
 
 /**
@@ -1996,7 +2106,8 @@ bool FileFormat::getXBytesOffset(std::uint64_t offset, std::uint64_t x, std::vec
 	res.clear();
 	if(offset + x <= getLoadedFileLength())
 	{
-		res.assign(loadedBytes->begin() + offset, loadedBytes->begin() + offset + x);
+		const auto *data = getLoadedBytesData();
+		res.assign(data + offset, data + offset + x);
 		return res.size() == x;
 	}
 
@@ -2486,6 +2597,7 @@ void FileFormat::dumpResourceTree()
 
 void FileFormat::dumpResourceTree(std::string &dumpStr)
 {
+	loadResourcesOnDemand();
 	if(!resourceTree)
 	{
 		dumpStr.clear();
@@ -72,6 +72,11 @@ bool IntelHexParser::parse()
 	index = 0;
 	IntelHexToken token;
 
+	// Preallocate from the tokenizer's structural scan. The buffer is
+	// cleared, not shrunk, when a new section starts, so no data record
+	// can trigger a reallocation.
+	actualSection.data.reserve(tokenizer.getDataByteCount());
+
 	while(true)
 	{
 		token = tokenizer.getToken();
@@ -128,20 +133,7 @@ void IntelHexParser::handleData(const IntelHexToken &token)
 	}
 
 	const int diff = address - (actualAddress - 1);
-	if(diff == 1)
-	{
-		// Still the same section
-		for(std::vector<int>::size_type i = 0; i < token.data.size(); i += 2)
-		{
-			// Size of vector is always even
-			std::string tmp;
-			tmp.push_back(token.data[i]);
-			tmp.push_back(token.data[i+1]);
-			actualSection.data.push_back(IntelHexParser::strToInt(tmp));
-			actualAddress += 1;
-		}
-	}
-	else
+	if(diff != 1)
 	{
 		// New section
 		if(actualAddress)
@@ -154,15 +146,15 @@ void IntelHexParser::handleData(const IntelHexToken &token)
 		actualSection.address = address;
 		actualSection.index = index;
 		actualSection.data.clear();
+	}
 
-		for(std::vector<int>::size_type i = 0; i < token.data.size(); i += 2)
-		{
-			std::string tmp;
-			tmp.push_back(token.data[i]);
-			tmp.push_back(token.data[i+1]);
-			actualSection.data.push_back(IntelHexParser::strToInt(tmp));
-			actualAddress += 1;
-		}
+	// Data digits were already validated by the tokenizer.
+	for(std::string::size_type i = 0; i < token.data.size(); i += 2)
+	{
+		// Size of vector is always even
+		actualSection.data.push_back(
+				(hexDigit(token.data[i]) << 4) | hexDigit(token.data[i + 1]));
+		actualAddress += 1;
 	}
 }
 
@@ -340,10 +332,40 @@ std::vector<IntelHexSection> IntelHexParser::getSectionsByAlignment(unsigned lon
 unsigned long long IntelHexParser::strToInt(const std::string &str)
 {
 	unsigned long long res = 0;
-	strToNum(str, res, std::hex);
+	for(char c : str)
+	{
+		const int digit = hexDigit(c);
+		if(digit < 0)
+		{
+			break;
+		}
+		res = (res << 4) | digit;
+	}
 	return res;
 }
 
+/**
+ * Converts hexadecimal digit to its value
+ * @param c Character to convert
+ * @return Value of @a c, or @c -1 if @a c is not a hexadecimal digit
+ */
+int IntelHexParser::hexDigit(char c)
+{
+	if(c >= '0' && c <= '9')
+	{
+		return c - '0';
+	}
+	if(c >= 'a' && c <= 'f')
+	{
+		return c - 'a' + 10;
+	}
+	if(c >= 'A' && c <= 'F')
+	{
+		return c - 'A' + 10;
+	}
+	return -1;
+}
+
 /**
  * Checks whether character is hexadecimal digit
  * @param c Character to check
@@ -351,9 +373,7 @@ unsigned long long IntelHexParser::strToInt(const std::string &str)
  */
 bool IntelHexParser::isHexadec(char c)
 {
-	return ((c >= '0' && c <= '9') ||
-		(c >= 'a' && c <= 'f') ||
-		(c >= 'A' && c <= 'F'));
+	return hexDigit(c) >= 0;
 }
 
 /**
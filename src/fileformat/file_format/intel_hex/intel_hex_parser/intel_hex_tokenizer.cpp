@@ -5,6 +5,7 @@
  */
 
 #include <cassert>
+#include <iterator>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/fileformat/file_format/intel_hex/intel_hex_parser/intel_hex_parser.h"
@@ -88,20 +89,72 @@ IntelHexTokenizer::~IntelHexTokenizer()
 }
 
 /**
- * Reads @a n characters from source
- * @param n Number of characters to read
- * @return String that was read
+ * Reads one data byte (two hexadecimal digits) from the buffered content
+ * @return Value of the byte, or @c -1 on invalid digit or end of content
+ *
+ * Position is advanced only on success.
  */
-std::string IntelHexTokenizer::readN(unsigned n)
+int IntelHexTokenizer::readByte()
 {
-	std::string result;
+	if(pos + 2 > content.size())
+	{
+		return -1;
+	}
 
-	for(unsigned i = 0; i < n; ++i)
+	const int hi = IntelHexParser::hexDigit(content[pos]);
+	const int lo = IntelHexParser::hexDigit(content[pos + 1]);
+	if(hi < 0 || lo < 0)
 	{
-		result += source->get();
+		return -1;
 	}
 
-	return result;
+	pos += 2;
+	return (hi << 4) | lo;
+}
+
+
+/**
+ * Structural scan of the buffered content (phase one of parsing)
+ *
+ * Walks the record skeletons only - byte counts and record types - without
+ * decoding data or checksums, and counts the total number of data bytes so
+ * the parser can preallocate section storage. The scan stops at the first
+ * anomaly; exact errors are reported later during tokenization.
+ */
+void IntelHexTokenizer::scanContent()
+{
+	dataBytes = 0;
+
+	std::string::size_type p = 0;
+	while(p < content.size() && content[p] == ':')
+	{
+		if(p + 9 > content.size())
+		{
+			return;
+		}
+
+		const int hi = IntelHexParser::hexDigit(content[p + 1]);
+		const int lo = IntelHexParser::hexDigit(content[p + 2]);
+		if(hi < 0 || lo < 0)
+		{
+			return;
+		}
+		const std::string::size_type byteCount = (hi << 4) | lo;
+
+		// Record type is stored behind the four address digits.
+		if(content[p + 7] == '0' && content[p + 8] == '0')
+		{
+			dataBytes += byteCount;
+		}
+
+		// Colon + byte count + address + record type + data + checksum.
+		p += 1 + 2 + 4 + 2 + 2 * byteCount + 2;
+		while(p < content.size()
+				&& (content[p] == '\r' || content[p] == '\n'))
+		{
+			++p;
+		}
+	}
 }
 
 /**
@@ -120,49 +173,83 @@ IntelHexToken IntelHexTokenizer::makeErrorToken(const std::string &errorMessage)
 /**
  * Get next token
  * @return Next token
+ *
+ * Reads from the buffered content (phase two of parsing). The checksum sum
+ * is accumulated while the data digits are validated, so every record is
+ * walked just once.
  */
 IntelHexToken IntelHexTokenizer::getToken()
 {
 	IntelHexToken token;
 	// Starting colon
-	char c = source->get();
-	if(c != ':')
+	if(pos >= content.size() || content[pos] != ':')
 	{
 		return makeErrorToken("Starting semicolon missing.");
 	}
+	++pos;
 
 	// Byte count
-	std::string tmp_str = readN(2);
-	if(!strToNum(tmp_str, token.byteCount, std::hex))
+	const int byteCount = readByte();
+	if(byteCount < 0)
 	{
 		return makeErrorToken("Invalid byte count sequence.");
 	}
+	token.byteCount = byteCount;
 
 	// Address
-	token.address = readN(4);
+	if(pos + 4 > content.size())
+	{
+		return makeErrorToken("Invalid address sequence.");
+	}
+	token.address.assign(content, pos, 4);
 	if(!IntelHexParser::isHexadec(token.address))
 	{
 		return makeErrorToken("Invalid address sequence.");
 	}
+	pos += 4;
 
 	// Record type
-	tmp_str = readN(2);
+	const int recordType = readByte();
 	// Max. type number is 5
-	if(!strToNum(tmp_str, token.recordType, std::hex) || token.recordType > 5)
+	if(recordType < 0 || recordType > 5)
 	{
 		return makeErrorToken("Invalid record type sequence.");
 	}
+	token.recordType = recordType;
+
+	int csum = byteCount + recordType;
+	csum += (IntelHexParser::hexDigit(token.address[0]) << 4)
+			| IntelHexParser::hexDigit(token.address[1]);
+	csum += (IntelHexParser::hexDigit(token.address[2]) << 4)
+			| IntelHexParser::hexDigit(token.address[3]);
 
-	// Data
-	token.data = readN(2 * token.byteCount);
-	if(!IntelHexParser::isHexadec(token.data))
+	// Data - validated and summed for the checksum in one pass
+	const std::string::size_type dataLen = 2 * token.byteCount;
+	if(pos + dataLen > content.size())
 	{
 		return makeErrorToken("Invalid data sequence.");
 	}
+	token.data.assign(content, pos, dataLen);
+	for(std::string::size_type i = 0; i < dataLen; i += 2)
+	{
+		const int hi = IntelHexParser::hexDigit(token.data[i]);
+		const int lo = IntelHexParser::hexDigit(token.data[i + 1]);
+		if(hi < 0 || lo < 0)
+		{
+			return makeErrorToken("Invalid data sequence.");
+		}
+		csum += (hi << 4) | lo;
+	}
+	pos += dataLen;
 
 	// Checksum
-	token.checksum = readN(2);
-	token.controlChecksum();
+	const int checksum = readByte();
+	if(checksum < 0)
+	{
+		return makeErrorToken("Invalid checksum.");
+	}
+	token.checksum.assign(content, pos - 2, 2);
+	token.checksumValid = (((0 - csum) & 0x0FF) == checksum);
 	if(!token.checksumValid)
 	{
 		return makeErrorToken("Invalid checksum.");
@@ -171,15 +258,20 @@ IntelHexToken IntelHexTokenizer::getToken()
 	// Newline delimiters
 	while(token.recordType != IntelHexToken::REC_TYPE::RT_EOFILE)
 	{
-		char c = source->get();
+		if(pos >= content.size())
+		{
+			// Error
+			return makeErrorToken("Invalid newline sequence.");
+		}
+
+		const char c = content[pos];
 		if(c == '\r' || c == '\n')
 		{
-			continue;
+			++pos;
 		}
 		else if(c == ':')
 		{
-			// New record
-			source->unget();
+			// New record - do not consume the colon
 			break;
 		}
 		else
@@ -192,6 +284,16 @@ IntelHexToken IntelHexTokenizer::getToken()
 	return token;
 }
 
+
+/**
+ * Get total number of data bytes found by the structural scan
+ * @return Number of data bytes in all data records
+ */
+std::size_t IntelHexTokenizer::getDataByteCount() const
+{
+	return dataBytes;
+}
+
 /**
  * Opens the file to analyze
  * @param pathToFile Path to input file
@@ -207,6 +309,9 @@ bool IntelHexTokenizer::openFile(const std::string &pathToFile)
  * Sets input stream to find tokens in
  * @param inputStream Reference to std::istream
  * @return True on success, false otherwise
+ *
+ * The whole stream is read into one contiguous buffer and scanned
+ * structurally, so tokenization afterwards does not touch the stream.
  */
 bool IntelHexTokenizer::setInputStream(std::istream &inputStream)
 {
@@ -215,7 +320,11 @@ bool IntelHexTokenizer::setInputStream(std::istream &inputStream)
 		return false;
 	}
 
-	source = &inputStream;
+	content.assign(
+			std::istreambuf_iterator<char>(inputStream),
+			std::istreambuf_iterator<char>());
+	pos = 0;
+	scanContent();
 	return true;
 }
 
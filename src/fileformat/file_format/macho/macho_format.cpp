@@ -5,6 +5,7 @@
  */
 
 #include <system_error>
+#include <thread>
 
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
@@ -122,7 +123,7 @@ bool MachOFormat::chooseArchitecture(const llvm::object::MachOUniversalBinary::o
 
 		chosenArchOffset = itr->getOffset();
 		chosenArchSize = itr->getSize();
-		chosenArchBytes.assign(getLoadedBytes().begin() + chosenArchOffset, getLoadedBytes().begin() + chosenArchOffset + chosenArchSize);
+		chosenArchBytes.assign(getLoadedBytesData() + chosenArchOffset, getLoadedBytesData() + chosenArchOffset + chosenArchSize);
 		return true;
 	}
 
@@ -693,11 +694,13 @@ void MachOFormat::loadDylibCommand(const llvm::object::MachOObjectFile::LoadComm
 }
 
 /**
- * Load symbol table
+ * Parse raw entries of the symbol table into @c symbols
+ *
+ * Only the file content is read, so this can run on a background thread
+ * while other load commands are processed (see loadCommands()).
  */
-void MachOFormat::symtabCommand()
+void MachOFormat::parseSymbolEntries()
 {
-	auto *symbolTable = new SymbolTable();
 	auto command = file->getSymtabLoadCommand();
 	const char *strPtr = fileBuffer.get()->getBufferStart() + command.stroff + chosenArchOffset;
 	const char *endPtr = chosenArchSize ? fileBuffer.get()->getBufferStart() + chosenArchOffset + chosenArchSize : fileBuffer.get()->getBufferEnd();
@@ -727,7 +730,6 @@ void MachOFormat::symtabCommand()
 			}
 			ptr += sizeof(MachO::nlist);
 			machoSymbol.setAllValues(res, strTable, i);
-			symbols.push_back(machoSymbol);
 		}
 		else
 		{
@@ -744,9 +746,29 @@ void MachOFormat::symtabCommand()
 			}
 			ptr += sizeof(MachO::nlist_64);
 			machoSymbol.setAllValues(res, strTable, i);
-			symbols.push_back(machoSymbol);
 		}
 
+		symbols.push_back(machoSymbol);
+	}
+}
+
+/**
+ * Load symbol table
+ *
+ * Expects @c symbols to be already filled by parseSymbolEntries(). Unlike the
+ * raw parsing, this needs the sections loaded by the preceding load commands
+ * (function detection looks the symbol's section up).
+ */
+void MachOFormat::symtabCommand()
+{
+	if(symbols.empty())
+	{
+		return;
+	}
+
+	auto *symbolTable = new SymbolTable();
+	for(auto &machoSymbol : symbols)
+	{
 		machoSymbol.makeFunction(this);
 		symbolTable->addSymbol(machoSymbol.getAsSymbol());
 	}
@@ -755,6 +777,10 @@ void MachOFormat::symtabCommand()
 	{
 		symbolTables.push_back(symbolTable);
 	}
+	else
+	{
+		delete symbolTable;
+	}
 }
 
 /**
@@ -1024,6 +1050,20 @@ std::uint32_t MachOFormat::getFirstCommandOffset() const
  */
 void MachOFormat::loadCommands()
 {
+	// The raw symbol entries depend only on the file content, so parse them
+	// on a background thread while the other commands are processed. The
+	// LC_SYMTAB handler below joins the thread and only finishes the symbols,
+	// because that part needs the sections loaded by the preceding commands.
+	std::thread symbolsThread;
+	for(const auto &command : file->load_commands())
+	{
+		if(command.C.cmd == MachO::LC_SYMTAB)
+		{
+			symbolsThread = std::thread([this] { parseSymbolEntries(); });
+			break;
+		}
+	}
+
 	for(const auto &command : file->load_commands())
 	{
 		switch(command.C.cmd)
@@ -1045,6 +1085,10 @@ void MachOFormat::loadCommands()
 				break;
 
 			case MachO::LC_SYMTAB:
+				if(symbolsThread.joinable())
+				{
+					symbolsThread.join();
+				}
 				symtabCommand();
 				break;
 
@@ -1068,6 +1112,11 @@ void MachOFormat::loadCommands()
 				break;
 		}
 	}
+
+	if(symbolsThread.joinable())
+	{
+		symbolsThread.join();
+	}
 }
 
 void MachOFormat::dumpCommands(std::ostream &outStream)
@@ -14,6 +14,7 @@
 #include <openssl/asn1.h>
 #include <openssl/x509.h>
 
+#include "retdec/utils/allocator.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/scope_exit.h"
@@ -301,6 +302,12 @@ PeFormat::PeFormat(std::string pathToFile, LoadFlags loadFlags) : FileFormat(pat
  */
 PeFormat::~PeFormat()
 {
+	// The asynchronously started certificate processing uses this object, so
+	// it must finish before anything is torn down.
+	if(certificatesFuture.valid())
+	{
+		certificatesFuture.wait();
+	}
 	delete file;
 	delete formatParser;
 }
@@ -314,6 +321,13 @@ void PeFormat::initStructures()
 	peHeader32 = nullptr;
 	peHeader64 = nullptr;
 	peClass = PEFILE_UNKNOWN;
+	richHeaderLoaded = false;
+	pdbInfoLoaded = false;
+	resourcesLoaded = false;
+	certificatesLoaded = false;
+	dotnetHeadersLoaded = false;
+	dotnetStreamsLoaded = false;
+	metadataHeaderAddress = 0;
 	file = openPeFile(filePath);
 	if(file)
 	{
@@ -375,17 +389,36 @@ void PeFormat::initStructures()
 	if(stateIsValid)
 	{
 		fileFormat = Format::PE;
-		loadRichHeader();
 		loadSections();
 		loadSymbols();
 		loadImports();
 		loadExports();
-		loadPdbInfo();
-		loadResources();
-		loadCertificates();
-		loadDotnetHeaders();
+		// The rich header, PDB info, resources, certificates, and .NET
+		// headers are parsed lazily, on first access of the corresponding
+		// structure (see the *OnDemand() methods). Only the address ranges
+		// occupied by the debug and resource directories are registered now
+		// so instruction decoding does not depend on the lazy parsing.
+		for (auto&& addressRange : formatParser->getDebugDirectoryOccupiedAddresses())
+		{
+			nonDecodableRanges.addRange(std::move(addressRange));
+		}
+		for (auto&& addressRange : formatParser->getResourceDirectoryOccupiedAddresses())
+		{
+			nonDecodableRanges.addRange(std::move(addressRange));
+		}
 		computeSectionTableHashes();
 		loadStrings();
+
+		if(getLoadFlags() & LoadFlags::ASYNC_CERTIFICATES)
+		{
+			// Consumers that know they will present certificates (fileinfo)
+			// can have the crypto-heavy processing run in the background
+			// while they analyze the rest of the file; the task is joined on
+			// the first access to the certificate table. The task touches
+			// only the certificate-related state.
+			certificatesFuture = std::async(std::launch::async,
+					[this] { loadCertificates(); });
+		}
 	}
 }
 
@@ -496,7 +529,7 @@ void PeFormat::loadRichHeader()
 	}
 
 	std::string plainText;
-	bytesToString(bytes, plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
+	bytesToString(getBytesData(), getFileLength(), plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
 	auto offset = getRichHeaderOffset(plainText);
 	auto standardOffset = (offset == STANDARD_RICH_HEADER_OFFSET);
 	if(offset >= getPeHeaderOffset())
@@ -607,10 +640,15 @@ void PeFormat::loadSymbols()
 {
 	const auto symTab = file->coffSymTab();
 	auto *table = new SymbolTable();
+	// allocate all symbols including their control blocks from one arena,
+	// the arena is kept alive by the allocator copies inside the control
+	// blocks for as long as any symbol exists
+	retdec::utils::ArenaAllocator<Symbol> symbolAllocator(std::make_shared<retdec::utils::BumpArena>());
+	table->reserve(symTab.getNumberOfStoredSymbols());
 
 	for(std::size_t i = 0, e = symTab.getNumberOfStoredSymbols(); i < e; ++i)
 	{
-		auto symbol = std::make_shared<Symbol>();
+		auto symbol = std::allocate_shared<Symbol>(symbolAllocator);
 		const word link = symTab.getSymbolSectionNumber(i);
 		if(!link || link == std::numeric_limits<word>::max() || link == std::numeric_limits<word>::max() - 1)
 		{
@@ -792,11 +830,6 @@ void PeFormat::loadPdbInfo()
 		}
 		break;
 	}
-
-	for (auto&& addressRange : formatParser->getDebugDirectoryOccupiedAddresses())
-	{
-		nonDecodableRanges.addRange(std::move(addressRange));
-	}
 }
 
 /**
@@ -929,11 +962,6 @@ void PeFormat::loadResources()
 			}
 		}
 	}
-
-	for (auto&& addressRange : formatParser->getResourceDirectoryOccupiedAddresses())
-	{
-		nonDecodableRanges.addRange(std::move(addressRange));
-	}
 }
 
 /**
@@ -1103,14 +1131,112 @@ void PeFormat::loadCertificates()
 	BIO_free(bio);
 }
 
+/**
+ * Parse the rich header on its first access
+ */
+void PeFormat::loadRichHeaderOnDemand() const
+{
+	auto *self = const_cast<PeFormat*>(this);
+	if(stateIsValid && !richHeaderLoaded)
+	{
+		self->richHeaderLoaded = true;
+		self->loadRichHeader();
+	}
+}
+
+/**
+ * Parse the PDB debug information on its first access
+ */
+void PeFormat::loadPdbInfoOnDemand() const
+{
+	auto *self = const_cast<PeFormat*>(this);
+	if(stateIsValid && !pdbInfoLoaded)
+	{
+		self->pdbInfoLoaded = true;
+		self->loadPdbInfo();
+	}
+}
+
+/**
+ * Parse the resources on their first access
+ */
+void PeFormat::loadResourcesOnDemand() const
+{
+	auto *self = const_cast<PeFormat*>(this);
+	if(stateIsValid && !resourcesLoaded)
+	{
+		self->resourcesLoaded = true;
+		self->loadResources();
+		// Resource loading itself only records references into the loaded
+		// file data; the hashes of all resources are computed afterwards on
+		// a pool of worker threads.
+		if(self->resourceTable && !(getLoadFlags() & LoadFlags::NO_VERBOSE_HASHES))
+		{
+			self->resourceTable->computeResourceHashes();
+		}
+	}
+}
+
+/**
+ * Parse the certificates on their first access
+ */
+void PeFormat::loadCertificatesOnDemand() const
+{
+	auto *self = const_cast<PeFormat*>(this);
+	if(stateIsValid && !certificatesLoaded)
+	{
+		self->certificatesLoaded = true;
+		if(self->certificatesFuture.valid())
+		{
+			// Certificate processing was started asynchronously at load
+			// time, so just join it here.
+			self->certificatesFuture.get();
+		}
+		else
+		{
+			self->loadCertificates();
+		}
+	}
+}
+
+/**
+ * Parse the .NET headers on their first access
+ */
+void PeFormat::loadDotnetHeadersOnDemand() const
+{
+	auto *self = const_cast<PeFormat*>(this);
+	if(stateIsValid && !dotnetHeadersLoaded)
+	{
+		self->dotnetHeadersLoaded = true;
+		self->loadDotnetHeaders();
+	}
+}
+
+/**
+ * Parse the contents of the .NET metadata streams on their first access
+ */
+void PeFormat::loadDotnetStreamsOnDemand() const
+{
+	loadDotnetHeadersOnDemand();
+
+	auto *self = const_cast<PeFormat*>(this);
+	if(stateIsValid && !dotnetStreamsLoaded)
+	{
+		self->dotnetStreamsLoaded = true;
+		self->loadDotnetStreams();
+	}
+}
 
 /**
  * Load .NET headers.
+ *
+ * Only the CLR header, the metadata header and the headers of the metadata
+ * streams are parsed here, so consumers that just ask whether the file is
+ * .NET and for its runtime version do not pay for full metadata parsing.
+ * The stream contents are parsed lazily by loadDotnetStreams().
  */
 void PeFormat::loadDotnetHeaders()
 {
-	std::uint64_t metadataHeaderAddress = 0;
-
 	// If our file contains CLR header, then use it
 	unsigned long long comHeaderAddress, comHeaderSize;
 	if(getDataDirectoryRelative(PELIB_IMAGE_DIRECTORY_ENTRY_COM_DESCRIPTOR, comHeaderAddress, comHeaderSize) && comHeaderSize)
@@ -1183,20 +1309,42 @@ void PeFormat::loadDotnetHeaders()
 			return;
 		}
 
-		if (streamName == "#~" || streamName == "#-")
-			parseMetadataStream(metadataHeaderAddress, streamOffset, streamSize);
-		else if (streamName == "#Blob")
-			parseBlobStream(metadataHeaderAddress, streamOffset, streamSize);
-		else if (streamName == "#GUID")
-			parseGuidStream(metadataHeaderAddress, streamOffset, streamSize);
-		else if (streamName == "#Strings")
-			parseStringStream(metadataHeaderAddress, streamOffset, streamSize);
-		else if (streamName == "#US")
-			parseUserStringStream(metadataHeaderAddress, streamOffset, streamSize);
+		dotnetStreamHeaders.push_back({streamName, streamOffset, streamSize});
 
 		// Round-up to the nearest higher multiple of 4
 		currentAddress += 8 + ((streamName.length() + 4) & ~3);
 	}
+}
+
+/**
+ * Load contents of .NET metadata streams.
+ *
+ * This is the second, expensive stage of .NET parsing. It walks the stream
+ * headers recorded by loadDotnetHeaders(), parses the metadata tables and
+ * heaps and reconstructs the defined and imported types.
+ */
+void PeFormat::loadDotnetStreams()
+{
+	if (!metadataHeader)
+	{
+		return;
+	}
+
+	for (const auto &stream : dotnetStreamHeaders)
+	{
+		if (stream.name == "#~" || stream.name == "#-")
+			parseMetadataStream(metadataHeaderAddress, stream.offset, stream.size);
+		else if (stream.name == "#Blob")
+			parseBlobStream(metadataHeaderAddress, stream.offset, stream.size);
+		else if (stream.name == "#GUID")
+			parseGuidStream(metadataHeaderAddress, stream.offset, stream.size);
+		else if (stream.name == "#Strings")
+			parseStringStream(metadataHeaderAddress, stream.offset, stream.size);
+		else if (stream.name == "#US")
+			parseUserStringStream(metadataHeaderAddress, stream.offset, stream.size);
+	}
+
+	dotnetStreamHeaders.clear();
 
 	detectModuleVersionId();
 	detectTypeLibId();
@@ -1302,16 +1450,18 @@ std::vector<std::tuple<const std::uint8_t*, std::size_t>> PeFormat::getDigestRan
 			return lhs.first < rhs.first;
 		});
 
+	const auto *fileData = getBytesData();
+	const auto fileSize = getFileLength();
 	std::size_t lastOffset = 0;
 	for (auto& offsetSize : offsets)
 	{
 		// If the length of the range is bigger than the amount of data we have available, then sanitize the length
-		if (offsetSize.second > bytes.size())
-			offsetSize.second = bytes.size();
+		if (offsetSize.second > fileSize)
+			offsetSize.second = fileSize;
 
 		// If the range overlaps the end of the file, then sanitize the length
-		if (offsetSize.first + offsetSize.second > bytes.size())
-			offsetSize.second = bytes.size() - offsetSize.first;
+		if (offsetSize.first + offsetSize.second > fileSize)
+			offsetSize.second = fileSize - offsetSize.first;
 
 		// This offsetSize is completely covered by the last offset so ignore it
 		if (offsetSize.first + offsetSize.second <= lastOffset)
@@ -1325,13 +1475,13 @@ std::vector<std::tuple<const std::uint8_t*, std::size_t>> PeFormat::getDigestRan
 			offsetSize.first = lastOffset;
 		}
 
-		result.emplace_back(bytes.data() + lastOffset, offsetSize.first - lastOffset);
+		result.emplace_back(fileData + lastOffset, offsetSize.first - lastOffset);
 		lastOffset = offsetSize.first + offsetSize.second;
 	}
 
 	// Finish off the data if the last offset didn't end at the end of all data
-	if (lastOffset != bytes.size())
-		result.emplace_back(bytes.data() + lastOffset, bytes.size() - lastOffset);
+	if (lastOffset != fileSize)
+		result.emplace_back(fileData + lastOffset, fileSize - lastOffset);
 
 	return result;
 }
@@ -2315,6 +2465,7 @@ int PeFormat::getPeClass() const
  */
 bool PeFormat::isDotNet() const
 {
+	loadDotnetHeadersOnDemand();
 	return clrHeader != nullptr || metadataHeader != nullptr;
 }
 
@@ -2462,56 +2613,67 @@ const PeCoffSection* PeFormat::getPeSection(unsigned long long secIndex) const
 
 const CLRHeader* PeFormat::getCLRHeader() const
 {
+	loadDotnetHeadersOnDemand();
 	return clrHeader.get();
 }
 
 const MetadataHeader* PeFormat::getMetadataHeader() const
 {
+	loadDotnetHeadersOnDemand();
 	return metadataHeader.get();
 }
 
 const MetadataStream* PeFormat::getMetadataStream() const
 {
+	loadDotnetStreamsOnDemand();
 	return metadataStream.get();
 }
 
 const StringStream* PeFormat::getStringStream() const
 {
+	loadDotnetStreamsOnDemand();
 	return stringStream.get();
 }
 
 const BlobStream* PeFormat::getBlobStream() const
 {
+	loadDotnetStreamsOnDemand();
 	return blobStream.get();
 }
 
 const GuidStream* PeFormat::getGuidStream() const
 {
+	loadDotnetStreamsOnDemand();
 	return guidStream.get();
 }
 
 const UserStringStream* PeFormat::getUserStringStream() const
 {
+	loadDotnetStreamsOnDemand();
 	return userStringStream.get();
 }
 
 const std::string& PeFormat::getModuleVersionId() const
 {
+	loadDotnetStreamsOnDemand();
 	return moduleVersionId;
 }
 
 const std::string& PeFormat::getTypeLibId() const
 {
+	loadDotnetStreamsOnDemand();
 	return typeLibId;
 }
 
 const std::vector<std::shared_ptr<DotnetClass>>& PeFormat::getDefinedDotnetClasses() const
 {
+	loadDotnetStreamsOnDemand();
 	return definedClasses;
 }
 
 const std::vector<std::shared_ptr<DotnetClass>>& PeFormat::getImportedDotnetClasses() const
 {
+	loadDotnetStreamsOnDemand();
 	return importedClasses;
 }
 
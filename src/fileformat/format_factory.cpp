@@ -45,5 +45,33 @@ std::unique_ptr<FileFormat> createFileFormat(const std::string &filePath, retdec
 	}
 }
 
+/**
+ * Create instance of FileFormat class from the stream with the file image
+ * @param inputStream Stream with the file image
+ * @param config Pointer to config used to detect raw data file format
+ * @param loadFlags Load flags
+ * @return Pointer to instance of FileFormat class or @c nullptr if any error
+ *
+ * Use for file images handed over in memory (e.g. a freshly unpacked file),
+ * skipping the round trip through a temporary file. Only formats whose parsers
+ * can read from a stream are supported - ELF, Intel HEX and raw data. The PE,
+ * COFF and Mach-O parsers are bound to on-disk files, so @c nullptr is returned
+ * for them and the caller has to fall back to a file.
+ */
+std::unique_ptr<FileFormat> createFileFormat(std::istream &inputStream, retdec::config::Config *config, LoadFlags loadFlags)
+{
+	switch(detectFileFormat(inputStream, config))
+	{
+		case Format::ELF:
+			return std::make_unique<ElfFormat>(inputStream, loadFlags);
+		case Format::INTEL_HEX:
+			return std::make_unique<IntelHexFormat>(inputStream, loadFlags);
+		case Format::RAW_DATA:
+			return std::make_unique<RawDataFormat>(inputStream, loadFlags);
+		default:
+			return nullptr;
+	}
+}
+
 } // namespace fileformat
 } // namespace retdec
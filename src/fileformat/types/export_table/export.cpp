@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include "retdec/utils/string_pool.h"
 #include "retdec/fileformat/types/export_table/export.h"
 
 namespace retdec {
@@ -12,7 +13,8 @@ namespace fileformat {
 /**
  * Constructor
  */
-Export::Export() : address(0), ordinalNumber(0), ordinalNumberIsValid(false)
+Export::Export() : name(&retdec::utils::internString(std::string())),
+	address(0), ordinalNumber(0), ordinalNumberIsValid(false)
 {
 
 }
@@ -31,7 +33,7 @@ Export::~Export()
  */
 std::string Export::getName() const
 {
-	return name;
+	return *name;
 }
 
 /**
@@ -66,7 +68,7 @@ bool Export::getOrdinalNumber(unsigned long long &exportOrdinalNumber) const
  */
 void Export::setName(std::string exportName)
 {
-	name = exportName;
+	name = &retdec::utils::internString(std::move(exportName));
 }
 
 /**
@@ -105,7 +107,7 @@ void Export::invalidateOrdinalNumber()
  */
 bool Export::hasEmptyName() const
 {
-	return name.empty();
+	return name->empty();
 }
 
 } // namespace fileformat
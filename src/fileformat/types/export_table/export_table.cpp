@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/utils/conversion.h"
 #include "retdec/fileformat/types/export_table/export_table.h"
 
@@ -15,7 +17,7 @@ namespace fileformat {
 /**
  * Constructor
  */
-ExportTable::ExportTable()
+ExportTable::ExportTable() : indexesAreValid(false)
 {
 
 }
@@ -28,6 +30,29 @@ ExportTable::~ExportTable()
 
 }
 
+/**
+ * Build lookup indexes over stored exports
+ *
+ * The name index maps every export name to the index of its first occurrence,
+ * the address index is a sorted array suitable for binary search. Both are
+ * built at most once between two modifications of the table.
+ */
+void ExportTable::buildIndexes() const
+{
+	nameIndex.clear();
+	addressIndex.clear();
+	addressIndex.reserve(exports.size());
+
+	for(std::size_t i = 0, e = exports.size(); i < e; ++i)
+	{
+		nameIndex.emplace(exports[i].getName(), i);
+		addressIndex.emplace_back(exports[i].getAddress(), i);
+	}
+
+	std::sort(addressIndex.begin(), addressIndex.end());
+	indexesAreValid = true;
+}
+
 /**
  * Get number of stored exports
  * @return Number of stored exports
@@ -54,15 +79,7 @@ const Export* ExportTable::getExport(std::size_t exportIndex) const
  */
 const Export* ExportTable::getExport(const std::string &name) const
 {
-	for(const auto &e : exports)
-	{
-		if(e.getName() == name)
-		{
-			return &e;
-		}
-	}
-
-	return nullptr;
+	return findByName(name);
 }
 
 /**
@@ -72,15 +89,46 @@ const Export* ExportTable::getExport(const std::string &name) const
  */
 const Export* ExportTable::getExportOnAddress(unsigned long long address) const
 {
-	for(const auto &e : exports)
+	return findByAddress(address);
+}
+
+/**
+ * Find export by name
+ * @param name Name of the export to find
+ * @return Pointer to export with the specified name or @c nullptr if such export not found
+ *
+ * Uses a hash index which is built on the first lookup, so repeated queries
+ * run in constant time instead of scanning the whole table.
+ */
+const Export* ExportTable::findByName(const std::string &name) const
+{
+	if(!indexesAreValid)
 	{
-		if(e.getAddress() == address)
-		{
-			return &e;
-		}
+		buildIndexes();
+	}
+
+	const auto it = nameIndex.find(name);
+	return it != nameIndex.end() ? &exports[it->second] : nullptr;
+}
+
+/**
+ * Find export by address
+ * @param address Address of the export to find
+ * @return Pointer to export on the specified address or @c nullptr if such export not found
+ *
+ * Uses a sorted address array which is built on the first lookup, so repeated
+ * queries run in logarithmic time instead of scanning the whole table.
+ */
+const Export* ExportTable::findByAddress(unsigned long long address) const
+{
+	if(!indexesAreValid)
+	{
+		buildIndexes();
 	}
 
-	return nullptr;
+	const auto it = std::lower_bound(addressIndex.begin(), addressIndex.end(),
+		std::make_pair(address, std::size_t(0)));
+	return it != addressIndex.end() && it->first == address ? &exports[it->second] : nullptr;
 }
 
 /**
@@ -107,6 +155,9 @@ ExportTable::exportsIterator ExportTable::end() const
 void ExportTable::clear()
 {
 	exports.clear();
+	nameIndex.clear();
+	addressIndex.clear();
+	indexesAreValid = false;
 }
 
 /**
@@ -116,6 +167,7 @@ void ExportTable::clear()
 void ExportTable::addExport(Export &newExport)
 {
 	exports.push_back(newExport);
+	indexesAreValid = false;
 }
 
 /**
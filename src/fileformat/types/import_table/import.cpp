@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include "retdec/utils/string_pool.h"
 #include "retdec/fileformat/types/import_table/import.h"
 
 namespace retdec {
@@ -12,7 +13,8 @@ namespace fileformat {
 /**
  * Constructor
  */
-Import::Import() : libraryIndex(0), address(0), ordinalNumber(0), ordinalNumberIsValid(false)
+Import::Import() : name(&retdec::utils::internString(std::string())),
+	libraryIndex(0), address(0), ordinalNumber(0), ordinalNumberIsValid(false)
 {
 
 }
@@ -31,7 +33,7 @@ Import::~Import()
  */
 std::string Import::getName() const
 {
-	return name;
+	return *name;
 }
 
 /**
@@ -75,7 +77,7 @@ bool Import::getOrdinalNumber(unsigned long long &importOrdinalNumber) const
  */
 void Import::setName(std::string importName)
 {
-	name = importName;
+	name = &retdec::utils::internString(std::move(importName));
 }
 
 /**
@@ -123,7 +125,7 @@ void Import::invalidateOrdinalNumber()
  */
 bool Import::hasEmptyName() const
 {
-	return name.empty();
+	return name->empty();
 }
 
 } // namespace fileformat
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/crypto/crypto.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
@@ -571,7 +573,7 @@ namespace fileformat {
 /**
  * Constructor
  */
-ImportTable::ImportTable()
+ImportTable::ImportTable() : indexesAreValid(false)
 {
 
 }
@@ -584,6 +586,29 @@ ImportTable::~ImportTable()
 
 }
 
+/**
+ * Build lookup indexes over stored imports
+ *
+ * The name index maps every import name to the index of its first occurrence,
+ * the address index is a sorted array suitable for binary search. Both are
+ * built at most once between two modifications of the table.
+ */
+void ImportTable::buildIndexes() const
+{
+	nameIndex.clear();
+	addressIndex.clear();
+	addressIndex.reserve(imports.size());
+
+	for(std::size_t i = 0, e = imports.size(); i < e; ++i)
+	{
+		nameIndex.emplace(imports[i].getName(), i);
+		addressIndex.emplace_back(imports[i].getAddress(), i);
+	}
+
+	std::sort(addressIndex.begin(), addressIndex.end());
+	indexesAreValid = true;
+}
+
 /**
  * Get number of libraries which are imported
  * @return Number of libraries which are imported
@@ -718,15 +743,7 @@ const Import* ImportTable::getImport(std::size_t importIndex) const
  */
 const Import* ImportTable::getImport(const std::string &name) const
 {
-	for(const auto &i : imports)
-	{
-		if(i.getName() == name)
-		{
-			return &i;
-		}
-	}
-
-	return nullptr;
+	return findByName(name);
 }
 
 /**
@@ -736,15 +753,46 @@ const Import* ImportTable::getImport(const std::string &name) const
  */
 const Import* ImportTable::getImportOnAddress(unsigned long long address) const
 {
-	for(const auto &i : imports)
+	return findByAddress(address);
+}
+
+/**
+ * Find import by name
+ * @param name Name of the import to find
+ * @return Pointer to import with the specified name or @c nullptr if such import not found
+ *
+ * Uses a hash index which is built on the first lookup, so repeated queries
+ * run in constant time instead of scanning the whole table.
+ */
+const Import* ImportTable::findByName(const std::string &name) const
+{
+	if(!indexesAreValid)
 	{
-		if(i.getAddress() == address)
-		{
-			return &i;
-		}
+		buildIndexes();
+	}
+
+	const auto it = nameIndex.find(name);
+	return it != nameIndex.end() ? &imports[it->second] : nullptr;
+}
+
+/**
+ * Find import by address
+ * @param address Address of the import to find
+ * @return Pointer to import on the specified address or @c nullptr if such import not found
+ *
+ * Uses a sorted address array which is built on the first lookup, so repeated
+ * queries run in logarithmic time instead of scanning the whole table.
+ */
+const Import* ImportTable::findByAddress(unsigned long long address) const
+{
+	if(!indexesAreValid)
+	{
+		buildIndexes();
 	}
 
-	return nullptr;
+	const auto it = std::lower_bound(addressIndex.begin(), addressIndex.end(),
+		std::make_pair(address, std::size_t(0)));
+	return it != addressIndex.end() && it->first == address ? &imports[it->second] : nullptr;
 }
 
 /**
@@ -786,6 +834,9 @@ void ImportTable::clear()
 	impHashBytes.clear();
 	libraries.clear();
 	imports.clear();
+	nameIndex.clear();
+	addressIndex.clear();
+	indexesAreValid = false;
 	impHashCrc32.clear();
 	impHashMd5.clear();
 	impHashSha256.clear();
@@ -810,6 +861,7 @@ void ImportTable::addLibrary(std::string name)
 void ImportTable::addImport(const Import &import)
 {
 	imports.push_back(import);
+	indexesAreValid = false;
 
 	// Get lowercase import name and library name
 	auto funcName = toLower(import.getName());
@@ -416,13 +416,25 @@ void Resource::load(const FileFormat *rOwner)
 	const auto *origBytes = rOwner->getLoadedBytesData() + offset;
 	bytes = StringRef(reinterpret_cast<const char*>(origBytes), std::min(size, rOwner->getLoadedFileLength() - offset));
 	loaded = true;
+}
 
-	if (!(rOwner->getLoadFlags() & LoadFlags::NO_VERBOSE_HASHES))
+/**
+ * Compute hashes of loaded resource content
+ *
+ * This method must be called after @a load(). It is separate from loading so
+ * the hashes of many resources can be computed in parallel.
+ */
+void Resource::computeHashes()
+{
+	if(!loaded || bytes.empty())
 	{
-		crc32 = retdec::crypto::getCrc32(origBytes, bytes.size());
-		md5 = retdec::crypto::getMd5(origBytes, bytes.size());
-		sha256 = retdec::crypto::getSha256(origBytes, bytes.size());
+		return;
 	}
+
+	const auto *origBytes = reinterpret_cast<const unsigned char*>(bytes.data());
+	crc32 = retdec::crypto::getCrc32(origBytes, bytes.size());
+	md5 = retdec::crypto::getMd5(origBytes, bytes.size());
+	sha256 = retdec::crypto::getSha256(origBytes, bytes.size());
 }
 
 /**
@@ -7,6 +7,7 @@
 #include <sstream>
 
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/thread_pool.h"
 #include "retdec/fileformat/types/resource_table/resource_table.h"
 
 using namespace retdec::utils;
@@ -230,6 +231,21 @@ void ResourceTable::addResource(Resource &newResource)
 	table.push_back(newResource);
 }
 
+/**
+ * Compute hashes of all stored resources
+ *
+ * Hashing is a pure per-resource computation, so resources are distributed
+ * over worker threads. Resource-stuffed installers may contain tens of
+ * thousands of resources and hashing them serially dominates their
+ * processing time.
+ */
+void ResourceTable::computeResourceHashes()
+{
+	parallelFor(table.size(), [this](std::size_t index) {
+		table[index].computeHashes();
+	});
+}
+
 /**
  * Find out if there are any resources
  * @return @c true if there are some resources, @c false otherwise
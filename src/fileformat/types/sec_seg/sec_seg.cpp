@@ -8,6 +8,7 @@
 
 #include "retdec/crypto/crypto.h"
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/math.h"
 #include "retdec/utils/string.h"
 #include "retdec/fileformat/file_format/file_format.h"
 #include "retdec/fileformat/types/sec_seg/sec_seg.h"
@@ -26,7 +27,8 @@ namespace fileformat {
  */
 SecSeg::SecSeg() : type(Type::UNDEFINED_SEC_SEG), index(0), offset(0), fileSize(0),
 	address(0), memorySize(0), entrySize(0), memorySizeIsValid(false),
-	entrySizeIsValid(false), isInMemory(false), loaded(false)
+	entrySizeIsValid(false), isInMemory(false), loaded(false), entropy(0.0),
+	entropyIsValid(false)
 {
 
 }
@@ -204,6 +206,26 @@ std::string SecSeg::getSha256() const
 	return sha256;
 }
 
+/**
+ * Get entropy of section or segment data in bits per byte
+ * @return Entropy in range <tt>[0.0, 8.0]</tt>, @c 0.0 for empty content
+ *
+ * The entropy is computed on the first call and cached, so all consumers
+ * (e.g. compiler-detection heuristics and fileinfo) share one computation
+ * per section. The content must be loaded via load() first.
+ */
+double SecSeg::getEntropy() const
+{
+	if (!entropyIsValid)
+	{
+		entropy = retdec::utils::byteEntropy(
+				reinterpret_cast<const unsigned char*>(bytes.data()),
+				bytes.size());
+		entropyIsValid = true;
+	}
+	return entropy;
+}
+
 /**
  * Get name
  * @return Name
@@ -563,6 +585,7 @@ void SecSeg::load(const FileFormat *sOwner)
 
 	bytes = StringRef(reinterpret_cast<const char*>(sOwner->getLoadedBytesData() + offset), std::min(fileSize, sOwner->getLoadedFileLength() - offset));
 	loaded = true;
+	entropyIsValid = false;
 
 	if (!(sOwner->getLoadFlags() & LoadFlags::NO_VERBOSE_HASHES))
 	{
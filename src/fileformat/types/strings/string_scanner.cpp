@@ -0,0 +1,294 @@
+/**
+ * @file src/fileformat/types/strings/string_scanner.cpp
+ * @brief Vectorized scanner of printable-character runs.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <cstdint>
+
+#include "retdec/fileformat/types/strings/string_scanner.h"
+
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+	#define RETDEC_STRING_SCANNER_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define RETDEC_STRING_SCANNER_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace {
+
+using namespace retdec::fileformat;
+
+const std::size_t ChunkSize = 16;
+
+/**
+ * Check if byte is a printable ASCII character
+ * @param b Byte to check
+ * @return @c true if byte is printable, @c false otherwise
+ *
+ * This must stay equivalent to std::isprint() in the "C" locale so the
+ * vectorized and scalar scanners classify bytes identically.
+ */
+inline bool isPrintableAscii(unsigned char b)
+{
+	return b >= 0x20 && b <= 0x7E;
+}
+
+/**
+ * Check if a valid character starts on the given offset
+ * @param data Scanned data
+ * @param size Size of scanned data
+ * @param pos Offset of the character
+ * @param charSize Character size in bytes
+ * @param endian Endianness of characters
+ * @return @c true if a whole valid character starts at @a pos, @c false otherwise
+ */
+inline bool isValidCharacterStart(const unsigned char* data, std::size_t size,
+	std::size_t pos, std::size_t charSize, CharacterEndianness endian)
+{
+	if(pos + charSize > size)
+	{
+		return false;
+	}
+
+	if(endian == CharacterEndianness::Little)
+	{
+		if(!isPrintableAscii(data[pos]))
+		{
+			return false;
+		}
+		for(std::size_t i = 1; i < charSize; ++i)
+		{
+			if(data[pos + i] != 0)
+			{
+				return false;
+			}
+		}
+	}
+	else
+	{
+		if(!isPrintableAscii(data[pos + charSize - 1]))
+		{
+			return false;
+		}
+		for(std::size_t i = 0; i + 1 < charSize; ++i)
+		{
+			if(data[pos + i] != 0)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+#if defined(RETDEC_STRING_SCANNER_SSE2) || defined(RETDEC_STRING_SCANNER_NEON)
+	#define RETDEC_STRING_SCANNER_SIMD
+#endif
+
+#ifdef RETDEC_STRING_SCANNER_SSE2
+
+/**
+ * Classify one 16-byte chunk
+ * @param p Pointer to the chunk
+ * @param printable Into this parameter is stored bitmask of printable bytes
+ * @param zero Into this parameter is stored bitmask of zero bytes
+ */
+inline void classifyChunk(const unsigned char* p, std::uint32_t &printable, std::uint32_t &zero)
+{
+	const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+	const auto aboveSpace = _mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1F));
+	const auto belowDel = _mm_cmplt_epi8(bytes, _mm_set1_epi8(0x7F));
+	printable = _mm_movemask_epi8(_mm_and_si128(aboveSpace, belowDel));
+	zero = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_setzero_si128()));
+}
+
+#elif defined(RETDEC_STRING_SCANNER_NEON)
+
+/**
+ * Extract one bit per byte from a NEON comparison result
+ * @param mask Comparison result with bytes equal to 0x00 or 0xFF
+ * @return Bitmask with bit @c i set if byte @c i of @a mask is 0xFF
+ */
+inline std::uint32_t movemask(uint8x16_t mask)
+{
+	const std::uint8_t bitWeights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+	const auto weighted = vandq_u8(mask, vld1q_u8(bitWeights));
+	auto sum = vpadd_u8(vget_low_u8(weighted), vget_high_u8(weighted));
+	sum = vpadd_u8(sum, sum);
+	sum = vpadd_u8(sum, sum);
+	return vget_lane_u8(sum, 0) | (static_cast<std::uint32_t>(vget_lane_u8(sum, 1)) << 8);
+}
+
+/**
+ * Classify one 16-byte chunk
+ * @param p Pointer to the chunk
+ * @param printable Into this parameter is stored bitmask of printable bytes
+ * @param zero Into this parameter is stored bitmask of zero bytes
+ */
+inline void classifyChunk(const unsigned char* p, std::uint32_t &printable, std::uint32_t &zero)
+{
+	const auto bytes = vld1q_u8(p);
+	const auto aboveSpace = vcgeq_u8(bytes, vdupq_n_u8(0x20));
+	const auto belowDel = vcleq_u8(bytes, vdupq_n_u8(0x7E));
+	printable = movemask(vandq_u8(aboveSpace, belowDel));
+	zero = movemask(vceqq_u8(bytes, vdupq_n_u8(0)));
+}
+
+#endif
+
+#ifdef RETDEC_STRING_SCANNER_SIMD
+
+/**
+ * Count trailing zero bits of a nonzero value
+ * @param value Value to process
+ * @return Number of trailing zero bits
+ */
+inline std::size_t countTrailingZeros(std::uint32_t value)
+{
+	std::size_t count = 0;
+	while(!(value & 1))
+	{
+		value >>= 1;
+		++count;
+	}
+	return count;
+}
+
+/**
+ * Compute bitmask of chunk offsets where a valid character starts
+ * @param printable Bitmask of printable bytes in the chunk
+ * @param zero Bitmask of zero bytes in the chunk
+ * @param charSize Character size in bytes (1 or 2)
+ * @param endian Endianness of characters
+ * @param usableBits Into this parameter is stored number of low bits of the
+ *    result which could be decided from this chunk alone
+ * @return Bitmask with bit @c i set if a valid character starts at offset @c i
+ */
+inline std::uint32_t validCharacterMask(std::uint32_t printable, std::uint32_t zero,
+	std::size_t charSize, CharacterEndianness endian, std::size_t &usableBits)
+{
+	if(charSize == 1)
+	{
+		usableBits = ChunkSize;
+		return printable;
+	}
+
+	// A two-byte character needs its second byte, so the last offset of the
+	// chunk cannot be decided here and is left to the next iteration.
+	usableBits = ChunkSize - 1;
+	const auto valid = (endian == CharacterEndianness::Little)
+		? printable & (zero >> 1)
+		: zero & (printable >> 1);
+	return valid & ((1 << (ChunkSize - 1)) - 1);
+}
+
+#endif
+
+} // anonymous namespace
+
+namespace retdec {
+namespace fileformat {
+
+/**
+ * Find the nearest offset where a valid character starts
+ * @param data Scanned data
+ * @param size Size of scanned data
+ * @param pos Offset on which the search starts
+ * @param charSize Character size in bytes
+ * @param endian Endianness of characters
+ * @return Offset of the first valid character at or after @a pos, or @a size
+ *    if there is none
+ */
+std::size_t findNextCharacterStart(const unsigned char* data, std::size_t size,
+	std::size_t pos, std::size_t charSize, CharacterEndianness endian)
+{
+#ifdef RETDEC_STRING_SCANNER_SIMD
+	if(charSize <= 2)
+	{
+		while(pos + ChunkSize <= size)
+		{
+			std::uint32_t printable, zero;
+			classifyChunk(data + pos, printable, zero);
+			std::size_t usableBits;
+			const auto valid = validCharacterMask(printable, zero, charSize, endian, usableBits);
+			if(valid)
+			{
+				return pos + countTrailingZeros(valid);
+			}
+			pos += usableBits;
+		}
+	}
+#endif
+
+	while(pos < size && !isValidCharacterStart(data, size, pos, charSize, endian))
+	{
+		++pos;
+	}
+
+	return std::min(pos, size);
+}
+
+/**
+ * Find the end of a run of valid characters
+ * @param data Scanned data
+ * @param size Size of scanned data
+ * @param pos Offset of the first character of the run
+ * @param charSize Character size in bytes
+ * @param endian Endianness of characters
+ * @return Offset just past the last valid character of the run
+ *
+ * The run is extended in steps of @a charSize, so the returned offset minus
+ * @a pos is a multiple of the character size.
+ */
+std::size_t findCharacterRunEnd(const unsigned char* data, std::size_t size,
+	std::size_t pos, std::size_t charSize, CharacterEndianness endian)
+{
+#ifdef RETDEC_STRING_SCANNER_SIMD
+	if(charSize == 1)
+	{
+		while(pos + ChunkSize <= size)
+		{
+			std::uint32_t printable, zero;
+			classifyChunk(data + pos, printable, zero);
+			const auto invalid = ~printable & 0xFFFF;
+			if(invalid)
+			{
+				return pos + countTrailingZeros(invalid);
+			}
+			pos += ChunkSize;
+		}
+	}
+	else if(charSize == 2)
+	{
+		while(pos + ChunkSize <= size)
+		{
+			std::uint32_t printable, zero;
+			classifyChunk(data + pos, printable, zero);
+			const auto valid = (endian == CharacterEndianness::Little)
+				? printable & (zero >> 1)
+				: zero & (printable >> 1);
+			// Characters of the run start on every other offset of the chunk.
+			const auto invalid = ~valid & 0x5555;
+			if(invalid)
+			{
+				return pos + countTrailingZeros(invalid);
+			}
+			pos += ChunkSize;
+		}
+	}
+#endif
+
+	while(isValidCharacterStart(data, size, pos, charSize, endian))
+	{
+		pos += charSize;
+	}
+
+	return pos;
+}
+
+} // namespace fileformat
+} // namespace retdec
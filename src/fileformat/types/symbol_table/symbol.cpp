@@ -5,6 +5,7 @@
  */
 
 #include "retdec/utils/string.h"
+#include "retdec/utils/string_pool.h"
 #include "retdec/fileformat/types/symbol_table/symbol.h"
 
 using namespace retdec::utils;
@@ -15,9 +16,11 @@ namespace fileformat {
 /**
  * Constructor
  */
-Symbol::Symbol() : type(Type::UNDEFINED_SYM), usageType(UsageType::UNKNOWN),
-	index(0), address(0), size(0), linkToSection(0), addressIsValid(false),
-	sizeIsValid(false), linkIsValid(false), thumbSymbol(false)
+Symbol::Symbol() : name(&internString(std::string())),
+	originalName(&internString(std::string())), type(Type::UNDEFINED_SYM),
+	usageType(UsageType::UNKNOWN), index(0), address(0), size(0),
+	linkToSection(0), addressIsValid(false), sizeIsValid(false),
+	linkIsValid(false), thumbSymbol(false)
 {
 
 }
@@ -149,7 +152,7 @@ bool Symbol::isOdd() const
  */
 bool Symbol::hasEmptyName() const
 {
-	return name.empty();
+	return name->empty();
 }
 
 /**
@@ -158,7 +161,7 @@ bool Symbol::hasEmptyName() const
  */
 const std::string &Symbol::getName() const
 {
-	return name;
+	return *name;
 }
 
 /**
@@ -176,7 +179,7 @@ std::string Symbol::getNormalizedName() const
  */
 std::string Symbol::getOriginalName() const
 {
-	return originalName;
+	return *originalName;
 }
 
 /**
@@ -292,7 +295,7 @@ bool Symbol::getLinkToSection(unsigned long long &sectionIndex) const
  */
 void Symbol::setName(std::string symbolName)
 {
-	name = symbolName;
+	name = &internString(std::move(symbolName));
 }
 
 /**
@@ -301,7 +304,7 @@ void Symbol::setName(std::string symbolName)
  */
 void Symbol::setOriginalName(std::string symbolOriginalName)
 {
-	originalName = symbolOriginalName;
+	originalName = &internString(std::move(symbolOriginalName));
 }
 
 /**
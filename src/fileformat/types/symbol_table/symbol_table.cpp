@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/utils/conversion.h"
 #include "retdec/fileformat/types/symbol_table/symbol_table.h"
 
@@ -15,7 +17,7 @@ namespace fileformat {
 /**
  * Constructor
  */
-SymbolTable::SymbolTable() : table(), name()
+SymbolTable::SymbolTable() : table(), name(), indexesAreValid(false)
 {
 
 }
@@ -28,6 +30,48 @@ SymbolTable::~SymbolTable()
 
 }
 
+/**
+ * Build lookup indexes over stored symbols
+ *
+ * The name index maps every symbol name to the index of its first occurrence,
+ * the address index is a sorted array of symbols with a valid address,
+ * suitable for binary search, and the stored index map maps the index stored
+ * in every symbol to its table position. All are built at most once between
+ * two modifications of the table.
+ */
+void SymbolTable::buildIndexes() const
+{
+	nameIndex.clear();
+	addressIndex.clear();
+	addressIndex.reserve(table.size());
+	storedIndexMap.clear();
+
+	for(std::size_t i = 0, e = table.size(); i < e; ++i)
+	{
+		nameIndex.emplace(table[i]->getName(), i);
+		unsigned long long a;
+		if(table[i]->getAddress(a))
+		{
+			addressIndex.emplace_back(a, i);
+		}
+		storedIndexMap.emplace(table[i]->getIndex(), i);
+	}
+
+	std::sort(addressIndex.begin(), addressIndex.end());
+	indexesAreValid = true;
+}
+
+/**
+ * Invalidate lookup indexes
+ *
+ * This must be called whenever the table or a symbol handed out through one
+ * of the non-constant getters may have been modified.
+ */
+void SymbolTable::invalidateIndexes()
+{
+	indexesAreValid = false;
+}
+
 /**
  * Get number of symbols in table
  * @return Number of symbols in table
@@ -54,15 +98,7 @@ const Symbol* SymbolTable::getSymbol(std::size_t symbolIndex) const
  */
 const Symbol* SymbolTable::getSymbol(const std::string &name) const
 {
-	for(const auto &s : table)
-	{
-		if(s->getName() == name)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	return findByName(name);
 }
 
 /**
@@ -72,34 +108,66 @@ const Symbol* SymbolTable::getSymbol(const std::string &name) const
  */
 const Symbol* SymbolTable::getSymbolOnAddress(unsigned long long addr) const
 {
-	for(const auto &s : table)
-	{
-		unsigned long long a;
-		if(s->getAddress(a) && a == addr)
-		{
-			return s.get();
-		}
-	}
-
-	return nullptr;
+	return findByAddress(addr);
 }
 
 /**
  * Get pointer to symbol from table with specified index
  * @param symbolIndex Index stored in symbol
  * @return Pointer to symbol or @c nullptr if symbol with index is not found
+ *
+ * Uses a hash index which is built on the first lookup, so repeated queries
+ * (e.g. one per relocation) run in constant time instead of scanning the
+ * whole table.
  */
 const Symbol* SymbolTable::getSymbolWithIndex(std::size_t symbolIndex) const
 {
-	for(const auto &s : table)
+	if(!indexesAreValid)
 	{
-		if(s->getIndex() == symbolIndex)
-		{
-			return s.get();
-		}
+		buildIndexes();
 	}
 
-	return nullptr;
+	const auto it = storedIndexMap.find(symbolIndex);
+	return it != storedIndexMap.end() ? table[it->second].get() : nullptr;
+}
+
+/**
+ * Find symbol by name
+ * @param name Name of the symbol to find
+ * @return Pointer to symbol with the specified name or @c nullptr if such symbol not found
+ *
+ * Uses a hash index which is built on the first lookup, so repeated queries
+ * run in constant time instead of scanning the whole table.
+ */
+const Symbol* SymbolTable::findByName(const std::string &name) const
+{
+	if(!indexesAreValid)
+	{
+		buildIndexes();
+	}
+
+	const auto it = nameIndex.find(name);
+	return it != nameIndex.end() ? table[it->second].get() : nullptr;
+}
+
+/**
+ * Find symbol by address
+ * @param addr Address of the symbol to find
+ * @return Pointer to symbol on the specified address or @c nullptr if such symbol not found
+ *
+ * Uses a sorted address array which is built on the first lookup, so repeated
+ * queries run in logarithmic time instead of scanning the whole table.
+ */
+const Symbol* SymbolTable::findByAddress(unsigned long long addr) const
+{
+	if(!indexesAreValid)
+	{
+		buildIndexes();
+	}
+
+	const auto it = std::lower_bound(addressIndex.begin(), addressIndex.end(),
+		std::make_pair(addr, std::size_t(0)));
+	return it != addressIndex.end() && it->first == addr ? table[it->second].get() : nullptr;
 }
 
 /**
@@ -118,6 +186,8 @@ const std::string& SymbolTable::getName() const
  */
 Symbol* SymbolTable::getSymbol(std::size_t symbolIndex)
 {
+	// The caller may modify the symbol, invalidating anything indexed on it.
+	invalidateIndexes();
 	return (symbolIndex < getNumberOfSymbols()) ? table[symbolIndex].get() : nullptr;
 }
 
@@ -128,6 +198,8 @@ Symbol* SymbolTable::getSymbol(std::size_t symbolIndex)
  */
 Symbol* SymbolTable::getSymbol(const std::string &name)
 {
+	// The caller may modify the symbol, invalidating anything indexed on it.
+	invalidateIndexes();
 	for(auto &s : table)
 	{
 		if(s->getName() == name)
@@ -146,6 +218,8 @@ Symbol* SymbolTable::getSymbol(const std::string &name)
  */
 Symbol* SymbolTable::getSymbolOnAddress(unsigned long long addr)
 {
+	// The caller may modify the symbol, invalidating anything indexed on it.
+	invalidateIndexes();
 	for(auto &s : table)
 	{
 		unsigned long long a;
@@ -165,6 +239,8 @@ Symbol* SymbolTable::getSymbolOnAddress(unsigned long long addr)
  */
 Symbol* SymbolTable::getSymbolWithIndex(std::size_t symbolIndex)
 {
+	// The caller may modify the symbol, invalidating anything indexed on it.
+	invalidateIndexes();
 	for(auto &s : table)
 	{
 		if(s->getIndex() == symbolIndex)
@@ -191,6 +267,8 @@ SymbolTable::symbolsConstIterator SymbolTable::begin() const
  */
 SymbolTable::symbolsIterator SymbolTable::begin()
 {
+	// The caller may modify the symbols, invalidating anything indexed on them.
+	invalidateIndexes();
 	return table.begin();
 }
 
@@ -218,6 +296,18 @@ SymbolTable::symbolsIterator SymbolTable::end()
 void SymbolTable::clear()
 {
 	table.clear();
+	nameIndex.clear();
+	addressIndex.clear();
+	indexesAreValid = false;
+}
+
+/**
+ * Reserve storage for symbols
+ * @param capacity Expected number of symbols in table
+ */
+void SymbolTable::reserve(std::size_t capacity)
+{
+	table.reserve(capacity);
 }
 
 /**
@@ -227,6 +317,7 @@ void SymbolTable::clear()
 void SymbolTable::addSymbol(const std::shared_ptr<Symbol> &symbol)
 {
 	table.push_back(symbol);
+	invalidateIndexes();
 }
 
 /**
@@ -236,6 +327,7 @@ void SymbolTable::addSymbol(const std::shared_ptr<Symbol> &symbol)
 void SymbolTable::addSymbol(std::shared_ptr<Symbol> &&symbol)
 {
 	table.push_back(std::move(symbol));
+	invalidateIndexes();
 }
 
 /**
@@ -34,33 +34,40 @@ std::ios_base& hexWithPrefix(std::ios_base &str)
  */
 void separateStrings(std::string &str, std::vector<std::string> &words)
 {
-	str += '\0';
+	separateStrings(llvm::StringRef(str.data(), str.length()), words);
+}
+
+/**
+ * Divide @a str into individual strings separated by a null character ('\0')
+ * @param str Reference to the content to divide
+ * @param words Into this parameter the separated strings are saved
+ *
+ * At start of this function, everything from vector @a words is deleted.
+ *
+ * Into @a words is stored each word (chunk of text), which contain at least one character
+ * with different value than '\0' (words containing only null character are eliminated).
+ *
+ * Unlike the overload taking @c std::string, this overload does not need its
+ * own copy of the content, so it can be used directly on the bytes of a
+ * section or segment.
+ */
+void separateStrings(llvm::StringRef str, std::vector<std::string> &words)
+{
 	words.clear();
-	std::string tmp;
-	const auto strLen = str.length();
 
-	for(std::size_t i = 0, lastPos = 0; i < strLen; ++i)
+	for(std::size_t i = 0, e = str.size(); i < e;)
 	{
-		if(str[i] == '\0')
+		auto wordEnd = str.find('\0', i);
+		if(wordEnd == llvm::StringRef::npos)
+		{
+			wordEnd = e;
+		}
+		if(wordEnd != i)
 		{
-			tmp = str.substr(lastPos, i + 1 - lastPos);
-			lastPos = i;
-			if(tmp != std::string(tmp.length(), '\0'))
-			{
-				if(tmp[0] == '\0')
-				{
-					tmp.erase(0, 1);
-				}
-				if(tmp[tmp.length() - 1] == '\0')
-				{
-					tmp.erase(tmp.length() - 1, 1);
-				}
-				words.push_back(tmp);
-			}
+			words.push_back(str.slice(i, wordEnd).str());
 		}
+		i = wordEnd + 1;
 	}
-
-	str.erase(strLen - 1, 1);
 }
 
 } // namespace fileformat
@@ -5,6 +5,7 @@
  */
 
 #include <fstream>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <system_error>
@@ -179,6 +180,102 @@ bool isStrangeFeedface(const std::string &filePath)
 	return false;
 }
 
+/**
+ * Read little endian dword on the specified position in the file image
+ * @param bytes Content of the file image
+ * @param pos Position of the dword
+ * @return Read dword, 0 if the dword overlaps the end of the image
+ */
+std::uint32_t readDword(const std::string &bytes, std::size_t pos)
+{
+	if(pos + 4 > bytes.size())
+	{
+		return 0;
+	}
+
+	return static_cast<std::uint8_t>(bytes[pos])
+		| (static_cast<std::uint8_t>(bytes[pos + 1]) << 8)
+		| (static_cast<std::uint8_t>(bytes[pos + 2]) << 16)
+		| (static_cast<std::uint8_t>(bytes[pos + 3]) << 24);
+}
+
+/**
+ * Check if in-memory file image contains PE signature
+ * @param bytes Content of the file image
+ * @return @c true if file image contains PE signature, @c false otherwise
+ */
+bool isPeImage(const std::string &bytes)
+{
+	// e_lfanew on offset 0x3C of the MZ header points to the PE signature
+	if(bytes.size() < 0x40)
+	{
+		return false;
+	}
+
+	const auto signature = readDword(bytes, readDword(bytes, 0x3C));
+	return signature == 0x4550 || signature == 0x50450000;
+}
+
+/**
+ * Check if in-memory file image is in COFF format
+ * @param bytes Content of the file image
+ * @param magic First bytes of the file image
+ * @return @c true if file image is COFF file, @c false otherwise
+ */
+bool isCoffImage(const std::string &bytes, const std::string &magic)
+{
+	if(magic.size() < COFF_FILE_HEADER_BYTE_SIZE || hasSubstringOnPosition(magic, "ELF", 1))
+	{
+		return false;
+	}
+
+	MemoryBufferRef buffer(StringRef(bytes.data(), bytes.size()), "");
+	std::error_code errorCode;
+	COFFObjectFile coff(buffer, errorCode);
+	PELIB_IMAGE_FILE_MACHINE_ITERATOR it;
+	return !errorCode && it.isValidMachineCode(static_cast<PELIB_IMAGE_FILE_MACHINE>(coff.getMachine()));
+}
+
+/**
+ * Check if in-memory file image is Java class
+ * @param bytes Content of the file image
+ * @return @c true if file image is Java class file, @c false otherwise
+ */
+bool isJavaImage(const std::string &bytes)
+{
+	// Same magic for both Java and fat Mach-O, stored in big endian byte order
+	const auto magic = readDword(bytes, 0);
+	if (magic == 0xcafebabe || magic == 0xbebafeca)
+	{
+		auto fatCount = readDword(bytes, 4);
+		fatCount = sys::SwapByteOrder_32(fatCount);
+
+		// Mach-O currently supports up to 18 architectures
+		// Java version starts at 39. However file utility uses value 30
+		return fatCount > 30;
+	}
+
+	return false;
+}
+
+/**
+ * Check if in-memory file image is strange format with Mach-O magic.
+ * @param bytes Content of the file image
+ * @return @c true if file image is likely not Mach-O, @c false otherwise
+ */
+bool isStrangeFeedfaceImage(const std::string &bytes)
+{
+	// All such files found were in little endian byte order
+	if (readDword(bytes, 0) == 0xfeedface && readDword(bytes, 4) == 0x10 && readDword(bytes, 8) == 0x02)
+	{
+		// Maximal valid Mach-O value is 0x0b but 0x10 will be safer and
+		// still remove all unwanted files
+		return readDword(bytes, 12) > 0x10;
+	}
+
+	return false;
+}
+
 } // anonymous namespace
 
 /**
@@ -256,5 +353,80 @@ Format detectFileFormat(const std::string &filePath, retdec::config::Config *con
 	return Format::UNKNOWN;
 }
 
+/**
+ * Detects file format of file image in the input stream
+ * @param inputStream Stream with the file image
+ * @param config Config is used to determine if the input is a raw binary
+ * @return Detected file format in enumeration representation
+ *
+ * Use for file images handed over in memory (e.g. a freshly unpacked file),
+ * where no file on the disk exists. The whole stream content is read into
+ * memory as the detection needs random access into the image. The stream is
+ * rewound back to its beginning afterwards, so a file format parser can be
+ * created from the same stream right away.
+ */
+Format detectFileFormat(std::istream &inputStream, retdec::config::Config *config)
+{
+	std::string bytes;
+
+	try
+	{
+		inputStream.clear();
+		inputStream.seekg(0, std::ios::beg);
+		bytes.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+	} catch(...)
+	{
+		return Format::UNDETECTABLE;
+	}
+
+	if(inputStream.bad())
+	{
+		return Format::UNDETECTABLE;
+	}
+
+	inputStream.clear();
+	inputStream.seekg(0, std::ios::beg);
+
+	for(const auto &item : unknownFormatMap)
+	{
+		if(hasSubstringOnPosition(bytes, item.first.second, item.first.first))
+		{
+			return Format::UNKNOWN;
+		}
+	}
+
+	for(const auto &item : magicFormatMap)
+	{
+		if(hasSubstringOnPosition(bytes, item.first.second, item.first.first))
+		{
+			switch(item.second)
+			{
+				case Format::PE:
+					return isPeImage(bytes) ? Format::PE : Format::UNKNOWN;
+				case Format::MACHO:
+					if (isStrangeFeedfaceImage(bytes) || isJavaImage(bytes))
+					{
+						// Java class and some other format use Mach-O magics
+						return Format::UNKNOWN;
+					}
+					/* fall-thru */
+				default:
+					return item.second;
+			}
+		}
+	}
+
+	if(isCoffImage(bytes, bytes.substr(0, COFF_FILE_HEADER_BYTE_SIZE)))
+	{
+		return Format::COFF;
+	}
+	else if(config && config->fileFormat.isRaw())
+	{
+		return Format::RAW_DATA;
+	}
+
+	return Format::UNKNOWN;
+}
+
 } // namespace fileformat
 } // namespace retdec
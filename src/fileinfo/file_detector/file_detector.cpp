@@ -5,6 +5,7 @@
  */
 
 #include <memory>
+#include <thread>
 
 #include <tinyxml2.h>
 
@@ -68,16 +69,18 @@ void FileDetector::getArchitectureBitSize()
 
 /**
  * Get all supported information about used compiler or packer
+ *
+ * Compiler detection searches the whole file for tool signatures and writes
+ * only @c fileInfo.toolInfo, so it may run in a separate thread while other
+ * information groups are gathered. Status and messages resulting from the
+ * detection are merged by the caller after the detection finishes.
+ *
+ * @return Status of compiler detection
  */
-void FileDetector::getCompilerInformation()
+retdec::cpdetect::ReturnCode FileDetector::getCompilerInformation()
 {
 	std::unique_ptr<CompilerDetector> compDetector(createCompilerDetector());
-	fileInfo.setStatus(compDetector ? compDetector->getAllInformation() : ReturnCode::UNKNOWN_CP);
-
-	for(const auto &m : fileInfo.toolInfo.errorMessages)
-	{
-		fileInfo.messages.push_back(m);
-	}
+	return compDetector ? compDetector->getAllInformation() : ReturnCode::UNKNOWN_CP;
 }
 
 /**
@@ -180,10 +183,14 @@ void FileDetector::getResourceInfo()
  */
 void FileDetector::getManifestInfo()
 {
-	std::string str;
 	tinyxml2::XMLDocument document;
 	const auto *manifestRes = fileParser->getManifestResource();
-	if(!manifestRes || !manifestRes->getString(str) || document.Parse(str.c_str(), str.length()) != tinyxml2::XML_SUCCESS)
+	if(!manifestRes)
+	{
+		return;
+	}
+	const auto content = manifestRes->getBytes();
+	if(document.Parse(content.data(), content.size()) != tinyxml2::XML_SUCCESS)
 	{
 		return;
 	}
@@ -311,6 +318,24 @@ void FileDetector::setConfigFile(retdec::config::Config &config)
  * Get all supported information about binary file
  */
 void FileDetector::getAllInformation()
+{
+	getAllInformation(InformationSelection());
+}
+
+/**
+ * Get selected information about binary file
+ * @param selection Selection of information groups to gather
+ *
+ * The groups needed by every output mode (format detection, compiler
+ * detection, hashes of the whole file, overlay, rich header, strings) are
+ * gathered unconditionally, the rest only when enabled in @a selection.
+ *
+ * Compiler detection runs in a separate thread overlapped with the groups
+ * which do not touch @c fileInfo.toolInfo. Format specific information
+ * (getAdditionalInfo()) must wait for it, because some formats store the
+ * entry point into @c fileInfo.toolInfo as well.
+ */
+void FileDetector::getAllInformation(const InformationSelection &selection)
 {
 	if(loaded)
 	{
@@ -320,19 +345,55 @@ void FileDetector::getAllInformation()
 		detectFileType();
 		getEndianness();
 		getArchitectureBitSize();
-		getCompilerInformation();
+
+		auto compilerStatus = ReturnCode::UNKNOWN_CP;
+		std::thread compilerThread([&] { compilerStatus = getCompilerInformation(); });
+
 		getRichHeaderInfo();
 		getOverlayInfo();
-		getPdbInfo();
-		getResourceInfo();
-		getManifestInfo();
-		getImports();
-		getExports();
+		if(selection.pdbInfo)
+		{
+			getPdbInfo();
+		}
+		if(selection.resources)
+		{
+			getResourceInfo();
+		}
+		if(selection.manifest)
+		{
+			getManifestInfo();
+		}
+		if(selection.imports)
+		{
+			getImports();
+		}
+		if(selection.exports)
+		{
+			getExports();
+		}
 		getHashes();
-		getAdditionalInfo();
-		getCertificates();
-		getLoaderInfo();
+		if(selection.certificates)
+		{
+			getCertificates();
+		}
+		if(selection.loaderInfo)
+		{
+			getLoaderInfo();
+		}
 		getStrings();
+
+		compilerThread.join();
+		fileInfo.setStatus(compilerStatus);
+		// keep the original message order - compiler detection messages
+		// were reported before the warnings of the other groups
+		fileInfo.messages.insert(fileInfo.messages.begin(),
+				fileInfo.toolInfo.errorMessages.begin(),
+				fileInfo.toolInfo.errorMessages.end());
+
+		if(selection.additionalInfo)
+		{
+			getAdditionalInfo();
+		}
 	}
 }
 
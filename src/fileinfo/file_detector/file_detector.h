@@ -12,6 +12,27 @@
 
 namespace fileinfo {
 
+/**
+ * Selection of information groups to gather about the input file
+ *
+ * The presentation layer prints only a subset of FileInformation depending
+ * on the output format and verbosity, so the selection lets the caller skip
+ * gathering of groups which would never be presented (e.g. hashing of all
+ * resources when only the basic overview is requested). All groups are
+ * enabled by default.
+ */
+struct InformationSelection
+{
+	bool pdbInfo = true;        ///< information about related PDB file
+	bool resources = true;      ///< resource table including resource hashes
+	bool manifest = true;       ///< manifest resource
+	bool imports = true;        ///< import table
+	bool exports = true;        ///< export table
+	bool additionalInfo = true; ///< format specific information (headers, sections, ...)
+	bool certificates = true;   ///< certificate table
+	bool loaderInfo = true;     ///< information from loader
+};
+
 /**
  * FileDetector - find info about binary file
  */
@@ -22,7 +43,7 @@ class FileDetector : private retdec::utils::NonCopyable
 		/// @{
 		void getEndianness();
 		void getArchitectureBitSize();
-		void getCompilerInformation();
+		retdec::cpdetect::ReturnCode getCompilerInformation();
 		void getRichHeaderInfo();
 		void getOverlayInfo();
 		void getPdbInfo();
@@ -57,6 +78,7 @@ class FileDetector : private retdec::utils::NonCopyable
 
 		void setConfigFile(retdec::config::Config &config);
 		void getAllInformation();
+		void getAllInformation(const InformationSelection &selection);
 		const retdec::fileformat::FileFormat* getFileParser() const;
 };
 
@@ -26,7 +26,7 @@ ConfigPresentation::ConfigPresentation(FileInformation &fileinfo_, std::string f
 {
 	try
 	{
-		outDoc.readJsonFile(configFile);
+		outDoc.readFile(configFile);
 	}
 	catch (const FileNotFoundException&)
 	{
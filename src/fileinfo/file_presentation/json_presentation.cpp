@@ -565,69 +565,112 @@ void JsonPresentation::presentIterativeSubtitle(Json::Value &root, const Iterati
 	}
 }
 
+/**
+ * Write all members of completed part of output document to standard output
+ * @param section Completed part of the output document
+ * @param firstMember Set to @c false once the first member of the document
+ *    is written
+ *
+ * Members are written as soon as their section is finished, so the memory
+ * for the document is bounded by its largest section and consumers can parse
+ * the finished sections while the remaining ones are still being gathered.
+ * The section is cleared after it is written.
+ */
+void JsonPresentation::flushSection(Json::Value &section, bool &firstMember) const
+{
+	StreamWriterBuilder builder;
+
+	for(const auto &member : section.getMemberNames())
+	{
+		std::cout << (firstMember ? "\n\t" : ",\n\t")
+				<< valueToQuotedString(member.c_str()) << " : "
+				<< writeString(builder, section[member]);
+		firstMember = false;
+	}
+
+	std::cout.flush();
+	section.clear();
+}
+
 bool JsonPresentation::present()
 {
-	Value root, jEp;
-	root["inputFile"] = fileinfo.getPathToFile();
-	presentErrors(root);
-	presentSimple(BasicJsonGetter(fileinfo), root);
+	Value section, jEp;
+	auto firstMember = true;
+	std::cout << "{";
+
+	section["inputFile"] = fileinfo.getPathToFile();
+	presentErrors(section);
+	presentSimple(BasicJsonGetter(fileinfo), section);
 	if(presentSimple(EntryPointJsonGetter(fileinfo), jEp))
 	{
-		root["entryPoint"] = jEp;
+		section["entryPoint"] = jEp;
 	}
-	presentCompiler(root);
-	presentLanguages(root);
-	presentOverlay(root);
+	presentCompiler(section);
+	presentLanguages(section);
+	presentOverlay(section);
+	flushSection(section, firstMember);
 
 	if(verbose)
 	{
 		std::string flags, title;
 		std::vector<std::string> desc, info;
 
-		presentPackingInfo(root);
+		presentPackingInfo(section);
 
 		HeaderJsonGetter headerInfo(fileinfo);
-		presentSimple(headerInfo, root);
+		presentSimple(headerInfo, section);
 		headerInfo.getFileFlags(title, flags, desc, info);
-		presentFlags(root, title, flags, desc);
+		presentFlags(section, title, flags, desc);
 		headerInfo.getDllFlags(title, flags, desc, info);
-		presentFlags(root, title, flags, desc);
+		presentFlags(section, title, flags, desc);
 		Value jPdb;
 		if(presentSimple(PdbJsonGetter(fileinfo), jPdb))
 		{
-			root["pdbInfo"] = jPdb;
+			section["pdbInfo"] = jPdb;
 		}
-
-		presentIterativeSubtitle(root, RichHeaderJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, DataDirectoryJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, SegmentJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, SectionJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, SymbolTablesJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, ImportTableJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, ExportTableJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, RelocationTablesJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, DynamicSectionsJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, ResourceJsonGetter(fileinfo));
-		presentIterativeSubtitle(root, CertificateTableJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+
+		presentIterativeSubtitle(section, RichHeaderJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, DataDirectoryJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, SegmentJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, SectionJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, SymbolTablesJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, ImportTableJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, ExportTableJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, RelocationTablesJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, DynamicSectionsJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, ResourceJsonGetter(fileinfo));
+		flushSection(section, firstMember);
+		presentIterativeSubtitle(section, CertificateTableJsonGetter(fileinfo));
 		const auto manifest = fileinfo.getCompactManifest();
 		if(!manifest.empty())
 		{
-			root["manifest"] = replaceNonasciiChars(manifest);
+			section["manifest"] = replaceNonasciiChars(manifest);
 		}
-		presentLoaderInfo(root);
-		presentPatterns(root);
-		presentCertificateAttributes(root);
-		presentDotnetInfo(root);
+		presentLoaderInfo(section);
+		presentPatterns(section);
+		presentCertificateAttributes(section);
+		presentDotnetInfo(section);
+		flushSection(section, firstMember);
 	}
 	else
 	{
-		presentRichHeader(root);
+		presentRichHeader(section);
 	}
 
-	presentIterativeSubtitle(root, StringsJsonGetter(fileinfo));
+	presentIterativeSubtitle(section, StringsJsonGetter(fileinfo));
+	flushSection(section, firstMember);
 
-	StreamWriterBuilder builder;
-	std::cout << writeString(builder, root) << std::endl;
+	std::cout << "\n}" << std::endl;
 	return true;
 }
 
@@ -35,6 +35,7 @@ class JsonPresentation : public FilePresentation
 		void presentFlags(Json::Value &root, const std::string &title, const std::string &flags, const std::vector<std::string> &desc) const;
 		void presentIterativeSubtitleStructure(Json::Value &root, const IterativeSubtitleGetter &getter, std::size_t structIndex) const;
 		void presentIterativeSubtitle(Json::Value &root, const IterativeSubtitleGetter &getter) const;
+		void flushSection(Json::Value &section, bool &firstMember) const;
 		/// @}
 	public:
 		JsonPresentation(FileInformation &fileinfo_, bool verbose_);
@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <regex>
+#include <thread>
 
 #include <llvm/Support/ErrorHandling.h>
 
@@ -41,6 +42,7 @@ struct ProgParams
 	SearchType searchMode;                  ///< type of search
 	bool internalDatabase;                  ///< use of internal signature database
 	bool externalDatabase;                  ///< use of external signature database
+	bool triage;                            ///< stop detection after first strong detection
 	bool plainText;                         ///< print output as plain text
 	bool verbose;                           ///< print all detected information (except strings)
 	bool explanatory;                       ///< print explanatory notes
@@ -56,6 +58,7 @@ struct ProgParams
 	ProgParams() : searchMode(SearchType::EXACT_MATCH),
 					internalDatabase(true),
 					externalDatabase(false),
+					triage(false),
 					plainText(true),
 					verbose(false),
 					explanatory(false),
@@ -121,6 +124,10 @@ void printHelp()
 				<< "    --sim-list, -l        Write list of similarities of all compilers and\n"
 				<< "                          packers in database.\n"
 				<< "\n"
+				<< "Option specifying scope of compiler or packer detection:\n"
+				<< "    --triage, -t          Report only the most probable tool. Detection\n"
+				<< "                          heuristics stop after the first strong detection.\n"
+				<< "\n"
 				<< "Options specifying signatures database:\n"
 				<< "  If no option from this group is used, program uses neither of them.\n"
 				<< "    --no-internal, -n     Do not use internal signatures database.\n"
@@ -251,6 +258,10 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 		{
 			params.searchMode = SearchType::SIM_LIST;
 		}
+		else if (c == "-t" || c == "--triage")
+		{
+			params.triage = true;
+		}
 		else if (c == "-n" || c == "--no-internal")
 		{
 			params.internalDatabase = false;
@@ -359,6 +370,33 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 	return true;
 }
 
+/**
+ * Derive the selection of gathered information from the output specification
+ * @param params Program parameters
+ * @return Selection of information groups to gather
+ *
+ * Non-verbose output presents only the basic overview, compiler detection,
+ * rich header, overlay and strings, so the remaining groups do not have to
+ * be gathered at all. The generated config file also needs nothing beyond
+ * the basic and compiler information.
+ */
+InformationSelection selectInformation(const ProgParams &params)
+{
+	InformationSelection selection;
+	if(!params.verbose)
+	{
+		selection.pdbInfo = false;
+		selection.resources = false;
+		selection.manifest = false;
+		selection.imports = false;
+		selection.exports = false;
+		selection.additionalInfo = false;
+		selection.certificates = false;
+		selection.loaderInfo = false;
+	}
+	return selection;
+}
+
 /**
 * Limits the maximal memory of the tool based on the command-line parameters.
 */
@@ -397,13 +435,28 @@ int main(int argc, char* argv[])
 
 	limitMaximalMemoryIfRequested(params);
 
+	if(!params.verbose)
+	{
+		// verbose hashes (sections, resources, imports) are never presented
+		// in non-verbose output, so do not compute them
+		params.loadFlags = static_cast<LoadFlags>(params.loadFlags
+				| LoadFlags::NO_VERBOSE_HASHES);
+	}
+
+	// Certificates are presented near the end of the output, so let their
+	// crypto-heavy processing run in the background while the rest of the
+	// file is analyzed; the task is joined on the first access to the
+	// certificate table.
+	params.loadFlags = static_cast<LoadFlags>(params.loadFlags
+			| LoadFlags::ASYNC_CERTIFICATES);
+
 	bool useConfig = true;
 	retdec::config::Config config;
 	if(params.generateConfigFile && !params.configFile.empty())
 	{
 		try
 		{
-			config.readJsonFile(params.configFile);
+			config.readFile(params.configFile);
 		}
 		catch (const retdec::config::FileNotFoundException&)
 		{
@@ -415,7 +468,7 @@ int main(int argc, char* argv[])
 		}
 	}
 
-	DetectParams searchPar(params.searchMode, params.internalDatabase, params.externalDatabase);
+	DetectParams searchPar(params.searchMode, params.internalDatabase, params.externalDatabase, params.triage);
 	const auto fileFormat = detectFileFormat(params.filePath, useConfig ? &config : nullptr);
 	FileInformation fileinfo;
 	FileDetector *fileDetector = nullptr;
@@ -456,7 +509,6 @@ int main(int argc, char* argv[])
 				{
 					fileDetector->setConfigFile(config);
 				}
-				fileDetector->getAllInformation();
 			}
 			else
 			{
@@ -473,7 +525,19 @@ int main(int argc, char* argv[])
 			patternDetector.addFilePaths("malware", params.yaraMalwarePaths);
 			patternDetector.addFilePaths("crypto", params.yaraCryptoPaths);
 			patternDetector.addFilePaths("other", params.yaraOtherPaths);
-			patternDetector.analyze();
+			if(fileDetector)
+			{
+				// YARA pattern matching reads only the input file and fills
+				// the pattern lists nothing else touches, so it can overlap
+				// with the gathering of file information
+				std::thread patternThread(&PatternDetector::analyze, &patternDetector);
+				fileDetector->getAllInformation(selectInformation(params));
+				patternThread.join();
+			}
+			else
+			{
+				patternDetector.analyze();
+			}
 		}
 	}
 
@@ -4,11 +4,16 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <fstream>
 #include <regex>
+#include <thread>
+
+#include <sys/stat.h>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/filesystem_path.h"
 #include "retdec/utils/string.h"
+#include "retdec/yara-cache/yara_cache.h"
 #include "fileinfo/pattern_detector/pattern_detector.h"
 
 using namespace retdec::utils;
@@ -16,6 +21,62 @@ using namespace yaracpp;
 
 namespace fileinfo {
 
+namespace
+{
+
+/// Name of the manifest of rule files generated in a rule directory at
+/// install time.
+const std::string RULE_MANIFEST_NAME = "yara-rules.manifest";
+
+/**
+ * Read the manifest of rule files of the given directory
+ * @param dirPath Path to the directory with rule files
+ * @param files Into this parameter the paths to the listed rule files are added
+ * @return @c true if the directory has a usable manifest, @c false otherwise
+ *
+ * The manifest is generated at install time (one tab-separated line with the
+ * size, the content hash and the name of every rule file) so rule directories
+ * do not have to be enumerated on every run. A manifest older than its
+ * directory is considered stale -- adding or removing rule files updates the
+ * directory, and the caller falls back to enumeration.
+ */
+bool readRuleManifest(const std::string &dirPath, std::set<std::string> &files)
+{
+	FilesystemPath manifestPath(dirPath);
+	manifestPath.append(RULE_MANIFEST_NAME);
+
+	struct stat manifestStat, dirStat;
+	if(stat(manifestPath.getPath().c_str(), &manifestStat) != 0
+		|| stat(dirPath.c_str(), &dirStat) != 0
+		|| dirStat.st_mtime > manifestStat.st_mtime)
+	{
+		return false;
+	}
+
+	std::ifstream manifest(manifestPath.getPath());
+	if(!manifest.is_open())
+	{
+		return false;
+	}
+
+	for(std::string line; std::getline(manifest, line);)
+	{
+		const auto namePos = line.find_last_of('\t');
+		if(namePos == std::string::npos || namePos + 1 == line.length())
+		{
+			continue;
+		}
+
+		FilesystemPath filePath(dirPath);
+		filePath.append(line.substr(namePos + 1));
+		files.insert(filePath.getPath());
+	}
+
+	return true;
+}
+
+} // anonymous namespace
+
 /**
  * Constructor
  * @param fparser Pointer to file parser
@@ -324,6 +385,13 @@ void PatternDetector::addFilePaths(const std::string &category, const std::set<s
 			continue;
 		}
 
+		// Prefer the manifest generated at install time over enumerating the
+		// directory.
+		if(readRuleManifest(item, actCategory->second))
+		{
+			continue;
+		}
+
 		for(const auto &file : actDir)
 		{
 			const auto path = file->getPath();
@@ -340,24 +408,61 @@ void PatternDetector::addFilePaths(const std::string &category, const std::set<s
  */
 void PatternDetector::analyze()
 {
+	// Categories without any rule file would just uselessly open and scan
+	// the input file, so leave them out.
+	std::vector<const std::pair<std::string, std::set<std::string>>*> usedCategories;
 	for(const auto &category : categories)
 	{
-		YaraDetector yara;
+		if(!category.second.empty())
+		{
+			usedCategories.push_back(&category);
+		}
+	}
 
-		for(const auto &item : category.second)
+	// Prepare a detector for every category. The rules are added through the
+	// compiled-rule cache, so textual rule files (most notably the large
+	// crypto-constant signatures) are compiled just once and shared with the
+	// other users of the cache. The detectors are created and the rules
+	// compiled on the current thread since the initialization of libyara is
+	// not thread-safe.
+	std::vector<YaraDetector> detectors(usedCategories.size());
+	for(std::size_t i = 0; i < usedCategories.size(); ++i)
+	{
+		for(const auto &item : usedCategories[i]->second)
 		{
-			yara.addRuleFile(item);
+			detectors[i].addRuleFile(retdec::yara_cache::getCompiledRuleFile(item));
 		}
+	}
 
-		yara.analyze(fileinfo.getPathToFile());
+	// Scan the input file. The scans only read the file and each of them
+	// fills just its own detector, so the categories can be scanned
+	// concurrently (there are at most three). The first category is scanned
+	// on the current thread.
+	std::vector<std::thread> threads;
+	for(std::size_t i = 1; i < detectors.size(); ++i)
+	{
+		threads.emplace_back([this, &detectors, i] {
+			detectors[i].analyze(fileinfo.getPathToFile());
+		});
+	}
+	if(!detectors.empty())
+	{
+		detectors[0].analyze(fileinfo.getPathToFile());
+	}
+	for(auto &thread : threads)
+	{
+		thread.join();
+	}
 
-		for(const auto &rule : yara.getDetectedRules())
+	for(std::size_t i = 0; i < usedCategories.size(); ++i)
+	{
+		for(const auto &rule : detectors[i].getDetectedRules())
 		{
-			if(category.first == "crypto")
+			if(usedCategories[i]->first == "crypto")
 			{
 				saveCryptoRule(rule);
 			}
-			else if(category.first == "malware")
+			else if(usedCategories[i]->first == "malware")
 			{
 				saveMalwareRule(rule);
 			}
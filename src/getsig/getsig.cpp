@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <iostream>
 #include <vector>
@@ -11,6 +13,7 @@
 #include "retdec/fileformat/format_factory.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
+#include "retdec/utils/thread_pool.h"
 
 using namespace retdec::fileformat;
 using namespace retdec::utils;
@@ -270,31 +273,28 @@ bool doParams(
 
 
 /**
- * Get length of shortest string in given vector.
- * @param inputs vector of strings
- * @return length of shortest string or 0
+ * Combine two patterns into pattern matching both of them.
+ * @param first first pattern
+ * @param second second pattern
+ * @return combined pattern
  *
- * If input vector is empty, function returns 0.
+ * Nibbles on positions where patterns differ are replaced by '?'. Result
+ * is truncated to length of shorter pattern.
  */
-std::size_t getShortestLength(
-		const std::vector<std::string> &inputs)
+std::string combinePatterns(
+		const std::string& first,
+		const std::string& second)
 {
-	if (inputs.empty())
-	{
-		return 0;
-	}
-
-	auto min = std::numeric_limits<std::size_t>::max();
-	for (const auto& input :inputs)
+	const auto length = std::min(first.length(), second.length());
+	std::string result;
+	result.reserve(length);
+	for (std::size_t i = 0; i < length; ++i)
 	{
-		const auto& length = input.length();
-		if (length < min)
-		{
-			min = length;
-		}
+		// Add nibble or '?' if nibbles differ.
+		result += first[i] == second[i] ? first[i] : '?';
 	}
 
-	return min;
+	return result;
 }
 
 
@@ -305,32 +305,44 @@ std::size_t getShortestLength(
  */
 std::string createSignature(const std::vector<std::string> &contents)
 {
-	const auto length = getShortestLength(contents);
-	if (!length)
+	if (contents.empty() || contents.front().empty())
 	{
 		// No data are available.
 		return std::string();
 	}
 
-	std::string pattern;
-	for (std::size_t i = 0; i < length; ++i)
+	// Combine contents by parallel tree reduction - every round halves the
+	// number of patterns by combining adjacent pairs.
+	std::vector<std::string> patterns = contents;
+	while (patterns.size() > 1)
 	{
-		bool insignificant = false;
-		for (std::size_t j = 1, f = contents.size(); j < f; ++j)
+		std::vector<std::string> combined((patterns.size() + 1) / 2);
+		std::atomic<std::size_t> nextPair(0);
+		auto worker = [&] ()
 		{
-			if (contents[0][i] != contents[j][i])
+			std::size_t i;
+			while ((i = nextPair++) < combined.size())
 			{
-				insignificant = true;
-				break;
+				combined[i] = 2 * i + 1 < patterns.size()
+						? combinePatterns(patterns[2 * i], patterns[2 * i + 1])
+						: std::move(patterns[2 * i]);
 			}
-		}
+		};
 
-		// Add nibble or '?' if nibbles differ.
-		pattern += !insignificant ? contents[0][i] : '?';
+		runWorkers(combined.size(), worker);
+		patterns = std::move(combined);
+
+		// Early cutoff - once only wildcards are left, no further round can
+		// make the pattern any more specific.
+		if (patterns.front().find_first_not_of('?') == std::string::npos)
+		{
+			return std::string();
+		}
 	}
+	std::string pattern = std::move(patterns.front());
 
 	// Remove trailing insignificant nibbles.
-	std::size_t index = length - 1;
+	std::size_t index = pattern.length() - 1;
 	while (index > 0 && pattern[index] == '?')
 	{
 		pattern.erase(index, 1);
@@ -347,6 +359,64 @@ std::string createSignature(const std::vector<std::string> &contents)
 }
 
 
+/**
+ * Result of loading content of one input file.
+ */
+struct FileContent
+{
+	public:
+		bool parsed = false;       ///< @c true if file was successfully parsed
+		bool epProblem = false;    ///< @c true if entry point offset was not found
+		bool dataProblem = false;  ///< @c true if bytes could not be read
+		Format format = Format::UNKNOWN; ///< detected file format
+		std::string content;       ///< bytes at search offset
+};
+
+
+/**
+ * Load contents of all input files in parallel.
+ * @param options application options
+ * @return loaded contents in order of input files
+ */
+std::vector<FileContent> loadFileContents(const Options& options)
+{
+	std::vector<FileContent> results(options.input.size());
+	std::atomic<std::size_t> nextInput(0);
+	auto worker = [&] ()
+	{
+		std::size_t i;
+		while ((i = nextInput++) < options.input.size())
+		{
+			auto& result = results[i];
+			auto fileParser = createFileFormat(options.input[i]);
+			if (!fileParser)
+			{
+				continue;
+			}
+
+			result.parsed = true;
+			result.format = fileParser->getFileFormat();
+
+			long long unsigned offset = options.isOffset ? options.offset : 0;
+			if (!options.isOffset && !fileParser->getEpOffset(offset))
+			{
+				result.epProblem = true;
+				continue;
+			}
+
+			if (!fileParser->getHexBytes(result.content, offset, options.size))
+			{
+				result.dataProblem = true;
+			}
+		}
+	};
+
+	runWorkers(options.input.size(), worker);
+
+	return results;
+}
+
+
 /**
  * Form entry point condition from format.
  * @param format file format
@@ -464,47 +534,48 @@ int main(int argc, char** argv) {
 		return printError("invalid arguments");
 	}
 
+	// Files are parsed in parallel, warnings and format resolution keep the
+	// original input order.
+	auto fileContents = loadFileContents(options);
+
 	Format format = Format::UNKNOWN;
 	std::vector<std::string> contents;
-	for (const auto& path : options.input)
+	for (std::size_t i = 0; i < options.input.size(); ++i)
 	{
-		auto fileParser = createFileFormat(path);
-		if (!fileParser)
+		const auto& path = options.input[i];
+		auto& fileContent = fileContents[i];
+		if (!fileContent.parsed)
 		{
 			printWarning("skipping '" + path + "' - invalid file");
 			continue;
 		}
 
 		// Format must be same for all files.
-		auto actualFormat = fileParser->getFileFormat();
 		if (format == Format::UNKNOWN)
 		{
 			// Set format from first file.
-			format = actualFormat;
+			format = fileContent.format;
 		}
-		if (format != actualFormat)
+		if (format != fileContent.format)
 		{
 			// Ignore files with other formats.
 			printWarning("skipping '" + path + "' - format mismatch");
 			continue;
 		}
 
-		if (!options.isOffset && !fileParser->getEpOffset(options.offset))
+		if (fileContent.epProblem)
 		{
 			printWarning("skipping '" + path + "' - EP problem");
 			continue;
 		}
 
-		std::string content;
-		if (!fileParser->getHexBytes(content, options.offset, options.size))
+		if (fileContent.dataProblem)
 		{
 			printWarning("skipping '" + path + "' - data problem");
 			continue;
 		}
-		else
-		{
-			contents.push_back(content);
-		}
+
+		contents.push_back(std::move(fileContent.content));
 	}
 
 	if (contents.empty())
@@ -5,15 +5,16 @@
  */
 
 #include <cstdint>
-#include <fstream>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
-#include <istream>
 #include <map>
 #include <set>
+#include <sstream>
 #include <vector>
 
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/memory_mapped_file.h"
 #include "yaramod/builder/yara_expression_builder.h"
 #include "yaramod/builder/yara_hex_string_builder.h"
 #include "yaramod/builder/yara_rule_builder.h"
@@ -27,70 +28,137 @@ using namespace yaramod;
 using Relocation = std::pair<std::uint32_t, std::string>;
 
 /**
- * Get one WORD from input stream.
+ * Bounds-checked reader over memory-mapped KB content.
  *
- * @param result where to store result
- * @param inputStream stream with correct position
- * @return @c true if value was read, @c false otherwise
+ * Records are extracted by seeking to their offset in the mapping - no
+ * byte of the KB is copied or even paged in until it is actually read.
+ * Once any read runs out of bounds, the reader stays invalid, same as
+ * a stream with the fail bit set.
  */
-bool getWord(
-		std::uint16_t &result,
-		std::ifstream &inputStream)
+class KbReader
 {
-	inputStream.read(reinterpret_cast<char*>(&result), sizeof(std::uint16_t));
-	return inputStream.good();
-}
+	public:
+		KbReader(const std::uint8_t* kbData, std::size_t kbSize) :
+				data(kbData), size(kbSize)
+		{
+		}
 
-/**
- * Get one DWORD from input stream.
- *
- * @param result where to store result
- * @param inputStream stream with correct position
- * @return @c true if value was read, @c false otherwise
- */
-bool getDword(
-		std::uint32_t &result,
-		std::ifstream &inputStream)
-{
-	inputStream.read(reinterpret_cast<char*>(&result), sizeof(std::uint32_t));
-	return inputStream.good();
-}
+		/**
+		 * Get @a count raw bytes from actual position.
+		 *
+		 * @param result where to store bytes
+		 * @param count number of bytes to read
+		 * @return @c true if bytes were read, @c false otherwise
+		 */
+		bool read(void* result, std::size_t count)
+		{
+			if (!valid || position > size || count > size - position) {
+				valid = false;
+				return false;
+			}
+
+			std::memcpy(result, data + position, count);
+			position += count;
+			return true;
+		}
 
-/**
- * Get zero terminated string with size information from input stream.
- *
- * @param result where to store result
- * @param inputStream stream with correct position
- * @return @c true if value was read, @c false otherwise
- */
-bool getString(
-		std::string &result,
-		std::ifstream &inputStream)
-{
-	std::uint16_t size = 0;
-	if (!getWord(size, inputStream)) {
-		return false;
-	}
+		/**
+		 * Get one WORD from actual position.
+		 *
+		 * @param result where to store result
+		 * @return @c true if value was read, @c false otherwise
+		 */
+		bool getWord(std::uint16_t &result)
+		{
+			return read(&result, sizeof(std::uint16_t));
+		}
+
+		/**
+		 * Get one DWORD from actual position.
+		 *
+		 * @param result where to store result
+		 * @return @c true if value was read, @c false otherwise
+		 */
+		bool getDword(std::uint32_t &result)
+		{
+			return read(&result, sizeof(std::uint32_t));
+		}
 
-	result.resize(size);
-	inputStream.read(&result[0], size);
+		/**
+		 * Get zero terminated string with size information from actual
+		 * position.
+		 *
+		 * @param result where to store result
+		 * @return @c true if value was read, @c false otherwise
+		 */
+		bool getString(std::string &result)
+		{
+			std::uint16_t stringSize = 0;
+			if (!getWord(stringSize)) {
+				return false;
+			}
+
+			result.resize(stringSize);
+			if (!read(&result[0], stringSize)) {
+				return false;
+			}
+
+			skip(1); // Eat terminating character.
+			return valid;
+		}
 
-	inputStream.get(); // Eat terminating character.
-	return inputStream.good();
-}
+		/**
+		 * Set actual position to given offset.
+		 *
+		 * @param offset offset from start of KB
+		 */
+		void seek(std::size_t offset)
+		{
+			position = offset;
+		}
 
-/**
- * Skip N bytes in input stream at actual position.
- *
- * @param N number of bytes to skip
- * @param inputStream stream with correct position
- */
-void skip(
-		const std::size_t &N,
-		std::ifstream &inputStream)
-{
-	inputStream.seekg(inputStream.tellg() + std::istream::pos_type(N));
-}
+		/**
+		 * Skip N bytes at actual position.
+		 *
+		 * @param N number of bytes to skip
+		 */
+		void skip(std::size_t N)
+		{
+			if (N > size - position || position > size) {
+				position = size;
+				valid = false;
+			}
+			else {
+				position += N;
+			}
+		}
+
+		/**
+		 * Get size of KB content.
+		 *
+		 * @return size in bytes
+		 */
+		std::size_t getSize() const
+		{
+			return size;
+		}
+
+		/**
+		 * Check reader state.
+		 *
+		 * @return @c true if no read failed so far, @c false otherwise
+		 */
+		explicit operator bool() const
+		{
+			return valid;
+		}
+
+	private:
+		const std::uint8_t* data; ///< start of KB content
+		std::size_t size;         ///< size of KB content in bytes
+		std::size_t position = 0; ///< actual read position
+		bool valid = true;        ///< no read failed so far
+};
 
 /**
  * Get string from relocations.
@@ -119,37 +187,39 @@ std::string getRelocationsAsString(
 /**
  * Read one function or procedure from KB.
  *
- * @param inputStream stream with correct position
+ * @param reader reader with correct position
  * @param index index of function
+ * @param output where to emit pattern rule
  */
 void readFunction(
-		std::ifstream &inputStream,
-		const std::size_t &index)
+		KbReader &reader,
+		const std::size_t &index,
+		std::ostream &output)
 {
 	// Skip (for now) unused fields.
-	skip(2, inputStream);
+	reader.skip(2);
 
 	// Read function name.
 	std::string name;
-	getString(name, inputStream);
+	reader.getString(name);
 
 	// Skip (for now) unused fields.
-	skip(8, inputStream);
+	reader.skip(8);
 
 	// Skip (for now) unused string.
 	std::string returnType;
-	getString(returnType, inputStream);
+	reader.getString(returnType);
 
 	// Skip (for now) unused fields.
-	skip(4, inputStream);
+	reader.skip(4);
 
 	// Read dump size.
 	std::uint32_t size = 0;
-	getDword(size, inputStream);
+	reader.getDword(size);
 
 	// Read number of fix-ups.
 	std::uint32_t fixCount = 0;
-	getDword(fixCount, inputStream);
+	reader.getDword(fixCount);
 
 	// Skip empty names and dumps.
 	if (!size || name.empty()) {
@@ -158,20 +228,20 @@ void readFunction(
 
 	// Read dump and relocation map (same size).
 	std::vector<std::uint8_t> dump(size);
-	inputStream.read(reinterpret_cast<char*>(&dump[0]), size);
+	reader.read(&dump[0], size);
 	std::vector<std::uint8_t> relocationMap(size);
-	inputStream.read(reinterpret_cast<char*>(&relocationMap[0]), size);
+	reader.read(&relocationMap[0], size);
 
 	// Read relocations.
 	std::set<std::string> usedNames;
 	std::vector<Relocation> relocations;
 	for (std::size_t i = 0; i < fixCount; ++i) {
 		// Skip (for now) unused fields.
-		skip(1, inputStream);
+		reader.skip(1);
 
 		// Read offset and check for position validity.
 		std::uint32_t fixOffset = 0;
-		getDword(fixOffset, inputStream);
+		reader.getDword(fixOffset);
 		if (fixOffset >= size) {
 			// This happens sometimes - safe to ignore.
 			continue;
@@ -179,7 +249,7 @@ void readFunction(
 
 		// Read name and check for duplicates.
 		std::string fixName;
-		getString(fixName, inputStream);
+		reader.getString(fixName);
 		if (usedNames.find(fixName) == usedNames.end()) {
 			// Create relocation and remember name.
 			usedNames.insert(fixName);
@@ -187,8 +257,8 @@ void readFunction(
 		}
 	}
 
-	// Check buffer state before writing rule.
-	if (!inputStream) {
+	// Check reader state before writing rule.
+	if (!reader) {
 		return;
 	}
 
@@ -217,75 +287,77 @@ void readFunction(
 	ruleBuilder.withHexString("$1", hexBuilder.get());
 	ruleBuilder.withCondition(stringRef("$1").get());
 
-	std::cout << ruleBuilder.get()->getText() << "\n";
+	output << ruleBuilder.get()->getText() << "\n";
 }
 
 /**
  * Read database and print function rules.
  *
- * @param inputStream source input stream
+ * @param reader reader over KB content
  * @param errorMessage possible error message if @c false is returned
  * @return @c true if information was read correctly, @c false otherwise
  */
 bool readDatabase(
-		std::ifstream &inputStream,
+		KbReader &reader,
 		std::string &errorMessage)
 {
 	// Position of section offsets - last 4 bytes.
-	inputStream.seekg(-4, std::ios_base::end);
+	reader.seek(reader.getSize() - 4);
 
 	// Read entry point position.
 	std::uint32_t entryPoint;
-	getDword(entryPoint, inputStream);
+	reader.getDword(entryPoint);
 
-	// Reset eof bit and go to the entry point.
-	inputStream.clear();
-	inputStream.seekg(entryPoint);
+	// Go to the entry point.
+	reader.seek(entryPoint);
 
 	// Skip (for now) unused fields.
 	std::uint32_t toSkip;
 	// Module definitions.
-	getDword(toSkip, inputStream);
-	skip(toSkip * 16 + 4, inputStream);
+	reader.getDword(toSkip);
+	reader.skip(toSkip * 16 + 4);
 	// Constants definitions.
-	getDword(toSkip, inputStream);
-	skip(toSkip * 16 + 4, inputStream);
+	reader.getDword(toSkip);
+	reader.skip(toSkip * 16 + 4);
 	// Types definitions.
-	getDword(toSkip, inputStream);
-	skip(toSkip * 16 + 4, inputStream);
+	reader.getDword(toSkip);
+	reader.skip(toSkip * 16 + 4);
 	// Variables definitions.
-	getDword(toSkip, inputStream);
-	skip(toSkip * 16 + 4, inputStream);
+	reader.getDword(toSkip);
+	reader.skip(toSkip * 16 + 4);
 	// String definitions.
-	getDword(toSkip, inputStream);
-	skip(toSkip * 16 + 4, inputStream);
+	reader.getDword(toSkip);
+	reader.skip(toSkip * 16 + 4);
 
-	// Read function offsets.
+	// Read function count.
 	std::uint32_t functionCount;
-	getDword(functionCount, inputStream);
+	reader.getDword(functionCount);
 
 	// Skip (for now) unused fields.
-	skip(4, inputStream);
+	reader.skip(4);
 
-	// Read function offsets.
+	// Build index over the function record table.
 	std::vector<std::uint32_t> functionOffsets(functionCount);
 	for (std::size_t i = 0; i < functionCount; ++i) {
-		getDword(functionOffsets[i], inputStream);
-		skip(12, inputStream);
+		reader.getDword(functionOffsets[i]);
+		reader.skip(12);
 	}
 
-	// Check buffer.
-	if (!inputStream) {
+	// Check reader state.
+	if (!reader) {
 		errorMessage = "could not read function offsets";
 		return false;
 	}
 
-	// Read functions.
+	// Extract function records by their indexed offsets and emit patterns
+	// in one batch.
+	std::ostringstream output;
 	std::size_t functionIndex = 0;
 	for (const auto &offset : functionOffsets) {
-		inputStream.seekg(offset);
-		readFunction(inputStream, functionIndex++);
+		reader.seek(offset);
+		readFunction(reader, functionIndex++, output);
 	}
+	std::cout << output.str();
 
 	return true;
 }
@@ -308,19 +380,22 @@ int main(int argc, char** argv)
 		return printError("need one argument - KB path");
 	}
 
-	std::ifstream inputFile(argv[1], std::ios::binary);
-	if (!inputFile) {
+	MemoryMappedFile inputFile;
+	if (!inputFile.map(argv[1])) {
 		return printError("could not open input file");
 	}
+	inputFile.advise(MemoryMappedFile::AccessPattern::Sequential);
+
+	KbReader reader(inputFile.getData(), inputFile.getSize());
 
 	char magic[25] = {};
-	inputFile.read(magic, 24);
+	reader.read(magic, 24);
 	if (std::string(magic) != "IDR Knowledge Base File") {
 		return printError("file is not IDR database file");
 	}
 
 	std::string errorMessage;
-	if (!readDatabase(inputFile, errorMessage)) {
+	if (!readDatabase(reader, errorMessage)) {
 		return printError(errorMessage);
 	}
 
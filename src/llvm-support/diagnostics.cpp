@@ -10,6 +10,8 @@
 
 #include "retdec/llvm-support/diagnostics.h"
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/event_log.h"
+#include "retdec/utils/instrumentation.h"
 #include "retdec/utils/time.h"
 
 using retdec::utils::getElapsedTime;
@@ -35,10 +37,29 @@ std::string formatElapsedTime(double elapsedTime) {
 /**
 * @brief Prints the given phase to the given stream with the given prefix.
 *
-* This function is used to implement the print*Phase() functions.
+* This function is used to implement the print*Phase() and report*Phase()
+* functions. When @a print is @c false, the phase is only recorded -- into
+* the event log and the instrumentation -- and nothing is formatted.
 */
 void printPrefixedPhase(const std::string &prefix, const std::string &phaseName,
-		llvm::raw_ostream &stream) {
+		llvm::raw_ostream &stream, unsigned depth, bool print = true) {
+	// Feed the phase into the binary event log (a no-op unless RETDEC_TRACE
+	// is set), so production runs can be correlated with their phase traces.
+	static retdec::utils::event_log::Site phaseSite(
+		"llvm-support/phase", /* arg0IsText */ true);
+	if (retdec::utils::event_log::isEnabled()) {
+		retdec::utils::event_log::record(phaseSite,
+			retdec::utils::event_log::internText(phaseName), depth);
+	}
+
+	// Also feed the phase into the machine-readable instrumentation (a no-op
+	// unless RETDEC_PROFILE is set).
+	retdec::utils::instrumentation::recordPhaseTransition(phaseName, depth);
+
+	if (!print) {
+		return;
+	}
+
 	printColoredLine(stream, llvm::raw_ostream::YELLOW, /* bold */ true, prefix,
 		phaseName, " ( ", formatElapsedTime(getElapsedTime()), "s )");
 
@@ -54,7 +75,7 @@ void printPrefixedPhase(const std::string &prefix, const std::string &phaseName,
 * A new line is appended after the emitted text and the stream is flushed.
 */
 void printPhase(const std::string &phaseName, llvm::raw_ostream &stream) {
-	printPrefixedPhase("Running phase: ", phaseName, stream);
+	printPrefixedPhase("Running phase: ", phaseName, stream, 0);
 }
 
 /**
@@ -63,7 +84,7 @@ void printPhase(const std::string &phaseName, llvm::raw_ostream &stream) {
 * A new line is appended after the emitted text and the stream is flushed.
 */
 void printSubPhase(const std::string &phaseName, llvm::raw_ostream &stream) {
-	printPrefixedPhase(" -> ", phaseName, stream);
+	printPrefixedPhase(" -> ", phaseName, stream, 1);
 }
 
 /**
@@ -72,7 +93,7 @@ void printSubPhase(const std::string &phaseName, llvm::raw_ostream &stream) {
 * A new line is appended after the emitted text and the stream is flushed.
 */
 void printSubSubPhase(const std::string &phaseName, llvm::raw_ostream &stream) {
-	printPrefixedPhase("     -> ", phaseName, stream);
+	printPrefixedPhase("     -> ", phaseName, stream, 2);
 }
 
 /**
@@ -81,7 +102,42 @@ void printSubSubPhase(const std::string &phaseName, llvm::raw_ostream &stream) {
 * A new line is appended after the emitted text and the stream is flushed.
 */
 void printSubSubSubPhase(const std::string &phaseName, llvm::raw_ostream &stream) {
-	printPrefixedPhase("         -> ", phaseName, stream);
+	printPrefixedPhase("         -> ", phaseName, stream, 3);
+}
+
+/**
+* @brief Records the given phase, printing it only when @a print is @c true.
+*/
+void reportPhase(bool print, const std::string &phaseName,
+		llvm::raw_ostream &stream) {
+	printPrefixedPhase("Running phase: ", phaseName, stream, 0, print);
+}
+
+/**
+* @brief Records the given sub-phase, printing it only when @a print is
+*        @c true.
+*/
+void reportSubPhase(bool print, const std::string &phaseName,
+		llvm::raw_ostream &stream) {
+	printPrefixedPhase(" -> ", phaseName, stream, 1, print);
+}
+
+/**
+* @brief Records the given sub-sub-phase, printing it only when @a print is
+*        @c true.
+*/
+void reportSubSubPhase(bool print, const std::string &phaseName,
+		llvm::raw_ostream &stream) {
+	printPrefixedPhase("     -> ", phaseName, stream, 2, print);
+}
+
+/**
+* @brief Records the given sub-sub-sub-phase, printing it only when @a print
+*        is @c true.
+*/
+void reportSubSubSubPhase(bool print, const std::string &phaseName,
+		llvm::raw_ostream &stream) {
+	printPrefixedPhase("         -> ", phaseName, stream, 3, print);
 }
 
 } // namespace llvm_support
@@ -2198,8 +2198,7 @@ llvm::GenericValue GlobalExecutionContext::getMemory(uint64_t addr, bool log)
 		memoryLoads.push_back(addr);
 	}
 
-	auto fIt = memory.find(addr);
-	return fIt != memory.end() ? fIt->second : GenericValue();
+	return memory.get(addr);
 }
 
 void GlobalExecutionContext::setMemory(
@@ -2212,7 +2211,7 @@ void GlobalExecutionContext::setMemory(
 		memoryStores.push_back(addr);
 	}
 
-	memory[addr] = val;
+	memory.set(addr, val);
 }
 
 llvm::GenericValue GlobalExecutionContext::getGlobal(
@@ -2257,7 +2256,14 @@ llvm::GenericValue GlobalExecutionContext::getOperandValue(
 	}
 	else if (Constant* cpv = dyn_cast<Constant>(val))
 	{
-		return getConstantValue(cpv, getModule());
+		auto fIt = constants.find(cpv);
+		if (fIt != constants.end())
+		{
+			return fIt->second;
+		}
+		auto gv = getConstantValue(cpv, getModule());
+		constants.emplace(cpv, gv);
+		return gv;
 	}
 	else if (isa<GlobalValue>(val))
 	{
@@ -2396,44 +2402,32 @@ void LlvmIrEmulator::run()
 void LlvmIrEmulator::logInstruction(llvm::Instruction* i)
 {
 	_visitedInsns.push_back(i);
+	_visitedInsnsSet.insert(i);
 	if (_visitedBbs.empty() || i->getParent() != _visitedBbs.back())
 	{
 		_visitedBbs.push_back(i->getParent());
+		_visitedBbsSet.insert(i->getParent());
 	}
 }
 
-const std::list<llvm::Instruction*>& LlvmIrEmulator::getVisitedInstructions() const
+const std::vector<llvm::Instruction*>& LlvmIrEmulator::getVisitedInstructions() const
 {
 	return _visitedInsns;
 }
 
-const std::list<llvm::BasicBlock*>& LlvmIrEmulator::getVisitedBasicBlocks() const
+const std::vector<llvm::BasicBlock*>& LlvmIrEmulator::getVisitedBasicBlocks() const
 {
 	return _visitedBbs;
 }
 
 bool LlvmIrEmulator::wasInstructionVisited(llvm::Instruction* i) const
 {
-	for (auto* vi : getVisitedInstructions())
-	{
-		if (vi == i)
-		{
-			return true;
-		}
-	}
-	return false;
+	return _visitedInsnsSet.count(i);
 }
 
 bool LlvmIrEmulator::wasBasicBlockVisited(llvm::BasicBlock* bb) const
 {
-	for (auto* vbb : getVisitedBasicBlocks())
-	{
-		if (vbb == bb)
-		{
-			return true;
-		}
-	}
-	return false;
+	return _visitedBbsSet.count(bb);
 }
 
 llvm::GenericValue LlvmIrEmulator::getExitValue() const
@@ -2523,7 +2517,8 @@ bool LlvmIrEmulator::wasGlobalVariableStored(llvm::GlobalVariable* gv)
 
 std::list<llvm::GlobalVariable*> LlvmIrEmulator::getLoadedGlobalVariables()
 {
-	return _globalEc.globalsLoads;
+	auto& l = _globalEc.globalsLoads;
+	return std::list<GlobalVariable*>(l.begin(), l.end());
 }
 
 std::set<llvm::GlobalVariable*> LlvmIrEmulator::getLoadedGlobalVariablesSet()
@@ -2534,7 +2529,8 @@ std::set<llvm::GlobalVariable*> LlvmIrEmulator::getLoadedGlobalVariablesSet()
 
 std::list<llvm::GlobalVariable*> LlvmIrEmulator::getStoredGlobalVariables()
 {
-	return _globalEc.globalsStores;
+	auto& l = _globalEc.globalsStores;
+	return std::list<GlobalVariable*>(l.begin(), l.end());
 }
 
 std::set<llvm::GlobalVariable*> LlvmIrEmulator::getStoredGlobalVariablesSet()
@@ -2570,7 +2566,8 @@ bool LlvmIrEmulator::wasMemoryStored(uint64_t addr)
 
 std::list<uint64_t> LlvmIrEmulator::getLoadedMemory()
 {
-	return _globalEc.memoryLoads;
+	auto& l = _globalEc.memoryLoads;
+	return std::list<uint64_t>(l.begin(), l.end());
 }
 
 std::set<uint64_t> LlvmIrEmulator::getLoadedMemorySet()
@@ -2581,7 +2578,8 @@ std::set<uint64_t> LlvmIrEmulator::getLoadedMemorySet()
 
 std::list<uint64_t> LlvmIrEmulator::getStoredMemory()
 {
-	return _globalEc.memoryStores;
+	auto& l = _globalEc.memoryStores;
+	return std::list<uint64_t>(l.begin(), l.end());
 }
 
 std::set<uint64_t> LlvmIrEmulator::getStoredMemorySet()
@@ -2606,6 +2604,50 @@ void LlvmIrEmulator::setMemoryValue(uint64_t addr, llvm::GenericValue val)
  * returned.
  * Otherwise, LLVM value to generic value map in global context is used.
  */
+/**
+ * Takes a snapshot of the emulator's persistent state.
+ *
+ * Together with restoreSnapshot(), this allows rewinding an emulation --
+ * e.g. emulating the same prologue repeatedly with different inputs without
+ * re-creating the emulator and replaying from scratch. The cost is a copy
+ * of the live state, which is typically much smaller than a replay.
+ *
+ * Must not be called while an emulation is in progress.
+ */
+LlvmIrEmulator::Snapshot LlvmIrEmulator::takeSnapshot() const
+{
+	assert(_ecStack.empty() && "cannot snapshot while emulation runs");
+
+	return Snapshot{
+			_globalEc,
+			_visitedInsns,
+			_visitedInsnsSet,
+			_visitedBbs,
+			_visitedBbsSet,
+			_calls,
+			_exitValue};
+}
+
+/**
+ * Restores the emulator's persistent state from a snapshot taken by
+ * takeSnapshot(). The snapshot is not consumed -- one snapshot can be
+ * restored any number of times.
+ *
+ * Must not be called while an emulation is in progress.
+ */
+void LlvmIrEmulator::restoreSnapshot(const Snapshot& s)
+{
+	assert(_ecStack.empty() && "cannot restore while emulation runs");
+
+	_globalEc = s.globalEc;
+	_visitedInsns = s.visitedInsns;
+	_visitedInsnsSet = s.visitedInsnsSet;
+	_visitedBbs = s.visitedBbs;
+	_visitedBbsSet = s.visitedBbsSet;
+	_calls = s.calls;
+	_exitValue = s.exitValue;
+}
+
 llvm::GenericValue LlvmIrEmulator::getValueValue(llvm::Value* val)
 {
 	if (auto* gv = dyn_cast<GlobalVariable>(val))
@@ -3047,6 +3089,222 @@ void LlvmIrEmulator::visitStoreInst(llvm::StoreInst& I)
 //=============================================================================
 //
 
+/// Upper bound on the number of emulated memory slots one native routine
+/// emulation may touch. Calls with bigger (or unterminated) operands fall
+/// back to the default call handling.
+static const uint64_t knownRoutineOperationLimit = 0x100000;
+
+/**
+ * Routine name with the possible leading underscore decoration stripped,
+ * so both @c memcpy and @c _memcpy are recognized.
+ */
+static std::string normalizeKnownRoutineName(llvm::Function* f)
+{
+	auto name = f->getName().str();
+	if (!name.empty() && name[0] == '_')
+	{
+		name.erase(name.begin());
+	}
+	return name;
+}
+
+static bool isKnownRoutineName(const std::string& name)
+{
+	return name == "memcpy"
+			|| name == "memmove"
+			|| name == "memset"
+			|| name == "strlen"
+			|| name == "strcpy"
+			|| name == "strcmp";
+}
+
+/**
+ * Emulated memory address held in @a gv -- pointer arguments may come in
+ * either as pointer values or as plain integers.
+ */
+static uint64_t addressFromGenericValue(const llvm::GenericValue& gv)
+{
+	if (auto addr = reinterpret_cast<uint64_t>(GVTOP(gv)))
+	{
+		return addr;
+	}
+	return gv.IntVal.getLimitedValue();
+}
+
+/**
+ * Low byte of the value stored in one emulated memory slot.
+ */
+static uint8_t byteFromSlot(const llvm::GenericValue& gv)
+{
+	return static_cast<uint8_t>(gv.IntVal.getRawData()[0]);
+}
+
+bool LlvmIrEmulator::isKnownRoutine(llvm::Function* f) const
+{
+	return f ? isKnownRoutineName(normalizeKnownRoutineName(f)) : false;
+}
+
+/**
+ * Natively emulate a call to a known runtime routine against the emulated
+ * memory model. Emulating decompiled memcpy/memset/strlen-style loops
+ * instruction by instruction costs millions of steps for one semantic
+ * operation -- this executes the whole operation in one go and sets the
+ * call's return value.
+ * @return @c True if the call was recognized and emulated, @c false if the
+ *         caller should handle it the default way.
+ */
+bool LlvmIrEmulator::emulateKnownRoutine(
+		llvm::CallInst& I,
+		llvm::Function* cf,
+		const std::vector<llvm::GenericValue>& args)
+{
+	auto name = normalizeKnownRoutineName(cf);
+
+	if (name == "memcpy" || name == "memmove")
+	{
+		if (args.size() < 3)
+		{
+			return false;
+		}
+		uint64_t dst = addressFromGenericValue(args[0]);
+		uint64_t src = addressFromGenericValue(args[1]);
+		uint64_t n = args[2].IntVal.getLimitedValue();
+		if (n > knownRoutineOperationLimit)
+		{
+			return false;
+		}
+		if (dst <= src)
+		{
+			for (uint64_t i = 0; i < n; ++i)
+			{
+				_globalEc.setMemory(dst + i, _globalEc.getMemory(src + i));
+			}
+		}
+		else
+		{
+			for (uint64_t i = n; i > 0; --i)
+			{
+				_globalEc.setMemory(
+						dst + i - 1,
+						_globalEc.getMemory(src + i - 1));
+			}
+		}
+		setKnownRoutineReturnValue(I, dst);
+		return true;
+	}
+	else if (name == "memset")
+	{
+		if (args.size() < 3)
+		{
+			return false;
+		}
+		uint64_t dst = addressFromGenericValue(args[0]);
+		uint8_t c = static_cast<uint8_t>(args[1].IntVal.getLimitedValue());
+		uint64_t n = args[2].IntVal.getLimitedValue();
+		if (n > knownRoutineOperationLimit)
+		{
+			return false;
+		}
+		GenericValue byte;
+		byte.IntVal = APInt(8, c);
+		for (uint64_t i = 0; i < n; ++i)
+		{
+			_globalEc.setMemory(dst + i, byte);
+		}
+		setKnownRoutineReturnValue(I, dst);
+		return true;
+	}
+	else if (name == "strlen")
+	{
+		if (args.size() < 1)
+		{
+			return false;
+		}
+		uint64_t src = addressFromGenericValue(args[0]);
+		for (uint64_t i = 0; i < knownRoutineOperationLimit; ++i)
+		{
+			if (byteFromSlot(_globalEc.getMemory(src + i)) == 0)
+			{
+				setKnownRoutineReturnValue(I, i);
+				return true;
+			}
+		}
+		return false;
+	}
+	else if (name == "strcpy")
+	{
+		if (args.size() < 2)
+		{
+			return false;
+		}
+		uint64_t dst = addressFromGenericValue(args[0]);
+		uint64_t src = addressFromGenericValue(args[1]);
+		for (uint64_t i = 0; i < knownRoutineOperationLimit; ++i)
+		{
+			auto slot = _globalEc.getMemory(src + i);
+			_globalEc.setMemory(dst + i, slot);
+			if (byteFromSlot(slot) == 0)
+			{
+				setKnownRoutineReturnValue(I, dst);
+				return true;
+			}
+		}
+		return false;
+	}
+	else if (name == "strcmp")
+	{
+		if (args.size() < 2)
+		{
+			return false;
+		}
+		uint64_t s1 = addressFromGenericValue(args[0]);
+		uint64_t s2 = addressFromGenericValue(args[1]);
+		for (uint64_t i = 0; i < knownRoutineOperationLimit; ++i)
+		{
+			uint8_t c1 = byteFromSlot(_globalEc.getMemory(s1 + i));
+			uint8_t c2 = byteFromSlot(_globalEc.getMemory(s2 + i));
+			if (c1 != c2)
+			{
+				setKnownRoutineReturnValue(
+						I,
+						c1 < c2 ? static_cast<uint64_t>(-1) : 1);
+				return true;
+			}
+			if (c1 == 0)
+			{
+				setKnownRoutineReturnValue(I, 0);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	return false;
+}
+
+/**
+ * Set the return value of natively emulated call @a I to @a val, converted
+ * to the call's return type.
+ */
+void LlvmIrEmulator::setKnownRoutineReturnValue(llvm::CallInst& I, uint64_t val)
+{
+	auto* t = I.getType();
+	GenericValue ret;
+	if (t->isPointerTy())
+	{
+		ret.PointerVal = PointerTy(static_cast<intptr_t>(val));
+	}
+	else if (auto* it = dyn_cast<IntegerType>(t))
+	{
+		ret.IntVal = APInt(it->getBitWidth(), val);
+	}
+	else
+	{
+		return;
+	}
+	_globalEc.setValue(&I, ret);
+}
+
 void LlvmIrEmulator::visitCallInst(llvm::CallInst& I)
 {
 	LocalExecutionContext& ec = _ecStack.back();
@@ -3093,6 +3351,15 @@ void LlvmIrEmulator::visitCallInst(llvm::CallInst& I)
 	}
 
 	_calls.push_back(ce);
+
+	// Known runtime routines (either original declarations, or statically
+	// linked bodies named by signature detection) are emulated natively
+	// against the emulated memory model -- the call is logged above like
+	// any other, but the whole semantic operation is done in one go.
+	if (cf)
+	{
+		emulateKnownRoutine(I, cf, ce.calledArguments);
+	}
 }
 
 void LlvmIrEmulator::visitInvokeInst(llvm::InvokeInst& I)
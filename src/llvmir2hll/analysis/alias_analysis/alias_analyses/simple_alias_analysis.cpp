@@ -16,6 +16,7 @@
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/utils/container.h"
 
+using retdec::utils::addToSet;
 using retdec::utils::hasItem;
 
 namespace retdec {
@@ -33,8 +34,8 @@ const VarSet EMPTY_VAR_SET = VarSet();
 * @brief Constructs a new analysis.
 */
 SimpleAliasAnalysis::SimpleAliasAnalysis(): AliasAnalysis(),
-	OrderedAllVisitor(true, true), allAddressedVars(), funcAddressedVarsMap(),
-	varFuncMap(), func() {}
+	OrderedAllVisitor(true, true), allAddressedVars(),
+	globalInitAddressedVars(), funcAddressedVarsMap(), varFuncMap(), func() {}
 
 /**
 * @brief Destructs the analysis.
@@ -56,6 +57,7 @@ void SimpleAliasAnalysis::init(ShPtr<Module> module) {
 	AliasAnalysis::init(module);
 
 	allAddressedVars.clear();
+	globalInitAddressedVars.clear();
 	funcAddressedVarsMap.clear();
 	varFuncMap.clear();
 	func.reset();
@@ -73,20 +75,74 @@ void SimpleAliasAnalysis::init(ShPtr<Module> module) {
 	// For every function...
 	for (auto i = module->func_definition_begin(),
 			e = module->func_definition_end(); i != e; ++i) {
-		func = *i;
+		computeFuncSummary(*i);
+	}
+
+	composeAllAddressedVars();
+}
+
+void SimpleAliasAnalysis::refreshFuncs(ShPtr<Module> module,
+		const FuncVector &funcs) {
+	if (this->module != module) {
+		// The analysis has been initialized over a different module (or has
+		// not been initialized at all), so everything has to be recomputed.
+		init(module);
+		return;
+	}
 
-		// Add an entry to varFuncMap for every local variable, including
-		// parameters.
-		VarSet localVars((*i)->getLocalVars(true));
-		for (const auto &var : localVars) {
-			varFuncMap[var] = func;
+	restart();
+
+	// Drop the stale local-variable entries of the refreshed functions (they
+	// are re-added in computeFuncSummary()).
+	FuncSet refreshedFuncs(funcs.begin(), funcs.end());
+	for (auto i = varFuncMap.begin(), e = varFuncMap.end(); i != e; ) {
+		if (hasItem(refreshedFuncs, i->second)) {
+			i = varFuncMap.erase(i);
+		} else {
+			++i;
 		}
+	}
 
-		// Compute variables whose address is taken in the function. First,
-		// however, initialize funcAddressedVarsMap for the current function so
-		// that if no variables are found, the map will return the empty set.
-		funcAddressedVarsMap[func];
-		visitStmt(func->getBody());
+	// Recompute the summary of every refreshed function and re-compose the
+	// module-wide set from the per-function summaries.
+	for (const auto &refreshedFunc : funcs) {
+		computeFuncSummary(refreshedFunc);
+	}
+	composeAllAddressedVars();
+}
+
+/**
+* @brief Computes the summary of the given function, i.e. the variables whose
+*        address is taken in it.
+*
+* It also registers all local variables of @a func, including parameters, into
+* @c varFuncMap.
+*/
+void SimpleAliasAnalysis::computeFuncSummary(ShPtr<Function> func) {
+	this->func = func;
+
+	// Add an entry to varFuncMap for every local variable, including
+	// parameters.
+	VarSet localVars(func->getLocalVars(true));
+	for (const auto &var : localVars) {
+		varFuncMap[var] = func;
+	}
+
+	// Compute variables whose address is taken in the function. First,
+	// however, reset funcAddressedVarsMap for the current function so that if
+	// no variables are found, the map will return the empty set.
+	funcAddressedVarsMap[func] = VarSet();
+	visitStmt(func->getBody());
+}
+
+/**
+* @brief Composes @c allAddressedVars from the addresses taken in the
+*        initializers of global variables and the per-function summaries.
+*/
+void SimpleAliasAnalysis::composeAllAddressedVars() {
+	allAddressedVars = globalInitAddressedVars;
+	for (const auto &p : funcAddressedVarsMap) {
+		addToSet(p.second, allAddressedVars);
 	}
 }
 
@@ -131,12 +187,13 @@ bool SimpleAliasAnalysis::mayBePointed(ShPtr<Variable> var) const {
 
 void SimpleAliasAnalysis::visit(ShPtr<AddressOpExpr> expr) {
 	if (ShPtr<Variable> var = cast<Variable>(expr->getOperand())) {
-		allAddressedVars.insert(var);
 		// Initializers of global variables may contain the `&` operator.
 		// However, there is no function associated with them. Hence the
 		// following check.
 		if (func) {
 			funcAddressedVarsMap[func].insert(var);
+		} else {
+			globalInitAddressedVars.insert(var);
 		}
 	} else {
 		OrderedAllVisitor::visit(expr);
@@ -40,6 +40,25 @@ void AliasAnalysis::init(ShPtr<Module> module) {
 	globalVars = module->getGlobalVars();
 }
 
+/**
+* @brief Refreshes the results of the analysis for the given functions.
+*
+* @param[in] module The module to be analyzed.
+* @param[in] funcs Functions in @a module whose bodies have been changed since
+*                  the last initialization or refresh.
+*
+* This member function may be called instead of init() when only the given
+* functions have been changed. By default, it re-initializes the whole
+* analysis; subclasses that keep per-function summaries may override it and
+* recompute just the summaries of the given functions.
+*
+* @par Preconditions
+*  - @a module is non-null
+*/
+void AliasAnalysis::refreshFuncs(ShPtr<Module> module, const FuncVector &funcs) {
+	init(module);
+}
+
 /**
 * @brief Returns @c true if the analysis has been initialized, @c false
 *        otherwise.
@@ -0,0 +1,69 @@
+/**
+* @file src/llvmir2hll/analysis/liveness_analysis.cpp
+* @brief Implementation of LivenessAnalysis.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/analysis/liveness_analysis.h"
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/support/debug.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs a new analysis.
+*
+* See the description of create() for more information.
+*/
+LivenessAnalysis::LivenessAnalysis(): Caching(true) {}
+
+/**
+* @brief Creates a new analysis.
+*/
+ShPtr<LivenessAnalysis> LivenessAnalysis::create() {
+	return ShPtr<LivenessAnalysis>(new LivenessAnalysis());
+}
+
+/**
+* @brief Returns the liveness summary of the given function.
+*
+* The summary is computed upon the first request and cached; subsequent
+* requests are mere lookups until funcHasBeenChanged() is called for the
+* function.
+*
+* @par Preconditions
+*  - @a func is non-null
+*  - @a func is a definition
+*/
+ShPtr<UsedVars> LivenessAnalysis::getLivenessInfo(ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(func);
+	PRECONDITION(func->isDefinition(), "it has to be a definition");
+
+	// Caching.
+	ShPtr<UsedVars> livenessInfo;
+	if (getCachedResult(func, livenessInfo)) {
+		return livenessInfo;
+	}
+
+	livenessInfo = UsedVarsVisitor::getUsedVars(func->getBody());
+
+	// Caching.
+	addToCache(func, livenessInfo);
+
+	return livenessInfo;
+}
+
+/**
+* @brief Tells the analysis that the body of @a func has been changed.
+*
+* The cached summary of the function (if any) is dropped, so it gets
+* re-computed upon the next call of getLivenessInfo().
+*/
+void LivenessAnalysis::funcHasBeenChanged(ShPtr<Function> func) {
+	removeFromCache(func);
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,102 @@
+/**
+* @file src/llvmir2hll/analysis/loop_info_analysis.cpp
+* @brief Implementation of LoopInfoAnalysis.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/analysis/loop_info_analysis.h"
+#include "retdec/llvmir2hll/ir/while_loop_stmt.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/utils/loop_optimizer.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs a new analysis.
+*/
+LoopInfoAnalysis::LoopInfoAnalysis():
+	splittedLoopCache(), indVarInfoCache() {}
+
+/**
+* @brief Returns the given "while true" loop splitted by its exit condition.
+*
+* See splitWhileTrueLoop() for more details, including the situations in which
+* the null pointer is returned. The result is cached until
+* loopHasBeenChanged() is called for @a stmt.
+*
+* @par Preconditions
+*  - @a stmt is non-null
+*/
+ShPtr<SplittedWhileTrueLoop> LoopInfoAnalysis::getSplittedLoop(
+		ShPtr<WhileLoopStmt> stmt) {
+	PRECONDITION_NON_NULL(stmt);
+
+	auto cachedResultIt = splittedLoopCache.find(stmt);
+	if (cachedResultIt != splittedLoopCache.end()) {
+		return cachedResultIt->second;
+	}
+
+	auto splittedLoop = splitWhileTrueLoop(stmt);
+	splittedLoopCache.emplace(stmt, splittedLoop);
+	return splittedLoop;
+}
+
+/**
+* @brief Returns information about the induction variable of the given "while
+*        true" loop.
+*
+* See the description of getIndVarInfo() in loop_optimizer.h for more details,
+* including the situations in which the null pointer is returned. The result
+* is cached until loopHasBeenChanged() is called for @a stmt.
+*
+* @par Preconditions
+*  - @a stmt is non-null
+*/
+ShPtr<IndVarInfo> LoopInfoAnalysis::getIndVarInfo(ShPtr<WhileLoopStmt> stmt) {
+	PRECONDITION_NON_NULL(stmt);
+
+	auto cachedResultIt = indVarInfoCache.find(stmt);
+	if (cachedResultIt != indVarInfoCache.end()) {
+		return cachedResultIt->second;
+	}
+
+	auto indVarInfo = llvmir2hll::getIndVarInfo(stmt);
+	indVarInfoCache.emplace(stmt, indVarInfo);
+	return indVarInfo;
+}
+
+/**
+* @brief Tells the analysis that the statements of the given loop have been
+*        changed.
+*
+* The cached information about the loop is dropped, so the next request
+* re-computes it from the current form of the loop.
+*
+* @par Preconditions
+*  - @a stmt is non-null
+*/
+void LoopInfoAnalysis::loopHasBeenChanged(ShPtr<WhileLoopStmt> stmt) {
+	PRECONDITION_NON_NULL(stmt);
+
+	splittedLoopCache.erase(stmt);
+	indVarInfoCache.erase(stmt);
+}
+
+/**
+* @brief Drops all the cached information about loops.
+*/
+void LoopInfoAnalysis::clearCache() {
+	splittedLoopCache.clear();
+	indVarInfoCache.clear();
+}
+
+/**
+* @brief Creates a new analysis.
+*/
+ShPtr<LoopInfoAnalysis> LoopInfoAnalysis::create() {
+	return ShPtr<LoopInfoAnalysis>(new LoopInfoAnalysis());
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -7,6 +7,7 @@
 #include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
 #include "retdec/llvmir2hll/ir/array_index_op_expr.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
 #include "retdec/llvmir2hll/ir/deref_op_expr.h"
 #include "retdec/llvmir2hll/ir/for_loop_stmt.h"
 #include "retdec/llvmir2hll/ir/function.h"
@@ -25,7 +26,8 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a new UsedVars object.
 */
-UsedVars::UsedVars(): readVars(), writtenVars(), allVars(), numOfVarUses() {}
+UsedVars::UsedVars(): readVars(), writtenVars(), allVars(), numOfVarUses(),
+	numOfVarWrites(), containsCalls(false) {}
 
 /**
 * @brief Constructs a new UsedVars object from @a other.
@@ -50,7 +52,9 @@ bool UsedVars::operator==(const UsedVars &other) const {
 	return (readVars == other.readVars &&
 		writtenVars == other.writtenVars &&
 		allVars == other.allVars &&
-		numOfVarUses == other.numOfVarUses);
+		numOfVarUses == other.numOfVarUses &&
+		numOfVarWrites == other.numOfVarWrites &&
+		containsCalls == other.containsCalls);
 }
 
 /**
@@ -117,6 +121,26 @@ std::size_t UsedVars::getNumOfUses(ShPtr<Variable> var) const {
 	return 0;
 }
 
+/**
+* @brief Returns the number of direct writes into @a var.
+*
+* Writes through dereferences, array accesses, and structure accesses are not
+* counted (see the description of the corresponding visits).
+*
+* @par Preconditions
+*  - @a var is non-null
+*/
+std::size_t UsedVars::getNumOfWrites(ShPtr<Variable> var) const {
+	PRECONDITION_NON_NULL(var);
+
+	auto i = numOfVarWrites.find(var);
+	if (i != numOfVarWrites.end()) {
+		return i->second;
+	}
+	// The given variable is never written into.
+	return 0;
+}
+
 /**
 * @brief Returns an iterator to the first read variable.
 */
@@ -177,6 +201,14 @@ bool UsedVars::isUsed(ShPtr<Variable> var, bool read,
 	return false;
 }
 
+/**
+* @brief Returns @c true if the value contains function calls, @c false
+*        otherwise.
+*/
+bool UsedVars::hasCalls() const {
+	return containsCalls;
+}
+
 /**
 * @brief Clears all private containers.
 */
@@ -185,6 +217,8 @@ void UsedVars::clear() {
 	writtenVars.clear();
 	allVars.clear();
 	numOfVarUses.clear();
+	numOfVarWrites.clear();
+	containsCalls = false;
 }
 
 /**
@@ -294,6 +328,7 @@ void UsedVarsVisitor::visit(ShPtr<Function> func) {
 void UsedVarsVisitor::visit(ShPtr<Variable> var) {
 	if (writing) {
 		usedVars->writtenVars.insert(var);
+		usedVars->numOfVarWrites[var]++;
 	} else {
 		usedVars->readVars.insert(var);
 	}
@@ -330,6 +365,12 @@ void UsedVarsVisitor::visit(ShPtr<DerefOpExpr> expr) {
 	writing = oldWriting;
 }
 
+void UsedVarsVisitor::visit(ShPtr<CallExpr> expr) {
+	usedVars->containsCalls = true;
+
+	OrderedAllVisitor::visit(expr);
+}
+
 void UsedVarsVisitor::visit(ShPtr<AssignStmt> stmt) {
 	writing = true;
 	stmt->getLhs()->accept(this);
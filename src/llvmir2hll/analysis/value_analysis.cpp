@@ -610,6 +610,9 @@ ShPtr<ValueData> ValueAnalysis::getValueData(ShPtr<Value> value) {
 
 	// Caching.
 	addToCache(value, valueData);
+	if (isCachingEnabled()) {
+		recordCacheDependencies(value, valueData);
+	}
 
 	return valueData;
 }
@@ -621,6 +624,7 @@ ShPtr<ValueData> ValueAnalysis::getValueData(ShPtr<Value> value) {
 */
 void ValueAnalysis::clearCache() {
 	Caching::clearCache();
+	cachedValuesForVar.clear();
 	validateState();
 }
 
@@ -650,6 +654,57 @@ void ValueAnalysis::removeFromCache(ShPtr<Value> value, bool recursive) {
 	}
 }
 
+/**
+* @brief Removes every cached result that was computed from @a var.
+*
+* Use this function when all your modifications of the module concern a single
+* variable (e.g. every occurrence of @a var is replaced with another
+* expression). In contrast to invalidating the whole analysis, only the cached
+* results whose values access @a var (directly or indirectly) are dropped;
+* everything else stays cached.
+*
+* @par Preconditions
+*  - @a var is non-null
+*/
+void ValueAnalysis::removeDependentFromCache(ShPtr<Variable> var) {
+	PRECONDITION_NON_NULL(var);
+
+	if (!isCachingEnabled()) {
+		return;
+	}
+
+	auto i = cachedValuesForVar.find(var);
+	if (i == cachedValuesForVar.end()) {
+		return;
+	}
+
+	// The recorded values may have already been removed from the cache by
+	// removeFromCache(); removing them again is harmless.
+	for (const auto &value : i->second) {
+		Caching::removeFromCache(value);
+	}
+	cachedValuesForVar.erase(i);
+}
+
+/**
+* @brief Records the variables from which the cached result @a data for
+*        @a value was computed.
+*
+* The recorded dependencies are used in removeDependentFromCache().
+*/
+void ValueAnalysis::recordCacheDependencies(ShPtr<Value> value,
+		ShPtr<ValueData> data) {
+	for (const auto &var : data->dirAllVars) {
+		cachedValuesForVar[var].insert(value);
+	}
+	for (const auto &var : data->mayBeAccessedVars) {
+		cachedValuesForVar[var].insert(value);
+	}
+	for (const auto &var : data->mustBeAccessedVars) {
+		cachedValuesForVar[var].insert(value);
+	}
+}
+
 /**
 * @brief Re-initializes the underlying alias analysis.
 *
@@ -660,6 +715,17 @@ void ValueAnalysis::initAliasAnalysis(ShPtr<Module> module) {
 	aliasAnalysis->init(module);
 }
 
+/**
+* @brief Refreshes the underlying alias analysis for the given functions.
+*
+* This function is a delegation to AliasAnalysis::refreshFuncs(). See it for
+* more information.
+*/
+void ValueAnalysis::refreshAliasAnalysis(ShPtr<Module> module,
+		const FuncVector &funcs) {
+	aliasAnalysis->refreshFuncs(module, funcs);
+}
+
 /**
 * @brief Returns the set of variables to which @a var may point to.
 *
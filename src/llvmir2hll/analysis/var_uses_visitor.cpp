@@ -112,8 +112,21 @@ ShPtr<VarUses> VarUsesVisitor::getUses(ShPtr<Variable> var,
 
 	// Have we already computed this piece of information?
 	if (cachingEnabled) {
-		varUses = cache[func][var];
-		if (varUses) {
+		auto funcCacheIt = cache.find(func);
+		if (funcCacheIt != cache.end()) {
+			auto varUsesIt = funcCacheIt->second.find(var);
+			if (varUsesIt != funcCacheIt->second.end() && varUsesIt->second) {
+				return varUses = varUsesIt->second;
+			}
+		}
+
+		// When everything has been pre-computed, the cache is complete (the
+		// stmtHasBeen*() updates keep it that way), so a missing entry means
+		// that the variable is not used in the function at all. There is no
+		// need to traverse the whole body to find that out.
+		if (precomputingHasBeenDone) {
+			varUses = ShPtr<VarUses>(new VarUses(var, func));
+			cache[func][var] = varUses;
 			return varUses;
 		}
 	}
@@ -261,8 +274,8 @@ void VarUsesVisitor::stmtHasBeenChanged(ShPtr<Statement> stmt,
 
 	// Get all variables used in the new statement.
 	ShPtr<ValueData> stmtData(va->getValueData(stmt));
-	const VarSet &dirUsedVars(stmtData->getDirAccessedVars());
-	const VarSet &indirUsedVars(setUnion(
+	VarSet dirUsedVars(stmtData->getDirAccessedVars());
+	VarSet indirUsedVars(setUnion(
 		stmtData->getMayBeAccessedVars(),
 		stmtData->getMustBeAccessedVars()));
 
@@ -274,13 +287,30 @@ void VarUsesVisitor::stmtHasBeenChanged(ShPtr<Statement> stmt,
 		p.second->dirUses.erase(stmt);
 		if (hasItem(dirUsedVars, p.first)) {
 			p.second->dirUses.insert(stmt);
+			dirUsedVars.erase(p.first);
 		}
 		// Indirect uses.
 		p.second->indirUses.erase(stmt);
 		if (hasItem(indirUsedVars, p.first)) {
 			p.second->indirUses.insert(stmt);
+			indirUsedVars.erase(p.first);
 		}
 	}
+
+	// If there are some variables left, it means that these haven't been used
+	// in the function before the statement was changed. Add them, so the cache
+	// stays complete. Directly used variables.
+	for (const auto &var : dirUsedVars) {
+		ShPtr<VarUses> varUses(new VarUses(var, func));
+		varUses->dirUses.insert(stmt);
+		cache[func][var] = varUses;
+	}
+	// Indirectly used variables.
+	for (const auto &var : indirUsedVars) {
+		ShPtr<VarUses> varUses(new VarUses(var, func));
+		varUses->indirUses.insert(stmt);
+		cache[func][var] = varUses;
+	}
 }
 
 /**
@@ -5,6 +5,7 @@
 */
 
 #include <sstream>
+#include <unordered_map>
 
 #include "retdec/llvmir2hll/config/configs/json_config.h"
 #include "retdec/llvmir2hll/support/debug.h"
@@ -39,12 +40,29 @@ struct JSONConfig::Impl {
 	const retdec::config::Class &getConfigClassByNameOrEmptyClass(
 		const std::string &name) const;
 	std::string getNameOfRegister(const retdec::config::Object &reg) const;
+	const std::unordered_map<std::string, std::string> &getFuncClassMap() const;
 
 	/// Path to the config file (if any).
 	std::string path;
 
 	/// Underlying config.
 	retdec::config::Config config;
+
+	/// Cache of the already looked-up function records. During the conversion,
+	/// many queries are issued for the same function in a row, so the records
+	/// are pulled from the underlying config lazily and remembered. The mapped
+	/// value is the null pointer when there is no function with the given
+	/// name. Caching the pointers is safe because functions are neither added
+	/// nor removed through this config (they are only modified in place).
+	mutable std::unordered_map<std::string, retdec::config::Function *>
+		funcRecordCache;
+
+	/// Mapping of a function name into the name of its class. It is built
+	/// lazily upon the first query (see getFuncClassMap()).
+	mutable std::unordered_map<std::string, std::string> funcClassMap;
+
+	/// Has @c funcClassMap already been built?
+	mutable bool funcClassMapBuilt = false;
 };
 
 /**
@@ -54,13 +72,22 @@ JSONConfig::Impl::Impl() = default;
 
 retdec::config::Function *JSONConfig::Impl::getConfigFunctionByName(
 		const std::string &name) {
-	return config.functions.getFunctionByName(name);
+	auto cachedRecordIt = funcRecordCache.find(name);
+	if (cachedRecordIt != funcRecordCache.end()) {
+		return cachedRecordIt->second;
+	}
+
+	auto f = config.functions.getFunctionByName(name);
+	funcRecordCache.emplace(name, f);
+	return f;
 }
 
 // A const overload of getConfigFunctionByName().
 const retdec::config::Function *JSONConfig::Impl::getConfigFunctionByName(
 		const std::string &name) const {
-	return config.functions.getFunctionByName(name);
+	// Use the non-const overload so that both overloads share the cache. This
+	// is safe because the caller obtains just a pointer to const.
+	return const_cast<Impl *>(this)->getConfigFunctionByName(name);
 }
 
 const retdec::config::Object &JSONConfig::Impl::getConfigGlobalVariableByNameOrEmptyVariable(
@@ -112,6 +139,35 @@ const retdec::config::Class &JSONConfig::Impl::getConfigClassByNameOrEmptyClass(
 	return c ? *c : emptyClass;
 }
 
+/**
+* @brief Returns a mapping of a function name into the name of its class.
+*
+* The mapping is built lazily upon the first query so repeated queries do not
+* have to go through all the classes over and over again. When a function
+* belongs to several classes, the class that comes first in the underlying
+* config is used (the same class that a linear search would find).
+*/
+const std::unordered_map<std::string, std::string> &JSONConfig::Impl::getFuncClassMap() const {
+	if (!funcClassMapBuilt) {
+		for (const auto &c : config.classes) {
+			for (const auto &func : c.constructors) {
+				funcClassMap.emplace(func, c.getName());
+			}
+			for (const auto &func : c.destructors) {
+				funcClassMap.emplace(func, c.getName());
+			}
+			for (const auto &func : c.methods) {
+				funcClassMap.emplace(func, c.getName());
+			}
+			for (const auto &func : c.virtualMethods) {
+				funcClassMap.emplace(func, c.getName());
+			}
+		}
+		funcClassMapBuilt = true;
+	}
+	return funcClassMap;
+}
+
 JSONConfig::JSONConfig(): impl(std::make_unique<Impl>()) {}
 
 JSONConfig::~JSONConfig() = default;
@@ -127,7 +183,7 @@ UPtr<JSONConfig> JSONConfig::fromFile(const std::string &path) {
 	auto config = UPtr<JSONConfig>(new JSONConfig());
 	config->impl->path = path;
 	try {
-		config->impl->config.readJsonFile(path);
+		config->impl->config.readFile(path);
 	} catch (const retdec::config::FileNotFoundException &ex) {
 		throw JSONConfigFileNotFoundError(ex.what());
 	} catch (const retdec::config::Exception &ex) {
@@ -310,12 +366,9 @@ StringSet JSONConfig::getClassNames() const {
 }
 
 std::string JSONConfig::getClassForFunc(const std::string &func) const {
-	for (const auto &c : impl->config.classes) {
-		if (c.hasFunction(func)) {
-			return c.getName();
-		}
-	}
-	return {};
+	const auto &funcClassMap = impl->getFuncClassMap();
+	auto classIt = funcClassMap.find(func);
+	return classIt != funcClassMap.end() ? classIt->second : std::string();
 }
 
 std::string JSONConfig::getTypeOfFuncInClass(const std::string &func,
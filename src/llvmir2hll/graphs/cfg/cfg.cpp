@@ -638,17 +638,18 @@ void CFG::replaceStmt(ShPtr<Statement> stmt, const StmtVector &stmts) {
 CFG::NodeVector CFG::getUnreachableNodes() const {
 	// We perform a traversal over the CFG, starting at the entry node. All
 	// nodes that are not visited during the traversal are unreachable.
+	//
+	// Instead of popping nodes from the front of the vector, which is
+	// expensive, we keep an index of the next node to be visited.
 	NodeVector nodesToVisit{entryNode};
 	NodeSet visitedNodes;
-	while (!nodesToVisit.empty()) {
-		// Get and remove the first node to be visited.
-		auto node = nodesToVisit.front();
-		nodesToVisit.erase(nodesToVisit.begin());
+	for (std::size_t n = 0; n != nodesToVisit.size(); ++n) {
+		// Get the next node to be visited.
+		auto node = nodesToVisit[n];
 
-		if (hasItem(visitedNodes, node)) {
+		if (!visitedNodes.insert(node).second) {
 			continue;
 		}
-		visitedNodes.insert(node);
 
 		// Schedule a visit for all successors.
 		for (auto i = node->succ_begin(), e = node->succ_end(); i != e; ++i) {
@@ -670,11 +671,7 @@ CFG::NodeVector CFG::getUnreachableNodes() const {
 * @brief Returns the last statement in the given @a node.
 */
 ShPtr<Statement> CFG::getLastStmtInNode(ShPtr<Node> node) {
-	stmt_iterator lastStmtIter;
-	for (auto i = node->stmt_begin(), e = node->stmt_end(); i != e; ++i) {
-		lastStmtIter = i;
-	}
-	return *lastStmtIter;
+	return *node->stmt_rbegin();
 }
 
 /**
@@ -723,6 +720,7 @@ ShPtr<CFG::Node> CFG::addNode(const std::string &label) {
 */
 void CFG::addNode(ShPtr<Node> node) {
 	nodes.push_back(node);
+	nodeSet.insert(node);
 }
 
 /**
@@ -775,7 +773,7 @@ void CFG::removeNode(ShPtr<Node> node) {
 	PRECONDITION(node != exitNode,
 		"Trying to remove the exit node.");
 
-	if (!hasItem(nodes, node)) {
+	if (!hasItem(nodeSet, node)) {
 		// The node doesn't exist.
 		return;
 	}
@@ -823,6 +821,7 @@ void CFG::removeNode(ShPtr<Node> node) {
 
 	// Remove the node itself. This may invalidate existing node iterators.
 	removeItem(nodes, node);
+	nodeSet.erase(node);
 }
 
 /**
@@ -925,11 +924,6 @@ void CFG::splitNode(ShPtr<Node> node) {
 * @endcode
 */
 void CFG::removeEmptyNodes() {
-	// Instead of erasing the node on-the-fly, we insert them into the
-	// following set and erase them after we have determined all empty nodes.
-	// In this way, we don't have to deal with iterator invalidation.
-	NodeSet toEraseNodes;
-
 	// Since more than one iteration may be needed, loop over the CFG until
 	// there is no change.
 	// TODO Is more than one iteration really needed?
@@ -938,6 +932,12 @@ void CFG::removeEmptyNodes() {
 	do {
 		cfgChanged = false;
 
+		// Instead of erasing the nodes on-the-fly, we insert them into the
+		// following set and erase them after we have determined all empty
+		// nodes found in this iteration. In this way, we don't have to deal
+		// with iterator invalidation.
+		NodeSet toEraseNodes;
+
 		// For each node...
 		for (const auto &node : nodes) {
 			if (node->hasStmts() || node == entryNode || node == exitNode) {
@@ -985,13 +985,13 @@ void CFG::validateEveryPredAndSuccIsInNodes() {
 	for (const auto &node : nodes) {
 		// For every ingoing edge of the node...
 		for (auto i = node->pred_begin(), e = node->pred_end(); i != e; ++i) {
-			ASSERT_MSG(hasItem(nodes, (*i)->getSrc()),
+			ASSERT_MSG(hasItem(nodeSet, (*i)->getSrc()),
 				"there is a node which is not in nodes (predecessor)");
 		}
 
 		// For every outgoing edge of the node...
 		for (auto i = node->succ_begin(), e = node->succ_end(); i != e; ++i) {
-			ASSERT_MSG(hasItem(nodes, (*i)->getDst()),
+			ASSERT_MSG(hasItem(nodeSet, (*i)->getDst()),
 				"there is a node which is not in nodes (successor)");
 		}
 	}
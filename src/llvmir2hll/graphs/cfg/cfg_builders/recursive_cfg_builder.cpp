@@ -145,7 +145,11 @@ bool isStatementInStatements(ShPtr<Statement> stmt, ShPtr<Statement> stmts) {
 * @brief Constructs a new builder.
 */
 RecursiveCFGBuilder::RecursiveCFGBuilder():
-	CFGBuilder(), OrderedAllVisitor(), currNode(), firstStmtNodeMapping() {}
+	CFGBuilder(), OrderedAllVisitor(), currNode(), firstStmtNodeMapping() {
+	// The builder provides its own, recursive visitStmt(), so keep the base
+	// traversal of statement chains recursive as well.
+	flattenStmtChains = false;
+}
 
 /**
 * @brief Destructs the builder.
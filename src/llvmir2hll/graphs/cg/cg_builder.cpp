@@ -42,6 +42,27 @@ ShPtr<CG> CGBuilder::getCG(ShPtr<Module> module) {
 	return builder->cg;
 }
 
+/**
+* @brief Recomputes the parts of @a cg for the given functions.
+*
+* The parts of @a cg for functions not present in @a funcs are left untouched.
+* Use this function when only some functions of the underlying module have
+* been changed and rebuilding the whole CG would be wasteful.
+*
+* @par Preconditions
+*  - @a cg is non-null
+*  - every function in @a funcs exists in the module for which @a cg was built
+*/
+void CGBuilder::updateFuncsInCG(ShPtr<CG> cg, const FuncSet &funcs) {
+	PRECONDITION_NON_NULL(cg);
+
+	ShPtr<CGBuilder> builder(new CGBuilder(cg->getCorrespondingModule()));
+	builder->cg = cg;
+	for (const auto &func : funcs) {
+		cg->callerCalleeMap[func] = builder->computeCGPartForFunction(func);
+	}
+}
+
 /**
 * @brief Computes the CG.
 */
@@ -172,10 +172,12 @@ BracketManager::PrevOperators BracketManager::getPrevOperator() {
 * @param[in] currentOperator enum @c Operators. It is used for creating item
 *            which is pushed as @a previous operator on stack.
 * @param[in] direction enum @c Direction. Enumeration for direction tree traversal.
+* @param[in] operatorSupported The result of @c isOperatorSupported(currentOperator),
+*            computed by the caller.
 */
 void BracketManager::addOperatorOnStackIfSupported(Operators currentOperator,
-		Direction direction) {
-	if (isOperatorSupported(currentOperator)) {
+		Direction direction, bool operatorSupported) {
+	if (operatorSupported) {
 		PrevOperators prevOperator = { currentOperator, direction };
 		prevOperatorsStack.push(prevOperator);
 	}
@@ -185,12 +187,11 @@ void BracketManager::addOperatorOnStackIfSupported(Operators currentOperator,
 * @brief Pop element from @a prevOperatorsStack. If operator is not supported,
 *        operator is not popped from stack.
 *
-* @param[in] currentOperator enum @c Operators. Operator is used for check whether
-*            is supported.
+* @param[in] operatorSupported The result of @c isOperatorSupported() for the
+*            operator that was pushed on the stack, computed by the caller.
 */
-void BracketManager::removeOperatorFromStackIfSupported(
-		Operators currentOperator) {
-	if (isOperatorSupported(currentOperator)) {
+void BracketManager::removeOperatorFromStackIfSupported(bool operatorSupported) {
+	if (operatorSupported) {
 		prevOperatorsStack.pop();
 	}
 }
@@ -205,9 +206,14 @@ void BracketManager::removeOperatorFromStackIfSupported(
 */
 void BracketManager::treeTraversalForUnaryOpWithStackOperations(
 		ShPtr<UnaryOpExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::CENTER);
+	// Ask the subclass just once per expression whether the operator is
+	// supported; the answer cannot change in between the operands.
+	bool operatorSupported = isOperatorSupported(currentOperator);
+
+	addOperatorOnStackIfSupported(currentOperator, Direction::CENTER,
+		operatorSupported);
 	expr->getOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 }
 
 /**
@@ -220,13 +226,19 @@ void BracketManager::treeTraversalForUnaryOpWithStackOperations(
 */
 void BracketManager::treeTraversalForBinaryOpWithStackOperations(
 		ShPtr<BinaryOpExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::LEFT);
+	// Ask the subclass just once per expression whether the operator is
+	// supported; the answer cannot change in between the operands.
+	bool operatorSupported = isOperatorSupported(currentOperator);
+
+	addOperatorOnStackIfSupported(currentOperator, Direction::LEFT,
+		operatorSupported);
 	expr->getFirstOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
+	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT,
+		operatorSupported);
 	expr->getSecondOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 }
 
 /**
@@ -239,17 +251,24 @@ void BracketManager::treeTraversalForBinaryOpWithStackOperations(
 */
 void BracketManager::treeTraversalForTernaryOpWithStackOperations(
 		ShPtr<TernaryOpExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
+	// Ask the subclass just once per expression whether the operator is
+	// supported; the answer cannot change in between the operands.
+	bool operatorSupported = isOperatorSupported(currentOperator);
+
+	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT,
+		operatorSupported);
 	expr->getTrueValue()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
+	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT,
+		operatorSupported);
 	expr->getCondition()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
+	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT,
+		operatorSupported);
 	expr->getFalseValue()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 }
 
 /**
@@ -262,9 +281,14 @@ void BracketManager::treeTraversalForTernaryOpWithStackOperations(
 */
 void BracketManager::treeTraversalForCastWithStackOperations(
 		ShPtr<CastExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::CENTER);
+	// Ask the subclass just once per expression whether the operator is
+	// supported; the answer cannot change in between the operands.
+	bool operatorSupported = isOperatorSupported(currentOperator);
+
+	addOperatorOnStackIfSupported(currentOperator, Direction::CENTER,
+		operatorSupported);
 	expr->getOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 }
 
 /**
@@ -277,16 +301,22 @@ void BracketManager::treeTraversalForCastWithStackOperations(
 */
 void BracketManager::treeTraversalForCallWithStackOperations(
 		ShPtr<CallExpr> expr, Operators currentOperator) {
+	// Ask the subclass just once per expression whether the operator is
+	// supported; the answer cannot change in between the operands.
+	bool operatorSupported = isOperatorSupported(currentOperator);
+
 	// Called expression.
-	addOperatorOnStackIfSupported(currentOperator, Direction::LEFT);
+	addOperatorOnStackIfSupported(currentOperator, Direction::LEFT,
+		operatorSupported);
 	expr->getCalledExpr()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+	removeOperatorFromStackIfSupported(operatorSupported);
 
 	// Arguments.
 	for (const auto &arg : expr->getArgs()) {
-		addOperatorOnStackIfSupported(currentOperator, Direction::LEFT);
+		addOperatorOnStackIfSupported(currentOperator, Direction::LEFT,
+			operatorSupported);
 		arg->accept(this);
-		removeOperatorFromStackIfSupported(currentOperator);
+		removeOperatorFromStackIfSupported(operatorSupported);
 	}
 }
 
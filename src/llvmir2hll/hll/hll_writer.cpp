@@ -5,11 +5,15 @@
 */
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "retdec/llvmir2hll/hll/bracket_manager.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/hll/hll_writer_factory.h"
 #include "retdec/llvmir2hll/ir/array_type.h"
 #include "retdec/llvmir2hll/ir/binary_op_expr.h"
 #include "retdec/llvmir2hll/ir/call_expr.h"
@@ -36,6 +40,7 @@
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
+#include "retdec/utils/thread_pool.h"
 #include "retdec/utils/time.h"
 
 using namespace std::string_literals;
@@ -138,9 +143,11 @@ private:
 * @param[in] out Output stream into which the HLL code will be emitted.
 */
 HLLWriter::HLLWriter(llvm::raw_ostream &out):
-	out(out), emitConstantsInStructuredWay(false),
+	outBuffer(), outBufferStream(outBuffer), finalOut(out),
+	out(outBufferStream), emitConstantsInStructuredWay(false),
 	optionEmitDebugComments(true), optionKeepAllBrackets(false),
 	optionEmitTimeVaryingInfo(true), optionUseCompoundOperators(true),
+	optionEmitFunctionsInChunks(false), optionEmitFunctionsInParallel(false),
 	currFuncGotoLabelCounter(1), currentIndent(DEFAULT_LEVEL_INDENT) {}
 
 /**
@@ -188,6 +195,35 @@ void HLLWriter::setOptionUseCompoundOperators(bool use) {
 	optionUseCompoundOperators = use;
 }
 
+/**
+* @brief Enables/disables writing of every function to the output as soon as
+*        it is finished.
+*
+* @param[in] emit If @c true, every emitted function is written to the output
+*                 right after its emission instead of after the emission of
+*                 the whole module. In this way, the output overlaps with the
+*                 emission of the remaining functions.
+*/
+void HLLWriter::setOptionEmitFunctionsInChunks(bool emit) {
+	optionEmitFunctionsInChunks = emit;
+}
+
+/**
+* @brief Enables/disables the emission of function bodies in parallel.
+*
+* @param[in] emit If @c true, function bodies are emitted by several threads
+*                 at once, each into its own buffer, and the buffers are
+*                 written to the output in the order in which the functions
+*                 would be emitted sequentially. The emitted code is therefore
+*                 identical to the code emitted without this option; only the
+*                 emission may be faster. The number of used threads is
+*                 determined automatically from the number of available
+*                 processors.
+*/
+void HLLWriter::setOptionEmitFunctionsInParallel(bool emit) {
+	optionEmitFunctionsInParallel = emit;
+}
+
 /**
 * @brief Emits the code from the given module.
 *
@@ -296,6 +332,8 @@ bool HLLWriter::emitTargetCode(ShPtr<Module> module) {
 
 	if (emitFileFooter()) { codeEmitted = true; }
 
+	flushOutBuffer();
+
 	return codeEmitted;
 }
 
@@ -599,6 +637,9 @@ bool HLLWriter::emitFunctionsHeader() {
 bool HLLWriter::emitFunctions() {
 	FuncVector funcs(module->func_definition_begin(), module->func_definition_end());
 	sortFuncsForEmission(funcs);
+	if (optionEmitFunctionsInParallel && funcs.size() > 1) {
+		return emitFunctionsInParallel(funcs);
+	}
 	bool somethingEmitted = false;
 	for (const auto &func : funcs) {
 		if (somethingEmitted) {
@@ -606,6 +647,9 @@ bool HLLWriter::emitFunctions() {
 			out << "\n";
 		}
 		somethingEmitted |= emitFunction(func);
+		if (optionEmitFunctionsInChunks) {
+			flushOutBuffer();
+		}
 	}
 	return somethingEmitted;
 }
@@ -647,6 +691,64 @@ bool HLLWriter::emitFunction(ShPtr<Function> func) {
 	return true;
 }
 
+/**
+* @brief Emits the given functions in parallel.
+*
+* @param[in] funcs Functions to be emitted, in the order in which they would
+*                  be emitted sequentially.
+*
+* @return @c true if some code has been emitted, @c false otherwise.
+*
+* Every worker thread emits functions through its own helper writer (see
+* prepareHelperWriter()), each function into its own buffer. The buffers are
+* then written to the output in the order of @a funcs, so the emitted code is
+* identical to the sequentially emitted one.
+*/
+bool HLLWriter::emitFunctionsInParallel(const FuncVector &funcs) {
+	auto numOfWorkers = std::min(retdec::utils::maxParallelism(), funcs.size());
+
+	std::vector<ShPtr<HLLWriter>> helperWriters;
+	for (std::size_t i = 0; i < numOfWorkers; ++i) {
+		// The stream passed to the helper is never written to; the emitted
+		// code is taken directly from the helper's buffer.
+		auto helper = HLLWriterFactory::getInstance().createObject(
+			getId(), llvm::nulls());
+		prepareHelperWriter(helper);
+		helperWriters.push_back(helper);
+	}
+
+	std::vector<std::string> codeOfFuncs(funcs.size());
+	std::atomic<std::size_t> nextHelperIndex(0);
+	std::atomic<std::size_t> nextFuncIndex(0);
+	retdec::utils::runWorkers(numOfWorkers, [&]() {
+		// At most numOfWorkers instances of the worker can run, so every one
+		// of them gets its own helper writer.
+		const auto helper = helperWriters[nextHelperIndex.fetch_add(1)];
+		while (true) {
+			auto i = nextFuncIndex.fetch_add(1);
+			if (i >= funcs.size()) {
+				break;
+			}
+			helper->emitFunction(funcs[i]);
+			codeOfFuncs[i] = helper->takeEmittedCode();
+		}
+	});
+
+	bool somethingEmitted = false;
+	for (const auto &code : codeOfFuncs) {
+		if (code.empty()) {
+			continue;
+		}
+		if (somethingEmitted) {
+			// To produce an empty line between functions.
+			out << "\n";
+		}
+		out << code;
+		somethingEmitted = true;
+	}
+	return somethingEmitted;
+}
+
 /**
 * @brief Emits the footer of the <em>functions</em> block.
 *
@@ -1147,6 +1249,53 @@ bool HLLWriter::emitLLVMIRFixerWarningForFuncIfAny(ShPtr<Function> func) {
 	return true;
 }
 
+/**
+* @brief Writes the code buffered so far to the output and empties the buffer.
+*
+* All the emission goes through a buffer (see @c out), so tiny, per-token
+* stream operations never reach the output. The capacity of the buffer is
+* kept, so subsequent emission reuses the already allocated memory.
+*/
+void HLLWriter::flushOutBuffer() {
+	finalOut << outBufferStream.str();
+	outBuffer.clear();
+}
+
+/**
+* @brief Returns the code buffered so far and empties the buffer.
+*
+* In contrast to flushOutBuffer(), the buffered code is returned to the
+* caller instead of being written to the output.
+*/
+std::string HLLWriter::takeEmittedCode() {
+	outBufferStream.flush();
+	auto code = std::move(outBuffer);
+	outBuffer.clear();
+	return code;
+}
+
+/**
+* @brief Prepares the given helper writer for emitting functions from the
+*        current module.
+*
+* @param[in] helper A freshly created writer of the same kind as the current
+*                   writer.
+*
+* Helper writers are used by emitFunctionsInParallel() to emit function bodies
+* outside of the main writer. The base version hands over the module and the
+* options; subclasses have to override it to also hand over their own emission
+* state (and create thread-private instances of the stateful parts of it, like
+* bracket managers).
+*/
+void HLLWriter::prepareHelperWriter(ShPtr<HLLWriter> helper) {
+	helper->module = module;
+	helper->optionEmitDebugComments = optionEmitDebugComments;
+	helper->optionKeepAllBrackets = optionKeepAllBrackets;
+	helper->optionEmitTimeVaryingInfo = optionEmitTimeVaryingInfo;
+	helper->optionUseCompoundOperators = optionUseCompoundOperators;
+	helper->namesOfFuncsWithFixedIR = namesOfFuncsWithFixedIR;
+}
+
 /**
 * @brief Emits a section header comment.
 *
@@ -539,6 +539,32 @@ bool CHLLWriter::emitTargetCode(ShPtr<Module> module) {
 	return HLLWriter::emitTargetCode(module);
 }
 
+void CHLLWriter::prepareHelperWriter(ShPtr<HLLWriter> helper) {
+	HLLWriter::prepareHelperWriter(helper);
+
+	auto cHelper = ucast<CHLLWriter>(helper);
+
+	// The managers keep per-emission state, so every helper gets its own
+	// instances (see emitTargetCode()).
+	if (optionKeepAllBrackets) {
+		cHelper->bracketsManager = ShPtr<BracketManager>(new NoBracketManager(module));
+	} else {
+		cHelper->bracketsManager = ShPtr<BracketManager>(new CBracketManager(module));
+	}
+	if (optionUseCompoundOperators) {
+		cHelper->compoundOpManager = ShPtr<CompoundOpManager>(new CCompoundOpManager());
+	} else {
+		cHelper->compoundOpManager = ShPtr<CompoundOpManager>(new NoCompoundOpManager());
+	}
+
+	// The names of structures in the emitted bodies have to match the already
+	// emitted declarations.
+	cHelper->structNames = structNames;
+	cHelper->unnamedStructCounter = unnamedStructCounter;
+	cHelper->optionEmitFunctionPrototypesForNonLibraryFuncs =
+		optionEmitFunctionPrototypesForNonLibraryFuncs;
+}
+
 void CHLLWriter::visit(ShPtr<Variable> var) {
 	out << var->getName();
 }
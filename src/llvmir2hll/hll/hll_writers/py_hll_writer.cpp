@@ -165,6 +165,25 @@ bool PyHLLWriter::emitTargetCode(ShPtr<Module> module) {
 	return HLLWriter::emitTargetCode(module);
 }
 
+void PyHLLWriter::prepareHelperWriter(ShPtr<HLLWriter> helper) {
+	HLLWriter::prepareHelperWriter(helper);
+
+	auto pyHelper = ucast<PyHLLWriter>(helper);
+
+	// The managers keep per-emission state, so every helper gets its own
+	// instances (see emitTargetCode()).
+	if (optionKeepAllBrackets) {
+		pyHelper->bracketsManager = ShPtr<BracketManager>(new NoBracketManager(module));
+	} else {
+		pyHelper->bracketsManager = ShPtr<BracketManager>(new PyBracketManager(module));
+	}
+	if (optionUseCompoundOperators) {
+		pyHelper->compoundOpManager = ShPtr<CompoundOpManager>(new PyCompoundOpManager());
+	} else {
+		pyHelper->compoundOpManager = ShPtr<CompoundOpManager>(new NoCompoundOpManager());
+	}
+}
+
 void PyHLLWriter::visit(ShPtr<GlobalVarDef> varDef) {
 	out << getCurrentIndent();
 	ShPtr<Variable> var(varDef->getVar());
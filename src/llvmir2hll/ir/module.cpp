@@ -96,6 +96,24 @@ void Module::removeGlobalVar(ShPtr<Variable> var) {
 	}
 }
 
+/**
+* @brief Removes all the given variables from the module in one batch.
+*
+* Variables that are not global are ignored.
+*
+* Time complexity: @c O(n log m), where @c n is the number of global variables
+* in the module and @c m is the number of variables in @a vars. This is much
+* faster than calling removeGlobalVar() once per variable.
+*/
+void Module::removeGlobalVars(const VarSet &vars) {
+	globalVars.erase(
+		std::remove_if(globalVars.begin(), globalVars.end(),
+			[&vars](const ShPtr<GlobalVarDef> &varDef) {
+				return vars.find(varDef->getVar()) != vars.end();
+			}),
+		globalVars.end());
+}
+
 /**
 * @brief Returns @c true if @a var is a global variable, @c false otherwise.
 *
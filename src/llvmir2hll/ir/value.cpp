@@ -7,6 +7,7 @@
 #include "retdec/llvmir2hll/ir/statement.h"
 #include "retdec/llvmir2hll/ir/value.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/value_arena.h"
 #include "retdec/llvmir2hll/support/value_text_repr_visitor.h"
 
 namespace retdec {
@@ -38,6 +39,20 @@ Value::Value() {}
 */
 Value::~Value() {}
 
+/**
+* @brief Allocates a new value from the common arena.
+*/
+void *Value::operator new(std::size_t size) {
+	return GlobalValueArena::getInstance().allocate(size);
+}
+
+/**
+* @brief Returns the storage of a destructed value back to the common arena.
+*/
+void Value::operator delete(void *ptr, std::size_t size) noexcept {
+	GlobalValueArena::getInstance().deallocate(ptr, size);
+}
+
 ShPtr<Value> Value::getSelf() {
 	return shared_from_this();
 }
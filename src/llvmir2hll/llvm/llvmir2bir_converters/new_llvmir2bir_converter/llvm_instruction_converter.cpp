@@ -13,9 +13,11 @@
 #include <llvm/IR/User.h>
 #include <llvm/IR/Value.h>
 
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/strict_arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/address_op_expr.h"
 #include "retdec/llvmir2hll/ir/array_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/binary_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_cast_expr.h"
 #include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
@@ -25,6 +27,7 @@
 #include "retdec/llvmir2hll/ir/call_expr.h"
 #include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/const_string.h"
+#include "retdec/llvmir2hll/ir/constant.h"
 #include "retdec/llvmir2hll/ir/deref_op_expr.h"
 #include "retdec/llvmir2hll/ir/div_op_expr.h"
 #include "retdec/llvmir2hll/ir/eq_op_expr.h"
@@ -68,7 +71,8 @@ const unsigned COMPOSITE_TYPE_INDEX_SIZE_BITS = 32;
 * @brief Constructs a new converter.
 */
 LLVMInstructionConverter::LLVMInstructionConverter():
-	fcmpConverter(std::make_unique<LLVMFCmpConverter>()) {}
+	fcmpConverter(std::make_unique<LLVMFCmpConverter>()),
+	arithmExprEvaluator(StrictArithmExprEvaluator::create()) {}
 
 /**
 * @brief Destructs the converter.
@@ -391,75 +395,94 @@ ShPtr<Expression> LLVMInstructionConverter::visitInstruction(llvm::Instruction &
 *
 * Note that @a inst type is @c llvm::User instead of @c llvm::BinaryOperator
 * because this method can handle also constant binary expressions.
+*
+* When both operands are constants, the created expression is folded into
+* a single constant right away.
 */
 ShPtr<Expression> LLVMInstructionConverter::convertBinaryOpToExpression(
 		llvm::User &inst, unsigned opcode) {
 	auto op1 = getConverter()->convertValueToExpression(inst.getOperand(0));
 	auto op2 = getConverter()->convertValueToExpression(inst.getOperand(1));
 
+	ShPtr<Expression> expr;
 	switch (opcode) {
 		case llvm::Instruction::Add:
 		case llvm::Instruction::FAdd:
-			return AddOpExpr::create(op1, op2);
+			expr = AddOpExpr::create(op1, op2);
+			break;
 
 		case llvm::Instruction::Sub:
 		case llvm::Instruction::FSub:
-			return SubOpExpr::create(op1, op2);
+			expr = SubOpExpr::create(op1, op2);
+			break;
 
 		case llvm::Instruction::Mul:
 		case llvm::Instruction::FMul:
-			return MulOpExpr::create(op1, op2);
+			expr = MulOpExpr::create(op1, op2);
+			break;
 
 		case llvm::Instruction::UDiv:
-			return DivOpExpr::create(op1, op2,
+			expr = DivOpExpr::create(op1, op2,
 				DivOpExpr::Variant::UDiv);
+			break;
 
 		case llvm::Instruction::SDiv:
-			return DivOpExpr::create(op1, op2,
+			expr = DivOpExpr::create(op1, op2,
 				DivOpExpr::Variant::SDiv);
+			break;
 
 		case llvm::Instruction::FDiv:
-			return DivOpExpr::create(op1, op2,
+			expr = DivOpExpr::create(op1, op2,
 				DivOpExpr::Variant::FDiv);
+			break;
 
 		case llvm::Instruction::URem:
-			return ModOpExpr::create(op1, op2,
+			expr = ModOpExpr::create(op1, op2,
 				ModOpExpr::Variant::UMod);
+			break;
 
 		case llvm::Instruction::SRem:
-			return ModOpExpr::create(op1, op2,
+			expr = ModOpExpr::create(op1, op2,
 				ModOpExpr::Variant::SMod);
+			break;
 
 		case llvm::Instruction::FRem:
-			return ModOpExpr::create(op1, op2,
+			expr = ModOpExpr::create(op1, op2,
 				ModOpExpr::Variant::FMod);
+			break;
 
 		case llvm::Instruction::Shl:
-			return BitShlOpExpr::create(op1, op2);
+			expr = BitShlOpExpr::create(op1, op2);
+			break;
 
 		case llvm::Instruction::LShr:
-			return BitShrOpExpr::create(op1, op2,
+			expr = BitShrOpExpr::create(op1, op2,
 				BitShrOpExpr::Variant::Logical);
+			break;
 
 		case llvm::Instruction::AShr:
-			return BitShrOpExpr::create(op1, op2,
+			expr = BitShrOpExpr::create(op1, op2,
 				BitShrOpExpr::Variant::Arithmetical);
+			break;
 
 		case llvm::Instruction::And:
-			return BitAndOpExpr::create(op1, op2);
+			expr = BitAndOpExpr::create(op1, op2);
+			break;
 
 		case llvm::Instruction::Or:
-			return BitOrOpExpr::create(op1, op2);
+			expr = BitOrOpExpr::create(op1, op2);
+			break;
 
 		case llvm::Instruction::Xor:
-			return BitXorOpExpr::create(op1, op2);
+			expr = BitXorOpExpr::create(op1, op2);
+			break;
 
 		default:
 			FAIL("unsupported binary operator: " << inst);
 			return nullptr;
 	}
 
-	return nullptr;
+	return foldToConstantIfPossible(expr);
 }
 
 /**
@@ -474,51 +497,62 @@ ShPtr<Expression> LLVMInstructionConverter::convertICmpInstToExpression(
 	auto op1 = getConverter()->convertValueToExpression(inst.getOperand(0));
 	auto op2 = getConverter()->convertValueToExpression(inst.getOperand(1));
 
+	ShPtr<Expression> expr;
 	switch (predicate) {
 		case llvm::CmpInst::Predicate::ICMP_EQ:
-			return EqOpExpr::create(op1, op2);
+			expr = EqOpExpr::create(op1, op2);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_NE:
-			return NeqOpExpr::create(op1, op2);
+			expr = NeqOpExpr::create(op1, op2);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_UGT:
-			return GtOpExpr::create(op1, op2,
+			expr = GtOpExpr::create(op1, op2,
 				GtOpExpr::Variant::UCmp);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_UGE:
-			return GtEqOpExpr::create(op1, op2,
+			expr = GtEqOpExpr::create(op1, op2,
 				GtEqOpExpr::Variant::UCmp);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_ULT:
-			return LtOpExpr::create(op1, op2,
+			expr = LtOpExpr::create(op1, op2,
 				LtOpExpr::Variant::UCmp);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_ULE:
-			return LtEqOpExpr::create(op1, op2,
+			expr = LtEqOpExpr::create(op1, op2,
 				LtEqOpExpr::Variant::UCmp);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_SGT:
-			return GtOpExpr::create(op1, op2,
+			expr = GtOpExpr::create(op1, op2,
 				GtOpExpr::Variant::SCmp);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_SGE:
-			return GtEqOpExpr::create(op1, op2,
+			expr = GtEqOpExpr::create(op1, op2,
 				GtEqOpExpr::Variant::SCmp);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_SLT:
-			return LtOpExpr::create(op1, op2,
+			expr = LtOpExpr::create(op1, op2,
 				LtOpExpr::Variant::SCmp);
+			break;
 
 		case llvm::CmpInst::Predicate::ICMP_SLE:
-			return LtEqOpExpr::create(op1, op2,
+			expr = LtEqOpExpr::create(op1, op2,
 				LtEqOpExpr::Variant::SCmp);
+			break;
 
 		default:
 			FAIL("unsupported icmp predicate: " << inst);
 			return nullptr;
 	}
 
-	return nullptr;
+	return foldToConstantIfPossible(expr);
 }
 
 /**
@@ -689,6 +723,39 @@ ShPtr<Expression> LLVMInstructionConverter::convertGEPIndices(ShPtr<Expression>
 	return AddressOpExpr::create(indexOp);
 }
 
+/**
+* @brief Folds the given expression @a expr into a single constant if possible.
+*
+* @return A constant with the value of @a expr if both operands of @a expr are
+*         constants and the evaluation is safe, @a expr itself otherwise.
+*
+* Folding is done directly during conversion, so the later optimizers never
+* allocate and repeatedly traverse subtrees like <tt>2 + 3</tt> -- they get
+* a single constant right away. Since conversion works bottom-up, checking
+* the immediate operands is enough: nested constant subtrees were already
+* folded into constants when they were converted.
+*/
+ShPtr<Expression> LLVMInstructionConverter::foldToConstantIfPossible(
+		ShPtr<Expression> expr) {
+	auto binOpExpr = cast<BinaryOpExpr>(expr);
+	if (!binOpExpr) {
+		return expr;
+	}
+
+	if (!isa<Constant>(binOpExpr->getFirstOperand()) ||
+			!isa<Constant>(binOpExpr->getSecondOperand())) {
+		return expr;
+	}
+
+	// The strict evaluator refuses anything whose evaluation could change
+	// semantics (division by zero, overflows, mixed types, ...) -- in such
+	// a case, keep the original expression.
+	if (auto constant = arithmExprEvaluator->evaluate(expr)) {
+		return constant;
+	}
+	return expr;
+}
+
 /**
 * @brief Returns the @c LLVMValueConverter.
 */
@@ -91,6 +91,11 @@ ShPtr<Type> LLVMTypeConverter::convert(const llvm::Type *type) {
 ShPtr<PointerType> LLVMTypeConverter::convert(const llvm::PointerType *type) {
 	PRECONDITION_NON_NULL(type);
 
+	auto existingTypeIt = mapLLVMTypeToType.find(type);
+	if (existingTypeIt != mapLLVMTypeToType.end()) {
+		return ucast<PointerType>(existingTypeIt->second);
+	}
+
 	auto birType = PointerType::create(UnknownType::create());
 	mapLLVMTypeToType.emplace(type, birType);
 
@@ -107,6 +112,11 @@ ShPtr<PointerType> LLVMTypeConverter::convert(const llvm::PointerType *type) {
 ShPtr<ArrayType> LLVMTypeConverter::convert(const llvm::ArrayType *type) {
 	PRECONDITION_NON_NULL(type);
 
+	auto existingTypeIt = mapLLVMTypeToType.find(type);
+	if (existingTypeIt != mapLLVMTypeToType.end()) {
+		return ucast<ArrayType>(existingTypeIt->second);
+	}
+
 	ArrayType::Dimensions arrayDims = {static_cast<std::size_t>(type->getNumElements())};
 
 	auto elemTypeIt = type->getElementType();
@@ -116,7 +126,9 @@ ShPtr<ArrayType> LLVMTypeConverter::convert(const llvm::ArrayType *type) {
 	}
 
 	auto elemType = convert(elemTypeIt);
-	return ArrayType::create(elemType, arrayDims);
+	auto birType = ArrayType::create(elemType, arrayDims);
+	mapLLVMTypeToType.emplace(type, birType);
+	return birType;
 }
 
 /**
@@ -128,13 +140,20 @@ ShPtr<ArrayType> LLVMTypeConverter::convert(const llvm::ArrayType *type) {
 ShPtr<StructType> LLVMTypeConverter::convert(const llvm::StructType *type) {
 	PRECONDITION_NON_NULL(type);
 
+	auto existingTypeIt = mapLLVMTypeToType.find(type);
+	if (existingTypeIt != mapLLVMTypeToType.end()) {
+		return ucast<StructType>(existingTypeIt->second);
+	}
+
 	StructType::ElementTypes elemTypes;
 	for (const auto &elem: type->elements()) {
 		elemTypes.push_back(convert(elem));
 	}
 
 	std::string name = type->hasName() ? type->getName() : "";
-	return StructType::create(elemTypes, name);
+	auto birType = StructType::create(elemTypes, name);
+	mapLLVMTypeToType.emplace(type, birType);
+	return birType;
 }
 
 /**
@@ -146,6 +165,11 @@ ShPtr<StructType> LLVMTypeConverter::convert(const llvm::StructType *type) {
 ShPtr<FunctionType> LLVMTypeConverter::convert(const llvm::FunctionType *type) {
 	PRECONDITION_NON_NULL(type);
 
+	auto existingTypeIt = mapLLVMTypeToType.find(type);
+	if (existingTypeIt != mapLLVMTypeToType.end()) {
+		return ucast<FunctionType>(existingTypeIt->second);
+	}
+
 	auto retType = convert(type->getReturnType());
 	auto funcType = FunctionType::create(retType);
 
@@ -157,6 +181,7 @@ ShPtr<FunctionType> LLVMTypeConverter::convert(const llvm::FunctionType *type) {
 		funcType->setVarArg();
 	}
 
+	mapLLVMTypeToType.emplace(type, funcType);
 	return funcType;
 }
 
@@ -5,6 +5,7 @@
 */
 
 #include <algorithm>
+#include <utility>
 
 #include <llvm/Analysis/LoopInfo.h>
 #include <llvm/Analysis/ScalarEvolution.h>
@@ -13,6 +14,7 @@
 #include <llvm/IR/Instructions.h>
 #include <llvm/Pass.h>
 
+#include "retdec/llvm-support/diagnostics.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/break_stmt.h"
 #include "retdec/llvmir2hll/ir/const_bool.h"
@@ -35,6 +37,7 @@
 #include "retdec/llvmir2hll/support/expression_negater.h"
 #include "retdec/llvmir2hll/utils/ir.h"
 #include "retdec/utils/container.h"
+#include "retdec/utils/instrumentation.h"
 
 using namespace std::placeholders;
 
@@ -58,6 +61,15 @@ const unsigned LIMIT_CLONED_STATEMENTS = 5;
 /// if target body has less statements, it is inserted in place of goto statement
 const unsigned MIN_GOTO_STATEMENTS = 3;
 
+/// Number of successful CFG reductions per one basic block of a function that
+/// the structuring may spend. On adversarial, heavily obfuscated functions,
+/// the repeated reductions (with statement cloning) can go superlinear.
+const std::size_t CFG_REDUCTION_STEPS_PER_NODE = 64;
+
+/// Lower bound of the reduction budget, so small functions with complicated
+/// control flow are not limited needlessly.
+const std::size_t CFG_REDUCTION_MIN_STEPS = 1024;
+
 } // anonymous namespace
 
 /**
@@ -93,8 +105,21 @@ ShPtr<Statement> StructureConverter::convertFuncBody(llvm::Function &func) {
 	auto cfg = createCFG(func.getEntryBlock());
 	detectBackEdges(cfg);
 
+	// Watchdog: when the reduction does not finish within its budget, the
+	// rest of the CFG is structured by gotos -- bounded latency matters more
+	// than structured output on hostile samples.
+	std::size_t remainingSteps = std::max<std::size_t>(
+		CFG_REDUCTION_MIN_STEPS, CFG_REDUCTION_STEPS_PER_NODE * func.size());
 	while (cfg->getSuccNum() != 0 && reduceCFG(cfg)) {
 		// Keep looping until the CFG is reduced.
+		if (remainingSteps-- == 0) {
+			utils::instrumentation::incrementCounter(
+				"watchdog/structure-converter/goto-fallback");
+			llvm_support::printWarningMessage("structuring of function '",
+				func.getName().str(), "' exceeded its budget; generating"
+				" goto code for the unreduced part");
+			break;
+		}
 	}
 
 	if (cfg->getSuccNum() != 0) {
@@ -427,6 +452,7 @@ bool StructureConverter::inspectCFGNode(ShPtr<CFGNode> node) {
 			(statementsStack.empty() || statementsStack.top() != node)) {
 		loopHeaders.emplace(getLoopFor(node), node);
 		node->setStatementSuccessor(getLoopSuccessor(node));
+		invalidateQueryResultsFor(node);
 
 		statementsStack.push(node);
 		statementsOnStack.insert(node);
@@ -658,11 +684,65 @@ bool StructureConverter::existsPathWithoutLoopsBetween(const ShPtr<CFGNode> &nod
 	PRECONDITION_NON_NULL(node1);
 	PRECONDITION_NON_NULL(node2);
 
-	auto predicate = [&node2](const auto &node) {
-		return node == node2;
-	};
+	return hasItem(getReachableNodesFrom(node1), node2);
+}
+
+/**
+* @brief Returns the set of nodes which are reachable from the given node
+*        @a node without passing a back-edge.
+*
+* The set also contains @a node itself. The result is memoized, so repeated
+* queries with the same starting node are answered in constant time. Whenever
+* edges of a node are changed, invalidateQueryResultsFor() has to be called
+* with that node.
+*
+* @par Preconditions
+*  - @a node is non-null
+*/
+const CFGNode::CFGNodeSet &StructureConverter::getReachableNodesFrom(
+		const ShPtr<CFGNode> &node) const {
+	PRECONDITION_NON_NULL(node);
+
+	auto existingIt = reachableNodes.find(node);
+	if (existingIt != reachableNodes.end()) {
+		return existingIt->second;
+	}
+
+	CFGNodeQueue toBeVisited({node});
+	CFGNode::CFGNodeSet visited{node};
+	while (!toBeVisited.empty()) {
+		auto currNode = popFromQueue(toBeVisited);
+		addUnvisitedSuccessorsToQueue(currNode, toBeVisited, visited);
+	}
 
-	return BFSFindFirst(node1, predicate) != nullptr;
+	return reachableNodes.emplace(node, std::move(visited)).first->second;
+}
+
+/**
+* @brief Drops the memoized query results which may have been changed by
+*        a modification of edges of the given node @a node.
+*
+* A memoized set of reachable nodes can be affected by the modification only
+* when it contains @a node, because every path whose existence the modification
+* could change passes through @a node. The memoized switch successors depend
+* on reachability in the whole graph, so all of them are dropped.
+*
+* @par Preconditions
+*  - @a node is non-null
+*/
+void StructureConverter::invalidateQueryResultsFor(
+		const ShPtr<CFGNode> &node) const {
+	PRECONDITION_NON_NULL(node);
+
+	for (auto it = reachableNodes.begin(), e = reachableNodes.end(); it != e; ) {
+		if (hasItem(it->second, node)) {
+			it = reachableNodes.erase(it);
+		} else {
+			++it;
+		}
+	}
+
+	switchSuccessors.clear();
 }
 
 /**
@@ -1070,6 +1150,7 @@ void StructureConverter::reduceToSequence(ShPtr<CFGNode> node) {
 	node->setLastBB(succ->getLastBB());
 	node->moveSuccessorsFrom(succ);
 	generatedNodes.insert(succ);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1088,6 +1169,7 @@ void StructureConverter::reduceToSequenceClone(ShPtr<CFGNode> node) {
 	node->setLastBB(succ->getLastBB());
 	node->removeSucc(0);
 	generatedNodes.insert(succ);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1111,6 +1193,7 @@ void StructureConverter::reduceToIfElseStatement(ShPtr<CFGNode> node) {
 
 	node->deleteSuccessors();
 	node->addSuccessor(newSucc);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1139,6 +1222,7 @@ void StructureConverter::reduceToIfStatement(ShPtr<CFGNode> node,
 	node->appendToBody(getIfStmt(cond, trueBody, falseBody));
 
 	node->deleteSucc(succ);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1169,6 +1253,7 @@ void StructureConverter::reduceToIfStatementClone(ShPtr<CFGNode> node,
 	node->appendToBody(getIfStmt(cond, trueBody, falseBody));
 
 	node->removeSucc(succ);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1212,6 +1297,7 @@ void StructureConverter::reduceToIfElseStatementWithBreakInLoop(ShPtr<CFGNode> n
 	}
 
 	node->removeSucc(succ);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1247,6 +1333,7 @@ void StructureConverter::reduceToIfElseStatementWithBreakByGotoInLoop(ShPtr<CFGN
 	addGotoTargetIfNotExists(targetNode);
 
 	node->removeSucc(succ);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1287,6 +1374,7 @@ void StructureConverter::reduceToIfElseStatementWithContinue(ShPtr<CFGNode> node
 	node->appendToBody(getIfStmt(cond, ifBody));
 
 	node->removeSucc(succ);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1317,6 +1405,7 @@ void StructureConverter::reduceToContinueStatement(ShPtr<CFGNode> node) {
 	node->appendToBody(continueStmt);
 
 	node->removeSucc(0);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1351,6 +1440,7 @@ void StructureConverter::reduceToForLoop(ShPtr<CFGNode> node) {
 		node->addSuccessor(node->getStatementSuccessor());
 		node->removeStatementSuccessor();
 	}
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1377,6 +1467,7 @@ void StructureConverter::reduceToWhileTrueLoop(ShPtr<CFGNode> node) {
 		node->addSuccessor(node->getStatementSuccessor());
 		node->removeStatementSuccessor();
 	}
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1424,6 +1515,7 @@ void StructureConverter::reduceToNestedWhileTrueLoopWithContinueInHeader(
 	reducedLoops.insert(getLoopFor(node));
 
 	node->addSuccessor(parentLoopHeader);
+	invalidateQueryResultsFor(node);
 }
 
 /**
@@ -1484,6 +1576,7 @@ void StructureConverter::structureByGotos(ShPtr<CFGNode> cfg) {
 		while (node->getSuccNum() > 0) {
 			node->removeSucc(0);
 		}
+		invalidateQueryResultsFor(node);
 	}
 }
 
@@ -1639,12 +1732,16 @@ void StructureConverter::reduceSwitchStatement(ShPtr<CFGNode> node) {
 	if (switchSuccessor) {
 		node->addSuccessor(switchSuccessor);
 	}
+	invalidateQueryResultsFor(node);
 }
 
 /**
 * @brief Returns successor of the given switch node @a switchNode.
 *
 * Switch also could have no successor. In that case, nullptr is returned.
+* The result is memoized until edges of any node are changed, so the repeated
+* computation in reduceSwitchStatement() right after isSwitchStatement() is
+* answered in constant time.
 *
 * @par Preconditions
 *  - @a switchNode is non-null
@@ -1653,9 +1750,17 @@ ShPtr<CFGNode> StructureConverter::getSwitchSuccessor(
 		const ShPtr<CFGNode> &switchNode) const {
 	PRECONDITION_NON_NULL(switchNode);
 
-	return BFSFindFirst(switchNode, [this, &switchNode](const auto &node) {
-		return this->isNodeAfterAllSwitchClauses(node, switchNode);
-	});
+	auto existingIt = switchSuccessors.find(switchNode);
+	if (existingIt != switchSuccessors.end()) {
+		return existingIt->second;
+	}
+
+	auto switchSuccessor = BFSFindFirst(switchNode,
+		[this, &switchNode](const auto &node) {
+			return this->isNodeAfterAllSwitchClauses(node, switchNode);
+		});
+	switchSuccessors.emplace(switchNode, switchSuccessor);
+	return switchSuccessor;
 }
 
 /**
@@ -2429,6 +2534,8 @@ void StructureConverter::cleanUp() {
 	loopTargets.clear();
 	targetReferences.clear();
 	stmtClones.clear();
+	reachableNodes.clear();
+	switchSuccessors.clear();
 }
 
 } // namespace llvmir2hll
@@ -5,9 +5,11 @@
 */
 
 #include <cstddef>
+#include <iterator>
 
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/ir/call_expr.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
@@ -142,6 +144,76 @@ bool CallInfoObtainer::isInitialized() const {
 	return cg && module;
 }
 
+/**
+* @brief (Re-)initializes the obtainer for the given module, reusing the
+*        cached call graph whenever possible.
+*
+* @param[in] module The current module.
+* @param[in] va The used analysis of values.
+*
+* If the obtainer has already been initialized for @a module, the call graph
+* from the last initialization is reused; only its parts for functions marked
+* by markFuncCallsAsChanged() are recomputed. Otherwise, this function behaves
+* as @c init(CGBuilder::getCG(module), va).
+*
+* Note that only the construction of the call graph is cached. The function
+* and call information is always recomputed, just like in init(), because it
+* also depends on the bodies of functions, which may have been changed in
+* arbitrary ways.
+*
+* @par Preconditions
+*  - both @a module and @a va are non-null
+*  - @a va is in a valid state
+*/
+void CallInfoObtainer::update(ShPtr<Module> module, ShPtr<ValueAnalysis> va) {
+	PRECONDITION_NON_NULL(module);
+
+	if (!isInitialized() || this->module != module ||
+			!cgMatchesFuncsInModule(module)) {
+		// We cannot reuse the cached call graph, so build a new one.
+		funcsWithChangedCalls.clear();
+		init(CGBuilder::getCG(module), va);
+		return;
+	}
+
+	if (!funcsWithChangedCalls.empty()) {
+		CGBuilder::updateFuncsInCG(cg, funcsWithChangedCalls);
+		funcsWithChangedCalls.clear();
+	}
+	init(cg, va);
+}
+
+/**
+* @brief Marks @a func as a function whose set of function calls has been
+*        changed.
+*
+* Call this function whenever you add or remove a function call in @a func.
+* The next call to update() then recomputes the cached call graph just for the
+* marked functions instead of building a whole new call graph.
+*/
+void CallInfoObtainer::markFuncCallsAsChanged(ShPtr<Function> func) {
+	funcsWithChangedCalls.insert(func);
+}
+
+/**
+* @brief Returns @c true if the cached call graph describes precisely the
+*        functions in @a module, @c false otherwise.
+*
+* When functions have been added into or removed from the module since the
+* call graph was built, the call graph cannot be reused.
+*/
+bool CallInfoObtainer::cgMatchesFuncsInModule(ShPtr<Module> module) const {
+	std::size_t numOfFuncsInModule = 0;
+	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
+		if (!cg->getCalledFuncs(*i)) {
+			return false;
+		}
+		++numOfFuncsInModule;
+	}
+	return numOfFuncsInModule == static_cast<std::size_t>(
+		std::distance(cg->caller_begin(), cg->caller_end()));
+}
+
 /**
 * @brief Computes an order in which FuncInfos should be computed.
 *
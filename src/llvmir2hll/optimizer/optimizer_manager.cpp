@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/analysis/liveness_analysis.h"
+#include "retdec/llvmir2hll/analysis/loop_info_analysis.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
@@ -25,6 +27,7 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/deref_to_array_index_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/empty_array_to_string_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/empty_stmt_optimizer.h"
+#include "retdec/llvmir2hll/optimizer/optimizers/fused_peephole_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/global_to_local_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/if_before_loop_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/if_structure_optimizer.h"
@@ -35,7 +38,6 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/pre_while_true_loop_conv_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/remove_all_casts_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/remove_useless_casts_optimizer.h"
-#include "retdec/llvmir2hll/optimizer/optimizers/self_assign_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simple_copy_propagation_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/unreachable_code_optimizer.h"
@@ -48,6 +50,7 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_while_cond_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/utils/container.h"
+#include "retdec/utils/instrumentation.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
 
@@ -159,6 +162,8 @@ OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 		enabledOpts(trimOptimizerSuffix(enabledOpts)),
 		disabledOpts(trimOptimizerSuffix(disabledOpts)),
 		hllWriter(hllWriter), va(va), cio(cio),
+		la(LivenessAnalysis::create()),
+		loopInfo(LoopInfoAnalysis::create()),
 		arithmExprEvaluator(arithmExprEvaluator),
 		enableAggressiveOpts(enableAggressiveOpts), enableDebug(enableDebug),
 		recoverFromOutOfMemory(true), frontendRunOpts(), backendRunOpts() {
@@ -218,10 +223,11 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// GlobalToLocalOptimizer should be run before CopyPropagationOptimizer.
 	runUnlessRunInFrontend<GlobalToLocalOptimizer>(m, va, cio);
 	// The following optimizations should be run before CopyPropagation to
-	// speed it up.
-	runUnlessRunInFrontend<DeadGlobalAssignOptimizer>(m, va, cio);
+	// speed it up. They share a single liveness analysis, so its summaries
+	// are computed just once per function.
+	runUnlessRunInFrontend<DeadGlobalAssignOptimizer>(m, va, cio, la);
 	run<UnusedGlobalVarOptimizer>(m);
-	run<DeadLocalAssignOptimizer>(m, va);
+	run<DeadLocalAssignOptimizer>(m, va, la);
 	run<SimpleCopyPropagationOptimizer>(m, va, cio);
 	run<CopyPropagationOptimizer>(m, va, cio);
 	// AuxiliaryVariablesOptimizer should be run after GlobalToLocalOptimizer
@@ -242,9 +248,12 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// PreWhileTrueLoopConvOptimizer should be run before other `while True`
 	// loop optimizers.
 	run<PreWhileTrueLoopConvOptimizer>(m, va);
+	// The optimizations above may have changed the loops, so drop the shared
+	// loop information before the loop-conversion optimizers use it.
+	loopInfo->clearCache();
 	// WhileTrueToForLoopOptimizer should be run before
 	// WhileTrueToWhileCondOptimizer.
-	run<WhileTrueToForLoopOptimizer>(m, va, arithmExprEvaluator);
+	run<WhileTrueToForLoopOptimizer>(m, va, arithmExprEvaluator, loopInfo);
 	// TODO The WhileTrueToUForLoopOptimizer does nothing at the moment, so it
 	//      makes no sense to run it.
 	#if 0
@@ -253,10 +262,10 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// better results). Also, run it only for C because the Python HLL writer
 	// does not support emission of universal for loops.
 	if (hllWriter->getId() == "c") {
-		run<WhileTrueToUForLoopOptimizer>(m, va);
+		run<WhileTrueToUForLoopOptimizer>(m, va, loopInfo);
 	}
 	#endif
-	run<WhileTrueToWhileCondOptimizer>(m);
+	run<WhileTrueToWhileCondOptimizer>(m, loopInfo);
 	run<IfBeforeLoopOptimizer>(m, va);
 	// Unreachable code should be removed after all structural optimizations to
 	// make sure that none of them appends something to unreachable statements.
@@ -282,10 +291,13 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 		// GlobalToLocalOptimizer should be run before CopyPropagationOptimizer.
 		runUnlessRunInFrontend<GlobalToLocalOptimizer>(m, va, cio);
 		// Dead{Global,Local}AssignOptimizer should be run before
-		// CopyPropagationOptimizer to speed it up.
-		runUnlessRunInFrontend<DeadGlobalAssignOptimizer>(m, va, cio);
+		// CopyPropagationOptimizer to speed it up. The optimizations run
+		// since the first phase have changed the code, so the shared liveness
+		// summaries have to be dropped before they are used again.
+		la->clearCache();
+		runUnlessRunInFrontend<DeadGlobalAssignOptimizer>(m, va, cio, la);
 		run<UnusedGlobalVarOptimizer>(m);
-		run<DeadLocalAssignOptimizer>(m, va);
+		run<DeadLocalAssignOptimizer>(m, va, la);
 		run<SimpleCopyPropagationOptimizer>(m, va, cio);
 		run<CopyPropagationOptimizer>(m, va, cio);
 	}
@@ -293,7 +305,17 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// This is best to be run after DeadLocalAssignOptimizer and
 	// CopyPropagationOptimizer because it can get rid of statements like `v =
 	// v`, where v is a variable.
-	run<SelfAssignOptimizer>(m);
+	// The removal of self assignments is fused with the removal of empty
+	// statements that the previous optimizations may have left behind, so
+	// both are done in a single traversal. When debug comments are emitted,
+	// empty statements have to be kept (see the EmptyStmtOptimizer run
+	// above).
+	std::vector<FusedPeepholeOptimizer::RewriteRule> peepholeRules;
+	peepholeRules.push_back(FusedPeepholeOptimizer::createSelfAssignRule());
+	if (!enableDebug) {
+		peepholeRules.push_back(FusedPeepholeOptimizer::createEmptyStmtRule());
+	}
+	run<FusedPeepholeOptimizer>(m, peepholeRules);
 
 	// VarDefForLoopOptimizer and VarDefStmtOptimizer are utilized also if the
 	// output is Python because in this way, we may emit addresses of
@@ -363,6 +385,8 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 
 	printOptimization(OPT_ID);
 
+	retdec::utils::instrumentation::ScopedPhase phase("backend-opt/" + OPT_ID);
+
 	if (recoverFromOutOfMemory) {
 		// Some optimizations, most notable CopyPropagation, may run out of
 		// memory on huge inputs. We try to recover from such situations by
@@ -4,6 +4,7 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/ir/variable.h"
@@ -41,17 +42,17 @@ void AggressiveGlobalToLocalOptimizer::doOptimization() {
 * @brief Converts all global variables to local variables.
 */
 void AggressiveGlobalToLocalOptimizer::convertGlobalVarsToLocalVars() {
-	// TODO The following algorithm may introduce local variables which are
-	//      never used. Improve it by computing the global variables that are
-	//      actually used in the function.
-
-	// Since we are going to remove global variables from the module during
-	// iteration, store them into a container and iterate over this copy.
+	// Since we are going to remove global variables from the module, store
+	// them into a container and iterate over this copy.
 	VarSet globalVars(module->getGlobalVars());
 
-	// For each function...
+	// For each function, compute the global variables which it actually uses
+	// (in a single pass over its body) and convert just them. In this way, we
+	// do not introduce local variables which are never used.
 	for (auto i = module->func_definition_begin(),
 			e = module->func_definition_end(); i != e; ++i) {
+		ShPtr<UsedVars> usedVars(UsedVarsVisitor::getUsedVars(
+			(*i)->getBody()));
 		// For each global variable...
 		for (const auto &var : globalVars) {
 			// Skip global variables which have an assigned name from debug
@@ -60,8 +61,19 @@ void AggressiveGlobalToLocalOptimizer::convertGlobalVarsToLocalVars() {
 				continue;
 			}
 
+			if (!usedVars->isUsed(var)) {
+				continue;
+			}
+
 			ShPtr<Expression> init(module->getInitForGlobalVar(var));
 			convertGlobalVarToLocalVarInFunc(var, *i, init);
+		}
+	}
+
+	// Finally, remove the converted global variables from the module in one
+	// batch.
+	for (const auto &var : globalVars) {
+		if (!module->hasAssignedDebugName(var)) {
 			module->removeGlobalVar(var);
 		}
 	}
@@ -6,7 +6,6 @@
 
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/auxiliary_variables_cfg_traversal.h"
-#include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/statement.h"
@@ -51,16 +50,10 @@ void AuxiliaryVariablesOptimizer::doOptimization() {
 	if (!va->isInValidState()) {
 		va->clearCache();
 	}
-	cio->init(CGBuilder::getCG(module), va);
+	cio->update(module, va);
 
 	// Perform the optimization on all functions.
 	FuncOptimizer::doOptimization();
-
-	// Currently, we do not update the used analysis of values (va) during this
-	// optimization, so here, at the end of the optimization, we have to put it
-	// into an invalid state.
-	// TODO Regularly update the cache of va so we do not have to invalidate it.
-	va->invalidateState();
 }
 
 void AuxiliaryVariablesOptimizer::runOnFunction(ShPtr<Function> func) {
@@ -70,7 +63,13 @@ void AuxiliaryVariablesOptimizer::runOnFunction(ShPtr<Function> func) {
 
 	// Replace them with original variables. The following loop has to be done
 	// first because the visitation functions modify auxVars.
+	//
+	// Since we replace every occurrence of an auxiliary variable, the cached
+	// results of the used analysis of values that become stale are precisely
+	// those computed from the variable, so drop just them instead of
+	// invalidating the whole analysis.
 	for (const auto &var : auxVars) {
+		va->removeDependentFromCache(var);
 		func->removeLocalVar(var);
 	}
 	visitStmt(func->getBody());
@@ -13,7 +13,6 @@
 #include "retdec/llvmir2hll/graphs/cfg/cfg.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/no_var_def_cfg_traversal.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/var_def_cfg_traversal.h"
-#include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/call_expr.h"
 #include "retdec/llvmir2hll/ir/const_array.h"
@@ -198,7 +197,7 @@ void CopyPropagationOptimizer::doOptimization() {
 	// surprisingly speeds up the optimization).
 	va->clearCache();
 	va->initAliasAnalysis(module);
-	cio->init(CGBuilder::getCG(module), va);
+	cio->update(module, va);
 	vuv = VarUsesVisitor::create(va, true, module);
 	dua = DefUseAnalysis::create(module, va, vuv);
 	uda = UseDefAnalysis::create(module);
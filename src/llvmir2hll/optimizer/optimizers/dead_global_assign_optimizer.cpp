@@ -4,12 +4,13 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/analysis/liveness_analysis.h"
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/modified_before_read_cfg_traversal.h"
 #include "retdec/llvmir2hll/graphs/cg/cg.h"
-#include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
@@ -31,13 +32,20 @@ namespace llvmir2hll {
 * @param[in] module Module to be optimized.
 * @param[in] va Analysis of values.
 * @param[in] cio Obtainer of information about function calls.
+* @param[in] la Analysis providing liveness summaries of functions. If it is
+*               the null pointer, the optimizer creates its own analysis.
+*
+* By passing a single liveness analysis to several optimizers, its summaries
+* are computed just once and shared between them.
 *
 * @par Preconditions
 *  - @a module, @a va, and @a cio are non-null
 */
 DeadGlobalAssignOptimizer::DeadGlobalAssignOptimizer(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio):
+		ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
+		ShPtr<LivenessAnalysis> la):
 	FuncOptimizer(module), va(va), cio(cio),
+	la(la ? la : LivenessAnalysis::create()),
 	cfgBuilder(NonRecursiveCFGBuilder::create()),
 	globalVars(module->getGlobalVars()), codeChanged(false) {
 		PRECONDITION_NON_NULL(module);
@@ -55,7 +63,7 @@ void DeadGlobalAssignOptimizer::doOptimization() {
 	if (!va->isInValidState()) {
 		va->clearCache();
 	}
-	cio->init(CGBuilder::getCG(module), va);
+	cio->update(module, va);
 
 	// Perform the optimization on all functions.
 	FuncOptimizer::doOptimization();
@@ -72,6 +80,12 @@ void DeadGlobalAssignOptimizer::runOnFunction(ShPtr<Function> func) {
 	do {
 		codeChanged = false;
 		FuncOptimizer::runOnFunction(func);
+		if (codeChanged) {
+			// The removed assignments may have been the last uses of some
+			// variables, so the liveness summary of the function has to be
+			// re-computed before the next round.
+			la->funcHasBeenChanged(func);
+		}
 	} while (codeChanged);
 }
 
@@ -94,6 +108,18 @@ bool DeadGlobalAssignOptimizer::canBeOptimized(ShPtr<AssignStmt> stmt) {
 		return false;
 	}
 
+	// If this assignment is the only place in the function where the variable
+	// is directly written into and the function contains no calls, the
+	// variable cannot be modified again before being read or before the
+	// function exits, so the CFG traversal below could never succeed. This
+	// check is cheap (the liveness summary is shared and computed just once
+	// per function), so perform it before the traversal.
+	ShPtr<UsedVars> funcLiveness(la->getLivenessInfo(
+		currCFG->getCorrespondingFunction()));
+	if (!funcLiveness->hasCalls() && funcLiveness->getNumOfWrites(lhsVar) <= 1) {
+		return false;
+	}
+
 	// The assignment cannot be the last statement in the function.
 	ShPtr<Statement> stmtSucc(skipEmptyStmts(stmt->getSuccessor()));
 	if (!stmtSucc) {
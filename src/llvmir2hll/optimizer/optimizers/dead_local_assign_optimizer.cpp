@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/analysis/liveness_analysis.h"
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/analysis/var_uses_visitor.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
@@ -27,13 +29,19 @@ namespace llvmir2hll {
 *
 * @param[in] module Module to be optimized.
 * @param[in] va Analysis of values.
+* @param[in] la Analysis providing liveness summaries of functions. If it is
+*               the null pointer, the optimizer creates its own analysis.
+*
+* By passing a single liveness analysis to several optimizers, its summaries
+* are computed just once and shared between them.
 *
 * @par Preconditions
 *  - @a module and @a va are non-null
 */
 DeadLocalAssignOptimizer::DeadLocalAssignOptimizer(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va):
-	FuncOptimizer(module), va(va), vuv() {
+		ShPtr<ValueAnalysis> va, ShPtr<LivenessAnalysis> la):
+	FuncOptimizer(module), va(va),
+	la(la ? la : LivenessAnalysis::create()), vuv() {
 		PRECONDITION_NON_NULL(module);
 		PRECONDITION_NON_NULL(va);
 	}
@@ -109,8 +117,23 @@ bool DeadLocalAssignOptimizer::canBeOptimized(ShPtr<Variable> var,
 bool DeadLocalAssignOptimizer::tryToOptimize(ShPtr<Function> func) {
 	bool codeChanged = false;
 
+	// Function declarations have no bodies (and no local variables), so there
+	// is nothing to optimize in them.
+	if (func->isDeclaration()) {
+		return false;
+	}
+
+	ShPtr<UsedVars> funcLiveness(la->getLivenessInfo(func));
+
 	// For every local variable in the function (excluding parameters)...
 	for (const auto &var : func->getLocalVars()) {
+		// A variable which is read somewhere in the function cannot be dead,
+		// so skip it right away without inspecting its uses (canBeOptimized()
+		// would reject the reading use anyway).
+		if (funcLiveness->isUsed(var, /*read=*/true, /*written=*/false)) {
+			continue;
+		}
+
 		// Check that all uses satisfy certain conditions.
 		ShPtr<VarUses> varUses(vuv->getUses(var, func));
 		if (!canBeOptimized(var, varUses)) {
@@ -129,6 +152,13 @@ bool DeadLocalAssignOptimizer::tryToOptimize(ShPtr<Function> func) {
 		}
 	}
 
+	if (codeChanged) {
+		// The removed statements may have been the last reads of other
+		// variables, so the liveness summary of the function has to be
+		// re-computed before the next round.
+		la->funcHasBeenChanged(func);
+	}
+
 	return codeChanged;
 }
 
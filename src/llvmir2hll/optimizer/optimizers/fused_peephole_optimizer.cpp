@@ -0,0 +1,142 @@
+/**
+* @file src/llvmir2hll/optimizer/optimizers/fused_peephole_optimizer.cpp
+* @brief Implementation of FusedPeepholeOptimizer.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/empty_stmt.h"
+#include "retdec/llvmir2hll/ir/expression.h"
+#include "retdec/llvmir2hll/ir/statement.h"
+#include "retdec/llvmir2hll/optimizer/optimizers/fused_peephole_optimizer.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/utils/container.h"
+
+using retdec::utils::hasItem;
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs a new optimizer.
+*
+* @param[in] module Module to be optimized.
+* @param[in] rules Rewrite rules to be run (see the class description).
+*
+* @par Preconditions
+*  - @a module is non-null
+*/
+FusedPeepholeOptimizer::FusedPeepholeOptimizer(ShPtr<Module> module,
+	const std::vector<RewriteRule> &rules):
+		FuncOptimizer(module), rules(rules) {
+			PRECONDITION_NON_NULL(module);
+		}
+
+/**
+* @brief Destructs the optimizer.
+*/
+FusedPeepholeOptimizer::~FusedPeepholeOptimizer() {}
+
+/**
+* @brief Returns a rule that removes self assignments (see
+*        SelfAssignOptimizer).
+*/
+FusedPeepholeOptimizer::RewriteRule FusedPeepholeOptimizer::createSelfAssignRule() {
+	return [](ShPtr<Statement> stmt) {
+		auto assignStmt = cast<AssignStmt>(stmt);
+		if (!assignStmt ||
+				!assignStmt->getLhs()->isEqualTo(assignStmt->getRhs())) {
+			return false;
+		}
+		Statement::removeStatementButKeepDebugComment(stmt);
+		return true;
+	};
+}
+
+/**
+* @brief Returns a rule that removes empty statements (see
+*        EmptyStmtOptimizer).
+*/
+FusedPeepholeOptimizer::RewriteRule FusedPeepholeOptimizer::createEmptyStmtRule() {
+	return [](ShPtr<Statement> stmt) {
+		if (!isa<EmptyStmt>(stmt)) {
+			return false;
+		}
+		Statement::removeStatement(stmt);
+		return true;
+	};
+}
+
+void FusedPeepholeOptimizer::runOnFunction(ShPtr<Function> func) {
+	// Phase 1: collect every statement of the function in a single
+	// traversal. The collection is done in the overridden visitStmt().
+	workList.clear();
+	inWorkList.clear();
+	FuncOptimizer::runOnFunction(func);
+
+	// Phase 2: feed the statements to the rules. Whenever a rule changes
+	// something, only the neighborhood of the changed statement is
+	// reexamined.
+	while (!workList.empty()) {
+		auto stmt = workList.front();
+		workList.pop_front();
+		inWorkList.erase(stmt);
+
+		// The rules may detach the statement, so gather the statements
+		// whose neighborhood changes beforehand.
+		StmtVector neighborhood;
+		for (auto i = stmt->predecessor_begin(),
+				e = stmt->predecessor_end(); i != e; ++i) {
+			neighborhood.push_back(*i);
+		}
+		if (auto succ = stmt->getSuccessor()) {
+			neighborhood.push_back(succ);
+		}
+
+		if (applyRules(stmt)) {
+			for (auto &neighbor : neighborhood) {
+				enqueue(neighbor);
+			}
+		}
+	}
+}
+
+/**
+* @brief Records every visited statement for phase 2 of runOnFunction().
+*/
+void FusedPeepholeOptimizer::visitStmt(ShPtr<Statement> stmt,
+		bool visitSuccessors, bool visitNestedStmts) {
+	if (stmt) {
+		enqueue(stmt);
+	}
+	OrderedAllVisitor::visitStmt(stmt, visitSuccessors, visitNestedStmts);
+}
+
+/**
+* @brief Adds @a stmt to the worklist (unless it is already there).
+*/
+void FusedPeepholeOptimizer::enqueue(ShPtr<Statement> stmt) {
+	if (!hasItem(inWorkList, stmt)) {
+		workList.push_back(stmt);
+		inWorkList.insert(stmt);
+	}
+}
+
+/**
+* @brief Runs the rules on @a stmt and returns @c true if any of them has
+*        changed anything.
+*
+* After the first change, the remaining rules are skipped -- the statement
+* may no longer exist, and the neighborhood gets reexamined anyway.
+*/
+bool FusedPeepholeOptimizer::applyRules(ShPtr<Statement> stmt) {
+	for (const auto &rule : rules) {
+		if (rule(stmt)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -43,7 +43,7 @@ GlobalToLocalOptimizer::GlobalToLocalOptimizer(ShPtr<Module> module,
 		ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio):
 	Optimizer(module), cg(CGBuilder::getCG(module)), va(va), cio(cio),
 	vuv(), usefulGlobalVars(), uselessGlobalVars(),
-	funcUsedGlobalVarsMap() {
+	funcUsedGlobalVarsMap(), globalVarUsersMap() {
 		PRECONDITION_NON_NULL(module);
 		PRECONDITION_NON_NULL(va);
 		PRECONDITION_NON_NULL(cio);
@@ -133,11 +133,11 @@ void GlobalToLocalOptimizer::convertUselessGlobalVars() {
 	for (const auto &var : uselessGlobalVars) {
 		ShPtr<Expression> init(module->getInitForGlobalVar(var));
 
-		// For each function...
-		for (auto j = module->func_definition_begin(),
-				f = module->func_definition_end(); j != f; ++j) {
-			if (hasItem(funcUsedGlobalVarsMap[*j], var)) {
-				convertGlobalVarToLocalVarInFunc(var, *j, init);
+		// For each function which uses the variable...
+		auto usersIt = globalVarUsersMap.find(var);
+		if (usersIt != globalVarUsersMap.end()) {
+			for (const auto &func : usersIt->second) {
+				convertGlobalVarToLocalVarInFunc(var, func, init);
 			}
 		}
 
@@ -282,8 +282,9 @@ void GlobalToLocalOptimizer::computeGlobalVarsUsedInGlobalVarDef() {
 }
 
 /**
-* @brief Computes @c globalVarsUsedInGlobalVarDef and @c funcUsedGlobalVarsMap
-*        for each function (definitions and declarations).
+* @brief Computes @c globalVarsUsedInGlobalVarDef, @c funcUsedGlobalVarsMap,
+*        and @c globalVarUsersMap for each function (definitions and
+*        declarations).
 */
 void GlobalToLocalOptimizer::computeUsedGlobalVars() {
 	computeGlobalVarsUsedInGlobalVarDef();
@@ -298,6 +299,17 @@ void GlobalToLocalOptimizer::computeUsedGlobalVars() {
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
 		funcUsedGlobalVarsMap[*i] = computeUsedGlobalVarsForFunc(*i);
 	}
+
+	// Compute also the inverse mapping for function definitions. In this way,
+	// the checks in the sub-optimizations do not have to loop over all the
+	// functions per candidate variable.
+	globalVarUsersMap.clear();
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		for (const auto &var : funcUsedGlobalVarsMap[*i]) {
+			globalVarUsersMap[var].insert(*i);
+		}
+	}
 }
 
 /**
@@ -504,21 +516,6 @@ bool GlobalToLocalOptimizer::isStatementImplyingUsefulness(
 	return false;
 }
 
-/**
-* @brief Returns @c true if the given global variable is used in the given
-*        function, @c false otherwise.
-*
-* @par Preconditions
-*  - @a var and @a func are non-null
-*/
-bool GlobalToLocalOptimizer::isUsedInFunc(ShPtr<Variable> var,
-		ShPtr<Function> func) {
-	PRECONDITION_NON_NULL(var);
-	PRECONDITION_NON_NULL(func);
-
-	return hasItem(funcUsedGlobalVarsMap[func], var);
-}
-
 /**
 * @brief Returns @c true if the given global variable may be removed from the
 *        module as unused, @c false otherwise.
@@ -530,11 +527,9 @@ bool GlobalToLocalOptimizer::globalVarMayBeRemovedAsUnused(ShPtr<Variable> var)
 	PRECONDITION_NON_NULL(var);
 
 	// The variable cannot be used in any function.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		if (isUsedInFunc(var, *i)) {
-			return false;
-		}
+	auto usersIt = globalVarUsersMap.find(var);
+	if (usersIt != globalVarUsersMap.end() && !usersIt->second.empty()) {
+		return false;
 	}
 
 	//
@@ -569,12 +564,13 @@ bool GlobalToLocalOptimizer::globalVarMayBeConverted(ShPtr<Variable> var,
 	PRECONDITION_NON_NULL(var);
 	PRECONDITION_NON_NULL(func);
 
-	// The global variable has to be used only in this function. Check all
-	// functions whether var is used in them.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		if (*i != func && isUsedInFunc(var, *i)) {
-			return false;
+	// The global variable has to be used only in this function.
+	auto usersIt = globalVarUsersMap.find(var);
+	if (usersIt != globalVarUsersMap.end()) {
+		for (const auto &user : usersIt->second) {
+			if (user != func) {
+				return false;
+			}
 		}
 	}
 
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/ir/eq_op_expr.h"
 #include "retdec/llvmir2hll/ir/neq_op_expr.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr/bool_comparison_optimizer.h"
@@ -46,9 +48,14 @@ std::string BoolComparisonSubOptimizer::getId() const {
 	return BOOL_COMPARISON_OPTIMIZER_ID;
 }
 
-void BoolComparisonSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	optimizeNestedComparisons(expr);
+SubOptimizer::ExprTypeVector BoolComparisonSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(EqOpExpr),
+		typeid(NeqOpExpr),
+	};
+}
 
+void BoolComparisonSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 	auto secOpBool = cast<ConstBool>(expr->getSecondOperand());
 	if (!secOpBool) {
 		return;
@@ -80,8 +87,6 @@ void BoolComparisonSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 }
 
 void BoolComparisonSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	optimizeNestedComparisons(expr);
-
 	auto secOpBool = cast<ConstBool>(expr->getSecondOperand());
 	if (!secOpBool) {
 		return;
@@ -112,11 +117,6 @@ void BoolComparisonSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 	}
 }
 
-template<typename ExprType>
-void BoolComparisonSubOptimizer::optimizeNestedComparisons(ExprType expr) {
-	SubOptimizer::visit(expr);
-}
-
 void BoolComparisonSubOptimizer::replaceWithFirstOperand(ShPtr<BinaryOpExpr> expr) {
 	Expression::replaceExpression(expr, expr->getFirstOperand());
 }
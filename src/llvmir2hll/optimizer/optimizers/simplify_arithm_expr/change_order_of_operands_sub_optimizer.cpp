@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/mul_op_expr.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr/change_order_of_operands_sub_optimizer.h"
@@ -46,9 +48,13 @@ std::string ChangeOrderOfOperandsSubOptimizer::getId() const {
 	return CHANGE_ORDER_OF_OPERANDS_SUB_OPTIMIZER_ID;
 }
 
-void ChangeOrderOfOperandsSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector ChangeOrderOfOperandsSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(MulOpExpr),
+	};
+}
 
+void ChangeOrderOfOperandsSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
 	// Optimization like "a * 3(ConstInt/ConstFloat)" -> optimized to "3 * a".
 	// Need to ensure not to optimize 2 * 3 because this expression will be
 	// optimized repeatedly.
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/and_op_expr.h"
@@ -64,75 +66,71 @@ std::string ConstOperatorConstSubOptimizer::getId() const {
 	return CONST_OPERATOR_CONST_SUB_OPTIMIZER_ID;
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector ConstOperatorConstSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(AddOpExpr),
+		typeid(SubOpExpr),
+		typeid(MulOpExpr),
+		typeid(DivOpExpr),
+		typeid(BitAndOpExpr),
+		typeid(BitOrOpExpr),
+		typeid(BitXorOpExpr),
+		typeid(LtOpExpr),
+		typeid(LtEqOpExpr),
+		typeid(GtOpExpr),
+		typeid(GtEqOpExpr),
+		typeid(EqOpExpr),
+		typeid(NeqOpExpr),
+		typeid(AndOpExpr),
+		typeid(OrOpExpr),
+	};
+}
 
+void ConstOperatorConstSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// This is resolved in EqualOperandsSubOptimizer.
 	// This case has some special conditions which are resolved there.
 	if (expr->getFirstOperand()->isEqualTo(expr->getSecondOperand())) {
@@ -143,8 +141,6 @@ void ConstOperatorConstSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// This is resolved in EqualOperandsSubOptimizer.
 	// This case has some special conditions which are resolved there.
 	if (expr->getFirstOperand()->isEqualTo(expr->getSecondOperand())) {
@@ -155,14 +151,10 @@ void ConstOperatorConstSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<AndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<OrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeConstConstOperand(expr);
 }
 
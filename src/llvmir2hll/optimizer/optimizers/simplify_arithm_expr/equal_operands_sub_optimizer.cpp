@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/const_bool.h"
@@ -56,9 +58,17 @@ std::string EqualOperandsSubOptimizer::getId() const {
 	return EQUAL_OPERANDS_SUB_OPTIMIZER_ID;
 }
 
-void EqualOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector EqualOperandsSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(AddOpExpr),
+		typeid(SubOpExpr),
+		typeid(DivOpExpr),
+		typeid(EqOpExpr),
+		typeid(NeqOpExpr),
+	};
+}
 
+void EqualOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	// Optimization like "a + a" -> optimized to "2 * a".
 	if ((expr->getFirstOperand())->isEqualTo(expr->getSecondOperand())) {
 		ShPtr<MulOpExpr> mulOpExpr(MulOpExpr::create(
@@ -70,8 +80,6 @@ void EqualOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// Optimization like "a - a" -> optimized to "0".
 	if ((expr->getFirstOperand())->isEqualTo(expr->getSecondOperand())) {
 		// Due to create correct zero(ConstInt or ConstFloat).
@@ -85,8 +93,6 @@ void EqualOperandsSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// Optimization like "a / a" -> optimized to "1".
 	if ((expr->getFirstOperand())->isEqualTo(expr->getSecondOperand())) {
 		// Due to create correct zero(ConstInt or ConstFloat).
@@ -100,8 +106,6 @@ void EqualOperandsSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// We don't want to optimize func() == func() or 2.74 == 2.74.
 	if (!isaConstIntOrIntTypeVariable(expr->getFirstOperand())) {
 		return;
@@ -115,8 +119,6 @@ void EqualOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// We don't want to optimize func() != func() or 2.74 != 2.74.
 	if (!isaConstIntOrIntTypeVariable(expr->getFirstOperand())) {
 		return;
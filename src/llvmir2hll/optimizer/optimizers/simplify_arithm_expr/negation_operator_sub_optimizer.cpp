@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/not_op_expr.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr/negation_operator_sub_optimizer.h"
@@ -47,9 +49,13 @@ std::string NegationOperatorSubOptimizer::getId() const {
 	return NEGATION_OPERATOR_SUB_OPTIMIZER_ID;
 }
 
-void NegationOperatorSubOptimizer::visit(ShPtr<NotOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector NegationOperatorSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(NotOpExpr),
+	};
+}
 
+void NegationOperatorSubOptimizer::visit(ShPtr<NotOpExpr> expr) {
 	ShPtr<Expression> negatedExpr(ExpressionNegater::negate(expr->getOperand()));
 	// !(a + b) is not optimized to !(a + b) because this is uselessly. Not to
 	// optimize expression to the same one is implemented in optimizeExpr(...).
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/const_float.h"
@@ -49,9 +51,14 @@ std::string NegativeOperandSubOptimizer::getId() const {
 	return NEGATIVE_OPERAND_SUB_OPTIMIZER_ID;
 }
 
-void NegativeOperandSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector NegativeOperandSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(AddOpExpr),
+		typeid(SubOpExpr),
+	};
+}
 
+void NegativeOperandSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	// -------
 	// First negative operand optimization.
 	//
@@ -134,8 +141,6 @@ void NegativeOperandSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void NegativeOperandSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// -------
 	// Second negative operand optimization.
 	//
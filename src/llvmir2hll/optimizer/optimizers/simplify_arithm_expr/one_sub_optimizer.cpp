@@ -5,6 +5,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
 #include "retdec/llvmir2hll/ir/cast_expr.h"
@@ -52,9 +54,15 @@ std::string OneSubOptimizer::getId() const {
 	return ONE_SUB_OPTIMIZER_ID;
 }
 
-void OneSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector OneSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(MulOpExpr),
+		typeid(DivOpExpr),
+		typeid(BitXorOpExpr),
+	};
+}
 
+void OneSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
 	if (isOpOne(expr->getFirstOperand())) {
 		// Optimization like "1(ConstInt/ConstFloat) * a" -> optimized to "a".
 		optimizeExpr(expr, expr->getSecondOperand());
@@ -65,8 +73,6 @@ void OneSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
 }
 
 void OneSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isOpOne(expr->getSecondOperand())) {
 		// Optimization like "a / 1(ConstInt/ConstFloat)" -> optimized to "a".
 		optimizeExpr(expr, expr->getFirstOperand());
@@ -74,8 +80,6 @@ void OneSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
 }
 
 void OneSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isConstIntOne(expr->getFirstOperand())) {
 		// Optimization like "1 ^ (a == b)" -> optimized to "a != b" or
 		// optimization like 1 ^ someCasts(a == b) -> optimized to "a != b."
@@ -39,6 +39,10 @@ SubOptimizer::~SubOptimizer() {}
 *
 * @param[in] expr An expression to optimize.
 *
+* Only the root node of @a expr is optimized. Nested expressions are expected
+* to be visited by the caller (the traversal is driven by
+* SimplifyArithmExprOptimizer).
+*
 * @return @c true if something was optimized, otherwise @c false.
 */
 bool SubOptimizer::tryOptimize(ShPtr<Expression> expr) {
@@ -63,9 +67,10 @@ void SubOptimizer::optimizeExpr(ShPtr<Expression> oldExpr,
 }
 
 /**
-* @brief Start traversal in abstract syntax tree.
+* @brief Dispatch @a expr to the visit function for its root node and try to
+*        optimize it.
 *
-* @param[in] expr Expression from which the traversal is started.
+* @param[in] expr Expression to optimize.
 *
 * @return @c true if something was optimized, otherwise @c false.
 */
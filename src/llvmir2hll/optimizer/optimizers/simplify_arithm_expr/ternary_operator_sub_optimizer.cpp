@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/const_bool.h"
 #include "retdec/llvmir2hll/ir/ternary_op_expr.h"
@@ -47,9 +49,13 @@ std::string TernaryOperatorSubOptimizer::getId() const {
 	return TERNARY_OPERATOR_SUB_OPTIMIZER_ID;
 }
 
-void TernaryOperatorSubOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector TernaryOperatorSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(TernaryOpExpr),
+	};
+}
 
+void TernaryOperatorSubOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
 	ShPtr<ConstBool> constBool(cast<ConstBool>(expr->getCondition()));
 	if (!constBool) {
 		return;
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
@@ -75,9 +77,22 @@ std::string ThreeOperandsSubOptimizer::getId() const {
 	return OP_OPER_OP_OPER_OP_SUB_OPTIMIZER_ID;
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector ThreeOperandsSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(AddOpExpr),
+		typeid(SubOpExpr),
+		typeid(LtOpExpr),
+		typeid(LtEqOpExpr),
+		typeid(GtOpExpr),
+		typeid(GtEqOpExpr),
+		typeid(EqOpExpr),
+		typeid(NeqOpExpr),
+		typeid(BitXorOpExpr),
+		typeid(OrOpExpr),
+	};
+}
 
+void ThreeOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	// Optimizations dependent on the first Constant operand or on the second
 	// Constant operand.
 	ShPtr<Expression> firstConstant;
@@ -199,8 +214,6 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	// Optimizations dependent on the first Constant operand.
 	if (isConstFloatOrConstInt(expr->getFirstOperand())) {
 		// Optimization like ConstInt/ConstFloat -
@@ -380,8 +393,6 @@ bool ThreeOperandsSubOptimizer::analyzeOpOperOp(ShPtr<Expression> &constant,
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
 		optimizeExpr(expr, LtOpExpr::create(exprPair->first, exprPair->second));
@@ -389,8 +400,6 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
 		optimizeExpr(expr, LtEqOpExpr::create(exprPair->first, exprPair->second));
@@ -398,8 +407,6 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
 		optimizeExpr(expr, GtOpExpr::create(exprPair->first, exprPair->second));
@@ -407,8 +414,6 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
 		optimizeExpr(expr, GtEqOpExpr::create(exprPair->first, exprPair->second));
@@ -416,8 +421,6 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
 		optimizeExpr(expr, EqOpExpr::create(exprPair->first, exprPair->second));
@@ -425,8 +428,6 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
 		optimizeExpr(expr, NeqOpExpr::create(exprPair->first, exprPair->second));
@@ -434,14 +435,10 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeBitXorOpWithRelationalOperator(expr);
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<OrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	tryOptimizeOrOpExprWithRelOperators(expr);
 }
 
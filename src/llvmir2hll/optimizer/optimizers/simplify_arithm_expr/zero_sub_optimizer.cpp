@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
@@ -55,9 +57,20 @@ std::string ZeroSubOptimizer::getId() const {
 	return ZERO_SUB_OPTIMIZER_ID;
 }
 
-void ZeroSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+SubOptimizer::ExprTypeVector ZeroSubOptimizer::getHandledExprTypes() const {
+	return {
+		typeid(AddOpExpr),
+		typeid(SubOpExpr),
+		typeid(MulOpExpr),
+		typeid(DivOpExpr),
+		typeid(ModOpExpr),
+		typeid(BitAndOpExpr),
+		typeid(BitOrOpExpr),
+		typeid(BitXorOpExpr),
+	};
+}
 
+void ZeroSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) + a -> optimized to "a".
 		optimizeExpr(expr, expr->getSecondOperand());
@@ -68,8 +81,6 @@ void ZeroSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	ShPtr<ConstInt> secOpConstInt(cast<ConstInt>(expr->getSecondOperand()));
 	ShPtr<ConstFloat> secOpConstFloat(cast<ConstFloat>(expr->getSecondOperand()));
 	ShPtr<NegOpExpr> secOpNegOpExpr(cast<NegOpExpr>(expr->getSecondOperand()));
@@ -105,8 +116,6 @@ void ZeroSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) * a -> optimized to "0".
 		optimizeExpr(expr, expr->getFirstOperand());
@@ -117,8 +126,6 @@ void ZeroSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) / a -> optimized to "0".
 		optimizeExpr(expr, expr->getFirstOperand());
@@ -126,8 +133,6 @@ void ZeroSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<ModOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) % a -> optimized to "0".
 		optimizeExpr(expr, expr->getFirstOperand());
@@ -135,8 +140,6 @@ void ZeroSubOptimizer::visit(ShPtr<ModOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isConstIntZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) & a -> optimized to "0".
 		optimizeExpr(expr, expr->getFirstOperand());
@@ -147,8 +150,6 @@ void ZeroSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isConstIntZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) | a -> optimized to "a".
 		optimizeExpr(expr, expr->getSecondOperand());
@@ -160,8 +161,6 @@ void ZeroSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
-
 	if (isConstIntZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) ^ a -> optimized to "a".
 		optimizeExpr(expr, expr->getSecondOperand());
@@ -4,7 +4,10 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/and_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
@@ -85,75 +88,121 @@ void SimplifyArithmExprOptimizer::doOptimization() {
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<AddOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<SubOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<MulOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<DivOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<ModOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<LtOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<GtOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<EqOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<NeqOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<NotOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
+	tryOptimizeInSubOptimizations(expr);
+}
+
+void SimplifyArithmExprOptimizer::visit(ShPtr<AndOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<OrOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
+	OrderedAllVisitor::visit(expr);
+
 	tryOptimizeInSubOptimizations(expr);
 }
 
 /**
-* @brief Iterate through all sub-optimizers and try optimize @a expr.
+* @brief Iterate through all sub-optimizers that can simplify the root node of
+*        @a expr and try optimize it.
+*
+* The sub-optimizers are looked up in @c subOptimsTable by the type of @a
+* expr, so sub-optimizers that cannot simplify it are not called at all. The
+* operands of @a expr are not traversed; they are expected to have been
+* visited before (the traversal of expressions is bottom-up).
 *
 * If something was optimized in sub-optimizations, @c codeChanged is set to
 * @c true.
@@ -162,13 +211,19 @@ void SimplifyArithmExprOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
 */
 void SimplifyArithmExprOptimizer::tryOptimizeInSubOptimizations(
 		ShPtr<Expression> expr) {
-	for (const auto &subOptim : subOptims) {
+	auto subOptimsIter = subOptimsTable.find(std::type_index(typeid(*expr)));
+	if (subOptimsIter == subOptimsTable.end()) {
+		return;
+	}
+
+	for (const auto &subOptim : subOptimsIter->second) {
 		codeChanged |= subOptim->tryOptimize(expr);
 	}
 }
 
 /**
-* @brief Create all sub-optimizers and save it into @c subOptims.
+* @brief Create all sub-optimizers, save it into @c subOptims, and index them
+*        in @c subOptimsTable by the types of expressions they handle.
 *
 * @param[in] arithmExprEvaluator @a The used evaluator of arithmetical
 *            expressions.
@@ -178,12 +233,16 @@ void SimplifyArithmExprOptimizer::createSubOptimizers(ShPtr<ArithmExprEvaluator>
 	StringVector regObjects = SubOptimizerFactory::getInstance().
 		getRegisteredObjects();
 	for (const auto &regObject : regObjects) {
-		subOptims.push_back(
+		ShPtr<SubOptimizer> subOptim(
 			SubOptimizerFactory::getInstance().createObject(
 				regObject,
 				arithmExprEvaluator
 			)
 		);
+		subOptims.push_back(subOptim);
+		for (const auto &exprType : subOptim->getHandledExprTypes()) {
+			subOptimsTable[exprType].push_back(subOptim);
+		}
 	}
 }
 
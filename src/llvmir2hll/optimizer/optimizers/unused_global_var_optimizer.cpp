@@ -10,9 +10,6 @@
 #include "retdec/llvmir2hll/ir/variable.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/unused_global_var_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
-#include "retdec/utils/container.h"
-
-using retdec::utils::hasItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -36,58 +33,30 @@ UnusedGlobalVarOptimizer::UnusedGlobalVarOptimizer(ShPtr<Module> module):
 UnusedGlobalVarOptimizer::~UnusedGlobalVarOptimizer() {}
 
 void UnusedGlobalVarOptimizer::doOptimization() {
-	computeUsedGlobalVars();
+	// One walk over the module computes the usage of all global variables at
+	// once (initializers of global variables and function bodies).
+	globalVarsUsage = GlobalVarsUsage::compute(module);
 	removeUnusedGlobalVars();
 }
 
-void UnusedGlobalVarOptimizer::visit(ShPtr<Variable> var) {
-	if (isGlobal(var)) {
-		usedGlobalVars.insert(var);
-	}
-}
-
-/**
-* @brief Computes used global variables.
-*/
-void UnusedGlobalVarOptimizer::computeUsedGlobalVars() {
-	// Initializers of global variables.
-	for (auto i = module->global_var_begin(), e = module->global_var_end();
-			i != e; ++i) {
-		if (ShPtr<Expression> init = (*i)->getInitializer()) {
-			init->accept(this);
-		}
-	}
-
-	// Function bodies.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		(*i)->accept(this);
-	}
-}
-
 /**
 * @brief Removes unused global variables from the module.
 */
 void UnusedGlobalVarOptimizer::removeUnusedGlobalVars() {
+	VarSet unusedVars;
 	for (auto &var : globalVars) {
 		if (!isUsed(var)) {
-			module->removeGlobalVar(var);
+			unusedVars.insert(var);
 		}
 	}
-}
-
-/**
-* @brief Is the given variable global?
-*/
-bool UnusedGlobalVarOptimizer::isGlobal(ShPtr<Variable> var) const {
-	return hasItem(globalVars, var);
+	module->removeGlobalVars(unusedVars);
 }
 
 /**
 * @brief Is the given global variable used?
 */
 bool UnusedGlobalVarOptimizer::isUsed(ShPtr<Variable> var) const {
-	return hasItem(usedGlobalVars, var);
+	return globalVarsUsage->isUsed(var);
 }
 
 } // namespace llvmir2hll
@@ -4,6 +4,7 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/analysis/loop_info_analysis.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
@@ -38,13 +39,18 @@ namespace llvmir2hll {
 * @param[in] module Module to be optimized.
 * @param[in] va Analysis of values.
 * @param[in] arithmExprEvaluator Evaluator of expressions.
+* @param[in] loopInfo Analysis providing information about "while true" loops.
+*                     If it is the null pointer, the optimizer creates its own
+*                     analysis.
 *
 * @par Preconditions
 *  - @a module, @a va, and @a arithmExprEvaluator are non-null
 */
 WhileTrueToForLoopOptimizer::WhileTrueToForLoopOptimizer(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va, ShPtr<ArithmExprEvaluator> arithmExprEvaluator):
-	FuncOptimizer(module), va(va), arithmExprEvaluator(arithmExprEvaluator) {
+		ShPtr<ValueAnalysis> va, ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
+		ShPtr<LoopInfoAnalysis> loopInfo):
+	FuncOptimizer(module), va(va), arithmExprEvaluator(arithmExprEvaluator),
+	loopInfo(loopInfo ? loopInfo : LoopInfoAnalysis::create()) {
 		PRECONDITION_NON_NULL(module);
 		PRECONDITION_NON_NULL(va);
 		PRECONDITION_NON_NULL(arithmExprEvaluator);
@@ -96,7 +102,7 @@ void WhileTrueToForLoopOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
 	//     if cond:
 	//         break/return
 	//     i = i + 1
-	auto splittedLoop = splitWhileTrueLoop(stmt);
+	auto splittedLoop = loopInfo->getSplittedLoop(stmt);
 	if (!splittedLoop) {
 		// The loop cannot be optimized.
 		return;
@@ -106,7 +112,7 @@ void WhileTrueToForLoopOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
 	//   ...
 	//   i = 0
 	//   ...
-	auto indVarInfo = getIndVarInfo(stmt);
+	auto indVarInfo = loopInfo->getIndVarInfo(stmt);
 	if (!indVarInfo) {
 		// The loop cannot be optimized.
 		return;
@@ -175,6 +181,10 @@ void WhileTrueToForLoopOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
 		}
 	}
 
+	// The original loop does not exist anymore, so drop the information
+	// cached for it.
+	loopInfo->loopHasBeenChanged(stmt);
+
 	// TODO What if the exit condition is a return? We should place a return
 	//      after the loop.
 }
@@ -4,6 +4,7 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/analysis/loop_info_analysis.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/ir/empty_stmt.h"
 #include "retdec/llvmir2hll/ir/ufor_loop_stmt.h"
@@ -21,13 +22,18 @@ namespace llvmir2hll {
 *
 * @param[in] module Module to be optimized.
 * @param[in] va Analysis of values.
+* @param[in] loopInfo Analysis providing information about "while true" loops.
+*                     If it is the null pointer, the optimizer creates its own
+*                     analysis.
 *
 * @par Preconditions
 *  - @a module and @a va are non-null
 */
 WhileTrueToUForLoopOptimizer::WhileTrueToUForLoopOptimizer(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va):
-	FuncOptimizer(module), va(va), canBeOptimized(false) {
+		ShPtr<ValueAnalysis> va, ShPtr<LoopInfoAnalysis> loopInfo):
+	FuncOptimizer(module), va(va),
+	loopInfo(loopInfo ? loopInfo : LoopInfoAnalysis::create()),
+	canBeOptimized(false) {
 		PRECONDITION_NON_NULL(module);
 		PRECONDITION_NON_NULL(va);
 	}
@@ -73,6 +79,10 @@ void WhileTrueToUForLoopOptimizer::tryReplacementWithUForLoop(
 	}
 	performReplacement(forLoop);
 
+	// The original loop does not exist anymore, so drop the information
+	// cached for it.
+	loopInfo->loopHasBeenChanged(whileLoop);
+
 	// Put lastLoopStmt to the end of the new loop.
 	if (lastLoopStmt && lastLoopStmt->hasMetadata()) {
 		Statement::mergeStatements(forLoop->getBody(), lastLoopStmt);
@@ -103,7 +113,7 @@ bool WhileTrueToUForLoopOptimizer::gatherInfoAboutOptimizedWhileLoop() {
 	}
 
 	// We have to be enable to split the loop.
-	splittedLoop = splitWhileTrueLoop(whileLoop);
+	splittedLoop = loopInfo->getSplittedLoop(whileLoop);
 	if (!splittedLoop) {
 		return false;
 	}
@@ -4,6 +4,7 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/analysis/loop_info_analysis.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/break_stmt.h"
 #include "retdec/llvmir2hll/ir/const_bool.h"
@@ -27,12 +28,17 @@ namespace llvmir2hll {
 * @brief Constructs a new optimizer.
 *
 * @param[in] module Module to be optimized.
+* @param[in] loopInfo Analysis providing information about "while true" loops.
+*                     If it is the null pointer, the optimizer creates its own
+*                     analysis.
 *
 * @par Preconditions
 *  - @a module is non-null
 */
-WhileTrueToWhileCondOptimizer::WhileTrueToWhileCondOptimizer(ShPtr<Module> module):
-	FuncOptimizer(module) {
+WhileTrueToWhileCondOptimizer::WhileTrueToWhileCondOptimizer(ShPtr<Module> module,
+		ShPtr<LoopInfoAnalysis> loopInfo):
+	FuncOptimizer(module),
+	loopInfo(loopInfo ? loopInfo : LoopInfoAnalysis::create()) {
 		PRECONDITION_NON_NULL(module);
 	}
 
@@ -59,7 +65,7 @@ void WhileTrueToWhileCondOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
 	}
 
 	// Gather all information needed to transform the loop.
-	ShPtr<SplittedWhileTrueLoop> splittedLoop(splitWhileTrueLoop(stmt));
+	ShPtr<SplittedWhileTrueLoop> splittedLoop(loopInfo->getSplittedLoop(stmt));
 	if (!splittedLoop) {
 		// The loop cannot be optimized.
 		return;
@@ -197,6 +203,10 @@ void WhileTrueToWhileCondOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
 			splittedLoop->loopEnd->getFirstIfBody()))) {
 		stmt->appendStatement(retStmt);
 	}
+
+	// The loop is no longer a "while true" loop, so drop the information
+	// cached for it.
+	loopInfo->loopHasBeenChanged(stmt);
 }
 
 } // namespace llvmir2hll
@@ -36,5 +36,22 @@ PatternFinder::PatternFinder(ShPtr<ValueAnalysis> va,
 */
 PatternFinder::~PatternFinder() {}
 
+/**
+* @brief Finds patterns in the given module and returns them.
+*
+* @param[in] module The searched module.
+* @param[in] callsInModule A pre-computed list of all the function calls in
+*                          @a module.
+*
+* This overload allows the caller to obtain the calls in @a module just once
+* and let several finders share them. By default, @a callsInModule is ignored
+* and findPatterns(module) is called, so finders that do not search for
+* patterns rooted at function calls do not have to override this overload.
+*/
+PatternFinder::Patterns PatternFinder::findPatterns(ShPtr<Module> module,
+		const CallsInModuleObtainer::Calls &callsInModule) {
+	return findPatterns(module);
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
@@ -4,6 +4,7 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/obtainer/calls_in_module_obtainer.h"
 #include "retdec/llvmir2hll/pattern/pattern_finder_runner.h"
 #include "retdec/llvmir2hll/support/debug.h"
 
@@ -26,15 +27,25 @@ PatternFinderRunner::~PatternFinderRunner() {}
 * @param[in] pfs Pattern finders to be run.
 * @param[in] module The module that is passed to the finders in @a pfs.
 *
-* More specifically, it calls <tt>run(pf, module)</tt> on every pattern finder
-* @c pf in @a pfs.
+* The calls in @a module are obtained just once, and all the finders in @a pfs
+* share them (see PatternFinder::findPatterns()). Apart from that, for every
+* pattern finder @c pf in @a pfs, the same actions as in <tt>run(pf,
+* module)</tt> are done.
 *
 * @par Preconditions
 *  - @a module is non-null
 */
 void PatternFinderRunner::run(const PatternFinders &pfs, ShPtr<Module> module) {
+	PRECONDITION_NON_NULL(module);
+
+	// Obtain the calls in the module just once so that every finder does not
+	// have to perform its own walk over the module to get them.
+	CallsInModuleObtainer::Calls callsInModule(
+		CallsInModuleObtainer::getCalls(module));
 	for (const auto &pf : pfs) {
-		run(pf, module);
+		doActionsBeforePatternFinderRuns(pf);
+		PatternFinder::Patterns patterns(pf->findPatterns(module, callsInModule));
+		doActionsAfterPatternFinderHasRun(pf, patterns);
 	}
 }
 
@@ -207,8 +207,19 @@ const std::string APICallPatternFinder::getId() const {
 */
 PatternFinder::Patterns APICallPatternFinder::findPatterns(
 		ShPtr<Module> module) {
-	Calls allCalls(CallsInModuleObtainer::getCalls(module));
-	Calls apiCalls(getAPICalls(allCalls));
+	return findPatterns(module, CallsInModuleObtainer::getCalls(module));
+}
+
+/**
+* @brief Finds patterns in the given module by utilizing the pre-computed list
+*        of calls in it and returns them.
+*
+* See findPatterns(module) for more information.
+*/
+PatternFinder::Patterns APICallPatternFinder::findPatterns(
+		ShPtr<Module> module,
+		const CallsInModuleObtainer::Calls &callsInModule) {
+	Calls apiCalls(getAPICalls(callsInModule));
 	return makePatterns(apiCalls);
 }
 
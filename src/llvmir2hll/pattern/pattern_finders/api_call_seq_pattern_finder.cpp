@@ -1129,12 +1129,24 @@ const std::string APICallSeqPatternFinder::getId() const {
 */
 PatternFinder::Patterns APICallSeqPatternFinder::findPatterns(
 		ShPtr<Module> module) {
+	return findPatterns(module, CallsInModuleObtainer::getCalls(module));
+}
+
+/**
+* @brief Finds patterns in the given module by utilizing the pre-computed list
+*        of calls in it and returns them.
+*
+* See findPatterns(module) for more information.
+*/
+PatternFinder::Patterns APICallSeqPatternFinder::findPatterns(
+		ShPtr<Module> module,
+		const CallsInModuleObtainer::Calls &callsInModule) {
 	// TODO Add a possibility of setting APICallSeqFinder outside of this
 	//      function.
 	ShPtr<APICallSeqFinder> acf(new BasicBlockAPICallSeqFinder(va, cio));
 
 	// For every call in the module...
-	for (const auto &call : CallsInModuleObtainer::getCalls(module)) {
+	for (const auto &call : callsInModule) {
 		std::string calledFuncName(getNameOfCalledFunc(call.call, module));
 		if (calledFuncName.empty()) {
 			continue;
@@ -82,7 +82,8 @@ Maybe<ReturnType> getAnswer(const SemanticsListType &semanticsList,
 /**
 * @brief Constructs the semantics.
 */
-CompoundSemantics::CompoundSemantics(): providedSemantics() {}
+CompoundSemantics::CompoundSemantics(): providedSemantics(),
+	cHeaderFileForFuncCache() {}
 
 /**
 * @brief Creates a new semantics.
@@ -100,6 +101,10 @@ ShPtr<CompoundSemantics> CompoundSemantics::create() {
 */
 void CompoundSemantics::prependSemantics(ShPtr<Semantics> semantics) {
 	providedSemantics.push_front(semantics);
+
+	// The newly added semantics may provide different answers, so the cached
+	// ones can no longer be used.
+	cHeaderFileForFuncCache.clear();
 }
 
 /**
@@ -111,6 +116,10 @@ void CompoundSemantics::prependSemantics(ShPtr<Semantics> semantics) {
 */
 void CompoundSemantics::appendSemantics(ShPtr<Semantics> semantics) {
 	providedSemantics.push_back(semantics);
+
+	// The newly added semantics may provide different answers, so the cached
+	// ones can no longer be used.
+	cHeaderFileForFuncCache.clear();
 }
 
 Maybe<std::string> CompoundSemantics::getMainFuncName() const {
@@ -120,8 +129,18 @@ Maybe<std::string> CompoundSemantics::getMainFuncName() const {
 
 Maybe<std::string> CompoundSemantics::getCHeaderFileForFunc(
 		const std::string &funcName) const {
-	return getAnswer<std::string>(providedSemantics,
+	// Caching. This query is issued repeatedly for the same function names
+	// (see, e.g., HeadersForDeclaredFuncs), so resolve every name through the
+	// provided semantics just once.
+	auto cachedAnswerIt = cHeaderFileForFuncCache.find(funcName);
+	if (cachedAnswerIt != cHeaderFileForFuncCache.end()) {
+		return cachedAnswerIt->second;
+	}
+
+	auto answer = getAnswer<std::string>(providedSemantics,
 		&Semantics::getCHeaderFileForFunc, funcName);
+	cHeaderFileForFuncCache.emplace(funcName, answer);
+	return answer;
 }
 
 Maybe<bool> CompoundSemantics::funcNeverReturns(
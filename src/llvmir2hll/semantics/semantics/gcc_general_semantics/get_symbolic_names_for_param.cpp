@@ -2617,9 +2617,6 @@ const FuncParamsMap &initFuncParamsMap() {
 	return funcParamsMap;
 }
 
-/// Mapping of function names into symbolic names of their parameters.
-const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
-
 } // anonymous namespace
 
 /**
@@ -2629,7 +2626,10 @@ const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
 */
 Maybe<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getSymbolicNamesForParamFromMap(funcName, paramPos, FUNC_PARAMS_MAP);
+	// The map is built lazily upon the first call -- building it is expensive
+	// and processes which never ask for symbolic names should not pay for it.
+	static const FuncParamsMap &funcParamsMap(initFuncParamsMap());
+	return getSymbolicNamesForParamFromMap(funcName, paramPos, funcParamsMap);
 }
 
 } // namespace gcc_general
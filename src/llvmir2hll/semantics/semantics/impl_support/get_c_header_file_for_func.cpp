@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_c_header_file_for_func.h"
 
 namespace retdec {
@@ -19,6 +22,20 @@ Maybe<std::string> getCHeaderFileForFuncFromMap(const std::string &funcName,
 	return i != map.end() ? Just(i->second) : Nothing<std::string>();
 }
 
+/**
+* @brief Returns the header name for the given function from the sorted table
+*        delimited by @a begin and @a end.
+*/
+Maybe<std::string> getCHeaderFileForFuncFromTable(const std::string &funcName,
+		const FuncCHeaderTableEntry *begin, const FuncCHeaderTableEntry *end) {
+	auto i = std::lower_bound(begin, end, funcName,
+		[](const FuncCHeaderTableEntry &e, const std::string &name) {
+			return std::strcmp(e.funcName, name.c_str()) < 0;
+		});
+	return i != end && i->funcName == funcName ?
+		Just(std::string(i->header)) : Nothing<std::string>();
+}
+
 } // namespace semantics
 } // namespace llvmir2hll
 } // namespace retdec
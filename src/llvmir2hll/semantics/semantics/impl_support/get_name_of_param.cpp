@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 
 namespace retdec {
@@ -20,6 +23,22 @@ Maybe<std::string> getNameOfParamFromMap(const std::string &funcName,
 		Just(funcParamIter->second) : Nothing<std::string>();
 }
 
+/**
+* @brief Returns the name of the given parameter from the sorted table
+*        delimited by @a begin and @a end.
+*/
+Maybe<std::string> getNameOfParamFromTable(const std::string &funcName,
+		unsigned paramPos, const FuncParamNameTableEntry *begin,
+		const FuncParamNameTableEntry *end) {
+	auto i = std::lower_bound(begin, end, funcName,
+		[paramPos](const FuncParamNameTableEntry &e, const std::string &name) {
+			int c = std::strcmp(e.funcName, name.c_str());
+			return c != 0 ? c < 0 : e.paramPos < paramPos;
+		});
+	return i != end && i->funcName == funcName && i->paramPos == paramPos ?
+		Just(std::string(i->paramName)) : Nothing<std::string>();
+}
+
 } // namespace semantics
 } // namespace llvmir2hll
 } // namespace retdec
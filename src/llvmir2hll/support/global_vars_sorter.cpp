@@ -5,18 +5,12 @@
 */
 
 #include <algorithm>
-#include <map>
 
-#include "retdec/llvmir2hll/ir/expression.h"
 #include "retdec/llvmir2hll/ir/global_var_def.h"
 #include "retdec/llvmir2hll/ir/variable.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/llvmir2hll/support/global_vars_sorter.h"
-#include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
-#include "retdec/utils/container.h"
-#include "retdec/utils/non_copyable.h"
-
-using retdec::utils::hasItem;
+#include "retdec/llvmir2hll/support/global_vars_usage.h"
 
 namespace retdec {
 namespace llvmir2hll {
@@ -24,135 +18,84 @@ namespace llvmir2hll {
 namespace {
 
 /**
-* @brief Sorter of global variables according to their interdependencies.
+* @brief Key to be used to sort sequences of ShPtr<GlobalVarDef>.
+*
+* All interdependency queries are answered from a precomputed
+* GlobalVarsUsage, so no traversal is done during the sorting itself.
 */
-class InterdependencySorter: private OrderedAllVisitor,
-		private retdec::utils::NonCopyable {
-	friend class LessThanKey;
+struct LessThanKey {
+	explicit LessThanKey(ShPtr<GlobalVarsUsage> usage): usage(usage) {}
 
-private:
 	/**
-	* @brief Key to be used to sort sequences of ShPtr<GlobalVarDefVector>.
+	* @brief Returns @c true iff <tt>p1 < p2</tt>.
 	*/
-	struct LessThanKey {
-		explicit LessThanKey(ShPtr<InterdependencySorter> sorter): sorter(sorter) {}
-
-		/**
-		* @brief Returns @c true iff <tt>p1 < p2</tt>.
-		*/
-		bool operator() (const ShPtr<GlobalVarDef> &p1,
-				const ShPtr<GlobalVarDef> &p2) {
-			// p1: int a;
-			// p2: int b = /* a appears here */;
-			//
-			// p1 < p2
-			if (hasItem(sorter->varToUsedVarsMap[p2->getVar()], p1->getVar())) {
-				return true;
-			}
-
-			// p1: int b = /* a appears here */;
-			// p2: int a;
-			//
-			// !(p1 < p2)
-			if (hasItem(sorter->varToUsedVarsMap[p1->getVar()], p2->getVar())) {
-				return false;
-			}
-
-			// p1: int a;
-			// p2: int b = /* some variables other than a */;
-			//
-			// p1 < p2
-			if (sorter->varToUsedVarsMap[p1->getVar()].empty() &&
-				!sorter->varToUsedVarsMap[p2->getVar()].empty() &&
-					!hasItem(sorter->varToUsedVarsMap[p2->getVar()], p1->getVar())) {
-				return true;
-			}
-
-			// p1: int b = /* some variables other than a */;
-			// p2: int a;
-			//
-			// !(p1 < p2)
-			if (sorter->varToUsedVarsMap[p2->getVar()].empty() &&
-				!sorter->varToUsedVarsMap[p1->getVar()].empty() &&
-					!hasItem(sorter->varToUsedVarsMap[p1->getVar()], p2->getVar())) {
-				return false;
-			}
-
-			// p1: int a;
-			// p2: int b;
-			//
-			// The '<' relation is decided by using the original names of the
-			// variables. We use the original names instead of the current
-			// names to make the variables and their comments (address,
-			// original name) appear in a sorted order. That is, instead of
-			//
-			//   int32_t abaca = 0; // gpr2
-			//   int32_t * apple; // 0x804cf40
-			//   int32_t apricot = 0; // gpr0
-			//
-			// we want
-			//
-			//   int32_t * apple; // 0x804cf40
-			//   int32_t apricot = 0; // gpr0
-			//   int32_t abaca = 0; // gpr2
-			//
-			// We use the fact that frontend generates global variables grouped
-			// by their type. For example, global variables corresponding to
-			// registers are emitted in one group, other variables into other
-			// groups.
-			//
-			// The reason why we need to sort the variables by using the
-			// initial names is that variables are renamed before HLL emission,
-			// and during such renaming, the original groups may be lost. This
-			// would result into a mixed order, as shown above.
-			return p1->getVar()->getInitialName() < p2->getVar()->getInitialName();
+	bool operator() (const ShPtr<GlobalVarDef> &p1,
+			const ShPtr<GlobalVarDef> &p2) {
+		// p1: int a;
+		// p2: int b = /* a appears here */;
+		//
+		// p1 < p2
+		if (usage->initializerOfUses(p2->getVar(), p1->getVar())) {
+			return true;
 		}
 
-		ShPtr<InterdependencySorter> sorter;
-	};
-
-public:
-	/**
-	* @brief Implementation of GlobalVarsSorter::sortByInterdependencies().
-	*/
-	static GlobalVarDefVector sort(const GlobalVarDefVector &globalVars) {
-		ShPtr<InterdependencySorter> sorter(new InterdependencySorter(globalVars));
+		// p1: int b = /* a appears here */;
+		// p2: int a;
+		//
+		// !(p1 < p2)
+		if (usage->initializerOfUses(p1->getVar(), p2->getVar())) {
+			return false;
+		}
 
-		GlobalVarDefVector sorted(globalVars);
-		std::sort(sorted.begin(), sorted.end(), LessThanKey(sorter));
-		return sorted;
-	}
+		// p1: int a;
+		// p2: int b = /* some variables other than a */;
+		//
+		// p1 < p2
+		if (!usage->initializerOfUsesAnyGlobal(p1->getVar()) &&
+				usage->initializerOfUsesAnyGlobal(p2->getVar())) {
+			return true;
+		}
 
-	// It needs to be public so it can be called in ShPtr's destructor.
-	virtual ~InterdependencySorter() override {}
-
-private:
-	explicit InterdependencySorter(const GlobalVarDefVector &globalVars) {
-		// Compute used variables in the initializers of all global variables.
-		for (const auto &varInitPair : globalVars) {
-			usedVarsInLastInit.clear();
-			if (ShPtr<Expression> init = varInitPair->getInitializer()) {
-				init->accept(this);
-			}
-			varToUsedVarsMap[varInitPair->getVar()] = usedVarsInLastInit;
+		// p1: int b = /* some variables other than a */;
+		// p2: int a;
+		//
+		// !(p1 < p2)
+		if (!usage->initializerOfUsesAnyGlobal(p2->getVar()) &&
+				usage->initializerOfUsesAnyGlobal(p1->getVar())) {
+			return false;
 		}
-	}
 
-	/// @name Visitor Interface
-	/// @{
-	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<Variable> var) override {
-		usedVarsInLastInit.insert(var);
+		// p1: int a;
+		// p2: int b;
+		//
+		// The '<' relation is decided by using the original names of the
+		// variables. We use the original names instead of the current
+		// names to make the variables and their comments (address,
+		// original name) appear in a sorted order. That is, instead of
+		//
+		//   int32_t abaca = 0; // gpr2
+		//   int32_t * apple; // 0x804cf40
+		//   int32_t apricot = 0; // gpr0
+		//
+		// we want
+		//
+		//   int32_t * apple; // 0x804cf40
+		//   int32_t apricot = 0; // gpr0
+		//   int32_t abaca = 0; // gpr2
+		//
+		// We use the fact that frontend generates global variables grouped
+		// by their type. For example, global variables corresponding to
+		// registers are emitted in one group, other variables into other
+		// groups.
+		//
+		// The reason why we need to sort the variables by using the
+		// initial names is that variables are renamed before HLL emission,
+		// and during such renaming, the original groups may be lost. This
+		// would result into a mixed order, as shown above.
+		return p1->getVar()->getInitialName() < p2->getVar()->getInitialName();
 	}
-	/// @}
-
-private:
-	/// Used variables in the last initializer.
-	VarSet usedVarsInLastInit;
 
-	/// Mapping of a variable into the set of variables used in in its
-	/// initializer.
-	std::map<ShPtr<Variable>, VarSet> varToUsedVarsMap;
+	ShPtr<GlobalVarsUsage> usage;
 };
 
 } // anonymous namespace
@@ -176,7 +119,29 @@ private:
 */
 GlobalVarDefVector GlobalVarsSorter::sortByInterdependencies(
 		const GlobalVarDefVector &globalVars) {
-	return InterdependencySorter::sort(globalVars);
+	return sortByInterdependencies(globalVars,
+		GlobalVarsUsage::computeFromInitializers(globalVars));
+}
+
+/**
+* @brief Sorts the given vector of global variables by their
+*        interdependencies, reusing the given precomputed usage.
+*
+* This overload allows callers that have already computed the usage of global
+* variables (e.g. for other purposes) to share it with the sorting instead of
+* walking the initializers again.
+*
+* @par Preconditions
+*  - @a usage is non-null and was computed over (a superset of) @a globalVars
+*/
+GlobalVarDefVector GlobalVarsSorter::sortByInterdependencies(
+		const GlobalVarDefVector &globalVars,
+		ShPtr<GlobalVarsUsage> usage) {
+	PRECONDITION_NON_NULL(usage);
+
+	GlobalVarDefVector sorted(globalVars);
+	std::sort(sorted.begin(), sorted.end(), LessThanKey(usage));
+	return sorted;
 }
 
 } // namespace llvmir2hll
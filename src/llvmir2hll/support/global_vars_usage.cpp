@@ -0,0 +1,182 @@
+/**
+* @file src/llvmir2hll/support/global_vars_usage.cpp
+* @brief Implementation of GlobalVarsUsage.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
+#include "retdec/llvmir2hll/ir/expression.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/global_var_def.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/global_vars_usage.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs an empty usage.
+*/
+GlobalVarsUsage::GlobalVarsUsage() {}
+
+/**
+* @brief Computes the usage of global variables in the whole module.
+*
+* One walk visits the initializers of all global variables and the bodies of
+* all function definitions. Every subsequent query is answered from the
+* computed bitmaps.
+*
+* @par Preconditions
+*  - @a module is non-null
+*/
+ShPtr<GlobalVarsUsage> GlobalVarsUsage::compute(ShPtr<Module> module) {
+	PRECONDITION_NON_NULL(module);
+
+	GlobalVarDefVector globalVars(module->global_var_begin(),
+		module->global_var_end());
+	ShPtr<GlobalVarsUsage> usage(computeFromInitializers(globalVars));
+
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		auto bitmap = usage->bitmapFromVars(
+			UsedVarsVisitor::getUsedVars(*i)->getAllVars());
+		usage->mergeIntoUsedAnywhere(bitmap);
+		usage->funcUses.emplace(*i, std::move(bitmap));
+	}
+
+	return usage;
+}
+
+/**
+* @brief Computes the usage of global variables in the initializers of the
+*        given global variables only.
+*
+* Function-related queries on the returned usage report no uses. This variant
+* is sufficient for sorting global variables by their interdependencies.
+*/
+ShPtr<GlobalVarsUsage> GlobalVarsUsage::computeFromInitializers(
+		const GlobalVarDefVector &globalVars) {
+	ShPtr<GlobalVarsUsage> usage(new GlobalVarsUsage());
+	usage->assignIndexes(globalVars);
+
+	for (const auto &varDef : globalVars) {
+		UsageBitmap bitmap(globalVars.size(), false);
+		if (ShPtr<Expression> init = varDef->getInitializer()) {
+			bitmap = usage->bitmapFromVars(
+				UsedVarsVisitor::getUsedVars(init)->getAllVars());
+		}
+		usage->mergeIntoUsedAnywhere(bitmap);
+		usage->initUses.push_back(std::move(bitmap));
+	}
+
+	return usage;
+}
+
+/**
+* @brief Is the given variable global?
+*/
+bool GlobalVarsUsage::isGlobal(ShPtr<Variable> var) const {
+	return varIndexMap.find(var) != varIndexMap.end();
+}
+
+/**
+* @brief Is the given global variable used anywhere in the module?
+*
+* For variables that are not global, this function returns @c false.
+*/
+bool GlobalVarsUsage::isUsed(ShPtr<Variable> var) const {
+	auto varIt = varIndexMap.find(var);
+	return varIt != varIndexMap.end() && usedAnywhere[varIt->second];
+}
+
+/**
+* @brief Is the given global variable used in the given function?
+*
+* For variables that are not global and for functions that were not walked
+* (declarations, functions outside of the module), this function returns @c
+* false.
+*/
+bool GlobalVarsUsage::isUsedInFunc(ShPtr<Variable> var,
+		ShPtr<Function> func) const {
+	auto varIt = varIndexMap.find(var);
+	if (varIt == varIndexMap.end()) {
+		return false;
+	}
+
+	auto funcIt = funcUses.find(func);
+	return funcIt != funcUses.end() && funcIt->second[varIt->second];
+}
+
+/**
+* @brief Does the initializer of @a var use the global variable @a usedVar?
+*/
+bool GlobalVarsUsage::initializerOfUses(ShPtr<Variable> var,
+		ShPtr<Variable> usedVar) const {
+	auto varIt = varIndexMap.find(var);
+	auto usedVarIt = varIndexMap.find(usedVar);
+	if (varIt == varIndexMap.end() || usedVarIt == varIndexMap.end()) {
+		return false;
+	}
+
+	return initUses[varIt->second][usedVarIt->second];
+}
+
+/**
+* @brief Does the initializer of @a var use any global variable?
+*/
+bool GlobalVarsUsage::initializerOfUsesAnyGlobal(ShPtr<Variable> var) const {
+	auto varIt = varIndexMap.find(var);
+	if (varIt == varIndexMap.end()) {
+		return false;
+	}
+
+	const UsageBitmap &bitmap(initUses[varIt->second]);
+	return std::find(bitmap.begin(), bitmap.end(), true) != bitmap.end();
+}
+
+/**
+* @brief Assigns an index to every global variable.
+*/
+void GlobalVarsUsage::assignIndexes(const GlobalVarDefVector &globalVars) {
+	for (const auto &varDef : globalVars) {
+		varIndexMap.emplace(varDef->getVar(), varIndexMap.size());
+	}
+	usedAnywhere.assign(varIndexMap.size(), false);
+}
+
+/**
+* @brief Converts the given set of variables into a bitmap over indices of
+*        global variables.
+*
+* Variables that are not global are ignored.
+*/
+GlobalVarsUsage::UsageBitmap GlobalVarsUsage::bitmapFromVars(
+		const VarSet &vars) const {
+	UsageBitmap bitmap(varIndexMap.size(), false);
+	for (const auto &var : vars) {
+		auto varIt = varIndexMap.find(var);
+		if (varIt != varIndexMap.end()) {
+			bitmap[varIt->second] = true;
+		}
+	}
+	return bitmap;
+}
+
+/**
+* @brief Merges the given bitmap into the bitmap of global variables used
+*        anywhere in the module.
+*/
+void GlobalVarsUsage::mergeIntoUsedAnywhere(const UsageBitmap &bitmap) {
+	for (std::size_t i = 0, e = bitmap.size(); i < e; ++i) {
+		if (bitmap[i]) {
+			usedAnywhere[i] = true;
+		}
+	}
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
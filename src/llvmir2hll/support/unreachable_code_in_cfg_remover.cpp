@@ -27,7 +27,12 @@ namespace llvmir2hll {
 * See removeCode() for the description of all parameters and preconditions.
 */
 UnreachableCodeInCFGRemover::UnreachableCodeInCFGRemover(ShPtr<Module> module):
-	module(module), cfg(), cfgBuilder(NonRecursiveCFGBuilder::create()) {}
+	module(module), cfg(), cfgBuilder(NonRecursiveCFGBuilder::create()) {
+	// Our override of visitStmt() performs work after the successors of the
+	// given statement have been visited, so the traversal of statement chains
+	// has to stay recursive.
+	flattenStmtChains = false;
+}
 
 /**
 * @brief Destructs the remover.
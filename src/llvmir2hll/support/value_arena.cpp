@@ -0,0 +1,110 @@
+/**
+* @file src/llvmir2hll/support/value_arena.cpp
+* @brief Implementation of ValueArena.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <mutex>
+#include <new>
+
+#include "retdec/llvmir2hll/support/value_arena.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs an empty arena.
+*
+* The first chunk is allocated lazily by the first allocation.
+*/
+ValueArena::ValueArena() {
+	freeLists.fill(nullptr);
+}
+
+/**
+* @brief Destructs the arena and releases all its chunks.
+*
+* All blocks served from the arena have to be deallocated before it is
+* destroyed.
+*/
+ValueArena::~ValueArena() {}
+
+/**
+* @brief Returns a block of at least @a size bytes.
+*
+* The block is aligned for any object type. Sizes above @c MAX_BLOCK_SIZE are
+* served by the global <tt>operator new</tt>.
+*/
+void *ValueArena::allocate(std::size_t size) {
+	// Round the size up to the granule. Zero-sized requests get a whole
+	// granule so every returned block is non-empty and bucketable.
+	size = size > 0 ? (size + GRANULE - 1) / GRANULE * GRANULE : GRANULE;
+	if (size > MAX_BLOCK_SIZE) {
+		return ::operator new(size);
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto bucket = getBucketIndex(size);
+	if (auto *block = freeLists[bucket]) {
+		freeLists[bucket] = block->next;
+		return block;
+	}
+
+	if (remainingInChunk < size) {
+		allocateNewChunk();
+	}
+	auto *block = nextFree;
+	nextFree += size;
+	remainingInChunk -= size;
+	return block;
+}
+
+/**
+* @brief Returns the block @a ptr of @a size bytes back to the arena.
+*
+* @a size has to be the size the block was allocated with.
+*/
+void ValueArena::deallocate(void *ptr, std::size_t size) noexcept {
+	if (!ptr) {
+		return;
+	}
+
+	size = size > 0 ? (size + GRANULE - 1) / GRANULE * GRANULE : GRANULE;
+	if (size > MAX_BLOCK_SIZE) {
+		::operator delete(ptr);
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto *block = static_cast<FreeBlock *>(ptr);
+	auto bucket = getBucketIndex(size);
+	block->next = freeLists[bucket];
+	freeLists[bucket] = block;
+}
+
+/**
+* @brief Returns the number of chunks the arena has allocated so far.
+*/
+std::size_t ValueArena::getNumOfAllocatedChunks() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return chunks.size();
+}
+
+/**
+* @brief Returns the free-list index for the given rounded @a size.
+*/
+std::size_t ValueArena::getBucketIndex(std::size_t size) const noexcept {
+	return size / GRANULE - 1;
+}
+
+/**
+* @brief Starts a new chunk to serve subsequent allocations from.
+*/
+void ValueArena::allocateNewChunk() {
+	chunks.emplace_back(new unsigned char[CHUNK_SIZE]);
+	nextFree = chunks.back().get();
+	remainingInChunk = CHUNK_SIZE;
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
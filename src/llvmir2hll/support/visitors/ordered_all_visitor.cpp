@@ -90,7 +90,8 @@ namespace llvmir2hll {
 */
 OrderedAllVisitor::OrderedAllVisitor(bool visitSuccessors, bool visitNestedStmts):
 	Visitor(), lastStmt(), accessedStmts(), visitSuccessors(visitSuccessors),
-	visitNestedStmts(visitNestedStmts) {}
+	visitNestedStmts(visitNestedStmts), flattenStmtChains(true),
+	traversingStmts(false), stmtToVisitNext(), stmtToSingleStep() {}
 
 /**
 * @brief Destructs the visitor.
@@ -123,9 +124,7 @@ void OrderedAllVisitor::visit(ShPtr<AssignStmt> stmt) {
 	lastStmt = stmt;
 	stmt->getLhs()->accept(this);
 	stmt->getRhs()->accept(this);
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<VarDefStmt> stmt) {
@@ -134,17 +133,13 @@ void OrderedAllVisitor::visit(ShPtr<VarDefStmt> stmt) {
 	if (ShPtr<Expression> init = stmt->getInitializer()) {
 		init->accept(this);
 	}
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<CallStmt> stmt) {
 	lastStmt = stmt;
 	stmt->getCall()->accept(this);
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<ReturnStmt> stmt) {
@@ -152,16 +147,12 @@ void OrderedAllVisitor::visit(ShPtr<ReturnStmt> stmt) {
 	if (ShPtr<Expression> retVal = stmt->getRetVal()) {
 		retVal->accept(this);
 	}
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<EmptyStmt> stmt) {
 	lastStmt = stmt;
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<IfStmt> stmt) {
@@ -177,9 +168,7 @@ void OrderedAllVisitor::visit(ShPtr<IfStmt> stmt) {
 	if (visitNestedStmts && stmt->hasElseClause()) {
 		visitStmt(stmt->getElseClause());
 	}
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<SwitchStmt> stmt) {
@@ -195,9 +184,7 @@ void OrderedAllVisitor::visit(ShPtr<SwitchStmt> stmt) {
 			visitStmt(i->second);
 		}
 	}
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<WhileLoopStmt> stmt) {
@@ -206,9 +193,7 @@ void OrderedAllVisitor::visit(ShPtr<WhileLoopStmt> stmt) {
 	if (visitNestedStmts) {
 		visitStmt(stmt->getBody());
 	}
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<ForLoopStmt> stmt) {
@@ -220,9 +205,7 @@ void OrderedAllVisitor::visit(ShPtr<ForLoopStmt> stmt) {
 	if (visitNestedStmts) {
 		visitStmt(stmt->getBody());
 	}
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<UForLoopStmt> stmt) {
@@ -239,38 +222,30 @@ void OrderedAllVisitor::visit(ShPtr<UForLoopStmt> stmt) {
 	if (visitNestedStmts) {
 		visitStmt(stmt->getBody());
 	}
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<BreakStmt> stmt) {
 	lastStmt = stmt;
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<ContinueStmt> stmt) {
 	lastStmt = stmt;
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 void OrderedAllVisitor::visit(ShPtr<GotoStmt> stmt) {
 	lastStmt = stmt;
 	if (visitSuccessors && stmt->hasSuccessor()) {
 		visitStmt(stmt->getTarget());
-		visitStmt(stmt->getSuccessor());
+		visitSuccessorOfStmt(stmt);
 	}
 }
 
 void OrderedAllVisitor::visit(ShPtr<UnreachableStmt> stmt) {
 	lastStmt = stmt;
-	if (visitSuccessors && stmt->hasSuccessor()) {
-		visitStmt(stmt->getSuccessor());
-	}
+	visitSuccessorOfStmt(stmt);
 }
 
 //
@@ -572,14 +547,84 @@ void OrderedAllVisitor::visit(ShPtr<UnknownType> type) {
 * If @a stmt has already been accessed, this function does nothing. If @a stmt
 * is the null pointer, it also does nothing. Before visiting @a stmt, this
 * function adds it to @c accessedStmts.
+*
+* Unless @c flattenStmtChains has been set to @c false, chains of successive
+* statements are traversed iteratively, not recursively: visiting a statement
+* does not recurse into its successor. Instead, the successor is scheduled
+* through visitSuccessorOfStmt() and visited in the next iteration of the loop
+* below. In this way, even very long chains of statements (think of decompiled
+* state machines) are traversed with a bounded call-stack depth. The function
+* is re-dispatched virtually for every statement in the chain, so overrides of
+* this function are invoked for every statement, just like when the traversal
+* was recursive.
 */
 void OrderedAllVisitor::visitStmt(ShPtr<Statement> stmt, bool visitSuccessors,
 		bool visitNestedStmts) {
-	if (stmt && !hasItem(accessedStmts, stmt)) {
-		this->visitSuccessors = visitSuccessors;
-		this->visitNestedStmts = visitNestedStmts;
-		accessedStmts.insert(stmt);
+	if (!stmt || hasItem(accessedStmts, stmt)) {
+		return;
+	}
+
+	this->visitSuccessors = visitSuccessors;
+	this->visitNestedStmts = visitNestedStmts;
+	accessedStmts.insert(stmt);
+
+	bool wasTraversingStmts = traversingStmts;
+	traversingStmts = true;
+
+	if (stmt == stmtToSingleStep) {
+		// We have been called from the loop below (possibly through an
+		// override of this function): visit just the single statement. Its
+		// scheduled successor, if any, ends up in stmtToVisitNext and is
+		// picked up by the loop.
+		stmtToSingleStep.reset();
 		stmt->accept(this);
+		traversingStmts = wasTraversingStmts;
+		return;
+	}
+
+	// A successor scheduled by an enclosing traversal (if any) may not be
+	// consumed by the loop below, so keep it aside until we are done.
+	ShPtr<Statement> prevStmtToVisitNext(stmtToVisitNext);
+	stmtToVisitNext.reset();
+
+	stmt->accept(this);
+
+	// Keep visiting scheduled successors until the chain ends.
+	while (stmtToVisitNext) {
+		ShPtr<Statement> next(stmtToVisitNext);
+		stmtToVisitNext.reset();
+		stmtToSingleStep = next;
+		visitStmt(next);
+	}
+	stmtToSingleStep.reset();
+
+	stmtToVisitNext = prevStmtToVisitNext;
+	traversingStmts = wasTraversingStmts;
+}
+
+/**
+* @brief Schedules the successor of @a stmt (if any) to be visited.
+*
+* If successors should not be visited or @a stmt has no successor, this
+* function does nothing. When chains of successive statements are flattened
+* and the visitor is currently inside visitStmt(), the successor is visited
+* after the current visit() returns, which keeps the traversal of the chain
+* iterative. Otherwise, the successor is visited right away.
+*
+* Call this function at the end of a visit() of a statement instead of calling
+* @code
+* visitStmt(stmt->getSuccessor())
+* @endcode
+*/
+void OrderedAllVisitor::visitSuccessorOfStmt(ShPtr<Statement> stmt) {
+	if (!visitSuccessors || !stmt->hasSuccessor()) {
+		return;
+	}
+
+	if (flattenStmtChains && traversingStmts) {
+		stmtToVisitNext = stmt->getSuccessor();
+	} else {
+		visitStmt(stmt->getSuccessor());
 	}
 }
 
@@ -593,6 +638,8 @@ void OrderedAllVisitor::visitStmt(ShPtr<Statement> stmt, bool visitSuccessors,
 void OrderedAllVisitor::restart(bool visitSuccessors, bool visitNestedStmts) {
 	accessedStmts.clear();
 	accessedTypes.clear();
+	stmtToVisitNext.reset();
+	stmtToSingleStep.reset();
 	this->visitSuccessors = visitSuccessors;
 	this->visitNestedStmts = visitNestedStmts;
 }
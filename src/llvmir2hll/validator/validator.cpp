@@ -47,11 +47,56 @@ bool Validator::validate(ShPtr<Module> module, bool printMessageOnError) {
 	this->printMessageOnError = printMessageOnError;
 	this->moduleIsCorrect = true;
 
+	// The validator may have been run before, so make sure that already
+	// visited statements are visited again.
+	restart();
+
 	runValidation();
 
 	return moduleIsCorrect;
 }
 
+/**
+* @brief Validates only the given functions of @a module.
+*
+* @param[in] module Module whose functions are to be validated.
+* @param[in] funcs Functions from @a module to be validated.
+* @param[in] printMessageOnError If @c true and a function is not valid, it
+*                                prints a warning message to standard error.
+*
+* @return @c true if the given functions are correct, @c false otherwise.
+*
+* This function is meant for incremental validation: when only some functions
+* have been changed since the last validation, it suffices to revalidate just
+* them instead of the whole module. The initializers of global variables are
+* always re-checked as there are usually just a few of them. Checks that a
+* concrete validator performs outside of global variables and functions (see
+* its runValidation()) may be skipped.
+*
+* @par Preconditions
+*  - @a module is non-null
+*/
+bool Validator::validateFuncs(ShPtr<Module> module, const FuncVector &funcs,
+		bool printMessageOnError) {
+	PRECONDITION_NON_NULL(module);
+
+	this->module = module;
+	this->printMessageOnError = printMessageOnError;
+	this->moduleIsCorrect = true;
+
+	// The validator may have been run before, so make sure that already
+	// visited statements are visited again.
+	restart();
+
+	traverseAllGlobalVariables();
+	for (const auto &validatedFunc : funcs) {
+		func = validatedFunc;
+		func->accept(this);
+	}
+
+	return moduleIsCorrect;
+}
+
 /**
 * @brief Traverses all global variables in the current module and calls @c
 *        accept() on every one of them.
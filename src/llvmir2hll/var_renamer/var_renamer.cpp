@@ -61,7 +61,8 @@ VarRenamer::~VarRenamer() {}
 */
 void VarRenamer::renameVars(ShPtr<Module> module) {
 	this->module = module;
-	globalVars = module->getGlobalVars();
+	VarSet moduleGlobalVars(module->getGlobalVars());
+	globalVars = VarUSet(moduleGlobalVars.begin(), moduleGlobalVars.end());
 	storeFuncsByName();
 	varNameGen->restart();
 	doVarsRenaming();
@@ -281,8 +282,15 @@ std::string VarRenamer::generateUniqueName(ShPtr<Variable> var,
 			newName += "_";
 		} while (nameExists(newName, func));
 	} else {
-		// The name does not end with a number -> append numbers.
-		unsigned varNum = 2;
+		// The name does not end with a number -> append numbers. For every
+		// name, remember the next number to be tried in the scope so repeated
+		// clashes of the same name do not re-probe the already taken numbers
+		// from the beginning (this makes the renaming of many equally named
+		// variables linear instead of quadratic).
+		unsigned &varNum = nameClashIndex[func][name];
+		if (varNum < 2) {
+			varNum = 2;
+		}
 		do {
 			newName = name + toString(varNum++);
 		} while (nameExists(newName, func));
@@ -479,6 +487,34 @@ void VarRenamer::renameFuncLocalVar(ShPtr<Variable> var, ShPtr<Function> func) {
 	assignName(var, varNameGen->getNextVarName(), func);
 }
 
+/**
+* @brief Makes the given name available again in the given function.
+*
+* Use this function instead of erasing the name from @c localVarsNames
+* directly; otherwise, @c nameClashIndex would get out of sync and the name
+* would not be reused.
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+void VarRenamer::unassignLocalVarName(ShPtr<Function> func,
+		const std::string &name) {
+	PRECONDITION_NON_NULL(func);
+
+	localVarsNames[func].erase(name);
+
+	// The name may become the result of resolving a clash of a shorter name
+	// (e.g. "i2" may now be generated for "i" again), so reset the clash index
+	// for such a name.
+	std::string baseName(name);
+	while (!baseName.empty() && std::isdigit(baseName.back())) {
+		baseName.pop_back();
+	}
+	if (!baseName.empty()) {
+		nameClashIndex[func].erase(baseName);
+	}
+}
+
 void VarRenamer::visit(ShPtr<Variable> var) {
 	// Do not rename already renamed variables.
 	if (hasBeenRenamed(var)) {
@@ -427,7 +427,7 @@ void ReadableVarRenamer::visit(ShPtr<ForLoopStmt> stmt) {
 		// Since the induction variable is local to the loop, we may reuse it
 		// after the loop. We add it back to localVarsNames later by using
 		// indVarsNamesInCurrFunc.
-		localVarsNames[currFunc].erase(indVar->getName());
+		unassignLocalVarName(currFunc, indVar->getName());
 
 		visitSubsequentStmts(stmt);
 	} else {
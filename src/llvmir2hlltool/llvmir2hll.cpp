@@ -8,7 +8,9 @@
 
 #include <algorithm>
 #include <fstream>
+#include <iostream>
 #include <memory>
+#include <vector>
 
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/LoopInfo.h>
@@ -86,6 +88,8 @@
 #include "retdec/llvm-support/diagnostics.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/instrumentation.h"
+#include "retdec/utils/job_server.h"
 #include "retdec/utils/memory.h"
 #include "retdec/utils/string.h"
 
@@ -128,6 +132,16 @@ cl::opt<bool> EmitDebugComments("emit-debug-comments",
 	cl::desc("Emits debugging comments in the generated code."),
 	cl::init(false));
 
+cl::opt<bool> EmitFunctionsInChunks("emit-funcs-in-chunks",
+	cl::desc("Writes every emitted function to the output as soon as it is"
+		" finished instead of after the emission of the whole module."),
+	cl::init(false));
+
+cl::opt<bool> EmitFunctionsInParallel("emit-funcs-in-parallel",
+	cl::desc("Emits function bodies in parallel. The emitted code is"
+		" identical to the sequentially emitted one."),
+	cl::init(false));
+
 cl::opt<std::string> EnabledOpts("enabled-opts",
 	cl::desc("A comma separated list of optimizations to be enabled, i.e. only they will run."),
 	cl::init(""));
@@ -257,6 +271,19 @@ MaxMemoryLimitHalfRAM("max-memory-half-ram",
 	cl::desc("Limit maximal memory to half of system RAM."),
 	cl::init(false));
 
+static cl::opt<bool>
+MemoryReport("memory-report",
+	cl::desc("Print peak and per-phase memory usage to stderr when the tool finishes."),
+	cl::init(false));
+
+// Recognized by a manual pre-scan in main(), not by the LLVM command-line
+// parser -- in daemon mode, the parser runs in the workers, once per job.
+// Declared here only so it shows up in -help.
+static cl::opt<std::string>
+Daemon("daemon",
+	cl::desc("Run as a daemon accepting jobs on the given unix socket (POSIX only)."),
+	cl::value_desc("socket"));
+
 cl::opt<std::string> InputFilename(cl::Positional,
 	cl::desc("<input bitcode>"),
 	cl::init("-"));
@@ -434,27 +461,27 @@ Decompiler::Decompiler(raw_pwrite_stream &out):
 	varNameGen(), varRenamer(), llvm2BIRConverter() {}
 
 bool Decompiler::runOnModule(Module &m) {
-	if (Debug) retdec::llvm_support::printPhase("initialization");
+	retdec::llvm_support::reportPhase(Debug, "initialization");
 
 	bool decompilationShouldContinue = initialize(m);
 	if (!decompilationShouldContinue) {
 		return false;
 	}
 
-	if (Debug) retdec::llvm_support::printPhase("conversion of LLVM IR into BIR");
+	retdec::llvm_support::reportPhase(Debug, "conversion of LLVM IR into BIR");
 	convertLLVMIRToBIR();
 
 	retdec::llvmir2hll::StringSet funcPrefixes(getPrefixesOfFuncsToBeRemoved());
-	if (Debug) retdec::llvm_support::printPhase("removing functions prefixed with [" + joinStrings(funcPrefixes) + "]");
+	retdec::llvm_support::reportPhase(Debug, "removing functions prefixed with [" + joinStrings(funcPrefixes) + "]");
 	removeFuncsPrefixedWith(funcPrefixes);
 
 	if (!KeepLibraryFunctions) {
-		if (Debug) retdec::llvm_support::printPhase("removing functions from standard libraries");
+		retdec::llvm_support::reportPhase(Debug, "removing functions from standard libraries");
 		removeLibraryFuncs();
 	}
 
 	if (unreachableFuncsShouldBeRemoved()) {
-		if (Debug) retdec::llvm_support::printPhase("removing functions that are not reachable from main");
+		retdec::llvm_support::reportPhase(Debug, "removing functions that are not reachable from main");
 		removeUnreachableFuncs();
 	}
 
@@ -463,65 +490,65 @@ bool Decompiler::runOnModule(Module &m) {
 	// the conversion of LLVM IR to BIR is not perfect, so it may introduce
 	// unreachable code. This causes problems later during optimizations
 	// because the code exists in BIR, but not in a CFG.
-	if (Debug) retdec::llvm_support::printPhase("removing code that is not reachable in a CFG");
+	retdec::llvm_support::reportPhase(Debug, "removing code that is not reachable in a CFG");
 	removeCodeUnreachableInCFG();
 
-	if (Debug) retdec::llvm_support::printPhase("signed/unsigned types fixing");
+	retdec::llvm_support::reportPhase(Debug, "signed/unsigned types fixing");
 	fixSignedUnsignedTypes();
 
-	if (Debug) retdec::llvm_support::printPhase("converting LLVM intrinsic functions to standard functions");
+	retdec::llvm_support::reportPhase(Debug, "converting LLVM intrinsic functions to standard functions");
 	convertLLVMIntrinsicFunctions();
 
 	if (resModule->isDebugInfoAvailable()) {
-		if (Debug) retdec::llvm_support::printPhase("obtaining debug information");
+		retdec::llvm_support::reportPhase(Debug, "obtaining debug information");
 		obtainDebugInfo();
 	}
 
 	if (!NoOpts) {
-		if (Debug) retdec::llvm_support::printPhase("alias analysis [" + aliasAnalysis->getId() + "]");
+		retdec::llvm_support::reportPhase(Debug, "alias analysis [" + aliasAnalysis->getId() + "]");
 		initAliasAnalysis();
 
-		if (Debug) retdec::llvm_support::printPhase("optimizations [" + getTypeOfRunOptimizations() + "]");
+		retdec::llvm_support::reportPhase(Debug, "optimizations [" + getTypeOfRunOptimizations() + "]");
 		runOptimizations();
 	}
 
 	if (!NoVarRenaming) {
-		if (Debug) retdec::llvm_support::printPhase("variable renaming [" + varRenamer->getId() + "]");
+		retdec::llvm_support::reportPhase(Debug, "variable renaming [" + varRenamer->getId() + "]");
 		renameVariables();
 	}
 
 	if (!NoSymbolicNames) {
-		if (Debug) retdec::llvm_support::printPhase("converting constants to symbolic names");
+		retdec::llvm_support::reportPhase(Debug, "converting constants to symbolic names");
 		convertConstantsToSymbolicNames();
 	}
 
 	if (ValidateModule) {
-		if (Debug) retdec::llvm_support::printPhase("module validation");
+		retdec::llvm_support::reportPhase(Debug, "module validation");
 		validateResultingModule();
 	}
 
 	if (!FindPatterns.empty()) {
-		if (Debug) retdec::llvm_support::printPhase("finding patterns");
+		retdec::llvm_support::reportPhase(Debug, "finding patterns");
 		findPatterns();
 	}
 
 	if (EmitCFGs) {
-		if (Debug) retdec::llvm_support::printPhase("emission of control-flow graphs");
+		retdec::llvm_support::reportPhase(Debug, "emission of control-flow graphs");
 		emitCFGs();
 	}
 
 	if (EmitCG) {
-		if (Debug) retdec::llvm_support::printPhase("emission of a call graph");
+		retdec::llvm_support::reportPhase(Debug, "emission of a call graph");
 		emitCG();
 	}
 
-	if (Debug) retdec::llvm_support::printPhase("emission of the target code [" + hllWriter->getId() + "]");
+	retdec::llvm_support::reportPhase(Debug, "emission of the target code [" + hllWriter->getId() + "]");
 	emitTargetHLLCode();
 
-	if (Debug) retdec::llvm_support::printPhase("finalization");
+	retdec::llvm_support::reportPhase(Debug, "finalization");
 	finalize();
 
-	if (Debug) retdec::llvm_support::printPhase("cleanup");
+	retdec::llvm_support::reportPhase(Debug, "cleanup");
 	cleanup();
 
 	return false;
@@ -545,7 +572,7 @@ bool Decompiler::initialize(Module &m) {
 	// Instantiate the requested HLL writer and make sure it exists. We need to
 	// explicitly specify template parameters because raw_pwrite_stream has
 	// a private copy constructor, so it needs to be passed by reference.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used HLL writer [" + TargetHLL + "]");
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used HLL writer [" + TargetHLL + "]");
 	hllWriter = retdec::llvmir2hll::HLLWriterFactory::getInstance().createObject<
 		raw_pwrite_stream &>(TargetHLL, out);
 	if (!hllWriter) {
@@ -555,7 +582,7 @@ bool Decompiler::initialize(Module &m) {
 	}
 
 	// Instantiate the requested alias analysis and make sure it exists.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used alias analysis [" + AliasAnalysis + "]");
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used alias analysis [" + AliasAnalysis + "]");
 	aliasAnalysis = retdec::llvmir2hll::AliasAnalysisFactory::getInstance().createObject(
 		AliasAnalysis);
 	if (!aliasAnalysis) {
@@ -566,7 +593,7 @@ bool Decompiler::initialize(Module &m) {
 
 	// Instantiate the requested obtainer of information about function
 	// calls and make sure it exists.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used call info obtainer [" + CallInfoObtainer + "]");
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used call info obtainer [" + CallInfoObtainer + "]");
 	cio = retdec::llvmir2hll::CallInfoObtainerFactory::getInstance().createObject(
 		CallInfoObtainer);
 	if (!cio) {
@@ -577,7 +604,7 @@ bool Decompiler::initialize(Module &m) {
 
 	// Instantiate the requested evaluator of arithmetical expressions and make
 	// sure it exists.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used evaluator of arithmetical expressions [" +
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used evaluator of arithmetical expressions [" +
 		ArithmExprEvaluator + "]");
 	arithmExprEvaluator = retdec::llvmir2hll::ArithmExprEvaluatorFactory::getInstance().createObject(
 		ArithmExprEvaluator);
@@ -589,7 +616,7 @@ bool Decompiler::initialize(Module &m) {
 
 	// Instantiate the requested variable names generator and make sure it
 	// exists.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used variable names generator [" + VarNameGen + "]");
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used variable names generator [" + VarNameGen + "]");
 	varNameGen = retdec::llvmir2hll::VarNameGenFactory::getInstance().createObject(
 		VarNameGen, VarNameGenPrefix);
 	if (!varNameGen) {
@@ -599,7 +626,7 @@ bool Decompiler::initialize(Module &m) {
 	}
 
 	// Instantiate the requested variable renamer and make sure it exists.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used variable renamer [" + VarRenamer + "]");
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used variable renamer [" + VarRenamer + "]");
 	varRenamer = retdec::llvmir2hll::VarRenamerFactory::getInstance().createObject(
 		VarRenamer, varNameGen, true);
 	if (!varRenamer) {
@@ -610,7 +637,7 @@ bool Decompiler::initialize(Module &m) {
 
 	// Instantiate the requested converter of LLVM IR to BIR and make sure it
 	// exists.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used LLVM IR to BIR converter [" + LLVMIR2BIRConverter + "]");
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used LLVM IR to BIR converter [" + LLVMIR2BIRConverter + "]");
 	llvm2BIRConverter = retdec::llvmir2hll::LLVMIR2BIRConverterFactory::getInstance().createObject(
 		LLVMIR2BIRConverter, this);
 	if (!llvm2BIRConverter) {
@@ -677,11 +704,11 @@ void Decompiler::createSemantics() {
 void Decompiler::createSemanticsFromParameter() {
 	if (Semantics.empty() || Semantics == "-") {
 		// Do no use any semantics.
-		if (Debug) retdec::llvm_support::printSubPhase("creating the used semantics [none]");
+		retdec::llvm_support::reportSubPhase(Debug, "creating the used semantics [none]");
 		semantics = retdec::llvmir2hll::DefaultSemantics::create();
 	} else {
 		// Use the given semantics.
-		if (Debug) retdec::llvm_support::printSubPhase("creating the used semantics [" + Semantics + "]");
+		retdec::llvm_support::reportSubPhase(Debug, "creating the used semantics [" + Semantics + "]");
 		semantics = retdec::llvmir2hll::CompoundSemanticsBuilder::build(split(Semantics, ','));
 	}
 }
@@ -695,7 +722,7 @@ void Decompiler::createSemanticsFromLLVMIR() {
 	std::string usedSemantics("libc,gcc-general,win-api");
 
 	// Use the list to create the semantics.
-	if (Debug) retdec::llvm_support::printSubPhase("creating the used semantics [" + usedSemantics + "]");
+	retdec::llvm_support::reportSubPhase(Debug, "creating the used semantics [" + usedSemantics + "]");
 	semantics = retdec::llvmir2hll::CompoundSemanticsBuilder::build(split(usedSemantics, ','));
 }
 
@@ -707,12 +734,12 @@ void Decompiler::createSemanticsFromLLVMIR() {
 bool Decompiler::loadConfig() {
 	// Currently, we always use the JSON config.
 	if (ConfigPath.empty()) {
-		if (Debug) retdec::llvm_support::printSubPhase("creating a new config");
+		retdec::llvm_support::reportSubPhase(Debug, "creating a new config");
 		config = retdec::llvmir2hll::JSONConfig::empty();
 		return true;
 	}
 
-	if (Debug) retdec::llvm_support::printSubPhase("loading the input config");
+	retdec::llvm_support::reportSubPhase(Debug, "loading the input config");
 	try {
 		config = retdec::llvmir2hll::JSONConfig::fromFile(ConfigPath);
 		return true;
@@ -860,7 +887,7 @@ void Decompiler::validateResultingModule() {
 		retdec::llvmir2hll::ValidatorFactory::getInstance().getRegisteredObjects());
 	std::sort(regValidatorIDs.begin(), regValidatorIDs.end());
 	for (const auto &id : regValidatorIDs) {
-		if (Debug) retdec::llvm_support::printSubPhase("running " + id + "Validator");
+		retdec::llvm_support::reportSubPhase(Debug, "running " + id + "Validator");
 		ShPtr<retdec::llvmir2hll::Validator> validator(
 			retdec::llvmir2hll::ValidatorFactory::getInstance().createObject(id));
 		validator->validate(resModule, true);
@@ -885,6 +912,8 @@ void Decompiler::emitTargetHLLCode() {
 	hllWriter->setOptionKeepAllBrackets(KeepAllBrackets);
 	hllWriter->setOptionEmitTimeVaryingInfo(!NoTimeVaryingInfo);
 	hllWriter->setOptionUseCompoundOperators(!NoCompoundOperators);
+	hllWriter->setOptionEmitFunctionsInChunks(EmitFunctionsInChunks);
+	hllWriter->setOptionEmitFunctionsInParallel(EmitFunctionsInParallel);
 	hllWriter->emitTargetCode(resModule);
 }
 
@@ -1201,6 +1230,32 @@ int compileModule(char **argv, LLVMContext &context) {
 	return 0;
 }
 
+/**
+* @brief Runs one conversion job with the given command line.
+*
+* In daemon mode, this runs in a forked worker; otherwise it is just the rest
+* of main().
+*/
+int runJob(int argc, char **argv) {
+	cl::ParseCommandLineOptions(argc, argv,
+		"convertor of LLVMIR into the target high-level language\n");
+
+	// Must happen before the measured work starts, so the phases of the run
+	// get recorded even when RETDEC_PROFILE is unset.
+	if (MemoryReport) {
+		retdec::utils::instrumentation::enable();
+	}
+
+	LLVMContext context;
+	int rc = compileModule(argv, context);
+
+	if (MemoryReport) {
+		retdec::utils::instrumentation::printMemoryReport(std::cerr);
+	}
+
+	return rc;
+}
+
 } // anonymous namespace
 
 int main(int argc, char **argv) {
@@ -1209,10 +1264,27 @@ int main(int argc, char **argv) {
 	llvm_shutdown_obj Y; // Call llvm_shutdown() on exit.
 	EnableDebugBuffering = true;
 
-	cl::ParseCommandLineOptions(argc, argv,
-		"convertor of LLVMIR into the target high-level language\n");
+	// Must happen before the LLVM command-line parsing -- in daemon mode, the
+	// parsing runs in the workers, once per job.
+	const auto daemonSocket =
+		retdec::utils::JobServer::extractDaemonOption(argc, argv);
+	if (!daemonSocket.empty()) {
+		retdec::utils::JobServer server(daemonSocket);
+		if (!server.listenOn()) {
+			std::cerr << "Error: failed to listen on socket: "
+				<< daemonSocket << "\n";
+			return EXIT_FAILURE;
+		}
+		return server.run([argv](const std::vector<std::string> &args) {
+			auto jobArgs = args;
+			std::vector<char*> jobArgv;
+			jobArgv.push_back(argv[0]);
+			for (auto &arg : jobArgs) {
+				jobArgv.push_back(&arg[0]);
+			}
+			return runJob(static_cast<int>(jobArgv.size()), jobArgv.data());
+		});
+	}
 
-	LLVMContext context;
-	int rc = compileModule(argv, context);
-	return rc;
+	return runJob(argc, argv);
 }
@@ -64,12 +64,18 @@ std::unique_ptr<Image> createImageImpl(const std::shared_ptr<retdec::fileformat:
  *
  * @param filePath Path to input file.
  * @param config Config used to determine if the input is a raw binary file format.
+ * @param loadFlags Load flags passed to the created @c FileFormat. Passing
+ *                  @c LoadFlags::MAP_INPUT_FILE makes the image windowed: it
+ *                  is backed by a memory mapping of the input file, so its
+ *                  bytes are faulted in from the disk on access instead of
+ *                  being read upfront (see also Image::prefetchDataOnAddress()).
  *
  * @return Pointer to instance of Image class or @c nullptr if any error
  */
-std::unique_ptr<Image> createImage(const std::string& filePath, retdec::config::Config *config)
+std::unique_ptr<Image> createImage(const std::string& filePath, retdec::config::Config *config,
+	retdec::fileformat::LoadFlags loadFlags)
 {
-	std::unique_ptr<retdec::fileformat::FileFormat> fileFormat = retdec::fileformat::createFileFormat(filePath, config);
+	std::unique_ptr<retdec::fileformat::FileFormat> fileFormat = retdec::fileformat::createFileFormat(filePath, config, loadFlags);
 	std::shared_ptr<retdec::fileformat::FileFormat> fileFormatShared(std::move(fileFormat)); // Obtain ownership.
 	return createImageImpl(fileFormatShared);
 }
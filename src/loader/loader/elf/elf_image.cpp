@@ -18,6 +18,7 @@
 #include "retdec/loader/loader/elf/elf_image.h"
 #include "retdec/loader/utils/overlap_resolver.h"
 #include "retdec/loader/utils/range.h"
+#include "retdec/utils/thread_pool.h"
 
 namespace retdec {
 namespace loader {
@@ -471,10 +472,28 @@ void ElfImage::fixBssSegments()
 			bssSegment->resize(nextSegment->getAddress() - bssSegment->getAddress());
 		}
 	}
+
+	// Resizing changed the boundaries of the segments
+	invalidateAddressIndex();
 }
 
 void ElfImage::applyRelocations()
 {
+	// MIPS and PowerPC pair HI16/LO16 relocations by their order in the
+	// table, so their application is order-dependent and stays sequential.
+	const auto arch = getFileFormat()->getTargetArchitecture();
+	bool orderDependent = arch == retdec::fileformat::Architecture::MIPS
+			|| arch == retdec::fileformat::Architecture::POWERPC;
+
+	// Group the applicable relocations by their target segment -- writes to
+	// different segments touch different buffers, so the groups can be
+	// applied in parallel.
+	using RelSymPair = std::pair<
+			const retdec::fileformat::Relocation*,
+			const retdec::fileformat::Symbol*>;
+	std::unordered_map<const Segment*, std::size_t> groupIndex;
+	std::vector<std::vector<RelSymPair>> groups;
+
 	for (auto& relTable : getFileFormat()->getRelocationTables())
 	{
 		if (relTable->getLinkToSymbolTable() >= getFileFormat()->getNumberOfSymbolTables())
@@ -483,6 +502,11 @@ void ElfImage::applyRelocations()
 		const auto* symTab = getFileFormat()->getSymbolTable(relTable->getLinkToSymbolTable());
 		for (const auto& rel : *relTable)
 		{
+			// Relocation types the resolver does not handle would only
+			// waste a symbol and segment lookup each.
+			if (!canApplyRelocation(rel))
+				continue;
+
 			unsigned long long symbolIndex;
 			if (!rel.getLinkToSymbol(symbolIndex))
 				continue;
@@ -499,9 +523,60 @@ void ElfImage::applyRelocations()
 			if (sym->getType() == retdec::fileformat::Symbol::Type::EXTERN)
 				continue;
 
-			resolveRelocation(rel, *sym);
+			if (orderDependent)
+			{
+				resolveRelocation(rel, *sym);
+				continue;
+			}
+
+			const auto* seg = getSegmentFromAddress(rel.getAddress());
+			if (seg == nullptr)
+				continue;
+
+			auto fIt = groupIndex.emplace(seg, groups.size());
+			if (fIt.second)
+				groups.emplace_back();
+			groups[fIt.first->second].emplace_back(&rel, sym);
 		}
 	}
+
+	if (groups.empty())
+		return;
+
+	retdec::utils::parallelFor(groups.size(), [&](std::size_t i) {
+		for (auto& relSym : groups[i])
+			resolveRelocation(*relSym.first, *relSym.second);
+	});
+}
+
+/**
+ * @return @c true if resolveRelocation() handles the type of the given
+ * relocation on the file's architecture, @c false otherwise.
+ */
+bool ElfImage::canApplyRelocation(const retdec::fileformat::Relocation& rel) const
+{
+	switch (getFileFormat()->getTargetArchitecture())
+	{
+		case retdec::fileformat::Architecture::X86:
+			return rel.getType() == R_386_32
+					|| rel.getType() == R_386_PC32;
+		case retdec::fileformat::Architecture::ARM:
+			return rel.getType() == R_ARM_ABS32
+					|| rel.getType() == R_ARM_CALL;
+		case retdec::fileformat::Architecture::MIPS:
+			return rel.getType() == R_MIPS_32
+					|| rel.getType() == R_MIPS_26
+					|| rel.getType() == R_MIPS_HI16
+					|| rel.getType() == R_MIPS_LO16;
+		case retdec::fileformat::Architecture::POWERPC:
+			return rel.getType() == R_PPC_ADDR32
+					|| rel.getType() == R_PPC_ADDR16_HI
+					|| rel.getType() == R_PPC_ADDR16_HA
+					|| rel.getType() == R_PPC_ADDR16_LO
+					|| rel.getType() == R_PPC_REL24;
+		default:
+			return false;
+	}
 }
 
 void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, const retdec::fileformat::Symbol& sym)
@@ -4,10 +4,12 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <climits>
 #include <cstring>
 
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/memory_mapped_file.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
 #include "retdec/loader/loader/image.h"
@@ -18,7 +20,7 @@ namespace retdec {
 namespace loader {
 
 Image::Image(const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat) : _fileFormat(fileFormat), _segments(),
-	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage()
+	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage(), _addressIndex(), _addressIndexIsValid(false)
 {
 }
 
@@ -322,6 +324,24 @@ std::pair<const std::uint8_t*, std::uint64_t> Image::getRawSegmentData(std::uint
 	return { rawData.first + offset, rawData.second - offset };
 }
 
+/**
+ * Advises the OS to start reading the data on the given address range into
+ * memory in the background. This is purely a performance hint for access
+ * patterns known in advance (e.g. the ranges selected for decoding): when the
+ * image is backed by a memory-mapped input file, it starts the read-ahead of
+ * the pages the caller is about to touch. It has no observable effect on any
+ * of the data access methods and may be a no-op.
+ *
+ * @param address Address the data start at.
+ * @param size Size of the data in bytes.
+ */
+void Image::prefetchDataOnAddress(std::uint64_t address, std::uint64_t size) const
+{
+	auto rawData = getRawSegmentData(address);
+	if (rawData.first)
+		retdec::utils::MemoryMappedFile::prefetch(rawData.first, std::min(size, rawData.second));
+}
+
 /**
  * Get integer (@a x bytes) located at provided address using the specified endian or default file endian
  *
@@ -340,8 +360,17 @@ bool Image::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t& res,
 		return false;
 	}
 
+	// Fast path -- decode the value straight from the raw segment data when
+	// it is physically present as a whole.
+	const auto offset = address - seg->getAddress();
+	const auto rawData = seg->getRawData();
+	if (rawData.first && offset + x <= rawData.second)
+	{
+		return createValueFromBytes(rawData.first + offset, x, res, e);
+	}
+
 	std::vector<std::uint8_t> data;
-	if (!seg->getBytes(data, address - seg->getAddress(), x) || data.size() != x)
+	if (!seg->getBytes(data, offset, x) || data.size() != x)
 	{
 		return false;
 	}
@@ -375,6 +404,68 @@ bool Image::getXBytes(std::uint64_t address, std::uint64_t x, std::vector<std::u
 	return true;
 }
 
+/**
+ * Get an array of @a count words located at provided address using the specified
+ * endian or default file endian. The address to segment resolution and the fetch
+ * of the underlying data are done only once for the whole array.
+ *
+ * @param address Address to get the words from
+ * @param count   Number of words to get
+ * @param res     Result array
+ * @param e       Endian - if specified it is forced, otherwise file's endian is used
+ *
+ * @return Status of operation (@c true if all is OK, @c false otherwise)
+ */
+bool Image::getWords(std::uint64_t address, std::uint64_t count, std::vector<std::uint64_t>& res, Endianness e/* = UNKNOWN*/) const
+{
+	const auto *seg = getSegmentFromAddress(address);
+	const auto bytesPerWord = getBytesPerWord();
+	res.clear();
+	if (!seg || bytesPerWord == 0)
+	{
+		return false;
+	}
+
+	const auto offset = address - seg->getAddress();
+	const auto totalSize = count * bytesPerWord;
+	res.reserve(count);
+
+	// Fast path -- decode the values straight from the raw segment data when
+	// the whole array is physically present.
+	const auto rawData = seg->getRawData();
+	const auto *data = rawData.first;
+	std::vector<std::uint8_t> loadedData;
+	if (!data || offset + totalSize > rawData.second)
+	{
+		// The range is not fully backed by physical data (e.g. it reaches
+		// into a BSS segment) -- load it through the segment, which
+		// zero-fills the virtual part.
+		if (!seg->getBytes(loadedData, offset, totalSize) || loadedData.size() != totalSize)
+		{
+			return false;
+		}
+
+		data = loadedData.data();
+	}
+	else
+	{
+		data += offset;
+	}
+
+	for (std::uint64_t i = 0; i < count; ++i)
+	{
+		std::uint64_t value;
+		if (!createValueFromBytes(data + i * bytesPerWord, bytesPerWord, value, e))
+		{
+			return false;
+		}
+
+		res.push_back(value);
+	}
+
+	return true;
+}
+
 bool Image::setXByte(std::uint64_t address, std::uint64_t x, std::uint64_t val, retdec::utils::Endianness e/* = retdec::utils::Endianness::UNKNOWN*/)
 {
 	const auto *seg = getSegmentFromAddress(address);
@@ -427,6 +518,7 @@ void Image::setStatusMessage(const std::string& message)
 Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 {
 	_segments.push_back(std::move(segment));
+	invalidateAddressIndex();
 
 	// We have used move constructor, segment is no longer valid pointer
 	// Now give segment name
@@ -442,6 +534,7 @@ void Image::removeSegment(Segment* segment)
 		if (itr->get() == segment)
 		{
 			_segments.erase(itr);
+			invalidateAddressIndex();
 			return;
 		}
 	}
@@ -461,6 +554,17 @@ void Image::sortSegments()
 			{
 				return seg1->getAddress() < seg2->getAddress();
 			});
+	invalidateAddressIndex();
+}
+
+/**
+ * Invalidates the address index over the segments. Needs to be called whenever
+ * the segment list or the boundaries of some segment change, e.g. after
+ * resizing or shrinking of a segment.
+ */
+void Image::invalidateAddressIndex()
+{
+	_addressIndexIsValid = false;
 }
 
 const Segment* Image::_getSegment(std::size_t index) const
@@ -495,13 +599,65 @@ const Segment* Image::_getSegmentWithIndex(std::size_t index) const
 
 const Segment* Image::_getSegmentFromAddress(std::uint64_t address) const
 {
-	for (const auto& segment : getSegments())
+	if (!_addressIndexIsValid)
+		buildAddressIndex();
+
+	// Find the position right behind the last entry that starts at or below
+	// the address. Only entries before this position can contain the address.
+	auto itr = std::upper_bound(_addressIndex.begin(), _addressIndex.end(), address,
+			[](std::uint64_t address, const SegmentIndexEntry& entry)
+			{
+				return address < entry.address;
+			});
+
+	// Walk the candidates from the back. Segments may overlap, so out of all
+	// segments containing the address, return the one that comes first in the
+	// segment list to keep the same result the linear scan used to give.
+	const Segment* result = nullptr;
+	std::size_t resultOrder = 0;
+	while (itr != _addressIndex.begin())
 	{
-		if (segment->containsAddress(address))
-			return segment.get();
+		--itr;
+		if (itr->segment->containsAddress(address) && (!result || itr->order < resultOrder))
+		{
+			result = itr->segment;
+			resultOrder = itr->order;
+		}
+
+		// No earlier entry reaches up to the address -- stop the walk.
+		if (itr == _addressIndex.begin() || std::prev(itr)->maxEndAddress < address)
+			break;
 	}
 
-	return nullptr;
+	return result;
+}
+
+/**
+ * Builds the index for address to segment resolution. The index is sorted by
+ * the start addresses of the segments and every entry carries the maximum end
+ * address over all entries up to and including itself, so a lookup can stop
+ * as soon as no earlier segment can contain the looked up address.
+ */
+void Image::buildAddressIndex() const
+{
+	_addressIndex.clear();
+	_addressIndex.reserve(_segments.size());
+	for (std::size_t i = 0; i < _segments.size(); ++i)
+		_addressIndex.push_back({ _segments[i]->getAddress(), _segments[i]->getEndAddress(), i, _segments[i].get() });
+
+	std::stable_sort(_addressIndex.begin(), _addressIndex.end(), [](const SegmentIndexEntry& entry1, const SegmentIndexEntry& entry2)
+			{
+				return entry1.address < entry2.address;
+			});
+
+	std::uint64_t maxEndAddress = 0;
+	for (auto& entry : _addressIndex)
+	{
+		maxEndAddress = std::max(maxEndAddress, entry.maxEndAddress);
+		entry.maxEndAddress = maxEndAddress;
+	}
+
+	_addressIndexIsValid = true;
 }
 
 } // namespace loader
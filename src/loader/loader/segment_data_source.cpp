@@ -12,18 +12,27 @@
 namespace retdec {
 namespace loader {
 
-SegmentDataSource::SegmentDataSource() : _data(nullptr, 0)
+SegmentDataSource::SegmentDataSource() : _data(nullptr, 0), _copiedData()
 {
 }
 
 SegmentDataSource::SegmentDataSource(const llvm::StringRef& data)
-	: _data(data.data(), data.size())
+	: _data(data.data(), data.size()), _copiedData()
 {
 }
 
 SegmentDataSource::SegmentDataSource(const SegmentDataSource& dataSource)
-	: _data(dataSource._data.data(), dataSource._data.size())
+	: _data(dataSource._data.data(), dataSource._data.size()), _copiedData()
 {
+	// If the source was already written into, it views its own private copy
+	// of the data. Copy that too and repoint the view, so the two sources do
+	// not share writable data.
+	if (!dataSource._copiedData.empty())
+	{
+		auto viewOffset = dataSource._data.bytes_begin() - dataSource._copiedData.data();
+		_copiedData = dataSource._copiedData;
+		_data = llvm::StringRef(reinterpret_cast<const char*>(_copiedData.data()) + viewOffset, _data.size());
+	}
 }
 
 SegmentDataSource::~SegmentDataSource()
@@ -94,10 +103,27 @@ bool SegmentDataSource::saveData(std::uint64_t saveOffset, std::uint64_t saveSiz
 	if (saveOffset >= getDataSize())
 		return false;
 
+	copyDataOnWrite();
 	saveSize = saveOffset + saveSize > getDataSize() ? getDataSize() - saveOffset : saveSize;
 	std::copy(data.data(), data.data() + saveSize, const_cast<char*>(_data.data()) + saveOffset);
 	return true;
 }
 
+/**
+ * Materializes a private copy of the viewed data and repoints the view into it.
+ * The view normally aliases the byte storage of the underlying FileFormat, so
+ * writes must not go through it directly -- they would patch the original file
+ * data shared by all its other users. Segments that are never written into
+ * (the vast majority) keep the copy-free view.
+ */
+void SegmentDataSource::copyDataOnWrite()
+{
+	if (!_copiedData.empty() || !isDataSet())
+		return;
+
+	_copiedData.assign(_data.bytes_begin(), _data.bytes_end());
+	_data = llvm::StringRef(reinterpret_cast<const char*>(_copiedData.data()), _copiedData.size());
+}
+
 } // namespace loader
 } // namespace retdec
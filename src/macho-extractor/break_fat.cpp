@@ -4,8 +4,11 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
-#include <iostream>
+#include <atomic>
 #include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
 
 #include <llvm/Support/MachO.h>
 #include <llvm/Support/Path.h>
@@ -97,8 +100,12 @@ namespace macho_extractor {
  */
 BreakMachOUniversal::BreakMachOUniversal(
 		const std::string &filePath)
-	: path(filePath), buffer(MemoryBuffer::getFile(Twine(filePath)))
+	: path(filePath), buffer(MemoryBuffer::getFile(Twine(filePath), -1,
+		/*RequiresNullTerminator=*/false))
 {
+	// Without the null terminator requirement, large files are mapped into
+	// memory instead of being read into a heap buffer. Slices are written
+	// straight from this shared read-only mapping.
 	if(buffer && !buffer.getError())
 	{
 		auto object = MachOUniversalBinary::create(
@@ -113,6 +120,7 @@ BreakMachOUniversal::BreakMachOUniversal(
 		{
 			file = std::move(object.get());
 			isStatic = isArchive();
+			buildSliceIndex();
 			valid = true;
 		}
 	}
@@ -167,42 +175,60 @@ const char *BreakMachOUniversal::getFileBufferStart()
 
 
 /**
- * Get Mach-O Universal object iterator by architecture
- * @param cpuType Mach-O specific CPU type constant
- * @param res reference for storing result
- * @return @c true if object with @p cpuType was found, @c false otherwise
+ * Build table of slices contained in fat Mach-O
+ *
+ * This is the only place that walks the fat header structures - all lookup
+ * and extraction requests are served from the table.
  */
-bool BreakMachOUniversal::getByArchFamily(
-		std::uint32_t cpuType,
-		MachOUniversalBinary::object_iterator &res)
+void BreakMachOUniversal::buildSliceIndex()
 {
+	slices.clear();
 	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
 	{
-		if(cpuType == i->getCPUType())
+		Slice slice;
+		slice.cpuType = i->getCPUType();
+		slice.offset = i->getOffset();
+		slice.size = i->getSize();
+		slice.archName = getArchName(i);
+		slices.push_back(std::move(slice));
+	}
+}
+
+
+/**
+ * Get slice by architecture
+ * @param cpuType Mach-O specific CPU type constant
+ * @return slice with @p cpuType, or @c nullptr if there is no such slice
+ */
+const BreakMachOUniversal::Slice* BreakMachOUniversal::getSliceByCpuType(
+		std::uint32_t cpuType) const
+{
+	for(const auto &slice : slices)
+	{
+		if(cpuType == slice.cpuType)
 		{
-			res = i;
-			return true;
+			return &slice;
 		}
 	}
 
-	return false;
+	return nullptr;
 }
 
 
 /**
- * Extract object by iterator
- * @param it object iterator
+ * Extract slice bytes to file
+ * @param slice slice to extract
  * @param outPath output file path
  * @return @c true if object was created successfully, @c false otherwise
  */
-bool BreakMachOUniversal::extract(
-		MachOUniversalBinary::object_iterator &it,
+bool BreakMachOUniversal::extractSlice(
+		const Slice &slice,
 		const std::string &outPath)
 {
 	std::ofstream output(outPath, std::ios::binary);
 	if(output)
 	{
-		output.write(getFileBufferStart() + it->getOffset(), it->getSize());
+		output.write(getFileBufferStart() + slice.offset, slice.size);
 		return output.good();
 	}
 
@@ -317,7 +343,7 @@ bool BreakMachOUniversal::listArchitectures(
 
 	unsigned archIndex = 0;
 	output << "Index\tName\tFamily\n";
-	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
+	for(const auto &slice : slices)
 	{
 		if(isStatic && withObjects && archIndex != 0)
 		{
@@ -326,13 +352,13 @@ bool BreakMachOUniversal::listArchitectures(
 		}
 
 		output << archIndex++ << "\t";
-		output << getArchName(i) << "\t";
-		output << cpuTypeToString(i->getCPUType()) << "\n";
+		output << slice.archName << "\t";
+		output << cpuTypeToString(slice.cpuType) << "\n";
 
 		if(isStatic && withObjects)
 		{
 			std::vector<std::string> names;
-			if(!getObjectNamesForArchive(i->getOffset(), i->getSize(), names))
+			if(!getObjectNamesForArchive(slice.offset, slice.size, names))
 			{
 				return false;
 			}
@@ -382,13 +408,13 @@ bool BreakMachOUniversal::listArchitecturesJson(
 	Value architectures(kArrayType);
 
 	unsigned archIndex = 0;
-	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
+	for(const auto &slice : slices)
 	{
 		Value arch(kObjectType);
 		Value objects(kArrayType);
 
-		auto name = getArchName(i);
-		auto family = cpuTypeToString(i->getCPUType());
+		const auto &name = slice.archName;
+		auto family = cpuTypeToString(slice.cpuType);
 		arch.AddMember("index", archIndex++, allocator);
 		arch.AddMember(
 					"name",
@@ -402,7 +428,7 @@ bool BreakMachOUniversal::listArchitecturesJson(
 		if(isStatic && withObjects)
 		{
 			std::vector<std::string> names;
-			if(!getObjectNamesForArchive(i->getOffset(), i->getSize(), names))
+			if(!getObjectNamesForArchive(slice.offset, slice.size, names))
 			{
 				return false;
 			}
@@ -454,23 +480,34 @@ bool BreakMachOUniversal::extractAllArchives()
 	}
 
 	const char *bytes = getFileBufferStart();
-	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
+
+	// Slices are independent ranges of the input written to separate files,
+	// so extract them concurrently.
+	std::vector<std::thread> writers;
+	std::atomic<bool> success(true);
+	for(const auto &slice : slices)
 	{
 		// Object within Mach-O Universal Binary are not named
-		auto fpath = path::filename(path).str() + "." + getArchName(i);
+		auto fpath = path::filename(path).str() + "." + slice.archName;
 		fpath += isStatic ? ".a" : "";
 
-		std::ofstream output(fpath, std::ios::binary);
-		if(!output.is_open())
-		{
-			return false;
-		}
-		if(!output.write(bytes + i->getOffset(), i->getSize()))
-		{
-			return false;
-		}
+		const auto offset = slice.offset;
+		const auto size = slice.size;
+		writers.emplace_back([bytes, fpath, offset, size, &success]()
+			{
+				std::ofstream output(fpath, std::ios::binary);
+				if(!output.is_open() || !output.write(bytes + offset, size))
+				{
+					success = false;
+				}
+			});
 	}
-	return true;
+
+	for(auto &writer : writers)
+	{
+		writer.join();
+	}
+	return success;
 }
 
 
@@ -487,16 +524,22 @@ bool BreakMachOUniversal::extractBestArchive(
 		return false;
 	}
 
-	auto obj = file->begin_objects();
-	if(getByArchFamily(CPU_TYPE_X86, obj)
-			|| getByArchFamily(CPU_TYPE_ARM, obj)
-			|| getByArchFamily(CPU_TYPE_POWERPC, obj))
+	const Slice *slice = getSliceByCpuType(CPU_TYPE_X86);
+	if(!slice)
+	{
+		slice = getSliceByCpuType(CPU_TYPE_ARM);
+	}
+	if(!slice)
 	{
-		return extract(obj, outPath);
+		slice = getSliceByCpuType(CPU_TYPE_POWERPC);
+	}
+	if(!slice && !slices.empty())
+	{
+		// If none of above, just pick first.
+		slice = &slices.front();
 	}
 
-	// If none of above, just pick first.
-	return extract(obj, outPath);
+	return slice ? extractSlice(*slice, outPath) : false;
 }
 
 
@@ -510,21 +553,12 @@ bool BreakMachOUniversal::extractArchiveWithIndex(
 		unsigned index,
 		const std::string &outPath)
 {
-	if(!file || index >= file->getNumberOfObjects())
+	if(!file || index >= slices.size())
 	{
 		return false;
 	}
 
-	unsigned idx = 0;
-	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
-	{
-		if(index == idx++)
-		{
-			return extract(i, outPath);
-		}
-	}
-
-	return false;
+	return extractSlice(slices[index], outPath);
 }
 
 
@@ -543,63 +577,48 @@ bool BreakMachOUniversal::extractArchiveForFamily(
 		return false;
 	}
 
-	auto obj = file->begin_objects();
+	std::uint32_t cpuType = 0;
 	if(familyName == "x86")
 	{
-		if(getByArchFamily(CPU_TYPE_X86, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_X86;
 	}
 	else if(familyName == "arm" || familyName == "thumb")
 	{
 		// Same family
-		if(getByArchFamily(CPU_TYPE_ARM, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_ARM;
 	}
 	else if(familyName == "powerpc")
 	{
-		if(getByArchFamily(CPU_TYPE_POWERPC, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_POWERPC;
 	}
 	else if(familyName == "x86-64")
 	{
-		if(getByArchFamily(CPU_TYPE_X86_64, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_X86_64;
 	}
 	else if(familyName == "arm64")
 	{
-		if(getByArchFamily(CPU_TYPE_ARM64, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_ARM64;
 	}
 	else if(familyName == "powerpc64")
 	{
-		if(getByArchFamily(CPU_TYPE_POWERPC64, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_POWERPC64;
 	}
 	else if(familyName == "sparc")
 	{
-		if(getByArchFamily(CPU_TYPE_SPARC, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_SPARC;
 	}
 	else if(familyName == "mc98000")
 	{
-		if(getByArchFamily(CPU_TYPE_MC98000, obj))
-		{
-			return extract(obj, outPath);
-		}
+		cpuType = CPU_TYPE_MC98000;
+	}
+	else
+	{
+		return false;
+	}
+
+	if(const Slice *slice = getSliceByCpuType(cpuType))
+	{
+		return extractSlice(*slice, outPath);
 	}
 
 	return false;
@@ -621,11 +640,11 @@ bool BreakMachOUniversal::extractArchiveForArchitecture(
 		return false;
 	}
 
-	for(auto i = file->begin_objects(), e = file->end_objects(); i != e; ++i)
+	for(const auto &slice : slices)
 	{
-		if(machoArchName == getArchName(i))
+		if(machoArchName == slice.archName)
 		{
-			return extract(i, outPath);
+			return extractSlice(slice, outPath);
 		}
 	}
 
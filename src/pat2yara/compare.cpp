@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <unordered_map>
+
 #include "pat2yara/compare.h"
 #include "pat2yara/utils.h"
 #include "yaramod/types/hex_string.h"
@@ -197,6 +199,48 @@ bool sortNamesPredicate(
 	return first < other;
 }
 
+/**
+ * Create content key of rule for the dedup index.
+ *
+ * Two rules share a key only when their pattern units -- wildcards
+ * included -- and their references are identical. Such rules produce the
+ * same result in every comparison above, so they always belong to the same
+ * relation group in the same role.
+ *
+ * @param rule input rule
+ *
+ * @return content key or empty string if rule has no pattern
+ */
+std::string getRuleContentKey(
+	const Rule* rule)
+{
+	const auto pattern = getHexPattern(rule, "$1");
+	if (!pattern) {
+		return std::string();
+	}
+
+	std::string key;
+	const auto &units = pattern->getUnits();
+	key.reserve(units.size() + 1);
+	for (const auto &unit : units) {
+		if (unit->isWildcard()) {
+			key.push_back('?');
+		}
+		else {
+			key.push_back("0123456789abcdef"[std::static_pointer_cast<
+				HexStringNibble>(unit)->getValue() & 0x0f]);
+		}
+	}
+
+	key.push_back('|');
+	const auto* refsMeta = rule->getMetaWithName("refs");
+	if (refsMeta) {
+		key += refsMeta->getValue().getPureText();
+	}
+
+	return key;
+}
+
 } // anonymous namespace
 
 
@@ -356,9 +400,42 @@ bool RuleRelations::add(
 }
 
 
+/**
+ * Add rule whose relation to the base rule is already known.
+ *
+ * Used by the content index in getRuleRelationsFromRules() -- a rule with
+ * the same content as an already classified rule does not have to be
+ * compared again.
+ *
+ * @param otherRule rule to add
+ * @param equal @c true for an equal rule, @c false for an alternative
+ */
+void RuleRelations::addClassified(
+	Rule* otherRule,
+	bool equal)
+{
+	if (equal) {
+		if (!compareNames(rule, otherRule)) {
+			// Add to equals only if names are different.
+			equals.push_back(otherRule);
+		}
+	}
+	else {
+		alternatives.push_back(otherRule);
+	}
+}
+
+
 /**
  * Create vector of relations from rules.
  *
+ * Across toolchain releases the same function bodies recur thousands of
+ * times. Classified rule bodies are therefore remembered in a content-hash
+ * index and exact duplicates are routed to their group directly, instead of
+ * being compared against every group created so far. Rules without an
+ * indexed duplicate still go through the full scan, so the produced groups
+ * are the same as without the index.
+ *
  * @param rules input rules
  *
  * @return vector of rule relations
@@ -368,13 +445,37 @@ std::vector<RuleRelations> getRuleRelationsFromRules(
 {
 	std::vector<RuleRelations> results;
 
+	/// One classified rule body in the content index.
+	struct IndexEntry
+	{
+		std::size_t group; ///< Index of group in results.
+		bool isEqual;      ///< @c true for equal, @c false for alternative.
+	};
+	std::unordered_map<std::string, IndexEntry> contentIndex;
+
 	for (const auto &rule : rules) {
+		const auto key = getRuleContentKey(rule.get());
+
+		// Duplicate bodies skip the group scan.
+		if (!key.empty()) {
+			auto indexed = contentIndex.find(key);
+			if (indexed != contentIndex.end()) {
+				results[indexed->second.group].addClassified(rule.get(),
+					indexed->second.isEqual);
+				continue;
+			}
+		}
+
 		// Look for related rules.
 		bool foundRelation = false;
-		for (auto &relation : results) {
-			if (relation.add(rule.get())) {
+		for (std::size_t i = 0, e = results.size(); i < e; ++i) {
+			if (results[i].add(rule.get())) {
 				// Related rule was found.
 				foundRelation = true;
+				if (!key.empty()) {
+					contentIndex.emplace(key,
+						IndexEntry{i, results[i].isEqual(rule.get())});
+				}
 				break;
 			}
 		}
@@ -382,6 +483,10 @@ std::vector<RuleRelations> getRuleRelationsFromRules(
 		// Create new entry if no related rule was found.
 		if (!foundRelation) {
 			results.emplace_back(RuleRelations(rule.get()));
+			if (!key.empty()) {
+				contentIndex.emplace(key,
+					IndexEntry{results.size() - 1, true});
+			}
 		}
 	}
 
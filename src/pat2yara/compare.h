@@ -42,6 +42,7 @@ class RuleRelations
 		/// @name Comparisons.
 		/// @{
 		bool add(yaramod::Rule* otherRule);
+		void addClassified(yaramod::Rule* otherRule, bool equal);
 		bool isEqual(const yaramod::Rule* otherRule) const;
 		bool isAlternative(const yaramod::Rule* otherRule) const;
 		bool isEqualOrAlternative(const yaramod::Rule* otherRule) const;
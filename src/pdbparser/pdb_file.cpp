@@ -66,7 +66,7 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 		// Get pointer to PDB info header
 		if (streams.size() > PDB_STREAM_PDB)
 		{
-			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(streams[PDB_STREAM_PDB].data);
+			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(streams[PDB_STREAM_PDB].load());
 		}
 		else
 		{
@@ -83,9 +83,11 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 }
 
 /**
- * Processes all PDB file streams and fills data containers.
+ * Processes PDB file streams and prepares data containers.
  * Must be called after load_pdb_file() and before any getting and printing or dumping method.
  * Can be called only once.
+ * Only modules and sections are parsed here -- TPI and symbol streams are
+ * parsed lazily when types or symbols are queried for the first time.
  * @param image_base Base address of program's virtual memory.
  */
 void PDBFile::initialize(int image_base)
@@ -95,9 +97,8 @@ void PDBFile::initialize(int image_base)
 		return;
 	}
 
-	// Initialize types
+	// Initialize types -- TPI stream is parsed on first type query.
 	pdb_types = new PDBTypes(&streams[PDB_STREAM_TPI]);
-	pdb_types->parse_types();
 
 	// Check if DBI stream is present
 	bool dbi_present = (num_streams > PDB_STREAM_DBI && streams[PDB_STREAM_DBI].unused == false);
@@ -106,7 +107,7 @@ void PDBFile::initialize(int image_base)
 	{
 		// Get DBI stream
 		unsigned int pdb_dbi_size = streams[PDB_STREAM_DBI].size;
-		char * pdb_dbi_data = streams[PDB_STREAM_DBI].data;
+		char * pdb_dbi_data = streams[PDB_STREAM_DBI].load();
 
 		// Get pointer to DBI header
 		dbi_header_v700 = reinterpret_cast<NewDBIHdr *>(pdb_dbi_data);
@@ -125,12 +126,11 @@ void PDBFile::initialize(int image_base)
 			image_base = 0x400000; // Default image base
 		parse_sections(image_base);
 
-		// Initialize symbols
+		// Initialize symbols -- streams are parsed on first symbol query.
 		int pdb_gsi_num = dbi_header_v700->snGSSyms;
 		int pdb_psi_num = dbi_header_v700->snPSSyms;
 		int pdb_sym_num = dbi_header_v700->snSymRecs;
 		pdb_symbols = new PDBSymbols(&streams[pdb_gsi_num],&streams[pdb_psi_num],&streams[pdb_sym_num],modules,sections,pdb_types);
-		pdb_symbols->parse_symbols();
 	}
 	pdb_initialized = true;
 }
@@ -154,7 +154,7 @@ bool PDBFile::save_streams_to_files(void)
 		if (fs == nullptr)
 			return false;
 		if (!streams[i].unused)
-			fwrite(streams[i].data,1,streams[i].size,fs);
+			fwrite(streams[i].load(),1,streams[i].size,fs);
 		fclose(fs);
 	}
 	return true;
@@ -242,7 +242,7 @@ void PDBFile::dump_FPO(void)
 
 	PDBStream *pdb_fpo_stream = &streams[pdb_fpo_num];
 	int fpoSize = pdb_fpo_stream->size;
-	PDB_FPO_DATA *fpo = reinterpret_cast<PDB_FPO_DATA *>(pdb_fpo_stream->data);
+	PDB_FPO_DATA *fpo = reinterpret_cast<PDB_FPO_DATA *>(pdb_fpo_stream->load());
 
 	int fpoCount = fpoSize / sizeof(PDB_FPO_DATA);
 	for (int i=0; i<fpoCount; i++)
@@ -283,7 +283,7 @@ void PDBFile::dump_PE_sections(void)
 	}
 
 	PDBStream *pdb_sect_stream = &streams[pdb_sec_num];
-	PDB_PVOID pSect = pdb_sect_stream->data;
+	PDB_PVOID pSect = pdb_sect_stream->load();
 	unsigned long sectSize = pdb_sect_stream->size;
 
 	int nSect = sectSize / sizeof (PDB_IMAGE_SECTION_HEADER);
@@ -307,9 +307,9 @@ PDBFile::~PDBFile()
 {
 	if (pdb_file_data)
 		delete [] pdb_file_data;
-	// Delete all non-linear (copied) streams
+	// Delete all non-linear streams that were reassembled into own memory
 	for (unsigned int i = 0; i < num_streams;i++)
-		if (!streams[i].unused && !streams[i].linear)
+		if (!streams[i].unused && !streams[i].linear && streams[i].data != nullptr)
 			delete [] streams[i].data;
 	if (pdb_types)
 		delete pdb_types;
@@ -406,6 +406,7 @@ PDBFileState PDBFile::load_pdb_v700(void)
 			streams[i].unused = true;
 			streams[i].linear = false;
 			streams[i].data = nullptr;
+			streams[i].pages = nullptr;
 		}
 		// Stream is not empty
 		else
@@ -417,12 +418,19 @@ PDBFileState PDBFile::load_pdb_v700(void)
 			{
 				streams[i].data = pdb_file_data + pdb_root_dir->V700.adStreamSizes[cur_pagedir_index] * page_size;
 				streams[i].linear = true;
+				streams[i].pages = nullptr;
 			}
-			// Stream is not linear in pdb file, we must copy it to linear memory
+			// Stream is not linear in pdb file, we just remember its page
+			// table -- it is copied to linear memory only when the stream
+			// is actually used. See PDBStream::load().
 			else
 			{
-				streams[i].data = extract_stream(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream);
+				streams[i].data = nullptr;
 				streams[i].linear = false;
+				streams[i].file_data = pdb_file_data;
+				streams[i].pages = &pdb_root_dir->V700.adStreamSizes[cur_pagedir_index];
+				streams[i].num_pages = pages_per_stream;
+				streams[i].page_size = page_size;
 			}
 			cur_pagedir_index += pages_per_stream;  // Increase index to next stream
 		}
@@ -439,7 +447,7 @@ void PDBFile::parse_modules(void)
 	// Get DBI stream size and data
 	PDBStream * pdb_dbi_stream = &streams[PDB_STREAM_DBI];
 	unsigned int pdb_dbi_size = pdb_dbi_stream->size;
-	char * pdb_dbi_data = pdb_dbi_stream->data;
+	char * pdb_dbi_data = pdb_dbi_stream->load();
 
 	if (pdb_dbi_size < sizeof(NewDBIHdr))  // DBI stream is empty
 		return;
@@ -499,7 +507,7 @@ void PDBFile::parse_sections(int image_base)
 	// Get stream with section info
 	PDBStream * pdb_sect_stream = &streams[pdb_sec_num];
 	unsigned int pdb_sect_size = pdb_sect_stream->size;
-	char * pdb_sect_data = pdb_sect_stream->data;
+	char * pdb_sect_data = pdb_sect_stream->load();
 
 	// Get number of sections and array of section headers
 	int num_sects = pdb_sect_size / sizeof(PDB_IMAGE_SECTION_HEADER);
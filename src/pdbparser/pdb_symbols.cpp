@@ -266,6 +266,9 @@ void PDBSymbols::parse_symbols(void)
 	if (parsed)
 		return;
 
+	// Get SYM stream data (fragmented streams are reassembled on first use)
+	pdb_sym_data = pdb_sym->load();
+
 	// Process SYM stream to find global variables
 	int position = 0;
 	while (unsigned(position) < pdb_sym_size)
@@ -297,6 +300,7 @@ void PDBSymbols::parse_symbols(void)
 		if (modules[m].stream_num == 65535)
 			continue;
 		PDBStream *stream = modules[m].stream;
+		stream->load();
 		position = 4;
 		int cnt = 0;
 		PDBFunction * new_function = nullptr;
@@ -364,8 +368,9 @@ void PDBSymbols::parse_symbols(void)
 							}
 							else
 								func_names[new_function->name] = new_function;
-							// Add function into functions map
+							// Add function into functions maps
 							functions[new_function->address] = new_function;
+							functions_byname[new_function->name] = new_function;
 							new_function = nullptr;
 						}
 					}
@@ -409,6 +414,7 @@ void PDBSymbols::dump_global_symbols(void)
 	unsigned int position = 0;
 	int cnt = 0;
 	puts("******* SYM global symbols *******");
+	pdb_sym_data = pdb_sym->load();
 	while (position < pdb_sym_size)
 	{
 		PDBGeneralSymbol *symbol = reinterpret_cast<PDBGeneralSymbol *>(pdb_sym_data + position);
@@ -432,6 +438,7 @@ void PDBSymbols::dump_module_symbols(int index)
 		return;
 	}
 	PDBStream *stream = modules[index].stream;
+	stream->load();
 	int position = 4;
 	int cnt = 0;
 
@@ -757,7 +764,8 @@ void PDBSymbols::dump_all_modules(void)
 void PDBSymbols::print_functions(void)
 {
 	puts("******* SYM functions list *******");
-	for (PDBFunctionAddressMap::iterator it = functions.begin(); it != functions.end(); ++it)
+	PDBFunctionAddressMap & fncs = get_functions();
+	for (PDBFunctionAddressMap::iterator it = fncs.begin(); it != fncs.end(); ++it)
 	{
 		if (it->second != nullptr)
 			it->second->dump();
@@ -767,7 +775,8 @@ void PDBSymbols::print_functions(void)
 void PDBSymbols::print_global_variables(void)
 {
 	puts("******* SYM global variables list *******");
-	for (PDBGlobalVarAddressMap::iterator it = global_variables.begin(); it != global_variables.end(); ++it)
+	PDBGlobalVarAddressMap & gvars = get_global_variables();
+	for (PDBGlobalVarAddressMap::iterator it = gvars.begin(); it != gvars.end(); ++it)
 	{
 		printf("Global variable [%s] at 0x%08x\n", it->second.name, it->second.address);
 		printf("\tOffset : %08x\n", it->second.offset);
@@ -1072,6 +1072,9 @@ void PDBTypes::parse_types(void)
 {
 	if (parsed)
 		return;
+	// Get TPI stream data (fragmented streams are reassembled on first use)
+	pdb_tpi_data = pdb_tpi_stream->load();
+	tpi_header = reinterpret_cast<HDR *>(pdb_tpi_data);
 	// Base types
 	types[T_NOTYPE] = new PDBTypeBase(0x00000000, PDBBASETYPE_VARIADIC, false, 0, "...");
 	types[T_VOID] = new PDBTypeBase(0x00000003, PDBBASETYPE_VOID, false, 0, "void");
@@ -1256,6 +1259,8 @@ void PDBTypes::parse_types(void)
 void PDBTypes::dump_types(void)
 {
 	puts("******* TPI list of types (dump) *******");
+	pdb_tpi_data = pdb_tpi_stream->load();
+	tpi_header = reinterpret_cast<HDR *>(pdb_tpi_data);
 	DisplayTypes(pdb_tpi_data, pdb_tpi_size);
 	puts("");
 }
@@ -1268,7 +1273,7 @@ void PDBTypes::print_types(void)
 		puts("Types not parsed yet!\n");
 		return;
 	}
-	for (PDBTypeDefIndexMap::iterator it = types_fully_defined.begin(); it != types_fully_defined.end(); ++it)
+	for (PDBTypeDefIndexOrderedMap::iterator it = types_fully_defined.begin(); it != types_fully_defined.end(); ++it)
 	{
 		if (it->second != nullptr)
 		{
@@ -6,6 +6,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include "retdec/pdbparser/pdb_info.h"
 #include "retdec/pdbparser/pdb_utils.h"
@@ -13,6 +14,27 @@
 namespace retdec {
 namespace pdbparser {
 
+/**
+ * Reassembles a fragmented stream into linear memory on first use.
+ * Linear streams are served directly from the PDB file data, so no copy
+ * is ever made for them.
+ * @return Stream data in linear memory or nullptr for unused streams.
+ */
+char * _PDBStream::load(void)
+{
+	// Linear and already reassembled streams are served as they are.
+	if (data != nullptr || pages == nullptr)
+		return data;
+
+	// Copy data from each page
+	data = new char[num_pages * page_size];
+	for (int i = 0;i < num_pages;i++)
+	{
+		memcpy(data + page_size * i, file_data + pages[i] * page_size, page_size);
+	}
+	return data;
+}
+
 PDB_PBYTE RecordValue(PDB_PBYTE pbData, PDB_PDWORD pdValue)
 {
 	PDB_WORD wValue;
@@ -5,13 +5,28 @@
  */
 
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "retdec/stacofin/stacofin.h"
 #include "yaracpp/yara_detector/yara_detector.h"
+#include "retdec/crypto/crypto.h"
 #include "retdec/loader/loader/image.h"
+#include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/instrumentation.h"
+#include "retdec/utils/thread_pool.h"
+#include "retdec/yara-cache/yara_cache.h"
 
 using namespace retdec::utils;
 using namespace yaracpp;
@@ -20,6 +35,122 @@ using namespace retdec::loader;
 namespace retdec {
 namespace stacofin {
 
+namespace {
+
+/**
+ * Get name of the file with the historical hit count of a signature file.
+ * It lives beside the signature file, like the compiled rule cache does.
+ *
+ * @param yaraFile signature file path
+ * @return hit statistics file path
+ */
+std::string getHitStatsFile(const std::string &yaraFile)
+{
+	return yaraFile + ".hits";
+}
+
+
+/**
+ * Read the historical hit count of a signature file.
+ *
+ * @param yaraFile signature file path
+ * @return stored hit count, zero if there are no statistics yet
+ */
+std::uint64_t readHitStats(const std::string &yaraFile)
+{
+	std::ifstream statsFile(getHitStatsFile(yaraFile));
+	std::uint64_t hits = 0;
+	statsFile >> hits;
+	return statsFile ? hits : 0;
+}
+
+
+/**
+ * Add detections of one run to the historical hit count of a signature file.
+ * Statistics are best effort -- signature directories may be read-only, in
+ * which case the write silently fails and the ordering just stays unseeded.
+ *
+ * @param yaraFile signature file path
+ * @param hits number of detections to add
+ */
+void addHitStats(const std::string &yaraFile, std::uint64_t hits)
+{
+	if (hits == 0) {
+		return;
+	}
+	const auto total = readHitStats(yaraFile) + hits;
+	std::ofstream statsFile(getHitStatsFile(yaraFile));
+	if (statsFile) {
+		statsFile << total << std::endl;
+	}
+}
+
+
+/// Environment variable with the directory of the persistent detection cache.
+/// When it is unset, the cache is disabled.
+const char *CACHE_DIR_ENV = "RETDEC_STACOFIN_CACHE_DIR";
+
+/// First line of a detection cache file -- a format version tag, so a future
+/// format change invalidates old files instead of misreading them.
+const char *CACHE_MAGIC = "stacofin-cache 1";
+
+/**
+ * Get name of the persistent detection cache file for one input/signature
+ * combination, or an empty string when the cache is disabled.
+ *
+ * The key pairs the hash of the scanned bytes with the hash of the resolved
+ * rule file path. The resolved path of a textual signature file embeds the
+ * hash of its content (see yara-cache), so an edited signature file changes
+ * the key and the stale detections are simply never found.
+ *
+ * Both hashes are SHA-256. The cache is meant to accumulate across many
+ * thousands of samples in one shared directory, and a collision of a short
+ * hash would silently load the detections of another binary -- the cost of
+ * the stronger hash is nothing next to the scan it saves.
+ *
+ * @param inputHash hash of the scanned input bytes
+ * @param resolvedRuleFile rule file path resolved by the compiled-rule cache
+ * @return detection cache file path, empty string if caching is disabled
+ */
+std::string getDetectionCacheFile(
+	const std::string &inputHash,
+	const std::string &resolvedRuleFile)
+{
+	const char *cacheDir = std::getenv(CACHE_DIR_ENV);
+	if (!cacheDir || !*cacheDir) {
+		return std::string();
+	}
+
+	const auto ruleHash = retdec::crypto::getSha256(
+		reinterpret_cast<const unsigned char*>(resolvedRuleFile.data()),
+		resolvedRuleFile.length());
+
+	retdec::utils::FilesystemPath cacheFile(cacheDir);
+	cacheFile.append(inputHash + "." + ruleHash + ".stacofin");
+	return cacheFile.getPath();
+}
+
+/**
+ * Get total size of code sections of an image. This is the base the coverage
+ * target of the multi-file search is computed from.
+ *
+ * @param image input file image
+ * @return size of code sections in bytes
+ */
+std::uint64_t getCodeSectionsSize(const Image &image)
+{
+	std::uint64_t size = 0;
+	for (const auto &segment : image.getSegments()) {
+		const auto* secSeg = segment->getSecSeg();
+		if (secSeg && (secSeg->isCode() || secSeg->isCodeAndData())) {
+			size += segment->getSize();
+		}
+	}
+	return size;
+}
+
+} // anonymous namespace
+
 
 /**
  * Parse string with references from meta attribute.
@@ -86,16 +217,36 @@ void Finder::search(
 		return;
 	}
 
-	// Start Yara detector.
-	YaraDetector detector;
-	detector.addRuleFile(yaraFile);
 	auto inputBytes = fileFormat->getLoadedBytes();
+	const auto compiledRuleFile
+		= retdec::yara_cache::getCompiledRuleFile(yaraFile);
+
+	// The same statically linked runtimes recur across many samples, so the
+	// detections themselves are cached on disk keyed by the content of the
+	// scanned bytes -- a hit skips the scan entirely.
+	std::string cachePath;
+	if (std::getenv(CACHE_DIR_ENV)) {
+		const auto inputHash = retdec::crypto::getSha256(
+			inputBytes.data(), inputBytes.size());
+		cachePath = getDetectionCacheFile(inputHash, compiledRuleFile);
+		if (!cachePath.empty() && loadCachedDetections(cachePath, yaraFile)) {
+			retdec::utils::instrumentation::incrementCounter(
+				"stacofin-cache/hits");
+			return;
+		}
+	}
+
+	// Start Yara detector. User supplied signature files are textual, so add
+	// their cached compiled form instead of re-compiling them on every run.
+	YaraDetector detector;
+	detector.addRuleFile(compiledRuleFile);
 	detector.analyze(inputBytes);
 	if (!detector.isInValidState()) {
 		return;
 	}
 
 	// Iterate over detected rules.
+	const auto firstNewDetection = detectedFunctions.size();
 	isSorted = false;
 	for (const YaraRule &detectedRule : detector.getDetectedRules()) {
 		DetectedFunction detectedFunction;
@@ -140,6 +291,338 @@ void Finder::search(
 			detectedFunctions.push_back(detectedFunction);
 		}
 	}
+
+	if (!cachePath.empty()) {
+		saveCachedDetections(cachePath, firstNewDetection);
+		retdec::utils::instrumentation::incrementCounter(
+			"stacofin-cache/stores");
+	}
+}
+
+/**
+ * Load detections of one signature file from the persistent cache.
+ *
+ * Loaded detections are appended to the current results the same way a scan
+ * would append them. A file in an unknown format -- truncated write, old
+ * version -- just fails the load and the caller falls back to scanning.
+ *
+ * @param cachePath detection cache file
+ * @param yaraFile signature file the cache was recorded for
+ * @return @c true if the detections were loaded, @c false otherwise
+ */
+bool Finder::loadCachedDetections(
+	const std::string &cachePath,
+	const std::string &yaraFile)
+{
+	std::ifstream cache(cachePath);
+	if (!cache.is_open()) {
+		return false;
+	}
+
+	std::string line;
+	if (!std::getline(cache, line) || line != CACHE_MAGIC) {
+		return false;
+	}
+
+	std::size_t count = 0;
+	if (!(cache >> count)) {
+		return false;
+	}
+
+	std::vector<DetectedFunction> loaded;
+	loaded.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		DetectedFunction detectedFunction;
+		detectedFunction.signaturePath = yaraFile;
+
+		std::uint64_t address = 0;
+		std::size_t nameCount = 0;
+		std::size_t referenceCount = 0;
+		if (!(cache >> detectedFunction.size >> detectedFunction.offset
+				>> address >> nameCount >> referenceCount)) {
+			return false;
+		}
+		detectedFunction.address = address;
+		cache.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+		for (std::size_t n = 0; n < nameCount; ++n) {
+			if (!std::getline(cache, line) || line.empty()) {
+				return false;
+			}
+			detectedFunction.names.push_back(line);
+		}
+		for (std::size_t r = 0; r < referenceCount; ++r) {
+			if (!std::getline(cache, line)) {
+				return false;
+			}
+			Reference reference;
+			std::istringstream referenceStream(line);
+			if (!(referenceStream >> reference.offset >> reference.name)) {
+				return false;
+			}
+			detectedFunction.references.push_back(reference);
+		}
+
+		loaded.push_back(std::move(detectedFunction));
+	}
+
+	for (auto &detectedFunction : loaded) {
+		coveredCode.insert(AddressRange(detectedFunction.address,
+			detectedFunction.address + detectedFunction.size));
+		detectedFunctions.push_back(std::move(detectedFunction));
+	}
+	isSorted = false;
+	return true;
+}
+
+/**
+ * Save detections of one scan to the persistent cache. Best effort -- when
+ * the file cannot be written completely, it is removed, so a later run
+ * re-scans instead of loading a truncated record.
+ *
+ * @param cachePath detection cache file
+ * @param firstIndex index of the first detection recorded by this scan
+ */
+void Finder::saveCachedDetections(
+	const std::string &cachePath,
+	std::size_t firstIndex) const
+{
+	std::ofstream cache(cachePath, std::ios::trunc);
+	if (!cache.is_open()) {
+		return;
+	}
+
+	cache << CACHE_MAGIC << "\n";
+	cache << detectedFunctions.size() - firstIndex << "\n";
+	for (std::size_t i = firstIndex; i < detectedFunctions.size(); ++i) {
+		const auto &detectedFunction = detectedFunctions[i];
+		cache << detectedFunction.size
+			<< " " << detectedFunction.offset
+			<< " " << static_cast<std::uint64_t>(detectedFunction.address)
+			<< " " << detectedFunction.names.size()
+			<< " " << detectedFunction.references.size() << "\n";
+		for (const auto &name : detectedFunction.names) {
+			cache << name << "\n";
+		}
+		for (const auto &reference : detectedFunction.references) {
+			cache << reference.offset << " " << reference.name << "\n";
+		}
+	}
+
+	if (!cache) {
+		cache.close();
+		std::remove(cachePath.c_str());
+	}
+}
+
+
+/**
+ * Search for static code in input file using multiple signature files.
+ *
+ * The signature files are distributed across threads, each scanning with its
+ * own detector and scan context. The merged result is the same set of
+ * detections a serial run of search() over the files would produce; their
+ * final order is established by the address sort of the getters.
+ *
+ * Files are scanned in order of their historical hit counts, best first, so
+ * a coverage target can be reached after as few scans as possible. Once the
+ * detections cover @a coverageTarget of the total size of the image's code
+ * sections, the remaining files are skipped. The default target of 1.0 can
+ * only be reached by covering the code sections completely, so by default
+ * every file is scanned.
+ *
+ * @param image input file image
+ * @param yaraFiles static code signature files
+ * @param coverageTarget fraction of code section bytes to cover, <0.0, 1.0>
+ */
+void Finder::search(
+	const Image &image,
+	const std::vector<std::string> &yaraFiles,
+	double coverageTarget)
+{
+	if (yaraFiles.empty() || !image.getFileFormat()) {
+		return;
+	}
+
+	// The scans are about to read every loaded segment, so let the OS start
+	// reading their backing pages in already.
+	for (const auto &seg : image.getSegments()) {
+		image.prefetchDataOnAddress(seg->getAddress(), seg->getPhysicalSize());
+	}
+
+	// Materialize the loaded bytes before the threads start reading them --
+	// the lazy getter must not race with itself.
+	image.getFileFormat()->getLoadedBytes();
+
+	// libyara's one-time global initialization is not thread-safe. Creating
+	// a detector here -- and keeping it alive -- makes sure the
+	// initialization is done, and stays done, before detectors get created
+	// and destroyed concurrently.
+	static YaraDetector libyaraInitializer;
+
+	// Order the files by their historical hit counts, best first.
+	std::vector<std::uint64_t> hits(yaraFiles.size());
+	for (std::size_t i = 0; i < yaraFiles.size(); ++i) {
+		hits[i] = readHitStats(yaraFiles[i]);
+	}
+	std::vector<std::size_t> order(yaraFiles.size());
+	for (std::size_t i = 0; i < order.size(); ++i) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(),
+		[&hits](std::size_t i, std::size_t j) {
+			return hits[i] > hits[j];
+		});
+
+	// A zero target -- no code sections or a nonpositive fraction -- would
+	// be reached before scanning anything, so it means no target instead.
+	const auto targetBytes = static_cast<std::uint64_t>(
+		coverageTarget * getCodeSectionsSize(image));
+
+	std::vector<Finder> finders(yaraFiles.size());
+	std::atomic<std::size_t> nextOrderIndex(0);
+	std::atomic<bool> targetReached(false);
+	std::mutex mergeMutex;
+	std::vector<bool> scanned(yaraFiles.size(), false);
+	auto worker = [&]() {
+		while (!targetReached.load()) {
+			const auto o = nextOrderIndex.fetch_add(1);
+			if (o >= order.size()) {
+				break;
+			}
+			const auto i = order[o];
+			finders[i].search(image, yaraFiles[i]);
+
+			// Merge right away, so coverage of the finished files can stop
+			// the remaining ones.
+			std::lock_guard<std::mutex> lock(mergeMutex);
+			scanned[i] = true;
+			for (auto &range : finders[i].coveredCode) {
+				coveredCode.insert(range);
+			}
+			detectedFunctions.insert(detectedFunctions.end(),
+				finders[i].detectedFunctions.begin(),
+				finders[i].detectedFunctions.end());
+
+			if (targetBytes > 0 && !targetReached.load()) {
+				std::uint64_t coveredBytes = 0;
+				for (auto &range : coveredCode) {
+					coveredBytes += range.getSize();
+				}
+				if (coveredBytes >= targetBytes) {
+					targetReached = true;
+				}
+			}
+		}
+	};
+
+	isSorted = false;
+	retdec::utils::runWorkers(yaraFiles.size(), worker);
+
+	// Remember how well each scanned file did, so later runs scan the most
+	// successful files first.
+	for (std::size_t i = 0; i < yaraFiles.size(); ++i) {
+		if (scanned[i]) {
+			addHitStats(yaraFiles[i], finders[i].detectedFunctions.size());
+		}
+	}
+}
+
+
+/**
+ * Resolve references of all detected functions.
+ *
+ * Referenced names are collected across all detections first and resolved
+ * against indexes built in a single pass over the image symbols, imports
+ * and relocations. Probing the image tables once per reference would be
+ * quadratic-ish on binaries with tens of thousands of detections.
+ *
+ * A reference is resolved when the word it marks in the function body holds
+ * the address of an object with the referenced name -- a symbol, an import,
+ * or another detected function -- or when a relocation with the referenced
+ * name patches that word.
+ *
+ * @param image input file image
+ */
+void Finder::resolveReferences(const Image &image)
+{
+	const auto* fileFormat = image.getFileFormat();
+	if (!fileFormat || detectedFunctions.empty()) {
+		return;
+	}
+
+	// Collect all referenced names.
+	std::unordered_set<std::string> referencedNames;
+	for (const auto &detected : detectedFunctions) {
+		for (const auto &reference : detected.references) {
+			referencedNames.insert(reference.name);
+		}
+	}
+	if (referencedNames.empty()) {
+		return;
+	}
+
+	// Index addresses of referenced names -- one pass over the tables.
+	std::unordered_map<std::string, std::set<std::uint64_t>> nameAddresses;
+	for (const auto* symbolTable : fileFormat->getSymbolTables()) {
+		for (const auto &symbol : *symbolTable) {
+			if (referencedNames.count(symbol->getName()) == 0) {
+				continue;
+			}
+			unsigned long long address = 0;
+			if (symbol->getRealAddress(address)) {
+				nameAddresses[symbol->getName()].insert(address);
+			}
+		}
+	}
+	if (const auto* importTable = fileFormat->getImportTable()) {
+		for (const auto &import : *importTable) {
+			if (referencedNames.count(import.getName())) {
+				nameAddresses[import.getName()].insert(import.getAddress());
+			}
+		}
+	}
+	for (const auto &detected : detectedFunctions) {
+		for (const auto &name : detected.names) {
+			if (referencedNames.count(name)) {
+				nameAddresses[name].insert(detected.address);
+			}
+		}
+	}
+
+	// Relocations are indexed by the address they patch.
+	std::unordered_map<std::uint64_t, std::string> relocationNames;
+	for (const auto* relocationTable : fileFormat->getRelocationTables()) {
+		for (const auto &relocation : *relocationTable) {
+			relocationNames.emplace(relocation.getAddress(), relocation.getName());
+		}
+	}
+
+	// Distribute results to the references.
+	for (auto &detected : detectedFunctions) {
+		for (auto &reference : detected.references) {
+			const std::uint64_t referenceAddress
+				= detected.address + reference.offset;
+
+			std::uint64_t target = 0;
+			if (image.getWord(referenceAddress, target)) {
+				reference.target = target;
+			}
+
+			auto nameIt = nameAddresses.find(reference.name);
+			if (nameIt != nameAddresses.end()
+					&& nameIt->second.count(reference.target)) {
+				reference.ok = true;
+				continue;
+			}
+
+			auto relocationIt = relocationNames.find(referenceAddress);
+			if (relocationIt != relocationNames.end()
+					&& relocationIt->second == reference.name) {
+				reference.ok = true;
+			}
+		}
+	}
 }
 
 
@@ -53,7 +53,7 @@ std::string referencesToString(
 {
 	std::string result;
 	for (const auto &ref : references) {
-		result += std::to_string(ref.first) + " " + ref.second + " ";
+		result += std::to_string(ref.offset) + " " + ref.name + " ";
 	}
 
 	return result;
@@ -159,9 +159,8 @@ int doActions(
 
 	// Do search.
 	Finder codeFinder;
-	for (const auto &yaraPath : yaraPaths) {
-		codeFinder.search(*image.get(), yaraPath);
-	}
+	codeFinder.search(*image.get(), yaraPaths);
+	codeFinder.resolveReferences(*image.get());
 
 	// Print detections.
 	if (debugOn) {
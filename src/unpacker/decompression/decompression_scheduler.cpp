@@ -0,0 +1,100 @@
+/**
+ * @file src/unpacker/decompression/decompression_scheduler.cpp
+ * @brief Implementation of scheduler running independent decompression jobs in parallel.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <utility>
+
+#include "retdec/unpacker/decompression/decompression_scheduler.h"
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace unpacker {
+
+/**
+ * Adds a new job to the scheduler. The job is not run until @ref run is called.
+ *
+ * @param job The job to add.
+ */
+void DecompressionScheduler::addJob(Job job)
+{
+	_jobs.push_back(std::move(job));
+}
+
+/**
+ * Returns the number of jobs waiting to be run.
+ *
+ * @return Number of scheduled jobs.
+ */
+std::size_t DecompressionScheduler::getJobCount() const
+{
+	return _jobs.size();
+}
+
+/**
+ * Runs all the scheduled jobs and waits until they finish. Jobs are removed from the
+ * scheduler afterwards, so the scheduler can be reused for another round of jobs.
+ * The workers come from the process-wide concurrency budget; when the budget is
+ * used up, the jobs are run directly on the calling thread.
+ *
+ * @param workerCount Number of worker threads to use. 0 means as many as the
+ *                    concurrency budget allows.
+ */
+void DecompressionScheduler::run(std::size_t workerCount /*= 0*/)
+{
+	if (workerCount == 0)
+		workerCount = _jobs.size();
+
+	workerCount = std::min(workerCount, _jobs.size());
+
+	// The first exception (in the order of job scheduling) thrown by the jobs.
+	// Jobs scheduled behind a failed one are still run - they write only into
+	// their own destination buffers, so it is safe and keeps the logic simple.
+	std::vector<std::exception_ptr> exceptions(_jobs.size());
+
+	std::atomic<std::size_t> nextJob(0);
+	retdec::utils::runWorkers(workerCount, [&]() {
+		while (true)
+		{
+			std::size_t i = nextJob.fetch_add(1);
+			if (i >= _jobs.size())
+				return;
+
+			try
+			{
+				_jobs[i]();
+			}
+			catch (...)
+			{
+				exceptions[i] = std::current_exception();
+			}
+		}
+	});
+
+	_jobs.clear();
+
+	for (auto& exception : exceptions)
+	{
+		if (exception != nullptr)
+			std::rethrow_exception(exception);
+	}
+}
+
+/**
+ * Returns the number of workers matching the number of hardware threads.
+ *
+ * @return Number of hardware threads. At least 1 even if the runtime cannot detect it.
+ */
+std::size_t DecompressionScheduler::hardwareWorkerCount()
+{
+	std::size_t count = std::thread::hardware_concurrency();
+	return count > 0 ? count : 1;
+}
+
+} // namespace unpacker
+} // namespace retdec
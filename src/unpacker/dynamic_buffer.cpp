@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <utility>
+
 #include "retdec/unpacker/dynamic_buffer.h"
 
 using namespace retdec::utils;
@@ -43,6 +45,17 @@ DynamicBuffer::DynamicBuffer(const std::vector<uint8_t>& data, Endianness endian
 {
 }
 
+/**
+ * Creates the DynamicBuffer object taking over the specified data with specified endianness.
+ *
+ * @param data The bytes to initialize the buffer with. The vector is moved from, not copied.
+ * @param endianness Endiannes of the bytes in the buffer.
+ */
+DynamicBuffer::DynamicBuffer(std::vector<uint8_t>&& data, Endianness endianness /*= Endianness::LITTLE*/)
+	: _data(std::move(data)), _endianness(endianness), _capacity(static_cast<uint32_t>(_data.size()))
+{
+}
+
 /**
  * Creates the copy of the DynamicBuffer object.
  *
@@ -53,6 +66,19 @@ DynamicBuffer::DynamicBuffer(const DynamicBuffer& dynamicBuffer)
 {
 }
 
+/**
+ * Creates the DynamicBuffer object by taking over the data of another DynamicBuffer.
+ * The moved-from buffer is left empty with no capacity.
+ *
+ * @param dynamicBuffer Buffer to move from.
+ */
+DynamicBuffer::DynamicBuffer(DynamicBuffer&& dynamicBuffer) noexcept
+	: _data(std::move(dynamicBuffer._data)), _endianness(dynamicBuffer._endianness), _capacity(dynamicBuffer._capacity)
+{
+	dynamicBuffer._data.clear();
+	dynamicBuffer._capacity = 0;
+}
+
 /**
  * Creates the copy of the DynamicBuffer object, but only the specified subbuffer.
  *
@@ -61,13 +87,9 @@ DynamicBuffer::DynamicBuffer(const DynamicBuffer& dynamicBuffer)
  * @param amount Number of bytes from startPos to copy.
  */
 DynamicBuffer::DynamicBuffer(const DynamicBuffer& dynamicBuffer, uint32_t startPos, uint32_t amount)
+	: _data(dynamicBuffer._data.begin() + startPos, dynamicBuffer._data.begin() + startPos + amount),
+	_endianness(dynamicBuffer._endianness), _capacity(amount)
 {
-	std::vector<uint8_t> tmpBuffer = dynamicBuffer.getBuffer();
-	std::vector<uint8_t> buffer(tmpBuffer.begin() + startPos, tmpBuffer.begin() + startPos + amount);
-
-	_data = buffer;
-	_endianness = dynamicBuffer._endianness;
-	_capacity = static_cast<uint32_t>(buffer.size());
 }
 
 /**
@@ -243,5 +265,77 @@ void DynamicBuffer::writeRepeatingByte(uint8_t byte, uint32_t pos, uint32_t repe
 	memset(&_data[pos], byte, repeatAmount);
 }
 
+// BufferView
+
+/**
+ * Creates the view of the whole data of the DynamicBuffer.
+ *
+ * @param buffer Buffer to view.
+ */
+BufferView::BufferView(const DynamicBuffer& buffer) : _data(buffer.getRawBuffer()), _size(buffer.getRealDataSize())
+{
+}
+
+/**
+ * Creates the view of the whole vector of bytes.
+ *
+ * @param data Vector to view.
+ */
+BufferView::BufferView(const std::vector<uint8_t>& data) : _data(data.data()), _size(data.size())
+{
+}
+
+/**
+ * Creates the view of the raw sequence of bytes.
+ *
+ * @param data Pointer to the first viewed byte.
+ * @param size Number of bytes to view.
+ */
+BufferView::BufferView(const uint8_t* data, std::size_t size) : _data(data), _size(size)
+{
+}
+
+/**
+ * Gets the raw pointer to the viewed bytes.
+ *
+ * @return The pointer to the viewed bytes.
+ */
+const uint8_t* BufferView::data() const
+{
+	return _data;
+}
+
+/**
+ * Gets the number of the viewed bytes.
+ *
+ * @return The number of the viewed bytes.
+ */
+std::size_t BufferView::size() const
+{
+	return _size;
+}
+
+/**
+ * Checks whether the view contains any bytes.
+ *
+ * @return True if the view is empty, otherwise false.
+ */
+bool BufferView::empty() const
+{
+	return _size == 0;
+}
+
+/**
+ * Reads the single byte from the view.
+ *
+ * @param pos Position of the byte to read.
+ *
+ * @return The byte at the specified position.
+ */
+uint8_t BufferView::operator [](std::size_t pos) const
+{
+	return _data[pos];
+}
+
 } // namespace unpacker
 } // namespace retdec
@@ -78,6 +78,18 @@ uint64_t Signature::getCaptureSize() const
 	return count;
 }
 
+/**
+ * Returns the signature byte at the specified position.
+ *
+ * @param index Position of the byte in the signature.
+ *
+ * @return Signature byte at the specified position.
+ */
+const Signature::Byte& Signature::getByte(uint64_t index) const
+{
+	return _buffer[index];
+}
+
 /**
  * Matches the signature against the file using the specified settings. Matching is being done on section or segment which contains entry point.
  *
@@ -112,9 +124,9 @@ bool Signature::match(const Signature::MatchSettings& settings, retdec::loader::
 bool Signature::match(const Signature::MatchSettings& settings, const DynamicBuffer& data) const
 {
 	if (settings.isSearch())
-		return searchMatchImpl(data.getBuffer(), settings.getOffset(), settings.getSearchDistance(), nullptr);
+		return searchMatchImpl(BufferView(data), settings.getOffset(), settings.getSearchDistance(), nullptr);
 
-	return (matchImpl(data.getBuffer(), settings.getOffset(), nullptr) == static_cast<int64_t>(getSize()));
+	return (matchImpl(BufferView(data), settings.getOffset(), nullptr) == static_cast<int64_t>(getSize()));
 }
 
 /**
@@ -154,12 +166,12 @@ bool Signature::match(const Signature::MatchSettings& settings, retdec::loader::
 bool Signature::match(const Signature::MatchSettings& settings, const DynamicBuffer& data, DynamicBuffer& capturedData) const
 {
 	if (settings.isSearch())
-		return searchMatchImpl(data.getBuffer(), settings.getOffset(), settings.getSearchDistance(), &capturedData);
+		return searchMatchImpl(BufferView(data), settings.getOffset(), settings.getSearchDistance(), &capturedData);
 
-	return (matchImpl(data.getBuffer(), settings.getOffset(), &capturedData) == static_cast<int64_t>(getSize()));
+	return (matchImpl(BufferView(data), settings.getOffset(), &capturedData) == static_cast<int64_t>(getSize()));
 }
 
-bool Signature::searchMatchImpl(const std::vector<uint8_t>& bytesToMatch, uint64_t offset, uint64_t maxSearchDist, DynamicBuffer* capturedData) const
+bool Signature::searchMatchImpl(const BufferView& bytesToMatch, uint64_t offset, uint64_t maxSearchDist, DynamicBuffer* capturedData) const
 {
 	// Boyer-Moore search over whole bytesToMatch buffer
 	uint64_t searchOffset = 0;
@@ -189,7 +201,7 @@ bool Signature::searchMatchImpl(const std::vector<uint8_t>& bytesToMatch, uint64
 	return false;
 }
 
-int64_t Signature::matchImpl(const std::vector<uint8_t>& bytesToMatch, uint64_t offset, DynamicBuffer* captureBuffer) const
+int64_t Signature::matchImpl(const BufferView& bytesToMatch, uint64_t offset, DynamicBuffer* captureBuffer) const
 {
 	// Bytes to match are not big enough to match this signature
 	if (bytesToMatch.size() - offset < getSize())
@@ -4,29 +4,34 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <iostream>
 #include <regex>
 
 #include "retdec/utils/string.h"
+#include "retdec/fileformat/file_format/file_format.h"
 #include "retdec/unpacker/plugin.h"
 #include "plugin_mgr.h"
 
 #include "plugins/mpress/mpress.h"
 #include "plugins/upx/upx.h"
 
+using namespace retdec::fileformat;
 using namespace retdec::utils;
 
 namespace retdec {
 namespace unpackertool {
 
-const std::vector<Plugin*> PluginMgr::plugins =
+const std::vector<PluginRegistration> PluginMgr::registrations =
 {
-	mpress_plugin,
-	upx_plugin
+	// MPRESS occurs only in PE files and always creates the .MPRESS1 and .MPRESS2 sections.
+	{ "MPRESS", R"/([12]\..{2})/", { Format::PE }, { ".MPRESS1", ".MPRESS2" }, []() -> Plugin* { return mpress_plugin; } },
+	// UPX-packed ELF and Mach-O files contain no sections at all, so no section fingerprint can be used.
+	{ "UPX", R"/(.*)/", { Format::PE, Format::ELF, Format::MACHO }, {}, []() -> Plugin* { return upx_plugin; } }
 };
 
 /**
- * Find the matching plugins in the registered plugins table.
+ * Find the matching plugins in the registered plugins table without any parsed file available.
  *
  * @param packerName The packer name for which the plugins are found.
  * @param packerVersion The packer version for which the plugins are found.
@@ -35,30 +40,85 @@ const std::vector<Plugin*> PluginMgr::plugins =
  */
 PluginList PluginMgr::matchingPlugins(const std::string& packerName, const std::string& packerVersion)
 {
-	// Iterate over all plugins for this packer name and match it against the used packer version
-	PluginList matchedPlugins;
-	for (const auto& plugin : plugins)
+	return matchingPlugins(nullptr, packerName, packerVersion);
+}
+
+/**
+ * Find the matching plugins in the registered plugins table. The preconditions of every
+ * registration are checked against the parsed input file first, so plugins that cannot
+ * possibly unpack the file are never constructed.
+ *
+ * @param fileFormat The parsed input file. May be @c nullptr if no parsed file is available.
+ * @param packerName The packer name for which the plugins are found.
+ * @param packerVersion The packer version for which the plugins are found.
+ *
+ * @return The list of matched plugins.
+ */
+PluginList PluginMgr::matchingPlugins(const retdec::fileformat::FileFormat* fileFormat,
+		const std::string& packerName, const std::string& packerVersion)
+{
+	// Iterate over all registrations for this packer name and match them against the used packer version
+	PluginList result;
+	for (const auto& registration : registrations)
 	{
-		if (!utils::areEqualCaseInsensitive(plugin->getInfo()->name, packerName))
+		if (!utils::areEqualCaseInsensitive(registration.packerName, packerName))
+			continue;
+
+		// For wildcard just accept the all versions of this packer
+		if (packerVersion != WILDCARD_ALL_VERSIONS)
+		{
+			// Non case-sensitive regular expressions to match against packerVersion
+			std::regex versionRegex(registration.packerVersion, std::regex::icase);
+			if (!std::regex_search(packerVersion, versionRegex))
+				continue;
+		}
+
+		if (!checkPreconditions(fileFormat, registration))
 			continue;
 
-		matchedPlugins.push_back(plugin);
+		// All preconditions hold, the plugin object may now be constructed
+		result.push_back(registration.create());
 	}
 
-	// For wildcard just return the all versions of this packers
-	if (packerVersion == WILDCARD_ALL_VERSIONS)
-		return matchedPlugins;
+	return result;
+}
 
-	PluginList result;
-	for (const auto& plugin : matchedPlugins)
+/**
+ * Checks the cheap static preconditions of the registration against the parsed input file.
+ *
+ * @param fileFormat The parsed input file. May be @c nullptr if no parsed file is available.
+ * @param registration The registration to check.
+ *
+ * @return @c true if all preconditions hold, otherwise @c false.
+ */
+bool PluginMgr::checkPreconditions(const retdec::fileformat::FileFormat* fileFormat, const PluginRegistration& registration)
+{
+	// Without the parsed file there is nothing to check
+	if (fileFormat == nullptr)
+		return true;
+
+	if (!registration.formats.empty()
+			&& std::find(registration.formats.begin(), registration.formats.end(),
+					fileFormat->getFileFormat()) == registration.formats.end())
+		return false;
+
+	if (!registration.sectionNames.empty())
 	{
-		// Non case-sensitive regular expressions to match against packerVersion
-		std::regex versionRegex(plugin->getInfo()->packerVersion, std::regex::icase);
-		if (std::regex_search(packerVersion, versionRegex))
-			result.push_back(plugin);
+		bool sectionFound = false;
+		for (const auto& sectionName : registration.sectionNames)
+		{
+			if (fileFormat->getSection(sectionName) != nullptr)
+			{
+				sectionFound = true;
+				break;
+			}
+		}
+
+		if (!sectionFound)
+			return false;
 	}
 
-	return result;
+	return true;
 }
 
 } // namepsace unpackertool
@@ -13,7 +13,16 @@
 #include <string>
 #include <vector>
 
+#include "retdec/fileformat/fftypes.h"
+
 namespace retdec {
+
+namespace fileformat {
+
+class FileFormat;
+
+} // namespace fileformat
+
 namespace unpackertool {
 
 #define WILDCARD_ALL_VERSIONS   ""
@@ -22,28 +31,51 @@ class Plugin;
 
 using PluginList = std::vector<Plugin*>; ///< Type for list of plugins.
 
+/**
+ * @brief Registration record of an unpacking plugin.
+ *
+ * Holds the cheap static preconditions of a plugin together with a factory
+ * that creates the plugin object. The preconditions are evaluated against
+ * the already parsed input file before the plugin object is even constructed,
+ * so plugins that cannot possibly unpack the file do not pay their
+ * construction cost.
+ */
+struct PluginRegistration
+{
+	std::string packerName; ///< Name of the packer, matched case-insensitively against the detected packer name.
+	std::string packerVersion; ///< Regular expression of packer versions the plugin supports.
+	std::vector<retdec::fileformat::Format> formats; ///< File formats the plugin supports. Empty means any format.
+	std::vector<std::string> sectionNames; ///< Section names typical for the packer. At least one has to be present in the file. Empty means no fingerprint.
+	Plugin* (*create)(); ///< Factory of the plugin object. Called only after all preconditions hold.
+};
+
 /**
  * @brief The manager of unpacking plugins.
  *
  * PluginMgr is static representing the plugin manager.
- * It stores all active plugins. It can also find the
+ * It stores the registrations of all active plugins. It can also find the
  * matching plugins for the specified plugin packer and version.
  * Packer name is case-insesitively matched against packer specified
- * in metadata of the plugin. Every plugin aso contains the
- * regular expression matching the version of packers it is
- * able to unpack.
+ * in the registration of the plugin. Every registration also contains the
+ * regular expression matching the version of packers the plugin is
+ * able to unpack. Plugin objects themselves are created lazily, only
+ * after all preconditions in their registration hold.
  */
 class PluginMgr
 {
 public:
 	PluginMgr(const PluginMgr&) = delete;
 
-	static const PluginList plugins;
+	static const std::vector<PluginRegistration> registrations;
 
 	static PluginList matchingPlugins(const std::string& packerName, const std::string& packerVersion);
+	static PluginList matchingPlugins(const retdec::fileformat::FileFormat* fileFormat,
+			const std::string& packerName, const std::string& packerVersion);
 
 private:
 	PluginMgr() = default;
+
+	static bool checkPreconditions(const retdec::fileformat::FileFormat* fileFormat, const PluginRegistration& registration);
 };
 
 } // namespace unpackertool
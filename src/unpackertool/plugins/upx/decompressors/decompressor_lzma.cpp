@@ -199,7 +199,7 @@ void DecompressorLzma::readUnpackingStub(PeUpxStub<32>* stub, DynamicBuffer& unp
 	std::vector<std::uint8_t> unpackingStubBytes;
 	stub->getFile()->getEpSegment()->getBytes(unpackingStubBytes, epOffset, stub->getFile()->getEpSegment()->getSize() - epOffset);
 
-	unpackingStub = DynamicBuffer(unpackingStubBytes, stub->getFile()->getFileFormat()->getEndianness());
+	unpackingStub = DynamicBuffer(std::move(unpackingStubBytes), stub->getFile()->getFileFormat()->getEndianness());
 }
 
 /**
@@ -232,7 +232,7 @@ void DecompressorLzma::readPackedData(PeUpxStub<32>* stub, DynamicBuffer& packed
 	std::vector<std::uint8_t> packedDataBytes;
 	stub->getFile()->getEpSegment()->getBytes(packedDataBytes, packedDataOffset, packedDataSize);
 
-	packedData = DynamicBuffer(packedDataBytes, stub->getFile()->getFileFormat()->getEndianness());
+	packedData = DynamicBuffer(std::move(packedDataBytes), stub->getFile()->getFileFormat()->getEndianness());
 }
 
 /**
@@ -291,7 +291,7 @@ void DecompressorLzma::readUnpackingStub(PeUpxStub<64>* stub, DynamicBuffer& unp
 	std::vector<std::uint8_t> unpackingStubBytes;
 	stub->getFile()->getEpSegment()->getBytes(unpackingStubBytes, epOffset, stub->getFile()->getEpSegment()->getSize() - epOffset);
 
-	unpackingStub = DynamicBuffer(unpackingStubBytes, stub->getFile()->getFileFormat()->getEndianness());
+	unpackingStub = DynamicBuffer(std::move(unpackingStubBytes), stub->getFile()->getFileFormat()->getEndianness());
 }
 
 /**
@@ -325,7 +325,7 @@ void DecompressorLzma::readPackedData(PeUpxStub<64>* stub, DynamicBuffer& packed
 	std::vector<std::uint8_t> packedDataBytes;
 	stub->getFile()->getEpSegment()->getBytes(packedDataBytes, packedDataOffset, packedDataSize);
 
-	packedData = DynamicBuffer(packedDataBytes, stub->getFile()->getFileFormat()->getEndianness());
+	packedData = DynamicBuffer(std::move(packedDataBytes), stub->getFile()->getFileFormat()->getEndianness());
 }
 
 /**
@@ -152,7 +152,7 @@ void DecompressorNrv::readUnpackingStub(PeUpxStub<32>* stub, DynamicBuffer& unpa
 	std::vector<std::uint8_t> unpackingStubBytes;
 	stub->getFile()->getEpSegment()->getBytes(unpackingStubBytes, epOffset, stub->getFile()->getEpSegment()->getSize() - epOffset);
 
-	unpackingStub = DynamicBuffer(unpackingStubBytes, stub->getFile()->getFileFormat()->getEndianness());
+	unpackingStub = DynamicBuffer(std::move(unpackingStubBytes), stub->getFile()->getFileFormat()->getEndianness());
 }
 
 /**
@@ -189,7 +189,7 @@ void DecompressorNrv::readPackedData(PeUpxStub<32>* stub, DynamicBuffer& packedD
 	std::vector<std::uint8_t> packedDataBytes;
 	stub->getFile()->getEpSegment()->getBytes(packedDataBytes, packedDataOffset, packedDataSize);
 
-	packedData = DynamicBuffer(packedDataBytes, stub->getFile()->getFileFormat()->getEndianness());
+	packedData = DynamicBuffer(std::move(packedDataBytes), stub->getFile()->getFileFormat()->getEndianness());
 
 	// Stub is modified and contains rewrite dword modification
 	// We need to take a dword and rewrite it in the packed data
@@ -262,7 +262,7 @@ void DecompressorNrv::readUnpackingStub(PeUpxStub<64>* stub, DynamicBuffer& unpa
 	std::vector<std::uint8_t> unpackingStubBytes;
 	stub->getFile()->getEpSegment()->getBytes(unpackingStubBytes, epOffset, stub->getFile()->getEpSegment()->getSize() - epOffset);
 
-	unpackingStub = DynamicBuffer(unpackingStubBytes, stub->getFile()->getFileFormat()->getEndianness());
+	unpackingStub = DynamicBuffer(std::move(unpackingStubBytes), stub->getFile()->getFileFormat()->getEndianness());
 }
 
 /**
@@ -300,7 +300,7 @@ void DecompressorNrv::readPackedData(PeUpxStub<64>* stub, DynamicBuffer& packedD
 	std::vector<std::uint8_t> packedDataBytes;
 	stub->getFile()->getEpSegment()->getBytes(packedDataBytes, packedDataOffset, packedDataSize);
 
-	packedData = DynamicBuffer(packedDataBytes, stub->getFile()->getFileFormat()->getEndianness());
+	packedData = DynamicBuffer(std::move(packedDataBytes), stub->getFile()->getFileFormat()->getEndianness());
 
 	// Stub is modified and contains rewrite dword modification
 	// We need to take a dword and rewrite it in the packed data
@@ -18,6 +18,7 @@
 #include "unpackertool/plugins/upx/upx.h"
 #include "unpackertool/plugins/upx/upx_exceptions.h"
 #include "unpackertool/plugins/upx/upx_stub_signatures.h"
+#include "retdec/unpacker/decompression/decompression_scheduler.h"
 #include "retdec/unpacker/dynamic_buffer.h"
 
 using namespace retdec::unpacker;
@@ -97,22 +98,71 @@ template <int bits> void ElfUpxStub<bits>::unpack(const std::string& outputFile)
 	//  are sometimes not packed
 	std::uint32_t initialOffset = originalHeaderData.getCapacity();
 
+	// Discover all packed blocks first. Blocks are stored in the file one after another,
+	// so their offsets can be obtained just by walking over the block headers without
+	// decompressing anything.
+	// It seems that only PT_LOAD segments are packed, other segments are joined to them, but header is kept
+	struct PackedBlock
+	{
+		DynamicBuffer packedBlock; ///< Packed block together with its header.
+		DynamicBuffer unpackedData; ///< Destination buffer of the block.
+		std::uint32_t progHeaderIndex; ///< Index of the associated program header.
+	};
+	std::vector<PackedBlock> packedBlocks;
+
 	for (std::uint32_t i = 0; i < originalHeader.e_phnum; ++i)
 	{
-		// It seems that only PT_LOAD segments are packed, other segments are joined to them, but header is kept
 		if (originalProgHeaders[i].p_type != PT_LOAD)
 			continue;
 
-		AddressType segReadPos;
-		DynamicBuffer unpackedData(_file->getFileFormat()->getEndianness());
-
 		upx_plugin->log("Unpacking block at file offset 0x", std::hex, firstBlockOffset + readPos, std::dec, ".");
-		unpackBlock(unpackedData, firstBlockOffset + readPos, segReadPos, originalProgHeaders[i].p_filesz);
 
-		retdec::utils::writeFile(output, unpackedData.getBuffer(), initialOffset + originalProgHeaders[i].p_offset);
+		// First extract the packed and unpacked sizes of block from the file
+		// They should be in the first 8 bytes of the block
+		std::vector<std::uint8_t> blockSizesBytes;
+		_file->getEpSegment()->getBytes(blockSizesBytes, firstBlockOffset + readPos, 8);
+
+		DynamicBuffer blockSizes(std::move(blockSizesBytes), _file->getFileFormat()->getEndianness());
+		std::uint32_t unpackedDataSize = blockSizes.read<std::uint32_t>(0);
+		std::uint32_t packedDataSize = blockSizes.read<std::uint32_t>(4);
+
+		// Unpacked data can't be smaller or even 0
+		if (packedDataSize == 0 || unpackedDataSize == 0 || unpackedDataSize < packedDataSize)
+			throw FatalException("Invalid block found.");
+
+		// Read the whole block together with its header
+		std::vector<std::uint8_t> packedBlockBytes;
+		_file->getEpSegment()->getBytes(packedBlockBytes, firstBlockOffset + readPos, PackedBlockHeaderSize + packedDataSize);
 
+		PackedBlock packedBlock = { DynamicBuffer(std::move(packedBlockBytes), _file->getFileFormat()->getEndianness()),
+				DynamicBuffer(_file->getFileFormat()->getEndianness()), i };
+		packedBlocks.push_back(std::move(packedBlock));
+
+		readPos += PackedBlockHeaderSize + packedDataSize;
+	}
+
+	// Blocks don't depend on each other, so they can be decompressed concurrently,
+	// every job writing only into its own destination buffer.
+	DecompressionScheduler scheduler;
+	for (auto& block : packedBlocks)
+	{
+		scheduler.addJob([this, &block, &originalProgHeaders]() {
+				unpackBlockConcurrent(block.unpackedData, block.packedBlock, originalProgHeaders[block.progHeaderIndex].p_filesz);
+			});
+	}
+	scheduler.run();
+
+	for (auto& block : packedBlocks)
+	{
+		// Report the unfiltering of decompressed blocks here to keep the log in the block order
+		if (block.packedBlock.read<std::uint32_t>(4) < block.packedBlock.read<std::uint32_t>(0))
+		{
+			upx_plugin->log("Unfiltering filter 0x", std::hex, static_cast<std::uint32_t>(block.packedBlock.read<std::uint8_t>(9)), std::dec,
+					" with parameter ", static_cast<std::uint32_t>(block.packedBlock.read<std::uint8_t>(10)), ".");
+		}
+
+		retdec::utils::writeFile(output, block.unpackedData.getBuffer(), initialOffset + originalProgHeaders[block.progHeaderIndex].p_offset);
 		initialOffset = 0;
-		readPos += segReadPos;
 	}
 
 	// We need to do this hack, because UPX doesn't map its whole content to the segments
@@ -363,7 +413,7 @@ template <int bits> void ElfUpxStub<bits>::unpackBlock(DynamicBuffer& unpackedDa
 	// Read the whole block together with its header
 	std::vector<std::uint8_t> packedBlockBytes;
 	_file->getEpSegment()->getBytes(packedBlockBytes, fileOffset, PackedBlockHeaderSize + packedDataSize);
-	DynamicBuffer packedBlock = DynamicBuffer(packedBlockBytes, _file->getFileFormat()->getEndianness());
+	DynamicBuffer packedBlock = DynamicBuffer(std::move(packedBlockBytes), _file->getFileFormat()->getEndianness());
 
 	// Unpack the block using the in-memory method overload
 	unpackBlock(unpackedData, packedBlock, readFromBlock, sizeHint);
@@ -417,6 +467,56 @@ template <int bits> void ElfUpxStub<bits>::unpackBlock(DynamicBuffer& unpackedDa
 	readFromBlock = packedDataSize + PackedBlockHeaderSize;
 }
 
+/**
+ * Unpacks the packed block that is stored in the @ref retdec::unpacker::DynamicBuffer. Unlike
+ * @ref unpackBlock, this method doesn't touch any state shared between blocks - the packing
+ * method is decided with a block-local decompressor and nothing is logged - so independent
+ * blocks can be unpacked concurrently through @ref retdec::unpacker::DecompressionScheduler.
+ *
+ * @tparam bits Number of bits of the architecture.
+ *
+ * @param unpackedData Buffer where to unpack the block.
+ * @param packedBlock Buffer that contains packed block.
+ * @param sizeHint Potentional size of the unpacked data. The size of unpacked data is determinted by comparing this value with the
+ *      data written in packed block header. Higher value is chosen.
+ */
+template <int bits> void ElfUpxStub<bits>::unpackBlockConcurrent(DynamicBuffer& unpackedData, DynamicBuffer& packedBlock, std::uint32_t sizeHint /*= 0*/)
+{
+	std::uint32_t unpackedDataSize = packedBlock.read<std::uint32_t>(0);
+	std::uint32_t packedDataSize = packedBlock.read<std::uint32_t>(4);
+
+	// Unpacked data can't be smaller or even 0
+	if (!validBlock(packedBlock))
+		throw FatalException("Invalid block found.");
+
+	// Read the packed data (without header) from the single block as packedBlock may contain more blocks joined together
+	DynamicBuffer packedData = DynamicBuffer(packedBlock, PackedBlockHeaderSize, packedDataSize);
+
+	// sizeHint comes from original ELF program headers, it is a size of segment
+	// There are few samples where segment is bigger than size reported in block header
+	// We use this hint if program header reportrs bigger size
+	unpackedData.setCapacity(std::max(unpackedDataSize, sizeHint));
+
+	// Decompress the data only if the size of packed data is less than size of unpacked data
+	// If they are equal the data are not packed
+	if (packedDataSize < unpackedDataSize)
+	{
+		// Every block carries its own packing method, so decompress with a block-local decompressor
+		std::uint8_t packingMethod = packedBlock.read<std::uint8_t>(8);
+		auto decompressor = decodePackingMethod(packingMethod);
+		decompressor->setupPackingMethod(this, packingMethod);
+		decompressor->decompress(this, packedData, unpackedData);
+
+		// Unfilter jumps
+		std::uint8_t filterId = packedBlock.read<std::uint8_t>(9);
+		std::uint8_t filterParam = packedBlock.read<std::uint8_t>(10);
+		if (!Unfilter::run(unpackedData, filterId, filterParam))
+			throw UnsupportedFilterException(filterId);
+	}
+	else
+		unpackedData = packedData;
+}
+
 /**
  * Finds the gap between two following LOAD segments in the original ELF header. Headers are searched circullary
  * starting from the specified segment.
@@ -441,7 +441,7 @@ template <int bits> void PeUpxStub<bits>::readPackedFileILT(DynamicBuffer& ilt)
 			_newPeFile->peHeader().rvaToOffset(_newPeFile->peHeader().getIddImportRva()) - importsSection->getSecSeg()->getOffset(),
 			_newPeFile->peHeader().getIddImportSize());
 
-	ilt = DynamicBuffer(iltBytes, _file->getFileFormat()->getEndianness());
+	ilt = DynamicBuffer(std::move(iltBytes), _file->getFileFormat()->getEndianness());
 }
 
 /**
@@ -865,7 +865,7 @@ template <int bits> void PeUpxStub<bits>::fixExports(const retdec::unpacker::Dyn
 	// Load export data into buffer
 	std::vector<std::uint8_t> exportsDataBytes;
 	exportsSection->getBytes(exportsDataBytes, exportsOffset, exportsSection->getSize() - exportsOffset);
-	DynamicBuffer exportsData(exportsDataBytes, _file->getFileFormat()->getEndianness());
+	DynamicBuffer exportsData(std::move(exportsDataBytes), _file->getFileFormat()->getEndianness());
 
 	if (PeLib::PELIB_IMAGE_EXPORT_DIRECTORY::size() >= exportsData.getRealDataSize())
 		throw InvalidDataDirectoryException("Exports");
@@ -984,7 +984,7 @@ template <int bits> void PeUpxStub<bits>::fixResources(const DynamicBuffer& unpa
 		throw InvalidDataDirectoryException("Resources");
 
 	sect->getBytes(uncompressedRsrcsBytes, 0, sect->getSize());
-	DynamicBuffer uncompressedRsrcs(uncompressedRsrcsBytes, _file->getFileFormat()->getEndianness());
+	DynamicBuffer uncompressedRsrcs(std::move(uncompressedRsrcsBytes), _file->getFileFormat()->getEndianness());
 
 	std::unordered_set<std::uint32_t> visitedNodes;
 	loadResources(_newPeFile->resDir().getRoot(), 0, uncompressedRsrcRva, compressedRsrcRva, uncompressedRsrcs, unpackedData, visitedNodes);
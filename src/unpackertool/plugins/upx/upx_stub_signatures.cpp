@@ -4,6 +4,10 @@
  * @copyright AVG Technologies s.r.o, All Rights Reserve
  */
 
+#include <algorithm>
+#include <map>
+#include <utility>
+
 #include "unpackertool/plugins/upx/upx_stub_signatures.h"
 
 using namespace retdec::fileformat;
@@ -1725,10 +1729,214 @@ std::vector<UpxStubData> UpxStubSignatures::allStubs =
 	{ Architecture::X86,    Format::PE,     &pushaNop_x86PeNrv2bSignature,      UpxStubVersion::NRV2B,   0xCB,  0x0 }
 };
 
+namespace {
+
+/**
+ * Automaton built over the signatures of all unpacking stubs in @ref UpxStubSignatures::allStubs.
+ * Instead of trying the stub signatures one after another, all of them are compiled into a single
+ * byte-trie and the entry-point bytes are walked just once, no matter how many stub variants exist.
+ *
+ * Exact signature bytes become regular trie edges. Wildcard and capture bytes become mask edges
+ * (expected value + wildcard mask), so several trie nodes can be active at once and the walk is
+ * effectively a run of a small NFA. Every leaf remembers the index of its stub in the signature
+ * table, so the first stub in table order still wins, exactly as the sequential matching did.
+ */
+class SignatureTrie
+{
+public:
+	SignatureTrie(const std::vector<UpxStubData>& stubs) : _stubs(stubs)
+	{
+		_nodes.emplace_back();
+		for (std::uint32_t i = 0; i < _stubs.size(); ++i)
+			insert(*_stubs[i].signature, i);
+	}
+
+	/**
+	 * Returns the maximum number of bytes any signature can inspect, including its
+	 * search distance. This many bytes need to be loaded from the entry-point
+	 * section or segment before the walk.
+	 */
+	std::uint64_t getMaxMatchLength() const
+	{
+		return _maxMatchLength;
+	}
+
+	/**
+	 * Walks the data once and finds the matching stub with the lowest index in the signature
+	 * table. For a single stub, the leftmost matching offset wins, mirroring the searching
+	 * behavior of Signature::match with a non-zero search distance.
+	 *
+	 * @param data Data to walk, starting at the entry point.
+	 * @param architecture Architecture of the file. Architecture::UNKNOWN matches any stub.
+	 * @param format File format of the file. Format::UNKNOWN matches any stub.
+	 * @param matchOffset Offset of the match from the beginning of @a data.
+	 *
+	 * @return Matched stub, or @c nullptr if no signature matched.
+	 */
+	const UpxStubData* findMatch(const std::vector<std::uint8_t>& data, Architecture architecture,
+			Format format, std::uint64_t& matchOffset) const
+	{
+		std::uint32_t bestIndex = static_cast<std::uint32_t>(_stubs.size());
+		std::uint64_t bestOffset = 0;
+
+		// Active trie nodes paired with the offset their walk started at. One position
+		// of the input can extend walks started at several previous offsets.
+		std::vector<std::pair<std::uint32_t, std::uint64_t>> states, nextStates;
+
+		for (std::uint64_t pos = 0; pos < data.size(); ++pos)
+		{
+			// Signatures with a search distance can also start further from the entry point.
+			if (pos == 0 || pos < _maxSearchDistance)
+				states.emplace_back(0, pos);
+
+			std::uint8_t byte = data[pos];
+
+			nextStates.clear();
+			for (const auto& state : states)
+			{
+				const Node& node = _nodes[state.first];
+
+				auto exactItr = node.exactChildren.find(byte);
+				if (exactItr != node.exactChildren.end())
+					advance(exactItr->second, state.second, architecture, format, bestIndex, bestOffset, nextStates);
+
+				for (const auto& edge : node.maskChildren)
+				{
+					if ((byte & ~edge.wildcardMask) == edge.expectedValue)
+						advance(edge.child, state.second, architecture, format, bestIndex, bestOffset, nextStates);
+				}
+			}
+
+			states.swap(nextStates);
+			if (states.empty() && pos + 1 >= _maxSearchDistance)
+				break;
+		}
+
+		if (bestIndex == _stubs.size())
+			return nullptr;
+
+		matchOffset = bestOffset;
+		return &_stubs[bestIndex];
+	}
+
+private:
+	/**
+	 * Edge taken by any byte that has the expected value on the non-wildcarded bits.
+	 */
+	struct MaskEdge
+	{
+		std::uint8_t expectedValue; ///< Expected value of the non-wildcarded bits.
+		std::uint8_t wildcardMask; ///< Bits set to 1 match any value.
+		std::uint32_t child; ///< Index of the target node.
+	};
+
+	struct Node
+	{
+		std::map<std::uint8_t, std::uint32_t> exactChildren; ///< Edges taken by exactly one byte value.
+		std::vector<MaskEdge> maskChildren; ///< Edges with wildcarded bits.
+		std::vector<std::uint32_t> leaves; ///< Signature table indices of stubs ending in this node.
+	};
+
+	SignatureTrie(const SignatureTrie&);
+	SignatureTrie& operator =(const SignatureTrie&);
+
+	void insert(const Signature& signature, std::uint32_t stubIndex)
+	{
+		std::uint32_t nodeIndex = 0;
+		for (std::uint64_t i = 0; i < signature.getSize(); ++i)
+		{
+			const Signature::Byte& sigByte = signature.getByte(i);
+			if (sigByte.getWildcardMask() == 0x00)
+			{
+				auto itr = _nodes[nodeIndex].exactChildren.find(sigByte.getExpectedValue());
+				if (itr == _nodes[nodeIndex].exactChildren.end())
+				{
+					_nodes.emplace_back();
+					itr = _nodes[nodeIndex].exactChildren.emplace(
+							sigByte.getExpectedValue(), static_cast<std::uint32_t>(_nodes.size() - 1)).first;
+				}
+				nodeIndex = itr->second;
+			}
+			else
+			{
+				std::uint32_t childIndex = 0;
+				for (const MaskEdge& edge : _nodes[nodeIndex].maskChildren)
+				{
+					if (edge.expectedValue == sigByte.getExpectedValue() && edge.wildcardMask == sigByte.getWildcardMask())
+					{
+						childIndex = edge.child;
+						break;
+					}
+				}
+				if (childIndex == 0)
+				{
+					_nodes.emplace_back();
+					childIndex = static_cast<std::uint32_t>(_nodes.size() - 1);
+					_nodes[nodeIndex].maskChildren.push_back(
+							{ sigByte.getExpectedValue(), sigByte.getWildcardMask(), childIndex });
+				}
+				nodeIndex = childIndex;
+			}
+		}
+
+		_nodes[nodeIndex].leaves.push_back(stubIndex);
+		_maxMatchLength = std::max(_maxMatchLength, signature.getSize() + _stubs[stubIndex].searchDistance);
+		_maxSearchDistance = std::max<std::uint64_t>(_maxSearchDistance, _stubs[stubIndex].searchDistance);
+	}
+
+	void advance(std::uint32_t nodeIndex, std::uint64_t startOffset, Architecture architecture,
+			Format format, std::uint32_t& bestIndex, std::uint64_t& bestOffset,
+			std::vector<std::pair<std::uint32_t, std::uint64_t>>& nextStates) const
+	{
+		const Node& node = _nodes[nodeIndex];
+
+		// Walks start at ascending offsets, so the first hit of a leaf comes from
+		// the leftmost matching offset of its stub.
+		for (std::uint32_t stubIndex : node.leaves)
+		{
+			const UpxStubData& stubData = _stubs[stubIndex];
+			if ((architecture != Architecture::UNKNOWN && stubData.architecture != architecture)
+					|| (format != Format::UNKNOWN && stubData.format != format))
+				continue;
+
+			// Stubs without a search distance match only right at the entry point.
+			if (startOffset != 0 && startOffset >= stubData.searchDistance)
+				continue;
+
+			if (stubIndex < bestIndex)
+			{
+				bestIndex = stubIndex;
+				bestOffset = startOffset;
+			}
+		}
+
+		if (!node.exactChildren.empty() || !node.maskChildren.empty())
+			nextStates.emplace_back(nodeIndex, startOffset);
+	}
+
+	const std::vector<UpxStubData>& _stubs; ///< Signature table the trie is built over.
+	std::vector<Node> _nodes; ///< All nodes of the trie. Node 0 is the root.
+	std::uint64_t _maxMatchLength = 0; ///< Maximum signature size plus search distance.
+	std::uint64_t _maxSearchDistance = 0; ///< Maximum search distance over all stubs.
+};
+
+/**
+ * Returns the signature trie built over the given signature table. The trie is built
+ * just once, when the first file is matched, and shared by all subsequent matches.
+ */
+const SignatureTrie& getSignatureTrie(const std::vector<UpxStubData>& stubs)
+{
+	static SignatureTrie trie(stubs);
+	return trie;
+}
+
+} // anonymous namespace
+
 /**
  * Matches all supported signatures against the input packed file at its entry point. In the case of
  * non-matched signature with searchDistance greather than 0, the searching of the signature is performed
- * up to searchDistance from the entry point.
+ * up to searchDistance from the entry point. All signatures are matched in a single pass over the
+ * entry-point bytes using a trie built over the whole signature table.
  *
  * @param file The input packed file.
  * @param captureData Data to capture from the signature.
@@ -1740,6 +1948,10 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 	Architecture architecture = file->getFileFormat()->getTargetArchitecture();
 	Format format = file->getFileFormat()->getFileFormat();
 
+	// No unpacking stub is declared for an unknown architecture or file format.
+	if (architecture == Architecture::UNKNOWN || format == Format::UNKNOWN)
+		return nullptr;
+
 	// Find out whether file has entry point section or segment
 	const retdec::loader::Segment* epSeg = file->getEpSegment();
 	if (epSeg == nullptr)
@@ -1750,27 +1962,31 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 	file->getFileFormat()->getEpAddress(ep);
 	ep -= epSeg->getAddress();
 
-	for (const UpxStubData& stubData : allStubs)
-	{
-		if (stubData.architecture != architecture || stubData.format != format)
-			continue;
+	const SignatureTrie& trie = getSignatureTrie(allStubs);
 
-		Signature::MatchSettings settings(ep, stubData.searchDistance);
-		DynamicBuffer localCaptureData(file->getFileFormat()->getEndianness());
-		if (stubData.signature->match(settings, file, localCaptureData))
-		{
-			captureData = localCaptureData;
-			return &stubData;
-		}
-	}
+	std::vector<std::uint8_t> bytesToMatch;
+	epSeg->getBytes(bytesToMatch, ep, trie.getMaxMatchLength());
+
+	std::uint64_t matchOffset = 0;
+	const UpxStubData* stubData = trie.findMatch(bytesToMatch, architecture, format, matchOffset);
+	if (stubData == nullptr)
+		return nullptr;
+
+	// The capture bytes are extracted by the matched signature itself, anchored at the found offset.
+	Signature::MatchSettings settings(ep + matchOffset, 0);
+	DynamicBuffer localCaptureData(file->getFileFormat()->getEndianness());
+	if (!stubData->signature->match(settings, file, localCaptureData))
+		return nullptr;
 
-	return nullptr;
+	captureData = std::move(localCaptureData);
+	return stubData;
 }
 
 /**
  * Matches all supported signatures against the data buffer from its beginning. In the case of
  * non-matched signature with searchDistance greather than 0, the searching of the signature is performed
- * up to searchDistance from the its beginning.
+ * up to searchDistance from the its beginning. All signatures are matched in a single pass over the
+ * buffer using a trie built over the whole signature table.
  *
  * @param data The input data buffer.
  * @param captureData Data to capture from the signature.
@@ -1782,22 +1998,21 @@ const UpxStubData* UpxStubSignatures::matchSignatures(Image* file, DynamicBuffer
 const UpxStubData* UpxStubSignatures::matchSignatures(const DynamicBuffer& data, DynamicBuffer& captureData,
 		retdec::fileformat::Architecture architecture /*= Architecture::UNKNOWN*/, retdec::fileformat::Format format /*= Format::UNKNOWN*/)
 {
-	for (const UpxStubData& stubData : allStubs)
-	{
-		if ((architecture != Architecture::UNKNOWN && stubData.architecture != architecture)
-				|| (format != Format::UNKNOWN && stubData.format != format))
-			continue;
+	const SignatureTrie& trie = getSignatureTrie(allStubs);
 
-		Signature::MatchSettings settings(0, stubData.searchDistance);
-		DynamicBuffer localCaptureData(data.getEndianness());
-		if (stubData.signature->match(settings, data, localCaptureData))
-		{
-			captureData = localCaptureData;
-			return &stubData;
-		}
-	}
+	std::uint64_t matchOffset = 0;
+	const UpxStubData* stubData = trie.findMatch(data.getBuffer(), architecture, format, matchOffset);
+	if (stubData == nullptr)
+		return nullptr;
+
+	// The capture bytes are extracted by the matched signature itself, anchored at the found offset.
+	Signature::MatchSettings settings(matchOffset, 0);
+	DynamicBuffer localCaptureData(data.getEndianness());
+	if (!stubData->signature->match(settings, data, localCaptureData))
+		return nullptr;
 
-	return nullptr;
+	captureData = std::move(localCaptureData);
+	return stubData;
 }
 
 } // namespace upx
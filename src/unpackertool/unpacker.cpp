@@ -29,7 +29,8 @@ enum ExitCode
 	EXIT_CODE_PREPROCESSING_ERROR ///< Error with preprocessing of input file before unpacking.
 };
 
-bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+bool detectPackers(const std::string& inputFile, std::unique_ptr<retdec::fileformat::FileFormat>& fileParser,
+		std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
 {
 	using namespace retdec::cpdetect;
 	using namespace retdec::fileformat;
@@ -47,7 +48,7 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 			return false;
 		default:
 		{
-			auto fileParser = createFileFormat(inputFile);
+			fileParser = createFileFormat(inputFile);
 			if (!fileParser)
 			{
 				std::cerr << "Error while detecting format of file '" << inputFile << "'! Please, report this." << std::endl;
@@ -70,14 +71,15 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 	return true;
 }
 
-ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile, bool brute, const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile, bool brute,
+		const retdec::fileformat::FileFormat* fileFormat, const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
 {
 	Plugin::Arguments pluginArgs = { inputFile, outputFile, brute };
 
 	ExitCode ret = EXIT_CODE_NOTHING_TO_DO;
 	for (const auto& detectedPacker : detectedPackers)
 	{
-		PluginList plugins = PluginMgr::matchingPlugins(detectedPacker.name, detectedPacker.versionInfo);
+		PluginList plugins = PluginMgr::matchingPlugins(fileFormat, detectedPacker.name, detectedPacker.versionInfo);
 
 		if (plugins.empty())
 		{
@@ -125,9 +127,9 @@ ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 	{
 		std::cout << "List of available plugins:" << std::endl;
 
-		for (const auto& plugin : PluginMgr::plugins)
+		for (const auto& registration : PluginMgr::registrations)
 		{
-			const Plugin::Info* info = plugin->getInfo();
+			const Plugin::Info* info = registration.create()->getInfo();
 			std::cout << info->name << " " << info->pluginVersion
 				<< " for packer '" << info->name << " " << info->packerVersion
 				<< "' (" << info->author << ")" << std::endl;
@@ -138,12 +140,13 @@ ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 	{
 		std::string inputFile = handler.getRawInputs()[0];
 		std::string outputFile = handler["output"]->used ? handler["output"]->input : std::string{inputFile}.append("-unpacked");
+		std::unique_ptr<retdec::fileformat::FileFormat> fileParser;
 		std::vector<retdec::cpdetect::DetectResult> detectedPackers;
 
-		if (!detectPackers(inputFile, detectedPackers))
+		if (!detectPackers(inputFile, fileParser, detectedPackers))
 			return EXIT_CODE_PREPROCESSING_ERROR;
 
-		return unpackFile(inputFile, outputFile, brute, detectedPackers);
+		return unpackFile(inputFile, outputFile, brute, fileParser.get(), detectedPackers);
 	}
 	// Nothing else, just print the help
 	else
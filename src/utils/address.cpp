@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <cassert>
 #include <climits>
 #include <cstdio>
@@ -186,6 +187,32 @@ std::ostream& operator<<(std::ostream &out, const AddressRangeContainer &r)
 	return out;
 }
 
+AddressRangeContainer::AddressRangeContainer()
+{
+}
+
+/**
+ * Bulk construction -- equivalent to inserting all the given ranges one by
+ * one, but done in one sort and one merging pass.
+ */
+AddressRangeContainer::AddressRangeContainer(std::vector<AddressRange> rs)
+{
+	std::sort(rs.begin(), rs.end());
+
+	for (auto& r : rs)
+	{
+		if (!ranges.empty()
+				&& r.getStart() <= ranges.back().getEnd() + 1)
+		{
+			ranges.back().setEnd(std::max(ranges.back().getEnd(), r.getEnd()));
+		}
+		else
+		{
+			ranges.push_back(r);
+		}
+	}
+}
+
 AddressRangeContainer::iterator AddressRangeContainer::begin()
 {
 	return ranges.begin();
@@ -234,53 +261,45 @@ bool AddressRangeContainer::operator!=(const AddressRangeContainer &o) const
 std::pair<AddressRangeContainer::iterator,bool> AddressRangeContainer::insert(
 		const AddressRange &r)
 {
-	std::vector<AddressRangeContainer::iterator> betweenOld;
-
-	auto pos = ranges.lower_bound(r);
-	if (pos != ranges.begin())
+	// First stored range that overlaps r or is adjacent to it from the left.
+	// Ends are strictly increasing, so we can binary search them.
+	auto first = std::lower_bound(ranges.begin(), ranges.end(), r,
+			[](const AddressRange& x, const AddressRange& y)
+			{
+				return x.getEnd() + 1 < y.getStart();
+			});
+
+	// One past the last stored range that overlaps r or is adjacent to it
+	// from the right.
+	auto last = first;
+	while (last != ranges.end() && last->getStart() <= r.getEnd() + 1)
 	{
-		--pos; // Move to previous no matter what.
-	}
-	while (pos != ranges.end() && pos->getStart() <= (r.getEnd() + 1))
-	{
-		if (pos->contains(r.getStart())
-				|| pos->contains(r.getEnd())
-				|| r.contains(pos->getStart())
-				|| r.contains(pos->getEnd())
-				|| pos->getStart() == (r.getEnd() + 1)
-				|| pos->getEnd() == (r.getStart() - 1))
-		{
-			betweenOld.push_back(pos);
-		}
-		++pos;
+		++last;
 	}
 
 	// Not overlapping -> insert brand new.
 	//
-	if (betweenOld.empty())
+	if (first == last)
 	{
-		return ranges.insert(r);
+		return {ranges.insert(first, r), true};
 	}
 	// Inserted range fully in some existing range -> do not insert anything.
 	//
-	else if (betweenOld.size() == 1 && (*betweenOld.begin())->contains(r))
+	else if (last - first == 1 && first->contains(r))
 	{
-		return {*betweenOld.begin(), false};
+		return {first, false};
 	}
-	// Some other combo -> find min/max, remove all old, insert new.
+	// Some other combo -> merge all old into one.
 	//
 	else
 	{
-		auto min = r.getStart();
-		auto max = r.getEnd();
-		for (auto it : betweenOld)
-		{
-			min = std::min(min, it->getStart());
-			max = std::max(max, it->getEnd());
-		}
-		auto last = betweenOld.back();
-		ranges.erase(betweenOld.front(), ++last);
-		return ranges.insert(AddressRange(min, max));
+		const auto min = std::min(r.getStart(), first->getStart());
+		const auto max = std::max(r.getEnd(), (last - 1)->getEnd());
+		auto pos = ranges.erase(first + 1, last);
+		// Merge in place -- the vector elements are mutable, unlike the
+		// keys of the former std::set.
+		*(pos - 1) = AddressRange(min, max);
+		return {pos - 1, true};
 	}
 }
 
@@ -291,35 +310,25 @@ std::pair<AddressRangeContainer::iterator,bool> AddressRangeContainer::insert(
 	return insert(AddressRange(s, e));
 }
 
-const AddressRange* AddressRangeContainer::getRange(Address addr)
+const AddressRange* AddressRangeContainer::getRange(Address addr) const
 {
-	if (ranges.empty())
-	{
-		return nullptr;
-	}
-
-	auto pos = ranges.lower_bound(AddressRange(addr));
-
-	if (pos == ranges.end())
-	{
-		auto last = ranges.rbegin();
-		return (last->contains(addr)) ? (&(*last)) : (nullptr);
-	}
+	// First stored range whose end is >= addr; since ends are strictly
+	// increasing, this is the only candidate that can contain addr.
+	auto pos = std::lower_bound(ranges.begin(), ranges.end(), addr,
+			[](const AddressRange& x, Address a)
+			{
+				return x.getEnd() < a;
+			});
 
-	if (pos != ranges.begin() && pos->getStart() != addr)
-	{
-		pos--;
-	}
-
-	return (pos->contains(addr)) ? (&(*pos)) : (nullptr);
+	return pos != ranges.end() && pos->contains(addr) ? &(*pos) : nullptr;
 }
 
-bool AddressRangeContainer::contains(Address addr)
+bool AddressRangeContainer::contains(Address addr) const
 {
 	return getRange(addr) != nullptr;
 }
 
-bool AddressRangeContainer::containsExact(AddressRange r)
+bool AddressRangeContainer::containsExact(AddressRange r) const
 {
 	auto* rr = getRange(r.getStart());
 	return rr ? *rr == r : false;
@@ -327,54 +336,59 @@ bool AddressRangeContainer::containsExact(AddressRange r)
 
 void AddressRangeContainer::remove(const AddressRange &r)
 {
-	std::vector<AddressRangeContainer::iterator> inOld;
+	// First stored range that overlaps r.
+	auto first = std::lower_bound(ranges.begin(), ranges.end(), r,
+			[](const AddressRange& x, const AddressRange& y)
+			{
+				return x.getEnd() < y.getStart();
+			});
 
-	auto pos = ranges.lower_bound(r);
-	if (pos != ranges.begin())
+	// One past the last stored range that overlaps r.
+	auto last = first;
+	while (last != ranges.end() && last->getStart() <= r.getEnd())
 	{
-		--pos; // Move to previous no matter what.
-	}
-	while (pos != ranges.end() && pos->getStart() <= r.getEnd())
-	{
-		if (pos->contains(r.getStart())
-				|| pos->contains(r.getEnd())
-				|| r.contains(pos->getStart())
-				|| r.contains(pos->getEnd()))
-		{
-			inOld.push_back(pos);
-		}
-		++pos;
+		++last;
 	}
 
-	if (inOld.empty())
+	if (first == last)
 	{
 		return;
 	}
 
-	std::vector<AddressRange> newRanges;
-
-	for (auto& it : inOld)
+	// Whatever sticks out of r on either side survives.
+	//
+	AddressRange left, right;
+	bool haveLeft = false, haveRight = false;
+	if (first->getStart() < r.getStart())
 	{
-		const AddressRange& old = *it;
-
-		if (old.getStart() < r.getStart())
-		{
-			newRanges.push_back(AddressRange(old.getStart(), r.getStart() - 1));
-		}
-		if (old.getEnd() > r.getEnd())
-		{
-			newRanges.push_back(AddressRange(r.getEnd() + 1, old.getEnd()));
-		}
+		left = AddressRange(first->getStart(), r.getStart() - 1);
+		haveLeft = true;
+	}
+	if ((last - 1)->getEnd() > r.getEnd())
+	{
+		right = AddressRange(r.getEnd() + 1, (last - 1)->getEnd());
+		haveRight = true;
 	}
 
-	// Remove all old -- container is set, we can not modify its elements.
+	// Reuse the leading removed slots for the remainders, erase the rest.
 	//
-	auto last = inOld.back();
-	ranges.erase(inOld.front(), ++last);
-
-	for (auto& nr : newRanges)
+	auto pos = first;
+	if (haveLeft)
+	{
+		*pos++ = left;
+	}
+	if (haveRight && pos != last)
+	{
+		*pos++ = right;
+		ranges.erase(pos, last);
+	}
+	else if (haveRight)
+	{
+		ranges.insert(pos, right);
+	}
+	else
 	{
-		insert(nr);
+		ranges.erase(pos, last);
 	}
 }
 
@@ -0,0 +1,133 @@
+/**
+* @file src/utils/allocator.cpp
+* @brief Bump arena and object pool allocation utilities.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+
+#include "retdec/utils/allocator.h"
+#include "retdec/utils/instrumentation.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Constructor
+ * @param sizeOfChunk Size of newly created chunks in bytes
+ */
+BumpArena::BumpArena(std::size_t sizeOfChunk) : chunkSize(std::max<std::size_t>(sizeOfChunk, 1))
+{
+
+}
+
+/**
+ * Destructor - releases all memory ever allocated from the arena
+ *
+ * When the instrumentation is enabled, the bytes still held by the arena are
+ * added to the <tt>bump-arena</tt> counters of the profiling report, so
+ * memory reports show how much of a run went through the arenas.
+ */
+BumpArena::~BumpArena()
+{
+	if (instrumentation::isEnabled())
+	{
+		std::size_t reserved = 0;
+		for (const auto &chunk : chunks)
+		{
+			reserved += chunk.size;
+		}
+		instrumentation::incrementCounter("bump-arena/arenas");
+		instrumentation::incrementCounter(
+			"bump-arena/allocated-bytes", getAllocatedBytes());
+		instrumentation::incrementCounter(
+			"bump-arena/reserved-bytes", reserved);
+	}
+}
+
+/**
+ * Allocate uninitialized memory from the arena
+ * @param size Number of bytes to allocate
+ * @param alignment Required alignment, must be a power of two
+ * @return Pointer to the allocated memory, never @c nullptr
+ *
+ * Allocations larger than the chunk size get a dedicated chunk.
+ */
+void* BumpArena::allocate(std::size_t size, std::size_t alignment)
+{
+	if(!chunks.empty())
+	{
+		auto &chunk = chunks.back();
+		const auto offset = (chunk.used + alignment - 1) & ~(alignment - 1);
+		if(offset + size <= chunk.size)
+		{
+			chunk.used = offset + size;
+			return chunk.data.get() + offset;
+		}
+	}
+
+	// operator new returns memory aligned for std::max_align_t, larger
+	// alignments need extra slack
+	const auto slack = alignment > alignof(std::max_align_t) ? alignment - 1 : 0;
+	const auto newChunkSize = std::max(chunkSize, size + slack);
+	chunks.push_back({std::unique_ptr<std::uint8_t[]>(new std::uint8_t[newChunkSize]), newChunkSize, 0});
+
+	auto &chunk = chunks.back();
+	const auto base = reinterpret_cast<std::uintptr_t>(chunk.data.get());
+	const auto offset = ((base + alignment - 1) & ~(alignment - 1)) - base;
+	chunk.used = offset + size;
+	return chunk.data.get() + offset;
+}
+
+/**
+ * Capture the current state of the arena
+ * @return State usable with rewind()
+ */
+BumpArena::State BumpArena::getState() const
+{
+	return {chunks.size(), chunks.empty() ? 0 : chunks.back().used};
+}
+
+/**
+ * Rewind the arena to a previously captured state
+ * @param state State captured by getState()
+ *
+ * All memory allocated after the state was captured is released or made
+ * available for reuse. Objects living in that memory must already be dead.
+ */
+void BumpArena::rewind(const State &state)
+{
+	if(chunks.size() > state.numberOfChunks)
+	{
+		chunks.resize(state.numberOfChunks);
+	}
+	if(!chunks.empty() && chunks.size() == state.numberOfChunks)
+	{
+		chunks.back().used = state.usedInLastChunk;
+	}
+}
+
+/**
+ * Release all memory allocated from the arena
+ */
+void BumpArena::reset()
+{
+	chunks.clear();
+}
+
+/**
+ * Get the total number of bytes handed out by the arena
+ * @return Number of allocated bytes including alignment padding
+ */
+std::size_t BumpArena::getAllocatedBytes() const
+{
+	std::size_t total = 0;
+	for(const auto &chunk : chunks)
+	{
+		total += chunk.used;
+	}
+	return total;
+}
+
+} // namespace utils
+} // namespace retdec
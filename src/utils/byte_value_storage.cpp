@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 #include <cassert>
+#include <climits>
 #include <cstring>
 
 #include "retdec/utils/byte_value_storage.h"
@@ -98,6 +99,77 @@ bool swapEndianness(std::vector<unsigned char>& values, std::size_t items)
 	return true;
 }
 
+/**
+ * Assemble one little endian value of @a X bytes from @a data
+ *
+ * @param data Bytes to assemble the value from
+ *
+ * @return Assembled value
+ */
+template <std::size_t X>
+inline std::uint64_t composeLittle(const std::uint8_t* data)
+{
+	std::uint64_t value = 0;
+
+	for (std::size_t i = 0; i < X; ++i)
+	{
+		value |= static_cast<std::uint64_t>(data[i]) << (CHAR_BIT * i);
+	}
+
+	return value;
+}
+
+/**
+ * Assemble one big endian value of @a X bytes from @a data
+ *
+ * @param data Bytes to assemble the value from
+ *
+ * @return Assembled value
+ */
+template <std::size_t X>
+inline std::uint64_t composeBig(const std::uint8_t* data)
+{
+	std::uint64_t value = 0;
+
+	for (std::size_t i = 0; i < X; ++i)
+	{
+		value |= static_cast<std::uint64_t>(data[i]) << (CHAR_BIT * (X - i - 1));
+	}
+
+	return value;
+}
+
+/**
+ * Assemble an array of @a count values (@a X bytes each) from @a data
+ *
+ * The endianness branch is resolved once outside the loops, so the loop
+ * bodies reduce to plain loads, shifts and byte swaps the compiler can
+ * vectorize.
+ *
+ * @param data Contiguous bytes of the whole array
+ * @param count Number of values to assemble
+ * @param bigEndian @c true for big endian values, @c false for little endian
+ * @param res Result values are appended into this vector
+ */
+template <std::size_t X>
+void composeArray(const std::uint8_t* data, std::size_t count, bool bigEndian, std::vector<std::uint64_t>& res)
+{
+	if (bigEndian)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			res.push_back(composeBig<X>(data + i * X));
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			res.push_back(composeLittle<X>(data + i * X));
+		}
+	}
+}
+
 } // anonymous namespace
 
 /**
@@ -611,6 +683,53 @@ bool ByteValueStorage::getNTWSNice(std::uint64_t address, std::size_t width, std
  */
 bool ByteValueStorage::getXByteArray(std::uint64_t address, std::uint64_t x, std::vector<std::uint64_t>& res, std::size_t size, Endianness e/* = Endianness::UNKNOWN*/) const
 {
+	if (!size)
+	{
+		return true;
+	}
+
+	// Read the whole array in a single virtual dispatch and decode the
+	// values from the contiguous buffer -- one getXByte() call per item
+	// shows up as a bottleneck when callers read large tables.
+	std::vector<std::uint8_t> bytes;
+	if (x && getXBytes(address, x * size, bytes) && bytes.size() == x * size)
+	{
+		const Endianness endian = e == Endianness::UNKNOWN ? getEndianness() : e;
+		if (endian == Endianness::UNKNOWN)
+		{
+			return false;
+		}
+
+		res.reserve(res.size() + size);
+
+		if (getByteLength() == CHAR_BIT)
+		{
+			const bool bigEndian = endian == Endianness::BIG;
+			switch (x)
+			{
+				case 1: composeArray<1>(bytes.data(), size, bigEndian, res); return true;
+				case 2: composeArray<2>(bytes.data(), size, bigEndian, res); return true;
+				case 4: composeArray<4>(bytes.data(), size, bigEndian, res); return true;
+				case 8: composeArray<8>(bytes.data(), size, bigEndian, res); return true;
+				default: break;
+			}
+		}
+
+		std::uint64_t r = 0;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			if (!createValueFromBytes(bytes.data(), bytes.size(), r, endian, i * x, x))
+			{
+				return false;
+			}
+			res.push_back(r);
+		}
+
+		return true;
+	}
+
+	// The full span is not readable in one piece -- fall back to reading
+	// item by item, which also keeps the old partial-result behavior.
 	std::uint64_t r = 0;
 
 	for (std::size_t i = 0; i < size; ++i)
@@ -806,8 +925,26 @@ bool ByteValueStorage::getDoubleArray(std::uint64_t address, std::vector<double>
  */
 bool ByteValueStorage::createValueFromBytes(const std::vector<std::uint8_t>& data, std::uint64_t& value, Endianness endian, std::uint64_t offset/* = 0*/, std::uint64_t size/* = 0*/) const
 {
-	const std::uint64_t realSize = (!size || offset + size > data.size()) ? data.size() - offset : size;
-	if (offset >= data.size() || (size && realSize != size))
+	return createValueFromBytes(data.data(), data.size(), value, endian, offset, size);
+}
+
+/**
+ * Create value from bytes
+ * @param data Pointer to bytes for conversion
+ * @param dataSize Number of bytes pointed to by @a data
+ * @param value Into this parameter the result is stored
+ * @param endian Endian of bytes (if endian is @c Endianness::UNKNOWN, default
+ *    file endian is used)
+ * @param offset First byte from @a data for conversion
+ * @param size Number of bytes for conversion (0 means all bytes from @a offset
+ *    to end of @a data)
+ *
+ * @return @c true if conversion went OK, @c false otherwise
+ */
+bool ByteValueStorage::createValueFromBytes(const std::uint8_t* data, std::size_t dataSize, std::uint64_t& value, Endianness endian, std::uint64_t offset/* = 0*/, std::uint64_t size/* = 0*/) const
+{
+	const std::uint64_t realSize = (!size || offset + size > dataSize) ? dataSize - offset : size;
+	if (offset >= dataSize || (size && realSize != size))
 	{
 		return false;
 	}
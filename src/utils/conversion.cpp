@@ -7,12 +7,102 @@
 #include <bitset>
 #include <cstring>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	#define CONVERSION_HW_SSSE3 1
+	#include <immintrin.h>
+#elif defined(__aarch64__)
+	#define CONVERSION_HW_NEON 1
+	#include <arm_neon.h>
+#endif
+
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
 
 namespace retdec {
 namespace utils {
 
+namespace {
+
+const char HEX_DIGITS_LOWERCASE[17] = "0123456789abcdef";
+const char HEX_DIGITS_UPPERCASE[17] = "0123456789ABCDEF";
+
+#if defined(CONVERSION_HW_SSSE3)
+
+/**
+ * Checks (once) whether the CPU we are running on supports SSSE3.
+ */
+bool hexConversionHardwareSupported()
+{
+	static const bool supported = __builtin_cpu_supports("ssse3");
+	return supported;
+}
+
+/**
+ * Converts @a numBytes bytes from @a data into @c 2*numBytes hex digits in
+ * @a result using SSSE3 byte shuffles -- both nibbles of 16 input bytes are
+ * translated through the digit table with one @c pshufb each.
+ *
+ * Compiled with a target attribute so that no extra build flags are needed;
+ * callers must check hexConversionHardwareSupported() first.
+ */
+__attribute__((target("ssse3")))
+void bytesToHexSimd(const std::uint8_t *data, std::size_t numBytes, char *result, const char *digits)
+{
+	const auto table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+	const auto nibbleMask = _mm_set1_epi8(0x0F);
+
+	std::size_t i = 0;
+	for(; i + 16 <= numBytes; i += 16, result += 32)
+	{
+		const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+		const auto high = _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask);
+		const auto low = _mm_and_si128(input, nibbleMask);
+		const auto highDigits = _mm_shuffle_epi8(table, high);
+		const auto lowDigits = _mm_shuffle_epi8(table, low);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_unpacklo_epi8(highDigits, lowDigits));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + 16), _mm_unpackhi_epi8(highDigits, lowDigits));
+	}
+
+	for(; i < numBytes; ++i)
+	{
+		*result++ = digits[data[i] >> 4];
+		*result++ = digits[data[i] & 0x0F];
+	}
+}
+
+#elif defined(CONVERSION_HW_NEON)
+
+/**
+ * Converts @a numBytes bytes from @a data into @c 2*numBytes hex digits in
+ * @a result using NEON table lookups -- both nibbles of 16 input bytes are
+ * translated through the digit table with one @c tbl each.
+ */
+void bytesToHexSimd(const std::uint8_t *data, std::size_t numBytes, char *result, const char *digits)
+{
+	const auto table = vld1q_u8(reinterpret_cast<const std::uint8_t*>(digits));
+
+	std::size_t i = 0;
+	for(; i + 16 <= numBytes; i += 16, result += 32)
+	{
+		const auto input = vld1q_u8(data + i);
+		const auto highDigits = vqtbl1q_u8(table, vshrq_n_u8(input, 4));
+		const auto lowDigits = vqtbl1q_u8(table, vandq_u8(input, vdupq_n_u8(0x0F)));
+		const auto interleaved = vzipq_u8(highDigits, lowDigits);
+		vst1q_u8(reinterpret_cast<std::uint8_t*>(result), interleaved.val[0]);
+		vst1q_u8(reinterpret_cast<std::uint8_t*>(result + 16), interleaved.val[1]);
+	}
+
+	for(; i < numBytes; ++i)
+	{
+		*result++ = digits[data[i] >> 4];
+		*result++ = digits[data[i] & 0x0F];
+	}
+}
+
+#endif
+
+} // anonymous namespace
+
 /**
 * @brief Converts the given integer into its hexadecimal representation.
 *
@@ -267,6 +357,78 @@ long long int binStringToSigned(const char *sValue) {
 	return nReturn * (-1);
 }
 
+/**
+ * Converts the given bytes into hex digits in a caller-provided buffer
+ * @param data Bytes to be converted
+ * @param numBytes Number of bytes to convert
+ * @param result Output buffer, must hold at least <tt>2 * numBytes</tt> chars
+ * @param uppercase @c true if hex letters (A-F) should be uppercase
+ *
+ * No terminating null character is written. On x86-64 and AArch64 the
+ * conversion runs 16 bytes at a time through SIMD table lookups, elsewhere
+ * (and for short inputs) a scalar lookup table is used.
+ */
+void bytesToHex(const std::uint8_t *data, std::size_t numBytes, char *result, bool uppercase)
+{
+	const char *digits = uppercase ? HEX_DIGITS_UPPERCASE : HEX_DIGITS_LOWERCASE;
+
+#if defined(CONVERSION_HW_SSSE3)
+	if(numBytes >= 16 && hexConversionHardwareSupported())
+	{
+		bytesToHexSimd(data, numBytes, result, digits);
+		return;
+	}
+#elif defined(CONVERSION_HW_NEON)
+	if(numBytes >= 16)
+	{
+		bytesToHexSimd(data, numBytes, result, digits);
+		return;
+	}
+#endif
+
+	for(std::size_t i = 0; i < numBytes; ++i)
+	{
+		result[2 * i] = digits[data[i] >> 4];
+		result[2 * i + 1] = digits[data[i] & 0x0F];
+	}
+}
+
+/**
+ * Converts the given byte array into a hexadecimal string representation
+ * @param data Array to be converted into a hexadecimal string
+ * @param dataSize Size of array
+ * @param result Into this parameter the result is stored
+ * @param offset First byte from @a data which will be converted
+ * @param size Number of bytes from @a data for conversion
+ *    (0 means all bytes from @a offset)
+ * @param uppercase @c true if hex letters (A-F) should be uppercase
+ *
+ * Non-template overload of the generic bytesToHexString() which is preferred
+ * for plain byte arrays and converts through the bulk bytesToHex() kernel.
+ */
+void bytesToHexString(const std::uint8_t *data, std::size_t dataSize, std::string &result, std::size_t offset, std::size_t size, bool uppercase)
+{
+	if(!data)
+	{
+		dataSize = 0;
+	}
+
+	if(offset >= dataSize)
+	{
+		size = 0;
+	}
+	else
+	{
+		size = (size == 0 || offset + size > dataSize) ? dataSize - offset : size;
+	}
+
+	result.resize(size * 2);
+	if(size)
+	{
+		bytesToHex(data + offset, size, &result[0], uppercase);
+	}
+}
+
 /**
  * Convert hexadecimal string @c hexIn string into bytes.
  * There might be whitespaces in the string, e.g. "0b 84 d1 a0 80 60 40" is
@@ -277,10 +439,11 @@ std::vector<uint8_t> hexStringToBytes(const std::string& hexIn)
 	std::vector<uint8_t> bytes;
 
 	auto hex = removeWhitespace(hexIn);
+	bytes.reserve((hex.length() + 1) / 2);
 	for (unsigned int i = 0; i < hex.length(); i += 2)
 	{
-		std::string byteString = hex.substr(i, 2);
-		char byte = strtol(byteString.c_str(), nullptr, 16);
+		const char byteString[3] = {hex[i], i + 1 < hex.length() ? hex[i + 1] : '\0', '\0'};
+		char byte = strtol(byteString, nullptr, 16);
 		bytes.push_back(byte);
 	}
 
@@ -0,0 +1,332 @@
+/**
+* @file src/utils/event_log.cpp
+* @brief Low-overhead event logging into per-thread binary ring buffers.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "retdec/utils/event_log.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_WINDOWS
+	#include <process.h>
+#else
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+namespace event_log {
+
+namespace {
+
+/// How many records the ring buffer of one thread holds. Sized so a buffer
+/// takes 2 MiB and still keeps tens of thousands of the most recent events.
+const std::size_t RECORDS_PER_THREAD = std::size_t(1) << 16;
+
+/// One binary record in a ring buffer.
+struct Record
+{
+	std::uint64_t timeNs;  ///< monotonic timestamp of the event
+	std::uint64_t arg0;    ///< first argument of the event
+	std::uint64_t arg1;    ///< second argument of the event
+	std::uint32_t siteId;  ///< site the event belongs to
+};
+
+/// Ring buffer of one thread. Only the owning thread writes to it; the
+/// exporter reads it without a lock, so the head is atomic to make the
+/// already-written records visible.
+struct ThreadBuffer
+{
+	std::vector<Record> records;
+	std::atomic<std::uint64_t> head;
+
+	ThreadBuffer(): records(RECORDS_PER_THREAD), head(0) {}
+};
+
+/// One registered site.
+struct SiteInfo
+{
+	std::string name;    ///< name given to the Site constructor
+	bool arg0IsText;     ///< is arg0 an id returned by internText()?
+};
+
+/// State shared by all threads. Registration and interning lock its mutex;
+/// recording does not touch it at all.
+struct Registry
+{
+	std::mutex mutex;
+	std::vector<SiteInfo> sites;
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+	std::vector<std::string> texts;
+	std::unordered_map<std::string, std::uint64_t> textIds;
+};
+
+/**
+ * Returns the registry. A function-local static, so sites constructed during
+ * the static initialization of other translation units can register safely.
+ */
+Registry &registry()
+{
+	static Registry instance;
+	return instance;
+}
+
+/**
+ * Returns the ring buffer of the calling thread, registering it on the first
+ * use. The buffer is shared with the registry, so it outlives the thread and
+ * its records make it into the exported trace.
+ */
+ThreadBuffer &threadBuffer()
+{
+	thread_local std::shared_ptr<ThreadBuffer> buffer;
+	if (!buffer)
+	{
+		buffer = std::make_shared<ThreadBuffer>();
+		auto &r = registry();
+		std::lock_guard<std::mutex> lock(r.mutex);
+		r.buffers.push_back(buffer);
+	}
+	return *buffer;
+}
+
+/**
+ * Returns the current value of a monotonic nanosecond clock.
+ */
+std::uint64_t nowNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Exports the trace according to the value of @c RETDEC_TRACE. Registered
+ * via std::atexit when the event log is first enabled.
+ */
+void exportTrace()
+{
+	// The log may be enabled programmatically (enable()), in which case
+	// RETDEC_TRACE does not have to be set at all -- the tool then exports
+	// the trace itself and nothing is exported here.
+	const auto *env = std::getenv("RETDEC_TRACE");
+	if (!env)
+	{
+		return;
+	}
+	std::string target = env;
+
+	// A "%p" in the path expands to the PID, so each process of a multi-tool
+	// pipeline gets its own trace file.
+	const auto pidPos = target.find("%p");
+	if (pidPos != std::string::npos)
+	{
+#ifdef OS_WINDOWS
+		target.replace(pidPos, 2, std::to_string(_getpid()));
+#else
+		target.replace(pidPos, 2, std::to_string(getpid()));
+#endif
+	}
+
+	if (target.find('.') != std::string::npos)
+	{
+		std::ofstream file(target);
+		if (file)
+		{
+			formatTrace(file);
+		}
+	}
+	else
+	{
+		formatTrace(std::cerr);
+	}
+}
+
+/// Is the event log collecting records? Set once, before any recording
+/// starts, so a plain (non-atomic) read in isEnabled() is sufficient.
+bool enabledFlag = false;
+
+/// Guards the one-time registration of the exit-time export.
+std::once_flag exportRegistration;
+
+/**
+ * Turns the collection on and registers the exit-time export (once).
+ */
+void enableCollection()
+{
+	// Touching the registry first makes sure it is constructed before the
+	// export is registered, so the export runs before its destruction.
+	registry();
+	std::call_once(exportRegistration, [] { std::atexit(&exportTrace); });
+	enabledFlag = true;
+}
+
+/**
+ * Checks the environment and enables the collection when requested.
+ */
+bool initialize()
+{
+	if (std::getenv("RETDEC_TRACE"))
+	{
+		enableCollection();
+	}
+	return enabledFlag;
+}
+
+} // anonymous namespace
+
+/**
+ * Finds out whether the event log is enabled
+ * @return @c true if @c RETDEC_TRACE is set or enable() was called,
+ *         @c false otherwise
+ */
+bool isEnabled()
+{
+	static const bool checkedEnvironment = initialize();
+	(void) checkedEnvironment;
+	return enabledFlag;
+}
+
+/**
+ * Enables the event log even when @c RETDEC_TRACE is unset
+ *
+ * Call it before the logged work starts. Without @c RETDEC_TRACE nothing is
+ * exported at exit; the caller is expected to export the trace itself via
+ * formatTrace().
+ */
+void enable()
+{
+	enableCollection();
+}
+
+/**
+ * Constructor -- registers the site
+ * @param name Name of the site, shown in the formatted trace
+ * @param arg0IsText @c true when the first argument of the records of this
+ *        site is an id returned by internText()
+ */
+Site::Site(const char *name, bool arg0IsText)
+{
+	auto &r = registry();
+	std::lock_guard<std::mutex> lock(r.mutex);
+	id = static_cast<std::uint32_t>(r.sites.size());
+	r.sites.push_back({name, arg0IsText});
+}
+
+/**
+ * Interns the given text
+ * @param text Text to intern
+ * @return Id of the text, usable as a record argument
+ *
+ * Interning the same text repeatedly returns the same id.
+ */
+std::uint64_t internText(const std::string &text)
+{
+	auto &r = registry();
+	std::lock_guard<std::mutex> lock(r.mutex);
+	auto inserted = r.textIds.emplace(text, r.texts.size());
+	if (inserted.second)
+	{
+		r.texts.push_back(text);
+	}
+	return inserted.first->second;
+}
+
+/**
+ * Appends one record to the ring buffer of the calling thread
+ * @param site Site the record belongs to
+ * @param arg0 First argument of the record
+ * @param arg1 Second argument of the record
+ *
+ * A no-op unless the event log is enabled. Never blocks -- the buffer is
+ * owned by the calling thread and old records are overwritten when it is
+ * full.
+ */
+void record(const Site &site, std::uint64_t arg0, std::uint64_t arg1)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	auto &buffer = threadBuffer();
+	const auto index = buffer.head.load(std::memory_order_relaxed);
+	auto &rec = buffer.records[index % RECORDS_PER_THREAD];
+	rec.timeNs = nowNs();
+	rec.arg0 = arg0;
+	rec.arg1 = arg1;
+	rec.siteId = site.getId();
+	buffer.head.store(index + 1, std::memory_order_release);
+}
+
+/**
+ * Formats all the collected records into the given stream
+ * @param out Stream to write the trace to
+ *
+ * Records of all threads are merged and ordered by time; timestamps are
+ * printed in nanoseconds relative to the oldest record in the trace. The
+ * formatting is best-effort with respect to threads that are still
+ * recording -- their newest events may be missing from the trace.
+ */
+void formatTrace(std::ostream &out)
+{
+	auto &r = registry();
+	std::lock_guard<std::mutex> lock(r.mutex);
+
+	/// One record with the thread it was recorded on.
+	struct OwnedRecord
+	{
+		Record record;
+		std::size_t thread;
+	};
+	std::vector<OwnedRecord> merged;
+	for (std::size_t t = 0; t < r.buffers.size(); ++t)
+	{
+		const auto &buffer = *r.buffers[t];
+		const auto head = buffer.head.load(std::memory_order_acquire);
+		const auto count = std::min<std::uint64_t>(head, RECORDS_PER_THREAD);
+		for (std::uint64_t i = head - count; i < head; ++i)
+		{
+			merged.push_back({buffer.records[i % RECORDS_PER_THREAD], t});
+		}
+	}
+	std::stable_sort(merged.begin(), merged.end(),
+		[](const OwnedRecord &a, const OwnedRecord &b)
+		{
+			return a.record.timeNs < b.record.timeNs;
+		});
+
+	out << "# time[ns] thread site arg0 arg1\n";
+	const auto base = merged.empty() ? 0 : merged.front().record.timeNs;
+	for (const auto &owned : merged)
+	{
+		const auto &rec = owned.record;
+		const auto *site = rec.siteId < r.sites.size()
+			? &r.sites[rec.siteId] : nullptr;
+		out << rec.timeNs - base
+			<< ' ' << owned.thread
+			<< ' ' << (site ? site->name : "?");
+		if (site && site->arg0IsText && rec.arg0 < r.texts.size())
+		{
+			out << " \"" << r.texts[rec.arg0] << '"';
+		}
+		else
+		{
+			out << ' ' << rec.arg0;
+		}
+		out << ' ' << rec.arg1 << '\n';
+	}
+}
+
+} // namespace event_log
+} // namespace utils
+} // namespace retdec
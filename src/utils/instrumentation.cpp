@@ -0,0 +1,427 @@
+/**
+* @file src/utils/instrumentation.cpp
+* @brief Phase timing and counter instrumentation.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "retdec/utils/instrumentation.h"
+#include "retdec/utils/memory.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_WINDOWS
+	#include <process.h>
+#else
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+namespace instrumentation {
+
+namespace {
+
+/// Aggregated measurements of one phase name.
+struct PhaseStats
+{
+	std::uint64_t totalNs = 0;    ///< total time spent in the phase
+	std::uint64_t calls = 0;      ///< how many times the phase ran
+	std::int64_t rssDelta = 0;    ///< total RSS change over all runs in bytes
+	std::uint64_t maxRss = 0;     ///< highest RSS seen at the end of a run
+};
+
+/// One phase opened by recordPhaseTransition() and not yet ended.
+struct OpenPhase
+{
+	std::string name;    ///< name of the phase
+	unsigned depth;      ///< nesting depth of the phase
+	std::uint64_t start; ///< start of the phase in nanoseconds
+	std::size_t startRss; ///< RSS of the process when the phase started
+};
+
+/// Guards all the mutable state below.
+std::mutex statsMutex;
+
+/// Aggregated phase timings, keyed by the full (nested) phase name.
+std::map<std::string, PhaseStats> phases;
+
+/// Counter values, keyed by the counter name.
+std::map<std::string, std::uint64_t> counters;
+
+/// Sequential phases opened by recordPhaseTransition() and not yet ended.
+std::vector<OpenPhase> openPhases;
+
+/// Names of the scoped phases enclosing the current code, per thread.
+thread_local std::vector<std::string> phaseNesting;
+
+/**
+ * Returns the current value of a monotonic nanosecond clock.
+ */
+std::uint64_t nowNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Adds one finished run of the given phase to the aggregated measurements.
+ * statsMutex must be held by the caller.
+ */
+void addPhaseRun(const std::string &name, std::uint64_t elapsedNs,
+	std::size_t startRss, std::size_t endRss)
+{
+	auto &stats = phases[name];
+	stats.totalNs += elapsedNs;
+	++stats.calls;
+	stats.rssDelta += std::int64_t(endRss) - std::int64_t(startRss);
+	stats.maxRss = std::max<std::uint64_t>(stats.maxRss, endRss);
+}
+
+/**
+ * Writes the aggregated report in the JSON format.
+ */
+void writeJson(std::ostream &out)
+{
+	out << "{\n\t\"peak_rss_bytes\" : " << getPeakMemoryUsage()
+		<< ",\n\t\"phases\" : [";
+	bool first = true;
+	for (const auto &phase : phases)
+	{
+		out << (first ? "\n" : ",\n")
+			<< "\t\t{ \"name\" : \"" << phase.first << "\""
+			<< ", \"calls\" : " << phase.second.calls
+			<< ", \"nanoseconds\" : " << phase.second.totalNs
+			<< ", \"rss_delta_bytes\" : " << phase.second.rssDelta
+			<< ", \"max_rss_bytes\" : " << phase.second.maxRss << " }";
+		first = false;
+	}
+	out << "\n\t],\n\t\"counters\" : {";
+	first = true;
+	for (const auto &counter : counters)
+	{
+		out << (first ? "\n" : ",\n")
+			<< "\t\t\"" << counter.first << "\" : " << counter.second;
+		first = false;
+	}
+	out << "\n\t}\n}\n";
+}
+
+/**
+ * Writes the aggregated report in the CSV format.
+ */
+void writeCsv(std::ostream &out)
+{
+	out << "kind,name,calls,value,rss_delta_bytes,max_rss_bytes\n";
+	for (const auto &phase : phases)
+	{
+		out << "phase," << phase.first << "," << phase.second.calls << ","
+			<< phase.second.totalNs << "," << phase.second.rssDelta << ","
+			<< phase.second.maxRss << "\n";
+	}
+	for (const auto &counter : counters)
+	{
+		out << "counter," << counter.first << ",," << counter.second
+			<< ",,\n";
+	}
+}
+
+/**
+ * Formats a (possibly negative) byte count for humans, e.g. "-1.5 MiB".
+ */
+std::string formatBytes(std::int64_t bytes)
+{
+	const char *sign = bytes < 0 ? "-" : "";
+	auto value = bytes < 0 ? -double(bytes) : double(bytes);
+	static const char *units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+	std::size_t unit = 0;
+	while (value >= 1024.0 && unit + 1 < sizeof(units) / sizeof(units[0]))
+	{
+		value /= 1024.0;
+		++unit;
+	}
+	std::ostringstream out;
+	out << sign << std::fixed << std::setprecision(unit == 0 ? 0 : 1)
+		<< value << ' ' << units[unit];
+	return out.str();
+}
+
+/**
+ * Exports the report according to the value of @c RETDEC_PROFILE. Registered
+ * via std::atexit when the instrumentation is first used.
+ */
+void exportReport()
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+
+	// End the sequential phases that are still open.
+	const auto now = nowNs();
+	const auto nowRss = getCurrentMemoryUsage();
+	for (const auto &open : openPhases)
+	{
+		addPhaseRun(open.name, now - open.start, open.startRss, nowRss);
+	}
+	openPhases.clear();
+
+	// The instrumentation may be enabled programmatically (enable()), in
+	// which case RETDEC_PROFILE does not have to be set at all -- the tool
+	// then prints its own report and nothing is exported here.
+	const auto *env = std::getenv("RETDEC_PROFILE");
+	if (!env)
+	{
+		return;
+	}
+	std::string target = env;
+
+	// A "%p" in the path expands to the PID, so each process of a multi-tool
+	// pipeline (e.g. a whole decompilation) gets its own report file.
+	const auto pidPos = target.find("%p");
+	if (pidPos != std::string::npos)
+	{
+#ifdef OS_WINDOWS
+		target.replace(pidPos, 2, std::to_string(_getpid()));
+#else
+		target.replace(pidPos, 2, std::to_string(getpid()));
+#endif
+	}
+
+	const auto dot = target.rfind('.');
+	const auto extension = dot == std::string::npos
+		? std::string() : target.substr(dot);
+
+	if (extension == ".json" || extension == ".csv")
+	{
+		std::ofstream file(target);
+		if (!file)
+		{
+			return;
+		}
+		extension == ".json" ? writeJson(file) : writeCsv(file);
+	}
+	else
+	{
+		writeJson(std::cerr);
+	}
+}
+
+/// Is the instrumentation collecting data? Set once, before any measurement
+/// starts, so a plain (non-atomic) read in isEnabled() is sufficient.
+bool enabledFlag = false;
+
+/// Guards the one-time registration of the exit-time export.
+std::once_flag exportRegistration;
+
+/**
+ * Turns the collection on and registers the exit-time export (once).
+ */
+void enableCollection()
+{
+	std::call_once(exportRegistration, [] { std::atexit(&exportReport); });
+	enabledFlag = true;
+}
+
+/**
+ * Checks the environment and enables the collection when requested.
+ */
+bool initialize()
+{
+	if (std::getenv("RETDEC_PROFILE"))
+	{
+		enableCollection();
+	}
+	return enabledFlag;
+}
+
+} // anonymous namespace
+
+/**
+ * Finds out whether the instrumentation is enabled
+ * @return @c true if @c RETDEC_PROFILE is set or enable() was called,
+ *         @c false otherwise
+ */
+bool isEnabled()
+{
+	static const bool checkedEnvironment = initialize();
+	(void) checkedEnvironment;
+	return enabledFlag;
+}
+
+/**
+ * Enables the instrumentation even when @c RETDEC_PROFILE is unset
+ *
+ * Call it before the measured work starts -- typically right after parsing
+ * the command-line options. Without @c RETDEC_PROFILE nothing is exported at
+ * exit; the caller is expected to print the data itself, e.g. via
+ * printMemoryReport().
+ */
+void enable()
+{
+	enableCollection();
+}
+
+/**
+ * Adds @a delta to the counter with the given name
+ * @param name Name of the counter
+ * @param delta Value to add
+ */
+void incrementCounter(const std::string &name, std::uint64_t delta)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(statsMutex);
+	counters[name] += delta;
+}
+
+/**
+ * Starts a new sequential phase
+ * @param name Name of the phase
+ * @param depth Nesting depth of the phase (0 for top-level phases)
+ *
+ * All currently open sequential phases with the same or greater depth are
+ * ended and their elapsed time is attributed to them. The new phase stays
+ * open until the next transition with depth <= @a depth, or until the
+ * process exits.
+ */
+void recordPhaseTransition(const std::string &name, unsigned depth)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	const auto now = nowNs();
+	const auto nowRss = getCurrentMemoryUsage();
+	std::lock_guard<std::mutex> lock(statsMutex);
+
+	while (!openPhases.empty() && openPhases.back().depth >= depth)
+	{
+		addPhaseRun(openPhases.back().name, now - openPhases.back().start,
+			openPhases.back().startRss, nowRss);
+		openPhases.pop_back();
+	}
+
+	// Open phases store their full names, so prefixing with the name of the
+	// innermost still-open phase nests under the whole enclosing chain.
+	auto fullName = openPhases.empty()
+		? name : openPhases.back().name + "/" + name;
+	openPhases.push_back({std::move(fullName), depth, now, nowRss});
+}
+
+/**
+ * Writes a human-readable summary of the collected memory measurements
+ * @param out Stream to write the summary to
+ *
+ * Shows the process-wide peak RSS, then every recorded phase with its total
+ * RSS delta (how much resident memory the phase gained or released over all
+ * its runs) and the highest RSS observed when a run of it ended, sorted by
+ * the watermark. Phases that are still open are reported as if they ended
+ * now. Nothing is printed for phases when no data was collected (i.e. the
+ * instrumentation was never enabled).
+ */
+void printMemoryReport(std::ostream &out)
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+
+	// Account for the sequential phases that have not ended yet (e.g. the
+	// last phase of a tool printing this report just before it exits).
+	auto reported = phases;
+	const auto now = nowNs();
+	const auto nowRss = getCurrentMemoryUsage();
+	for (const auto &open : openPhases)
+	{
+		auto &stats = reported[open.name];
+		stats.totalNs += now - open.start;
+		++stats.calls;
+		stats.rssDelta += std::int64_t(nowRss) - std::int64_t(open.startRss);
+		stats.maxRss = std::max<std::uint64_t>(stats.maxRss, nowRss);
+	}
+
+	out << "Memory report:\n"
+		<< "    current RSS : " << formatBytes(nowRss) << "\n"
+		<< "    peak RSS    : " << formatBytes(getPeakMemoryUsage()) << "\n";
+
+	if (!reported.empty())
+	{
+		std::vector<std::pair<std::string, PhaseStats>> sorted(
+			reported.begin(), reported.end());
+		std::sort(sorted.begin(), sorted.end(),
+			[](const std::pair<std::string, PhaseStats> &a,
+				const std::pair<std::string, PhaseStats> &b)
+			{
+				return a.second.maxRss > b.second.maxRss;
+			});
+
+		out << "Phases (by RSS watermark):\n";
+		for (const auto &phase : sorted)
+		{
+			out << "    " << std::left << std::setw(48) << phase.first
+				<< " watermark " << std::setw(10)
+				<< formatBytes(phase.second.maxRss)
+				<< " delta " << formatBytes(phase.second.rssDelta) << "\n";
+		}
+	}
+
+	bool headerPrinted = false;
+	for (const auto &counter : counters)
+	{
+		if (!headerPrinted)
+		{
+			out << "Counters:\n";
+			headerPrinted = true;
+		}
+		out << "    " << std::left << std::setw(48) << counter.first
+			<< " " << counter.second << "\n";
+	}
+}
+
+/**
+ * Constructor -- starts measuring the phase
+ * @param name Name of the phase
+ */
+ScopedPhase::ScopedPhase(const std::string &name)
+	: active(isEnabled()), start(0), startRss(0)
+{
+	if (!active)
+	{
+		return;
+	}
+
+	start = nowNs();
+	startRss = getCurrentMemoryUsage();
+	auto fullName = phaseNesting.empty()
+		? name : phaseNesting.back() + "/" + name;
+	phaseNesting.push_back(std::move(fullName));
+}
+
+/**
+ * Destructor -- ends the phase and adds its time to the aggregated report
+ */
+ScopedPhase::~ScopedPhase()
+{
+	if (!active)
+	{
+		return;
+	}
+
+	const auto elapsed = nowNs() - start;
+	const auto endRss = getCurrentMemoryUsage();
+	std::lock_guard<std::mutex> lock(statsMutex);
+	addPhaseRun(phaseNesting.back(), elapsed, startRss, endRss);
+	phaseNesting.pop_back();
+}
+
+} // namespace instrumentation
+} // namespace utils
+} // namespace retdec
@@ -0,0 +1,276 @@
+/**
+* @file src/utils/job_server.cpp
+* @brief Unix-socket job server for the daemon modes of the tools.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <cstring>
+
+#include "retdec/utils/job_server.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_POSIX
+	#include <csignal>
+
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+
+namespace {
+
+/// A job line may carry long pass lists and paths, but it is still a single
+/// command line -- anything above this is a protocol error.
+const std::size_t MAX_JOB_LINE_LENGTH = 1024 * 1024;
+
+/// Job line shutting the server down.
+const char * const SHUTDOWN_JOB = "@shutdown";
+
+#ifdef OS_POSIX
+
+/**
+ * Reads one '\n'-terminated job line from the given connection.
+ * @return @c false when the connection ends or the line is too long.
+ */
+bool readJobLine(int fd, std::string &line)
+{
+	line.clear();
+	char c;
+	while (line.size() < MAX_JOB_LINE_LENGTH)
+	{
+		const auto got = read(fd, &c, 1);
+		if (got != 1)
+		{
+			return false;
+		}
+		if (c == '\n')
+		{
+			return true;
+		}
+		line += c;
+	}
+	return false;
+}
+
+/**
+ * Splits a job line into the tab-separated arguments.
+ */
+std::vector<std::string> splitJobLine(const std::string &line)
+{
+	std::vector<std::string> args;
+	std::size_t start = 0;
+	while (start <= line.size())
+	{
+		auto end = line.find('\t', start);
+		if (end == std::string::npos)
+		{
+			end = line.size();
+		}
+		args.push_back(line.substr(start, end - start));
+		start = end + 1;
+	}
+	// A trailing '\r' (e.g. from an interactive client) would end up glued
+	// to the last argument.
+	if (!args.empty() && !args.back().empty() && args.back().back() == '\r')
+	{
+		args.back().pop_back();
+	}
+	while (!args.empty() && args.back().empty())
+	{
+		args.pop_back();
+	}
+	return args;
+}
+
+#endif
+
+} // anonymous namespace
+
+/**
+ * Constructor
+ * @param socketPath Path of the unix socket to listen on
+ */
+JobServer::JobServer(const std::string &socketPath) : socketPath(socketPath)
+{
+
+}
+
+/**
+ * Destructor -- stops listening and removes the socket from the filesystem
+ */
+JobServer::~JobServer()
+{
+#ifdef OS_POSIX
+	if (serverFd != -1)
+	{
+		close(serverFd);
+		unlink(socketPath.c_str());
+	}
+#endif
+}
+
+/**
+ * Starts listening on the socket
+ * @return @c true on success, @c false otherwise (and always on Windows)
+ *
+ * A stale socket left over by a crashed daemon is removed first, so
+ * restarting a daemon with the same socket path just works.
+ */
+bool JobServer::listenOn()
+{
+#ifdef OS_POSIX
+	sockaddr_un address;
+	if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+	{
+		return false;
+	}
+
+	serverFd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (serverFd == -1)
+	{
+		return false;
+	}
+
+	unlink(socketPath.c_str());
+
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	std::strcpy(address.sun_path, socketPath.c_str());
+	if (bind(serverFd, reinterpret_cast<sockaddr*>(&address),
+			sizeof(address)) == -1
+		|| listen(serverFd, SOMAXCONN) == -1)
+	{
+		close(serverFd);
+		serverFd = -1;
+		return false;
+	}
+
+	// The workers are fire-and-forget -- the clients learn the job status
+	// from the @retdec-exit line, so the kernel can reap them for us.
+	signal(SIGCHLD, SIG_IGN);
+	// A client disconnecting mid-job must not kill the worker writing to it.
+	signal(SIGPIPE, SIG_IGN);
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+ * Accepts and runs jobs until a shutdown job arrives
+ * @param handler Handler running one job in a forked worker
+ * @return Exit status of the server
+ *
+ * One worker is forked per job, so jobs run concurrently when clients
+ * connect concurrently, and nothing a job does can affect the daemon or
+ * later jobs.
+ */
+int JobServer::run(const JobHandler &handler)
+{
+#ifdef OS_POSIX
+	if (serverFd == -1)
+	{
+		return EXIT_FAILURE;
+	}
+
+	while (true)
+	{
+		const auto connection = accept(serverFd, nullptr, nullptr);
+		if (connection == -1)
+		{
+			continue;
+		}
+
+		std::string line;
+		if (!readJobLine(connection, line))
+		{
+			close(connection);
+			continue;
+		}
+
+		if (line == SHUTDOWN_JOB)
+		{
+			close(connection);
+			return EXIT_SUCCESS;
+		}
+
+		const auto pid = fork();
+		if (pid == 0)
+		{
+			// The worker talks to the client through its standard outputs.
+			dup2(connection, STDOUT_FILENO);
+			dup2(connection, STDERR_FILENO);
+			close(connection);
+			close(serverFd);
+
+			const auto status = handler(splitJobLine(line));
+
+			std::fflush(nullptr);
+			dprintf(STDOUT_FILENO, "@retdec-exit %d\n", status);
+			// _exit() -- running the daemon's exit handlers and static
+			// destructors in every worker is neither needed nor safe.
+			_exit(status);
+		}
+		close(connection);
+	}
+#else
+	return EXIT_FAILURE;
+#endif
+}
+
+/**
+ * Extracts the daemon option from a command line
+ * @param argc Number of arguments, updated when the option is removed
+ * @param argv The arguments, shifted when the option is removed
+ * @return Socket path given by the option, or an empty string
+ *
+ * Accepts <tt>-daemon PATH</tt>, <tt>-daemon=PATH</tt> and the double-dash
+ * variants. The tools have to recognize the option before their regular
+ * command-line parsing runs -- in daemon mode, the parsing happens in the
+ * workers, once per job.
+ */
+std::string JobServer::extractDaemonOption(int &argc, char **argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "-daemon" || arg == "--daemon")
+		{
+			if (i + 1 >= argc)
+			{
+				return std::string();
+			}
+			std::string path = argv[i + 1];
+			for (int j = i; j + 2 < argc; ++j)
+			{
+				argv[j] = argv[j + 2];
+			}
+			argc -= 2;
+			return path;
+		}
+
+		const auto isPrefix = [&arg](const char *prefix)
+		{
+			return arg.compare(0, std::strlen(prefix), prefix) == 0;
+		};
+		if (isPrefix("-daemon=") || isPrefix("--daemon="))
+		{
+			const auto path = arg.substr(arg.find('=') + 1);
+			for (int j = i; j + 1 < argc; ++j)
+			{
+				argv[j] = argv[j + 1];
+			}
+			--argc;
+			return path;
+		}
+	}
+	return std::string();
+}
+
+} // namespace utils
+} // namespace retdec
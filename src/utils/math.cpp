@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <cmath>
+#include <cstring>
+
 #include "retdec/utils/math.h"
 
 namespace retdec {
@@ -31,5 +34,75 @@ unsigned bitSizeOfNumber(unsigned long long v) {
 	return r + 1;
 }
 
+/**
+* @brief Computes the histogram of byte values in the given data.
+*
+* @param[in]  data   Data to process.
+* @param[in]  size   Size of @a data in bytes.
+* @param[out] counts Result histogram -- @c counts[b] is the number of
+*                    occurrences of the byte value @c b.
+*
+* Histogram increments scatter, so they cannot be expressed with SIMD
+* directly -- instead, four interleaved count tables break the dependency
+* chain between increments of equal adjacent bytes (common in padding and
+* packed data), which is what limits the naive one-table loop.
+*/
+void byteHistogram(
+		const unsigned char* data,
+		std::size_t size,
+		std::uint64_t (&counts)[256])
+{
+	std::uint64_t tables[4][256];
+	std::memset(tables, 0, sizeof(tables));
+
+	std::size_t i = 0;
+	for (; i + 4 <= size; i += 4)
+	{
+		++tables[0][data[i]];
+		++tables[1][data[i + 1]];
+		++tables[2][data[i + 2]];
+		++tables[3][data[i + 3]];
+	}
+	for (; i < size; ++i)
+	{
+		++tables[0][data[i]];
+	}
+
+	for (std::size_t b = 0; b < 256; ++b)
+	{
+		counts[b] = tables[0][b] + tables[1][b] + tables[2][b] + tables[3][b];
+	}
+}
+
+/**
+* @brief Computes the Shannon entropy of the given data in bits per byte.
+*
+* @param[in] data Data to process.
+* @param[in] size Size of @a data in bytes.
+*
+* @return Entropy in the range <tt>[0.0, 8.0]</tt>, @c 0.0 for empty data.
+*/
+double byteEntropy(const unsigned char* data, std::size_t size)
+{
+	if (data == nullptr || size == 0)
+	{
+		return 0.0;
+	}
+
+	std::uint64_t counts[256];
+	byteHistogram(data, size, counts);
+
+	double entropy = 0.0;
+	for (std::size_t b = 0; b < 256; ++b)
+	{
+		if (counts[b])
+		{
+			double p = static_cast<double>(counts[b]) / size;
+			entropy -= p * std::log2(p);
+		}
+	}
+	return entropy;
+}
+
 } // namespace utils
 } // namespace retdec
@@ -9,10 +9,15 @@
 
 #ifdef OS_WINDOWS
 	#include <windows.h>
+	#include <psapi.h>
 #elif defined(OS_MACOS)
+	#include <mach/mach.h>
 	#include <sys/types.h>
 	#include <sys/sysctl.h>
 #else
+	#include <fstream>
+
+	#include <unistd.h>
 	#include <sys/sysinfo.h>
 #endif
 
@@ -53,6 +58,26 @@ std::size_t getTotalSystemMemoryOnWindows() {
 	return succeeded ? memoryStatus.ullTotalPhys : 0;
 }
 
+/**
+* @brief Implementation of @c getCurrentMemoryUsage() on Windows.
+*/
+std::size_t getCurrentMemoryUsageOnWindows() {
+	PROCESS_MEMORY_COUNTERS counters;
+	auto succeeded = GetProcessMemoryInfo(
+		GetCurrentProcess(), &counters, sizeof(counters));
+	return succeeded ? counters.WorkingSetSize : 0;
+}
+
+/**
+* @brief Implementation of @c getPeakMemoryUsage() on Windows.
+*/
+std::size_t getPeakMemoryUsageOnWindows() {
+	PROCESS_MEMORY_COUNTERS counters;
+	auto succeeded = GetProcessMemoryInfo(
+		GetCurrentProcess(), &counters, sizeof(counters));
+	return succeeded ? counters.PeakWorkingSetSize : 0;
+}
+
 /**
 * @brief Assigns the current process into a new job and returns a handle to
 *     that job.
@@ -109,6 +134,27 @@ std::size_t getTotalSystemMemoryOnMacOS() {
 	return rc != -1 ? value : 0;
 }
 
+/**
+* @brief Implementation of @c getCurrentMemoryUsage() on MacOS.
+*/
+std::size_t getCurrentMemoryUsageOnMacOS() {
+	mach_task_basic_info info;
+	mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+	auto rc = task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+		reinterpret_cast<task_info_t>(&info), &count);
+	return rc == KERN_SUCCESS ? info.resident_size : 0;
+}
+
+/**
+* @brief Implementation of @c getPeakMemoryUsage() on MacOS.
+*/
+std::size_t getPeakMemoryUsageOnMacOS() {
+	struct rusage usage;
+	auto rc = getrusage(RUSAGE_SELF, &usage);
+	// ru_maxrss is in bytes on MacOS.
+	return rc == 0 ? usage.ru_maxrss : 0;
+}
+
 /**
 * @brief Implementation of @c limitSystemMemory() on MacOS.
 */
@@ -127,6 +173,29 @@ std::size_t getTotalSystemMemoryOnLinux() {
     return rc == 0 ? system_info.totalram : 0;
 }
 
+/**
+* @brief Implementation of @c getCurrentMemoryUsage() on Linux.
+*/
+std::size_t getCurrentMemoryUsageOnLinux() {
+	std::ifstream statm("/proc/self/statm");
+	std::size_t pages = 0;
+	std::size_t residentPages = 0;
+	if (!(statm >> pages >> residentPages)) {
+		return 0;
+	}
+	return residentPages * sysconf(_SC_PAGESIZE);
+}
+
+/**
+* @brief Implementation of @c getPeakMemoryUsage() on Linux.
+*/
+std::size_t getPeakMemoryUsageOnLinux() {
+	struct rusage usage;
+	auto rc = getrusage(RUSAGE_SELF, &usage);
+	// ru_maxrss is in kilobytes on Linux.
+	return rc == 0 ? usage.ru_maxrss * std::size_t(1024) : 0;
+}
+
 /**
 * @brief Implementation of @c limitSystemMemory() on Linux.
 */
@@ -153,6 +222,37 @@ std::size_t getTotalSystemMemory() {
 #endif
 }
 
+/**
+* @brief Returns the current resident-set size of the process (in bytes).
+*
+* When the size cannot be obtained, it returns @c 0.
+*/
+std::size_t getCurrentMemoryUsage() {
+#ifdef OS_WINDOWS
+	return getCurrentMemoryUsageOnWindows();
+#elif defined(OS_MACOS)
+	return getCurrentMemoryUsageOnMacOS();
+#else
+	return getCurrentMemoryUsageOnLinux();
+#endif
+}
+
+/**
+* @brief Returns the peak resident-set size of the process (in bytes).
+*
+* This is the high watermark over the whole lifetime of the process, so it
+* only ever grows. When the size cannot be obtained, it returns @c 0.
+*/
+std::size_t getPeakMemoryUsage() {
+#ifdef OS_WINDOWS
+	return getPeakMemoryUsageOnWindows();
+#elif defined(OS_MACOS)
+	return getPeakMemoryUsageOnMacOS();
+#else
+	return getPeakMemoryUsageOnLinux();
+#endif
+}
+
 /**
 * @brief Limits system memory to the given size (in bytes).
 *
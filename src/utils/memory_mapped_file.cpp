@@ -0,0 +1,285 @@
+/**
+ * @file src/utils/memory_mapped_file.cpp
+ * @brief Read-only memory mapping of a file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdint>
+
+#include "retdec/utils/memory_mapped_file.h"
+
+#ifdef OS_WINDOWS
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+
+namespace {
+
+/// The largest file map() is willing to map on hosts with a 32-bit address
+/// space (1 GiB). Larger mappings would exhaust the address space, so such
+/// callers are made to fall back to their stream-based reading path instead.
+const std::uint64_t MAX_MAPPED_SIZE_ON_32_BIT = 0x40000000;
+
+/**
+ * Checks whether a file of the given size may be mapped on this host
+ * @param fileSize Size of the file in bytes
+ * @return @c true if the file fits into the address space, @c false otherwise
+ */
+bool fitsIntoAddressSpace(std::uint64_t fileSize)
+{
+	return sizeof(std::size_t) >= 8 || fileSize <= MAX_MAPPED_SIZE_ON_32_BIT;
+}
+
+} // anonymous namespace
+
+/**
+ * Constructs an object with no mapped file.
+ */
+MemoryMappedFile::MemoryMappedFile() : data(nullptr), size(0), mapped(false)
+#ifdef OS_WINDOWS
+	, fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr)
+#endif
+{
+}
+
+/**
+ * Destructor -- releases the mapping (if any).
+ */
+MemoryMappedFile::~MemoryMappedFile()
+{
+	unmap();
+}
+
+/**
+ * Maps the file with the given path for reading
+ * @param filePath Path to the file to be mapped
+ * @return @c true if the whole file was successfully mapped, @c false otherwise
+ *
+ * A previous mapping (if any) is released first. An existing but empty file
+ * is successfully "mapped" to no content, i.e. after the call, isMapped()
+ * returns @c true and getSize() returns zero.
+ */
+bool MemoryMappedFile::map(const std::string& filePath)
+{
+	unmap();
+
+#ifdef OS_WINDOWS
+	fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(fileHandle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if(!GetFileSizeEx(fileHandle, &fileSize))
+	{
+		unmap();
+		return false;
+	}
+	if(fileSize.QuadPart == 0)
+	{
+		return mapped = true;
+	}
+	if(!fitsIntoAddressSpace(fileSize.QuadPart))
+	{
+		unmap();
+		return false;
+	}
+
+	mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if(!mappingHandle)
+	{
+		unmap();
+		return false;
+	}
+
+	const auto *view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	if(!view)
+	{
+		unmap();
+		return false;
+	}
+
+	data = static_cast<const unsigned char*>(view);
+	size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+	const auto fd = open(filePath.c_str(), O_RDONLY);
+	if(fd == -1)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == -1 || !S_ISREG(fileStat.st_mode))
+	{
+		close(fd);
+		return false;
+	}
+	if(fileStat.st_size == 0)
+	{
+		close(fd);
+		return mapped = true;
+	}
+	if(!fitsIntoAddressSpace(fileStat.st_size))
+	{
+		close(fd);
+		return false;
+	}
+
+	auto *view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping keeps its own reference to the file, so the descriptor is
+	// no longer needed.
+	close(fd);
+	if(view == MAP_FAILED)
+	{
+		return false;
+	}
+
+	data = static_cast<const unsigned char*>(view);
+	size = static_cast<std::size_t>(fileStat.st_size);
+#endif
+
+	return mapped = true;
+}
+
+/**
+ * Releases the mapping (if any)
+ *
+ * After the call, isMapped() returns @c false.
+ */
+void MemoryMappedFile::unmap()
+{
+#ifdef OS_WINDOWS
+	if(data)
+	{
+		UnmapViewOfFile(data);
+	}
+	if(mappingHandle)
+	{
+		CloseHandle(mappingHandle);
+		mappingHandle = nullptr;
+	}
+	if(fileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(fileHandle);
+		fileHandle = INVALID_HANDLE_VALUE;
+	}
+#else
+	if(data)
+	{
+		munmap(const_cast<unsigned char*>(data), size);
+	}
+#endif
+
+	data = nullptr;
+	size = 0;
+	mapped = false;
+}
+
+/**
+ * Tells the OS how the mapped content is going to be accessed
+ * @param pattern Expected access pattern
+ * @return @c true if the hint was passed to the OS, @c false otherwise
+ *
+ * With @c AccessPattern::Sequential the OS reads ahead aggressively, with
+ * @c AccessPattern::Random it stops reading ahead altogether. The hint is
+ * best-effort: failure only means the default read-ahead stays in effect,
+ * so the return value can safely be ignored.
+ */
+bool MemoryMappedFile::advise(AccessPattern pattern) const
+{
+	if(!data || !size)
+	{
+		return false;
+	}
+
+#ifdef OS_WINDOWS
+	// There is no madvise() counterpart for file mappings on Windows.
+	return false;
+#else
+	int advice = POSIX_MADV_NORMAL;
+	switch(pattern)
+	{
+		case AccessPattern::Sequential:
+			advice = POSIX_MADV_SEQUENTIAL;
+			break;
+		case AccessPattern::Random:
+			advice = POSIX_MADV_RANDOM;
+			break;
+		default:
+			break;
+	}
+	return posix_madvise(const_cast<unsigned char*>(data), size, advice) == 0;
+#endif
+}
+
+/**
+ * Finds out whether a file is currently mapped
+ * @return @c true if a file is mapped, @c false otherwise
+ */
+bool MemoryMappedFile::isMapped() const
+{
+	return mapped;
+}
+
+/**
+ * Returns the content of the mapped file
+ * @return Start of the mapped content or @c nullptr if no file is mapped or
+ *         the mapped file is empty
+ */
+const unsigned char* MemoryMappedFile::getData() const
+{
+	return data;
+}
+
+/**
+ * Returns the size of the mapped file
+ * @return Size of the mapped content in bytes
+ */
+std::size_t MemoryMappedFile::getSize() const
+{
+	return size;
+}
+
+/**
+ * Advises the OS to start reading the given range of memory into the page
+ * cache in the background
+ * @param data Start of the range
+ * @param size Size of the range in bytes
+ * @return @c true if the hint was passed to the OS, @c false otherwise
+ *
+ * The range may point anywhere into a mapped file and is aligned to page
+ * boundaries internally. The hint is best-effort and asynchronous: failure
+ * only means the pages will be faulted in on first access as usual, so the
+ * return value can safely be ignored.
+ */
+bool MemoryMappedFile::prefetch(const void* data, std::size_t size)
+{
+	if(!data || !size)
+	{
+		return false;
+	}
+
+#ifdef OS_WINDOWS
+	// PrefetchVirtualMemory() exists only from Windows 8 on -- rely on the
+	// plain on-demand faulting there.
+	return false;
+#else
+	const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	auto address = reinterpret_cast<std::uintptr_t>(data);
+	const auto misalignment = address % pageSize;
+	return posix_madvise(reinterpret_cast<void*>(address - misalignment),
+		size + misalignment, POSIX_MADV_WILLNEED) == 0;
+#endif
+}
+
+} // namespace utils
+} // namespace retdec
@@ -0,0 +1,82 @@
+/**
+ * @file src/utils/string_pool.cpp
+ * @brief Interning pool for immutable strings.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/utils/string_pool.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Interns the given string.
+ * @param s String to intern.
+ * @return Reference to the single pooled copy of @a s.
+ */
+const std::string& StringPool::intern(const std::string& s)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return *_strings.insert(s).first;
+}
+
+/**
+ * Interns the given string without copying it if it is not pooled yet.
+ * @param s String to intern.
+ * @return Reference to the single pooled copy of @a s.
+ */
+const std::string& StringPool::intern(std::string&& s)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return *_strings.insert(std::move(s)).first;
+}
+
+/**
+ * @return Number of distinct strings in the pool.
+ */
+std::size_t StringPool::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _strings.size();
+}
+
+namespace {
+
+/**
+ * @return The process-wide pool. The pool is leaked on purpose -- interned
+ * names may be referenced by objects destroyed after static destruction of
+ * this translation unit would have run.
+ */
+StringPool& getProcessPool()
+{
+	static StringPool* pool = new StringPool();
+	return *pool;
+}
+
+} // anonymous namespace
+
+/**
+ * Interns the given string in the process-wide pool.
+ * @param s String to intern.
+ * @return Reference to the single pooled copy of @a s, valid for the whole
+ * lifetime of the process.
+ */
+const std::string& internString(const std::string& s)
+{
+	return getProcessPool().intern(s);
+}
+
+/**
+ * Interns the given string in the process-wide pool without copying it if it
+ * is not pooled yet.
+ * @param s String to intern.
+ * @return Reference to the single pooled copy of @a s, valid for the whole
+ * lifetime of the process.
+ */
+const std::string& internString(std::string&& s)
+{
+	return getProcessPool().intern(std::move(s));
+}
+
+} // namespace utils
+} // namespace retdec
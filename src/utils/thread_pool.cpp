@@ -0,0 +1,142 @@
+/**
+* @file src/utils/thread_pool.cpp
+* @brief Worker threads with a process-wide concurrency budget.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace utils {
+
+namespace {
+
+/// Budget set by setMaxParallelism() (0 means "size by the hardware").
+std::atomic<std::size_t> userMaxParallelism(0);
+
+/// Number of extra worker threads currently running in some parallel region.
+/// The calling threads of the regions are not counted -- they are part of
+/// the budget by definition.
+std::atomic<std::size_t> busyExtraThreads(0);
+
+/**
+* @brief Reserves up to @a wanted extra worker threads from the free part of
+*        the budget.
+* @return Number of threads actually reserved (may be zero).
+*/
+std::size_t reserveExtraThreads(std::size_t wanted) {
+	const auto budget = maxParallelism();
+	if (budget <= 1 || wanted == 0) {
+		return 0;
+	}
+
+	const std::size_t budgetExtra = budget - 1;
+	auto busy = busyExtraThreads.load();
+	while (true) {
+		if (busy >= budgetExtra) {
+			return 0;
+		}
+		const auto granted = std::min(wanted, budgetExtra - busy);
+		if (busyExtraThreads.compare_exchange_weak(busy, busy + granted)) {
+			return granted;
+		}
+	}
+}
+
+/**
+* @brief Returns @a count extra worker threads to the budget.
+*/
+void releaseExtraThreads(std::size_t count) {
+	busyExtraThreads -= count;
+}
+
+} // anonymous namespace
+
+/**
+* @brief Returns the process-wide concurrency budget.
+*
+* The budget is the value set by setMaxParallelism(), or the number of
+* hardware threads when nothing was set. It is always at least 1.
+*/
+std::size_t maxParallelism() {
+	const auto userMax = userMaxParallelism.load();
+	if (userMax > 0) {
+		return userMax;
+	}
+	const std::size_t hardwareMax = std::thread::hardware_concurrency();
+	return std::max<std::size_t>(hardwareMax, 1);
+}
+
+/**
+* @brief Sets the process-wide concurrency budget to @a threads.
+*
+* Zero restores the default (the number of hardware threads). The new budget
+* applies to parallel regions started after the call; running regions keep
+* the workers they already have.
+*/
+void setMaxParallelism(std::size_t threads) {
+	userMaxParallelism = threads;
+}
+
+/**
+* @brief Runs @a worker concurrently on the calling thread and on up to
+*        @a maxWorkers - 1 extra threads, and waits until all of them return.
+*
+* The worker is expected to claim its work items from some shared source
+* (typically an atomic counter) until the source is exhausted, so it is
+* correct for any number of its instances to run -- the number only affects
+* speed. Extra threads are taken from the free part of the process-wide
+* budget; when the budget is saturated (e.g. when the caller itself runs
+* inside a parallel region), the worker runs once on the calling thread and
+* no threads are spawned.
+*/
+void runWorkers(std::size_t maxWorkers, const std::function<void()> &worker) {
+	const auto extra = maxWorkers > 1
+		? reserveExtraThreads(maxWorkers - 1)
+		: 0;
+
+	std::vector<std::thread> threads;
+	threads.reserve(extra);
+	for (std::size_t i = 0; i < extra; ++i) {
+		threads.emplace_back(worker);
+	}
+
+	worker();
+
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	releaseExtraThreads(extra);
+}
+
+/**
+* @brief Calls <tt>action(i)</tt> for every <tt>i</tt> in
+*        <tt>[0, count)</tt>, distributing the calls over workers from the
+*        process-wide budget.
+*
+* The calls run in an unspecified order and possibly concurrently, so the
+* action must not touch shared state without synchronization. The function
+* returns after all calls have finished.
+*/
+void parallelFor(std::size_t count,
+		const std::function<void(std::size_t)> &action) {
+	if (count == 0) {
+		return;
+	}
+
+	std::atomic<std::size_t> nextIndex(0);
+	runWorkers(count, [&]() {
+		std::size_t index;
+		while ((index = nextIndex.fetch_add(1)) < count) {
+			action(index);
+		}
+	});
+}
+
+} // namespace utils
+} // namespace retdec
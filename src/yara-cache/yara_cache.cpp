@@ -0,0 +1,143 @@
+/**
+ * @file src/yara-cache/yara_cache.cpp
+ * @brief Persistent cache of compiled YARA rule files.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include <yara.h>
+
+#include "retdec/crypto/crypto.h"
+#include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/instrumentation.h"
+#include "retdec/utils/memory_mapped_file.h"
+#include "retdec/yara-cache/yara_cache.h"
+
+namespace retdec {
+namespace yara_cache {
+
+namespace {
+
+/// Guards the memoization table and the one-time libyara initialization.
+std::mutex cacheMutex;
+
+/// Maps a rule file path to the compiled file path resolved for it, so repeat
+/// jobs in one process skip the hashing and compilation entirely.
+std::unordered_map<std::string, std::string> resolvedFiles;
+
+/**
+ * Checks whether the file content is already in the compiled rules format
+ * @param content Content of a rule file
+ * @param size Size of the content in bytes
+ * @return @c true if the content starts with the compiled rules magic
+ */
+bool isCompiledContent(const unsigned char *content, std::size_t size)
+{
+	return size >= 4 && std::memcmp(content, "YARA", 4) == 0;
+}
+
+/**
+ * Compiles the textual rules into the given file
+ * @param ruleFile Path to the textual rule file
+ * @param compiledFile Path the compiled form is saved to
+ * @return @c true if the compiled file was successfully written
+ */
+bool compileRuleFile(const std::string &ruleFile, const std::string &compiledFile)
+{
+	static std::once_flag libyaraInitialized;
+	std::call_once(libyaraInitialized, []() { yr_initialize(); });
+
+	auto *file = std::fopen(ruleFile.c_str(), "rb");
+	if (!file)
+	{
+		return false;
+	}
+
+	YR_COMPILER *compiler = nullptr;
+	if (yr_compiler_create(&compiler) != ERROR_SUCCESS)
+	{
+		std::fclose(file);
+		return false;
+	}
+
+	YR_RULES *rules = nullptr;
+	bool result = yr_compiler_add_file(compiler, file, nullptr, ruleFile.c_str()) == 0
+		&& yr_compiler_get_rules(compiler, &rules) == ERROR_SUCCESS
+		&& yr_rules_save(rules, compiledFile.c_str()) == ERROR_SUCCESS;
+
+	if (rules)
+	{
+		yr_rules_destroy(rules);
+	}
+	yr_compiler_destroy(compiler);
+	std::fclose(file);
+
+	if (!result)
+	{
+		std::remove(compiledFile.c_str());
+	}
+	return result;
+}
+
+} // anonymous namespace
+
+/**
+ * Returns a path to the compiled form of the given YARA rule file
+ * @param ruleFile Path to a rule file (textual or already compiled)
+ * @return Path to a compiled rule file, or @a ruleFile itself when no
+ *         compiled form is available
+ *
+ * Already compiled files are returned unchanged. A textual file is compiled
+ * at most once: the compiled form is stored beside it, keyed by the hash of
+ * its content (<tt>&lt;file&gt;.&lt;crc32&gt;.yarac</tt>), so later runs --
+ * and other processes -- reuse it instead of re-compiling the text. When the
+ * content of the rule file changes, the key changes with it and a fresh
+ * compilation is made. If the cache cannot be created (e.g. the directory is
+ * not writable), the original file is returned and the caller compiles the
+ * text as before.
+ */
+std::string getCompiledRuleFile(const std::string &ruleFile)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	auto memoized = resolvedFiles.find(ruleFile);
+	if (memoized != resolvedFiles.end())
+	{
+		return memoized->second;
+	}
+
+	// The file is only inspected and hashed here, so its content is served
+	// straight from the page cache instead of being copied into a string.
+	retdec::utils::MemoryMappedFile input;
+	if (!input.map(ruleFile) || isCompiledContent(input.getData(), input.getSize()))
+	{
+		resolvedFiles.emplace(ruleFile, ruleFile);
+		return ruleFile;
+	}
+
+	input.advise(retdec::utils::MemoryMappedFile::AccessPattern::Sequential);
+	const auto contentHash = retdec::crypto::getCrc32(input.getData(), input.getSize());
+	const auto compiledFile = ruleFile + "." + contentHash + ".yarac";
+
+	auto result = ruleFile;
+	if (retdec::utils::FilesystemPath(compiledFile).isFile())
+	{
+		retdec::utils::instrumentation::incrementCounter("yara-cache/hits");
+		result = compiledFile;
+	}
+	else if (compileRuleFile(ruleFile, compiledFile))
+	{
+		retdec::utils::instrumentation::incrementCounter("yara-cache/compilations");
+		result = compiledFile;
+	}
+
+	resolvedFiles.emplace(ruleFile, result);
+	return result;
+}
+
+} // namespace yara_cache
+} // namespace retdec
@@ -0,0 +1,103 @@
+/**
+* @file tests/bin2llvmir/analyses/analysis_manager_tests.cpp
+* @brief Tests for the @c AnalysisManager.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/analyses/analysis_manager.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c AnalysisManager.
+ */
+class AnalysisManagerTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(AnalysisManagerTests, VersionDoesNotChangeWithoutModification)
+{
+	parseInput(R"(
+		define void @fnc() {
+			ret void
+		}
+	)");
+	auto* f = getFunctionByName("fnc");
+
+	auto v1 = AnalysisManager::getVersion(f);
+	auto v2 = AnalysisManager::getVersion(f);
+
+	EXPECT_EQ(v1, v2);
+}
+
+TEST_F(AnalysisManagerTests, ReportModifiedFunctionChangesItsVersion)
+{
+	parseInput(R"(
+		define void @fnc() {
+			ret void
+		}
+		define void @fnc2() {
+			ret void
+		}
+	)");
+	auto* f1 = getFunctionByName("fnc");
+	auto* f2 = getFunctionByName("fnc2");
+
+	auto v1 = AnalysisManager::getVersion(f1);
+	auto o1 = AnalysisManager::getVersion(f2);
+	AnalysisManager::reportModified(f1);
+
+	EXPECT_NE(v1, AnalysisManager::getVersion(f1));
+	EXPECT_EQ(o1, AnalysisManager::getVersion(f2));
+}
+
+TEST_F(AnalysisManagerTests, ReportModifiedModuleChangesAllFunctionVersions)
+{
+	parseInput(R"(
+		define void @fnc() {
+			ret void
+		}
+	)");
+	auto* f = getFunctionByName("fnc");
+
+	auto v1 = AnalysisManager::getVersion(f);
+	AnalysisManager::reportModified(module.get());
+
+	EXPECT_NE(v1, AnalysisManager::getVersion(f));
+}
+
+TEST_F(AnalysisManagerTests, FunctionAnalysisCacheRecomputesOnlyDirtyFunctions)
+{
+	parseInput(R"(
+		define void @fnc() {
+			ret void
+		}
+	)");
+	auto* f = getFunctionByName("fnc");
+
+	unsigned computed = 0;
+	FunctionAnalysisCache<int> cache;
+	auto compute = [&computed](Function*) { return int(++computed); };
+
+	EXPECT_EQ(1, cache.get(f, compute));
+	EXPECT_EQ(1, cache.get(f, compute));
+	EXPECT_EQ(1u, computed);
+
+	AnalysisManager::reportModified(f);
+
+	EXPECT_EQ(2, cache.get(f, compute));
+	EXPECT_EQ(2u, computed);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
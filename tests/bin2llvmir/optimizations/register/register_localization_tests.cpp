@@ -0,0 +1,183 @@
+/**
+* @file tests/bin2llvmir/optimizations/register/register_localization_tests.cpp
+* @brief Tests for the @c RegisterLocalization pass.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/optimizations/register/register_localization.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c RegisterLocalization pass.
+ */
+class RegisterLocalizationTests: public LlvmIrTests
+{
+	protected:
+		RegisterLocalization pass;
+};
+
+TEST_F(RegisterLocalizationTests, passDoesNotSegfaultAndReturnsFalseIfConfigForModuleDoesNotExists)
+{
+	bool b = pass.runOnModule(*module);
+
+	EXPECT_FALSE(b);
+}
+
+TEST_F(RegisterLocalizationTests, passDoesNotSegfaultAndReturnsFalseIfNullptrConfigPassed)
+{
+	bool b = pass.runOnModuleCustom(*module, nullptr);
+
+	EXPECT_FALSE(b);
+}
+
+TEST_F(RegisterLocalizationTests, passLocalizesRegisterAccessesAndSyncsBeforeReturn)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		define i32 @func() {
+		entry:
+			%a = load i32, i32* @eax
+			%b = add i32 %a, 1
+			store i32 %b, i32* @eax
+			ret i32 %b
+		}
+	)");
+	auto s = retdec::config::Storage::inRegister("eax");
+	auto r = retdec::config::Object("eax", s);
+	auto c = Config::empty(module.get());
+	c.getConfig().registers.insert(r);
+
+	bool b = pass.runOnModuleCustom(*module, &c);
+
+	std::string exp = R"(
+		@eax = global i32 0
+		define i32 @func() {
+		entry:
+			%eax.reg-localized = alloca i32
+			%0 = load i32, i32* @eax
+			store i32 %0, i32* %eax.reg-localized
+			%a = load i32, i32* %eax.reg-localized
+			%b = add i32 %a, 1
+			store i32 %b, i32* %eax.reg-localized
+			%1 = load i32, i32* %eax.reg-localized
+			store i32 %1, i32* @eax
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(b);
+}
+
+TEST_F(RegisterLocalizationTests, passSpillsAndReloadsRegisterAroundCalls)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		declare void @g()
+		define void @func() {
+		entry:
+			store i32 123, i32* @eax
+			call void @g()
+			%a = load i32, i32* @eax
+			ret void
+		}
+	)");
+	auto s = retdec::config::Storage::inRegister("eax");
+	auto r = retdec::config::Object("eax", s);
+	auto c = Config::empty(module.get());
+	c.getConfig().registers.insert(r);
+
+	bool b = pass.runOnModuleCustom(*module, &c);
+
+	std::string exp = R"(
+		@eax = global i32 0
+		declare void @g()
+		define void @func() {
+		entry:
+			%eax.reg-localized = alloca i32
+			%0 = load i32, i32* @eax
+			store i32 %0, i32* %eax.reg-localized
+			store i32 123, i32* %eax.reg-localized
+			%1 = load i32, i32* %eax.reg-localized
+			store i32 %1, i32* @eax
+			call void @g()
+			%2 = load i32, i32* @eax
+			store i32 %2, i32* %eax.reg-localized
+			%a = load i32, i32* %eax.reg-localized
+			%3 = load i32, i32* %eax.reg-localized
+			store i32 %3, i32* @eax
+			ret void
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(b);
+}
+
+TEST_F(RegisterLocalizationTests, passKeepsRegisterWhoseAddressIsTaken)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		declare void @g(i32*)
+		define void @func() {
+		entry:
+			store i32 1, i32* @eax
+			call void @g(i32* @eax)
+			ret void
+		}
+	)");
+	auto s = retdec::config::Storage::inRegister("eax");
+	auto r = retdec::config::Object("eax", s);
+	auto c = Config::empty(module.get());
+	c.getConfig().registers.insert(r);
+
+	bool b = pass.runOnModuleCustom(*module, &c);
+
+	std::string exp = R"(
+		@eax = global i32 0
+		declare void @g(i32*)
+		define void @func() {
+		entry:
+			store i32 1, i32* @eax
+			call void @g(i32* @eax)
+			ret void
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_FALSE(b);
+}
+
+TEST_F(RegisterLocalizationTests, passKeepsNonRegisterGlobals)
+{
+	parseInput(R"(
+		@glob = global i32 0
+		define void @func() {
+		entry:
+			store i32 1, i32* @glob
+			ret void
+		}
+	)");
+	auto c = Config::empty(module.get());
+
+	bool b = pass.runOnModuleCustom(*module, &c);
+
+	std::string exp = R"(
+		@glob = global i32 0
+		define void @func() {
+		entry:
+			store i32 1, i32* @glob
+			ret void
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_FALSE(b);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -0,0 +1,67 @@
+/**
+* @file tests/bin2llvmir/providers/providers_tests.cpp
+* @brief Tests for the @c Providers lifetime management.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/providers/providers.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c Providers lifetime management.
+ */
+class ProvidersTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(ProvidersTests, eraseRemovesModuleData)
+{
+	ConfigProvider::addConfigJsonString(module.get(), "{}");
+	EXPECT_NE(nullptr, ConfigProvider::getConfig(module.get()));
+
+	Providers::erase(module.get());
+
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+}
+
+TEST_F(ProvidersTests, providerScopeErasesModuleDataOnDestruction)
+{
+	{
+		ProviderScope scope(module.get());
+
+		ConfigProvider::addConfigJsonString(module.get(), "{}");
+		EXPECT_NE(nullptr, ConfigProvider::getConfig(module.get()));
+	}
+
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+}
+
+TEST_F(ProvidersTests, eraseKeepsDataOfOtherModules)
+{
+	LLVMContext ctx;
+	Module other("other", ctx);
+
+	ConfigProvider::addConfigJsonString(module.get(), "{}");
+	ConfigProvider::addConfigJsonString(&other, "{}");
+
+	Providers::erase(module.get());
+
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+	EXPECT_NE(nullptr, ConfigProvider::getConfig(&other));
+
+	Providers::erase(&other);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
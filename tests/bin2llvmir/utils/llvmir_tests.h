@@ -19,6 +19,7 @@
 #include "retdec/llvm-support/tests/llvmir_tests.h"
 #include "retdec/llvm-support/utils.h"
 #include "retdec/utils/string.h"
+#include "retdec/bin2llvmir/analyses/analysis_manager.h"
 #include "retdec/bin2llvmir/providers/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
@@ -26,6 +27,7 @@
 #include "retdec/bin2llvmir/providers/demangler.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/providers.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
 #include "retdec/loader/loader.h"
@@ -46,13 +48,7 @@ class LlvmIrTests : public retdec::llvm_support::tests::LlvmIrTests
 		 */
 		void clearAllStaticData()
 		{
-			AbiProvider::clear();
-			ConfigProvider::clear();
-			DebugFormatProvider::clear();
-			DemanglerProvider::clear();
-			FileImageProvider::clear();
-			AsmInstruction::clear();
-			LtiProvider::clear();
+			Providers::clear();
 		}
 
 		/**
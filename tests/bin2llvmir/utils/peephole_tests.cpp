@@ -0,0 +1,113 @@
+/**
+ * @file tests/bin2llvmir/utils/tests/peephole_tests.cpp
+ * @brief Tests for the @c PeepholeEngine.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/utils/peephole.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c PeepholeEngine.
+ */
+class PeepholeEngineTests: public LlvmIrTests
+{
+
+};
+
+/**
+ * add x, 0 -> x, erases the add.
+ */
+static bool addZeroRule(llvm::Instruction* i)
+{
+	auto* ci = dyn_cast<ConstantInt>(i->getOperand(1));
+	if (ci == nullptr || !ci->isZero())
+	{
+		return false;
+	}
+	i->replaceAllUsesWith(i->getOperand(0));
+	i->eraseFromParent();
+	return true;
+}
+
+TEST_F(PeepholeEngineTests, ruleIsAppliedToMatchingOpcode)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = add i32 %a, 0
+			ret i32 %b
+		}
+	)");
+
+	PeepholeEngine engine;
+	engine.addRule(Instruction::Add, &addZeroRule);
+	bool b = engine.runOnModule(*module);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			ret i32 %a
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(b);
+}
+
+TEST_F(PeepholeEngineTests, ruleIsNotAppliedToOtherOpcodes)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = sub i32 %a, 0
+			ret i32 %b
+		}
+	)");
+
+	PeepholeEngine engine;
+	engine.addRule(Instruction::Add, &addZeroRule);
+	bool b = engine.runOnModule(*module);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			%b = sub i32 %a, 0
+			ret i32 %b
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_FALSE(b);
+}
+
+TEST_F(PeepholeEngineTests, rewritesCascadeToFixpoint)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %a) {
+			%b = add i32 %a, 0
+			%c = add i32 %b, 0
+			%d = add i32 %c, 0
+			ret i32 %d
+		}
+	)");
+
+	PeepholeEngine engine;
+	engine.addRule(Instruction::Add, &addZeroRule);
+	bool b = engine.runOnModule(*module);
+
+	std::string exp = R"(
+		define i32 @fnc(i32 %a) {
+			ret i32 %a
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(b);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
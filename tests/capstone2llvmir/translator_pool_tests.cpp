@@ -0,0 +1,103 @@
+/**
+ * @file tests/capstone2llvmir/translator_pool_tests.cpp
+ * @brief Capstone2LlvmIrTranslatorPool unit tests.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include "retdec/capstone2llvmir/translator_pool.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace capstone2llvmir {
+namespace tests {
+
+class Capstone2LlvmIrTranslatorPoolTests : public Test
+{
+	protected:
+		llvm::LLVMContext _ctx1;
+		llvm::LLVMContext _ctx2;
+		llvm::Module _module1 = llvm::Module("test1", _ctx1);
+		llvm::Module _module2 = llvm::Module("test2", _ctx2);
+};
+
+TEST_F(Capstone2LlvmIrTranslatorPoolTests, poolCreatesOneInstancePerModule)
+{
+	Capstone2LlvmIrTranslatorPool pool(
+			CS_ARCH_X86,
+			{&_module1, &_module2},
+			CS_MODE_32);
+
+	EXPECT_EQ(2, pool.size());
+}
+
+TEST_F(Capstone2LlvmIrTranslatorPoolTests, checkedOutInstancesAreDistinct)
+{
+	Capstone2LlvmIrTranslatorPool pool(
+			CS_ARCH_X86,
+			{&_module1, &_module2},
+			CS_MODE_32);
+
+	auto t1 = pool.checkOut();
+	auto t2 = pool.checkOut();
+
+	EXPECT_NE(nullptr, t1.get());
+	EXPECT_NE(nullptr, t2.get());
+	EXPECT_NE(t1.get(), t2.get());
+	EXPECT_EQ(CS_ARCH_X86, t1->getArchitecture());
+}
+
+TEST_F(Capstone2LlvmIrTranslatorPoolTests, guardChecksInstanceBackIn)
+{
+	Capstone2LlvmIrTranslatorPool pool(
+			CS_ARCH_X86,
+			{&_module1},
+			CS_MODE_32);
+
+	Capstone2LlvmIrTranslator* first = nullptr;
+	{
+		auto t = pool.checkOut();
+		first = t.get();
+	}
+
+	// The single instance was checked back in -- this does not block.
+	auto t = pool.checkOut();
+	EXPECT_EQ(first, t.get());
+}
+
+TEST_F(Capstone2LlvmIrTranslatorPoolTests, checkOutBlocksUntilInstanceIsCheckedIn)
+{
+	Capstone2LlvmIrTranslatorPool pool(
+			CS_ARCH_X86,
+			{&_module1},
+			CS_MODE_32);
+
+	std::atomic<bool> released(false);
+	std::thread other;
+	{
+		auto t = pool.checkOut();
+
+		other = std::thread([&]()
+		{
+			auto t2 = pool.checkOut();
+			EXPECT_NE(nullptr, t2.get());
+			EXPECT_TRUE(released.load());
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		released = true;
+	}
+	other.join();
+}
+
+} // namespace tests
+} // namespace capstone2llvmir
+} // namespace retdec
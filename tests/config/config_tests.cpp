@@ -75,6 +75,85 @@ TEST_F(ConfigTests, SuccessfulReadJsonStringResetsAllConfigData)
 	EXPECT_TRUE(config.parameters.abiPaths.empty());
 }
 
+TEST_F(ConfigTests, LazyDecodingParameterIsReadFromJson)
+{
+	std::string jsonContent = "{ \"decompParams\" : { \"lazyDecoding\" : true } }";
+
+	ASSERT_NO_THROW(config.readJsonString(jsonContent));
+
+	EXPECT_TRUE(config.parameters.isLazyDecoding());
+}
+
+TEST_F(ConfigTests, LazyDecodingParameterIsFalseByDefault)
+{
+	ASSERT_NO_THROW(config.readJsonString("{}"));
+
+	EXPECT_FALSE(config.parameters.isLazyDecoding());
+}
+
+TEST_F(ConfigTests, IncrementalParameterIsReadFromJson)
+{
+	std::string jsonContent = "{ \"decompParams\" : { \"incremental\" : true } }";
+
+	ASSERT_NO_THROW(config.readJsonString(jsonContent));
+
+	EXPECT_TRUE(config.parameters.isIncremental());
+}
+
+TEST_F(ConfigTests, IncrementalParameterIsFalseByDefault)
+{
+	ASSERT_NO_THROW(config.readJsonString("{}"));
+
+	EXPECT_FALSE(config.parameters.isIncremental());
+}
+
+TEST_F(ConfigTests, StaticCodeDecodingParameterIsReadFromJson)
+{
+	std::string jsonContent = "{ \"decompParams\" : { \"staticCodeDecoding\" : true } }";
+
+	ASSERT_NO_THROW(config.readJsonString(jsonContent));
+
+	EXPECT_TRUE(config.parameters.isStaticCodeDecoding());
+}
+
+TEST_F(ConfigTests, StaticCodeDecodingParameterIsFalseByDefault)
+{
+	ASSERT_NO_THROW(config.readJsonString("{}"));
+
+	EXPECT_FALSE(config.parameters.isStaticCodeDecoding());
+}
+
+TEST_F(ConfigTests, ReadJsonStringReadsJsonWithComments)
+{
+	std::string jsonContent = "{ // comment\n"
+			"\"inputFile\" : \"/input/1\",\n"
+			"\"functions\" : [ { \"name\" : \"fnc\" } ] }";
+
+	ASSERT_NO_THROW(config.readJsonString(jsonContent));
+
+	EXPECT_EQ("/input/1", config.getInputFile());
+	EXPECT_NE(nullptr, config.functions.getFunctionByName("fnc"));
+}
+
+TEST_F(ConfigTests, ReadJsonStringThrowsParseExceptionOnWrongValueType)
+{
+	ASSERT_THROW(config.readJsonString("{ \"inputFile\" : 5 }"), ParseException);
+}
+
+TEST_F(ConfigTests, FunctionContentHashSurvivesJsonRoundTrip)
+{
+	retdec::config::Function f("fnc");
+	f.setContentHash("aabbccdd");
+	config.functions.insert(f);
+
+	retdec::config::Config loaded;
+	ASSERT_NO_THROW(loaded.readJsonString(config.generateJsonString()));
+
+	auto* lf = loaded.functions.getFunctionByName("fnc");
+	ASSERT_NE(nullptr, lf);
+	EXPECT_EQ("aabbccdd", lf->getContentHash());
+}
+
 TEST_F(ConfigTests, ClassesGetElementByIdReturnsNullPointerWhenThereIsNoSuchClass)
 {
 	ASSERT_EQ(nullptr, config.classes.getElementById("ClassName"));
@@ -32,6 +32,73 @@ const unsigned char elfBytes[] =
 
 };
 
+
+// The following two files are hand-crafted minimal ELFs whose only payload
+// is a dynamic symbol table ("malloc", "free" and "calloc") reachable through
+// a hash section. The first one carries a .gnu.hash section (one bucket, one
+// 32-bit Bloom word, shift 5), the second one a SysV .hash section (two
+// buckets). They back the getDynamicSymbol() tests below.
+
+const unsigned char elfGnuHashBytes[] =
+{
+0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x12, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x12, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x12, 0x00, 0x01, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x00, 0x66, 0x72, 0x65, 0x65,
+0x00, 0x63, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x90, 0x02, 0x88, 0x20, 0x01, 0x00, 0x00, 0x00,
+0x3c, 0xad, 0x39, 0x0d, 0x86, 0xf0, 0x96, 0x7c, 0xf3, 0x16, 0xe6, 0xf5, 0x00, 0x2e, 0x64, 0x79,
+0x6e, 0x73, 0x79, 0x6d, 0x00, 0x2e, 0x64, 0x79, 0x6e, 0x73, 0x74, 0x72, 0x00, 0x2e, 0x67, 0x6e,
+0x75, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+0x74, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+0xf6, 0xff, 0xff, 0x6f, 0x02, 0x00, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const unsigned char elfSysvHashBytes[] =
+{
+0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x12, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x12, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x12, 0x00, 0x01, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x00, 0x66, 0x72, 0x65, 0x65,
+0x00, 0x63, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x64, 0x79, 0x6e, 0x73, 0x79, 0x6d,
+0x00, 0x2e, 0x64, 0x79, 0x6e, 0x73, 0x74, 0x72, 0x00, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x00, 0x2e,
+0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+0x34, 0x04, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x74, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+0x88, 0x04, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00,
+};
+
 } // anonymous namespace
 
 namespace retdec {
@@ -99,6 +166,132 @@ TEST_F(ElfFormatTests, DataInterpretationBig)
 	EXPECT_EQ(0x7f454c4601010148, res);
 }
 
+/**
+ * Tests for dynamic symbol lookups through the @c .gnu.hash section
+ */
+class ElfGnuHashLookupTests : public Test
+{
+	private:
+		std::string elfString;
+		std::stringstream elfStringStream;
+	protected:
+		ElfFormat *parser;
+	public:
+		ElfGnuHashLookupTests()
+		{
+			for(const auto &item : elfGnuHashBytes)
+			{
+				elfString += item;
+			}
+
+			elfStringStream << elfString;
+			parser = new ElfFormat(elfStringStream);
+		}
+
+		~ElfGnuHashLookupTests()
+		{
+			delete parser;
+		}
+};
+
+TEST_F(ElfGnuHashLookupTests, FindsExistingSymbols)
+{
+	ASSERT_EQ(true, parser->isInValidState());
+
+	const auto *first = parser->getDynamicSymbol("malloc");
+	ASSERT_NE(nullptr, first);
+	EXPECT_EQ("malloc", first->getName());
+
+	// "calloc" terminates the hash chain, so a hit on it proves the whole
+	// chain is walked.
+	const auto *last = parser->getDynamicSymbol("calloc");
+	ASSERT_NE(nullptr, last);
+	EXPECT_EQ("calloc", last->getName());
+	unsigned long long address = 0;
+	EXPECT_EQ(true, last->getAddress(address));
+	EXPECT_EQ(0x1020, address);
+}
+
+TEST_F(ElfGnuHashLookupTests, MissesNameRejectedByBloomFilter)
+{
+	// "aaaa" does not have both of its bits set in the Bloom word, so the
+	// lookup fails without ever touching the buckets.
+	EXPECT_EQ(nullptr, parser->getDynamicSymbol("aaaa"));
+}
+
+TEST_F(ElfGnuHashLookupTests, MissesAbsentNamePassingBloomFilter)
+{
+	// "aaex" passes the Bloom filter, so the lookup has to walk the chain
+	// of the only bucket all the way to its terminating entry.
+	EXPECT_EQ(nullptr, parser->getDynamicSymbol("aaex"));
+}
+
+TEST_F(ElfGnuHashLookupTests, GetSymbolIsAnsweredFromHashSection)
+{
+	const auto *symbol = parser->getSymbol(std::string("free"));
+	ASSERT_NE(nullptr, symbol);
+	EXPECT_EQ("free", symbol->getName());
+	EXPECT_EQ(symbol, parser->getDynamicSymbol("free"));
+}
+
+/**
+ * Tests for dynamic symbol lookups through the SysV @c .hash section
+ */
+class ElfSysvHashLookupTests : public Test
+{
+	private:
+		std::string elfString;
+		std::stringstream elfStringStream;
+	protected:
+		ElfFormat *parser;
+	public:
+		ElfSysvHashLookupTests()
+		{
+			for(const auto &item : elfSysvHashBytes)
+			{
+				elfString += item;
+			}
+
+			elfStringStream << elfString;
+			parser = new ElfFormat(elfStringStream);
+		}
+
+		~ElfSysvHashLookupTests()
+		{
+			delete parser;
+		}
+};
+
+TEST_F(ElfSysvHashLookupTests, FindsExistingSymbols)
+{
+	ASSERT_EQ(true, parser->isInValidState());
+
+	// All three symbols hash into the same bucket, so "malloc" sits at the
+	// very end of the chain.
+	const auto *first = parser->getDynamicSymbol("malloc");
+	ASSERT_NE(nullptr, first);
+	EXPECT_EQ("malloc", first->getName());
+
+	const auto *head = parser->getDynamicSymbol("calloc");
+	ASSERT_NE(nullptr, head);
+	EXPECT_EQ("calloc", head->getName());
+}
+
+TEST_F(ElfSysvHashLookupTests, MissesAbsentNameAfterWalkingChainToEnd)
+{
+	// "aaaa" hashes into the occupied bucket, so the lookup walks the whole
+	// chain and stops at its STN_UNDEF terminator.
+	EXPECT_EQ(nullptr, parser->getDynamicSymbol("aaaa"));
+}
+
+TEST_F(ElfSysvHashLookupTests, GetSymbolIsAnsweredFromHashSection)
+{
+	const auto *symbol = parser->getSymbol(std::string("free"));
+	ASSERT_NE(nullptr, symbol);
+	EXPECT_EQ("free", symbol->getName());
+	EXPECT_EQ(symbol, parser->getDynamicSymbol("free"));
+}
+
 } // namespace tests
 } // namespace fileformat
 } // namespace retdec
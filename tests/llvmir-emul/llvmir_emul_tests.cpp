@@ -329,6 +329,31 @@ TEST_F(LlvmIrEmulatorTests, setMemoryValue)
 	EXPECT_EQ(200, emu.getMemoryValue(2000).IntVal.getZExtValue());
 }
 
+TEST_F(LlvmIrEmulatorTests, memoryValuesInDifferentPagesDoNotAffectEachOther)
+{
+	parseInput(R"(
+		define i32 @f() {
+			ret i32 0
+		}
+	)");
+	GenericValue v1;
+	v1.IntVal = APInt(32, 11);
+	GenericValue v2;
+	v2.IntVal = APInt(32, 22);
+	GenericValue v3;
+	v3.IntVal = APInt(32, 33);
+
+	LlvmIrEmulator emu(module.get());
+	emu.setMemoryValue(0xfff, v1);      // The last slot of the first page.
+	emu.setMemoryValue(0x1000, v2);     // The first slot of the second page.
+	emu.setMemoryValue(0x12345678, v3); // A page far away.
+
+	EXPECT_EQ(11, emu.getMemoryValue(0xfff).IntVal.getZExtValue());
+	EXPECT_EQ(22, emu.getMemoryValue(0x1000).IntVal.getZExtValue());
+	EXPECT_EQ(33, emu.getMemoryValue(0x12345678).IntVal.getZExtValue());
+	EXPECT_EQ(GenericValue().IntVal, emu.getMemoryValue(0x2000).IntVal);
+}
+
 //
 // x86_fp80 test
 //
@@ -363,6 +388,92 @@ TEST_F(LlvmIrEmulatorTests, usingOf_x86_fp80_Type)
 	EXPECT_DOUBLE_EQ(3.0, emu.getGlobalVariableValue(st0).DoubleVal);
 }
 
+//
+// Known runtime routine fast paths.
+//
+
+TEST_F(LlvmIrEmulatorTests, knownRoutineMemsetIsEmulatedNatively)
+{
+	parseInput(R"(
+		declare i8* @memset(i8*, i32, i32)
+		define i32 @f() {
+			%a = call i8* @memset(
+					i8* inttoptr (i64 4096 to i8*),
+					i32 65,
+					i32 4)
+			ret i32 0
+		}
+	)");
+	auto* f = getFunctionByName("f");
+	auto* memsetFnc = getFunctionByName("memset");
+
+	LlvmIrEmulator emu(module.get());
+	EXPECT_TRUE(emu.isKnownRoutine(memsetFnc));
+	emu.runFunction(f);
+
+	EXPECT_TRUE(emu.wasValueCalled(memsetFnc));
+	for (uint64_t i = 0; i < 4; ++i)
+	{
+		EXPECT_EQ(65, emu.getMemoryValue(4096 + i).IntVal.getZExtValue());
+	}
+	EXPECT_EQ(
+			GenericValue().IntVal,
+			emu.getMemoryValue(4096 + 4).IntVal);
+}
+
+TEST_F(LlvmIrEmulatorTests, knownRoutineMemcpyIsEmulatedNatively)
+{
+	parseInput(R"(
+		declare i8* @memcpy(i8*, i8*, i32)
+		define i32 @f() {
+			%a = call i8* @memcpy(
+					i8* inttoptr (i64 512 to i8*),
+					i8* inttoptr (i64 256 to i8*),
+					i32 3)
+			ret i32 0
+		}
+	)");
+	auto* f = getFunctionByName("f");
+
+	LlvmIrEmulator emu(module.get());
+	for (uint64_t i = 0; i < 3; ++i)
+	{
+		GenericValue v;
+		v.IntVal = APInt(8, 10 + i);
+		emu.setMemoryValue(256 + i, v);
+	}
+	emu.runFunction(f);
+
+	for (uint64_t i = 0; i < 3; ++i)
+	{
+		EXPECT_EQ(10 + i, emu.getMemoryValue(512 + i).IntVal.getZExtValue());
+	}
+}
+
+TEST_F(LlvmIrEmulatorTests, knownRoutineStrlenReturnsLength)
+{
+	parseInput(R"(
+		declare i32 @strlen(i8*)
+		define i32 @f() {
+			%a = call i32 @strlen(i8* inttoptr (i64 256 to i8*))
+			ret i32 %a
+		}
+	)");
+	auto* f = getFunctionByName("f");
+
+	LlvmIrEmulator emu(module.get());
+	GenericValue c;
+	c.IntVal = APInt(8, 'a');
+	emu.setMemoryValue(256, c);
+	c.IntVal = APInt(8, 'b');
+	emu.setMemoryValue(257, c);
+	c.IntVal = APInt(8, 0);
+	emu.setMemoryValue(258, c);
+	emu.runFunction(f);
+
+	EXPECT_EQ(2, emu.getExitValue().IntVal.getZExtValue());
+}
+
 } // tests
 } // llvmir_emul
 } // retdec
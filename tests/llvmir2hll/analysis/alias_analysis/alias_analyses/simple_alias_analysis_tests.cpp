@@ -238,6 +238,53 @@ VariableWhoseAddressIsNotTakenMayNotBePointed) {
 	EXPECT_FALSE(analysis->mayBePointed(varA));
 }
 
+TEST_F(SimpleAliasAnalysisTests,
+RefreshFuncsRecomputesSummaryOfGivenFunction) {
+	// Set-up the module.
+	//
+	// int *g;
+	//
+	// void test() {
+	//     int a;
+	//     int b;
+	//     g = &a;
+	// }
+	//
+	ShPtr<Variable> varG(Variable::create("g", PointerType::create(IntType::create(16))));
+	module->addGlobalVar(varG);
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(16)));
+	testFunc->addLocalVar(varB);
+	ShPtr<AssignStmt> assignGA(AssignStmt::create(varG, AddressOpExpr::create(varA)));
+	ShPtr<VarDefStmt> varDefB(VarDefStmt::create(varB, ShPtr<Expression>(), assignGA));
+	ShPtr<VarDefStmt> varDefA(VarDefStmt::create(varA, ShPtr<Expression>(), varDefB));
+	testFunc->setBody(varDefA);
+
+	analysis->init(module);
+
+	EXPECT_TRUE(analysis->mayBePointed(varA));
+	EXPECT_FALSE(analysis->mayBePointed(varB));
+
+	// Change the body of test() so that the address of `b` is taken instead
+	// of the address of `a`:
+	//
+	// void test() {
+	//     int a;
+	//     int b;
+	//     g = &b;
+	// }
+	//
+	ShPtr<AssignStmt> assignGB(AssignStmt::create(varG, AddressOpExpr::create(varB)));
+	varDefB->setSuccessor(assignGB);
+
+	analysis->refreshFuncs(module, FuncVector{testFunc});
+
+	// The stale summary of test() has to be replaced, not just extended.
+	EXPECT_FALSE(analysis->mayBePointed(varA));
+	EXPECT_TRUE(analysis->mayBePointed(varB));
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -0,0 +1,118 @@
+/**
+* @file tests/llvmir2hll/analysis/liveness_analysis_tests.cpp
+* @brief Tests for the @c liveness_analysis module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/analysis/liveness_analysis.h"
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/call_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c liveness_analysis module.
+*/
+class LivenessAnalysisTests: public TestsWithModule {
+protected:
+	virtual void SetUp() override {
+		TestsWithModule::SetUp();
+		la = LivenessAnalysis::create();
+	}
+
+protected:
+	ShPtr<LivenessAnalysis> la;
+};
+
+TEST_F(LivenessAnalysisTests,
+SummaryContainsReadAndWrittenVariables) {
+	// Set the module.
+	//
+	// def test():
+	//    a = 1
+	//    return b
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(varB));
+	ShPtr<AssignStmt> assignStmt(AssignStmt::create(varA,
+		ConstInt::create(1, 32), returnStmt));
+	testFunc->setBody(assignStmt);
+
+	ShPtr<UsedVars> livenessInfo(la->getLivenessInfo(testFunc));
+
+	EXPECT_TRUE(livenessInfo->isUsed(varA, false, true));
+	EXPECT_FALSE(livenessInfo->isUsed(varA, true, false));
+	EXPECT_TRUE(livenessInfo->isUsed(varB, true, false));
+	EXPECT_EQ(1, livenessInfo->getNumOfWrites(varA));
+	EXPECT_EQ(0, livenessInfo->getNumOfWrites(varB));
+	EXPECT_FALSE(livenessInfo->hasCalls());
+}
+
+TEST_F(LivenessAnalysisTests,
+SummaryOfFunctionWithCallHasCalls) {
+	// Set the module.
+	//
+	// def test():
+	//    testFuncDecl()
+	//
+	ShPtr<Function> funcDecl(addFuncDecl("testFuncDecl"));
+	ShPtr<CallExpr> callExpr(CallExpr::create(funcDecl->getAsVar()));
+	ShPtr<CallStmt> callStmt(CallStmt::create(callExpr));
+	testFunc->setBody(callStmt);
+
+	ShPtr<UsedVars> livenessInfo(la->getLivenessInfo(testFunc));
+
+	EXPECT_TRUE(livenessInfo->hasCalls());
+}
+
+TEST_F(LivenessAnalysisTests,
+SummaryIsCachedUntilFuncHasBeenChangedIsCalled) {
+	// Set the module.
+	//
+	// def test():
+	//    a = 1
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<AssignStmt> assignStmt(AssignStmt::create(varA,
+		ConstInt::create(1, 32)));
+	testFunc->setBody(assignStmt);
+
+	ShPtr<UsedVars> livenessInfo1(la->getLivenessInfo(testFunc));
+	ShPtr<UsedVars> livenessInfo2(la->getLivenessInfo(testFunc));
+	EXPECT_EQ(livenessInfo1, livenessInfo2) <<
+		"the summary should be cached";
+
+	// Change the body of the function.
+	//
+	// def test():
+	//    return a
+	//
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(varA));
+	testFunc->setBody(returnStmt);
+	la->funcHasBeenChanged(testFunc);
+
+	ShPtr<UsedVars> livenessInfo3(la->getLivenessInfo(testFunc));
+	EXPECT_TRUE(livenessInfo3->isUsed(varA, true, false));
+	EXPECT_FALSE(livenessInfo3->isUsed(varA, false, true));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,105 @@
+/**
+* @file tests/llvmir2hll/analysis/loop_info_analysis_tests.cpp
+* @brief Tests for the @c loop_info_analysis module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/analysis/loop_info_analysis.h"
+#include "retdec/llvmir2hll/ir/break_stmt.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/empty_stmt.h"
+#include "retdec/llvmir2hll/ir/if_stmt.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/ir/while_loop_stmt.h"
+#include "retdec/llvmir2hll/utils/loop_optimizer.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c loop_info_analysis module.
+*/
+class LoopInfoAnalysisTests: public TestsWithModule {
+protected:
+	virtual void SetUp() override {
+		TestsWithModule::SetUp();
+		loopInfo = LoopInfoAnalysis::create();
+	}
+
+	ShPtr<WhileLoopStmt> createSplittableWhileTrueLoop();
+
+protected:
+	ShPtr<LoopInfoAnalysis> loopInfo;
+};
+
+/**
+* @brief Creates a "while true" loop that can be splitted.
+*
+* The loop is of the following form:
+* @code
+* while True:
+*     if b:
+*         break
+* @endcode
+*/
+ShPtr<WhileLoopStmt> LoopInfoAnalysisTests::createSplittableWhileTrueLoop() {
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(1)));
+	ShPtr<IfStmt> ifStmt(IfStmt::create(varB, BreakStmt::create()));
+	return WhileLoopStmt::create(ConstBool::create(true), ifStmt);
+}
+
+TEST_F(LoopInfoAnalysisTests,
+GetSplittedLoopReturnsSplitOfSplittableWhileTrueLoop) {
+	ShPtr<WhileLoopStmt> whileLoop(createSplittableWhileTrueLoop());
+
+	ShPtr<SplittedWhileTrueLoop> splittedLoop(
+		loopInfo->getSplittedLoop(whileLoop));
+
+	ASSERT_TRUE(splittedLoop);
+	EXPECT_TRUE(splittedLoop->loopEnd);
+}
+
+TEST_F(LoopInfoAnalysisTests,
+GetSplittedLoopReturnsNullPointerForNonWhileTrueLoop) {
+	ShPtr<WhileLoopStmt> whileLoop(WhileLoopStmt::create(
+		ConstBool::create(false), EmptyStmt::create()));
+
+	EXPECT_FALSE(loopInfo->getSplittedLoop(whileLoop));
+}
+
+TEST_F(LoopInfoAnalysisTests,
+SplittedLoopIsCachedUntilLoopHasBeenChangedIsCalled) {
+	ShPtr<WhileLoopStmt> whileLoop(createSplittableWhileTrueLoop());
+
+	ShPtr<SplittedWhileTrueLoop> splittedLoop1(
+		loopInfo->getSplittedLoop(whileLoop));
+	ShPtr<SplittedWhileTrueLoop> splittedLoop2(
+		loopInfo->getSplittedLoop(whileLoop));
+	EXPECT_EQ(splittedLoop1, splittedLoop2) <<
+		"the splitted loop should be cached";
+
+	// Change the body of the loop so it no longer contains a loop end.
+	whileLoop->setBody(EmptyStmt::create());
+	loopInfo->loopHasBeenChanged(whileLoop);
+
+	EXPECT_FALSE(loopInfo->getSplittedLoop(whileLoop)) <<
+		"the splitted loop should have been re-computed";
+}
+
+TEST_F(LoopInfoAnalysisTests,
+GetIndVarInfoReturnsNullPointerForLoopWithoutInductionVariable) {
+	ShPtr<WhileLoopStmt> whileLoop(createSplittableWhileTrueLoop());
+
+	EXPECT_FALSE(loopInfo->getIndVarInfo(whileLoop));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
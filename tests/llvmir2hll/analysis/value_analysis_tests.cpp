@@ -700,6 +700,45 @@ AfterStatementChangeAndCacheUpdateCorrectResultsAreReturned) {
 	EXPECT_EQ(varB, *newReadVarsInReturnA.begin());
 }
 
+TEST_F(ValueAnalysisTests,
+RemoveDependentFromCacheDropsOnlyResultsComputedFromTheVariable) {
+	// Set-up the module.
+	//
+	// a
+	// b
+	//
+	// void test() {
+	//     return a;
+	//     return b;   // unreachable; just to have a second statement
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	module->addGlobalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	module->addGlobalVar(varB);
+	ShPtr<ReturnStmt> returnB(ReturnStmt::create(varB));
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA, returnB));
+	testFunc->setBody(returnA);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	// Cache the results for both statements.
+	va->getValueData(returnA);
+	ShPtr<ValueData> dataOfReturnB(va->getValueData(returnB));
+
+	// Now, change `return a` to `return b`, remove the results computed from
+	// `a` from va's cache, and check that the new version of `returnA` is
+	// re-analyzed while the cached result for `returnB` is kept.
+	returnA->replace(varA, varB);
+	va->removeDependentFromCache(varA);
+
+	VarSet newReadVarsInReturnA(va->getValueData(returnA)->getDirReadVars());
+	EXPECT_EQ(1, newReadVarsInReturnA.size());
+	EXPECT_EQ(varB, *newReadVarsInReturnA.begin());
+	EXPECT_EQ(dataOfReturnB, va->getValueData(returnB)) <<
+		"the cached result for `return b` should have been kept";
+}
+
 TEST_F(ValueAnalysisTests,
 MayBeReadNoCaching) {
 	// Set-up the module.
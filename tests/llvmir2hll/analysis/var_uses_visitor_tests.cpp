@@ -281,6 +281,49 @@ GlobalVariableIsIndirectlyUsedMay) {
 	}
 }
 
+TEST_F(VarUsesVisitorTests,
+StmtHasBeenChangedRegistersUsesOfNewlyIntroducedVariable) {
+	// Set-up the module.
+	//
+	// def test():
+	//    return 1
+	//
+	// which is changed (after the visitor is created) into
+	//
+	// def test():
+	//    return b
+	//
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(ConstInt::create(1, 32)));
+	testFunc->setBody(returnStmt);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	FOR_EVERY_VAR_USES_VISITOR_VARIANT {
+		// Make sure the uses are (pre)computed before the change.
+		EXPECT_FALSE(vuv->isUsed(varB, testFunc, false)) << vuvDesc;
+
+		returnStmt->setRetVal(varB);
+		va->removeFromCache(returnStmt);
+		vuv->stmtHasBeenChanged(returnStmt, testFunc);
+
+		// isUsed()
+		EXPECT_TRUE(vuv->isUsed(varB, testFunc, false)) << vuvDesc;
+
+		// getUses()
+		ShPtr<VarUses> varBUses(vuv->getUses(varB, testFunc));
+		EXPECT_EQ(varB, varBUses->var) << vuvDesc;
+		EXPECT_EQ(testFunc, varBUses->func) << vuvDesc;
+		StmtSet refVarBDirUses;
+		refVarBDirUses.insert(returnStmt);
+		EXPECT_EQ(refVarBDirUses, varBUses->dirUses) << vuvDesc;
+
+		// Restore the original body for the next visitor variant.
+		returnStmt->setRetVal(ConstInt::create(1, 32));
+		va->removeFromCache(returnStmt);
+		vuv->stmtHasBeenChanged(returnStmt, testFunc);
+	}
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
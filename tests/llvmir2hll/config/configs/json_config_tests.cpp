@@ -658,6 +658,25 @@ MarkFuncAsStaticallyLinkedSetsFuncAsStaticallyLinked) {
 	ASSERT_TRUE(config->isStaticallyLinkedFunc("my_func"));
 }
 
+TEST_F(JSONConfigTests,
+MarkFuncAsStaticallyLinkedIsVisibleThroughRepeatedQueries) {
+	auto config = JSONConfig::fromString(R"({
+		"functions": [
+			{
+				"name": "my_func",
+				"fncType": "dynamicallyLinked"
+			}
+		]
+	})");
+
+	// The function's record is queried (and so cached) before it is marked.
+	ASSERT_FALSE(config->isStaticallyLinkedFunc("my_func"));
+
+	config->markFuncAsStaticallyLinked("my_func");
+
+	ASSERT_TRUE(config->isStaticallyLinkedFunc("my_func"));
+}
+
 //
 // getDeclarationStringForFunc()
 //
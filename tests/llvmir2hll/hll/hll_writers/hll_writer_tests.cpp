@@ -95,6 +95,48 @@ std::string HLLWriterTests::emitCodeForCurrentModule() {
 	return codeStream.str();
 }
 
+//
+// Emission of functions in chunks.
+//
+
+TEST_F(HLLWriterTests,
+EmittingFunctionsInChunksProducesTheSameCode) {
+	writer->setOptionEmitTimeVaryingInfo(false);
+	auto codeEmittedAtOnce = emitCodeForCurrentModule();
+
+	std::string chunkedCode;
+	llvm::raw_string_ostream chunkedCodeStream(chunkedCode);
+	auto chunkedWriter = CHLLWriter::create(chunkedCodeStream);
+	chunkedWriter->setOptionEmitTimeVaryingInfo(false);
+	chunkedWriter->setOptionEmitFunctionsInChunks();
+	chunkedWriter->emitTargetCode(module);
+
+	ASSERT_EQ(codeEmittedAtOnce, chunkedCodeStream.str());
+}
+
+//
+// Parallel emission of functions.
+//
+
+TEST_F(HLLWriterTests,
+EmittingFunctionsInParallelProducesTheSameCode) {
+	addFuncDef("func1");
+	addFuncDef("func2");
+	addFuncDef("func3");
+
+	writer->setOptionEmitTimeVaryingInfo(false);
+	auto codeEmittedSequentially = emitCodeForCurrentModule();
+
+	std::string parallelCode;
+	llvm::raw_string_ostream parallelCodeStream(parallelCode);
+	auto parallelWriter = CHLLWriter::create(parallelCodeStream);
+	parallelWriter->setOptionEmitTimeVaryingInfo(false);
+	parallelWriter->setOptionEmitFunctionsInParallel();
+	parallelWriter->emitTargetCode(module);
+
+	ASSERT_EQ(codeEmittedSequentially, parallelCodeStream.str());
+}
+
 //
 // Emission of classes.
 //
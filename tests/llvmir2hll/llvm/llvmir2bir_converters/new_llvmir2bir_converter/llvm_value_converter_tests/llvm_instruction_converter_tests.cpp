@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 #include <llvm/IR/Argument.h>
+#include <llvm/IR/Constants.h>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/InstrTypes.h>
 #include <llvm/IR/Instructions.h>
@@ -21,6 +22,8 @@
 #include "retdec/llvmir2hll/ir/bit_shl_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_shr_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/div_op_expr.h"
 #include "retdec/llvmir2hll/ir/eq_op_expr.h"
 #include "retdec/llvmir2hll/ir/expression.h"
@@ -570,6 +573,50 @@ SelectInstructionIsConvertedCorrectly) {
 	ASSERT_TRUE(areTernaryOperandsInCorrectOrder(birTernaryOpExpr));
 }
 
+TEST_F(LLVMInstructionsConverterTests,
+AddInstructionWithConstantOperandsIsFoldedIntoConstant) {
+	auto type = llvm::Type::getInt32Ty(context);
+	auto op1 = llvm::ConstantInt::get(type, 2);
+	auto op2 = llvm::ConstantInt::get(type, 3);
+	auto llvmInst = UPtr<llvm::BinaryOperator>(llvm::BinaryOperator::Create(
+		llvm::Instruction::Add, op1, op2));
+
+	auto birInst = converter->convertInstructionToExpression(llvmInst.get());
+
+	auto birConstInt = cast<ConstInt>(birInst);
+	ASSERT_TRUE(birConstInt);
+	ASSERT_EQ(5, birConstInt->getValue().getZExtValue());
+}
+
+TEST_F(LLVMInstructionsConverterTests,
+ICmpInstructionWithConstantOperandsIsFoldedIntoConstant) {
+	auto type = llvm::Type::getInt32Ty(context);
+	auto op1 = llvm::ConstantInt::get(type, 1);
+	auto op2 = llvm::ConstantInt::get(type, 1);
+	auto llvmInst = UPtr<llvm::CmpInst>(llvm::CmpInst::Create(
+		llvm::Instruction::ICmp, llvm::ICmpInst::ICMP_EQ, op1, op2));
+
+	auto birInst = converter->convertInstructionToExpression(llvmInst.get());
+
+	auto birConstBool = cast<ConstBool>(birInst);
+	ASSERT_TRUE(birConstBool);
+	ASSERT_TRUE(birConstBool->getValue());
+}
+
+TEST_F(LLVMInstructionsConverterTests,
+SDivInstructionWithZeroConstantDivisorIsNotFolded) {
+	auto type = llvm::Type::getInt32Ty(context);
+	auto op1 = llvm::ConstantInt::get(type, 2);
+	auto op2 = llvm::ConstantInt::get(type, 0);
+	auto llvmInst = UPtr<llvm::BinaryOperator>(llvm::BinaryOperator::Create(
+		llvm::Instruction::SDiv, op1, op2));
+
+	auto birInst = converter->convertInstructionToExpression(llvmInst.get());
+
+	auto birDivExpr = cast<DivOpExpr>(birInst);
+	ASSERT_TRUE(birDivExpr);
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
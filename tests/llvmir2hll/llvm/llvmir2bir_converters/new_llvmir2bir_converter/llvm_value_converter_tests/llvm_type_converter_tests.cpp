@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 #include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Type.h>
 
 #include "retdec/llvmir2hll/ir/array_type.h"
@@ -18,6 +19,7 @@
 #include "retdec/llvmir2hll/ir/struct_type.h"
 #include "retdec/llvmir2hll/ir/type.h"
 #include "retdec/llvmir2hll/ir/void_type.h"
+#include "retdec/llvmir2hll/llvm/llvmir2bir_converters/new_llvmir2bir_converter/llvm_type_converter.h"
 #include "llvmir2hll/llvm/llvmir2bir_converters/new_llvmir2bir_converter_tests/base_tests.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 
@@ -303,6 +305,27 @@ VoidTypeIsConvertedCorrectly) {
 	ASSERT_TRUE(isa<VoidType>(birType));
 }
 
+TEST_F(LLVMTypeConverterTests,
+RepeatedConversionOfSameLLVMTypeReturnsSameBIRType) {
+	llvm::LLVMContext context;
+	LLVMTypeConverter converter;
+	auto llvmElemType = llvm::Type::getInt32Ty(context);
+	auto llvmArrayType = llvm::ArrayType::get(llvmElemType, 10);
+	auto llvmPtrType = llvm::PointerType::getUnqual(llvmArrayType);
+
+	auto birArrayType1 = converter.convert(llvmArrayType);
+	auto birArrayType2 = converter.convert(llvmArrayType);
+	auto birPtrType1 = converter.convert(llvmPtrType);
+	auto birPtrType2 = converter.convert(llvmPtrType);
+
+	ASSERT_EQ(birArrayType1, birArrayType2);
+	ASSERT_EQ(birPtrType1, birPtrType2);
+	// The generic overload has to hit the very same cache as the typed ones.
+	ASSERT_EQ(birArrayType1,
+		converter.convert(static_cast<const llvm::Type *>(llvmArrayType)));
+	ASSERT_EQ(birArrayType1, birPtrType1->getContainedType());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -0,0 +1,145 @@
+/**
+* @file tests/llvmir2hll/optimizer/optimizers/fused_peephole_optimizer_tests.cpp
+* @brief Tests for the @c fused_peephole_optimizer module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/empty_stmt.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/optimizer/optimizers/fused_peephole_optimizer.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c fused_peephole_optimizer module.
+*/
+class FusedPeepholeOptimizerTests: public TestsWithModule {
+protected:
+	/// Rules used by most of the tests.
+	std::vector<FusedPeepholeOptimizer::RewriteRule> defaultRules = {
+		FusedPeepholeOptimizer::createSelfAssignRule(),
+		FusedPeepholeOptimizer::createEmptyStmtRule(),
+	};
+};
+
+TEST_F(FusedPeepholeOptimizerTests,
+OptimizerHasNonEmptyID) {
+	ShPtr<FusedPeepholeOptimizer> optimizer(
+		new FusedPeepholeOptimizer(module, defaultRules));
+
+	EXPECT_TRUE(!optimizer->getId().empty()) <<
+		"the optimizer should have a non-empty ID";
+}
+
+TEST_F(FusedPeepholeOptimizerTests,
+WithoutRulesNothingIsOptimized) {
+	// Add a body to the testing function:
+	//
+	// a = a  (VarA)
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	testFunc->addLocalVar(varA);
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA, varA));
+	testFunc->setBody(assignA);
+
+	// Optimize the module.
+	Optimizer::optimize<FusedPeepholeOptimizer>(module,
+		std::vector<FusedPeepholeOptimizer::RewriteRule>());
+
+	// Check that the output is correct.
+	EXPECT_EQ(assignA, testFunc->getBody()) <<
+		"expected " << assignA << ", got " << testFunc->getBody();
+}
+
+TEST_F(FusedPeepholeOptimizerTests,
+SelfAssignAndEmptyStmtsAreRemovedInOneRun) {
+	// Add a body to the testing function:
+	//
+	// a = a       (VarA)
+	// (empty statement)
+	// return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<EmptyStmt> emptyStmt(EmptyStmt::create(returnA));
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA, varA, emptyStmt));
+	testFunc->setBody(assignA);
+
+	// Optimize the module.
+	Optimizer::optimize<FusedPeepholeOptimizer>(module, defaultRules);
+
+	// Check that the output is correct.
+	EXPECT_EQ(returnA, testFunc->getBody()) <<
+		"expected " << returnA << ", got " << testFunc->getBody();
+	EXPECT_TRUE(!testFunc->getBody()->hasSuccessor()) <<
+		"expected no successors of the statement, but got " <<
+		testFunc->getBody()->getSuccessor();
+}
+
+TEST_F(FusedPeepholeOptimizerTests,
+ChainOfSelfAssignsIsCompletelyRemoved) {
+	// Add a body to the testing function:
+	//
+	// a = a       (VarA)
+	// a = a       (VarA)
+	// a = a       (VarA)
+	// return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignA3(AssignStmt::create(varA, varA, returnA));
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA, varA, assignA3));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA, varA, assignA2));
+	testFunc->setBody(assignA1);
+
+	// Optimize the module.
+	Optimizer::optimize<FusedPeepholeOptimizer>(module, defaultRules);
+
+	// Check that the output is correct.
+	EXPECT_EQ(returnA, testFunc->getBody()) <<
+		"expected " << returnA << ", got " << testFunc->getBody();
+}
+
+TEST_F(FusedPeepholeOptimizerTests,
+OrdinaryAssignStmtIsKept) {
+	// Add a body to the testing function:
+	//
+	// a = 1       (VarA)
+	// return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA,
+		ConstInt::create(llvm::APInt(16, 1)), returnA));
+	testFunc->setBody(assignA);
+
+	// Optimize the module.
+	Optimizer::optimize<FusedPeepholeOptimizer>(module, defaultRules);
+
+	// Check that the output is correct.
+	EXPECT_EQ(assignA, testFunc->getBody()) <<
+		"expected " << assignA << ", got " << testFunc->getBody();
+	EXPECT_EQ(returnA, testFunc->getBody()->getSuccessor()) <<
+		"expected " << returnA << ", got " <<
+		testFunc->getBody()->getSuccessor();
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -137,12 +137,13 @@ OptimizesNestedEqualityComparisons) {
 
 	auto varA = Variable::create("a", IntType::create(32));
 	auto ltExpr = LtOpExpr::create(varA, ConstInt::create(1, 32));
-	auto returnExpr = EqOpExpr::create(
-		EqOpExpr::create(ltExpr, ConstBool::create(true)),
-		ConstBool::create(true)
-	);
+	auto innerExpr = EqOpExpr::create(ltExpr, ConstBool::create(true));
+	auto returnExpr = EqOpExpr::create(innerExpr, ConstBool::create(true));
 	auto returnStmt = ReturnStmt::create(returnExpr);
 
+	// Nested expressions are optimized bottom-up by the driving optimizer, so
+	// simulate it by optimizing the inner comparison first.
+	optimizer->tryOptimize(innerExpr);
 	optimizer->tryOptimize(returnStmt->getRetVal());
 
 	ASSERT_BIR_EQ(ltExpr, returnStmt->getRetVal());
@@ -158,12 +159,13 @@ OptimizesNestedNonEqualityComparisons) {
 
 	auto varA = Variable::create("a", IntType::create(32));
 	auto ltExpr = LtOpExpr::create(varA, ConstInt::create(1, 32));
-	auto returnExpr = NeqOpExpr::create(
-		NeqOpExpr::create(ltExpr, ConstBool::create(false)),
-		ConstBool::create(false)
-	);
+	auto innerExpr = NeqOpExpr::create(ltExpr, ConstBool::create(false));
+	auto returnExpr = NeqOpExpr::create(innerExpr, ConstBool::create(false));
 	auto returnStmt = ReturnStmt::create(returnExpr);
 
+	// Nested expressions are optimized bottom-up by the driving optimizer, so
+	// simulate it by optimizing the inner comparison first.
+	optimizer->tryOptimize(innerExpr);
 	optimizer->tryOptimize(returnStmt->getRetVal());
 
 	ASSERT_BIR_EQ(ltExpr, returnStmt->getRetVal());
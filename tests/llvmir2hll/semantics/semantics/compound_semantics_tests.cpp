@@ -145,6 +145,39 @@ GetCHeaderFileForFuncReturnsAnswerIfSecondSemanticsAddedByPrependKnowsTheAnswer)
 	EXPECT_EQ("stdio.h", answer.get());
 }
 
+TEST_F(CompoundSemanticsTests,
+GetCHeaderFileForFuncAsksProvidedSemanticsJustOnceForRepeatedQueries) {
+	INSTANTIATE_SEMANTICS_MOCK(semantics);
+	EXPECT_CALL(*semanticsMock, getCHeaderFileForFunc("printf"))
+		.Times(1)
+		.WillOnce(Return(Just("stdio.h"s)));
+	compoundSemantics->appendSemantics(semantics);
+
+	Maybe<std::string> answer1(compoundSemantics->getCHeaderFileForFunc("printf"));
+	Maybe<std::string> answer2(compoundSemantics->getCHeaderFileForFunc("printf"));
+	ASSERT_TRUE(answer2);
+	EXPECT_EQ("stdio.h", answer2.get());
+}
+
+TEST_F(CompoundSemanticsTests,
+GetCHeaderFileForFuncReturnsFreshAnswerWhenNewSemanticsIsAddedAfterQuery) {
+	INSTANTIATE_SEMANTICS_MOCK(semantics1);
+	ON_CALL(*semantics1Mock, getCHeaderFileForFunc("printf"))
+		.WillByDefault(Return(Nothing<std::string>()));
+	compoundSemantics->appendSemantics(semantics1);
+
+	EXPECT_FALSE(compoundSemantics->getCHeaderFileForFunc("printf"));
+
+	INSTANTIATE_SEMANTICS_MOCK(semantics2);
+	ON_CALL(*semantics2Mock, getCHeaderFileForFunc("printf"))
+		.WillByDefault(Return(Just("stdio.h"s)));
+	compoundSemantics->appendSemantics(semantics2);
+
+	Maybe<std::string> answer(compoundSemantics->getCHeaderFileForFunc("printf"));
+	ASSERT_TRUE(answer);
+	EXPECT_EQ("stdio.h", answer.get());
+}
+
 //
 // funcNeverReturns()
 //
@@ -0,0 +1,80 @@
+/**
+* @file tests/llvmir2hll/support/value_arena_tests.cpp
+* @brief Tests for the @c value_arena module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/support/value_arena.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c value_arena module.
+*/
+class ValueArenaTests: public Test {};
+
+TEST_F(ValueArenaTests,
+AllocatedBlocksAreDistinctAndAligned) {
+	ValueArena arena;
+
+	auto *p1 = arena.allocate(24);
+	auto *p2 = arena.allocate(24);
+
+	EXPECT_NE(p1, p2);
+	EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(p1)
+			% alignof(std::max_align_t));
+	EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(p2)
+			% alignof(std::max_align_t));
+
+	arena.deallocate(p1, 24);
+	arena.deallocate(p2, 24);
+}
+
+TEST_F(ValueArenaTests,
+DeallocatedBlockIsReusedForSameSize) {
+	ValueArena arena;
+
+	auto *p1 = arena.allocate(24);
+	arena.deallocate(p1, 24);
+	auto *p2 = arena.allocate(24);
+
+	EXPECT_EQ(p1, p2);
+
+	arena.deallocate(p2, 24);
+}
+
+TEST_F(ValueArenaTests,
+ManyAllocationsComeFromFewChunks) {
+	ValueArena arena;
+
+	for (int i = 0; i < 1000; ++i) {
+		arena.allocate(64);
+	}
+
+	// 1000 * 64 B fits into one 256 KiB chunk.
+	EXPECT_EQ(1, arena.getNumOfAllocatedChunks());
+}
+
+TEST_F(ValueArenaTests,
+OversizedRequestsAreServedOutsideOfChunks) {
+	ValueArena arena;
+
+	auto *p = arena.allocate(4096);
+
+	EXPECT_NE(nullptr, p);
+	EXPECT_EQ(0, arena.getNumOfAllocatedChunks());
+
+	arena.deallocate(p, 4096);
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
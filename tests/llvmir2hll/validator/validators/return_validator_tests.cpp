@@ -93,6 +93,51 @@ ErrorOnVoidWithReturnValue) {
 	EXPECT_FALSE(validator->validate(module));
 }
 
+TEST_F(ReturnValidatorTests,
+ValidateFuncsChecksJustTheGivenFunctions) {
+	// Set-up the module.
+	//
+	// void test() {
+	//    return 1;   // error
+	// }
+	//
+	// int test2() {
+	//    return 1;   // correct
+	// }
+	//
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(ConstInt::create(1, 16)));
+	testFunc->setBody(returnStmt);
+	ShPtr<Function> testFunc2 = FunctionBuilder("test2")
+		.definitionWithBody(ReturnStmt::create(ConstInt::create(1, 16)))
+		.withRetType(IntType::create(32))
+		.build();
+	module->addFunc(testFunc2);
+
+	// Only test2() is validated, so the error in test() is not detected.
+	EXPECT_TRUE(validator->validateFuncs(module, FuncVector{testFunc2}));
+
+	EXPECT_FALSE(validator->validateFuncs(module, FuncVector{testFunc}));
+}
+
+TEST_F(ReturnValidatorTests,
+ValidateFuncsCanBeRunRepeatedlyOverSameFunction) {
+	// Set-up the module.
+	//
+	// void test() {
+	//    return 1;   // error
+	// }
+	//
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(ConstInt::create(1, 16)));
+	testFunc->setBody(returnStmt);
+
+	EXPECT_FALSE(validator->validateFuncs(module, FuncVector{testFunc}));
+
+	// After the return statement is fixed, the revalidation has to succeed,
+	// i.e. the validator cannot skip the already visited statement.
+	returnStmt->setRetVal(ShPtr<Expression>());
+	EXPECT_TRUE(validator->validateFuncs(module, FuncVector{testFunc}));
+}
+
 TEST_F(ReturnValidatorTests,
 ErrorOnNonVoidWithoutReturnValue) {
 	// Set-up the module.
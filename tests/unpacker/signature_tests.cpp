@@ -198,6 +198,18 @@ GetCaptureSizeWorks) {
 	EXPECT_EQ(1, sig.getCaptureSize());
 }
 
+TEST_F(SignatureTests,
+GetByteWorks) {
+	Signature sig = { 0x30, CAP, ANY, 0x32 };
+
+	EXPECT_EQ(Signature::Byte::Type::NORMAL, sig.getByte(0).getType());
+	EXPECT_EQ(0x30, sig.getByte(0).getExpectedValue());
+	EXPECT_EQ(Signature::Byte::Type::CAPTURE, sig.getByte(1).getType());
+	EXPECT_EQ(Signature::Byte::Type::WILDCARD, sig.getByte(2).getType());
+	EXPECT_EQ(0xFF, sig.getByte(2).getWildcardMask());
+	EXPECT_EQ(0x32, sig.getByte(3).getExpectedValue());
+}
+
 TEST_F(SignatureTests,
 ExactMatchWithoutCaptureWorks) {
 	Signature sig = { 0x40, 0x41, 0x42, 0x43 };
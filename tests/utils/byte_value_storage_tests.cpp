@@ -532,6 +532,8 @@ TEST_F(ByteValueStorageTests,
 GetNByteArrayFailsIfGetXByteFails) {
 	MockByteValueStorage storage;
 
+	EXPECT_CALL(storage, getXBytes(_,_,_))
+		.WillRepeatedly(Return(false));
 	EXPECT_CALL(storage, getXByte(_,_,_,_))
 		.Times(4)
 		.WillRepeatedly(Return(false));
@@ -547,6 +549,8 @@ TEST_F(ByteValueStorageTests,
 Get1ByteArrayWorks) {
 	MockByteValueStorage storage;
 
+	EXPECT_CALL(storage, getXBytes(_,_,_))
+		.WillRepeatedly(Return(false));
 	EXPECT_CALL(storage, getXByte(AllOf(Ge(0),Le(4)),1,_,_))
 		.Times(4)
 		.WillOnce(DoAll(SetArgReferee<2>(0x10), Return(true)))
@@ -565,6 +569,8 @@ TEST_F(ByteValueStorageTests,
 Get2ByteArrayWorks) {
 	MockByteValueStorage storage;
 
+	EXPECT_CALL(storage, getXBytes(_,_,_))
+		.WillRepeatedly(Return(false));
 	EXPECT_CALL(storage, getXByte(AllOf(Ge(0),Le(8)),2,_,_))
 		.Times(4)
 		.WillOnce(DoAll(SetArgReferee<2>(0x1000), Return(true)))
@@ -583,6 +589,8 @@ TEST_F(ByteValueStorageTests,
 Get4ByteArrayWorks) {
 	MockByteValueStorage storage;
 
+	EXPECT_CALL(storage, getXBytes(_,_,_))
+		.WillRepeatedly(Return(false));
 	EXPECT_CALL(storage, getXByte(AllOf(Ge(0),Le(16)),4,_,_))
 		.Times(4)
 		.WillOnce(DoAll(SetArgReferee<2>(0x10001000), Return(true)))
@@ -601,6 +609,8 @@ TEST_F(ByteValueStorageTests,
 Get8ByteArrayWorks) {
 	MockByteValueStorage storage;
 
+	EXPECT_CALL(storage, getXBytes(_,_,_))
+		.WillRepeatedly(Return(false));
 	EXPECT_CALL(storage, getXByte(AllOf(Ge(0),Le(32)),8,_,_))
 		.Times(4)
 		.WillOnce(DoAll(SetArgReferee<2>(0x1000100010001000), Return(true)))
@@ -615,6 +625,49 @@ Get8ByteArrayWorks) {
 	EXPECT_EQ(expected, loaded);
 }
 
+TEST_F(ByteValueStorageTests,
+Get4ByteArrayReadsWholeArrayInOneBulkRead) {
+	MockByteValueStorage storage;
+
+	std::vector<std::uint8_t> bytes =
+			{ 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x20 };
+
+	EXPECT_CALL(storage, getEndianness())
+		.WillRepeatedly(Return(Endianness::LITTLE));
+	EXPECT_CALL(storage, getByteLength())
+		.WillRepeatedly(Return(8));
+	EXPECT_CALL(storage, getXBytes(0,8,_))
+		.Times(1)
+		.WillOnce(DoAll(SetArgReferee<2>(bytes), Return(true)));
+	EXPECT_CALL(storage, getXByte(_,_,_,_))
+		.Times(0);
+
+	std::vector<std::uint64_t> expected = { 0x10001000, 0x20002000 };
+
+	std::vector<std::uint64_t> loaded;
+	EXPECT_TRUE(storage.get4ByteArray(0, loaded, 2));
+	EXPECT_EQ(expected, loaded);
+}
+
+TEST_F(ByteValueStorageTests,
+Get2ByteArrayBulkReadHonorsForcedBigEndian) {
+	MockByteValueStorage storage;
+
+	std::vector<std::uint8_t> bytes = { 0x12, 0x34, 0x56, 0x78 };
+
+	EXPECT_CALL(storage, getByteLength())
+		.WillRepeatedly(Return(8));
+	EXPECT_CALL(storage, getXBytes(0,4,_))
+		.Times(1)
+		.WillOnce(DoAll(SetArgReferee<2>(bytes), Return(true)));
+
+	std::vector<std::uint64_t> expected = { 0x1234, 0x5678 };
+
+	std::vector<std::uint64_t> loaded;
+	EXPECT_TRUE(storage.get2ByteArray(0, loaded, 2, Endianness::BIG));
+	EXPECT_EQ(expected, loaded);
+}
+
 } // namespace tests
 } // namespace utils
 } // namespace retdec
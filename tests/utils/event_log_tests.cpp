@@ -0,0 +1,78 @@
+/**
+* @file tests/utils/event_log_tests.cpp
+* @brief Tests for the @c event_log module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/event_log.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace event_log {
+namespace tests {
+
+/**
+* @brief Tests for the @c event_log module.
+*
+* The event log cannot be disabled once enabled, so all the tests here run
+* with an enabled log and only check their own sites and records.
+*/
+class EventLogTests: public Test {
+protected:
+	virtual void SetUp() override {
+		enable();
+	}
+};
+
+TEST_F(EventLogTests,
+IsEnabledReturnsTrueAfterEnable) {
+	ASSERT_TRUE(isEnabled());
+}
+
+TEST_F(EventLogTests,
+SitesGetDistinctIds) {
+	static Site site1("event-log-tests/distinct-1");
+	static Site site2("event-log-tests/distinct-2");
+
+	ASSERT_NE(site1.getId(), site2.getId());
+}
+
+TEST_F(EventLogTests,
+RecordedEventAppearsInFormattedTrace) {
+	static Site site("event-log-tests/appears");
+	record(site, 1234, 5678);
+
+	std::ostringstream trace;
+	formatTrace(trace);
+
+	ASSERT_NE(std::string::npos,
+		trace.str().find("event-log-tests/appears 1234 5678"));
+}
+
+TEST_F(EventLogTests,
+InternedTextIsResolvedInFormattedTrace) {
+	static Site site("event-log-tests/text", /* arg0IsText */ true);
+	record(site, internText("some phase"), 2);
+
+	std::ostringstream trace;
+	formatTrace(trace);
+
+	ASSERT_NE(std::string::npos,
+		trace.str().find("event-log-tests/text \"some phase\" 2"));
+}
+
+TEST_F(EventLogTests,
+InterningSameTextTwiceReturnsSameId) {
+	ASSERT_EQ(internText("repeated text"), internText("repeated text"));
+}
+
+} // namespace tests
+} // namespace event_log
+} // namespace utils
+} // namespace retdec
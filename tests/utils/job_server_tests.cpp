@@ -0,0 +1,81 @@
+/**
+* @file tests/utils/job_server_tests.cpp
+* @brief Tests for the @c job_server module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/job_server.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c job_server module.
+*/
+class JobServerTests: public Test {};
+
+TEST_F(JobServerTests,
+ExtractDaemonOptionReturnsEmptyStringWhenOptionIsNotPresent) {
+	char tool[] = "tool";
+	char input[] = "input.bc";
+	char* argv[] = {tool, input};
+	int argc = 2;
+
+	ASSERT_EQ("", JobServer::extractDaemonOption(argc, argv));
+	ASSERT_EQ(2, argc);
+}
+
+TEST_F(JobServerTests,
+ExtractDaemonOptionExtractsTwoArgumentForm) {
+	char tool[] = "tool";
+	char option[] = "-daemon";
+	char socket[] = "/tmp/tool.sock";
+	char input[] = "input.bc";
+	char* argv[] = {tool, option, socket, input};
+	int argc = 4;
+
+	ASSERT_EQ("/tmp/tool.sock", JobServer::extractDaemonOption(argc, argv));
+	ASSERT_EQ(2, argc);
+	ASSERT_EQ(std::string("input.bc"), argv[1]);
+}
+
+TEST_F(JobServerTests,
+ExtractDaemonOptionExtractsEqualsSignForm) {
+	char tool[] = "tool";
+	char option[] = "--daemon=/tmp/tool.sock";
+	char input[] = "input.bc";
+	char* argv[] = {tool, option, input};
+	int argc = 3;
+
+	ASSERT_EQ("/tmp/tool.sock", JobServer::extractDaemonOption(argc, argv));
+	ASSERT_EQ(2, argc);
+	ASSERT_EQ(std::string("input.bc"), argv[1]);
+}
+
+TEST_F(JobServerTests,
+ExtractDaemonOptionReturnsEmptyStringWhenSocketPathIsMissing) {
+	char tool[] = "tool";
+	char option[] = "-daemon";
+	char* argv[] = {tool, option};
+	int argc = 2;
+
+	ASSERT_EQ("", JobServer::extractDaemonOption(argc, argv));
+}
+
+TEST_F(JobServerTests,
+ListenOnFailsForEmptySocketPath) {
+	JobServer server("");
+
+	ASSERT_FALSE(server.listenOn());
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
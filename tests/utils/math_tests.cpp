@@ -47,6 +47,43 @@ TEST_F(MathTests, bitSizeOfNumberCountsOK) {
 	EXPECT_EQ(4, bitSizeOfNumber(8));
 }
 
+//
+// byteHistogram()
+//
+
+TEST_F(MathTests, byteHistogramCountsOK) {
+	// 7 bytes so both the unrolled loop and its scalar tail are used.
+	const unsigned char data[] = {0x00, 0xff, 0x00, 0x41, 0x41, 0x41, 0xff};
+	std::uint64_t counts[256];
+
+	byteHistogram(data, sizeof(data), counts);
+
+	EXPECT_EQ(2, counts[0x00]);
+	EXPECT_EQ(3, counts[0x41]);
+	EXPECT_EQ(2, counts[0xff]);
+	EXPECT_EQ(0, counts[0x01]);
+}
+
+//
+// byteEntropy()
+//
+
+TEST_F(MathTests, byteEntropyComputesOK) {
+	EXPECT_DOUBLE_EQ(0.0, byteEntropy(nullptr, 0));
+
+	const unsigned char same[] = {0x41, 0x41, 0x41, 0x41};
+	EXPECT_DOUBLE_EQ(0.0, byteEntropy(same, sizeof(same)));
+
+	const unsigned char half[] = {0x00, 0x01, 0x00, 0x01};
+	EXPECT_DOUBLE_EQ(1.0, byteEntropy(half, sizeof(half)));
+
+	unsigned char all[256];
+	for (std::size_t i = 0; i < 256; ++i) {
+		all[i] = static_cast<unsigned char>(i);
+	}
+	EXPECT_DOUBLE_EQ(8.0, byteEntropy(all, sizeof(all)));
+}
+
 } // namespace tests
 } // namespace utils
 } // namespace retdec
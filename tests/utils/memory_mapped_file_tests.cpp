@@ -0,0 +1,100 @@
+/**
+* @file tests/utils/memory_mapped_file_tests.cpp
+* @brief Tests for the @c memory_mapped_file module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/memory_mapped_file.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c memory_mapped_file module.
+*/
+class MemoryMappedFileTests: public Test {
+protected:
+	virtual void TearDown() override {
+		if (!filePath.empty()) {
+			std::remove(filePath.c_str());
+		}
+	}
+
+	/// Creates a temporary file with the given content and returns its path.
+	std::string createFileWithContent(const std::string &content) {
+		filePath = "memory_mapped_file_tests.tmp";
+		std::ofstream file(filePath, std::ofstream::binary);
+		file << content;
+		return filePath;
+	}
+
+private:
+	/// Path of the created temporary file (if any).
+	std::string filePath;
+};
+
+TEST_F(MemoryMappedFileTests,
+NothingIsMappedAfterConstruction) {
+	MemoryMappedFile file;
+
+	EXPECT_FALSE(file.isMapped());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+TEST_F(MemoryMappedFileTests,
+MapMakesContentOfFileAccessible) {
+	const std::string content("content of the file");
+	MemoryMappedFile file;
+
+	ASSERT_TRUE(file.map(createFileWithContent(content)));
+
+	ASSERT_TRUE(file.isMapped());
+	ASSERT_EQ(content.size(), file.getSize());
+	EXPECT_EQ(content, std::string(
+		reinterpret_cast<const char *>(file.getData()), file.getSize()));
+}
+
+TEST_F(MemoryMappedFileTests,
+MapOfEmptyFileSucceedsWithNoContent) {
+	MemoryMappedFile file;
+
+	ASSERT_TRUE(file.map(createFileWithContent("")));
+
+	EXPECT_TRUE(file.isMapped());
+	EXPECT_EQ(0, file.getSize());
+}
+
+TEST_F(MemoryMappedFileTests,
+MapOfNonExistingFileFails) {
+	MemoryMappedFile file;
+
+	ASSERT_FALSE(file.map("this-file-does-not-exist"));
+
+	EXPECT_FALSE(file.isMapped());
+}
+
+TEST_F(MemoryMappedFileTests,
+UnmapReleasesMapping) {
+	MemoryMappedFile file;
+	ASSERT_TRUE(file.map(createFileWithContent("content")));
+
+	file.unmap();
+
+	EXPECT_FALSE(file.isMapped());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
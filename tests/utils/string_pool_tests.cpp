@@ -0,0 +1,66 @@
+/**
+* @file tests/utils/string_pool_tests.cpp
+* @brief Tests for the @c string_pool module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/string_pool.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c string_pool module.
+*/
+class StringPoolTests: public Test {};
+
+TEST_F(StringPoolTests,
+InternReturnsEqualString) {
+	StringPool pool;
+	EXPECT_EQ("name", pool.intern("name"));
+}
+
+TEST_F(StringPoolTests,
+EqualStringsAreInternedOnce) {
+	StringPool pool;
+	const auto& first = pool.intern("name");
+	const auto& second = pool.intern("name");
+	EXPECT_EQ(&first, &second);
+	EXPECT_EQ(1, pool.size());
+}
+
+TEST_F(StringPoolTests,
+DistinctStringsGetDistinctCopies) {
+	StringPool pool;
+	const auto& first = pool.intern("name1");
+	const auto& second = pool.intern("name2");
+	EXPECT_NE(&first, &second);
+	EXPECT_EQ(2, pool.size());
+}
+
+TEST_F(StringPoolTests,
+ReferencesStayValidAcrossInsertions) {
+	StringPool pool;
+	const auto& first = pool.intern("name");
+	for (int i = 0; i < 1000; ++i) {
+		pool.intern("name" + std::to_string(i));
+	}
+	EXPECT_EQ("name", first);
+	EXPECT_EQ(&first, &pool.intern("name"));
+}
+
+TEST_F(StringPoolTests,
+ProcessWidePoolInternsOnce) {
+	const auto& first = internString("StringPoolTests unique name");
+	const auto& second = internString("StringPoolTests unique name");
+	EXPECT_EQ(&first, &second);
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
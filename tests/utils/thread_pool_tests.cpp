@@ -0,0 +1,108 @@
+/**
+* @file tests/utils/thread_pool_tests.cpp
+* @brief Tests for the @c thread_pool module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/thread_pool.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c thread_pool module.
+*/
+class ThreadPoolTests: public Test {
+protected:
+	virtual void TearDown() override {
+		// Several tests change the process-wide budget.
+		setMaxParallelism(0);
+	}
+};
+
+TEST_F(ThreadPoolTests,
+MaxParallelismIsAtLeastOneByDefault) {
+	ASSERT_GE(maxParallelism(), 1);
+}
+
+TEST_F(ThreadPoolTests,
+SetMaxParallelismOverridesTheDefaultBudget) {
+	setMaxParallelism(3);
+
+	ASSERT_EQ(3, maxParallelism());
+}
+
+TEST_F(ThreadPoolTests,
+SetMaxParallelismToZeroRestoresTheDefaultBudget) {
+	auto defaultBudget = maxParallelism();
+	setMaxParallelism(defaultBudget + 5);
+	setMaxParallelism(0);
+
+	ASSERT_EQ(defaultBudget, maxParallelism());
+}
+
+TEST_F(ThreadPoolTests,
+ParallelForDoesNothingWhenCountIsZero) {
+	std::atomic<std::size_t> calls(0);
+
+	parallelFor(0, [&](std::size_t) { ++calls; });
+
+	ASSERT_EQ(0, calls.load());
+}
+
+TEST_F(ThreadPoolTests,
+ParallelForCallsActionExactlyOnceForEveryIndex) {
+	std::vector<std::atomic<int>> calls(100);
+	for (auto &c : calls) {
+		c = 0;
+	}
+
+	parallelFor(calls.size(), [&](std::size_t i) { ++calls[i]; });
+
+	for (std::size_t i = 0; i < calls.size(); ++i) {
+		ASSERT_EQ(1, calls[i].load()) << "index " << i;
+	}
+}
+
+TEST_F(ThreadPoolTests,
+ParallelForRunsAllIndexesWhenBudgetIsOne) {
+	setMaxParallelism(1);
+	std::atomic<std::size_t> calls(0);
+
+	parallelFor(50, [&](std::size_t) { ++calls; });
+
+	ASSERT_EQ(50, calls.load());
+}
+
+TEST_F(ThreadPoolTests,
+NestedParallelForRunsAllIndexesOfBothLevels) {
+	std::atomic<std::size_t> calls(0);
+
+	parallelFor(10, [&](std::size_t) {
+		parallelFor(10, [&](std::size_t) { ++calls; });
+	});
+
+	ASSERT_EQ(100, calls.load());
+}
+
+TEST_F(ThreadPoolTests,
+RunWorkersRunsWorkerAtLeastOnce) {
+	setMaxParallelism(1);
+	std::atomic<std::size_t> runs(0);
+
+	runWorkers(8, [&]() { ++runs; });
+
+	ASSERT_GE(runs.load(), 1);
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec